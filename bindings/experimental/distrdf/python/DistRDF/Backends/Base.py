@@ -11,9 +11,12 @@
 ################################################################################
 from __future__ import annotations
 
+import math
+import pickle
+import zlib
 from abc import ABC, abstractmethod
 from dataclasses import dataclass
-from functools import partial
+from functools import partial, reduce
 from typing import Callable, Iterable, List, Optional, TYPE_CHECKING, Union
 
 import ROOT
@@ -90,6 +93,22 @@ class TaskResult:
     mergeables: Optional[List]
     entries_in_trees: Optional[Ranges.TaskTreeEntries]
 
+    def __getstate__(self):
+        """
+        Task results travel between the workers at every level of the
+        reduction tree. The mergeables, e.g. histograms with many empty bins,
+        are streamed once and compressed as a whole rather than pickled one by
+        one.
+        """
+        return {
+            "mergeables": zlib.compress(pickle.dumps(self.mergeables, protocol=pickle.HIGHEST_PROTOCOL)),
+            "entries_in_trees": self.entries_in_trees,
+        }
+
+    def __setstate__(self, state):
+        self.mergeables = pickle.loads(zlib.decompress(state["mergeables"]))
+        self.entries_in_trees = state["entries_in_trees"]
+
 
 def distrdf_mapper(
         current_range: Union[Ranges.EmptySourceRange, Ranges.TreeRangePerc],
@@ -168,6 +187,32 @@ def distrdf_reducer(results_inout: TaskResult,
 
     return TaskResult(mergeables_updated, entries_in_trees_out)
 
+def distrdf_tree_reducer(reducer: Callable[[TaskResult, TaskResult], TaskResult],
+                         *results: TaskResult) -> TaskResult:
+    """
+    Merges the results of a node of the reduction tree, i.e. of up to
+    `BaseBackend.reduction_fanin` tasks or nodes of the previous level, into
+    the first one.
+    """
+    return reduce(reducer, results)
+
+
+def get_tree_reduction_depth(npartitions: int, fanin: int) -> int:
+    """
+    Returns the number of levels of a reduction tree of the given fan-in that
+    merges the results of `npartitions` tasks.
+    """
+    if npartitions <= 1:
+        return 1
+    # Compute the depth in integers to avoid rounding issues of math.log
+    depth = 0
+    nresults = npartitions
+    while nresults > 1:
+        nresults = math.ceil(nresults / fanin)
+        depth += 1
+    return depth
+
+
 class BaseBackend(ABC):
     """
     Base class for RDataFrame distributed backends.
@@ -181,10 +226,16 @@ class BaseBackend(ABC):
             analysis.
         shared_libraries (list): List of shared libraries needed for the
             analysis.
+        reduction_fanin (int): Number of partial results merged by each task
+            of the reduction tree that backends run on the workers. Larger
+            values mean fewer levels, hence fewer transfers of intermediate
+            results, but less parallelism in the reduction.
     """
 
     initialization = staticmethod(lambda: None)
 
+    reduction_fanin = 8
+
     headers = set()
     shared_libraries = set()
 
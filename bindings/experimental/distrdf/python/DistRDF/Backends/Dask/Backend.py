@@ -12,7 +12,9 @@
 from __future__ import annotations
 
 import os
-from typing import Any, Dict, Optional, TYPE_CHECKING
+import socket
+from functools import partial
+from typing import Any, Dict, Optional, Set, TYPE_CHECKING
 
 from DistRDF import DataFrame
 from DistRDF import HeadNode
@@ -90,6 +92,24 @@ def get_total_cores(client: Client) -> int:
     return get_total_cores_generic(client)
 
 
+def get_worker_hosts(client: Client) -> Set[str]:
+    """
+    Retrieve the addresses of the hosts of the workers of the Dask cluster.
+    """
+    return {worker["host"] for worker in client.scheduler_info()["workers"].values()}
+
+
+def resolve_host(host: str) -> str:
+    """
+    Return the address of a host, which is how the Dask scheduler identifies
+    the hosts of the workers, or the host itself if it cannot be resolved.
+    """
+    try:
+        return socket.gethostbyname(host)
+    except OSError:
+        return host
+
+
 class DaskBackend(Base.BaseBackend):
     """Dask backend for distributed RDataFrame."""
 
@@ -171,13 +191,35 @@ class DaskBackend(Base.BaseBackend):
             return mapper(current_range)
 
         dmapper = dask.delayed(dask_mapper)
-        dreducer = dask.delayed(reducer)
-
-        mergeables_lists = [dmapper(range) for range in ranges]
-
+        dreducer = dask.delayed(partial(Base.distrdf_tree_reducer, reducer))
+
+        # Tasks whose files are held by the host of some worker are restricted
+        # to the workers of those hosts, loosely so that idle workers can
+        # still steal them. Tasks reading remote files are the slower ones:
+        # they are given a higher priority, so that they do not make up the
+        # tail of the computation.
+        worker_hosts = get_worker_hosts(self.client)
+        mergeables_lists = []
+        for range in ranges:
+            hosts = [host for host in map(resolve_host, getattr(range, "hosts", [])) if host in worker_hosts]
+            if hosts:
+                annotations = {"workers": hosts, "allow_other_workers": True}
+            elif getattr(range, "hosts", []):
+                annotations = {"priority": 1}
+            else:
+                annotations = {}
+            with dask.annotate(**annotations):
+                mergeables_lists.append(dmapper(range))
+
+        # Build the reduction tree level by level: every task merges up to
+        # `reduction_fanin` results of the previous level on a worker, so the
+        # client only receives the final result
+        fanin = self.reduction_fanin
         while len(mergeables_lists) > 1:
-            mergeables_lists.append(
-                dreducer(mergeables_lists.pop(0), mergeables_lists.pop(0)))
+            mergeables_lists = [
+                dreducer(*mergeables_lists[i:i + fanin])
+                for i in range(0, len(mergeables_lists), fanin)
+            ]
 
         # Here we start the progressbar for the current RDF computation graph
         # running on the Dask client. This expects a future object, so we need
@@ -188,7 +230,9 @@ class DaskBackend(Base.BaseBackend):
         # shown only if it's the last call in a cell. Since we're encapsulating
         # it in this class, it won't be shown. Full details at
         # https://docs.dask.org/en/latest/diagnostics-distributed.html#dask.distributed.progress
-        final_results = mergeables_lists.pop().persist()
+        # The graph is not optimized, as fusing its tasks would drop the
+        # scheduling annotations of the mappers.
+        final_results = mergeables_lists.pop().persist(optimize_graph=False)
         progress(final_results)
 
         return final_results.compute()
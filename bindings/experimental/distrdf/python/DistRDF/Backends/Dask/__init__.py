@@ -21,3 +21,16 @@ def RDataFrame(*args, **kwargs):
     daskbackend = Backend.DaskBackend(daskclient=daskclient)
 
     return daskbackend.make_dataframe(*args, **kwargs)
+
+
+def ProcessSelector(selector, treename, filenames, npartitions=None, inputs=None, daskclient=None):
+    """
+    Process a tree with a TSelector on a Dask cluster, see
+    DistRDF.Selector.process_selector.
+    """
+
+    from DistRDF import Selector
+    from DistRDF.Backends.Dask import Backend
+    daskbackend = Backend.DaskBackend(daskclient=daskclient)
+
+    return Selector.process_selector(daskbackend, selector, treename, filenames, npartitions, inputs)
@@ -131,8 +131,10 @@ class SparkBackend(Base.BaseBackend):
         # Build parallel collection
         parallel_collection = self.sc.parallelize(ranges, len(ranges))
 
-        # Map-Reduce using Spark
-        return parallel_collection.map(spark_mapper).treeReduce(reducer)
+        # Map-Reduce using Spark. The depth of the reduction tree executed on
+        # the workers follows from the fan-in of the backend
+        depth = Base.get_tree_reduction_depth(len(ranges), self.reduction_fanin)
+        return parallel_collection.map(spark_mapper).treeReduce(reducer, depth=depth)
 
     def distribute_unique_paths(self, paths):
         """
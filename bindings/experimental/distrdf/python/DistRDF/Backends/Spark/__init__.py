@@ -21,3 +21,16 @@ def RDataFrame(*args, **kwargs):
     spark = Backend.SparkBackend(sparkcontext=sparkcontext)
 
     return spark.make_dataframe(*args, **kwargs)
+
+
+def ProcessSelector(selector, treename, filenames, npartitions=None, inputs=None, sparkcontext=None):
+    """
+    Process a tree with a TSelector on a Spark cluster, see
+    DistRDF.Selector.process_selector.
+    """
+
+    from DistRDF import Selector
+    from DistRDF.Backends.Spark import Backend
+    spark = Backend.SparkBackend(sparkcontext=sparkcontext)
+
+    return Selector.process_selector(spark, selector, treename, filenames, npartitions, inputs)
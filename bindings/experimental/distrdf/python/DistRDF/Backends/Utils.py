@@ -208,6 +208,24 @@ def _(mergeable_out, mergeable_in):
     mergeable_out.Merge(mergeable_in)
 
 
+@merge_values.register(ROOT.TList)
+def _(mergeable_out, mergeable_in):
+    """
+    The output lists of distributed TSelectors are merged object by object with
+    TList::Merge, which expects a collection of lists to merge with.
+    """
+    if mergeable_in.IsEmpty():
+        return
+    if mergeable_out.IsEmpty():
+        # Take the objects over, the input list will not be used anymore
+        mergeable_out.AddAll(mergeable_in)
+        mergeable_in.SetOwner(False)
+        return
+    inputs = ROOT.TList()
+    inputs.Add(mergeable_in)
+    mergeable_out.Merge(inputs)
+
+
 @singledispatch
 def set_value_on_node(mergeable, node, backend):
     """
@@ -38,6 +38,7 @@ def build_backends_submodules(parentmodule: types.ModuleType) -> types.ModuleTyp
 
             # Attached functions
             dummy.RDataFrame = actual.RDataFrame
+            dummy.ProcessSelector = actual.ProcessSelector
 
             setattr(parentmodule, module_name, dummy)
 
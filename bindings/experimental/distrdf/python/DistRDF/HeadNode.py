@@ -498,28 +498,36 @@ class TreeHeadNode(HeadNode):
             raise RuntimeError("The distributed execution returned no values. "
                                "This can happen if all files in your dataset contain empty trees.")
 
-        # User could have requested to read the same file multiple times indeed
-        input_files_and_trees = [
-            f"{filename}?#{treename}" for filename, treename in zip(self.inputfiles, self.subtreenames)
-        ]
-        files_counts = Counter(input_files_and_trees)
-
-        entries_in_trees = values.entries_in_trees
-        # Keys should be exactly the same
-        if files_counts.keys() != entries_in_trees.trees_with_entries.keys():
-            raise RuntimeError("The specified input files and the files that were "
-                                "actually processed are not the same:\n"
-                                f"Input files: {list(files_counts.keys())}\n"
-                                f"Processed files: {list(entries_in_trees.trees_with_entries.keys())}")
-
-        # Multiply the entries of each tree by the number of times it was
-        # requested by the user
-        for fullpath in files_counts:
-            entries_in_trees.trees_with_entries[fullpath] *= files_counts[fullpath]
-
-        total_dataset_entries = sum(entries_in_trees.trees_with_entries.values())
-        if entries_in_trees.processed_entries != total_dataset_entries:
-            raise RuntimeError(f"The dataset has {total_dataset_entries} entries, "
-                               f"but {entries_in_trees.processed_entries} were processed.")
+        check_processed_entries(self.inputfiles, self.subtreenames, values.entries_in_trees)
 
         return values.mergeables
+
+
+def check_processed_entries(inputfiles: List[str], subtreenames: List[str],
+                            entries_in_trees: Ranges.TaskTreeEntries) -> None:
+    """
+    Checks that exactly the input trees and all their entries were processed
+    during distributed execution.
+    """
+    # User could have requested to read the same file multiple times indeed
+    input_files_and_trees = [
+        f"{filename}?#{treename}" for filename, treename in zip(inputfiles, subtreenames)
+    ]
+    files_counts = Counter(input_files_and_trees)
+
+    # Keys should be exactly the same
+    if files_counts.keys() != entries_in_trees.trees_with_entries.keys():
+        raise RuntimeError("The specified input files and the files that were "
+                           "actually processed are not the same:\n"
+                           f"Input files: {list(files_counts.keys())}\n"
+                           f"Processed files: {list(entries_in_trees.trees_with_entries.keys())}")
+
+    # Multiply the entries of each tree by the number of times it was
+    # requested by the user
+    for fullpath in files_counts:
+        entries_in_trees.trees_with_entries[fullpath] *= files_counts[fullpath]
+
+    total_dataset_entries = sum(entries_in_trees.trees_with_entries.values())
+    if entries_in_trees.processed_entries != total_dataset_entries:
+        raise RuntimeError(f"The dataset has {total_dataset_entries} entries, "
+                           f"but {entries_in_trees.processed_entries} were processed.")
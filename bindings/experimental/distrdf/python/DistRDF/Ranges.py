@@ -4,6 +4,7 @@ import logging
 
 from bisect import bisect_left
 from dataclasses import dataclass, field
+from functools import lru_cache
 from itertools import accumulate
 from math import floor
 
@@ -142,6 +143,9 @@ class TreeRangePerc(DataRange):
     first_tree_start_perc: float
     last_tree_end_perc: float
     friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo]
+    # Hosts of the data servers holding the files of the task, used by the
+    # backends to schedule the task close to its data
+    hosts: List[str] = field(default_factory=list)
 
 
 @dataclass
@@ -178,6 +182,40 @@ def get_clusters_and_entries(treename: str, filename: str) -> Tuple[List[int], i
     return clusters, entries
 
 
+@lru_cache(maxsize=None)
+def get_file_hosts(filename: str) -> Tuple[str, ...]:
+    """
+    Retrieve the hosts of the data servers holding a remote file, as reported
+    by the XRootD redirector. Local files, as well as files whose location
+    cannot be determined, are not bound to any host.
+    """
+    if not filename.startswith(("root://", "roots://", "xroot://")):
+        return ()
+
+    try:
+        xrdsystem = ROOT.TNetXNGSystem(filename)
+        endurl = ROOT.TString()
+        if xrdsystem.Locate(filename, endurl) != 0:
+            return ()
+        host = ROOT.TUrl(str(endurl)).GetHost()
+    except (AttributeError, TypeError, ROOT.std.exception) as e:
+        logger.debug("Could not locate file %s: %s", filename, e)
+        return ()
+
+    return (host,) if host else ()
+
+
+def get_hosts_of_files(filenames: List[str]) -> List[str]:
+    """
+    Retrieve the hosts of the data servers holding any of the given files,
+    without duplicates and in order of first appearance.
+    """
+    hosts: Dict[str, None] = {}
+    for filename in filenames:
+        hosts.update(dict.fromkeys(get_file_hosts(filename)))
+    return list(hosts)
+
+
 def get_percentage_ranges(treenames: List[str], filenames: List[str], npartitions: int,
                           friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo]) -> List[TreeRangePerc]:
     """
@@ -229,7 +267,8 @@ def get_percentage_ranges(treenames: List[str], filenames: List[str], npartition
         # task, in order to properly align the full dataset considering friends.
         return [
             TreeRangePerc(rangeid, treenames, filenames, start_sample_idxs[rangeid], end_sample_idxs[rangeid],
-                          first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo)
+                          first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo,
+                          get_hosts_of_files(filenames[start_sample_idxs[rangeid]:end_sample_idxs[rangeid]]))
             for rangeid in range(npartitions)
         ]
     else:
@@ -246,7 +285,8 @@ def get_percentage_ranges(treenames: List[str], filenames: List[str], npartition
         return [
             TreeRangePerc(
                 rangeid, tasktreenames[rangeid], taskfilenames[rangeid], 0, len(taskfilenames[rangeid]),
-                first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo
+                first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo,
+                get_hosts_of_files(taskfilenames[rangeid])
             )
             for rangeid in range(npartitions)
         ]
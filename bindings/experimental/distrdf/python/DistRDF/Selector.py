@@ -0,0 +1,199 @@
+################################################################################
+# Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+from __future__ import annotations
+
+import logging
+from functools import partial
+from textwrap import dedent
+from typing import Callable, Iterable, Optional, TYPE_CHECKING, Union
+
+import ROOT
+
+from DistRDF import Ranges
+from DistRDF.Backends.Base import TaskResult, distrdf_reducer, setup_mapper
+from DistRDF.HeadNode import check_processed_entries
+
+if TYPE_CHECKING:
+    from DistRDF.Backends.Base import BaseBackend
+
+logger = logging.getLogger(__name__)
+
+# Worker side of a TSelector on a range of entries of a chain, i.e. the calls
+# that PROOF runs on its workers. The event loop is the one of
+# TTreePlayer::Process, without Begin and Terminate which run in the client.
+_process_selector_range_code = dedent("""
+    #include "TDirectory.h"
+    #include "TList.h"
+    #include "TSelector.h"
+    #include "TTree.h"
+
+    #include <stdexcept>
+    #include <string>
+
+    namespace DistRDF {
+    namespace Internal {
+    TList *ProcessSelectorRange(TSelector &selector, TTree &chain, Long64_t begin, Long64_t end)
+    {
+       TDirectory::TContext ctxt;
+       chain.SetNotify(&selector);
+       selector.SlaveBegin(&chain);
+       if (selector.Version() >= 2)
+          selector.Init(&chain);
+
+       const bool useCutFill = selector.Version() == 0;
+       for (auto entry = begin; entry < end && selector.GetAbort() != TSelector::kAbortProcess; ++entry) {
+          // Notify is called by the chain when it switches to the tree of the next file
+          const auto localEntry = chain.LoadTree(entry);
+          if (localEntry < 0)
+             break;
+          if (useCutFill) {
+             if (selector.ProcessCut(localEntry))
+                selector.ProcessFill(localEntry);
+          } else {
+             selector.Process(localEntry);
+          }
+          if (selector.GetAbort() == TSelector::kAbortFile) {
+             entry += chain.GetTree()->GetEntries() - localEntry - 1;
+             selector.ResetAbort();
+          }
+       }
+       chain.SetNotify(nullptr);
+       if (selector.GetAbort() == TSelector::kAbortProcess)
+          throw std::runtime_error(std::string("The processing was aborted by the selector ") + selector.ClassName());
+       selector.SlaveTerminate();
+
+       // Move the results out of the selector, which owns its output list
+       auto output = new TList;
+       output->SetOwner(kTRUE);
+       if (auto selectorOutput = selector.GetOutputList()) {
+          output->AddAll(selectorOutput);
+          selectorOutput->SetOwner(kFALSE);
+          selectorOutput->Clear();
+       }
+       return output;
+    }
+    } // namespace Internal
+    } // namespace DistRDF
+""")
+
+
+def declare_process_selector_range() -> None:
+    """
+    Declares the worker side event loop of a TSelector to the interpreter, once
+    per process.
+    """
+    if not hasattr(ROOT, "DistRDF") or not hasattr(ROOT.DistRDF.Internal, "ProcessSelectorRange"):
+        if not ROOT.gInterpreter.Declare(_process_selector_range_code):
+            raise RuntimeError("Failed to declare the event loop of distributed TSelectors.")
+
+
+def make_selector(selector_name: str, inputlist: ROOT.TList) -> ROOT.TSelector:
+    """
+    Creates an instance of the TSelector class with the given name and hands it
+    the input list.
+    """
+    selector = ROOT.TSelector.GetSelector(selector_name)
+    if not selector:
+        raise RuntimeError(f"Cannot create the selector {selector_name}. The class must derive from TSelector and be "
+                           "known to the interpreter, also on the workers (see DistRDF.initialize).")
+    ROOT.SetOwnership(selector, True)
+    selector.SetInputList(inputlist)
+    return selector
+
+
+def selector_mapper(current_range: Ranges.TreeRangePerc, selector_name: str, inputlist: ROOT.TList,
+                    initialization_fn: Callable) -> TaskResult:
+    """
+    Runs SlaveBegin, Process and SlaveTerminate of a new instance of the
+    selector on the clustered range of entries of the task, and returns its
+    output list.
+    """
+    try:
+        setup_mapper(initialization_fn)
+        declare_process_selector_range()
+
+        clustered_range, entries_in_trees = Ranges.get_clustered_range_from_percs(current_range)
+        if clustered_range is None:
+            return TaskResult(None, entries_in_trees)
+
+        chain = ROOT.TChain()
+        for treename, filename in zip(clustered_range.treenames, clustered_range.filenames):
+            chain.Add(f"{filename}?#{treename}")
+        selector = make_selector(selector_name, inputlist)
+        output = ROOT.DistRDF.Internal.ProcessSelectorRange(selector, chain, clustered_range.globalstart,
+                                                            clustered_range.globalend)
+        ROOT.SetOwnership(output, True)
+    except ROOT.std.exception as e:
+        raise RuntimeError(f"C++ exception thrown:\n\t{type(e).__name__}: {e.what()}")
+
+    return TaskResult([output], entries_in_trees)
+
+
+def process_selector(backend: BaseBackend, selector_name: str, treename: str, filenames: Union[str, Iterable[str]],
+                     npartitions: Optional[int] = None, inputs: Optional[Iterable[ROOT.TObject]] = None
+                     ) -> ROOT.TSelector:
+    """
+    Processes a tree with a TSelector on a distributed backend, like PROOF would
+    do. The dataset is split in ranges of clusters, as for distributed
+    RDataFrame. Begin runs in the local session, each task then runs SlaveBegin,
+    Process and SlaveTerminate of its own instance of the selector on its range
+    of entries. The output lists of the tasks are merged with TList::Merge into
+    the output list of the local selector, whose Terminate is called last.
+
+    Args:
+        backend: The distributed backend running the tasks.
+
+        selector_name (str): Name of the class deriving from TSelector. It must
+            be known to the interpreter in the local session and on the
+            workers, e.g. by including its header or loading its library in a
+            function registered with DistRDF.initialize.
+
+        treename (str): Name of the tree in the input files.
+
+        filenames (str, list[str]): Name or glob of the input files, or list
+            of them.
+
+        npartitions (int): Number of tasks to split the dataset in. Defaults
+            to the number of cores of the backend.
+
+        inputs (list[ROOT.TObject]): Objects added to the input list of the
+            selector, which is sent to all the tasks together with the objects
+            that Begin adds to it.
+
+    Returns:
+        ROOT.TSelector: The local selector, holding the merged output list.
+    """
+    chain = ROOT.TChain(treename)
+    for filename in [filenames] if isinstance(filenames, str) else filenames:
+        chain.Add(str(filename))
+    subtreenames = [str(name) for name in ROOT.Internal.TreeUtils.GetTreeFullPaths(chain)]
+    inputfiles = [str(name) for name in ROOT.Internal.TreeUtils.GetFileNamesFromTree(chain)]
+
+    inputlist = ROOT.TList()
+    for obj in inputs if inputs is not None else []:
+        inputlist.Add(obj)
+    selector = make_selector(selector_name, inputlist)
+    selector.Begin(ROOT.nullptr)
+
+    if npartitions is None:
+        npartitions = backend.optimize_npartitions()
+    ranges = Ranges.get_percentage_ranges(subtreenames, inputfiles, npartitions, None)
+    mapper = partial(selector_mapper, selector_name=selector_name, inputlist=inputlist,
+                     initialization_fn=backend.initialization)
+
+    logger.debug("Processing selector %s on %d tasks", selector_name, len(ranges))
+    values = backend.ProcessAndMerge(ranges, mapper, distrdf_reducer)
+    check_processed_entries(inputfiles, subtreenames, values.entries_in_trees)
+
+    if values.mergeables is not None:
+        merged = values.mergeables[0]
+        selector.GetOutputList().AddAll(merged)
+        merged.SetOwner(False)
+    selector.Terminate()
+
+    return selector
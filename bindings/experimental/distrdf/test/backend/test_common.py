@@ -75,3 +75,36 @@ class InitializationTest(unittest.TestCase):
         varvalue = 2
         DistRDF.initialize(defineIntVariable, "myInt", varvalue)
         self.assertEqual(ROOT.myInt, varvalue)
+
+
+class ReductionTreeTest(unittest.TestCase):
+    """Helpers of the reduction tree of the partial results"""
+
+    def test_tree_reduction_depth(self):
+        """The depth is the number of levels needed to merge all results."""
+        self.assertEqual(Base.get_tree_reduction_depth(1, 8), 1)
+        self.assertEqual(Base.get_tree_reduction_depth(8, 8), 1)
+        self.assertEqual(Base.get_tree_reduction_depth(9, 8), 2)
+        self.assertEqual(Base.get_tree_reduction_depth(64, 8), 2)
+        self.assertEqual(Base.get_tree_reduction_depth(1000, 8), 4)
+
+    def test_tree_reducer(self):
+        """All the results of a node of the tree are merged into the first."""
+        results = [Base.TaskResult([i], None) for i in range(5)]
+
+        def reducer(out, res):
+            return Base.TaskResult([out.mergeables[0] + res.mergeables[0]], None)
+
+        self.assertEqual(Base.distrdf_tree_reducer(reducer, *results).mergeables, [10])
+
+    def test_task_result_serialization(self):
+        """Task results are compressed when pickled and restored identically."""
+        import pickle
+        h = ROOT.TH1D("h_reduction_tree", "h", 10000, 0, 1)
+        h.Fill(0.5)
+        result = Base.TaskResult([h], None)
+        restored = pickle.loads(pickle.dumps(result))
+        self.assertIsNone(restored.entries_in_trees)
+        self.assertEqual(restored.mergeables[0].GetEntries(), 1)
+        self.assertEqual(restored.mergeables[0].GetNbinsX(), 10000)
+        self.assertLess(len(pickle.dumps(result)), len(pickle.dumps(h)))
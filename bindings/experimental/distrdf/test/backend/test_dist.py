@@ -1,7 +1,10 @@
 import unittest
 
+import ROOT
+
 from DistRDF import DataFrame
 from DistRDF import HeadNode
+from DistRDF import Selector
 from DistRDF.Backends import Base
 
 
@@ -81,3 +84,58 @@ class DistRDataFrameInvariants(unittest.TestCase):
             headnode = HeadNode.get_headnode(backend, npartitions, treename, filenames)
             rdf = DataFrame.RDataFrame(headnode)
             self.assertEqual(rdf.Count().GetValue(), 100)
+
+
+class DistTSelector(unittest.TestCase):
+    """
+    A TSelector processed on a distributed backend gives the same results for
+    any number of partitions.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        ROOT.gInterpreter.Declare("""
+        #include "TH1D.h"
+        #include "TParameter.h"
+        #include "TSelector.h"
+
+        class DistRDFTestSelector : public TSelector {
+        public:
+           TH1D *fHist = nullptr;
+           Int_t Version() const override { return 2; }
+           void Begin(TTree *) override { fInput->Add(new TNamed("begin", "called")); }
+           void SlaveBegin(TTree *) override
+           {
+              auto nbins = static_cast<TParameter<Int_t> *>(fInput->FindObject("nbins"))->GetVal();
+              fHist = new TH1D("localentries", "localentries", nbins, 0, nbins);
+              fHist->SetDirectory(nullptr);
+              fOutput->Add(fHist);
+              if (fInput->FindObject("begin"))
+                 fOutput->Add(new TNamed("slavebegin", "called"));
+           }
+           Bool_t Process(Long64_t entry) override
+           {
+              fHist->Fill(entry);
+              return kTRUE;
+           }
+           void Terminate() override { fHist = static_cast<TH1D *>(fOutput->FindObject("localentries")); }
+        };
+        """)
+
+    def test_selector_result_invariance(self):
+        """
+        Check the merged histogram filled by the selector and that the input
+        list filled by Begin reaches the tasks.
+        """
+        treename = "entries"
+        filenames = ["1cluster_20entries.root"] * 5
+
+        for npartitions in range(1, 6):
+            backend = DistRDataFrameInvariants.TestBackend()
+            nbins = ROOT.TParameter[int]("nbins", 20)
+            selector = Selector.process_selector(backend, "DistRDFTestSelector", treename, filenames,
+                                                 npartitions, [nbins])
+            self.assertEqual(selector.fHist.GetEntries(), 100)
+            for ibin in range(1, 21):
+                self.assertEqual(selector.fHist.GetBinContent(ibin), 5)
+            self.assertTrue(selector.GetOutputList().FindObject("slavebegin"))
@@ -518,3 +518,17 @@ class TreeRanges(unittest.TestCase):
         ]
 
         self.assertListEqual(ranges, ranges_reqd)
+
+    def test_local_files_have_no_hosts(self):
+        """
+        Ranges of local files are not bound to the hosts of any data server.
+        """
+        nfiles = 3
+        treenames = [f"tree_{i}" for i in range(nfiles)]
+        filenames = [f"distrdf_unittests_file_{i}.root" for i in range(nfiles)]
+        npartitions = 2
+
+        percranges = Ranges.get_percentage_ranges(treenames, filenames, npartitions, friendinfo=None)
+
+        self.assertListEqual([percrange.hosts for percrange in percranges], [[], []])
+        self.assertListEqual(Ranges.get_hosts_of_files(filenames), [])
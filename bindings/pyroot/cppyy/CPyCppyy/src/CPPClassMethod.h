@@ -14,6 +14,10 @@ public:
     virtual PyCallable* Clone() { return new CPPClassMethod(*this); }
     virtual PyObject* Call(
         CPPInstance*&, PyObject* args, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr) {
+        return PyCallable::VectorCall(self, args, nargs, ctxt);    // arguments are processed as a tuple
+    }
 };
 
 } // namespace CPyCppyy
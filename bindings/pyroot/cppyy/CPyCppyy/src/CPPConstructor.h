@@ -18,6 +18,10 @@ public:
 public:
     virtual PyObject* Call(
         CPPInstance*& self, PyObject* args, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr) {
+        return PyCallable::VectorCall(self, args, nargs, ctxt);    // arguments are processed as a tuple
+    }
 
 protected:
     virtual bool InitExecutor_(Executor*&, CallContext* ctxt = nullptr);
@@ -16,6 +16,10 @@ public:
 
     virtual PyObject* Call(
         CPPInstance*&, PyObject* args, PyObject* kwds, CallContext* ctx = nullptr);
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr) {
+        return PyCallable::VectorCall(self, args, nargs, ctxt);    // arguments are processed as a tuple
+    }
 
 protected:
     virtual PyObject* PreProcessArgs(CPPInstance*& self, PyObject* args, PyObject* kwds);
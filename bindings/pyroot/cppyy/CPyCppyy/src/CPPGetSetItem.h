@@ -13,6 +13,10 @@ public:
 
 public:
     virtual PyCallable* Clone() { return new CPPSetItem(*this); }
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr) {
+        return PyCallable::VectorCall(self, args, nargs, ctxt);    // arguments are processed as a tuple
+    }
 
 protected:
     virtual PyObject* PreProcessArgs(CPPInstance*& self, PyObject* args, PyObject* kwds);
@@ -25,6 +29,10 @@ public:
 
 public:
     virtual PyCallable* Clone() { return new CPPGetItem(*this); }
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr) {
+        return PyCallable::VectorCall(self, args, nargs, ctxt);    // arguments are processed as a tuple
+    }
 
 protected:
     virtual PyObject* PreProcessArgs(CPPInstance*& self, PyObject* args, PyObject* kwds);
@@ -677,7 +677,12 @@ PyObject* CPyCppyy::CPPMethod::PreProcessArgs(
 //----------------------------------------------------------------------------
 bool CPyCppyy::CPPMethod::ConvertAndSetArgs(PyObject* args, CallContext* ctxt)
 {
-    Py_ssize_t argc = PyTuple_GET_SIZE(args);
+    return ConvertAndSetArgs(PySequence_Fast_ITEMS(args), PyTuple_GET_SIZE(args), ctxt);
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::CPPMethod::ConvertAndSetArgs(PyObject* const* args, Py_ssize_t argc, CallContext* ctxt)
+{
     Py_ssize_t argMax = (Py_ssize_t)fConverters.size();
 
     if (argMax != argc) {
@@ -703,7 +708,7 @@ bool CPyCppyy::CPPMethod::ConvertAndSetArgs(PyObject* args, CallContext* ctxt)
     bool isOK = true;
     Parameter* cppArgs = ctxt->GetArgs(argc);
     for (int i = 0; i < (int)argc; ++i) {
-        if (!fConverters[i]->SetArg(PyTuple_GET_ITEM(args, i), cppArgs[i], ctxt)) {
+        if (!fConverters[i]->SetArg(args[i], cppArgs[i], ctxt)) {
             SetPyError_(CPyCppyy_PyText_FromFormat("could not convert argument %d", i+1));
             isOK = false;
             break;
@@ -761,13 +766,39 @@ PyObject* CPyCppyy::CPPMethod::Call(
         }
     }
 
+    PyObject* result = ExecuteOnSelf(self, ctxt);
+    Py_DECREF(args);
+    return result;
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::CPPMethod::VectorCall(
+    CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt)
+{
+// unbound calls need their self taken from the arguments: use the tuple based Call
+    if (!self)
+        return PyCallable::VectorCall(self, args, nargs, ctxt);
+
+// setup as necessary
+    if (fArgsRequired == -1 && !Initialize(ctxt))
+        return nullptr;
+
+// translate the arguments straight from the array, no tuple needed
+    if ((fArgsRequired || nargs) && !ConvertAndSetArgs(args, nargs, ctxt))
+        return nullptr;
+
+    return ExecuteOnSelf(self, ctxt);
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::CPPMethod::ExecuteOnSelf(CPPInstance*& self, CallContext* ctxt)
+{
 // get the C++ object that this object proxy is a handle for
     void* object = self->GetObject();
 
 // validity check that should not fail
     if (!object) {
         PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
-        Py_DECREF(args);
         return nullptr;
     }
 
@@ -781,7 +812,6 @@ PyObject* CPyCppyy::CPPMethod::Call(
 
 // actual call; recycle self instead of returning new object for same address objects
     CPPInstance* pyobj = (CPPInstance*)Execute(object, offset, ctxt);
-    Py_DECREF(args);
 
     if (CPPInstance_Check(pyobj) &&
             derived && pyobj->ObjectIsA() == derived &&
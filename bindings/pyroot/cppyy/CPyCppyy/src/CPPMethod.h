@@ -39,6 +39,8 @@ public:
 public:
     virtual PyObject* Call(
         CPPInstance*& self, PyObject* args, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr);
 
 protected:
     virtual PyObject* PreProcessArgs(CPPInstance*& self, PyObject* args, PyObject* kwds);
@@ -46,6 +48,7 @@ protected:
     bool      Initialize(CallContext* ctxt = nullptr);
     PyObject* ProcessKeywords(PyObject* self, PyObject* args, PyObject* kwds);
     bool      ConvertAndSetArgs(PyObject* args, CallContext* ctxt = nullptr);
+    bool      ConvertAndSetArgs(PyObject* const* args, Py_ssize_t argc, CallContext* ctxt = nullptr);
     PyObject* Execute(void* self, ptrdiff_t offset, CallContext* ctxt = nullptr);
 
     Cppyy::TCppMethod_t GetMethod()   { return fMethod; }
@@ -63,6 +66,7 @@ private:
     void Copy_(const CPPMethod&);
     void Destroy_();
 
+    PyObject* ExecuteOnSelf(CPPInstance*& self, CallContext* ctxt);
     PyObject* ExecuteFast(void*, ptrdiff_t, CallContext*);
     PyObject* ExecuteProtected(void*, ptrdiff_t, CallContext*);
 
@@ -34,6 +34,14 @@ static int numfree = 0;
 #define CPPOverload_MAXFREELIST 32
 #endif
 
+#if PY_VERSION_HEX >= 0x03090000
+#define CPPOverload_VECTORCALL_FLAG Py_TPFLAGS_HAVE_VECTORCALL
+#elif PY_VERSION_HEX >= 0x03080000
+#define CPPOverload_VECTORCALL_FLAG _Py_TPFLAGS_HAVE_VECTORCALL
+#else
+#define CPPOverload_VECTORCALL_FLAG 0
+#endif
+
 
 // TODO: only used here, but may be better off integrated with Pythonize.cxx callbacks
 class TPythonCallback : public PyCallable {
@@ -531,6 +539,19 @@ static PyGetSetDef mp_getset[] = {
 };
 
 //= CPyCppyy method proxy function behavior ==================================
+static inline void InitCallContext(CPPOverload* pymeth, CallContext& ctxt)
+{
+// Set the call flags that follow from the method (memory and GIL policies).
+    const auto mflags = pymeth->fMethodInfo->fFlags;
+    const auto mempolicy = (mflags & (CallContext::kUseHeuristics | CallContext::kUseStrict));
+    ctxt.fFlags |= mempolicy ? mempolicy : (uint64_t)CallContext::sMemoryPolicy;
+    ctxt.fFlags |= (mflags & CallContext::kReleaseGIL);
+    ctxt.fFlags |= (mflags & CallContext::kProtected);
+    if (IsConstructor(pymeth->fMethodInfo->fFlags)) ctxt.fFlags |= CallContext::kIsConstructor;
+    ctxt.fPyContext = (PyObject*)pymeth->fSelf;  // no Py_INCREF as no ownership
+}
+
+//----------------------------------------------------------------------------
 static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
 {
 // Call the appropriate overload of this method.
@@ -544,12 +565,7 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
 
     CallContext ctxt{};
     const auto mflags = pymeth->fMethodInfo->fFlags;
-    const auto mempolicy = (mflags & (CallContext::kUseHeuristics | CallContext::kUseStrict));
-    ctxt.fFlags |= mempolicy ? mempolicy : (uint64_t)CallContext::sMemoryPolicy;
-    ctxt.fFlags |= (mflags & CallContext::kReleaseGIL);
-    ctxt.fFlags |= (mflags & CallContext::kProtected);
-    if (IsConstructor(pymeth->fMethodInfo->fFlags)) ctxt.fFlags |= CallContext::kIsConstructor;
-    ctxt.fPyContext = (PyObject*)pymeth->fSelf;  // no Py_INCREF as no ownership
+    InitCallContext(pymeth, ctxt);
 
 // magic variable to prevent recursion passed by keyword?
     if (kwds && PyDict_CheckExact(kwds) && PyDict_Size(kwds) != 0) {
@@ -667,6 +683,88 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
     return nullptr;
 }
 
+#if PY_VERSION_HEX >= 0x03080000
+//----------------------------------------------------------------------------
+static PyObject* mp_vectorcall_tuple(
+    CPPOverload* pymeth, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
+{
+// Pack the vectorcall arguments into a tuple and keywords dict for the generic mp_call.
+    PyObject* pyargs = PyTuple_New(nargs);
+    if (!pyargs)
+        return nullptr;
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(pyargs, i, args[i]);
+    }
+
+    PyObject* kwds = nullptr;
+    if (kwnames && PyTuple_GET_SIZE(kwnames)) {
+        kwds = PyDict_New();
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(kwnames); ++i) {
+            if (PyDict_SetItem(kwds, PyTuple_GET_ITEM(kwnames, i), args[nargs+i]) != 0) {
+                Py_DECREF(kwds);
+                Py_DECREF(pyargs);
+                return nullptr;
+            }
+        }
+    }
+
+    PyObject* result = mp_call(pymeth, pyargs, kwds);
+    Py_XDECREF(kwds);
+    Py_DECREF(pyargs);
+    return result;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* mp_vectorcall(
+    CPPOverload* pymeth, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+// Call through the vectorcall protocol. For bound methods called with positional
+// arguments, the single or memoized overload converts them straight from the array;
+// all other calls, and finding the overload for a new signature, go through mp_call.
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (kwnames || !pymeth->fSelf || IsConstructor(pymeth->fMethodInfo->fFlags))
+        return mp_vectorcall_tuple(pymeth, args, nargs, kwnames);
+
+// C++ instances may be moved if only referenced by the arguments, which is decided on
+// their ref-counts as seen from an argument tuple
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        if (CPPInstance_Check(args[i]))
+            return mp_vectorcall_tuple(pymeth, args, nargs, kwnames);
+    }
+
+    auto& methods = pymeth->fMethodInfo->fMethods;
+    PyCallable* pc = nullptr;
+    if (methods.size() == 1)
+        pc = methods[0];
+    else {
+        uint64_t sighash = HashSignature(args, nargs, false);
+        for (const auto& p : pymeth->fMethodInfo->fDispatchMap) {
+            if (p.first == sighash) {
+                pc = p.second;
+                break;
+            }
+        }
+        if (!pc)
+            return mp_vectorcall_tuple(pymeth, args, nargs, kwnames);
+    }
+
+    CPPInstance* oldSelf = pymeth->fSelf;
+    CallContext ctxt{};
+    InitCallContext(pymeth, ctxt);
+    if (methods.size() == 1)
+        ctxt.fFlags |= CallContext::kAllowImplicit;    // no two rounds needed
+
+    PyObject* result = HandleReturn(pymeth, oldSelf, pc->VectorCall(pymeth->fSelf, args, nargs, &ctxt));
+    if (result || methods.size() == 1)
+        return result;
+
+// python is dynamic, and so, the hashing isn't infallible: resolve the overload anew
+    PyErr_Clear();
+    return mp_vectorcall_tuple(pymeth, args, nargs, kwnames);
+}
+#endif
+
 //----------------------------------------------------------------------------
 static PyObject* mp_str(CPPOverload* cppinst)
 {
@@ -705,6 +803,9 @@ static CPPOverload* mp_descrget(CPPOverload* pymeth, CPPInstance* pyobj, PyObjec
 // new method is to be bound to current object
     Py_INCREF((PyObject*)pyobj);
     newPyMeth->fSelf = pyobj;
+#if PY_VERSION_HEX >= 0x03080000
+    newPyMeth->fVectorCall = (vectorcallfunc)mp_vectorcall;
+#endif
 
     PyObject_GC_Track(newPyMeth);
     return newPyMeth;
@@ -718,6 +819,9 @@ static CPPOverload* mp_new(PyTypeObject*, PyObject*, PyObject*)
     CPPOverload* pymeth = PyObject_GC_New(CPPOverload, &CPPOverload_Type);
     pymeth->fSelf = nullptr;
     pymeth->fMethodInfo = new CPPOverload::MethodInfo_t;
+#if PY_VERSION_HEX >= 0x03080000
+    pymeth->fVectorCall = (vectorcallfunc)mp_vectorcall;
+#endif
 
     PyObject_GC_Track(pymeth);
     return pymeth;
@@ -867,7 +971,11 @@ PyTypeObject CPPOverload_Type = {
     sizeof(CPPOverload),           // tp_basicsize
     0,                             // tp_itemsize
     (destructor)mp_dealloc,        // tp_dealloc
+#if PY_VERSION_HEX >= 0x03080000
+    offsetof(CPPOverload, fVectorCall),    // tp_vectorcall_offset
+#else
     0,                             // tp_print
+#endif
     0,                             // tp_getattr
     0,                             // tp_setattr
     0,                             // tp_compare
@@ -881,7 +989,7 @@ PyTypeObject CPPOverload_Type = {
     0,                             // tp_getattro
     0,                             // tp_setattro
     0,                             // tp_as_buffer
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,      // tp_flags
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | CPPOverload_VECTORCALL_FLAG,    // tp_flags
     (char*)"cppyy method proxy (internal)",       // tp_doc
     (traverseproc)mp_traverse,     // tp_traverse
     (inquiry)mp_clear,             // tp_clear
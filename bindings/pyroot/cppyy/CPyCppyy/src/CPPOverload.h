@@ -13,18 +13,20 @@
 namespace CPyCppyy {
 
 // signature hashes are also used by TemplateProxy
-inline uint64_t HashSignature(PyObject* args)
+inline uint64_t HashSignature(PyObject* const* args, Py_ssize_t nargs, bool use_refcount = true)
 {
-// Build a hash from the types of the given python function arguments.
+// Build a hash from the types of the given python function arguments. Arguments
+// passed in a C array (vectorcall) are not held by a tuple, so their ref-counts
+// are one lower and are not used, as no argument that came from python then has
+// a ref-count of 1 in the tuple either.
     uint64_t hash = 0;
 
-    int nargs = (int)PyTuple_GET_SIZE(args);
-    for (int i = 0; i < nargs; ++i) {
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
     // TODO: hashing in the ref-count is for moves; resolve this together with the
     // improved overloads for implicit conversions
-        PyObject* pyobj = PyTuple_GET_ITEM(args, i);
+        PyObject* pyobj = args[i];
         hash += (uint64_t)Py_TYPE(pyobj);
-        hash += (uint64_t)(pyobj->ob_refcnt == 1 ? 1 : 0);
+        hash += (uint64_t)(use_refcount && pyobj->ob_refcnt == 1 ? 1 : 0);
         hash += (hash << 10); hash ^= (hash >> 6);
     }
 
@@ -33,6 +35,11 @@ inline uint64_t HashSignature(PyObject* args)
     return hash;
 }
 
+inline uint64_t HashSignature(PyObject* args)
+{
+    return HashSignature(PySequence_Fast_ITEMS(args), PyTuple_GET_SIZE(args));
+}
+
 class CPPOverload {
 public:
     typedef std::vector<std::pair<uint64_t, PyCallable*>> DispatchMap_t;
@@ -66,6 +73,9 @@ public:                 // public, as the python C-API works with C structs
     PyObject_HEAD
     CPPInstance*   fSelf;         // must be first (same layout as TemplateProxy)
     MethodInfo_t*  fMethodInfo;
+#if PY_VERSION_HEX >= 0x03080000
+    vectorcallfunc fVectorCall;
+#endif
 
 private:
     CPPOverload() = delete;
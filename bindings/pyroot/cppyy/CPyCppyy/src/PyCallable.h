@@ -33,6 +33,23 @@ public:
 public:
     virtual PyObject* Call(
         CPPInstance*& self, PyObject* args, PyObject* kwds, CallContext* ctxt = nullptr) = 0;
+
+// call with positional arguments in a C array (vectorcall protocol); the default packs
+// them into a tuple, callables that can convert from the array directly override it
+    virtual PyObject* VectorCall(
+        CPPInstance*& self, PyObject* const* args, Py_ssize_t nargs, CallContext* ctxt = nullptr)
+    {
+        PyObject* pyargs = PyTuple_New(nargs);
+        if (!pyargs)
+            return nullptr;
+        for (Py_ssize_t i = 0; i < nargs; ++i) {
+            Py_INCREF(args[i]);
+            PyTuple_SET_ITEM(pyargs, i, args[i]);
+        }
+        PyObject* result = Call(self, pyargs, nullptr, ctxt);
+        Py_DECREF(pyargs);
+        return result;
+    }
 };
 
 } // namespace CPyCppyy
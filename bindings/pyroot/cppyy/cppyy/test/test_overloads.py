@@ -138,3 +138,24 @@ class TestOVERLOADS:
         for l in ['f', 'd', 'i', 'h', 'l']:
             a = array.array(l, numbers)
             assert round(cmean(len(a), a) - mean, 8) == 0
+
+    def test08_repeated_bound_calls(self):
+        """Test repeated calls of bound methods, dispatched to the memoized overloads"""
+
+        import cppyy, array
+        more_overloads = cppyy.gbl.more_overloads
+        c_overload = cppyy.gbl.c_overload
+
+        m = more_overloads()
+        for i in range(10):
+            assert m.call(i)       == "int"
+            assert m.call(i + 0.5) == "double"
+            assert more_overloads.call(m, i) == "int"
+
+        c = c_overload()
+        ai = array.array('i', [525252])
+        ah = array.array('h', [25])
+        for i in range(10):
+            assert c.get_int(ai) == 525252
+            assert c.get_int(ah) == 25
+            assert c.get_int(cppyy.gbl.b_overload()) == 13
@@ -1,7 +1,7 @@
 from cppyy import gbl as gbl_namespace
 
 
-def _NumbaDeclareDecorator(input_types, return_type = None, name=None):
+def _NumbaDeclareDecorator(input_types, return_type = None, name=None, batch=False):
     '''
     Decorator for making Python callables accessible in C++ by just-in-time compilation
     with numba and cling
@@ -22,6 +22,15 @@ def _NumbaDeclareDecorator(input_types, return_type = None, name=None):
     Note that the callable is fully compiled without side-effects. The numba jitting uses the nopython
     option which does not allow interaction with the Python interpreter. This means that you can use
     the resulting function also safely in multi-threaded environments.
+
+    With batch=True, the callable processes whole batches of entries at once: it takes one numpy array
+    per input type, e.g. for the input types ['double', 'double'], and returns an array of the same
+    length. The C++ wrapper is then a functor with the signature of an expression of the RDataFrame
+    DefineBatch method, void(unsigned int slot, RVec<R> &out, const RVec<T1> &x_1, ...), which is called
+    once per batch of entries, e.g. per bulk range if RDataFrame::SetBulkSize is used, instead of once
+    per entry. The input arrays are views of the data of the batches and the returned values are written
+    directly into the output batch (except for bool, see above). In this mode, input and return types
+    are fundamental types, long and unsigned long standing for Long64_t and ULong64_t.
     '''
     # Make required imports
     try:
@@ -354,4 +363,148 @@ namespace Numba {{
 
         return func
 
-    return inner
+    def inner_batch(func, input_types=input_types, return_type=return_type, name=name):
+        '''
+        Inner decorator for batches of entries, see outer decorator for documentation
+        '''
+        for t in input_types + ([return_type] if return_type is not None else []):
+            if 'RVec' in t:
+                raise Exception('Type {} is not supported in batch mode, which takes the types of the elements of '
+                                'the batches'.format(t))
+
+        # Jit the given Python callable with numba, with arrays for the batches of each input type
+        nb_input_types = [get_numba_type(t)[:] for t in input_types]
+        try:
+            if return_type is not None:
+                nbjit = nb.jit(get_numba_type(return_type)[:](*nb_input_types), nopython=True, inline='always')(func)
+            else:
+                nbjit = nb.jit(tuple(nb_input_types), nopython=True, inline='always')(func)
+        except:
+            raise Exception('Failed to jit Python callable {} with numba.jit'.format(func))
+        func.numba_func = nbjit
+        if return_type is None:
+            nb_return_type = nbjit.nopython_signatures[-1].return_type
+            type_map = {
+                nb.types.boolean: 'bool',
+                nb.types.int32: 'int',
+                nb.types.uint32: 'unsigned int',
+                nb.types.int64: 'long',
+                nb.types.uint64: 'unsigned long',
+                nb.types.float32: 'float',
+                nb.types.float64: 'double',
+            }
+            if not isinstance(nb_return_type, nb.types.Array) or nb_return_type.dtype not in type_map:
+                raise Exception('The callable {} must return an array of one of the types {} in batch mode, not {}'
+                                .format(func, list(type_map.values()), nb_return_type))
+            return_type = type_map[nb_return_type.dtype]
+
+        # Create Python wrapper with C friendly signature, which views the batches as numpy arrays and
+        # writes the returned values into the output batch
+        pywrapper_signature = ['ptr_r, size_r'] + ['ptr_{0}, size_{0}'.format(i) for i in range(len(input_types))]
+        pywrapper_args_def = ['x_{0} = nb.carray(ptr_{0}, (size_{0},))'.format(i) for i in range(len(input_types))]
+        pywrappercode = '''\
+def pywrapper({SIGNATURE}):
+    """
+    Wrapper function for the jitted Python callable working on batches of entries
+    """
+    # Define numba carray wrappers for the input batches
+    {ARGS_DEF}
+    # Call the jitted Python function
+    r = nbjit({ARGS})
+    # Write the result into the output batch
+    x_r = nb.carray(ptr_r, (size_r,))
+    x_r[:] = r
+        '''.format(
+                SIGNATURE=', '.join(pywrapper_signature),
+                ARGS_DEF='\n    '.join(pywrapper_args_def),
+                ARGS=', '.join('x_{}'.format(i) for i in range(len(input_types))))
+
+        glob = dict(globals()) # Make a shallow copy of the dictionary so we don't pollute the global scope
+        glob['nb'] = nb
+        glob['nbjit'] = nbjit
+        exec(pywrappercode, glob, locals()) in {}
+        if not 'pywrapper' in locals():
+            raise Exception('Failed to create Python wrapper function:\n{}'.format(pywrappercode))
+
+        # Jit the Python wrapper code
+        c_input_types = []
+        for t in [return_type] + input_types:
+            c_input_types += [nb.types.CPointer(get_numba_type(t)), nb.int64]
+        try:
+            nbcfunc = nb.cfunc(nb.void(*c_input_types), nopython=True)(locals()['pywrapper'])
+        except:
+            raise Exception('Failed to jit Python wrapper with numba.cfunc')
+        func.__py_wrapper__ = pywrappercode
+        func.__numba_cfunc__ = nbcfunc
+
+        # Infer name of the C++ wrapper functor
+        if not name:
+            name = func.__name__
+
+        # Build C++ wrapper for jitting with cling
+        def get_cpp_type(t):
+            '''
+            Get the C++ type of the RVecs of the batches, using the 64-bit integer types of ROOT for long
+            '''
+            return {'long': 'Long64_t', 'unsigned long': 'ULong64_t'}.get(t, t)
+
+        def get_c_type(t):
+            '''
+            Get the C++ type of the pointers passed to the jitted Python wrapper
+            '''
+            # Special treatment for bool: In numpy, bools have 1 byte
+            return 'char' if t == 'bool' else get_cpp_type(t)
+
+        input_signature = ''.join(', const ROOT::RVec<{}> &x_{}'.format(get_cpp_type(t), i)
+                                  for i, t in enumerate(input_types))
+        func_ptr_type = 'void(*)({})'.format(', '.join('{}*, Long64_t'.format(get_c_type(t))
+                                                       for t in [return_type] + input_types))
+
+        # Define function call, the output batch being the first argument
+        vecbool_conversion = []
+        func_args = []
+        for i, t in enumerate([return_type] + input_types):
+            x = 'x_r' if i == 0 else 'x_{}'.format(i - 1)
+            if t == 'bool':
+                # Copy the RVec<bool> to a RVec<char> to match the numpy memory layout
+                vecbool_conversion += ['ROOT::RVec<char> {0}b({0}.begin(), {0}.end());'.format(x)]
+                x += 'b'
+            func_args += ['const_cast<{0}*>({1}.data()), {1}.size()'.format(get_c_type(t), x)]
+        vecbool_copy = 'std::copy(x_rb.begin(), x_rb.end(), x_r.begin());' if return_type == 'bool' else ''
+
+        # Build wrapper code
+        cppwrappercode = """\
+namespace Numba {{
+/*
+ * C++ functor around the jitted Python wrapper which calls the jitted Python callable on a batch of entries
+ */
+struct {FUNC_NAME} {{
+  void operator()(unsigned int /*slot*/, ROOT::RVec<{RETURN_TYPE}> &x_r{INPUT_SIGNATURE}) const {{
+    // Create a function pointer from the jitted Python wrapper
+    const auto funcptr = reinterpret_cast<{FUNC_PTR_TYPE}>({FUNC_PTR});
+    // Perform conversion of RVec<bool>
+    {VECBOOL_CONVERSION}
+    // Compute the batch
+    funcptr({FUNC_ARGS});
+    {VECBOOL_COPY}
+  }}
+}};
+}}""".format(
+                FUNC_NAME=name,
+                RETURN_TYPE=get_cpp_type(return_type),
+                INPUT_SIGNATURE=input_signature,
+                FUNC_PTR=nbcfunc.address,
+                FUNC_PTR_TYPE=func_ptr_type,
+                VECBOOL_CONVERSION='\n    '.join(vecbool_conversion),
+                FUNC_ARGS=', '.join(func_args),
+                VECBOOL_COPY=vecbool_copy)
+
+        # Jit wrapper C++ code
+        err = gbl_namespace.gInterpreter.Declare(cppwrappercode)
+        if not err:
+            raise Exception('Failed to jit C++ wrapper code with cling:\n{}'.format(cppwrappercode))
+        func.__cpp_wrapper__ = cppwrappercode
+
+        return func
+
+    return inner_batch if batch else inner
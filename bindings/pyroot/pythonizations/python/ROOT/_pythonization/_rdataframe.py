@@ -95,6 +95,22 @@ df.Define('array', 'ROOT::RVecF{1.,2.,3.}')\
   .Define('arraySquared', 'Numba::pypowarray(array, 2)')
 ~~~
 
+The overhead of calling the compiled function once per entry can be avoided by declaring it with `batch=True`:
+it then receives the values of a whole batch of entries as numpy arrays, which are views of the data of the batch,
+and returns the array of the values of the defined column. The batches are the ranges of entries of the bulk
+processing mode, see `SetBulkSize()`, and the function is used with `DefineBatch()`. `DefineBatch()` also accepts
+the Python function directly, deducing the parameter types from the types of the columns:
+
+~~~{.py}
+@ROOT.Numba.Declare(['double', 'double'], 'double', batch=True)
+def pyhypot(x, y):
+    return np.sqrt(x * x + y * y)
+
+df.SetBulkSize(1024)
+df.DefineBatch('r', ROOT.Numba.pyhypot(), ['x', 'y'])
+df.DefineBatch('r2', lambda x, y: x * x + y * y)
+~~~
+
 Note that this functionality requires the Python packages `numba` and `cffi` to be installed.
 
 ### Interoperability with NumPy
@@ -422,6 +438,8 @@ def pythonize_rdataframe(klass):
     if sys.version_info >= (3, 7):
         klass._OriginalFilter = klass.Filter
         klass._OriginalDefine = klass.Define
-        from ._rdf_pyz import _PyFilter, _PyDefine
+        klass._OriginalDefineBatch = klass.DefineBatch
+        from ._rdf_pyz import _PyFilter, _PyDefine, _PyDefineBatch
         klass.Filter = _PyFilter
         klass.Define = _PyDefine
+        klass.DefineBatch = _PyDefineBatch
@@ -225,6 +225,35 @@ class FunctionJitter:
         FunctionJitter.function_cache[self.func.__name__] = (self.func_call, self.func_sign)
         return self.func_call
 
+    def jit_batch_function(self, func, cols_list):
+        """
+        Jits the provided function as a functor computing batches of entries, using ROOT's NumbaDeclare.
+        The functor is named after the function with the suffix "_batch" and is not jitted again if the function was
+        jitted earlier with the same signature.
+
+        Arguments:
+        func: A python callable taking and returning numpy arrays
+        cols_list: A list of columns of RDF on which func depends on.
+
+        Returns:
+            The name of the functor in the Numba namespace
+        """
+        self.get_function_params_args_call(func, cols_list, {})
+        # Lambda functions were given a unique name by the call above
+        cache_key = self.func.__name__ + "_batch"
+        if any('RVec' in t for t in self.func_sign):
+            raise TypeError(
+                f"Only columns of fundamental types can be processed by batches, not {self.func_sign}.")
+        if cache_key in FunctionJitter.function_cache:
+            name, func_sign = FunctionJitter.function_cache[cache_key]
+            if self.func_sign != func_sign:
+                raise ValueError("Trying to re-use a function. Do not change function signature.")
+            return name
+
+        _NumbaDeclareDecorator(self.func_sign, self.return_type, name=cache_key, batch=True)(self.func)
+        FunctionJitter.function_cache[cache_key] = (cache_key, self.func_sign)
+        return cache_key
+
 def _convert_to_vector(args):
     """
     Converts a Python list of strings into an std::vector before passing such
@@ -407,3 +436,48 @@ def _PyDefine(rdf, col_name, callable_or_str, cols = [] , extra_args = {} ):
     jitter = FunctionJitter(rdf)    
     func_call = jitter.jit_function(func, cols, extra_args)
     return rdf._OriginalDefine(col_name, "Numba::" + func_call)
+
+def _PyDefineBatch(rdf, col_name, func, cols = []):
+    """
+    Defines a new column in the RDataFrame, computed by batches of entries.
+    Arguments:
+    1. col_name: The name of the new column to be defined
+    2. func: The definition of the contents of the new column.
+        It can be a python callable, which takes one numpy array per input column with the values of a batch of
+        entries and returns the array of the values of the new column for these entries. It is jitted with numba.
+        It can also be a C++ functor or an std::function with the signature of the C++ DefineBatch.
+    3. cols: list of columns that the callable will receive as argument.
+                If not provided then it tries maps the name of the parameter to a column name of the RDF.
+    Returns:
+        RDataFrame: rdf with new column defined
+
+    The batches are the ranges of entries of bulk processing mode, see SetBulkSize(): the columns are then defined
+    with one call of the jitted callable per range of entries, on views of the values of the input columns, instead
+    of one call per entry.
+
+    Examples:
+    1. rdf.SetBulkSize(1024)
+       rdf.DefineBatch("x2", lambda x: x*x)
+       Maps the function argument to column x.
+    2. rdf.DefineBatch("r", lambda a, b: np.sqrt(a*a + b*b), ["x", "y"])
+       Maps the function arguments to columns x and y.
+    """
+    if not isinstance(col_name, str):
+        raise TypeError(f"First argument of DefineBatch must be a valid string for the new column name. {type(col_name).__name__} is not a string.")
+
+    if not callable(func):
+        raise TypeError(f"The second argument of a DefineBatch operation should be a callable. {type(func).__name__} object is not callable.")
+
+    if not isinstance(cols, list):
+        raise TypeError(f"DefineBatch takes a column list as third arguments but {type(cols).__name__} was given.")
+
+    rdf_node = _handle_cpp_callables(func, rdf._OriginalDefineBatch, col_name, func, cols)
+    if rdf_node is not None:
+        return rdf_node
+
+    import ROOT
+    jitter = FunctionJitter(rdf)
+    functor = getattr(ROOT.Numba, jitter.jit_batch_function(func, cols))()
+    # The columns of the batches, in the order of the parameters of the function
+    columns = ROOT.std.vector['std::string'](arg_info[1] for arg_info in jitter.args_info.values())
+    return rdf._OriginalDefineBatch[type(functor)](col_name, functor, columns)
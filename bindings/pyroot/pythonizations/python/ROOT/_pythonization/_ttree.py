@@ -124,6 +124,22 @@ t.SetBranchAddress('classb', cb)
 ms = ROOT.MyStruct()
 ds.SetBranchAddress('structb', ms)
 \endcode
+
+Finally, the values of whole branches can be read into NumPy arrays with
+`TTree.arrays(columns, entry_start, entry_stop)`. The result is a dictionary
+with one array per column:
+\code{.py}
+arrays = t.arrays(['floatb', 'arrayb', 'vectorb'], entry_start=0, entry_stop=1000)
+arrays['floatb']  # NumPy array with one value per entry
+arrays['arrayb']  # NumPy array of shape (entries, N) for fixed-size arrays
+arrays['vectorb'] # NumPy array of objects, one NumPy array per entry
+\endcode
+Branches of fundamental types, fixed-size arrays of them, variable-length
+arrays (like `x[n]/F`) and `std::vector` of fundamental types are read basket by
+basket with the bulk I/O of TBranch, directly into the returned buffers and
+without an event loop. With `library='ak'`, awkward arrays are returned instead,
+where the variable-length columns keep the offsets and the contiguous values read
+from the tree. Other branches are read with ROOT::RDataFrame::AsNumpy().
 \htmlonly
 </div>
 \endhtmlonly
@@ -145,6 +161,111 @@ def _TTree__iter__(self):
     if bytes_read == -1:
         raise RuntimeError("TTree I/O error")
 
+# NumPy types of the values read in bulk by TTree.arrays
+_bulk_read_dtypes = {
+    'kChar_t': 'i1',
+    'kUChar_t': 'u1',
+    'kShort_t': 'i2',
+    'kUShort_t': 'u2',
+    'kInt_t': 'i4',
+    'kUInt_t': 'u4',
+    'kLong_t': 'l',
+    'kULong_t': 'L',
+    'kFloat_t': 'f4',
+    'kLong64_t': 'i8',
+    'kULong64_t': 'u8',
+    'kDouble_t': 'f8',
+}
+
+# C++ types of the std::vector filled with the values of variable-length columns
+_bulk_read_vector_types = {
+    'kInt_t': 'Int_t',
+    'kUInt_t': 'UInt_t',
+    'kFloat_t': 'Float_t',
+    'kLong64_t': 'Long64_t',
+    'kULong64_t': 'ULong64_t',
+    'kDouble_t': 'Double_t',
+}
+
+def _read_bulk(tree, column, entry_start, entry_stop):
+    # Reads a column with the bulk I/O of TBranch, returns None if it is not supported
+    import ROOT
+    import numpy
+
+    tree_utils = ROOT.Internal.TreeUtils
+    info = tree_utils.GetBulkBranchInfo(tree, column)
+    type_name = next((name for name in _bulk_read_dtypes if info.fType == getattr(ROOT, name)), None)
+    if type_name is None:
+        return None
+
+    nentries = entry_stop - entry_start
+    if not info.fVarLength:
+        shape = (nentries,) if info.fLen == 1 else (nentries, info.fLen)
+        values = numpy.empty(shape, dtype=_bulk_read_dtypes[type_name])
+        if not tree_utils.ReadBranchBulk(tree, column, entry_start, entry_stop, values):
+            return None
+        return values
+
+    if type_name not in _bulk_read_vector_types:
+        return None
+    values = ROOT.std.vector(_bulk_read_vector_types[type_name])()
+    offsets = ROOT.std.vector('Long64_t')()
+    if not tree_utils.ReadBranchBulkVarLength(tree, column, entry_start, entry_stop, values, offsets):
+        return None
+    # The NumPy arrays keep the std::vector alive, no copy is made
+    return numpy.asarray(offsets), numpy.asarray(values)
+
+def _TTree_arrays(self, columns=None, entry_start=0, entry_stop=None, library='np'):
+    # Reads the given columns, all top-level branches by default, for the entries [entry_start, entry_stop)
+    # into a dictionary of NumPy arrays, or of awkward arrays for library='ak'
+    import ROOT
+    import numpy
+
+    if library not in ('np', 'ak'):
+        raise ValueError("TTree.arrays: library must be 'np' or 'ak', not '{}'".format(library))
+    if library == 'ak':
+        import awkward
+
+    if columns is None:
+        columns = [branch.GetName() for branch in self.GetListOfBranches()]
+    elif isinstance(columns, str):
+        columns = [columns]
+    nentries = self.GetEntries()
+    if entry_stop is None or entry_stop > nentries:
+        entry_stop = nentries
+    entry_start = max(0, min(entry_start, entry_stop))
+
+    result = {}
+    fallback = []
+    for column in columns:
+        arrays = _read_bulk(self, column, entry_start, entry_stop)
+        if arrays is None:
+            fallback.append(column)
+        elif not isinstance(arrays, tuple):
+            result[column] = awkward.from_numpy(arrays) if library == 'ak' else arrays
+        elif library == 'ak':
+            offsets, values = arrays
+            layout = awkward.contents.ListOffsetArray(awkward.index.Index64(offsets),
+                                                      awkward.contents.NumpyArray(values))
+            result[column] = awkward.Array(layout)
+        else:
+            offsets, values = arrays
+            jagged = numpy.empty(len(offsets) - 1, dtype=object)
+            for i in range(len(jagged)):
+                jagged[i] = values[offsets[i]:offsets[i + 1]]
+            result[column] = jagged
+
+    if fallback:
+        df = ROOT.RDataFrame(self)
+        if entry_start > 0 or entry_stop < nentries:
+            df = df.Range(entry_start, entry_stop)
+        for column, values in df.AsNumpy(fallback).items():
+            if library == 'ak':
+                values = awkward.from_iter(map(list, values)) if values.dtype == object else awkward.from_numpy(values)
+            result[column] = values
+
+    return {column: result[column] for column in columns}
+
 def _SetBranchAddress(self, *args):
     # Modify the behaviour if args is (const char*, void*)
     res = SetBranchAddressPyz(self, *args)
@@ -185,6 +306,9 @@ def pythonize_ttree(klass, name):
     # tree.branch syntax
     AddBranchAttrSyntax(klass)
 
+    # Columnar reading into NumPy arrays
+    klass.arrays = _TTree_arrays
+
     # SetBranchAddress
     klass._OriginalSetBranchAddress = klass.SetBranchAddress
     klass.SetBranchAddress = _SetBranchAddress
@@ -107,6 +107,29 @@ class PyDefine(unittest.TestCase):
         for x,y in zip(rdf2.Take['ULong64_t']("rdfentry_"), rdf2.Take['ULong64_t']("x")):
            self.assertEqual(x*x, y)
 
-    
+    def test_define_batch(self):
+        """
+        Test that a Python callable can compute a column by batches of entries
+        """
+        rdf = ROOT.RDataFrame(100)
+        rdf.SetBulkSize(16)
+        rdf = rdf.Define("x", "(double) rdfentry_").Define("y", "(int) rdfentry_ % 3")
+        rdf = rdf.DefineBatch("z", lambda x, y: x * y).DefineBatch("w", lambda a: a > 50, ["z"])
+        arr = np.arange(0, 100)
+        cols = rdf.AsNumpy(["z", "w"])
+        self.assertTrue(np.array_equal(cols["z"], arr * (arr % 3)))
+        self.assertTrue(np.array_equal(cols["w"], arr * (arr % 3) > 50))
+
+    def test_define_batch_declare(self):
+        """
+        Test that a functor declared with ROOT.Numba.Declare in batch mode can be used in DefineBatch
+        """
+        @ROOT.Numba.Declare(["unsigned long"], "double", batch=True)
+        def half_batch(x):
+            return x * 0.5
+        rdf = ROOT.RDataFrame(10).DefineBatch("h", ROOT.Numba.half_batch(), ["rdfentry_"])
+        self.assertTrue(np.array_equal(rdf.AsNumpy()["h"], np.arange(0, 10) * 0.5))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,95 @@
+import unittest
+
+import ROOT
+import numpy as np
+
+
+class TTreeArrays(unittest.TestCase):
+    """
+    Test for the TTree.arrays pythonization, which reads columns into NumPy arrays
+    with the bulk I/O of the branches, for trees and chains.
+    """
+
+    filename = 'treearrays.root'
+    treename = 'mytree'
+    nentries = 1000
+
+    # Setup
+    @classmethod
+    def setUpClass(cls):
+        ROOT.gInterpreter.Declare('''
+        void CreateTreeForArrays(const char *filename, const char *treename, int nentries)
+        {
+           TFile f(filename, "RECREATE");
+           TTree t(treename, "tree for arrays");
+           int n = 0;
+           float x = 0;
+           double fixed[3];
+           float var[10];
+           std::vector<double> vec;
+           bool flag = false;
+           t.Branch("x", &x, "x/F", 256);
+           t.Branch("fixed", fixed, "fixed[3]/D", 256);
+           t.Branch("n", &n, "n/I", 256);
+           t.Branch("var", var, "var[n]/F", 256);
+           t.Branch("vec", &vec, 256, 0);
+           t.Branch("flag", &flag, "flag/O");
+           for (int i = 0; i < nentries; ++i) {
+              x = 0.5f * i;
+              for (int j = 0; j < 3; ++j)
+                 fixed[j] = i + 0.1 * j;
+              n = i % 5;
+              vec.clear();
+              for (int j = 0; j < n; ++j) {
+                 var[j] = i + j;
+                 vec.push_back(-i - j);
+              }
+              flag = i % 2;
+              t.Fill();
+           }
+           f.Write();
+        }
+        ''')
+        ROOT.CreateTreeForArrays(cls.filename, cls.treename, cls.nentries)
+
+    def check_arrays(self, tree, entry_start, entry_stop):
+        arrays = tree.arrays(['x', 'fixed', 'var', 'vec', 'flag'], entry_start=entry_start, entry_stop=entry_stop)
+        entries = np.arange(entry_start, entry_stop) % self.nentries
+        np.testing.assert_array_equal(arrays['x'], 0.5 * entries)
+        self.assertEqual(arrays['x'].dtype, np.float32)
+        self.assertEqual(arrays['fixed'].shape, (len(entries), 3))
+        np.testing.assert_allclose(arrays['fixed'][:, 2], entries + 0.2)
+        np.testing.assert_array_equal(arrays['flag'], entries % 2 == 1)
+        self.assertEqual(len(arrays['var']), len(entries))
+        for i, entry in enumerate(entries):
+            n = entry % 5
+            np.testing.assert_array_equal(arrays['var'][i], entry + np.arange(n))
+            np.testing.assert_array_equal(arrays['vec'][i], -entry - np.arange(n))
+
+    # Tests
+    def test_tree(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        self.check_arrays(t, 0, self.nentries)
+        self.check_arrays(t, 123, 789)
+        self.assertEqual(list(t.arrays().keys()), ['x', 'fixed', 'n', 'var', 'vec', 'flag'])
+
+    def test_chain(self):
+        c = ROOT.TChain(self.treename)
+        c.Add(self.filename)
+        c.Add(self.filename)
+        # entries of both trees of the chain
+        self.check_arrays(c, 950, 1100)
+
+    def test_bulk_read(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        tree_utils = ROOT.Internal.TreeUtils
+        self.assertEqual(tree_utils.GetBulkBranchInfo(t, 'fixed').fLen, 3)
+        self.assertTrue(tree_utils.GetBulkBranchInfo(t, 'var').fVarLength)
+        self.assertEqual(tree_utils.GetBulkBranchInfo(t, 'flag').fType, ROOT.kOther_t)
+        self.assertEqual(tree_utils.GetBulkBranchInfo(t, 'nonexistent').fType, ROOT.kOther_t)
+
+
+if __name__ == '__main__':
+    unittest.main()
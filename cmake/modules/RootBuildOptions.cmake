@@ -82,6 +82,7 @@ ROOT_BUILD_OPTION(arrow OFF "Enable support for Apache Arrow")
 ROOT_BUILD_OPTION(asimage ON "Enable support for image processing via libAfterImage")
 ROOT_BUILD_OPTION(asserts OFF "Enable asserts (defaults to ON for CMAKE_BUILD_TYPE=Debug and/or dev=ON)")
 ROOT_BUILD_OPTION(builtin_afterimage OFF "Build bundled copy of libAfterImage")
+ROOT_BUILD_OPTION(builtin_benchmark OFF "Build Google Benchmark internally (requires network)")
 ROOT_BUILD_OPTION(builtin_cfitsio OFF "Build CFITSIO internally (requires network)")
 ROOT_BUILD_OPTION(builtin_clang ON "Build bundled copy of Clang")
 ROOT_BUILD_OPTION(builtin_cling ON "Build bundled copy of Cling. Only build with an external cling if you know what you are doing: associating ROOT commits with cling commits is tricky.")
@@ -202,6 +203,7 @@ option(clingtest "Enable cling tests (Note: that this makes llvm/clang symbols v
 option(fail-on-missing "Fail at configure time if a required package cannot be found" OFF)
 option(gminimal "Enable only required options by default, but include X11" OFF)
 option(minimal "Enable only required options by default" OFF)
+option(benchmarks "Build the Google Benchmark targets of the hot paths in test/benchmarks (implies testing)" OFF)
 option(rootbench "Build rootbench if rootbench exists in root or if it is a sibling directory." OFF)
 option(roottest "Build roottest if roottest exists in root or if it is a sibling directory." OFF)
 option(testing "Enable testing with CTest" OFF)
@@ -285,6 +287,7 @@ endif()
 #--- The 'builtin_all' option swithes ON old the built in options-------------------------------
 if(builtin_all)
   set(builtin_afterimage_defvalue ON)
+  set(builtin_benchmark_defvalue ON)
   set(builtin_cfitsio_defvalue ON)
   set(builtin_clang_defvalue ON)
   set(builtin_cling_defvalue ON)
@@ -386,7 +389,7 @@ endif()
 ROOT_APPLY_OPTIONS()
 
 #---roottest option implies testing
-if(roottest OR rootbench)
+if(roottest OR rootbench OR benchmarks)
   set(testing ON CACHE BOOL "" FORCE)
 endif()
 
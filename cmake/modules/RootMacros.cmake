@@ -1840,6 +1840,38 @@ function(ROOT_ADD_GTEST test_suite)
   )
 endfunction()
 
+#----------------------------------------------------------------------------
+# function ROOT_ADD_BENCHMARK(<benchmark> source1 source2...
+#                             [LIBRARIES lib1 lib2...] -- Libraries to link against
+#                             [LABELS label1 label2...] -- Labels to annotate the test, in addition to 'benchmark'
+#                             [INCLUDE_DIRS dir1 dir2...] -- Extra target include directories
+# Creates a new Google Benchmark executable, and registers a test running it that writes the results in JSON to
+# ${ROOT_BENCHMARK_RESULTS_DIR}/<benchmark>.json, for the comparison with the baselines (see test/benchmarks).
+#----------------------------------------------------------------------------
+function(ROOT_ADD_BENCHMARK benchmark)
+  cmake_parse_arguments(ARG "" "" "LIBRARIES;LABELS;INCLUDE_DIRS" ${ARGN})
+
+  ROOT_GET_SOURCES(source_files . ${ARG_UNPARSED_ARGUMENTS})
+  ROOT_EXECUTABLE(${benchmark} ${source_files} LIBRARIES ${ARG_LIBRARIES})
+  target_link_libraries(${benchmark} benchmark::benchmark benchmark::benchmark_main)
+  if(ARG_INCLUDE_DIRS)
+    target_include_directories(${benchmark} PRIVATE ${ARG_INCLUDE_DIRS})
+  endif()
+
+  file(MAKE_DIRECTORY ${ROOT_BENCHMARK_RESULTS_DIR})
+  ROOT_PATH_TO_STRING(mangled_name ${benchmark} PATH_SEPARATOR_REPLACEMENT "-")
+  ROOT_ADD_TEST(
+    benchmark-${mangled_name}
+    COMMAND ${benchmark} --benchmark_min_time=${benchmarks_min_time}s
+            --benchmark_out=${ROOT_BENCHMARK_RESULTS_DIR}/${benchmark}.json --benchmark_out_format=json
+    WORKING_DIR ${CMAKE_CURRENT_BINARY_DIR}
+    # Concurrent tests would disturb the timings
+    RUN_SERIAL
+    FIXTURES_SETUP benchmark-results
+    LABELS benchmark ${ARG_LABELS}
+  )
+endfunction()
+
 
 #----------------------------------------------------------------------------
 # ROOT_ADD_TEST_SUBDIRECTORY( <name> )
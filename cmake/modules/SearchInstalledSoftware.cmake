@@ -1082,6 +1082,17 @@ if(arrow)
     endif()
   endif()
 
+  if(arrow)
+    find_package(Parquet CONFIG QUIET)
+    if(Parquet_FOUND)
+      set(PARQUET_FOUND TRUE)
+      set(PARQUET_SHARED_LIB Parquet::parquet_shared)
+      message(STATUS "Found Apache Parquet version ${PARQUET_VERSION}")
+    else()
+      message(STATUS "Apache Parquet not found, the RDataFrame Parquet data source will not be built")
+    endif()
+  endif()
+
 endif()
 
 #---Check for gfal-------------------------------------------------------------------
@@ -2098,6 +2109,85 @@ if (builtin_gtest)
 
 endif()
 
+#---Check for Google Benchmark-----------------------------------------------------------
+if(benchmarks AND NOT builtin_benchmark)
+  if(fail-on-missing)
+    find_package(benchmark 1.8 REQUIRED)
+  else()
+    find_package(benchmark 1.8)
+    if(NOT benchmark_FOUND)
+      if(NO_CONNECTION)
+        message(STATUS "Google Benchmark not found, and no internet connection. Disabling the 'benchmarks' option.")
+        set(benchmarks OFF CACHE BOOL "Disabled because Google Benchmark not found (${builtin_benchmark_description}) and there is no internet connection" FORCE)
+      else()
+        message(STATUS "Google Benchmark not found, switching ON 'builtin_benchmark' option.")
+        set(builtin_benchmark ON CACHE BOOL "Enabled because benchmarks requested and Google Benchmark not found (${builtin_benchmark_description})" FORCE)
+      endif()
+    endif()
+  endif()
+endif()
+
+if(builtin_benchmark AND NO_CONNECTION)
+  if(fail-on-missing)
+    message(FATAL_ERROR "No internet connection. Please check your connection, or either disable the 'builtin_benchmark' option or the 'fail-on-missing' to automatically disable options requiring internet access")
+  else()
+    message(STATUS "No internet connection, disabling the 'benchmarks' and 'builtin_benchmark' options")
+    set(benchmarks OFF CACHE BOOL "Disabled because there is no internet connection" FORCE)
+    set(builtin_benchmark OFF CACHE BOOL "Disabled because there is no internet connection" FORCE)
+  endif()
+endif()
+
+if(benchmarks AND builtin_benchmark)
+  set(_benchmark_byproduct_binary_dir ${CMAKE_CURRENT_BINARY_DIR}/googlebenchmark-prefix/src/googlebenchmark-build)
+  set(_benchmark_byproducts
+    ${_benchmark_byproduct_binary_dir}/src/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark${CMAKE_STATIC_LIBRARY_SUFFIX}
+    ${_benchmark_byproduct_binary_dir}/src/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark_main${CMAKE_STATIC_LIBRARY_SUFFIX}
+    )
+
+  ExternalProject_Add(
+    googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_SHALLOW 1
+    GIT_TAG v1.8.3
+    UPDATE_COMMAND ""
+    CMAKE_ARGS -G ${CMAKE_GENERATOR}
+                  -DCMAKE_BUILD_TYPE=Release
+                  -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}
+                  -DCMAKE_C_FLAGS=${CMAKE_C_FLAGS}
+                  -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}
+                  -DCMAKE_CXX_FLAGS=${ROOT_EXTERNAL_CXX_FLAGS}
+                  -DCMAKE_AR=${CMAKE_AR}
+                  -DBENCHMARK_ENABLE_TESTING=OFF
+                  -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+                  -DBENCHMARK_ENABLE_INSTALL=OFF
+    # Disable install step
+    INSTALL_COMMAND ""
+    BUILD_BYPRODUCTS ${_benchmark_byproducts}
+    LOG_DOWNLOAD ON
+    LOG_CONFIGURE ON
+    LOG_BUILD ON
+    TIMEOUT 600
+  )
+
+  ExternalProject_Get_Property(googlebenchmark source_dir binary_dir)
+  set(BENCHMARK_INCLUDE_DIR ${source_dir}/include)
+  # Create the directory. Prevents bug https://gitlab.kitware.com/cmake/cmake/issues/15052
+  file(MAKE_DIRECTORY ${BENCHMARK_INCLUDE_DIR})
+
+  # Same names as the targets exported by an installed Google Benchmark
+  foreach(lib benchmark benchmark_main)
+    add_library(benchmark::${lib} IMPORTED STATIC GLOBAL)
+    set_target_properties(benchmark::${lib} PROPERTIES
+      IMPORTED_LOCATION ${binary_dir}/src/${CMAKE_STATIC_LIBRARY_PREFIX}${lib}${CMAKE_STATIC_LIBRARY_SUFFIX}
+      INTERFACE_INCLUDE_DIRECTORIES ${BENCHMARK_INCLUDE_DIR}
+      INTERFACE_COMPILE_DEFINITIONS BENCHMARK_STATIC_DEFINE)
+    add_dependencies(benchmark::${lib} googlebenchmark)
+  endforeach()
+  find_package(Threads REQUIRED)
+  set_property(TARGET benchmark::benchmark APPEND PROPERTY INTERFACE_LINK_LIBRARIES Threads::Threads)
+  set_property(TARGET benchmark::benchmark_main APPEND PROPERTY INTERFACE_LINK_LIBRARIES benchmark::benchmark)
+endif()
+
 if(webgui AND NOT builtin_openui5 AND NO_CONNECTION)
   if(fail-on-missing)
     message(FATAL_ERROR "No internet connection. Please check your connection, or either enable the 'builtin_openui5' option or the 'fail-on-missing' to automatically disable options requiring internet access")
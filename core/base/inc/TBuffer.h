@@ -51,6 +51,7 @@ protected:
    char            *fBuffer;        //Buffer used to store objects
    char            *fBufCur;        //Current position in buffer
    char            *fBufMax;        //End of buffer
+   Int_t            fBufOffset{0};  //Offset of fBuffer in the data, non-zero only when reading from several segments
    TObject         *fParent;        //Pointer to parent object owning this buffer
    ReAllocCharFun_t fReAllocFunc;   //! Realloc function to be used when extending the buffer.
    CacheList_t      fCacheStack;    //Stack of pointers to the cache where to temporarily store the value of 'missing' data members
@@ -63,6 +64,9 @@ protected:
    TBuffer(const TBuffer &) = delete;
    void operator=(const TBuffer &) = delete;
 
+   /// Called by SetBufferOffset() for an offset outside of [fBuffer, fBufMax]
+   virtual void SeekBuffer(Int_t offset) { fBufCur = fBuffer + (offset - fBufOffset); }
+
    Int_t Read(const char *name) override { return TObject::Read(name); }
    Int_t Write(const char *name, Int_t opt, Int_t bufs) override
                               { return TObject::Write(name, opt, bufs); }
@@ -90,14 +94,20 @@ public:
    void     SetBuffer(void *buf, UInt_t bufsiz = 0, Bool_t adopt = kTRUE, ReAllocCharFun_t reallocfunc = nullptr);
    ReAllocCharFun_t GetReAllocFunc() const;
    void     SetReAllocFunc(ReAllocCharFun_t reallocfunc = nullptr);
-   void     SetBufferOffset(Int_t offset = 0) { fBufCur = fBuffer+offset; }
+   void     SetBufferOffset(Int_t offset = 0)
+   {
+      if (R__likely(offset >= fBufOffset && offset - fBufOffset <= fBufMax - fBuffer))
+         fBufCur = fBuffer + (offset - fBufOffset);
+      else
+         SeekBuffer(offset);
+   }
    void     SetParent(TObject *parent);
    TObject *GetParent()  const;
    char    *Buffer()     const { return fBuffer; }
    char    *GetCurrent() const { return fBufCur; }
    Int_t    BufferSize() const { return fBufSize; }
    void     DetachBuffer() { fBuffer = nullptr; }
-   Int_t    Length()     const { return (Int_t)(fBufCur - fBuffer); }
+   Int_t    Length()     const { return (Int_t)(fBufCur - fBuffer) + fBufOffset; }
    void     Expand(Int_t newsize, Bool_t copy = kTRUE);  // expand buffer to newsize
    void     AutoExpand(Int_t size_needed);  // expand buffer to newsize
    Bool_t   ByteSwapBuffer(Long64_t n, EDataType type);  // Byte-swap N primitive-elements in the buffer
@@ -132,6 +132,24 @@ can be replaced with the simpler and exception safe:
       ~TContext();
    };
 
+   /// \brief RAII detaching the current thread from the directories (see TDirectory::DetachThread)
+   ///
+   /// Typically created at the beginning of the task of a worker thread booking its
+   /// own histograms, which are then merged or adopted by a directory (SetDirectory) at the end:
+   /// ~~~ {.cpp}
+   ///    TDirectory::TDetachedThread detached;
+   ///    auto h = new TH1D("h", "h", 100, 0., 1.); // not registered in gDirectory
+   /// ~~~
+   class TDetachedThread {
+   private:
+      Bool_t fWasDetached; //! Previous state of the current thread, restored by the destructor
+      TDetachedThread(const TDetachedThread&) = delete;
+      TDetachedThread& operator=(const TDetachedThread&) = delete;
+   public:
+      TDetachedThread() : fWasDetached(TDirectory::IsThreadDetached()) { TDirectory::DetachThread(kTRUE); }
+      ~TDetachedThread() { TDirectory::DetachThread(fWasDetached); }
+   };
+
 protected:
 
    TObject         *fMother{nullptr};   // pointer to mother of the directory
@@ -171,6 +189,8 @@ public:
    virtual ~TDirectory();
    static  void        AddDirectory(Bool_t add=kTRUE);
    static  Bool_t      AddDirectoryStatus();
+   static  void        DetachThread(Bool_t detach = kTRUE);
+   static  Bool_t      IsThreadDetached();
    virtual void        Append(TObject *obj, Bool_t replace = kFALSE);
    virtual void        Add(TObject *obj, Bool_t replace = kFALSE) { Append(obj,replace); }
    virtual Int_t       AppendKey(TKey *) {return 0;}
@@ -245,6 +245,27 @@ public:
    ClassDef(TObject,1)  //Basic ROOT object
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// Opt-in pooled allocation for a class deriving from TObject: put the macro in
+/// the class declaration, e.g. next to ClassDef. The objects created with
+/// new are allocated by TStorage::PooledObjectAlloc, which reuses the blocks of
+/// the objects of the same size deleted on the same thread instead of going
+/// to the global heap. The classes deriving from such a class share its pools.
+/// As ClassDef, the macro leaves the access specifier to public.
+
+#define R__POOLED_ALLOCATION                                                                          \
+public:                                                                                                \
+   void *operator new(size_t sz) { return TStorage::PooledObjectAlloc(sz); }                          \
+   void *operator new(size_t sz, void *vp) { return TStorage::ObjectAlloc(sz, vp); }                  \
+   void operator delete(void *ptr, size_t sz)                                                         \
+   {                                                                                                  \
+      if ((Longptr_t)ptr != TObject::GetDtorOnly())                                                   \
+         TStorage::PooledObjectDealloc(ptr, sz);                                                      \
+      else                                                                                            \
+         TObject::SetDtorOnly(nullptr);                                                               \
+   }                                                                                                  \
+   void operator delete(void *, void *) {}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// TObject constructor. It sets the two data words of TObject to their
 /// initial values. The unique ID is set to 0 and the status word is
@@ -94,6 +94,7 @@ class TEnv;
 class TList;
 class THashTable;
 class TFunction;
+class TRegexp;
 class TPluginManager;
 
 #include <atomic>
@@ -113,13 +114,14 @@ private:
    TString      fOrigin;    // origin of plugin handler definition
    TMethodCall *fCallEnv;   //!ctor method call environment
    TFunction   *fMethod;    //!ctor method or global function
+   TRegexp     *fCompiledRegexp; //!fRegexp compiled by the first CanHandle matching an URI
    AtomicInt_t  fCanCall;   //!if 1 fCallEnv is ok, -1 fCallEnv is not ok, 0 fCallEnv not setup yet.
    Bool_t       fIsMacro;   // plugin is a macro and not a library
    Bool_t       fIsGlobal;  // plugin ctor is a global function
 
    TPluginHandler() :
       fBase(), fRegexp(), fClass(), fPlugin(), fCtor(), fOrigin(),
-      fCallEnv(nullptr), fMethod(nullptr), fCanCall(0), fIsMacro(kTRUE), fIsGlobal(kTRUE) { }
+      fCallEnv(nullptr), fMethod(nullptr), fCompiledRegexp(nullptr), fCanCall(0), fIsMacro(kTRUE), fIsGlobal(kTRUE) { }
    TPluginHandler(const char *base, const char *regexp,
                   const char *className, const char *pluginName,
                   const char *ctor, const char *origin);
@@ -71,6 +71,8 @@ public:
    static void           ObjectDealloc(void *vp, size_t size);
 #endif
    static void           ObjectDealloc(void *vp, void *ptr);
+   static void          *PooledObjectAlloc(size_t size);
+   static void           PooledObjectDealloc(void *vp, size_t size);
 
    static void EnterStat(size_t size, void *p);
    static void RemoveStat(void *p);
@@ -0,0 +1,171 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** Bswapcpy
+\ingroup Base
+
+Byte swapping copies of arrays, see Bswapcpy.h.
+
+The element-wise tobuf() and frombuf() routines go through volatile unions and
+cannot be vectorized.  Here the bytes of whole vector registers are shuffled at
+once: with AVX2 (selected at run time with `__builtin_cpu_supports`) on x86-64,
+with NEON on 64 bit ARM.  The remaining elements, and all elements on other
+platforms, are swapped word by word in a loop that the compiler can vectorize
+for the baseline instruction set.
+*/
+
+#include "Bswapcpy.h"
+#include "Byteswap.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define R__BSWAPCPY_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define R__BSWAPCPY_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using Bswapcpy_t = void (*)(void *to, const void *from, size_t n);
+
+inline std::uint16_t BswapWord(std::uint16_t x)
+{
+   return R__bswap_16(x);
+}
+
+inline std::uint32_t BswapWord(std::uint32_t x)
+{
+   return R__bswap_32(x);
+}
+
+inline std::uint64_t BswapWord(std::uint64_t x)
+{
+   return R__bswap_64(x);
+}
+
+template <typename WordT>
+void BswapcpyScalar(void *to, const void *from, size_t n)
+{
+   char *out = static_cast<char *>(to);
+   const char *in = static_cast<const char *>(from);
+   for (size_t i = 0; i < n; ++i) {
+      WordT x;
+      memcpy(&x, in + i * sizeof(WordT), sizeof(WordT));
+      x = BswapWord(x);
+      memcpy(out + i * sizeof(WordT), &x, sizeof(WordT));
+   }
+}
+
+#ifdef R__BSWAPCPY_AVX2
+template <typename WordT>
+__attribute__((target("avx2"))) void BswapcpyAVX2(void *to, const void *from, size_t n)
+{
+   // vpshufb shuffles within each 128 bit lane, the mask is the same for both lanes
+   alignas(16) char lane[16];
+   for (int j = 0; j < 16; ++j)
+      lane[j] = (j / sizeof(WordT)) * sizeof(WordT) + (sizeof(WordT) - 1 - j % sizeof(WordT));
+   const __m256i mask = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(lane)));
+
+   char *out = static_cast<char *>(to);
+   const char *in = static_cast<const char *>(from);
+   const size_t nbytes = n * sizeof(WordT);
+   size_t i = 0;
+   for (; i + 64 <= nbytes; i += 64) {
+      __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+      __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i + 32), _mm256_shuffle_epi8(v1, mask));
+   }
+   for (; i + 32 <= nbytes; i += 32) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_shuffle_epi8(v, mask));
+   }
+   BswapcpyScalar<WordT>(out + i, in + i, (nbytes - i) / sizeof(WordT));
+}
+#endif
+
+#ifdef R__BSWAPCPY_NEON
+inline uint8x16_t BswapVector(uint8x16_t v, std::uint16_t)
+{
+   return vrev16q_u8(v);
+}
+
+inline uint8x16_t BswapVector(uint8x16_t v, std::uint32_t)
+{
+   return vrev32q_u8(v);
+}
+
+inline uint8x16_t BswapVector(uint8x16_t v, std::uint64_t)
+{
+   return vrev64q_u8(v);
+}
+
+template <typename WordT>
+void BswapcpyNEON(void *to, const void *from, size_t n)
+{
+   std::uint8_t *out = static_cast<std::uint8_t *>(to);
+   const std::uint8_t *in = static_cast<const std::uint8_t *>(from);
+   const size_t nbytes = n * sizeof(WordT);
+   size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16)
+      vst1q_u8(out + i, BswapVector(vld1q_u8(in + i), WordT()));
+   BswapcpyScalar<WordT>(out + i, in + i, (nbytes - i) / sizeof(WordT));
+}
+#endif
+
+template <typename WordT>
+Bswapcpy_t SelectBswapcpy()
+{
+#if defined(R__BSWAPCPY_AVX2)
+   if (__builtin_cpu_supports("avx2"))
+      return &BswapcpyAVX2<WordT>;
+#elif defined(R__BSWAPCPY_NEON)
+   return &BswapcpyNEON<WordT>;
+#endif
+   return &BswapcpyScalar<WordT>;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n elements of 2 bytes from `from` to `to`, swapping the bytes of each.
+
+void *bswapcpy16(void *to, const void *from, size_t n)
+{
+   static const Bswapcpy_t impl = SelectBswapcpy<std::uint16_t>();
+   impl(to, from, n);
+   return to;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n elements of 4 bytes from `from` to `to`, swapping the bytes of each.
+
+void *bswapcpy32(void *to, const void *from, size_t n)
+{
+   static const Bswapcpy_t impl = SelectBswapcpy<std::uint32_t>();
+   impl(to, from, n);
+   return to;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n elements of 8 bytes from `from` to `to`, swapping the bytes of each.
+
+void *bswapcpy64(void *to, const void *from, size_t n)
+{
+   static const Bswapcpy_t impl = SelectBswapcpy<std::uint64_t>();
+   impl(to, from, n);
+   return to;
+}
@@ -196,6 +196,7 @@ void TBuffer::SetBuffer(void *buf, UInt_t newsiz, Bool_t adopt, ReAllocCharFun_t
 
    fBuffer = (char *)buf;
    fBufCur = fBuffer;
+   fBufOffset = 0;
    if (newsiz > 0) {
       if ( (fMode&kWrite)!=0 ) {
          fBufSize = newsiz - kExtraSpace;
@@ -25,6 +25,7 @@
 #include "TSystem.h"
 #include "TVirtualMutex.h"
 #include "TThreadSlots.h"
+#include "ThreadLocalStorage.h"
 #include "TMethod.h"
 
 #include "TSpinLockGuard.h"
@@ -182,6 +183,41 @@ Bool_t TDirectory::AddDirectoryStatus()
    return fgAddDirectory;
 }
 
+static Bool_t &ThreadDetached()
+{
+   TTHREAD_TLS(Bool_t) detached(kFALSE);
+   return detached;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sets the flag detaching the current thread from the directories.
+///
+/// While the flag is set, the histograms and graphs created or copied by the
+/// current thread are not added to gDirectory, whatever the value of
+/// TH1::AddDirectory(), which is left unchanged for the other threads.
+/// Booking objects on a detached thread does not go through the locks of the
+/// shared directories; they can be adopted by a directory later on, with e.g.
+/// TH1::SetDirectory. See also TDirectory::TDetachedThread.
+///
+///  NOTE that this is a static function. To call it, use:
+/// ~~~ {.cpp}
+///     TDirectory::DetachThread
+/// ~~~
+
+void TDirectory::DetachThread(Bool_t detach)
+{
+   ThreadDetached() = detach;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function: returns true if the current thread is detached from the
+/// directories, see TDirectory::DetachThread.
+
+Bool_t TDirectory::IsThreadDetached()
+{
+   return ThreadDetached();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Append object to this directory.
 ///
@@ -237,7 +273,7 @@ void TDirectory::Browse(TBrowser *b)
 
 void TDirectory::BuildDirectory(TFile* /*motherFile*/, TDirectory* motherDir)
 {
-   fList       = new THashList(100,50);
+   fList       = new THashList(100,3);
    fList->UseRWLock();
    fMother     = motherDir;
    SetBit(kCanDelete);
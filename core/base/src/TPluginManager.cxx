@@ -124,16 +124,21 @@ TPluginHandler::TPluginHandler(const char *base, const char *regexp,
    fOrigin(origin),
    fCallEnv(nullptr),
    fMethod(nullptr),
+   fCompiledRegexp(nullptr),
    fCanCall(0),
    fIsMacro(kFALSE),
    fIsGlobal(kFALSE)
 {
-   TString aclicMode, arguments, io;
-   TString fname = gSystem->SplitAclicMode(fPlugin, aclicMode, arguments, io);
+   // Most handlers name a library: only a name with an extension can be a
+   // macro, avoid splitting the ACLiC mode of all the other ones.
    Bool_t validMacro = kFALSE;
-   if (fname.EndsWith(".C") || fname.EndsWith(".cxx") || fname.EndsWith(".cpp") ||
-       fname.EndsWith(".cc"))
-      validMacro = kTRUE;
+   if (fPlugin.Index(".") != kNPOS) {
+      TString aclicMode, arguments, io;
+      TString fname = gSystem->SplitAclicMode(fPlugin, aclicMode, arguments, io);
+      if (fname.EndsWith(".C") || fname.EndsWith(".cxx") || fname.EndsWith(".cpp") ||
+          fname.EndsWith(".cc"))
+         validMacro = kTRUE;
+   }
 
    if (validMacro && gROOT->LoadMacro(fPlugin, nullptr, kTRUE) == 0)
       fIsMacro = kTRUE;
@@ -150,6 +155,7 @@ TPluginHandler::TPluginHandler(const char *base, const char *regexp,
 TPluginHandler::~TPluginHandler()
 {
    delete fCallEnv;
+   delete fCompiledRegexp;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -164,14 +170,18 @@ Bool_t TPluginHandler::CanHandle(const char *base, const char *uri)
    if (!uri || fRegexp == "*")
       return kTRUE;
 
-   Bool_t wildcard = kFALSE;
-   if (!fRegexp.MaybeRegexp())
-      wildcard = kTRUE;
+   // The regexp is only compiled for the handlers of the bases actually
+   // used, and only once: TPluginManager::FindHandler holds the lock.
+   if (!fCompiledRegexp) {
+      Bool_t wildcard = kFALSE;
+      if (!fRegexp.MaybeRegexp())
+         wildcard = kTRUE;
+      fCompiledRegexp = new TRegexp(fRegexp, wildcard);
+   }
 
-   TRegexp re(fRegexp, wildcard);
    TString ruri = uri;
 
-   if (ruri.Index(re) != kNPOS)
+   if (ruri.Index(*fCompiledRegexp) != kNPOS)
       return kTRUE;
    return kFALSE;
 }
@@ -60,8 +60,10 @@ TExMap     *TProcessID::fgObjPIDs = nullptr; //Table (pointer,pids)
 ClassImp(TProcessID);
 
 static std::atomic<TProcessID *> gIsValidCache;
-using PIDCacheContent_t = std::pair<Int_t, TProcessID*>;
-static std::atomic<PIDCacheContent_t *> gGetProcessWithUIDCache;
+/// The TProcessIDs with the numbers below 255, which are encoded in the unique
+/// ID of the referenced objects, looked up without lock. A slot is filled on
+/// first use and reset when its TProcessID is deleted, under the write lock.
+static std::atomic<TProcessID *> gProcessWithUIDTable[255];
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return hash value for this object.
@@ -100,13 +102,11 @@ TProcessID::~TProcessID()
    TProcessID *This = this; // We need a referencable value for the 1st argument
    gIsValidCache.compare_exchange_strong(This, nullptr);
 
-   auto current = gGetProcessWithUIDCache.load();
-   if (current && current->second == this) {
-      gGetProcessWithUIDCache.compare_exchange_strong(current, nullptr);
-      delete current;
-   }
-
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   for (auto &slot : gProcessWithUIDTable) {
+      This = this;
+      slot.compare_exchange_strong(This, nullptr);
+   }
    fgPIDs->Remove(this);
 }
 
@@ -275,17 +275,13 @@ TProcessID *TProcessID::GetProcessWithUID(UInt_t uid, const void *obj)
       pid = fgObjPIDs->GetValue(hash,(Longptr_t)obj);
       return (TProcessID*)fgPIDs->At(pid);
    } else {
-      auto current = gGetProcessWithUIDCache.load();
-      if (current && current->first == pid)
-         return current->second;
+      auto &slot = gProcessWithUIDTable[pid];
+      if (auto res = slot.load(std::memory_order_acquire))
+         return res;
 
       R__READ_LOCKGUARD(ROOT::gCoreMutex);
       auto res = (TProcessID*)fgPIDs->At(pid);
-
-      auto next = new PIDCacheContent_t(pid, res);
-      auto old = gGetProcessWithUIDCache.exchange(next);
-      delete old;
-
+      slot.store(res, std::memory_order_release);
       return res;
    }
 }
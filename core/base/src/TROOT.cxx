@@ -1949,8 +1949,10 @@ void TROOT::InitSystem()
 
       ROOT::Internal::SetErrorSystemMsgHandler([](){ return gSystem->GetError(); });
       SetErrorHandler(DefaultErrorHandler);
+      ROOT::Internal::DeclareFilteringErrorHandler(DefaultErrorHandler);
 
       gDebug = gEnv->GetValue("Root.Debug", 0);
+      gErrorRepeatLimit = gEnv->GetValue("Root.ErrorRepeatLimit", 0);
 
       if (!gEnv->GetValue("Root.ErrorHandlers", 1))
          gSystem->ResetSignals();
@@ -381,10 +381,9 @@ TObject *TRef::GetObject() const
    if (!TProcessID::IsValid(fPID)) return nullptr;
    UInt_t uid = GetUniqueID();
 
-   //the reference may be in the TRefTable
+   //the reference may be in the TRefTable, which is the one of this thread
    TRefTable *table = TRefTable::GetRefTable();
    if (table) {
-      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
       table->SetUID(uid, fPID);
       table->Notify();
    }
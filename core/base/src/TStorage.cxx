@@ -31,6 +31,7 @@ and statistics gathering in the system.
 */
 
 #include <stdlib.h>
+#include <cstring>
 
 #include "TROOT.h"
 #include "TObjectTable.h"
@@ -374,6 +375,107 @@ void TStorage::ObjectDealloc(void *vp, void *ptr)
    if (vp && ptr) { }
 }
 
+namespace {
+
+// Per-thread free lists of the blocks released by PooledObjectDealloc, by size
+// class of 16 bytes. A block released by another thread than the one which
+// allocated it simply joins the lists of the releasing thread.
+struct TObjectPool {
+   static constexpr size_t kGranularity = 16;
+   static constexpr size_t kNClasses = 32;    // i.e. objects of up to 512 bytes
+   static constexpr size_t kMaxCached = 1024; // blocks kept per size class
+
+   struct Block_t {
+      Block_t *fNext;
+   };
+
+   Block_t *fFree[kNClasses] = {};
+   size_t fNFree[kNClasses] = {};
+
+   static size_t GetClass(size_t size) { return (size + kGranularity - 1) / kGranularity - 1; }
+
+   ~TObjectPool()
+   {
+      IsDestroyed() = true;
+      for (size_t i = 0; i < kNClasses; i++) {
+         while (Block_t *block = fFree[i]) {
+            fFree[i] = block->fNext;
+            ::operator delete(block);
+         }
+      }
+   }
+
+   // Objects can still be deleted once the pool of their thread is destroyed,
+   // e.g. by the static destructors run after those of the main thread locals.
+   static bool &IsDestroyed()
+   {
+      thread_local bool destroyed = false;
+      return destroyed;
+   }
+};
+
+TObjectPool *GetObjectPool()
+{
+   if (TObjectPool::IsDestroyed())
+      return nullptr;
+   thread_local TObjectPool pool;
+   return &pool;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Used to allocate a TObject on the heap by the classes opting in for pooled
+/// allocation (see R__POOLED_ALLOCATION in TObject.h). Small objects reuse
+/// the blocks released on the same thread by PooledObjectDealloc, avoiding the
+/// calls to the global heap of programs creating and deleting many of them.
+/// As for ObjectAlloc, the memory is filled to allow TObject to detect the
+/// objects created on the heap.
+
+void *TStorage::PooledObjectAlloc(size_t sz)
+{
+   const size_t iclass = TObjectPool::GetClass(sz);
+   if (sz == 0 || iclass >= TObjectPool::kNClasses)
+      return ObjectAlloc(sz);
+
+   TObjectPool *pool = GetObjectPool();
+   void *space = pool ? pool->fFree[iclass] : nullptr;
+   if (space) {
+      pool->fFree[iclass] = pool->fFree[iclass]->fNext;
+      pool->fNFree[iclass]--;
+   } else {
+      space = ::operator new((iclass + 1) * TObjectPool::kGranularity);
+   }
+   memset(space, kObjectAllocMemValue, sz);
+   return space;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Used to deallocate a TObject allocated by PooledObjectAlloc, size being
+/// the one given at allocation: the block is kept for reuse by the current
+/// thread, unless enough blocks of this size are already available.
+
+void TStorage::PooledObjectDealloc(void *vp, size_t sz)
+{
+   if (!vp)
+      return;
+   const size_t iclass = TObjectPool::GetClass(sz);
+   if (sz == 0 || iclass >= TObjectPool::kNClasses) {
+      ::operator delete(vp);
+      return;
+   }
+
+   TObjectPool *pool = GetObjectPool();
+   if (!pool || pool->fNFree[iclass] >= TObjectPool::kMaxCached) {
+      ::operator delete(vp);
+      return;
+   }
+   auto block = static_cast<TObjectPool::Block_t *>(vp);
+   block->fNext = pool->fFree[iclass];
+   pool->fFree[iclass] = block;
+   pool->fNFree[iclass]++;
+}
+
 #ifdef R__SIZEDDELETE
 ////////////////////////////////////////////////////////////////////////////////
 /// Used to deallocate a TObject on the heap (via TObject::operator delete()),
@@ -0,0 +1,41 @@
+#include "Bswapcpy.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Covers the vectorized blocks as well as the remainders handled element by element
+void TestBswapcpy(std::size_t wordSize, void *(*bswapcpy)(void *, const void *, std::size_t))
+{
+   for (std::size_t n : {0, 1, 3, 7, 8, 15, 16, 17, 33, 100, 1001}) {
+      std::vector<std::uint8_t> from(n * wordSize);
+      std::vector<std::uint8_t> to(n * wordSize);
+      for (std::size_t i = 0; i < from.size(); ++i)
+         from[i] = i * 7 + 1;
+      EXPECT_EQ(to.data(), bswapcpy(to.data(), from.data(), n));
+      for (std::size_t i = 0; i < from.size(); ++i) {
+         ASSERT_EQ(from[(i / wordSize) * wordSize + wordSize - 1 - i % wordSize], to[i])
+            << "n=" << n << " byte " << i;
+      }
+   }
+}
+
+} // anonymous namespace
+
+TEST(Bswapcpy, Bswapcpy16)
+{
+   TestBswapcpy(2, bswapcpy16);
+}
+
+TEST(Bswapcpy, Bswapcpy32)
+{
+   TestBswapcpy(4, bswapcpy32);
+}
+
+TEST(Bswapcpy, Bswapcpy64)
+{
+   TestBswapcpy(8, bswapcpy64);
+}
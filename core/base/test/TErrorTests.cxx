@@ -10,9 +10,11 @@ int gTestLastLevel = -1;
 bool gTestLastAbort = false;
 std::string gTestLastLocation;
 std::string gTestLastMsg;
+int gTestNMessages = 0;
 
 void TestErrorHandler(int level, Bool_t abort, const char *location, const char *msg)
 {
+   ++gTestNMessages;
    gTestLastLevel = level;
    gTestLastAbort = abort;
    gTestLastLocation = location;
@@ -55,3 +57,50 @@ TEST(TError, LongMessage) {
    Info("location", "%s", longMessage.c_str());
    EXPECT_EQ(longMessage, gTestLastMsg);
 }
+
+
+TEST(TError, IgnoredMessagesDroppedBeforeFormatting) {
+   SetErrorHandler(TestErrorHandler);
+   auto prevIgnoreLevel = gErrorIgnoreLevel;
+   gErrorIgnoreLevel = kWarning;
+
+   // The test handler does not filter on the ignore level, it gets all the messages
+   gTestNMessages = 0;
+   Info("location", "ignored");
+   EXPECT_EQ(1, gTestNMessages);
+
+   ROOT::Internal::DeclareFilteringErrorHandler(TestErrorHandler);
+   gTestNMessages = 0;
+   Info("location", "ignored");
+   EXPECT_EQ(0, gTestNMessages);
+   Warning("location", "message");
+   EXPECT_EQ(1, gTestNMessages);
+
+   ROOT::Internal::DeclareFilteringErrorHandler(DefaultErrorHandler);
+   gErrorIgnoreLevel = prevIgnoreLevel;
+}
+
+TEST(TError, RepeatLimit) {
+   SetErrorHandler(TestErrorHandler);
+   ROOT::Internal::ResetErrorMessageCounts();
+   gErrorRepeatLimit = 2;
+
+   gTestNMessages = 0;
+   for (int i = 0; i < 5; ++i)
+      Warning("location", "repeated %d", i);
+   EXPECT_EQ(2, gTestNMessages);
+   EXPECT_EQ(3, ROOT::Internal::GetNSuppressedErrorMessages());
+   EXPECT_EQ(0u, gTestLastMsg.find("repeated 1 (repeated 2 times"));
+
+   // The messages are counted by level, location and format
+   Error("location", "repeated %d", 5);
+   Warning("other location", "repeated %d", 6);
+   Warning("location", "other %d", 7);
+   EXPECT_EQ(5, gTestNMessages);
+
+   ROOT::Internal::ResetErrorMessageCounts();
+   EXPECT_EQ(0, ROOT::Internal::GetNSuppressedErrorMessages());
+   Warning("location", "repeated %d", 8);
+   EXPECT_EQ(6, gTestNMessages);
+   gErrorRepeatLimit = 0;
+}
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+
+#include "TObject.h"
+#include "TStorage.h"
+
+#include <thread>
+
+namespace {
+struct TPooledObject : public TObject {
+   double fValues[4] = {};
+   R__POOLED_ALLOCATION
+};
+
+struct TLargePooledObject : public TPooledObject {
+   char fPayload[1024];
+};
+} // namespace
+
+TEST(TStorage, PooledAllocationReusesBlocks)
+{
+   auto first = new TPooledObject;
+   EXPECT_TRUE(first->IsOnHeap());
+   void *address = first;
+   delete first;
+
+   auto second = new TPooledObject;
+   EXPECT_EQ(address, static_cast<void *>(second));
+   EXPECT_TRUE(second->IsOnHeap());
+   EXPECT_EQ(second->GetUniqueID(), 0u);
+   delete second;
+
+   TPooledObject onStack;
+   EXPECT_FALSE(onStack.IsOnHeap());
+}
+
+TEST(TStorage, PooledAllocationLargeAndCrossThread)
+{
+   TObject *large = new TLargePooledObject;
+   EXPECT_TRUE(large->IsOnHeap());
+   delete large;
+
+   // a block released on another thread is simply kept by that thread
+   auto obj = new TPooledObject;
+   std::thread([obj] { delete obj; }).join();
+   auto other = new TPooledObject;
+   EXPECT_TRUE(other->IsOnHeap());
+   delete other;
+}
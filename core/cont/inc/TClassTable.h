@@ -55,6 +55,7 @@ private:
    static ROOT::TClassRec   *FindElementImpl(const char *cname, Bool_t insert);
    static ROOT::TClassRec   *FindElement(const char *cname, Bool_t insert=kFALSE);
    static void         SortTable();
+   static void         Expand(UInt_t newSize);
 
    static Bool_t CheckClassTableInit();
 
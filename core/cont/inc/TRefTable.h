@@ -26,6 +26,7 @@
 
 #include "TObject.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -48,7 +49,9 @@ protected:
    TObject          *fOwner;      //Object owning this TRefTable
    std::vector<std::string> fProcessGUIDs; // UUIDs of TProcessIDs used in fParentIDs
    std::vector<Int_t> fMapPIDtoInternal;   //! cache of pid to index in fProcessGUIDs
-   static TRefTable *fgRefTable;  //Pointer to current TRefTable
+   TProcessID       *fLastPID;    //!TProcessID of the latest lookup of an index in fProcessGUIDs
+   Int_t             fLastIID;    //!index in fProcessGUIDs of fLastPID
+   std::vector<std::atomic<TRefTable *> *> fCurrentIn; //!slots of the threads whose current TRefTable this is
 
    Int_t              AddInternalIdxForPID(TProcessID* procid);
    virtual Int_t      ExpandForIID(Int_t iid, Int_t newsize);
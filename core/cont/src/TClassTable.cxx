@@ -190,10 +190,12 @@ namespace ROOT {
 
    static UInt_t ClassTableHash(const char *name, UInt_t size)
    {
+      // FNV-1a: unlike a shift and xor, all the characters of the long
+      // template instance names contribute to the slot.
       auto p = reinterpret_cast<const unsigned char*>( name );
-      UInt_t slot = 0;
+      UInt_t slot = 2166136261u;
 
-      while (*p) slot = slot<<1 ^ *p++;
+      while (*p) slot = (slot ^ *p++) * 16777619u;
       slot %= size;
 
       return slot;
@@ -523,12 +525,57 @@ TClassRec *TClassTable::FindElementImpl(const char *cname, Bool_t insert)
 
    if (!insert) return nullptr;
 
+   // Keep the chains short: the dictionaries of all the loaded libraries
+   // register many thousands of classes at start up.
+   if (fgTally >= fgSize) {
+      Expand(2 * fgSize + 1);
+      slot = ROOT::ClassTableHash(cname, fgSize);
+   }
+
    fgTable[slot] = new TClassRec(fgTable[slot]);
 
    fgTally++;
    return fgTable[slot];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Rehash the class records and the alternate names in tables of newSize slots.
+/// All the records have a name: Add sets it right after FindElementImpl created
+/// the record.
+
+void TClassTable::Expand(UInt_t newSize)
+{
+   TClassRec **table = new TClassRec* [newSize];
+   TClassAlt **alternate = new TClassAlt* [newSize];
+   memset(table, 0, newSize*sizeof(TClassRec*));
+   memset(alternate, 0, newSize*sizeof(TClassAlt*));
+
+   for (UInt_t i = 0; i < fgSize; i++) {
+      TClassRec *r = fgTable[i];
+      while (r) {
+         TClassRec *next = r->fNext;
+         UInt_t slot = ROOT::ClassTableHash(r->fName, newSize);
+         r->fNext = table[slot];
+         table[slot] = r;
+         r = next;
+      }
+      TClassAlt *a = fgAlternate[i];
+      while (a) {
+         TClassAlt *next = a->fNext.release();
+         UInt_t slot = ROOT::ClassTableHash(a->fName, newSize);
+         a->fNext.reset(alternate[slot]);
+         alternate[slot] = a;
+         a = next;
+      }
+   }
+
+   delete [] fgTable;
+   delete [] fgAlternate;
+   fgTable = table;
+   fgAlternate = alternate;
+   fgSize = newSize;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Find a class by name in the class table (using hash of name). Returns
 /// 0 if the class is not in the table. Unless arguments insert is true in
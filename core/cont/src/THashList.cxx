@@ -311,6 +311,11 @@ void THashList::RecursiveRemove(TObject *obj)
 {
    if (!obj) return;
 
+   // Nothing to remove nor to forward to: avoid computing the hash of obj,
+   // as most of the (directory) lists scanned for each deleted object are empty.
+   if (!fFirst.get())
+      return;
+
    // It might not be safe to rely on TROOT::RecursiveRemove to take the readlock in case user code
    // is calling directly gROOT->GetListOfCleanups()->RecursiveRemove(...)
    // However this can become a significant bottleneck if there are a very large number of
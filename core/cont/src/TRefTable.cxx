@@ -35,6 +35,10 @@ all known TProcessIDs in fProcessGUIDs; the index of a TProcessID in
 this vector defines the index of the auto-loading info in fParentIDs
 for that TProcessID. The mapping of TProcessID* to index is cached
 for quick non-persistent lookup.
+
+The current TRefTable, returned by GetRefTable, is kept per thread: a
+thread filling or reading a tree with references uses the table of the
+TBranchRef of that tree, independently of the other threads.
 */
 
 #include "TRefTable.h"
@@ -42,17 +46,36 @@ for quick non-persistent lookup.
 #include "TObjArray.h"
 #include "TProcessID.h"
 #include <algorithm>
+#include <mutex>
+
+namespace {
+
+/// Protects the fCurrentIn lists of the TRefTables
+std::mutex &GetCurrentRefTableMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
 
-TRefTable *TRefTable::fgRefTable = nullptr;
+/// The current TRefTable of a thread, which is reset when the thread ends
+struct RCurrentRefTable {
+   std::atomic<TRefTable *> fTable{nullptr};
+   ~RCurrentRefTable() { TRefTable::SetRefTable(nullptr); }
+};
+
+thread_local RCurrentRefTable gCurrentRefTable;
+
+} // namespace
 
 ClassImp(TRefTable);
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for I/O.
 
 TRefTable::TRefTable() : fNumPIDs(0), fAllocSize(nullptr), fN(nullptr), fParentIDs(nullptr), fParentID(-1),
-                         fDefaultSize(10), fUID(0), fUIDContext(nullptr), fSize(0), fParents(nullptr), fOwner(nullptr)
+                         fDefaultSize(10), fUID(0), fUIDContext(nullptr), fSize(0), fParents(nullptr), fOwner(nullptr),
+                         fLastPID(nullptr), fLastIID(-1)
 {
-   fgRefTable   = this;
+   SetRefTable(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -60,9 +83,10 @@ TRefTable::TRefTable() : fNumPIDs(0), fAllocSize(nullptr), fN(nullptr), fParentI
 
 TRefTable::TRefTable(TObject *owner, Int_t size) :
      fNumPIDs(0), fAllocSize(nullptr), fN(nullptr), fParentIDs(nullptr), fParentID(-1),
-     fDefaultSize(size<10 ? 10 : size), fUID(0), fUIDContext(nullptr), fSize(0), fParents(new TObjArray(1)), fOwner(owner)
+     fDefaultSize(size<10 ? 10 : size), fUID(0), fUIDContext(nullptr), fSize(0), fParents(new TObjArray(1)), fOwner(owner),
+     fLastPID(nullptr), fLastIID(-1)
 {
-   fgRefTable   = this;
+   SetRefTable(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -77,7 +101,10 @@ TRefTable::~TRefTable()
    }
    delete [] fParentIDs;
    delete fParents;
-   if (fgRefTable == this) fgRefTable = nullptr;
+   // this is no longer the current table of any thread
+   std::lock_guard<std::mutex> lock(GetCurrentRefTableMutex());
+   for (auto slot : fCurrentIn)
+      slot->store(nullptr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +163,8 @@ Int_t TRefTable::AddInternalIdxForPID(TProcessID *procid)
    }
 
    ExpandPIDs(iid + 1);
+   fLastPID = procid;
+   fLastIID = iid;
    return iid;
 }
 
@@ -264,10 +293,13 @@ TObject *TRefTable::GetParent(Int_t uid, TProcessID *context /* =0 */ ) const
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the index for fProcessIDs, fAllocSize, etc given a PID.
-/// Uses fMapPIDtoInternal and the pid's GUID / fProcessGUID
+/// Uses fMapPIDtoInternal and the pid's GUID / fProcessGUID; the index of
+/// the latest PID, usually the only one, is returned directly.
 
 Int_t TRefTable::GetInternalIdxForPID(TProcessID *procid) const
 {
+   if (procid && procid == fLastPID)
+      return fLastIID;
    return const_cast <TRefTable*>(this)->AddInternalIdxForPID(procid);
 }
 
@@ -282,11 +314,11 @@ Int_t TRefTable::GetInternalIdxForPID(Int_t pid) const
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Static function returning the current TRefTable.
+/// Static function returning the current TRefTable of this thread.
 
 TRefTable *TRefTable::GetRefTable()
 {
-   return fgRefTable;
+   return gCurrentRefTable.fTable.load(std::memory_order_relaxed);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -378,11 +410,22 @@ Int_t TRefTable::SetParent(const TObject* parent, Int_t branchID)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Static function setting the current TRefTable.
+/// Static function setting the current TRefTable of this thread.
 
 void TRefTable::SetRefTable(TRefTable *table)
 {
-   fgRefTable = table;
+   std::atomic<TRefTable *> &slot = gCurrentRefTable.fTable;
+   if (slot.load(std::memory_order_relaxed) == table)
+      return;
+   std::lock_guard<std::mutex> lock(GetCurrentRefTableMutex());
+   // the previous table resets the slot if it is deleted meanwhile
+   if (TRefTable *previous = slot.load()) {
+      auto &slots = previous->fCurrentIn;
+      slots.erase(std::find(slots.begin(), slots.end(), &slot));
+   }
+   slot.store(table);
+   if (table)
+      table->fCurrentIn.push_back(&slot);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,27 @@
+#include "gtest/gtest.h"
+#include "TRefTable.h"
+
+#include <memory>
+#include <thread>
+
+// The current TRefTable is kept per thread, and reset when it is deleted
+TEST(TRefTable, CurrentTablePerThread)
+{
+   auto table = std::make_unique<TRefTable>(nullptr, 10);
+   EXPECT_EQ(TRefTable::GetRefTable(), table.get());
+
+   TRefTable *otherCurrent = table.get();
+   std::thread other([&] {
+      otherCurrent = TRefTable::GetRefTable();
+      auto otherTable = std::make_unique<TRefTable>(nullptr, 10);
+      EXPECT_EQ(TRefTable::GetRefTable(), otherTable.get());
+   });
+   other.join();
+   EXPECT_EQ(otherCurrent, nullptr);
+   EXPECT_EQ(TRefTable::GetRefTable(), table.get());
+
+   std::thread user([&] { TRefTable::SetRefTable(table.get()); });
+   user.join();
+   table.reset();
+   EXPECT_EQ(TRefTable::GetRefTable(), nullptr);
+}
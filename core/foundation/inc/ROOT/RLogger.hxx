@@ -317,6 +317,23 @@ inline ELogLevel RLogChannel::GetEffectiveVerbosity(const RLogManager &mgr) cons
    return fVerbosity;
 }
 
+namespace Internal {
+
+/// Returns whether a diagnostic of the given severity is emitted to the channel. The warnings and errors that are not
+/// emitted are counted here, such that their message is not built.
+inline bool IsLogEmitted(ELogLevel severity, RLogChannel &channel)
+{
+   auto &mgr = RLogManager::Get();
+   if (channel.GetEffectiveVerbosity(mgr) >= severity)
+      return true;
+   mgr.Increment(severity);
+   if (&channel != &mgr)
+      channel.Increment(severity);
+   return false;
+}
+
+} // namespace Internal
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -335,16 +352,14 @@ inline ELogLevel RLogChannel::GetEffectiveVerbosity(const RLogManager &mgr) cons
  RLogScopedVerbosity silence(RLogLevel::kFatal);
  R__LOG_DEBUG(7) << WillNotBeCalled();
  ~~~
- - To update counts of warnings / errors / fatal errors, those RLogEntries must
- always be created, even if in the end their emission will be silenced. This
- should be fine, performance-wise, as they should not happen frequently.
+ - The counts of warnings / errors / fatal errors are updated even if their
+ emission is silenced, without building their message, see `IsLogEmitted()`.
  - Use `(condition) && RLogBuilder(...)` instead of `if (condition) RLogBuilder(...)`
  to prevent "ambiguous else" in invocations such as `if (something) R__LOG_DEBUG()...`.
  */
 #define R__LOG_TO_CHANNEL(SEVERITY, CHANNEL)                                                                        \
-   ((SEVERITY < ROOT::Experimental::ELogLevel::kInfo + 0) ||                                                        \
-     ROOT::Experimental::Internal::GetChannelOrManager(CHANNEL).GetEffectiveVerbosity(                              \
-        ROOT::Experimental::RLogManager::Get()) >= SEVERITY) &&                                                     \
+   ROOT::Experimental::Internal::IsLogEmitted(SEVERITY,                                                             \
+                                              ROOT::Experimental::Internal::GetChannelOrManager(CHANNEL)) &&        \
       ROOT::Experimental::Detail::RLogBuilder(SEVERITY, ROOT::Experimental::Internal::GetChannelOrManager(CHANNEL), \
                                               __FILE__, __LINE__, R__LOG_PRETTY_FUNCTION)
 
@@ -77,6 +77,21 @@ extern void DefaultErrorHandler(int level, Bool_t abort, const char *location, c
 extern ErrorHandlerFunc_t SetErrorHandler(ErrorHandlerFunc_t newhandler);
 extern ErrorHandlerFunc_t GetErrorHandler();
 
+namespace ROOT {
+namespace Internal {
+
+/// Declare that handler drops the messages below gErrorIgnoreLevel, as the minimal error handler does. While it is
+/// the error handler, ErrorHandler() drops these messages before formatting them. TROOT declares DefaultErrorHandler.
+void DeclareFilteringErrorHandler(ErrorHandlerFunc_t handler);
+
+/// Returns the number of messages suppressed because they were repeated more than gErrorRepeatLimit times.
+Long64_t GetNSuppressedErrorMessages();
+/// Forget the number of times the messages were repeated.
+void ResetErrorMessageCounts();
+
+} // namespace Internal
+} // namespace ROOT
+
 extern void Info(const char *location, const char *msgfmt, ...)
 #if defined(__GNUC__) && !defined(__CINT__)
 __attribute__((format(printf, 2, 3)))
@@ -126,6 +141,7 @@ R__EXTERN const char *kCheckMsg;
 
 R__EXTERN Int_t  gErrorIgnoreLevel;
 R__EXTERN Int_t  gErrorAbortLevel;
+R__EXTERN Int_t  gErrorRepeatLimit;
 R__EXTERN Bool_t gPrintViaErrorHandler;
 
 #endif
@@ -26,19 +26,62 @@ to be replaced by the proper DefaultErrorHandler()
 #include <cstdio>
 #include <cstdlib>
 #include <cerrno>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 // Deprecated
 TVirtualMutex *gErrorMutex = nullptr;
 
 Int_t  gErrorIgnoreLevel     = kUnset;
 Int_t  gErrorAbortLevel      = kSysError+1;
+Int_t  gErrorRepeatLimit     = 0;
 Bool_t gPrintViaErrorHandler = kFALSE;
 
 const char *kAssertMsg = "%s violated at line %d of `%s'";
 const char *kCheckMsg  = "%s not true at line %d of `%s'";
 
 static ErrorHandlerFunc_t gErrorHandler = ROOT::Internal::MinimalErrorHandler;
+static std::atomic<ErrorHandlerFunc_t> gFilteringErrorHandler{nullptr};
+
+namespace {
+
+/// Number of times each message was emitted, by level, location and format. The counts are split in shards with their
+/// own lock, such that threads emitting different messages rarely contend.
+struct RMessageCounts {
+   static constexpr std::size_t kNShards = 16;
+   struct RShard {
+      std::mutex fMutex;
+      std::unordered_map<std::string, Long64_t> fCounts;
+   };
+   std::array<RShard, kNShards> fShards;
+   std::atomic<Long64_t> fNSuppressed{0};
+};
+
+/// Never destructed, such that messages can be emitted during the destruction of static objects
+RMessageCounts &GetMessageCounts()
+{
+   static RMessageCounts *counts = new RMessageCounts();
+   return *counts;
+}
+
+/// Count an emission of a message, returns the number of times it was emitted including this one.
+Long64_t CountMessage(Int_t level, const char *location, const char *fmt)
+{
+   std::string key = std::to_string(level);
+   key += ':';
+   key += location ? location : "";
+   key += ':';
+   key += fmt;
+   auto &shard = GetMessageCounts().fShards[std::hash<std::string>{}(key) % RMessageCounts::kNShards];
+   std::lock_guard<std::mutex> lock(shard.fMutex);
+   return ++shard.fCounts[key];
+}
+
+} // unnamed namespace
 
 
 static ROOT::Internal::ErrorSystemMsgHandlerFunc_t &GetErrorSystemMsgHandlerRef()
@@ -83,6 +126,26 @@ void MinimalErrorHandler(Int_t level, Bool_t abort_bool, const char *location, c
    }
 }
 
+void DeclareFilteringErrorHandler(ErrorHandlerFunc_t handler)
+{
+   gFilteringErrorHandler = handler;
+}
+
+Long64_t GetNSuppressedErrorMessages()
+{
+   return GetMessageCounts().fNSuppressed;
+}
+
+void ResetErrorMessageCounts()
+{
+   auto &counts = GetMessageCounts();
+   for (auto &shard : counts.fShards) {
+      std::lock_guard<std::mutex> lock(shard.fMutex);
+      shard.fCounts.clear();
+   }
+   counts.fNSuppressed = 0;
+}
+
 } // namespace Internal
 } // namespace ROOT
 
@@ -108,9 +171,32 @@ ErrorHandlerFunc_t GetErrorHandler()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// General error handler function. It calls the user set error handler.
+///
+/// The messages below gErrorIgnoreLevel are dropped before being formatted if the error handler is known to drop
+/// them, see ROOT::Internal::DeclareFilteringErrorHandler(). If gErrorRepeatLimit is positive, the messages from a
+/// given location with a given format and level are emitted at most gErrorRepeatLimit times; the following ones,
+/// except the fatal ones, are dropped and counted, see ROOT::Internal::GetNSuppressedErrorMessages().
 
 void ErrorHandler(Int_t level, const char *location, const char *fmt, std::va_list ap)
 {
+   if (level < gErrorIgnoreLevel &&
+       (gErrorHandler == ROOT::Internal::MinimalErrorHandler || gErrorHandler == gFilteringErrorHandler))
+      return;
+
+   if (!fmt)
+      fmt = "no error message provided";
+
+   // counting the message must not change the error reported by SysError()
+   const int savedErrno = errno;
+   Long64_t repetitions = 0;
+   if (gErrorRepeatLimit > 0 && level < kFatal) {
+      repetitions = CountMessage(level, location, fmt);
+      if (repetitions > gErrorRepeatLimit) {
+         ++GetMessageCounts().fNSuppressed;
+         return;
+      }
+   }
+
    thread_local Int_t buf_size(256);
    thread_local char *buf_storage(nullptr);
 
@@ -120,9 +206,6 @@ void ErrorHandler(Int_t level, const char *location, const char *fmt, std::va_li
    std::va_list ap_copy;
    va_copy(ap_copy, ap);
 
-   if (!fmt)
-      fmt = "no error message provided";
-
    Int_t n = vsnprintf(buf, buf_size, fmt, ap_copy);
    if (n >= buf_size) {
       va_end(ap_copy);
@@ -140,12 +223,15 @@ void ErrorHandler(Int_t level, const char *location, const char *fmt, std::va_li
 
    std::string bp = buf;
    if (level >= kSysError && level < kFatal) {
+      errno = savedErrno;
       bp.push_back(' ');
       if (GetErrorSystemMsgHandlerRef())
          bp += GetErrorSystemMsgHandlerRef()();
       else
          bp += std::string("(errno: ") + std::to_string(errno) + ")";
    }
+   if (repetitions > 0 && repetitions == gErrorRepeatLimit)
+      bp += " (repeated " + std::to_string(repetitions) + " times, further repetitions are suppressed)";
 
    if (level != kFatal)
       gErrorHandler(level, level >= gErrorAbortLevel, location, bp.c_str());
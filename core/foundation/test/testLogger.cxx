@@ -263,6 +263,23 @@ TEST(Logger, SuppressStreamEval)
    EXPECT_FALSE(wasEvaluated);
 }
 
+TEST(Logger, SuppressedWarningsCountedWithoutStreamEval)
+{
+   TestLogger testLogger;
+   RLogChannel channel("channel");
+   RLogScopedVerbosity suppress(channel, ELogLevel::kError);
+   auto prevWarnings = RLogManager::Get().GetNumWarnings();
+   bool wasEvaluated = false;
+   R__LOG_WARNING(channel) << "suppressed" << [&]() -> int {
+      wasEvaluated = true;
+      return 0;
+   }();
+   EXPECT_FALSE(wasEvaluated);
+   EXPECT_TRUE(testLogger.empty());
+   EXPECT_EQ(RLogManager::Get().GetNumWarnings(), prevWarnings + 1);
+   EXPECT_EQ(channel.GetNumWarnings(), 1);
+}
+
 namespace {
 struct TestErrorHandler_t {
    int fLevel;
@@ -0,0 +1,106 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTaskGraph
+#define ROOT_RTaskGraph
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RTaskGraph {
+   /**
+   \class ROOT::Experimental::RTaskGraph
+   \ingroup Parallelism
+   \brief A directed acyclic graph of tasks, run once or as a pipeline over a stream of tokens.
+
+   Nodes are work items receiving the index of the token they process; an edge from node A to node B means that,
+   for a given token, B only runs once A is done. Run(nTokens, maxInFlight) pushes nTokens tokens through the graph,
+   keeping at most maxInFlight of them in flight: a new token enters the graph only when a previous one has gone
+   through all the nodes, which bounds the memory used by the intermediate results (backpressure). Nodes added as
+   serial process one token at a time, e.g. a stage writing to a file; the others can process several tokens at
+   the same time: the tokens ready for a busy serial node are queued, without blocking a worker thread.
+
+   The tasks run in ROOT's global task arena, i.e. they share the worker threads with the rest of the implicit
+   multi-threading. If implicit multi-threading is not enabled, the tokens are processed one after the other by the
+   calling thread, following a topological order of the nodes. An exception thrown by a node cancels the graph and
+   is rethrown by Run().
+   ~~~{.cpp}
+   ROOT::Experimental::RTaskGraph graph;
+   auto read = graph.AddNode([&](std::size_t i) { ReadCluster(i); }, true);  // serial
+   auto unzip = graph.AddNode([&](std::size_t i) { Unzip(i); });             // parallel
+   auto write = graph.AddNode([&](std::size_t i) { Write(i); }, true);       // serial
+   graph.AddEdge(read, unzip);
+   graph.AddEdge(unzip, write);
+   graph.Run(nClusters, 8);
+   ~~~
+   */
+public:
+   using NodeId_t = std::size_t;
+   using Task_t = std::function<void(std::size_t)>;
+
+private:
+   struct RSlot;
+
+   struct RNode {
+      Task_t fTask;
+      std::vector<NodeId_t> fSuccessors;
+      unsigned int fNPredecessors = 0;
+      bool fSerial = false;
+      bool fBusy = false;          ///< a serial node is processing a token
+      std::deque<RSlot *> fQueue;  ///< tokens waiting for a busy serial node
+      std::unique_ptr<std::mutex> fMutex{new std::mutex};
+   };
+
+   /// State of the token going through the graph in one of the in-flight slots
+   struct RSlot {
+      std::size_t fToken = 0;
+      std::unique_ptr<std::atomic<unsigned int>[]> fPendingPredecessors;
+      std::atomic<std::size_t> fPendingNodes{0};
+   };
+
+   std::vector<RNode> fNodes;
+   std::vector<NodeId_t> fOrder; ///< topological order of the nodes, filled by Run()
+   std::vector<std::unique_ptr<RSlot>> fSlots;
+   std::atomic<std::size_t> fNextToken{0};
+   std::size_t fNTokens = 0;
+   void *fTaskGroup = nullptr; ///< the tbb::task_group of the running graph
+
+   void SortNodes();
+   void Spawn(RSlot &slot, NodeId_t node);
+   void ExecuteNode(RSlot &slot, NodeId_t node);
+   void CompleteNode(RSlot &slot, NodeId_t node);
+   void StartToken(RSlot &slot, std::size_t token);
+
+public:
+   RTaskGraph() = default;
+   RTaskGraph(const RTaskGraph &) = delete;
+   RTaskGraph &operator=(const RTaskGraph &) = delete;
+
+   NodeId_t AddNode(const Task_t &task, bool serial = false);
+   NodeId_t AddNode(const std::function<void(void)> &task, bool serial = false);
+   void AddEdge(NodeId_t from, NodeId_t to);
+
+   void Run(std::size_t nTokens = 1, std::size_t maxInFlight = 1);
+
+   std::size_t GetNNodes() const { return fNodes.size(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -3,13 +3,18 @@
 
 #include "ROOT/RTaskArena.hxx"
 #include "ROpaqueTaskArena.hxx"
+#include "TEnv.h"
 #include "TError.h"
 #include "TROOT.h"
 #include "TThread.h"
+#include <algorithm>
 #include <fstream>
 #include <mutex>
 #include <thread>
 #include "tbb/task_arena.h"
+#if TBB_INTERFACE_VERSION >= 12010
+#include "tbb/info.h"
+#endif
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
 
@@ -72,10 +77,29 @@ int LogicalCPUBandwithControl()
 /// * Checks for CPU bandwidth control and avoids oversubscribing
 /// * If no BC in place and maxConcurrency<1, defaults to the default tbb number of threads,
 /// which is CPU affinity aware
+/// * If `Root.ImplicitMT.NumaNode` is set to a NUMA node index in `.rootrc`, the worker threads are pinned
+/// to the cores of that node, so that the memory they first touch is allocated on it, and the default number
+/// of threads is the number of cores of the node. This requires a TBB with NUMA support (oneTBB with tbbbind).
 ////////////////////////////////////////////////////////////////////////////////
 RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new ROpaqueTaskArena{})
 {
-   const unsigned tbbDefaultNumberThreads = fTBBArena->max_concurrency(); // not initialized, automatic state
+   unsigned tbbDefaultNumberThreads = fTBBArena->max_concurrency(); // not initialized, automatic state
+   const int numaNode = gEnv ? gEnv->GetValue("Root.ImplicitMT.NumaNode", -1) : -1;
+#if TBB_INTERFACE_VERSION >= 12010
+   bool useNumaNode = false;
+   if (numaNode >= 0) {
+      const auto nodes = tbb::info::numa_nodes();
+      if (std::find(nodes.begin(), nodes.end(), numaNode) != nodes.end()) {
+         useNumaNode = true;
+         tbbDefaultNumberThreads = tbb::info::default_concurrency(numaNode);
+      } else {
+         Warning("RTaskArenaWrapper", "NUMA node %d not available, the worker threads are not pinned", numaNode);
+      }
+   }
+#else
+   if (numaNode >= 0)
+      Warning("RTaskArenaWrapper", "This TBB version does not support NUMA nodes, ignoring Root.ImplicitMT.NumaNode");
+#endif
    maxConcurrency = maxConcurrency > 0 ? std::min(maxConcurrency, tbbDefaultNumberThreads) : tbbDefaultNumberThreads;
    const unsigned bcCpus = LogicalCPUBandwithControl();
    if (maxConcurrency > bcCpus) {
@@ -86,7 +110,14 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
       Warning("RTaskArenaWrapper", "tbb::global_control is active, limiting the number of parallel workers"
                                    "from this task arena available for execution.");
    }
+#if TBB_INTERFACE_VERSION >= 12010
+   if (useNumaNode)
+      fTBBArena->initialize(tbb::task_arena::constraints(numaNode, maxConcurrency));
+   else
+      fTBBArena->initialize(maxConcurrency);
+#else
    fTBBArena->initialize(maxConcurrency);
+#endif
    fNWorkers = maxConcurrency;
    ROOT::EnableThreadSafety();
 }
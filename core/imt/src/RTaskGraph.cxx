@@ -0,0 +1,225 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h"
+
+#include "ROOT/RTaskGraph.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/RTaskArena.hxx"
+#include "ROpaqueTaskArena.hxx"
+#include "TROOT.h"
+#include "tbb/task_group.h"
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+/**
+\class ROOT::Experimental::RTaskGraph
+\ingroup Parallelism
+\brief A directed acyclic graph of tasks, run once or as a pipeline over a stream of tokens.
+
+Each token runs the nodes of the graph in an order compatible with the edges. Several tokens, up to the maximum
+number in flight given to Run(), go through the graph at the same time, so that the stages of a pipeline (e.g.
+read, unzip, deserialize, process and write) process different tokens concurrently. The tasks are scheduled in
+ROOT's global task arena, the one used by the implicit multi-threading, instead of a separate pool of threads.
+*/
+
+namespace ROOT {
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a node running task for each token, with the token index as argument.
+/// A serial node processes at most one token at a time.
+RTaskGraph::NodeId_t RTaskGraph::AddNode(const Task_t &task, bool serial)
+{
+   if (fTaskGroup)
+      throw std::runtime_error("RTaskGraph: cannot add a node while the graph is running.");
+   fNodes.emplace_back();
+   fNodes.back().fTask = task;
+   fNodes.back().fSerial = serial;
+   return fNodes.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a node running task for each token, which does not need the token index.
+RTaskGraph::NodeId_t RTaskGraph::AddNode(const std::function<void(void)> &task, bool serial)
+{
+   return AddNode(Task_t([task](std::size_t) { task(); }), serial);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add an edge: for each token, node to only runs once node from is done.
+void RTaskGraph::AddEdge(NodeId_t from, NodeId_t to)
+{
+   if (fTaskGroup)
+      throw std::runtime_error("RTaskGraph: cannot add an edge while the graph is running.");
+   if (from >= fNodes.size() || to >= fNodes.size())
+      throw std::runtime_error("RTaskGraph: unknown node " + std::to_string(std::max(from, to)) + ".");
+   if (from == to)
+      throw std::runtime_error("RTaskGraph: a node cannot depend on itself.");
+   fNodes[from].fSuccessors.push_back(to);
+   ++fNodes[to].fNPredecessors;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill fOrder with a topological order of the nodes; throws if the graph has a cycle.
+void RTaskGraph::SortNodes()
+{
+   std::vector<unsigned int> nPredecessors(fNodes.size());
+   fOrder.clear();
+   for (NodeId_t i = 0; i < fNodes.size(); ++i) {
+      nPredecessors[i] = fNodes[i].fNPredecessors;
+      if (nPredecessors[i] == 0)
+         fOrder.push_back(i);
+   }
+   for (std::size_t i = 0; i < fOrder.size(); ++i) {
+      for (auto succ : fNodes[fOrder[i]].fSuccessors) {
+         if (--nPredecessors[succ] == 0)
+            fOrder.push_back(succ);
+      }
+   }
+   if (fOrder.size() != fNodes.size())
+      throw std::runtime_error("RTaskGraph: the graph contains a cycle.");
+}
+
+#ifdef R__USE_IMT
+
+////////////////////////////////////////////////////////////////////////////////
+/// Submit the execution of node for the token of slot to the task group.
+void RTaskGraph::Spawn(RSlot &slot, NodeId_t node)
+{
+   static_cast<tbb::task_group *>(fTaskGroup)->run([this, &slot, node] { ExecuteNode(slot, node); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run node for the token of slot. If the node is serial and already busy, the token is queued and
+/// processed by the task running the node, once it is done with its current token.
+void RTaskGraph::ExecuteNode(RSlot &slot, NodeId_t node)
+{
+   RNode &n = fNodes[node];
+   if (!n.fSerial) {
+      n.fTask(slot.fToken);
+      CompleteNode(slot, node);
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(*n.fMutex);
+      if (n.fBusy) {
+         n.fQueue.push_back(&slot);
+         return;
+      }
+      n.fBusy = true;
+   }
+   RSlot *current = &slot;
+   while (current) {
+      n.fTask(current->fToken);
+      CompleteNode(*current, node);
+      std::lock_guard<std::mutex> lock(*n.fMutex);
+      if (n.fQueue.empty()) {
+         n.fBusy = false;
+         current = nullptr;
+      } else {
+         current = n.fQueue.front();
+         n.fQueue.pop_front();
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the successors of node whose predecessors are all done for the token of slot. Once the token went
+/// through the whole graph, the slot starts the next token, if any.
+void RTaskGraph::CompleteNode(RSlot &slot, NodeId_t node)
+{
+   for (auto succ : fNodes[node].fSuccessors) {
+      if (--slot.fPendingPredecessors[succ] == 0)
+         Spawn(slot, succ);
+   }
+   if (--slot.fPendingNodes == 0) {
+      const std::size_t next = fNextToken++;
+      if (next < fNTokens)
+         StartToken(slot, next);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset the counters of slot, which is not used by any task, and spawn the sources of the graph for token.
+void RTaskGraph::StartToken(RSlot &slot, std::size_t token)
+{
+   slot.fToken = token;
+   for (NodeId_t i = 0; i < fNodes.size(); ++i)
+      slot.fPendingPredecessors[i] = fNodes[i].fNPredecessors;
+   slot.fPendingNodes = fNodes.size();
+   for (auto node : fOrder) {
+      if (fNodes[node].fNPredecessors != 0)
+         break;
+      Spawn(slot, node);
+   }
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Push nTokens tokens, with indices from 0 to nTokens - 1, through the graph; at most maxInFlight tokens are
+/// processed at the same time. The method returns once all tokens went through all the nodes. If a node throws,
+/// the graph is cancelled and the exception is rethrown.
+void RTaskGraph::Run(std::size_t nTokens, std::size_t maxInFlight)
+{
+   if (fTaskGroup)
+      throw std::runtime_error("RTaskGraph: the graph is already running.");
+   if (maxInFlight == 0)
+      throw std::runtime_error("RTaskGraph: the maximum number of tokens in flight must be larger than zero.");
+   SortNodes();
+   if (nTokens == 0 || fNodes.empty())
+      return;
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      const std::size_t nSlots = std::min(nTokens, maxInFlight);
+      fSlots.clear();
+      for (std::size_t i = 0; i < nSlots; ++i) {
+         fSlots.emplace_back(new RSlot);
+         fSlots.back()->fPendingPredecessors.reset(new std::atomic<unsigned int>[fNodes.size()]);
+      }
+      for (auto &node : fNodes) {
+         node.fBusy = false;
+         node.fQueue.clear();
+      }
+      fNTokens = nTokens;
+      fNextToken = nSlots;
+
+      tbb::task_group group;
+      fTaskGroup = &group;
+      try {
+         ROOT::Internal::GetGlobalTaskArena()->Access().execute([&] {
+            for (std::size_t i = 0; i < nSlots; ++i)
+               StartToken(*fSlots[i], i);
+            group.wait();
+         });
+      } catch (...) {
+         fTaskGroup = nullptr;
+         throw;
+      }
+      fTaskGroup = nullptr;
+      return;
+   }
+#endif
+
+   for (std::size_t token = 0; token < nTokens; ++token) {
+      for (auto node : fOrder)
+         fNodes[node].fTask(token);
+   }
+}
+
+} // namespace Experimental
+} // namespace ROOT
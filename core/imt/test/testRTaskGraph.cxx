@@ -0,0 +1,119 @@
+#include "TROOT.h"
+#include "ROOT/RTaskGraph.hxx"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+// read -> {unzip, check} -> write, where write is serial and records the order of the stages of each token
+void RunDiamond(std::size_t nTokens, std::size_t maxInFlight)
+{
+   std::vector<std::atomic<int>> stage(nTokens);
+   std::atomic<int> inFlight{0};
+   std::atomic<int> maxSeenInFlight{0};
+   std::atomic<int> inWrite{0};
+   std::atomic<bool> orderOk{true};
+   std::vector<std::size_t> written;
+
+   RTaskGraph graph;
+   auto read = graph.AddNode([&](std::size_t i) {
+      auto n = ++inFlight;
+      int seen = maxSeenInFlight;
+      while (n > seen && !maxSeenInFlight.compare_exchange_weak(seen, n))
+         ;
+      stage[i] = 1;
+   });
+   auto unzip = graph.AddNode([&](std::size_t i) {
+      if (stage[i] < 1)
+         orderOk = false;
+   });
+   auto check = graph.AddNode([&](std::size_t i) {
+      if (stage[i] < 1)
+         orderOk = false;
+   });
+   auto write = graph.AddNode(
+      [&](std::size_t i) {
+         if (++inWrite != 1)
+            orderOk = false;
+         written.push_back(i);
+         stage[i] = 2;
+         --inWrite;
+         --inFlight;
+      },
+      true);
+   graph.AddEdge(read, unzip);
+   graph.AddEdge(read, check);
+   graph.AddEdge(unzip, write);
+   graph.AddEdge(check, write);
+   EXPECT_EQ(graph.GetNNodes(), 4u);
+
+   graph.Run(nTokens, maxInFlight);
+
+   EXPECT_TRUE(orderOk);
+   EXPECT_LE(maxSeenInFlight, int(maxInFlight));
+   ASSERT_EQ(written.size(), nTokens);
+   for (std::size_t i = 0; i < nTokens; ++i)
+      EXPECT_EQ(stage[i], 2);
+}
+
+TEST(RTaskGraph, Sequential)
+{
+   RunDiamond(100, 4);
+}
+
+TEST(RTaskGraph, SingleRun)
+{
+   int value = 0;
+   RTaskGraph graph;
+   auto a = graph.AddNode([&] { value = 2; });
+   auto b = graph.AddNode([&] { value *= 3; });
+   graph.AddEdge(a, b);
+   graph.Run();
+   EXPECT_EQ(value, 6);
+}
+
+TEST(RTaskGraph, WrongGraph)
+{
+   RTaskGraph graph;
+   auto a = graph.AddNode([] {});
+   auto b = graph.AddNode([] {});
+   EXPECT_THROW(graph.AddEdge(a, a), std::runtime_error);
+   EXPECT_THROW(graph.AddEdge(a, 2), std::runtime_error);
+   graph.AddEdge(a, b);
+   graph.AddEdge(b, a);
+   EXPECT_THROW(graph.Run(), std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RTaskGraph, Pipeline)
+{
+   ROOT::EnableImplicitMT(4);
+   RunDiamond(1000, 1);
+   RunDiamond(1000, 8);
+   RunDiamond(3, 8);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RTaskGraph, Exception)
+{
+   ROOT::EnableImplicitMT(4);
+   RTaskGraph graph;
+   std::atomic<int> n{0};
+   auto a = graph.AddNode([&](std::size_t i) {
+      if (i == 10)
+         throw std::runtime_error("failure");
+   });
+   auto b = graph.AddNode([&](std::size_t) { ++n; });
+   graph.AddEdge(a, b);
+   EXPECT_THROW(graph.Run(100, 4), std::runtime_error);
+   EXPECT_LT(n, 100);
+   // the graph can be run again after a failure
+   EXPECT_NO_THROW(graph.Run(5, 2));
+   ROOT::DisableImplicitMT();
+}
+#endif
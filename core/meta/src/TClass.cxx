@@ -87,7 +87,9 @@ In order to access the name of a class within the ROOT type system, the method T
 #include "TThreadSlots.h"
 #include "ThreadLocalStorage.h"
 
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <cctype>
 #include <set>
 #include <iostream>
@@ -464,6 +466,120 @@ namespace ROOT {
          fMap.erase(key);
       }
    };
+
+   class TLoadedClassCache {
+   // Lock-free cache of the loaded TClass objects, used by TClass::GetClass
+   // to answer the look ups of the classes already known without taking
+   // ROOT::gCoreMutex. Two fixed size open addressing tables are keyed by the
+   // hash of the class name and of the type_info name: the TClass pointer of
+   // an entry is set only after its key and each hit is checked against the
+   // TClass itself, hence a concurrent insertion can only cause a miss, which
+   // falls back to the locked look up. A table which runs out of slots simply
+   // stops caching. Entries are cleared by TClass::RemoveClass, SetUnloaded
+   // and ~TClass.
+   private:
+      static constexpr size_t kNSlots = 4096; // power of 2
+      static constexpr size_t kMaxProbes = 16;
+
+      struct Slot_t {
+         std::atomic<size_t>  fKey{0};
+         std::atomic<TClass*> fClass{nullptr};
+      };
+      Slot_t fByName[kNSlots];
+      Slot_t fByTypeInfo[kNSlots];
+
+      static size_t Hash(const char *name)
+      {
+         // FNV-1a, 0 marks an empty slot
+         size_t h = 14695981039346656037ull;
+         for (; *name; ++name)
+            h = (h ^ (unsigned char)*name) * 1099511628211ull;
+         return h ? h : 1;
+      }
+
+      template <typename Match>
+      static TClass *Find(const Slot_t *slots, size_t key, Match &&match)
+      {
+         for (size_t i = 0; i < kMaxProbes; ++i) {
+            const Slot_t &slot = slots[(key + i) & (kNSlots - 1)];
+            size_t slotKey = slot.fKey.load(std::memory_order_acquire);
+            if (slotKey == 0)
+               return nullptr;
+            if (slotKey != key)
+               continue;
+            TClass *cl = slot.fClass.load(std::memory_order_acquire);
+            if (cl && match(cl))
+               return cl;
+         }
+         return nullptr;
+      }
+
+      static void Insert(Slot_t *slots, size_t key, TClass *cl)
+      {
+         for (size_t i = 0; i < kMaxProbes; ++i) {
+            Slot_t &slot = slots[(key + i) & (kNSlots - 1)];
+            size_t slotKey = slot.fKey.load(std::memory_order_acquire);
+            if (slotKey == 0 && slot.fKey.compare_exchange_strong(slotKey, key, std::memory_order_acq_rel))
+               slotKey = key;
+            if (slotKey != key)
+               continue;
+            TClass *expected = nullptr;
+            if (slot.fClass.compare_exchange_strong(expected, cl, std::memory_order_acq_rel) || expected == cl)
+               return;
+         }
+      }
+
+      static void Remove(Slot_t *slots, size_t key, TClass *cl)
+      {
+         for (size_t i = 0; i < kMaxProbes; ++i) {
+            Slot_t &slot = slots[(key + i) & (kNSlots - 1)];
+            size_t slotKey = slot.fKey.load(std::memory_order_acquire);
+            if (slotKey == 0)
+               return;
+            TClass *expected = cl;
+            if (slotKey == key)
+               slot.fClass.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+         }
+      }
+
+   public:
+      TClass *Find(const char *name) const
+      {
+         return Find(fByName, Hash(name), [name](TClass *cl) {
+            return cl->IsLoaded() && strcmp(cl->GetName(), name) == 0;
+         });
+      }
+      TClass *Find(const std::type_info &typeinfo) const
+      {
+         return Find(fByTypeInfo, Hash(typeinfo.name()), [&typeinfo](TClass *cl) {
+            const std::type_info *clTypeInfo = cl->GetTypeInfo();
+            return cl->IsLoaded() && clTypeInfo && *clTypeInfo == typeinfo;
+         });
+      }
+      void Insert(const char *name, TClass *cl)
+      {
+         Insert(fByName, Hash(name), cl);
+      }
+      void Insert(const std::type_info &typeinfo, TClass *cl)
+      {
+         Insert(fByTypeInfo, Hash(typeinfo.name()), cl);
+      }
+      void Remove(TClass *cl)
+      {
+         Remove(fByName, Hash(cl->GetName()), cl);
+         if (cl->GetTypeInfo())
+            Remove(fByTypeInfo, Hash(cl->GetTypeInfo()->name()), cl);
+      }
+   };
+}
+
+namespace {
+   // Never deleted: the TClass destructors running at tear down still use it.
+   ROOT::TLoadedClassCache &GetLoadedClassCache()
+   {
+      static ROOT::TLoadedClassCache *gLoadedClassCache = new ROOT::TLoadedClassCache;
+      return *gLoadedClassCache;
+   }
 }
 
 IdMap_t *TClass::GetIdMap() {
@@ -522,6 +638,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   GetLoadedClassCache().Remove(oldcl);
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -1661,6 +1778,8 @@ TClass::~TClass()
 {
    R__LOCKGUARD(gInterpreterMutex);
 
+   GetLoadedClassCache().Remove(this);
+
    // Remove from the typedef hashtables.
    if (fgClassTypedefHash && TestBit (kHasNameMapNode)) {
       TString resolvedThis = TClassEdit::ResolveTypedef (GetName(), kTRUE);
@@ -2981,14 +3100,22 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Classes already loaded are found without taking any lock.
+   TClass *cl = GetLoadedClassCache().Find(name);
+   if (cl) return cl;
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
-   TClass *cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
+   cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) {
+      if (cl->IsLoaded())
+         GetLoadedClassCache().Insert(name, cl);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -3245,12 +3372,19 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Classes already loaded are found without taking any lock.
+   TClass *cl = GetLoadedClassCache().Find(typeinfo);
+   if (cl) return cl;
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   TClass* cl = GetIdMap()->Find(typeinfo.name());
+   cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) {
+      GetLoadedClassCache().Insert(typeinfo, cl);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -6302,6 +6436,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   GetLoadedClassCache().Remove(this);
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
@@ -39,6 +39,9 @@ using MPCodeBufPair = std::pair<unsigned, std::unique_ptr<TBufferFile>>;
 // to send a code and an object of any non-pointer type.
 int MPSend(TSocket *s, unsigned code);
 
+// Send a code and an object already serialized in objBuf, through shared memory if objBuf is large
+int MPSendObjBuf(TSocket *s, unsigned code, const TBufferFile &objBuf);
+
 template<class T, typename std::enable_if<std::is_class<T>::value>::type * = nullptr>
 int MPSend(TSocket *s, unsigned code, T obj);
 
@@ -83,7 +86,9 @@ T ReadBuffer(TBufferFile *buf);
 /// **Note:** only objects the headers of which have been parsed by
 /// cling can be sent using MPSend(). User-defined types can be made available to
 /// cling via a call like `gSystem->ProcessLine("#include \"header.h\"")`.
-/// Pointer types cannot be sent via MPSend() (with the exception of const char*).
+/// Pointer types cannot be sent via MPSend() (with the exception of const char*).\n
+/// **Note:** objects serialized in more bytes than the `MultiProc.SharedMemoryThreshold`
+/// resource (1 MB by default) are passed through a POSIX shared memory segment, see MPSendObjBuf().
 /// \param s a pointer to a valid TSocket. No validity checks are performed\n
 /// \param code the code to be sent
 /// \param obj the object to be sent
@@ -98,11 +103,7 @@ int MPSend(TSocket *s, unsigned code, T obj)
    }
    TBufferFile objBuf(TBuffer::kWrite);
    objBuf.WriteObjectAny(&obj, c);
-   TBufferFile wBuf(TBuffer::kWrite);
-   wBuf.WriteUInt(code);
-   wBuf.WriteULong(objBuf.Length());
-   wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
-   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+   return MPSendObjBuf(s, code, objBuf);
 }
 
 /// \cond
@@ -137,14 +138,7 @@ int MPSend(TSocket *s, unsigned code, T obj)
    TBufferFile objBuf(TBuffer::kWrite);
    if(obj != nullptr)
       objBuf.WriteObjectAny(obj, obj->IsA());
-
-   //write everything together in a buffer
-   TBufferFile wBuf(TBuffer::kWrite);
-   wBuf.WriteUInt(code);
-   wBuf.WriteULong(objBuf.Length());
-   if(objBuf.Length())
-      wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
-   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+   return MPSendObjBuf(s, code, objBuf);
 }
 
 /// \endcond
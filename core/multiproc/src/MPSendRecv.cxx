@@ -12,7 +12,92 @@
 #include "MPSendRecv.h"
 #include "TBufferFile.h"
 #include "MPCode.h"
+#include "TEnv.h"
+#include <atomic>
+#include <cstring> //memcpy
 #include <memory> //unique_ptr
+#include <string>
+#include <fcntl.h> //O_* constants
+#include <sys/mman.h> //shm_open, mmap
+#include <unistd.h> //ftruncate, getpid
+
+namespace {
+
+/// Bit of the object size of the messages whose object is in a shared memory segment: the message then
+/// only holds the name of the segment and the size of the object
+const ULong_t kShmBit = ULong_t(1) << (8 * sizeof(ULong_t) - 1);
+
+/// Size from which the objects are passed through shared memory, 0 or less to never use it
+Long64_t GetShmThreshold()
+{
+   static const Long64_t threshold = gEnv->GetValue("MultiProc.SharedMemoryThreshold", 1048576);
+   return threshold;
+}
+
+/// Copy the content of buf in a new shared memory segment, whose name is returned in name.
+/// Return false if the segment could not be created, e.g. because no shared memory is left.
+bool WriteShmSegment(const TBufferFile &buf, std::string &name)
+{
+   static std::atomic<unsigned> counter{0};
+   name = "/ROOTMP-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+   const size_t size = buf.Length();
+   int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+   if (fd < 0)
+      return false;
+#ifdef R__LINUX
+   // Reserve the pages now: writing beyond the free shared memory through the mapping would raise SIGBUS
+   const bool resized = posix_fallocate(fd, 0, size) == 0;
+#else
+   const bool resized = ftruncate(fd, size) == 0;
+#endif
+   void *addr = resized ? mmap(nullptr, size, PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+   close(fd);
+   if (addr == MAP_FAILED) {
+      shm_unlink(name.c_str());
+      return false;
+   }
+   memcpy(addr, buf.Buffer(), size);
+   munmap(addr, size);
+   return true;
+}
+
+/// A TBufferFile reading an object from a mapped shared memory segment, unmapped when the buffer is deleted
+class TMPShmBuffer : public TBufferFile {
+   void *fSegment;
+   size_t fSegmentSize;
+
+public:
+   TMPShmBuffer(void *segment, Int_t size)
+      : TBufferFile(TBuffer::kRead, size, segment, false), fSegment(segment), fSegmentSize(size)
+   {
+   }
+   ~TMPShmBuffer() override { munmap(fSegment, fSegmentSize); }
+};
+
+/// Map the shared memory segment whose handle is in handleBuf, and remove its name: it is freed when unmapped
+std::unique_ptr<TBufferFile> MapShmSegment(TBufferFile &handleBuf)
+{
+   char name[256];
+   handleBuf.ReadString(name, sizeof(name));
+   Int_t size = 0;
+   handleBuf.ReadInt(size);
+   int fd = shm_open(name, O_RDONLY, 0);
+   if (fd < 0) {
+      SysError("MPRecv", "[E] Could not open shared memory segment %s", name);
+      return nullptr;
+   }
+   // A private mapping lets the buffer be modified while it is read, without affecting the segment
+   void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+   shm_unlink(name);
+   if (addr == MAP_FAILED) {
+      SysError("MPRecv", "[E] Could not map shared memory segment %s", name);
+      return nullptr;
+   }
+   return std::make_unique<TMPShmBuffer>(addr, size);
+}
+
+} // anonymous namespace
 
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
@@ -37,6 +122,40 @@ int MPSend(TSocket *s, unsigned code)
    return s->SendRaw(wBuf.Buffer(), wBuf.Length());
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with a code and an object already serialized in objBuf.
+/// This is how the templated versions of MPSend() send objects.\n
+/// If objBuf holds at least as many bytes as the `MultiProc.SharedMemoryThreshold`
+/// resource (1048576 by default, 0 to disable it), the object is copied in a
+/// new POSIX shared memory segment and the message only contains the name of
+/// the segment: MPRecv() maps the segment and reads the object from it, without
+/// transferring it through the socket. The receiver removes the segment; if
+/// the message is never received, the segment remains until reboot.
+/// If the segment cannot be created, the object is sent through the socket.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param objBuf the serialized object, possibly empty
+/// \return the number of bytes sent, as per TSocket::SendRaw
+int MPSendObjBuf(TSocket *s, unsigned code, const TBufferFile &objBuf)
+{
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   std::string segment;
+   const Long64_t threshold = GetShmThreshold();
+   if (threshold > 0 && objBuf.Length() >= threshold && WriteShmSegment(objBuf, segment)) {
+      TBufferFile handleBuf(TBuffer::kWrite);
+      handleBuf.WriteString(segment.c_str());
+      handleBuf.WriteInt(objBuf.Length());
+      wBuf.WriteULong(kShmBit | handleBuf.Length());
+      wBuf.WriteBuf(handleBuf.Buffer(), handleBuf.Length());
+   } else {
+      wBuf.WriteULong(objBuf.Length());
+      if (objBuf.Length())
+         wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
+   }
+   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
@@ -49,6 +168,8 @@ int MPSend(TSocket *s, unsigned code)
 /// * non-pointer built-in types: TBufferFile::operator>> must be used\n
 /// * c-strings: TBufferFile::ReadString must be used\n
 /// * class types: TBufferFile::ReadObjectAny must be used\n
+/// If the object was passed in a shared memory segment (see MPSendObjBuf()), the
+/// returned TBufferFile reads it from the mapped segment.\n
 /// \param s a pointer to a valid TSocket. No validity checks are performed\n
 /// \return ::MPCodeBufPair, i.e. an std::pair containing message code and (possibly) object
 MPCodeBufPair MPRecv(TSocket *s)
@@ -73,6 +194,9 @@ MPCodeBufPair MPRecv(TSocket *s)
    ULong_t classBufSize;
    bufReader.ReadULong(classBufSize);
    delete [] rawbuf;
+   //the message might only contain the handle of a shared memory segment holding the object
+   const bool inShm = classBufSize & kShmBit;
+   classBufSize &= ~kShmBit;
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
@@ -80,6 +204,11 @@ MPCodeBufPair MPRecv(TSocket *s)
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
+      if (inShm) {
+         objBuf = MapShmSegment(*objBuf);
+         if (!objBuf)
+            return std::make_pair(MPCode::kRecvError, nullptr);
+      }
    }
 
    return std::make_pair(code, std::move(objBuf));
@@ -35,7 +35,10 @@
 /// deletes what it returns, it simply forgets it.\n
 /// **Note:** that the usage of ROOT::TProcessExecutor::Map is indicated only when the task to be
 /// executed takes more than a few seconds, otherwise the overhead introduced
-/// by Map will outrun the benefits of parallel execution on most machines.
+/// by Map will outrun the benefits of parallel execution on most machines.\n
+/// **Note:** the results larger than the `MultiProc.SharedMemoryThreshold` resource
+/// (1 MB by default) are handed over by the workers in POSIX shared memory
+/// segments, only their names being sent through the sockets.
 ///
 /// \param func
 /// \parblock
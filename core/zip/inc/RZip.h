@@ -23,6 +23,25 @@ extern "C" unsigned long R__memcompress(char *tgt, unsigned long tgtsize, char *
 
 extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues);
 
+/**
+ * Same as R__zipMultipleAlgorithm, using the dictionary dictID (see R__AddCompressionDictionary) when the algorithm
+ * is ZSTD.  The buffers are decompressed with R__unzip, which finds the dictionary from the ID in the compressed frame.
+ */
+extern "C" void R__zipWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                     ROOT::RCompressionSetting::EAlgorithm::EValues, unsigned int dictID);
+
+/**
+ * Register a ZSTD dictionary for compression and decompression, returns its ID (0 if dict is not a dictionary).
+ */
+extern "C" unsigned int R__AddCompressionDictionary(const char *dict, int dictsize);
+
+/**
+ * Train a ZSTD dictionary of at most capacity bytes on the nsamples samples stored one after the other in samples.
+ * Returns the size of the dictionary, 0 in case of failure.
+ */
+extern "C" int R__TrainCompressionDictionary(char *dict, int capacity, const char *samples, const int *samplesizes,
+                                             unsigned int nsamples);
+
 /**
  * This is a historical definition, prior to ROOT supporting multiple algorithms in a single file.  Use
  * R__zipMultipleAlgorithm instead.
@@ -33,6 +52,37 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * Context of the decompression of consecutive compressed records that arrive in pieces, e.g. from the network, into
+ * their final destination.  Each record is inflated into the target as soon as it is complete: directly from the
+ * piece if the record is contained in it, otherwise from a copy of its bytes collected by the context.
+ */
+struct R__unzip_stream {
+   unsigned char *tgt;     /* where the next record is inflated */
+   int tgtsize;            /* remaining size of the target */
+   int nout;               /* number of bytes inflated so far */
+   unsigned char *pending; /* the beginning of a record split between pieces */
+   int npending;           /* number of bytes in pending */
+   int pendingsize;        /* allocated size of pending */
+   int error;              /* non zero after an error */
+};
+
+/**
+ * Start the decompression of records into the tgtsize bytes at tgt.
+ */
+extern "C" void R__unzip_stream_init(struct R__unzip_stream *stream, unsigned char *tgt, int tgtsize);
+
+/**
+ * Add the next srcsize bytes of the records and inflate the records that are complete.  Returns the number of bytes
+ * inflated so far, -1 in case of error.
+ */
+extern "C" int R__unzip_stream_feed(struct R__unzip_stream *stream, unsigned char *src, int srcsize);
+
+/**
+ * Release the resources of the context.  Returns 0 if all the records fed were complete and inflated, 1 otherwise.
+ */
+extern "C" int R__unzip_stream_end(struct R__unzip_stream *stream);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
@@ -17,6 +17,8 @@
 #include "zlib.h"
 
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <cassert>
 
 // The size of the ROOT block framing headers for compression:
@@ -110,6 +112,32 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   }
 }
 
+void R__zipWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                          ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm, unsigned int dictID)
+{
+  if (dictID == 0 || compressionAlgorithm != ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
+     R__zipMultipleAlgorithm(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm);
+     return;
+  }
+
+  if (*srcsize < 1 + HDRSIZE + 1 || cxlevel <= 0) {
+     *irep = 0;
+     return;
+  }
+  R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, dictID);
+}
+
+unsigned int R__AddCompressionDictionary(const char *dict, int dictsize)
+{
+   return R__zstdAddDictionary(dict, dictsize);
+}
+
+int R__TrainCompressionDictionary(char *dict, int capacity, const char *samples, const int *samplesizes,
+                                  unsigned int nsamples)
+{
+   return R__zstdTrainDictionary(dict, capacity, samples, samplesizes, nsamples);
+}
+
   // The very old algorithm for backward compatibility
   // 0 for selecting with R__ZipMode in a backward compatible way
   // 3 for selecting in other cases
@@ -421,3 +449,102 @@ void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
      *irep = stream.total_out;
      return;
 }
+
+/**
+ * Below are the routines for the streaming decompression of records.
+ */
+
+void R__unzip_stream_init(struct R__unzip_stream *stream, unsigned char *tgt, int tgtsize)
+{
+   stream->tgt = tgt;
+   stream->tgtsize = tgtsize;
+   stream->nout = 0;
+   stream->pending = nullptr;
+   stream->npending = 0;
+   stream->pendingsize = 0;
+   stream->error = 0;
+}
+
+/* Inflate the complete record of srcsize bytes at src into the target of the stream, returns 0 in case of success */
+static int R__unzip_stream_record(struct R__unzip_stream *stream, unsigned char *src, int srcsize)
+{
+   int nout = 0;
+   R__unzip(&srcsize, src, &stream->tgtsize, stream->tgt, &nout);
+   if (nout == 0) {
+      fprintf(stderr, "R__unzip_stream_feed: error during decompression\n");
+      stream->error = 1;
+      return 1;
+   }
+   stream->tgt += nout;
+   stream->tgtsize -= nout;
+   stream->nout += nout;
+   return 0;
+}
+
+int R__unzip_stream_feed(struct R__unzip_stream *stream, unsigned char *src, int srcsize)
+{
+   int nin, nbuf;
+
+   if (stream->error)
+      return -1;
+
+   while (srcsize > 0) {
+      /* the records contained in the piece are inflated in place */
+      if (stream->npending == 0 && srcsize >= HDRSIZE) {
+         if (R__unzip_header(&nin, src, &nbuf)) {
+            stream->error = 1;
+            return -1;
+         }
+         if (nin <= srcsize) {
+            if (R__unzip_stream_record(stream, src, nin))
+               return -1;
+            src += nin;
+            srcsize -= nin;
+            continue;
+         }
+      }
+
+      /* collect the header of the record, then the rest of the record */
+      int needed = HDRSIZE;
+      if (stream->npending >= HDRSIZE) {
+         R__unzip_header(&needed, stream->pending, &nbuf);
+      }
+      if (needed > stream->pendingsize) {
+         unsigned char *pending = (unsigned char *)realloc(stream->pending, needed);
+         if (!pending) {
+            fprintf(stderr, "R__unzip_stream_feed: cannot allocate %d bytes\n", needed);
+            stream->error = 1;
+            return -1;
+         }
+         stream->pending = pending;
+         stream->pendingsize = needed;
+      }
+      int ncopy = needed - stream->npending < srcsize ? needed - stream->npending : srcsize;
+      memcpy(stream->pending + stream->npending, src, ncopy);
+      stream->npending += ncopy;
+      src += ncopy;
+      srcsize -= ncopy;
+
+      if (stream->npending == HDRSIZE && needed == HDRSIZE) {
+         if (R__unzip_header(&needed, stream->pending, &nbuf)) {
+            stream->error = 1;
+            return -1;
+         }
+      }
+      if (stream->npending >= HDRSIZE && stream->npending == needed) {
+         stream->npending = 0;
+         if (R__unzip_stream_record(stream, stream->pending, needed))
+            return -1;
+      }
+   }
+
+   return stream->nout;
+}
+
+int R__unzip_stream_end(struct R__unzip_stream *stream)
+{
+   free(stream->pending);
+   stream->pending = nullptr;
+   stream->pendingsize = 0;
+   return stream->error || stream->npending != 0;
+}
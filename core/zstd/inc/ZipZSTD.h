@@ -17,6 +17,9 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned int dictID);
+unsigned int R__zstdAddDictionary(const char *dict, int dictsize);
+int R__zstdTrainDictionary(char *dict, int capacity, const char *samples, const int *samplesizes, unsigned int nsamples);
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,11 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <iostream>
 
@@ -22,17 +26,110 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
+namespace {
+
+/// The dictionaries known to this process, by dictionary ID.  The dictionaries of the
+/// files being read are added when their StreamerInfo record is read; the ones trained
+/// for files being written when the training is done.  They are never removed, such
+/// that the frames compressed with them can always be decompressed.
+class RZstdDictionaries {
+   struct RDictDeleter {
+      void operator()(ZSTD_CDict *cdict) const { ZSTD_freeCDict(cdict); }
+      void operator()(ZSTD_DDict *ddict) const { ZSTD_freeDDict(ddict); }
+   };
+   struct RDictionary {
+      std::vector<char> fContent;
+      std::unique_ptr<ZSTD_DDict, RDictDeleter> fDDict;
+      std::map<int, std::unique_ptr<ZSTD_CDict, RDictDeleter>> fCDicts; ///< By compression level
+   };
+   std::mutex fMutex;
+   std::map<unsigned int, RDictionary> fDictionaries;
+
+public:
+   static RZstdDictionaries &Instance()
+   {
+      static RZstdDictionaries dictionaries;
+      return dictionaries;
+   }
+
+   unsigned int Add(const char *dict, int dictsize)
+   {
+      unsigned int id = ZDICT_getDictID(dict, dictsize);
+      if (id == 0)
+         return 0;
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto &entry = fDictionaries[id];
+      if (!entry.fDDict) {
+         entry.fContent.assign(dict, dict + dictsize);
+         entry.fDDict.reset(ZSTD_createDDict(entry.fContent.data(), entry.fContent.size()));
+      }
+      return id;
+   }
+
+   /// The digested dictionaries are thread-safe and can be used by several contexts at once
+   const ZSTD_CDict *GetCDict(unsigned int id, int level)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto itr = fDictionaries.find(id);
+      if (itr == fDictionaries.end())
+         return nullptr;
+      auto &cdict = itr->second.fCDicts[level];
+      if (!cdict)
+         cdict.reset(ZSTD_createCDict(itr->second.fContent.data(), itr->second.fContent.size(), level));
+      return cdict.get();
+   }
+
+   const ZSTD_DDict *GetDDict(unsigned int id)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto itr = fDictionaries.find(id);
+      return itr == fDictionaries.end() ? nullptr : itr->second.fDDict.get();
+   }
+};
+
+} // anonymous namespace
+
+unsigned int R__zstdAddDictionary(const char *dict, int dictsize)
+{
+    return RZstdDictionaries::Instance().Add(dict, dictsize);
+}
+
+int R__zstdTrainDictionary(char *dict, int capacity, const char *samples, const int *samplesizes, unsigned int nsamples)
+{
+    std::vector<size_t> sizes(samplesizes, samplesizes + nsamples);
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(capacity), samples, sizes.data(), nsamples);
+    if (ZDICT_isError(retval)) {
+        std::cerr << "Error in training the ZSTD dictionary. Type = " << ZDICT_getErrorName(retval) << std::endl;
+        return 0;
+    }
+    return static_cast<int>(retval);
+}
+
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, 0);
+}
+
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned int dictID)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
     Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    const ZSTD_CDict *cdict = dictID ? RZstdDictionaries::Instance().GetCDict(dictID, 2*cxlevel) : nullptr;
+    size_t retval;
+    if (cdict) {
+        // The dictionary ID is stored in the frame header, R__unzipZSTD uses it to find the dictionary
+        retval = ZSTD_compress_usingCDict(fCtx.get(),
+                                          &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                          src, static_cast<size_t>(*srcsize), cdict);
+    } else {
+        retval = ZSTD_compressCCtx(fCtx.get(),
+                                   &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                   src, static_cast<size_t>(*srcsize),
+                                   2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -77,9 +174,24 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    size_t retval;
+    unsigned int dictID = ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    if (dictID != 0) {
+        const ZSTD_DDict *ddict = RZstdDictionaries::Instance().GetDDict(dictID);
+        if (R__unlikely(!ddict)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the unknown dictionary " << dictID
+                      << "; the dictionaries are registered when reading the file's StreamerInfo record." << std::endl;
+            return;
+        }
+        retval = ZSTD_decompress_usingDDict(fCtx.get(),
+                                            (char *)tgt, static_cast<size_t>(*tgtsize),
+                                            (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                            ddict);
+    } else {
+        retval = ZSTD_decompressDCtx(fCtx.get(),
+                                     (char *)tgt, static_cast<size_t>(*tgtsize),
+                                     (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
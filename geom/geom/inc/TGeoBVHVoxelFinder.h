@@ -0,0 +1,53 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGeoBVHVoxelFinder
+#define ROOT_TGeoBVHVoxelFinder
+
+#include "TGeoVoxelFinder.h"
+
+class TGeoBVHVoxelFinder : public TGeoVoxelFinder
+{
+private:
+   Int_t             fNnodes;         // number of nodes of the hierarchy
+   Int_t             fNbounds;        // length of array of node bounds (6*fNnodes)
+   Int_t             fNlinks;         // length of array of node links (2*fNnodes)
+   Int_t             fNindices;       // length of array of daughter indices
+   Double_t         *fBounds;         //[fNbounds] xmin, ymin, zmin, xmax, ymax, zmax of each node
+   Int_t            *fLinks;          //[fNlinks] children of inner nodes, -(first+1) and count for leaves
+   Int_t            *fIndices;        //[fNindices] daughter indices, grouped by leaf
+
+   TGeoBVHVoxelFinder(const TGeoBVHVoxelFinder&) = delete;
+   TGeoBVHVoxelFinder& operator=(const TGeoBVHVoxelFinder&) = delete;
+
+   Int_t               BuildNode(Int_t first, Int_t count, const Double_t *centers);
+   void                BuildHierarchy();
+   Double_t            DistToDaughterBox(Int_t id, const Double_t *point, const Double_t *invdir) const;
+
+public:
+   TGeoBVHVoxelFinder();
+   TGeoBVHVoxelFinder(TGeoVolume *vol);
+   virtual ~TGeoBVHVoxelFinder();
+
+   virtual Double_t    Efficiency();
+   virtual void        FindOverlaps(Int_t inode) const;
+   virtual Int_t      *GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td);
+   virtual Int_t      *GetNextCandidates(const Double_t *point, Int_t &ncheck, TGeoStateInfo &td);
+   virtual Int_t      *GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td);
+   virtual Int_t      *GetSafetyCandidates(const Double_t *point, Double_t safmax, Int_t &ncheck, TGeoStateInfo &td);
+   Int_t               GetNnodes() const {return fNnodes;}
+   virtual void        Print(Option_t *option="") const;
+   virtual void        SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td);
+   virtual void        Voxelize(Option_t *option="");
+
+   ClassDef(TGeoBVHVoxelFinder, 1)             // bounding volume hierarchy finder class
+};
+
+#endif
@@ -56,6 +56,7 @@ protected:
    static Int_t          fgMaxLevel;        //! Maximum level in geometry
    static Int_t          fgMaxDaughters;    //! Maximum number of daughters
    static Int_t          fgMaxXtruVert;     //! Maximum number of Xtru vertices
+   static Int_t          fgBVHThreshold;    //! Minimum number of daughters of volumes using a TGeoBVHVoxelFinder
    static UInt_t         fgExportPrecision; //! Precision to be used in ASCII exports
    static EDefaultUnits  fgDefaultUnits;    //! Default units in GDML if not explicit in some tags
 
@@ -121,6 +122,7 @@ private :
    typedef std::map<std::string, Double_t>                   ConstPropMap_t;
 
    NavigatorsMap_t       fNavigators;       //! Map between thread id's and navigator arrays
+   Long64_t              fNavigatorsKey;    //! Key of the navigator arrays cached by the threads
    static ThreadsMap_t  *fgThreadId;        //! Thread id's map
    static Int_t          fgNumThreads;      //! Number of registered threads
    static Bool_t         fgLockNavigators;   //! Lock existing navigators
@@ -176,6 +178,7 @@ public:
    Int_t                  AddTrack(TVirtualGeoTrack *track);
    Int_t                  AddVolume(TGeoVolume *volume);
    TGeoNavigator         *AddNavigator();
+   TGeoNavigator         *GetOrAddNavigator();
    Bool_t                 AddProperty(const char *property, Double_t value);
    Double_t               GetProperty(const char *name, Bool_t *error = nullptr) const;
    Double_t               GetProperty(size_t i, TString &name, Bool_t *error = nullptr) const;
@@ -455,6 +458,8 @@ public:
    static Int_t           GetMaxDaughters();
    static Int_t           GetMaxLevels();
    static Int_t           GetMaxXtruVert();
+   static Int_t           GetBVHThreshold();
+   static void            SetBVHThreshold(Int_t ndaughters);
    Int_t                  GetMaxThreads() const {return fMaxThreads-1;}
    void                   SetMaxThreads(Int_t nthreads);
    Int_t                  GetRTmode() const {return fRaytraceMode;}
@@ -109,6 +109,11 @@ public :
    TGeoNode              *FindNextBoundaryAndStep(Double_t stepmax=TGeoShape::Big(), Bool_t compsafe=kFALSE);
    TGeoNode              *FindNode(Bool_t safe_start=kTRUE);
    TGeoNode              *FindNode(Double_t x, Double_t y, Double_t z);
+   void                   FindDaughter_v(const TGeoVolume *vol, const Double_t *points, Int_t npoints,
+                                         Int_t *idaughter) const;
+   void                   FindNextBoundary_v(const TGeoVolume *vol, const Double_t *points, const Double_t *dirs,
+                                             Int_t npoints, const Double_t *stepmax, Double_t *snext,
+                                             Int_t *idaughter) const;
    Double_t              *FindNormal(Bool_t forward=kTRUE);
    Double_t              *FindNormalFast();
    TGeoNode              *InitTrack(const Double_t *point, const Double_t *dir);
@@ -0,0 +1,498 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TGeoBVHVoxelFinder
+\ingroup Geometry_classes
+
+Finder class organizing the bounding boxes of the daughters of a volume
+in a bounding volume hierarchy (BVH), instead of the slices of TGeoVoxelFinder.
+
+The hierarchy is a binary tree of axis-aligned boxes: each inner node is
+split along the longest axis of the centers of its daughters, at their median,
+and the leaves hold a few daughters. The candidates containing a point, crossed
+by a ray or closer than a given safety are found by descending the tree, with a
+cost growing with the logarithm of the number of daughters, and the memory used
+grows linearly with it. This pays off for volumes with many daughters spread in
+the three dimensions, e.g. the cells of a calorimeter, for which the candidate
+lists of the slices become long and their bit masks large.
+
+The candidates crossed by a ray are returned one by one by GetNextVoxel(),
+ordered by the distance at which the ray enters their bounding box, and the
+search stops as soon as this distance exceeds the current step: in most cases
+only the daughters close to the next boundary are checked.
+
+Volumes use this finder when they have at least TGeoManager::GetBVHThreshold()
+daughters, see TGeoManager::SetBVHThreshold().
+*/
+
+#include "TGeoBVHVoxelFinder.h"
+
+#include "TGeoBBox.h"
+#include "TGeoManager.h"
+#include "TGeoNode.h"
+#include "TGeoStateInfo.h"
+#include "TGeoVolume.h"
+#include "TMath.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+ClassImp(TGeoBVHVoxelFinder);
+
+namespace {
+
+const Int_t kMaxLeafSize = 4;  // maximum number of daughters in a leaf
+const Int_t kMaxDepth = 64;    // the median split keeps the depth close to log2(nd/kMaxLeafSize)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray at which it enters the box [lo, hi], 0 if the point
+/// is inside, TGeoShape::Big() if the ray misses the box.
+
+inline Double_t DistToBox(const Double_t *lo, const Double_t *hi, const Double_t *point, const Double_t *invdir)
+{
+   Double_t tmin = 0.;
+   Double_t tmax = TGeoShape::Big();
+   for (Int_t i=0; i<3; i++) {
+      if (invdir[i] == TGeoShape::Big()) {
+         if (point[i] < lo[i] || point[i] > hi[i]) return TGeoShape::Big();
+         continue;
+      }
+      Double_t t1 = (lo[i] - point[i]) * invdir[i];
+      Double_t t2 = (hi[i] - point[i]) * invdir[i];
+      if (t1 > t2) std::swap(t1, t2);
+      if (t1 > tmin) tmin = t1;
+      if (t2 < tmax) tmax = t2;
+      if (tmin > tmax) return TGeoShape::Big();
+   }
+   return tmin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from point to the box [lo, hi], 0 if the point is inside.
+
+inline Double_t Dist2ToBox(const Double_t *lo, const Double_t *hi, const Double_t *point)
+{
+   Double_t d2 = 0.;
+   for (Int_t i=0; i<3; i++) {
+      Double_t d = 0.;
+      if (point[i] < lo[i]) d = lo[i] - point[i];
+      else if (point[i] > hi[i]) d = point[i] - hi[i];
+      d2 += d*d;
+   }
+   return d2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Inverse of the direction cosines, TGeoShape::Big() for null components.
+
+inline void InvertDirection(const Double_t *dir, Double_t *invdir)
+{
+   for (Int_t i=0; i<3; i++) invdir[i] = (dir[i] == 0.) ? TGeoShape::Big() : 1./dir[i];
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Default constructor
+
+TGeoBVHVoxelFinder::TGeoBVHVoxelFinder()
+{
+   fNnodes   = 0;
+   fNbounds  = 0;
+   fNlinks   = 0;
+   fNindices = 0;
+   fBounds   = 0;
+   fLinks    = 0;
+   fIndices  = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor for the daughters of volume vol
+
+TGeoBVHVoxelFinder::TGeoBVHVoxelFinder(TGeoVolume *vol) : TGeoVoxelFinder(vol)
+{
+   fNnodes   = 0;
+   fNbounds  = 0;
+   fNlinks   = 0;
+   fNindices = 0;
+   fBounds   = 0;
+   fLinks    = 0;
+   fIndices  = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TGeoBVHVoxelFinder::~TGeoBVHVoxelFinder()
+{
+   delete [] fBounds;
+   delete [] fLinks;
+   delete [] fIndices;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the node holding the daughters fIndices[first, first+count) and
+/// its children, return the index of the node.
+
+Int_t TGeoBVHVoxelFinder::BuildNode(Int_t first, Int_t count, const Double_t *centers)
+{
+   const Int_t inode = fNnodes++;
+   Double_t *lo = &fBounds[6*inode];
+   Double_t *hi = lo + 3;
+   Double_t clo[3], chi[3];
+   for (Int_t i=0; i<3; i++) {
+      lo[i] = clo[i] = TGeoShape::Big();
+      hi[i] = chi[i] = -TGeoShape::Big();
+   }
+   for (Int_t k=first; k<first+count; k++) {
+      const Int_t id = fIndices[k];
+      for (Int_t i=0; i<3; i++) {
+         lo[i] = std::min(lo[i], fBoxes[6*id+3+i] - fBoxes[6*id+i]);
+         hi[i] = std::max(hi[i], fBoxes[6*id+3+i] + fBoxes[6*id+i]);
+         clo[i] = std::min(clo[i], centers[3*id+i]);
+         chi[i] = std::max(chi[i], centers[3*id+i]);
+      }
+   }
+   if (count <= kMaxLeafSize) {
+      fLinks[2*inode]   = -(first+1);
+      fLinks[2*inode+1] = count;
+      return inode;
+   }
+   // split at the median of the centers along their largest extent
+   Int_t axis = 0;
+   for (Int_t i=1; i<3; i++) {
+      if (chi[i]-clo[i] > chi[axis]-clo[axis]) axis = i;
+   }
+   const Int_t half = count/2;
+   std::nth_element(fIndices+first, fIndices+first+half, fIndices+first+count,
+                    [centers, axis](Int_t a, Int_t b) { return centers[3*a+axis] < centers[3*b+axis]; });
+   const Int_t left = BuildNode(first, half, centers);
+   const Int_t right = BuildNode(first+half, count-half, centers);
+   fLinks[2*inode]   = left;
+   fLinks[2*inode+1] = right;
+   return inode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the hierarchy from the bounding boxes of the daughters.
+
+void TGeoBVHVoxelFinder::BuildHierarchy()
+{
+   delete [] fBounds;
+   delete [] fLinks;
+   delete [] fIndices;
+   fBounds = 0;
+   fLinks = 0;
+   fIndices = 0;
+   fNnodes = fNbounds = fNlinks = fNindices = 0;
+   const Int_t nd = fVolume->GetNdaughters();
+   if (!nd || !fBoxes) return;
+   // a binary tree with leaves of at least one daughter has less than 2*nd nodes
+   const Int_t maxnodes = 2*nd;
+   fNindices = nd;
+   fIndices = new Int_t[nd];
+   std::iota(fIndices, fIndices+nd, 0);
+   Double_t *bounds = new Double_t[6*maxnodes];
+   Int_t *links = new Int_t[2*maxnodes];
+   fBounds = bounds;
+   fLinks = links;
+   std::vector<Double_t> centers(3*nd);
+   for (Int_t id=0; id<nd; id++) {
+      for (Int_t i=0; i<3; i++) centers[3*id+i] = fBoxes[6*id+3+i];
+   }
+   BuildNode(0, nd, centers.data());
+   // shrink the arrays to the actual number of nodes
+   fNbounds = 6*fNnodes;
+   fNlinks = 2*fNnodes;
+   fBounds = new Double_t[fNbounds];
+   fLinks = new Int_t[fNlinks];
+   memcpy(fBounds, bounds, fNbounds*sizeof(Double_t));
+   memcpy(fLinks, links, fNlinks*sizeof(Int_t));
+   delete [] bounds;
+   delete [] links;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray at which it enters the bounding box of daughter id.
+
+Double_t TGeoBVHVoxelFinder::DistToDaughterBox(Int_t id, const Double_t *point, const Double_t *invdir) const
+{
+   const Double_t tol = TGeoShape::Tolerance();
+   Double_t lo[3], hi[3];
+   for (Int_t i=0; i<3; i++) {
+      lo[i] = fBoxes[6*id+3+i] - fBoxes[6*id+i] - tol;
+      hi[i] = fBoxes[6*id+3+i] + fBoxes[6*id+i] + tol;
+   }
+   return DistToBox(lo, hi, point, invdir);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the bounding boxes of the daughters and build the hierarchy.
+
+void TGeoBVHVoxelFinder::Voxelize(Option_t * /*option*/)
+{
+   if (fVolume->IsAssembly()) fVolume->GetShape()->ComputeBBox();
+   Int_t nd = fVolume->GetNdaughters();
+   TGeoVolume *vd;
+   for (Int_t i=0; i<nd; i++) {
+      vd = fVolume->GetNode(i)->GetVolume();
+      if (vd->IsAssembly()) vd->GetShape()->ComputeBBox();
+   }
+   BuildVoxelLimits();
+   BuildHierarchy();
+   SetNeedRebuild(kFALSE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the average fraction of daughters which are not in the leaf of a
+/// random daughter, i.e. the fraction of daughters a point query does not check.
+
+Double_t TGeoBVHVoxelFinder::Efficiency()
+{
+   printf("Voxelization efficiency for %s\n", fVolume->GetName());
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   Int_t nd = fVolume->GetNdaughters();
+   if (!nd || !fNnodes) return 0.;
+   Double_t sum = 0.;
+   for (Int_t inode=0; inode<fNnodes; inode++) {
+      if (fLinks[2*inode] >= 0) continue;
+      Double_t count = fLinks[2*inode+1];
+      sum += count*count;
+   }
+   Double_t eff = 1. - sum/(Double_t(nd)*nd);
+   printf("  %d daughters in a hierarchy of %d nodes, efficiency=%g\n", nd, fNnodes, eff);
+   return eff;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the list of nodes for which the bboxes overlap with inode's bbox,
+/// searching the hierarchy instead of looping over all daughters.
+
+void TGeoBVHVoxelFinder::FindOverlaps(Int_t inode) const
+{
+   if (!fBoxes || !fNnodes) return;
+   Double_t lo[3], hi[3];
+   for (Int_t i=0; i<3; i++) {
+      lo[i] = fBoxes[6*inode+3+i] - fBoxes[6*inode+i];
+      hi[i] = fBoxes[6*inode+3+i] + fBoxes[6*inode+i];
+   }
+   std::vector<Int_t> ovlps;
+   Int_t stack[kMaxDepth];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const Int_t n = stack[--nstack];
+      const Double_t *blo = &fBounds[6*n];
+      const Double_t *bhi = blo + 3;
+      if (blo[0] >= hi[0] || bhi[0] <= lo[0] || blo[1] >= hi[1] || bhi[1] <= lo[1] ||
+          blo[2] >= hi[2] || bhi[2] <= lo[2]) continue;
+      if (fLinks[2*n] >= 0) {
+         stack[nstack++] = fLinks[2*n];
+         stack[nstack++] = fLinks[2*n+1];
+         continue;
+      }
+      const Int_t first = -fLinks[2*n]-1;
+      for (Int_t k=first; k<first+fLinks[2*n+1]; k++) {
+         const Int_t ib = fIndices[k];
+         if (ib == inode) continue; // everyone overlaps with itself
+         Bool_t overlap = kTRUE;
+         for (Int_t i=0; i<3 && overlap; i++) {
+            const Double_t lo1 = fBoxes[6*ib+3+i] - fBoxes[6*ib+i];
+            const Double_t hi1 = fBoxes[6*ib+3+i] + fBoxes[6*ib+i];
+            if ((hi[i]-lo1)*(hi1-lo[i]) <= 0.) overlap = kFALSE;
+         }
+         if (overlap) ovlps.push_back(ib);
+      }
+   }
+   TGeoNode *node = fVolume->GetNode(inode);
+   if (ovlps.empty()) {
+      node->SetOverlaps(0, 0);
+      return;
+   }
+   std::sort(ovlps.begin(), ovlps.end());
+   Int_t *list = new Int_t[ovlps.size()];
+   std::copy(ovlps.begin(), ovlps.end(), list);
+   node->SetOverlaps(list, ovlps.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughters whose bounding box contains point, ordered by
+/// daughter index. Returns 0 if there is none.
+
+Int_t *TGeoBVHVoxelFinder::GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td)
+{
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   nelem = 0;
+   td.fVoxNcandidates = 0;
+   if (!fNnodes) return 0;
+   Int_t stack[kMaxDepth];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const Int_t n = stack[--nstack];
+      if (Dist2ToBox(&fBounds[6*n], &fBounds[6*n+3], point) > 0.) continue;
+      if (fLinks[2*n] >= 0) {
+         stack[nstack++] = fLinks[2*n];
+         stack[nstack++] = fLinks[2*n+1];
+         continue;
+      }
+      const Int_t first = -fLinks[2*n]-1;
+      for (Int_t k=first; k<first+fLinks[2*n+1]; k++) {
+         const Int_t id = fIndices[k];
+         if (TMath::Abs(point[0]-fBoxes[6*id+3]) <= fBoxes[6*id] &&
+             TMath::Abs(point[1]-fBoxes[6*id+4]) <= fBoxes[6*id+1] &&
+             TMath::Abs(point[2]-fBoxes[6*id+5]) <= fBoxes[6*id+2])
+            td.fVoxCheckList[nelem++] = id;
+      }
+   }
+   if (!nelem) return 0;
+   std::sort(td.fVoxCheckList, td.fVoxCheckList+nelem);
+   td.fVoxNcandidates = nelem;
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Not used by this finder: the crossed candidates are all found by
+/// SortCrossedVoxels() and returned one by one by GetNextVoxel().
+
+Int_t *TGeoBVHVoxelFinder::GetNextCandidates(const Double_t * /*point*/, Int_t &ncheck, TGeoStateInfo & /*td*/)
+{
+   ncheck = 0;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find all the daughters whose bounding box is crossed by the ray within the
+/// current step, and store them in td ordered by the distance at which the ray
+/// enters their bounding box.
+
+void TGeoBVHVoxelFinder::SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td)
+{
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   td.fVoxCurrent = 0;
+   td.fVoxNcandidates = 0;
+   if (!fNnodes) return;
+   // scratch storage, never used by two sorts at the same time in a thread
+   static thread_local std::vector<std::pair<Double_t, Int_t>> crossed;
+   crossed.clear();
+   const Double_t step = gGeoManager->GetStep();
+   Double_t invdir[3];
+   InvertDirection(dir, invdir);
+   Int_t stack[kMaxDepth];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const Int_t n = stack[--nstack];
+      if (DistToBox(&fBounds[6*n], &fBounds[6*n+3], point, invdir) > step) continue;
+      if (fLinks[2*n] >= 0) {
+         stack[nstack++] = fLinks[2*n];
+         stack[nstack++] = fLinks[2*n+1];
+         continue;
+      }
+      const Int_t first = -fLinks[2*n]-1;
+      for (Int_t k=first; k<first+fLinks[2*n+1]; k++) {
+         const Int_t id = fIndices[k];
+         const Double_t dist = DistToDaughterBox(id, point, invdir);
+         if (dist <= step) crossed.emplace_back(dist, id);
+      }
+   }
+   std::sort(crossed.begin(), crossed.end());
+   for (auto &c : crossed) td.fVoxCheckList[td.fVoxNcandidates++] = c.second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the next candidate crossed by the ray, found by SortCrossedVoxels(),
+/// or 0 when there is none left or the ray enters its bounding box beyond the
+/// current step, i.e. no remaining candidate can be hit before.
+
+Int_t *TGeoBVHVoxelFinder::GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td)
+{
+   ncheck = 0;
+   if (td.fVoxCurrent >= td.fVoxNcandidates) return 0;
+   Int_t *next = &td.fVoxCheckList[td.fVoxCurrent];
+   if (td.fVoxCurrent) {
+      Double_t invdir[3];
+      InvertDirection(dir, invdir);
+      if (DistToDaughterBox(*next, point, invdir) > gGeoManager->GetStep()) {
+         td.fVoxCurrent = td.fVoxNcandidates;
+         return 0;
+      }
+   }
+   td.fVoxCurrent++;
+   ncheck = 1;
+   return next;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughters whose bounding box is closer than safmax to point.
+
+Int_t *TGeoBVHVoxelFinder::GetSafetyCandidates(const Double_t *point, Double_t safmax, Int_t &ncheck,
+                                               TGeoStateInfo &td)
+{
+   ncheck = 0;
+   if (!fNnodes) return td.fVoxCheckList;
+   const Double_t safmax2 = safmax*safmax;
+   Int_t stack[kMaxDepth];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const Int_t n = stack[--nstack];
+      if (Dist2ToBox(&fBounds[6*n], &fBounds[6*n+3], point) >= safmax2) continue;
+      if (fLinks[2*n] >= 0) {
+         stack[nstack++] = fLinks[2*n];
+         stack[nstack++] = fLinks[2*n+1];
+         continue;
+      }
+      const Int_t first = -fLinks[2*n]-1;
+      for (Int_t k=first; k<first+fLinks[2*n+1]; k++) {
+         const Int_t id = fIndices[k];
+         Double_t lo[3], hi[3];
+         for (Int_t i=0; i<3; i++) {
+            lo[i] = fBoxes[6*id+3+i] - fBoxes[6*id+i];
+            hi[i] = fBoxes[6*id+3+i] + fBoxes[6*id+i];
+         }
+         if (Dist2ToBox(lo, hi, point) < safmax2) td.fVoxCheckList[ncheck++] = id;
+      }
+   }
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the hierarchy: number of nodes and daughters of each leaf.
+
+void TGeoBVHVoxelFinder::Print(Option_t *) const
+{
+   printf("Bounding volume hierarchy of %s: %d daughters, %d nodes\n", fVolume->GetName(),
+          fVolume->GetNdaughters(), fNnodes);
+   for (Int_t inode=0; inode<fNnodes; inode++) {
+      const Double_t *b = &fBounds[6*inode];
+      if (fLinks[2*inode] >= 0) {
+         printf("  node %d: [%g,%g] x [%g,%g] x [%g,%g], children %d %d\n", inode, b[0], b[3], b[1], b[4],
+                b[2], b[5], fLinks[2*inode], fLinks[2*inode+1]);
+         continue;
+      }
+      const Int_t first = -fLinks[2*inode]-1;
+      printf("  leaf %d: [%g,%g] x [%g,%g] x [%g,%g], daughters", inode, b[0], b[3], b[1], b[4], b[2], b[5]);
+      for (Int_t k=first; k<first+fLinks[2*inode+1]; k++) printf(" %d", fIndices[k]);
+      printf("\n");
+   }
+}
@@ -383,11 +383,16 @@ void TGeoBranchArray::Sort(Int_t n, TGeoBranchArray **array, Int_t *index, Bool_
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the navigator to reflect the branch.
-///   nav->CdTop();
+/// Only the levels below the deepest node shared by the current branch of the
+/// navigator and this branch are changed, so that handing a track over to
+/// another navigator costs at most one step per level. Together with
+/// InitFromNavigator() this saves and restores the navigation state of a track
+/// moved between threads; the point and direction have to be set separately.
 
 void TGeoBranchArray::UpdateNavigator(TGeoNavigator *nav) const
 {
    if (fLevel<0) {nav->SetOutside(kTRUE); return;}
+   nav->SetOutside(kFALSE);
    Int_t matchlev = 0;
    Int_t navlev = nav->GetLevel();
    Int_t i;
@@ -237,6 +237,7 @@ in order to enhance rays.
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <atomic>
 
 #include "TROOT.h"
 #include "TGeoManager.h"
@@ -283,6 +284,9 @@ in order to enhance rays.
 #include "TGeoRegion.h"
 #include "TGDMLMatrix.h"
 #include "TGeoOpticalSurface.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 // statics and globals
 
@@ -297,18 +301,40 @@ Int_t  TGeoManager::fgVerboseLevel    = 1;
 Int_t  TGeoManager::fgMaxLevel        = 1;
 Int_t  TGeoManager::fgMaxDaughters    = 1;
 Int_t  TGeoManager::fgMaxXtruVert     = 1;
+Int_t  TGeoManager::fgBVHThreshold    = 0;
 Int_t  TGeoManager::fgNumThreads      = 0;
 UInt_t TGeoManager::fgExportPrecision = 17;
 TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits;
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = 0;
 static Bool_t gGeometryLocked = kTRUE;
 
+namespace {
+
+// Source of the keys of the navigator arrays, unique among all managers
+std::atomic<Long64_t> gNavigatorsKeys{0};
+
+// Navigator array of the calling thread found by the last lookup in the map of a manager
+struct TGeoThreadNavigators {
+   const TGeoManager  *fManager = nullptr;
+   Long64_t            fKey = -1;
+   TGeoNavigatorArray *fArray = nullptr;
+};
+
+TGeoThreadNavigators &GetThreadNavigators()
+{
+   thread_local TGeoThreadNavigators navigators;
+   return navigators;
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
 TGeoManager::TGeoManager()
 {
    if (!fgThreadId) fgThreadId = new TGeoManager::ThreadsMap_t;
+   fNavigatorsKey = ++gNavigatorsKeys;
    if (TClass::IsCallingNew() == TClass::kDummyNew) {
       fTimeCut = kFALSE;
       fTmin = 0.;
@@ -417,6 +443,7 @@ void TGeoManager::Init()
 
    gGeoManager = this;
    if (!fgThreadId) fgThreadId = new TGeoManager::ThreadsMap_t;
+   fNavigatorsKey = ++gNavigatorsKeys;
    fTimeCut = kFALSE;
    fTmin = 0.;
    fTmax = 999.;
@@ -728,37 +755,59 @@ TGeoNavigator *TGeoManager::AddNavigator()
    }
    TGeoNavigator *nav = array->AddNavigator();
    if (fClosed) nav->GetCache()->BuildInfoBranch();
+   TGeoThreadNavigators &cached = GetThreadNavigators();
+   cached.fManager = this;
+   cached.fKey = fNavigatorsKey;
+   cached.fArray = array;
    if (fMultiThread) fgMutex.unlock();
    return nav;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the current navigator for the calling thread, adding one if the
+/// thread has none yet. This is the way for the threads of a pool, e.g. the
+/// TBB workers of the implicit multi-threading, to get their navigator
+/// without knowing when they are started: only the first call of each thread
+/// takes the lock.
+
+TGeoNavigator *TGeoManager::GetOrAddNavigator()
+{
+   TGeoNavigator *nav = GetCurrentNavigator();
+   if (nav) return nav;
+   return AddNavigator();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns current navigator for the calling thread.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator*) tnav = 0;
    if (!fMultiThread) return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav) return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
-   return nav;
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   return array ? array->GetCurrentNavigator() : nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Get list of navigators for the calling thread.
+///
+/// The list found last by the thread is cached in thread local storage, so
+/// that the map of threads, which is filled by AddNavigator() under a lock,
+/// is only looked up once per thread and manager.
 
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
+   TGeoThreadNavigators &cached = GetThreadNavigators();
+   if (cached.fManager == this && cached.fKey == fNavigatorsKey) return cached.fArray;
+   if (fMultiThread) fgMutex.lock();
    std::thread::id threadId = std::this_thread::get_id();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
+   TGeoNavigatorArray *array = (it == fNavigators.end()) ? nullptr : it->second;
+   if (array) {
+      cached.fManager = this;
+      cached.fKey = fNavigatorsKey;
+      cached.fArray = array;
+   }
+   if (fMultiThread) fgMutex.unlock();
    return array;
 }
 
@@ -768,13 +817,12 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
    std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) {
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   if (!array) {
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
       std::cout << "  thread id: " << threadId << std::endl;
       return kFALSE;
    }
-   TGeoNavigatorArray *array = it->second;
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
@@ -806,6 +854,7 @@ void TGeoManager::ClearNavigators()
       if (arr) delete arr;
    }
    fNavigators.clear();
+   fNavigatorsKey = ++gNavigatorsKeys;
    if (fMultiThread) fgMutex.unlock();
 }
 
@@ -820,7 +869,11 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
       if (arr) {
          if ((TGeoNavigator*)arr->Remove((TObject*)nav)) {
             delete nav;
-            if (!arr->GetEntries()) fNavigators.erase(it);
+            if (!arr->GetEntries()) {
+               fNavigators.erase(it);
+               delete arr;
+               fNavigatorsKey = ++gNavigatorsKeys;
+            }
             if (fMultiThread) fgMutex.unlock();
             return;
          }
@@ -1961,6 +2014,27 @@ Int_t TGeoManager::GetMaxXtruVert()
    return fgMaxXtruVert;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the minimum number of daughters of the volumes voxelized with a
+/// bounding volume hierarchy (TGeoBVHVoxelFinder). 0 if disabled.
+
+Int_t TGeoManager::GetBVHThreshold()
+{
+   return fgBVHThreshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Voxelize the volumes with at least ndaughters daughters with a bounding
+/// volume hierarchy (TGeoBVHVoxelFinder) instead of the slices of
+/// TGeoVoxelFinder. This is faster for volumes with thousands of daughters,
+/// e.g. calorimeter cells. 0 (default) disables it. Has to be called before
+/// CloseGeometry().
+
+void TGeoManager::SetBVHThreshold(Int_t ndaughters)
+{
+   fgBVHThreshold = (ndaughters > 0) ? ndaughters : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns number of threads that were set to use geometry.
 
@@ -2889,6 +2963,11 @@ void TGeoManager::RestoreMasterVolume()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Voxelize all non-divided volumes.
+///
+/// If the implicit multi-threading is enabled, the volumes are voxelized in
+/// parallel: each volume only modifies its own voxel finder and the overlap
+/// lists of its own nodes. The nodes are sorted and the bounding boxes of the
+/// assemblies, shared by all their mothers, are computed beforehand.
 
 void TGeoManager::Voxelize(Option_t *option)
 {
@@ -2896,6 +2975,27 @@ void TGeoManager::Voxelize(Option_t *option)
 //   TGeoVoxelFinder *vox = 0;
    if (!fStreamVoxels && fgVerboseLevel>0) Info("Voxelize","Voxelizing...");
 //   Int_t nentries = fVolumes->GetSize();
+#ifdef R__USE_IMT
+   const Int_t nvol = fVolumes->GetEntriesFast();
+   if (ROOT::IsImplicitMTEnabled() && !fStreamVoxels && nvol > 1) {
+      for (Int_t i=0; i<nvol; i++) {
+         vol = (TGeoVolume*)fVolumes->UncheckedAt(i);
+         if (!vol) continue;
+         if (!fIsGeomReading) vol->SortNodes();
+         if (vol->IsAssembly()) vol->GetShape()->ComputeBBox();
+      }
+      const Bool_t findOverlaps = !fIsGeomReading;
+      auto voxelize = [this, option, findOverlaps](UInt_t i) {
+         TGeoVolume *v = (TGeoVolume*)fVolumes->UncheckedAt(i);
+         if (!v) return;
+         v->Voxelize(option);
+         if (findOverlaps) v->FindOverlaps();
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(voxelize, ROOT::TSeqU(nvol));
+      return;
+   }
+#endif
    TIter next(fVolumes);
    while ((vol = (TGeoVolume*)next())) {
       if (!fIsGeomReading) vol->SortNodes();
@@ -3698,7 +3798,10 @@ void TGeoManager::ExecuteEvent(Int_t event, Int_t px, Int_t py)
 ///  - Case 1: root file or root/xml file
 ///    if filename end with ".root". The key will be named name
 ///    By default the geometry is saved without the voxelisation info.
-///    Use option 'v" to save the voxelisation info.
+///    Use option 'v" to save the voxelisation info, including the bounding
+///    volume hierarchies (see SetBVHThreshold()): reading the geometry back
+///    then skips the voxelization, which dominates the loading time of large
+///    geometries.
 ///    if filename end with ".xml" a root/xml file is produced.
 ///
 ///  - Case 2: C++ script
@@ -42,6 +42,10 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TMath.h"
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
+#include "TGeoBBox.h"
+
+#include <memory>
+#include <vector>
 
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
@@ -1519,6 +1523,105 @@ TGeoNode *TGeoNavigator::FindNode(Double_t x, Double_t y, Double_t z)
    return found;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Locate a basket of npoints points given in the local frame of volume vol: idaughter[i]
+/// is the index of the daughter node of vol containing point i, or -1 if the point is
+/// not inside any daughter. The points are stored as x,y,z triplets, as for the
+/// vectorized TGeoShape methods. The daughters are tested one after the other for all
+/// the points not located yet, with a single call to their shape's Contains_v(), so
+/// that the number of virtual calls does not grow with the number of points. Only the
+/// first level is searched and the state of the navigator is not changed.
+
+void TGeoNavigator::FindDaughter_v(const TGeoVolume *vol, const Double_t *points, Int_t npoints,
+                                   Int_t *idaughter) const
+{
+   for (Int_t i=0; i<npoints; i++) idaughter[i] = -1;
+   const Int_t nd = vol->GetNdaughters();
+   if (npoints <= 0 || nd == 0) return;
+   std::vector<Double_t> lpoints(3*npoints);
+   std::vector<Int_t> index(npoints);
+   std::unique_ptr<Bool_t[]> inside(new Bool_t[npoints]);
+   Int_t nleft = npoints;
+   for (Int_t id=0; id<nd && nleft>0; id++) {
+      const TGeoNode *node = vol->GetNode(id);
+      const TGeoBBox *box = (const TGeoBBox*)node->GetVolume()->GetShape();
+      Int_t nsel = 0;
+      for (Int_t i=0; i<npoints; i++) {
+         if (idaughter[i] >= 0) continue;
+         Double_t *local = &lpoints[3*nsel];
+         node->MasterToLocal(&points[3*i], local);
+         // cheap rejection with the bounding box of the daughter
+         if (!TGeoBBox::Contains(local, box->GetDX(), box->GetDY(), box->GetDZ(), box->GetOrigin())) continue;
+         index[nsel++] = i;
+      }
+      if (!nsel) continue;
+      box->Contains_v(lpoints.data(), inside.get(), nsel);
+      for (Int_t k=0; k<nsel; k++) {
+         if (!inside[k]) continue;
+         idaughter[index[k]] = id;
+         nleft--;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distance to the next boundary for a basket of npoints tracks located
+/// inside volume vol but outside its daughters, with positions and directions given as
+/// x,y,z triplets in the local frame of vol. On return snext[i] is the distance to the
+/// first boundary crossed by track i, limited to stepmax[i], and idaughter[i] is the
+/// index of the daughter node entered there, or -1 if the track exits vol or reaches
+/// stepmax[i] first.
+///
+/// The distances are computed with the vectorized shape methods DistFromInside_v() and
+/// DistFromOutside_v(): one call for the mother and one per daughter for all the tracks
+/// whose step can reach the daughter's bounding box, instead of one virtual call per
+/// track and candidate as in FindNextBoundary(). Overlapping (MANY) daughters are
+/// treated as the other daughters and the state of the navigator is not changed.
+
+void TGeoNavigator::FindNextBoundary_v(const TGeoVolume *vol, const Double_t *points, const Double_t *dirs,
+                                       Int_t npoints, const Double_t *stepmax, Double_t *snext,
+                                       Int_t *idaughter) const
+{
+   if (npoints <= 0) return;
+   std::vector<Double_t> steps(stepmax, stepmax + npoints);
+   vol->GetShape()->DistFromInside_v(points, dirs, snext, npoints, steps.data());
+   for (Int_t i=0; i<npoints; i++) {
+      if (snext[i] > stepmax[i]) snext[i] = stepmax[i];
+      idaughter[i] = -1;
+   }
+   const Int_t nd = vol->GetNdaughters();
+   if (nd == 0) return;
+   std::vector<Double_t> lpoints(3*npoints);
+   std::vector<Double_t> ldirs(3*npoints);
+   std::vector<Double_t> dists(npoints);
+   std::vector<Int_t> index(npoints);
+   for (Int_t id=0; id<nd; id++) {
+      const TGeoNode *node = vol->GetNode(id);
+      const TGeoBBox *box = (const TGeoBBox*)node->GetVolume()->GetShape();
+      Int_t nsel = 0;
+      for (Int_t i=0; i<npoints; i++) {
+         Double_t *local = &lpoints[3*nsel];
+         Double_t *ldir = &ldirs[3*nsel];
+         node->MasterToLocal(&points[3*i], local);
+         node->MasterToLocalVect(&dirs[3*i], ldir);
+         // skip the tracks that cannot reach the bounding box of the daughter within their current step
+         if (TGeoBBox::DistFromOutside(local, ldir, box->GetDX(), box->GetDY(), box->GetDZ(), box->GetOrigin(),
+                                       snext[i]) >= snext[i]) continue;
+         steps[nsel] = snext[i];
+         index[nsel++] = i;
+      }
+      if (!nsel) continue;
+      box->DistFromOutside_v(lpoints.data(), ldirs.data(), dists.data(), nsel, steps.data());
+      for (Int_t k=0; k<nsel; k++) {
+         const Int_t i = index[k];
+         if (dists[k] < snext[i]) {
+            snext[i] = dists[k];
+            idaughter[i] = id;
+         }
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes fast normal to next crossed boundary, assuming that the current point
 /// is close enough to the boundary. Works only after calling FindNextBoundary.
@@ -1687,7 +1790,11 @@ Double_t TGeoNavigator::Safety(Bool_t inside)
 
    //---> check fast unsafe voxels
    Double_t *boxes = voxels->GetBoxes();
-   for (id=0; id<nd; id++) {
+   TGeoStateInfo &info = *fCache->GetInfo();
+   Int_t ncheck = 0;
+   Int_t *candidates = voxels->GetSafetyCandidates(point, fSafety, ncheck, info);
+   for (Int_t ic=0; ic<ncheck; ic++) {
+      id = candidates ? candidates[ic] : ic;
       Int_t ist = 6*id;
       Double_t dxyz = 0.;
       Double_t dxyz0 = TMath::Abs(point[0]-boxes[ist+3])-boxes[ist];
@@ -1703,12 +1810,14 @@ Double_t TGeoNavigator::Safety(Bool_t inside)
       node = (TGeoNode*)nodes->UncheckedAt(id);
       safe = node->Safety(point, kFALSE);
       if (safe<gTolerance) {
+         fCache->ReleaseInfo();
          fSafety=0;
          fIsOnBoundary = kTRUE;
          return fSafety;
       }
       if (safe<fSafety) fSafety = safe;
    }
+   fCache->ReleaseInfo();
    if (fNmany  && !inside) SafetyOverlaps();
    return fSafety;
 }
@@ -400,6 +400,7 @@ volumes (or volume assemblies) as content.
 #include "TGeoScaledShape.h"
 #include "TGeoCompositeShape.h"
 #include "TGeoVoxelFinder.h"
+#include "TGeoBVHVoxelFinder.h"
 #include "TGeoExtension.h"
 
 ClassImp(TGeoVolume);
@@ -2319,7 +2320,10 @@ void TGeoVolume::Voxelize(Option_t *option)
       fVoxels = 0;
    }
    // Create the voxels structure
-   fVoxels = new TGeoVoxelFinder(this);
+   if (TGeoManager::GetBVHThreshold() > 0 && nd >= TGeoManager::GetBVHThreshold())
+      fVoxels = new TGeoBVHVoxelFinder(this);
+   else
+      fVoxels = new TGeoVoxelFinder(this);
    fVoxels->Voxelize(option);
    if (fVoxels) {
       if (fVoxels->IsInvalid()) {
@@ -503,6 +503,18 @@ Int_t *TGeoVoxelFinder::GetValidExtra(Int_t /*n1*/, UChar_t *array1, Int_t /*n2*
    return td.fVoxCheckList;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the list of daughters whose bounding boxes may be closer than safmax
+/// to point, or NULL if all the ncheck daughters have to be checked. The slices
+/// do not provide such a list, so all the daughters are returned.
+
+Int_t *TGeoVoxelFinder::GetSafetyCandidates(const Double_t * /*point*/, Double_t /*safmax*/, Int_t &ncheck,
+                                            TGeoStateInfo & /*td*/)
+{
+   ncheck = fVolume->GetNdaughters();
+   return nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns list of new candidates in next voxel. If NULL, nowhere to
 /// go next.
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBVHVoxelFinder.h>
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMedium.h>
+#include <TGeoMatrix.h>
+#include <TGeoNavigator.h>
+#include <TGeoVolume.h>
+#include <TRandom3.h>
+#include <TROOT.h>
+
+#include <vector>
+
+struct NavResult {
+   std::vector<Int_t> fLevel;
+   std::vector<Double_t> fStep;
+   std::vector<Double_t> fSafety;
+};
+
+// Navigate random tracks in a world box filled with a grid of 10x10x10 cells, each one containing a tube, with the
+// cells voxelized by slices or, for a threshold larger than zero, by a bounding volume hierarchy
+NavResult Navigate(Int_t bvhThreshold)
+{
+   TGeoManager::SetBVHThreshold(bvhThreshold);
+   auto geom = new TGeoManager("bvh", "bounding volume hierarchy");
+   auto mat = new TGeoMaterial("Vacuum", 0, 0, 0);
+   auto med = new TGeoMedium("Vacuum", 1, mat);
+   auto world = geom->MakeBox("World", med, 120, 120, 120);
+   geom->SetTopVolume(world);
+   auto cell = geom->MakeBox("Cell", med, 4, 4, 4);
+   cell->AddNode(geom->MakeTube("Fiber", med, 0, 1, 4), 1);
+   Int_t copy = 0;
+   for (Int_t i = 0; i < 10; i++)
+      for (Int_t j = 0; j < 10; j++)
+         for (Int_t k = 0; k < 10; k++)
+            world->AddNode(cell, copy++, new TGeoTranslation(-90 + 20 * i, -90 + 20 * j, -90 + 20 * k));
+   geom->CloseGeometry();
+   EXPECT_EQ(world->GetVoxels()->InheritsFrom(TGeoBVHVoxelFinder::Class()), bvhThreshold > 0);
+   auto nav = geom->GetCurrentNavigator();
+
+   NavResult result;
+   TRandom3 rng(1);
+   for (Int_t itrack = 0; itrack < 200; itrack++) {
+      Double_t point[3], dir[3];
+      for (Int_t j = 0; j < 3; j++)
+         point[j] = rng.Uniform(-100, 100);
+      rng.Sphere(dir[0], dir[1], dir[2], 1.);
+      nav->InitTrack(point, dir);
+      for (Int_t istep = 0; istep < 20 && !nav->IsOutside(); istep++) {
+         result.fLevel.push_back(nav->GetLevel());
+         result.fSafety.push_back(nav->Safety());
+         nav->FindNextBoundaryAndStep();
+         result.fStep.push_back(nav->GetStep());
+      }
+   }
+   delete geom;
+   TGeoManager::SetBVHThreshold(0);
+   return result;
+}
+
+void CompareNavigation(const NavResult &a, const NavResult &b)
+{
+   ASSERT_EQ(a.fStep.size(), b.fStep.size());
+   for (std::size_t i = 0; i < a.fStep.size(); i++) {
+      EXPECT_EQ(a.fLevel[i], b.fLevel[i]) << "step " << i;
+      EXPECT_NEAR(a.fStep[i], b.fStep[i], 1e-8) << "step " << i;
+      EXPECT_NEAR(a.fSafety[i], b.fSafety[i], 1e-8) << "step " << i;
+   }
+}
+
+TEST(TGeoBVHVoxelFinder, SameNavigation)
+{
+   CompareNavigation(Navigate(0), Navigate(100));
+}
+
+#ifdef R__USE_IMT
+// The volumes are voxelized in parallel by CloseGeometry when the implicit multi-threading is enabled
+TEST(TGeoBVHVoxelFinder, ParallelVoxelization)
+{
+   auto slices = Navigate(0);
+   ROOT::EnableImplicitMT(4);
+   auto parallelSlices = Navigate(0);
+   auto parallelBvh = Navigate(100);
+   ROOT::DisableImplicitMT();
+   CompareNavigation(slices, parallelSlices);
+   CompareNavigation(slices, parallelBvh);
+}
+#endif
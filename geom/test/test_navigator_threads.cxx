@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBranchArray.h>
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMedium.h>
+#include <TGeoMatrix.h>
+#include <TGeoNavigator.h>
+#include <TGeoVolume.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+// Navigators of several threads, and navigation states handed over between threads, in a world containing rows of
+// boxes containing boxes
+TEST(TGeoNavigator, Threads)
+{
+   auto geom = new TGeoManager("mtnav", "navigators of threads");
+   auto mat = new TGeoMaterial("Vacuum", 0, 0, 0);
+   auto med = new TGeoMedium("Vacuum", 1, mat);
+   auto world = geom->MakeBox("World", med, 100, 100, 100);
+   geom->SetTopVolume(world);
+   auto row = geom->MakeBox("Row", med, 90, 10, 10);
+   auto cell = geom->MakeBox("Cell", med, 5, 5, 5);
+   for (Int_t i = 0; i < 9; i++)
+      row->AddNode(cell, i, new TGeoTranslation(-80 + 20 * i, 0, 0));
+   for (Int_t j = 0; j < 4; j++)
+      world->AddNode(row, j, new TGeoTranslation(0, -60 + 40 * j, 0));
+   geom->CloseGeometry();
+   geom->SetMaxThreads(4);
+   ASSERT_NE(geom->GetCurrentNavigator(), nullptr);
+
+   const Int_t nthreads = 4;
+   const Int_t maxlevel = geom->GetMaxLevel();
+   std::vector<TGeoBranchArray *> states(nthreads);
+   std::vector<std::string> paths(nthreads);
+   std::vector<std::thread> threads;
+   for (Int_t i = 0; i < nthreads; i++) {
+      threads.emplace_back([&, i] {
+         auto nav = geom->GetOrAddNavigator();
+         ASSERT_NE(nav, nullptr);
+         EXPECT_EQ(geom->GetOrAddNavigator(), nav);
+         // a second navigator of the thread becomes current until switching back
+         auto other = geom->AddNavigator();
+         EXPECT_EQ(geom->GetCurrentNavigator(), other);
+         EXPECT_TRUE(geom->SetCurrentNavigator(0));
+         EXPECT_EQ(geom->GetCurrentNavigator(), nav);
+         nav->FindNode(-80 + 20 * (2 * i), -60 + 40 * i, 1);
+         EXPECT_EQ(nav->GetLevel(), 2);
+         paths[i] = nav->GetPath();
+         states[i] = TGeoBranchArray::MakeInstance(maxlevel);
+         states[i]->InitFromNavigator(nav);
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   threads.clear();
+
+   // hand the state of each thread over to the navigator of another thread
+   for (Int_t i = 0; i < nthreads; i++) {
+      threads.emplace_back([&, i] {
+         auto nav = geom->GetOrAddNavigator();
+         ASSERT_NE(nav, nullptr);
+         nav->FindNode(150, 0, 0);
+         EXPECT_TRUE(nav->IsOutside());
+         const Int_t from = (i + 1) % nthreads;
+         states[from]->UpdateNavigator(nav);
+         EXPECT_FALSE(nav->IsOutside());
+         EXPECT_EQ(std::string(nav->GetPath()), paths[from]);
+         nav->FindNode(-80 + 20 * (2 * from), -60 + 40 * from, 1);
+         EXPECT_EQ(std::string(nav->GetPath()), paths[from]);
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   for (auto state : states)
+      TGeoBranchArray::ReleaseInstance(state);
+   delete geom;
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMedium.h>
+#include <TGeoMatrix.h>
+#include <TGeoNavigator.h>
+#include <TGeoVolume.h>
+#include <TRandom3.h>
+
+#include <algorithm>
+#include <vector>
+
+// Compare the basket methods of TGeoNavigator with the scalar navigation, for random tracks starting in a
+// world box containing a box, a tube and a sphere
+TEST(TGeoNavigator, Vectorized)
+{
+   auto geom = new TGeoManager("vecnav", "vectorized navigation");
+   auto mat = new TGeoMaterial("Vacuum", 0, 0, 0);
+   auto med = new TGeoMedium("Vacuum", 1, mat);
+   auto world = geom->MakeBox("World", med, 100, 100, 100);
+   geom->SetTopVolume(world);
+   world->AddNode(geom->MakeBox("Box", med, 10, 20, 30), 1, new TGeoTranslation(-50, 0, 0));
+   auto rot = new TGeoRotation("r", 0, 90, 0);
+   world->AddNode(geom->MakeTube("Tube", med, 5, 15, 40), 1, new TGeoCombiTrans(40, 20, 0, rot));
+   world->AddNode(geom->MakeSphere("Sphere", med, 0, 20), 1, new TGeoTranslation(0, -60, 30));
+   geom->CloseGeometry();
+   auto nav = geom->GetCurrentNavigator();
+
+   const Int_t n = 1000;
+   TRandom3 rng(1);
+   std::vector<Double_t> points(3 * n), dirs(3 * n), stepmax(n, 1e30), snext(n);
+   std::vector<Int_t> idaughter(n);
+   for (Int_t i = 0; i < n; i++) {
+      for (Int_t j = 0; j < 3; j++)
+         points[3 * i + j] = rng.Uniform(-99, 99);
+      rng.Sphere(dirs[3 * i], dirs[3 * i + 1], dirs[3 * i + 2], 1.);
+   }
+   stepmax[0] = 1.;
+
+   nav->FindDaughter_v(world, points.data(), n, idaughter.data());
+   for (Int_t i = 0; i < n; i++) {
+      auto node = nav->FindNode(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+      EXPECT_EQ(idaughter[i], nav->GetLevel() == 0 ? -1 : world->GetIndex(node)) << "point " << i;
+   }
+
+   // keep only the tracks which start outside of the daughters
+   std::vector<Double_t> opoints, odirs, ostepmax;
+   for (Int_t i = 0; i < n; i++) {
+      if (idaughter[i] >= 0)
+         continue;
+      opoints.insert(opoints.end(), &points[3 * i], &points[3 * i + 3]);
+      odirs.insert(odirs.end(), &dirs[3 * i], &dirs[3 * i + 3]);
+      ostepmax.push_back(stepmax[i]);
+   }
+   const Int_t nout = ostepmax.size();
+   ASSERT_GT(nout, 0);
+   nav->FindNextBoundary_v(world, opoints.data(), odirs.data(), nout, ostepmax.data(), snext.data(),
+                           idaughter.data());
+   for (Int_t i = 0; i < nout; i++) {
+      nav->InitTrack(&opoints[3 * i], &odirs[3 * i]);
+      auto next = nav->FindNextBoundary(ostepmax[i]);
+      EXPECT_NEAR(snext[i], std::min(nav->GetStep(), ostepmax[i]), 1e-8) << "track " << i;
+      if (idaughter[i] >= 0)
+         EXPECT_EQ(next, world->GetNode(idaughter[i])) << "track " << i;
+   }
+   delete geom;
+}
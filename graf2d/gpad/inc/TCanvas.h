@@ -16,6 +16,8 @@
 
 #include "TAttCanvas.h"
 
+#include <functional>
+
 class TCanvasImp;
 class TContextMenu;
 class TControlBar;
@@ -227,6 +229,10 @@ public:
    void                DeleteCanvasPainter();
 
    static TCanvas   *MakeDefCanvas();
+   static Int_t      SaveInParallel(Int_t n, const std::function<TCanvas *(Int_t)> &build,
+                                    const std::function<TString(Int_t)> &filename, Int_t nworkers = 0);
+   static Int_t      SaveInParallel(Int_t n, const std::function<TCanvas *(Int_t)> &build, const char *filename,
+                                    Int_t nworkers = 0);
    static Bool_t     SupportAlpha();
 
    ClassDefOverride(TCanvas,8)  //Graphics canvas
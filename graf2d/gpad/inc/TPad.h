@@ -113,6 +113,7 @@ protected:
    TObject      *fPadPointer;       ///<! free pointer
    TObject      *fPadView3D;        ///<! 3D View of this TPad
    static Int_t  fgMaxPickDistance; ///<  Maximum Pick Distance
+   static Int_t  fgLevelOfDetail;   ///<  Level of detail painting of large graphs and histograms (-1 until set)
    Int_t         fNumPaletteColor;  ///<  Number of objects with an automatic color
    Int_t         fNextPaletteColor; ///<  Next automatic color
    std::vector<Bool_t> fCollideGrid;///<! Grid used to find empty space when adding a box (Legend) in a pad
@@ -240,6 +241,7 @@ public:
    Double_t          GetY1() const override { return fY1; }
    Double_t          GetY2() const override { return fY2; }
    static Int_t      GetMaxPickDistance();
+   static Bool_t     GetLevelOfDetail();
    TList            *GetListOfPrimitives() const override { return fPrimitives; }
    TList            *GetListOfExecs() const override { return fExecs; }
    TObject          *GetPrimitive(const char *name) const override;  //obsolete, use FindObject instead
@@ -345,6 +347,7 @@ public:
    void              SetAttMarkerPS(Color_t color, Style_t style, Size_t msize) override;
    void              SetAttTextPS(Int_t align, Float_t angle, Color_t color, Style_t font, Float_t tsize) override;
    static  void      SetMaxPickDistance(Int_t maxPick=5);
+   static  void      SetLevelOfDetail(Bool_t lod=kTRUE);
    void              SetName(const char *name) override { fName = name; } // *MENU*
    void              SetSelected(TObject *obj) override;
    void              SetTicks(Int_t valuex = 1, Int_t valuey = 1) override { fTickx = valuex; fTicky = valuey; Modified(); }
@@ -13,6 +13,12 @@
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <functional>
+#include <vector>
+#ifndef R__WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -44,6 +50,8 @@
 #include "TGraph.h"
 #include "TMath.h"
 #include "TView.h"
+#include "TFile.h"
+#include "TSystem.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 
@@ -2608,3 +2616,201 @@ void TCanvas::DeleteCanvasPainter()
       fGLDevice = -1;
    }
 }
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run work(i) for the n canvases in nworkers forked batch processes, the worker
+/// w taking the canvases w, w + nworkers, w + 2*nworkers... Then call collect(i, ok)
+/// in this process for each canvas in order, as soon as its worker is done with
+/// it. Without fork, or with one worker, it all runs in this process.
+
+void RunSaveWorkers(Int_t n, Int_t nworkers, const std::function<Bool_t(Int_t)> &work,
+                    const std::function<void(Int_t, Bool_t)> &collect)
+{
+#ifndef R__WIN32
+   std::vector<int> fds;
+   std::vector<pid_t> pids;
+   if (nworkers > 1) {
+      std::cout.flush();
+      fflush(stdout);
+      fflush(stderr);
+      for (Int_t w = 0; w < nworkers; w++) {
+         int fd[2];
+         if (pipe(fd) != 0) break;
+         pid_t pid = fork();
+         if (pid < 0) {
+            close(fd[0]);
+            close(fd[1]);
+            break;
+         }
+         if (pid == 0) {
+            // worker: a batch session reporting each canvas done through the pipe
+            close(fd[0]);
+            for (auto other : fds) close(other);
+            gROOT->SetBatch();
+            if (gGuiFactory != gBatchGuiFactory) delete gGuiFactory;
+            gGuiFactory = gBatchGuiFactory;
+            if (gVirtualX != gGXBatch) delete gVirtualX;
+            gVirtualX = gGXBatch;
+            for (Int_t i = w; i < n; i += nworkers) {
+               Char_t ok = work(i) ? 1 : 0;
+               if (write(fd[1], &ok, 1) != 1) break;
+            }
+            close(fd[1]);
+            // leave without the cleanup of the session shared with the parent (open files, ...)
+            _exit(0);
+         }
+         close(fd[1]);
+         fds.push_back(fd[0]);
+         pids.push_back(pid);
+      }
+      if (fds.empty())
+         ::Warning("TCanvas::SaveInParallel", "cannot fork the workers, saving the canvases sequentially");
+   }
+   if (!fds.empty()) {
+      const Int_t nforked = fds.size();
+      std::vector<Bool_t> alive(nforked, kTRUE);
+      for (Int_t i = 0; i < n; i++) {
+         const Int_t w = i % nforked;
+         Char_t ok = 0;
+         if (alive[w] && read(fds[w], &ok, 1) != 1) {
+            ::Error("TCanvas::SaveInParallel", "worker %d terminated before saving all its canvases", w);
+            alive[w] = kFALSE;
+            ok = 0;
+         }
+         collect(i, ok);
+      }
+      for (Int_t w = 0; w < nforked; w++) {
+         close(fds[w]);
+         waitpid(pids[w], nullptr, 0);
+      }
+      return;
+   }
+#else
+   (void)nworkers;
+#endif
+   Bool_t batch = gROOT->IsBatch();
+   gROOT->SetBatch(kTRUE);
+   for (Int_t i = 0; i < n; i++)
+      collect(i, work(i));
+   gROOT->SetBatch(batch);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of workers used by TCanvas::SaveInParallel for n canvases.
+
+Int_t SaveWorkers(Int_t n, Int_t nworkers)
+{
+   if (nworkers <= 0) {
+      SysInfo_t si;
+      nworkers = gSystem->GetSysInfo(&si) == 0 ? si.fCpus : 1;
+   }
+   return TMath::Max(1, TMath::Min(nworkers, n));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build and save n independent canvases with several processes.
+///
+/// The canvas i is returned by `build(i)` and saved with TPad::SaveAs in the
+/// file `filename(i)`, in any of the formats of TPad::SaveAs, then deleted. The
+/// canvases are distributed among nworkers processes forked from this session
+/// (the number of cores when 0), in batch mode, so that building and painting
+/// them, as well as writing the files, scale with the number of cores. The
+/// state of the graphics (gPad, gStyle, the colors...) is the one of this
+/// session when forking, each worker changing only its own copy of it.
+///
+/// ~~~ {.cpp}
+/// TCanvas::SaveInParallel(hists.size(),
+///    [&](Int_t i) { auto c = new TCanvas(); hists[i]->Draw(); return c; },
+///    [&](Int_t i) { return TString::Format("plot_%d.png", i); });
+/// ~~~
+///
+/// Returns the number of canvases which could not be built (build returned a
+/// null pointer) or whose worker died. On Windows, the canvases are saved
+/// sequentially.
+
+Int_t TCanvas::SaveInParallel(Int_t n, const std::function<TCanvas *(Int_t)> &build,
+                              const std::function<TString(Int_t)> &filename, Int_t nworkers)
+{
+   if (n <= 0) return 0;
+   Int_t nfailed = 0;
+   auto work = [&](Int_t i) {
+      TCanvas *c = build(i);
+      if (!c) return kFALSE;
+      c->SaveAs(filename(i));
+      delete c;
+      return kTRUE;
+   };
+   RunSaveWorkers(n, SaveWorkers(n, nworkers), work, [&](Int_t, Bool_t ok) { if (!ok) nfailed++; });
+   return nfailed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build n independent canvases with several processes and save them as the
+/// pages of one PostScript or PDF file.
+///
+/// The canvas i is returned by `build(i)`, in one of nworkers processes forked
+/// from this session (the number of cores when 0), in batch mode, like with the
+/// other overload. The workers store the canvases in temporary ROOT files, that
+/// this session reads back in order as soon as they are written, printing each
+/// one as a page of the file (see TPad::Print): the document is streamed while
+/// the next canvases are still being built.
+///
+/// Returns the number of canvases which could not be built or read back, which
+/// are missing from the document.
+
+Int_t TCanvas::SaveInParallel(Int_t n, const std::function<TCanvas *(Int_t)> &build, const char *filename,
+                              Int_t nworkers)
+{
+   if (n <= 0 || !filename || !filename[0]) return 0;
+   // the temporary files are named after this process, not the workers
+   const Int_t pid = gSystem->GetPid();
+   auto tmpName = [pid](Int_t i) {
+      return TString::Format("%s/rootcanvas-%d-%d.root", gSystem->TempDirectory(), pid, i);
+   };
+   auto work = [&](Int_t i) {
+      TCanvas *c = build(i);
+      if (!c) return kFALSE;
+      TFile f(tmpName(i), "RECREATE");
+      Bool_t ok = !f.IsZombie() && c->Write("canvas") > 0;
+      f.Close();
+      delete c;
+      return ok;
+   };
+
+   Int_t nfailed = 0;
+   Bool_t batch = gROOT->IsBatch();
+   TCanvas *last = nullptr;
+   auto collect = [&](Int_t i, Bool_t ok) {
+      TCanvas *c = nullptr;
+      if (ok) {
+         TFile f(tmpName(i), "READ");
+         if (!f.IsZombie()) c = dynamic_cast<TCanvas *>(f.Get("canvas"));
+      }
+      gSystem->Unlink(tmpName(i));
+      if (!c) {
+         nfailed++;
+         return;
+      }
+      // the previous page is deleted first, as drawing a canvas deletes the one of the same name
+      const Bool_t first = !last;
+      delete last;
+      gROOT->SetBatch(kTRUE);
+      c->Draw();
+      if (first) c->Print(TString::Format("%s[", filename));
+      c->Print(filename);
+      gROOT->SetBatch(batch);
+      last = c;
+   };
+   RunSaveWorkers(n, SaveWorkers(n, nworkers), work, collect);
+   if (last) {
+      gROOT->SetBatch(kTRUE);
+      last->Print(TString::Format("%s]", filename));
+      gROOT->SetBatch(batch);
+      delete last;
+   }
+   return nfailed;
+}
@@ -65,6 +65,7 @@
 static Int_t gReadLevel = 0;
 
 Int_t TPad::fgMaxPickDistance = 5;
+Int_t TPad::fgLevelOfDetail = -1;
 
 ClassImpQ(TPad)
 
@@ -2690,6 +2691,18 @@ Int_t TPad::GetMaxPickDistance()
    return fgMaxPickDistance;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function returning kTRUE when the level of detail painting is enabled
+/// (see TPad::SetLevelOfDetail). Unless set explicitly, it is taken from the
+/// resource `Canvas.LevelOfDetail` (enabled by default).
+
+Bool_t TPad::GetLevelOfDetail()
+{
+   if (fgLevelOfDetail < 0)
+      fgLevelOfDetail = gEnv->GetValue("Canvas.LevelOfDetail", 1) ? 1 : 0;
+   return fgLevelOfDetail;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get selected.
 
@@ -4222,6 +4235,110 @@ void TPad::PaintLine3D(Double_t *p1, Double_t *p2)
    PaintLine(xpad[0],xpad[1],xpad[3],xpad[4]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Number of columns (or rows) of the grid used by the level of detail painting
+/// of the pad along a direction of npixels pixels. The grid is finer than the
+/// pixels, so that vector outputs stay accurate when zoomed.
+
+static Int_t LevelOfDetailCells(Double_t npixels)
+{
+   const Int_t kOversampling = 4;
+   return Int_t(npixels) * kOversampling;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce a polyline of n points to at most four points per column of a grid
+/// of ncol columns spanning [xmin, xmax]: for each run of consecutive points
+/// falling in the same column, only the first, lowest, highest and last points
+/// are kept, in their original order. The envelope of the curve is preserved.
+
+template <typename T>
+static void MergePolyLineColumns(Int_t n, const T *x, const T *y, Double_t xmin, Double_t xmax, Int_t ncol,
+                                 std::vector<T> &xm, std::vector<T> &ym)
+{
+   xm.clear();
+   ym.clear();
+   const Double_t scale = ncol / (xmax - xmin);
+   Int_t i = 0;
+   while (i < n) {
+      const Double_t col = TMath::Floor((x[i] - xmin) * scale);
+      Int_t j = i + 1, imin = i, imax = i;
+      for (; j < n && TMath::Floor((x[j] - xmin) * scale) == col; j++) {
+         if (y[j] < y[imin]) imin = j;
+         if (y[j] > y[imax]) imax = j;
+      }
+      const Int_t kept[4] = {i, TMath::Min(imin, imax), TMath::Max(imin, imax), j - 1};
+      for (Int_t k = 0; k < 4; k++) {
+         if (k > 0 && kept[k] == kept[k - 1]) continue;
+         xm.push_back(x[kept[k]]);
+         ym.push_back(y[kept[k]]);
+      }
+      i = j;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce a polymarker of n points to at most one point per cell of a grid of
+/// ncol x nrow cells spanning [xmin, xmax] x [ymin, ymax]: markers falling in a
+/// cell already covered are indistinguishable and are dropped.
+
+template <typename T>
+static void MergePolyMarkerCells(Int_t n, const T *x, const T *y, Double_t xmin, Double_t xmax, Double_t ymin,
+                                 Double_t ymax, Int_t ncol, Int_t nrow, std::vector<T> &xm, std::vector<T> &ym)
+{
+   xm.clear();
+   ym.clear();
+   std::vector<bool> covered(Long64_t(ncol) * nrow, false);
+   const Double_t xscale = ncol / (xmax - xmin);
+   const Double_t yscale = nrow / (ymax - ymin);
+   for (Int_t i = 0; i < n; i++) {
+      const Long64_t col = TMath::Min(Long64_t((x[i] - xmin) * xscale), Long64_t(ncol - 1));
+      const Long64_t row = TMath::Min(Long64_t((y[i] - ymin) * yscale), Long64_t(nrow - 1));
+      if (col >= 0 && row >= 0) {
+         const Long64_t cell = row * ncol + col;
+         if (covered[cell]) continue;
+         covered[cell] = true;
+      }
+      xm.push_back(x[i]);
+      ym.push_back(y[i]);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Paint a polyline of n points in the PostScript-like output, reduced to its
+/// envelope when it has more points than the output can resolve.
+
+template <typename T>
+static void DrawPolyLinePS(TPad *pad, Int_t n, T *x, T *y)
+{
+   const Int_t ncol = LevelOfDetailCells(pad->GetWw() * pad->GetAbsWNDC());
+   if (TPad::GetLevelOfDetail() && ncol > 0 && n > 4 * ncol) {
+      std::vector<T> xm, ym;
+      MergePolyLineColumns(n, x, y, pad->GetX1(), pad->GetX2(), ncol, xm, ym);
+      gVirtualPS->DrawPS(xm.size(), xm.data(), ym.data());
+   } else {
+      gVirtualPS->DrawPS(n, x, y);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Paint a polymarker of n points in the PostScript-like output, without the
+/// markers hidden by the ones painted at the same place.
+
+template <typename T>
+static void DrawPolyMarkerPS(TPad *pad, Int_t n, T *x, T *y)
+{
+   const Int_t ncol = LevelOfDetailCells(pad->GetWw() * pad->GetAbsWNDC());
+   const Int_t nrow = LevelOfDetailCells(pad->GetWh() * pad->GetAbsHNDC());
+   if (TPad::GetLevelOfDetail() && ncol > 0 && nrow > 0 && n > ncol) {
+      std::vector<T> xm, ym;
+      MergePolyMarkerCells(n, x, y, pad->GetX1(), pad->GetX2(), pad->GetY1(), pad->GetY2(), ncol, nrow, xm, ym);
+      gVirtualPS->DrawPolyMarker(xm.size(), xm.data(), ym.data());
+   } else {
+      gVirtualPS->DrawPolyMarker(n, x, y);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Paint polyline in CurrentPad World coordinates.
 
@@ -4252,7 +4369,7 @@ void TPad::PaintPolyLine(Int_t n, Float_t *x, Float_t *y, Option_t *)
       if (!gPad->IsBatch() && GetPainter())
          GetPainter()->DrawPolyLine(np, &x[i1], &y[i1]);
       if (gVirtualPS) {
-         gVirtualPS->DrawPS(np, &x[i1], &y[i1]);
+         DrawPolyLinePS(this, np, &x[i1], &y[i1]);
       }
       if (iclip) {
          x[i] = x1;
@@ -4305,7 +4422,7 @@ void TPad::PaintPolyLine(Int_t n, Double_t *x, Double_t *y, Option_t *option)
       if (!gPad->IsBatch() && GetPainter())
          GetPainter()->DrawPolyLine(np, &x[i1], &y[i1]);
       if (gVirtualPS) {
-         gVirtualPS->DrawPS(np, &x[i1], &y[i1]);
+         DrawPolyLinePS(this, np, &x[i1], &y[i1]);
       }
       if (iclip) {
          x[i] = x1;
@@ -4378,7 +4495,7 @@ void TPad::PaintPolyMarker(Int_t nn, Float_t *x, Float_t *y, Option_t *)
       if (!gPad->IsBatch() && GetPainter())
          GetPainter()->DrawPolyMarker(np, &x[i1], &y[i1]);
       if (gVirtualPS) {
-         gVirtualPS->DrawPolyMarker(np, &x[i1], &y[i1]);
+         DrawPolyMarkerPS(this, np, &x[i1], &y[i1]);
       }
       i1 = -1;
       np = 0;
@@ -4409,7 +4526,7 @@ void TPad::PaintPolyMarker(Int_t nn, Double_t *x, Double_t *y, Option_t *)
       if (!gPad->IsBatch() && GetPainter())
          GetPainter()->DrawPolyMarker(np, &x[i1], &y[i1]);
       if (gVirtualPS) {
-         gVirtualPS->DrawPolyMarker(np, &x[i1], &y[i1]);
+         DrawPolyMarkerPS(this, np, &x[i1], &y[i1]);
       }
       i1 = -1;
       np = 0;
@@ -6507,6 +6624,27 @@ void TPad::SetMaxPickDistance(Int_t maxPick)
    fgMaxPickDistance = maxPick;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to enable or disable the level of detail painting.
+///
+/// When enabled, the primitives carrying more points than the pad can resolve
+/// are reduced before being painted: the polylines keep only their envelope
+/// (the first, lowest, highest and last points of each column of a grid 4 times
+/// finer than the pixels of the pad) and the polymarkers drop the markers
+/// painted at the same place as a previous one. The 2D histograms drawn with
+/// the option COL, having more visible cells than the pixels of the frame, are
+/// painted as an image of the frame resolution, embedded as such in the
+/// PostScript, PDF and SVG outputs (see THistPainter).
+///
+/// This keeps the painting of large graphs and histograms interactive and the
+/// vector outputs small. It is enabled by default; it can also be disabled with
+/// the resource `Canvas.LevelOfDetail: false`.
+
+void TPad::SetLevelOfDetail(Bool_t lod)
+{
+   fgLevelOfDetail = lod ? 1 : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set tool tip text associated with this pad. The delay is in
 /// milliseconds (minimum 250). To remove tool tip call method with
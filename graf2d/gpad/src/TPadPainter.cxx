@@ -892,7 +892,27 @@ void DrawPolyMarkerAux(TVirtualPad *pad, unsigned nPoints, const T *xs, const T
       xy[i].fY = (SCoord_t)pad->YtoPixel(ys[i]);
    }
 
-   gVirtualX->DrawPolyMarker(nPoints, &xy[0]);
+   //With more markers than pixels, the ones painted on an already covered
+   //pixel cannot be seen (see TPad::SetLevelOfDetail).
+   const UInt_t w = pad->GetWw(), h = pad->GetWh();
+   if (TPad::GetLevelOfDetail() && nPoints > w && w && h) {
+      std::vector<bool> covered(std::size_t(w) * h, false);
+      size_type nKept = 0;
+      for (unsigned i = 0; i < nPoints; ++i) {
+         const TPoint &p = xy[i];
+         if (p.fX >= 0 && p.fY >= 0 && UInt_t(p.fX) < w && UInt_t(p.fY) < h) {
+            const std::size_t pixel = std::size_t(p.fY) * w + p.fX;
+            if (covered[pixel])
+               continue;
+            covered[pixel] = true;
+         }
+         xy[nKept++] = p;
+      }
+      xy.resize(nKept);
+   }
+
+   if (!xy.empty())
+      gVirtualX->DrawPolyMarker(xy.size(), &xy[0]);
 }
 
 }
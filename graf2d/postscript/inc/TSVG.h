@@ -15,6 +15,8 @@
 
 #include "TVirtualPS.h"
 
+#include <vector>
+
 class TPoints;
 
 class TSVG : public TVirtualPS {
@@ -26,6 +28,13 @@ protected:
    Bool_t       fBoundingBox;     ///< True when the SVG header is printed
    Bool_t       fRange;           ///< True when a range has been defined
    Double_t     fYsizeSVG;        ///< Page's Y size in SVG units
+   std::vector<UChar_t> fCellArray; ///< RGB colors of the cells of the current cell array
+   Int_t        fCellArrayW = 0;  ///< Number of cells of the current cell array along X
+   Int_t        fCellArrayH = 0;  ///< Number of cells of the current cell array along Y
+   Double_t     fCellArrayX = 0;  ///< Left edge of the current cell array in SVG units
+   Double_t     fCellArrayY = 0;  ///< Top edge of the current cell array in SVG units
+   Double_t     fCellArrayDX = 0; ///< Width of the cells of the current cell array in SVG units
+   Double_t     fCellArrayDY = 0; ///< Height of the cells of the current cell array in SVG units
 
    static Int_t fgLineJoin;       ///< Appearance of joining lines
    static Int_t fgLineCap;        ///< Appearance of line caps
@@ -172,19 +172,41 @@ TPDF::~TPDF()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Begin the Cell Array painting
+///
+/// The cell array has W x H cells, the top left one spanning [x1,x2] x [y1,y2].
+/// It is written as an inline image, with the colors of the cells given by
+/// CellArrayFill from the top left to the bottom right one in hexadecimal form
+/// (the page stream being compressed).
 
-void TPDF::CellArrayBegin(Int_t, Int_t, Double_t, Double_t, Double_t,
-                          Double_t)
+void TPDF::CellArrayBegin(Int_t W, Int_t H, Double_t x1, Double_t x2, Double_t y1,
+                          Double_t y2)
 {
-   Warning("TPDF::CellArrayBegin", "not yet implemented");
+   Double_t dx  = TMath::Abs(XtoPDF(x2)-XtoPDF(x1));
+   Double_t dy  = TMath::Abs(YtoPDF(y2)-YtoPDF(y1));
+   Double_t ix1 = XtoPDF(TMath::Min(x1,x2));
+   Double_t iy1 = YtoPDF(TMath::Max(y1,y2))-H*dy;
+
+   PrintStr(" q");
+   WriteReal(W*dx);
+   PrintStr(" 0 0");
+   WriteReal(H*dy);
+   WriteReal(ix1);
+   WriteReal(iy1);
+   PrintStr(" cm BI /W");
+   WriteInteger(W);
+   PrintStr(" /H");
+   WriteInteger(H);
+   PrintStr(" /CS /RGB /BPC 8 /F /AHx ID ");
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Paint the Cell Array
 
-void TPDF::CellArrayFill(Int_t, Int_t, Int_t)
+void TPDF::CellArrayFill(Int_t r, Int_t g, Int_t b)
 {
-   Warning("TPDF::CellArrayFill", "not yet implemented");
+   char str[8];
+   snprintf(str, 8, "%02x%02x%02x", r & 0xFF, g & 0xFF, b & 0xFF);
+   PrintFast(6, str);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -192,7 +214,7 @@ void TPDF::CellArrayFill(Int_t, Int_t, Int_t)
 
 void TPDF::CellArrayEnd()
 {
-   Warning("TPDF::CellArrayEnd", "not yet implemented");
+   PrintStr("> EI Q");
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1583,7 +1583,8 @@ void TSVG::NewPage()
       PrintStr("\" viewBox=\"0 0");
       WriteReal(CMtoSVG(fXsize));
       WriteReal(fYsizeSVG);
-      PrintStr("\" xmlns=\"http://www.w3.org/2000/svg\" shape-rendering=\"crispEdges\">");
+      PrintStr("\" xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\"");
+      PrintStr(" shape-rendering=\"crispEdges\">");
       PrintStr("@");
       Initialize();
       fBoundingBox  = kTRUE;
@@ -2034,27 +2035,102 @@ Double_t TSVG::YtoSVG(Double_t y)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Begin the Cell Array painting
+///
+/// The cell array has W x H cells, the top left one spanning [x1,x2] x [y1,y2].
+/// The colors of the cells, given by CellArrayFill from the top left to the
+/// bottom right one, are collected and CellArrayEnd writes them as one image.
 
-void TSVG::CellArrayBegin(Int_t, Int_t, Double_t, Double_t, Double_t,
-                          Double_t)
+void TSVG::CellArrayBegin(Int_t W, Int_t H, Double_t x1, Double_t x2, Double_t y1,
+                          Double_t y2)
 {
-   Warning("TSVG::CellArrayBegin", "not yet implemented");
+   fCellArrayW  = W;
+   fCellArrayH  = H;
+   fCellArrayX  = XtoSVG(TMath::Min(x1,x2));
+   fCellArrayY  = YtoSVG(TMath::Max(y1,y2));
+   fCellArrayDX = TMath::Abs(XtoSVG(x2)-XtoSVG(x1));
+   fCellArrayDY = TMath::Abs(YtoSVG(y2)-YtoSVG(y1));
+   fCellArray.clear();
+   fCellArray.reserve(3*W*H);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Paint the Cell Array
 
-void TSVG::CellArrayFill(Int_t, Int_t, Int_t)
+void TSVG::CellArrayFill(Int_t r, Int_t g, Int_t b)
 {
-   Warning("TSVG::CellArrayFill", "not yet implemented");
+   if ((Int_t)fCellArray.size() >= 3*fCellArrayW*fCellArrayH) return;
+   fCellArray.push_back(r);
+   fCellArray.push_back(g);
+   fCellArray.push_back(b);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// End the Cell Array painting
+///
+/// The cells are written as an `<image>` element holding a BMP picture, which
+/// does not need any compression library and is understood by all the SVG
+/// viewers.
 
 void TSVG::CellArrayEnd()
 {
-   Warning("TSVG::CellArrayEnd", "not yet implemented");
+   const Int_t w = fCellArrayW, h = fCellArrayH;
+   if (w <= 0 || h <= 0) return;
+   fCellArray.resize(3*w*h, 255);
+
+   // 24 bits BMP: the rows, padded to 4 bytes, go from the bottom to the top
+   const Int_t rowSize = (3*w+3) & ~3;
+   const Int_t fileSize = 54 + rowSize*h;
+   std::vector<UChar_t> bmp(fileSize, 0);
+   auto put = [&bmp](Int_t pos, Int_t value, Int_t nbytes) {
+      for (Int_t i = 0; i < nbytes; i++) bmp[pos+i] = (value >> (8*i)) & 0xFF;
+   };
+   bmp[0] = 'B'; bmp[1] = 'M';
+   put(2, fileSize, 4);
+   put(10, 54, 4);     // offset of the pixels
+   put(14, 40, 4);     // size of the info header
+   put(18, w, 4);
+   put(22, h, 4);
+   put(26, 1, 2);      // planes
+   put(28, 24, 2);     // bits per pixel
+   put(34, rowSize*h, 4);
+   for (Int_t j = 0; j < h; j++) {
+      UChar_t *row = &bmp[54 + (h-1-j)*rowSize];
+      const UChar_t *cells = &fCellArray[3*j*w];
+      for (Int_t i = 0; i < w; i++) {
+         row[3*i]   = cells[3*i+2];
+         row[3*i+1] = cells[3*i+1];
+         row[3*i+2] = cells[3*i];
+      }
+   }
+
+   PrintStr("@");
+   PrintFast(10,"<image x=\"");
+   WriteReal(fCellArrayX, kFALSE);
+   PrintFast(5,"\" y=\"");
+   WriteReal(fCellArrayY, kFALSE);
+   PrintFast(9,"\" width=\"");
+   WriteReal(w*fCellArrayDX, kFALSE);
+   PrintFast(10,"\" height=\"");
+   WriteReal(h*fCellArrayDY, kFALSE);
+   PrintStr("\" preserveAspectRatio=\"none\" image-rendering=\"optimizeSpeed\"");
+   PrintStr(" xlink:href=\"data:image/bmp;base64,");
+
+   // base64 encoding of the BMP picture
+   static const char *kBase64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+   char quad[5] = {0};
+   for (Int_t i = 0; i < fileSize; i += 3) {
+      const Int_t n = TMath::Min(3, fileSize-i);
+      const UInt_t v = (bmp[i] << 16) | ((n > 1 ? bmp[i+1] : 0) << 8) | (n > 2 ? bmp[i+2] : 0);
+      quad[0] = kBase64[(v >> 18) & 0x3F];
+      quad[1] = kBase64[(v >> 12) & 0x3F];
+      quad[2] = n > 1 ? kBase64[(v >> 6) & 0x3F] : '=';
+      quad[3] = n > 2 ? kBase64[v & 0x3F] : '=';
+      PrintFast(4, quad);
+   }
+   PrintFast(3,"\"/>");
+
+   fCellArray.clear();
+   fCellArrayW = fCellArrayH = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
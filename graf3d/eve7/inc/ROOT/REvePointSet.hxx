@@ -45,6 +45,7 @@ protected:
    std::vector<REveVector> fPoints;
    int                     fCapacity{0};
    int                     fSize{0};
+   int                     fMaxRenderedPoints{0}; // Maximum number of points sent to the client, 0 for all
 
 public:
    REvePointSet(const std::string& name="", const std::string& title="", Int_t n_points = 0);
@@ -71,6 +72,9 @@ public:
    void SetMarkerStyle(Style_t mstyle = 1) override;
    void SetMarkerSize(Size_t msize = 1) override;
 
+   int  GetMaxRenderedPoints() const { return fMaxRenderedPoints; }
+   void SetMaxRenderedPoints(int n);
+
    void CopyVizParams(const REveElement *el) override;
    void WriteVizParams(std::ostream &out, const TString &var) override;
 
@@ -21,6 +21,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+
 using namespace ROOT::Experimental;
 
 /** \class REvePointSet
@@ -173,6 +175,26 @@ void REvePointSet::SetMarkerSize(Size_t msize)
    StampObjProps();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of points sent to the client, 0 to send all of them.
+/// Larger sets are decimated uniformly when building the render data, which
+/// limits the size of the scene updates for sets of millions of hits while
+/// preserving their overall shape. The projected sets use the same limit.
+
+void REvePointSet::SetMaxRenderedPoints(int n)
+{
+   for (auto &pi: fProjectedList)
+   {
+      REvePointSet* pt = dynamic_cast<REvePointSet *>(pi);
+      if (pt)
+      {
+         pt->SetMaxRenderedPoints(n);
+      }
+   }
+   fMaxRenderedPoints = std::max(n, 0);
+   StampObjProps();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy visualization parameters from element el.
 
@@ -182,6 +204,7 @@ void REvePointSet::CopyVizParams(const REveElement* el)
    if (m)
    {
       TAttMarker::operator=(*m);
+      fMaxRenderedPoints = m->fMaxRenderedPoints;
    }
 
    REveElement::CopyVizParams(el);
@@ -218,10 +241,17 @@ Int_t REvePointSet::WriteCoreJson(nlohmann::json& j, Int_t rnr_offset)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Crates 3D point array for rendering.
+/// If there are more than fMaxRenderedPoints points, a uniform subset of them is used.
 
 void REvePointSet::BuildRenderData()
 {
-   if (fSize > 0)
+   if (fSize > 0 && fMaxRenderedPoints > 0 && fSize > fMaxRenderedPoints)
+   {
+      fRenderData = std::make_unique<REveRenderData>("makeHit", 3*fMaxRenderedPoints);
+      for (int i = 0; i < fMaxRenderedPoints; ++i)
+         fRenderData->PushV(fPoints[(Long64_t) i * fSize / fMaxRenderedPoints]);
+   }
+   else if (fSize > 0)
    {
       fRenderData = std::make_unique<REveRenderData>("makeHit", 3*fSize);
       fRenderData->PushV(&fPoints[0].fX, 3*fSize);
@@ -24,6 +24,7 @@
 #include <queue>
 #include <functional>
 #include <map>
+#include <set>
 
 class TPad;
 class TPadWebSnapshot;
@@ -58,11 +59,13 @@ protected:
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       UInt_t fLastSendHash{0};         ///<! hash of last send draw message, avoid looping
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
+      std::map<std::string, std::map<std::string, UInt_t>> fPadHashes; ///<! hashes of primitives send for each pad
       WebConn(unsigned id) : fConnId(id) {}
       void reset()
       {
          fCheckedVersion = fSendVersion = fDrawVersion = 0;
          fLastSendHash = 0;
+         fPadHashes.clear();
       }
    };
 
@@ -111,6 +114,7 @@ protected:
    void AddColorsPalette(TPadWebSnapshot &master);
    void CreateObjectSnapshot(TPadWebSnapshot &master, TPad *pad, TObject *obj, const char *opt, TWebPS *masterps = nullptr);
    void CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t version, PadPaintingReady_t func);
+   void ReducePadSnapshot(TPadWebSnapshot &paddata, WebConn &conn, std::set<std::string> &pads, bool full);
 
    void CheckPadModified(TPad *pad);
 
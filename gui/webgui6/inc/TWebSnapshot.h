@@ -36,7 +36,8 @@ public:
      kSVG = 2,         ///< list of SVG primitives
      kSubPad = 3,      ///< subpad
      kColors = 4,      ///< list of ROOT colors + palette
-     kStyle = 5        ///< gStyle object
+     kStyle = 5,       ///< gStyle object
+     kUnchanged = 6    ///< object already send to the client, just to be redrawn
    };
 
    virtual ~TWebSnapshot();
@@ -46,6 +47,7 @@ public:
    const char* GetObjectID() const { return fObjectID.c_str(); }
 
    void SetOption(const std::string &opt) { fOption = opt; }
+   const char* GetOption() const { return fOption.c_str(); }
 
    void SetSnapshot(Int_t kind, TObject *snapshot, Bool_t owner = kFALSE);
    Int_t GetKind() const { return fKind; }
@@ -73,6 +75,7 @@ public:
    void SetActive(bool on = true) { fActive = on; }
 
    void SetWithoutPrimitives(bool on = true) { fWithoutPrimitives = on; }
+   bool IsWithoutPrimitives() const { return fWithoutPrimitives; }
 
    bool IsReadOnly() const { return fReadOnly; }
 
@@ -82,6 +85,8 @@ public:
 
    TWebSnapshot &NewSpecials();
 
+   std::vector<std::unique_ptr<TWebSnapshot>> &GetPrimitives() { return fPrimitives; }
+
    ClassDef(TPadWebSnapshot, 2) // Pad painting snapshot, used for JSROOT
 };
 
@@ -553,6 +553,45 @@ void TWebCanvas::CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t
    fPrimitivesLists.Clear("nodelete");
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Replace in the snapshot the primitives which did not change since they were send to the connection
+/// Each object or SVG painting is identified by its id, and compared with the hash of its JSON and draw
+/// option send before in the same pad. Unchanged ones are marked as kUnchanged without data, so that the
+/// client just redraws them. When full is true, everything is send and only the hashes are recorded.
+/// Ids of all pads in the snapshot are collected, to forget the pads removed from the canvas
+
+void TWebCanvas::ReducePadSnapshot(TPadWebSnapshot &paddata, WebConn &conn, std::set<std::string> &pads, bool full)
+{
+   pads.emplace(paddata.GetObjectID());
+
+   std::map<std::string, UInt_t> hashes;
+   auto &prev = conn.fPadHashes[paddata.GetObjectID()];
+
+   for (auto &prim : paddata.GetPrimitives()) {
+      if (prim->GetKind() == TWebSnapshot::kSubPad) {
+         ReducePadSnapshot(static_cast<TPadWebSnapshot &>(*prim), conn, pads, full);
+         continue;
+      }
+      if (paddata.IsWithoutPrimitives() || !prim->GetSnapshot() ||
+          ((prim->GetKind() != TWebSnapshot::kObject) && (prim->GetKind() != TWebSnapshot::kSVG)))
+         continue;
+
+      auto json = TBufferJSON::ConvertToJSON(prim->GetSnapshot(), prim->GetSnapshot()->IsA(), fJsonComp);
+      json.Append(prim->GetOption());
+      auto hash = json.Hash();
+
+      std::string id = prim->GetObjectID();
+      auto iter = prev.find(id);
+      if (!full && (iter != prev.end()) && (iter->second == hash) && (hashes.count(id) == 0))
+         prim->SetSnapshot(TWebSnapshot::kUnchanged, nullptr);
+      hashes[id] = hash;
+   }
+
+   // when primitives are not send, client keeps the ones received before
+   if (!paddata.IsWithoutPrimitives())
+      std::swap(prev, hashes);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Add message to send queue for specified connection
 /// If connid == 0, message will be add to all connections
@@ -603,6 +642,12 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
          holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
 
          CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf, &conn, this](TPadWebSnapshot *snap) {
+            // send only objects modified since last snapshot, the first one is always complete
+            std::set<std::string> pads;
+            ReducePadSnapshot(*snap, conn, pads, conn.fSendVersion == 0);
+            for (auto iter = conn.fPadHashes.begin(); iter != conn.fPadHashes.end();)
+               iter = pads.count(iter->first) ? std::next(iter) : conn.fPadHashes.erase(iter);
+
             auto json = TBufferJSON::ToJSON(snap, fJsonComp);
             auto hash = json.Hash();
             if (conn.fLastSendHash && (conn.fLastSendHash == hash)) {
@@ -48,6 +48,7 @@ struct Foption_t {
    int Robust;      // "ROB" or "H":  For a TGraph use robust fitting
    int StoreResult; // "S": Stores the result in a TFitResult structure
    int BinVolume;   // "WIDTH": scale content by the bin width/volume
+   int Vectorized;  // "VEC": evaluate a formula-based model function on SIMD vectors of points
    double hRobust;  //  value of h parameter used in robust fitting
    ROOT::EExecutionPolicy ExecPolicy;  //  Choose the execution Policy: "SERIAL", "MULTITHREAD" or "MULTIPROCESS"
 
@@ -74,6 +75,7 @@ struct Foption_t {
       Robust       (0),
       StoreResult  (0),
       BinVolume    (0),
+      Vectorized   (0),
       hRobust      (0),
       ExecPolicy   (ROOT::EExecutionPolicy::kSequential)
    {}
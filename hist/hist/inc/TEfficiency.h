@@ -58,6 +58,9 @@ protected:
       TH1*          fTotalHistogram;         ///<  Histogram for total number of events
       Double_t      fWeight;                 ///<  Weight for all events (default = 1)
 
+      struct TIntervalCache;
+      TIntervalCache* fIntervalCache = NewIntervalCache(); ///<! Confidence intervals of the bins already computed
+
       enum EStatusBits {
          kIsBayesian       = BIT(14),  ///< Bayesian statistics are used
          kPosteriorMode    = BIT(15),  ///< Use posterior mean for best estimate (Bayesian statistics)
@@ -70,6 +73,13 @@ protected:
       void          FillGraph(TGraphAsymmErrors * graph, Option_t * opt) const;
       void          FillHistogram(TH2 * h2) const;
 
+      static TIntervalCache* NewIntervalCache();
+      void          CacheIntervals() const;
+      Double_t      ComputeEfficiencyErrorLow(Int_t bin) const;
+      Double_t      ComputeEfficiencyErrorUp(Int_t bin) const;
+      void          GetEfficiencyErrors(Int_t bin, Double_t &low, Double_t &up) const;
+      void          InvalidateIntervals();
+
 public:
       TEfficiency();
       TEfficiency(const TH1& passed,const TH1& total);
@@ -100,6 +110,8 @@ public:
       void  ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
       void          Fill(Bool_t bPassed,Double_t x,Double_t y=0,Double_t z=0);
       void          FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_t y=0,Double_t z=0);
+      void          FillN(Int_t n,const Bool_t* passed,const Double_t* x,const Double_t* y=nullptr,
+                          const Double_t* z=nullptr,const Double_t* w=nullptr);
       Int_t         FindFixBin(Double_t x,Double_t y=0,Double_t z=0) const;
       TFitResultPtr Fit(TF1* f1,Option_t* opt="");
       // use trick of -1 to return global parameters
@@ -22,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "RConfigure.h"
+#include "ROOT/RSpan.hxx"
 #include <functional>
 #include <cassert>
 #include <string>
@@ -214,6 +215,7 @@ class TF1 : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    template<class Func>
    friend struct ROOT::Internal::TF1Builder;
+   friend class TF1Sampler;
 
 public:
    /// Add to list behavior
@@ -438,6 +440,11 @@ public:
    //template <class T> T Eval(T x, T y = 0, T z = 0, T t = 0) const;
    virtual Double_t EvalPar(const Double_t *x, const Double_t *params = nullptr);
    template <class T> T EvalPar(const T *x, const Double_t *params = nullptr);
+   void     EvalBatch(std::span<const Double_t> x, std::span<Double_t> out, const Double_t *params = nullptr);
+   void     EvalBatch(std::span<const Double_t> x, std::span<const Double_t> y, std::span<Double_t> out,
+                      const Double_t *params = nullptr);
+   void     EvalBatch(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> z,
+                      std::span<Double_t> out, const Double_t *params = nullptr);
    virtual Double_t operator()(Double_t x, Double_t y = 0, Double_t z = 0, Double_t t = 0) const;
    template <class T> T operator()(const T *x, const Double_t *params = nullptr);
    void     ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
@@ -712,6 +719,9 @@ private:
    template <class T>
    T EvalParTempl(const T *data, const Double_t *params = 0);
 
+   void DoEvalBatch(std::size_t n, const Double_t *const *coords, Int_t ncoords, Double_t *out,
+                    const Double_t *params);
+
 #ifdef R__HAS_VECCORE
    inline double EvalParVec(const Double_t *data, const Double_t *params);
 #endif
@@ -0,0 +1,46 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TF1Sampler
+#define ROOT_TF1Sampler
+
+#include "RtypesCore.h"
+#include "ROOT/RSpan.hxx"
+
+#include <vector>
+
+class TF1;
+class TRandom;
+
+class TF1Sampler {
+
+private:
+   Int_t fNpx = 0;                  ///< Number of bins of the tabulated cumulative distribution
+   Bool_t fLogBins = kFALSE;        ///< Whether the bins are in log10(x)
+   std::vector<Double_t> fIntegral; ///< Normalized cumulative integral at the bin edges
+   std::vector<Double_t> fAlpha;    ///< In each bin the inverse of the cumulative distribution is approximated
+   std::vector<Double_t> fBeta;     ///< by x = alpha + y, with beta*y + gamma/2*y**2 = r - fIntegral[bin]
+   std::vector<Double_t> fGamma;
+   std::vector<Int_t> fGuide;       ///< First bin to search for the random numbers in [k/fNpx, (k+1)/fNpx)
+
+   Double_t Quantile(Double_t r) const;
+
+public:
+   explicit TF1Sampler(TF1 &f, Option_t *option = nullptr);
+
+   /// Whether the cumulative distribution could be tabulated, i.e. whether the integral of the function is not zero
+   Bool_t IsValid() const { return !fIntegral.empty(); }
+   Int_t GetNpx() const { return fNpx; }
+
+   Double_t GetRandom(TRandom &rng) const;
+   void GetRandom(std::span<Double_t> out, TRandom &rng) const;
+};
+
+#endif
@@ -0,0 +1,54 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGraphInterpolator
+#define ROOT_TGraphInterpolator
+
+#include "RtypesCore.h"
+#include "ROOT/RSpan.hxx"
+
+#include <vector>
+
+class TGraph;
+
+class TGraphInterpolator {
+
+public:
+   enum class EMethod {
+      kLinear, ///< Linear interpolation between the two points around x, as TGraph::Eval(x)
+      kSpline  ///< Cubic spline through the points, as TGraph::Eval(x, nullptr, "S")
+   };
+
+private:
+   EMethod fMethod = EMethod::kLinear;
+   std::vector<Double_t> fX; ///< Abscissae of the points, in increasing order
+   std::vector<Double_t> fY; ///< Ordinates of the points, or values of the spline at the knots fX
+   std::vector<Double_t> fB; ///< Spline coefficients, y = fY + dx * (fB + dx * (fC + dx * fD)) with dx = x - fX
+   std::vector<Double_t> fC;
+   std::vector<Double_t> fD;
+
+   Int_t LowerBound(Double_t x) const;
+   Double_t EvalAt(Double_t x, Int_t lowerBound) const;
+
+public:
+   explicit TGraphInterpolator(const TGraph &graph, EMethod method = EMethod::kLinear);
+
+   EMethod GetMethod() const { return fMethod; }
+   Int_t GetN() const { return fX.size(); }
+
+   Double_t Eval(Double_t x) const;
+   void Eval(std::span<const Double_t> x, std::span<Double_t> y) const;
+
+   Double_t operator()(Double_t x) const { return Eval(x); }
+   /// Evaluate at x[0], with the signature of the functions of a TF1
+   Double_t operator()(const Double_t *x, const Double_t * = nullptr) const { return Eval(x[0]); }
+};
+
+#endif
@@ -0,0 +1,73 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH1ConcurrentFill
+#define ROOT_TH1ConcurrentFill
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+class TH1;
+class TH1ConcurrentFiller;
+
+class TH1ConcurrentFillManager {
+
+private:
+   friend class TH1ConcurrentFiller;
+
+   TH1 &fHist;
+   std::mutex fFillMutex; ///< Serializes the fills of the buffers of the fillers
+
+   void FillN(std::size_t n, const Double_t *coords, const Double_t *weights);
+
+public:
+   explicit TH1ConcurrentFillManager(TH1 &hist);
+
+   TH1ConcurrentFiller MakeFiller(std::size_t bufferSize = 1024);
+
+   TH1 &GetHist() const { return fHist; }
+};
+
+class TH1ConcurrentFiller {
+
+private:
+   TH1ConcurrentFillManager *fManager;
+   Int_t fNDim;                   ///< Dimension of the histogram
+   std::size_t fBufferSize;       ///< Number of fills buffered before filling the histogram
+   std::vector<Double_t> fCoords; ///< Coordinates of the buffered fills, fNDim per fill
+   std::vector<Double_t> fWeights;
+
+   void Push(const Double_t *coords, Double_t w);
+
+public:
+   TH1ConcurrentFiller(TH1ConcurrentFillManager &manager, std::size_t bufferSize = 1024);
+   TH1ConcurrentFiller(TH1ConcurrentFiller &&other);
+   TH1ConcurrentFiller(const TH1ConcurrentFiller &) = delete;
+   TH1ConcurrentFiller &operator=(const TH1ConcurrentFiller &) = delete;
+   TH1ConcurrentFiller &operator=(TH1ConcurrentFiller &&) = delete;
+   ~TH1ConcurrentFiller() { Flush(); }
+
+   /// \name Fill interface
+   /// The arguments are interpreted as in the Fill methods of the histogram: for a TH2,
+   /// Fill(x, y) fills (x, y) with weight 1, while for a TH1 it fills x with weight y.
+   ///@{
+   void Fill(Double_t x);
+   void Fill(Double_t x, Double_t y);
+   void Fill(Double_t x, Double_t y, Double_t z);
+   void Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+   ///@}
+
+   void Flush();
+};
+
+#endif
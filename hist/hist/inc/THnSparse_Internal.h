@@ -23,6 +23,8 @@
 
 #include "TObject.h"
 
+#include <vector>
+
 class TBrowser;
 class TH1;
 class THnSparse;
@@ -66,5 +68,45 @@ class THnSparseArrayChunk: public TObject {
 
    ClassDefOverride(THnSparseArrayChunk, 1); // chunks of linearized bins
 };
+
+/// Hash table from the hash of the compact coordinates of the filled bins to their linear index.
+/// It uses open addressing with linear probing, with at least twice as many slots as bins, such that
+/// a lookup usually reads a single cache line. Several bins can have the same hash if their compact
+/// coordinates do not fit into 8 bytes; Find() then checks the candidates with the predicate "matches".
+class THnSparseBinIndex {
+ private:
+   struct Slot {
+      ULong64_t fHash;
+      Long64_t fIndex; ///< Linear bin index + 1, 0 for an empty slot
+   };
+   std::vector<Slot> fSlots; ///< Number of slots is a power of 2
+   Long64_t fSize = 0;       ///< Number of bins in the table
+   Int_t fShift = 64;        ///< 64 - log2(number of slots)
+
+   /// Slot where the search for hash starts: the hash is mixed (Fibonacci hashing) because the
+   /// compact coordinates used as hash are far from uniformly distributed.
+   ULong64_t FirstSlot(ULong64_t hash) const { return (hash * 0x9E3779B97F4A7C15ULL) >> fShift; }
+   void Insert(ULong64_t hash, Long64_t index);
+
+ public:
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetMemorySize() const { return fSlots.size() * sizeof(Slot); }
+   void Clear();
+   void Reserve(Long64_t nbins);
+   void Add(ULong64_t hash, Long64_t index);
+
+   /// Return the linear index of the bin with the given hash for which matches(index) is true, -1 if none.
+   template <class MATCHES>
+   Long64_t Find(ULong64_t hash, MATCHES &&matches) const {
+      if (fSlots.empty())
+         return -1;
+      const ULong64_t mask = fSlots.size() - 1;
+      for (ULong64_t i = FirstSlot(hash); fSlots[i].fIndex; i = (i + 1) & mask) {
+         if (fSlots[i].fHash == hash && matches(fSlots[i].fIndex - 1))
+            return fSlots[i].fIndex - 1;
+      }
+      return -1;
+   }
+};
 #endif // ROOT_THnSparse_Internal
 
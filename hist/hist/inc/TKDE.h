@@ -17,9 +17,12 @@
 
 #include "Math/Math.h"
 
+#include "ROOT/RSpan.hxx"
+
 #include <string>
 #include <vector>
 #include <memory>
+#include <limits>
 
 class TGraphErrors;
 class TF1;
@@ -130,6 +133,7 @@ public:
    Double_t operator()(const Double_t* x, const Double_t* p = nullptr) const;  // Needed for creating TF1
 
    Double_t GetValue(Double_t x) const { return (*this)(x); }
+   void GetValues(std::span<const Double_t> x, std::span<Double_t> values) const;
    Double_t GetError(Double_t x) const;
 
    Double_t GetBias(Double_t x) const;
@@ -164,6 +168,10 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      Double_t fMaxWeight;            ///< Largest kernel weight, giving the range of data contributing to the estimate
+      Bool_t fUseSupport;             ///< Sum only over the data within the kernel support (for kernels of finite support)
+      std::vector<Double_t> fSortedData; ///< Data in increasing order, empty if the data are already sorted
+      std::vector<UInt_t> fSortedIndex;  ///< Indices in the data of the values of fSortedData
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
@@ -254,6 +262,17 @@ private:
    inline Double_t CosineArchKernel(Double_t x) const {
       return (x > -1. &&  x < 1.) ? M_PI_4 * std::cos(M_PI_2 * x) : 0.0;
    }
+
+   /// Returns the half width of the support of the kernel function, infinite for user defined kernels
+   inline Double_t KernelSupport() const {
+      switch (fKernelType) {
+         case kGaussian : return 9.;
+         case kEpanechnikov :
+         case kBiweight :
+         case kCosineArch : return 1.;
+         default : return std::numeric_limits<Double_t>::infinity();
+      }
+   }
    Double_t UpperConfidenceInterval(const Double_t* x, const Double_t* p) const; ///< Valid if the bandwidth is small compared to nEvents**1/5
    Double_t LowerConfidenceInterval(const Double_t* x, const Double_t* p) const; ///< Valid if the bandwidth is small compared to nEvents**1/5
    Double_t ApproximateBias(const Double_t* x, const Double_t* ) const { return GetBias(*x); }
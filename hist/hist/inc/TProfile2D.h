@@ -105,6 +105,9 @@ public:
    virtual Int_t     Fill(const char *namex, Double_t y, Double_t z, Double_t w = 1.);
    virtual Int_t     Fill(const char *namex, const char *namey, Double_t z, Double_t w = 1.);
    virtual Int_t     Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+   using TH2::FillN;
+   virtual void      FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w,
+                           Int_t stride = 1);
    Double_t  GetBinContent(Int_t bin) const override;
    Double_t  GetBinContent(Int_t binx, Int_t biny) const override {return GetBinContent(GetBin(binx,biny));}
    Double_t  GetBinContent(Int_t binx, Int_t biny, Int_t) const override {return GetBinContent(GetBin(binx,biny));}
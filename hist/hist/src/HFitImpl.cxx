@@ -230,6 +230,35 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
    }
 
 
+   // with option VEC switch a formula-based function to the vectorized signature for the time of the fit, when
+   // the objective function can be evaluated on SIMD vectors of points
+   bool setVectorized = false;
+#ifdef R__HAS_VECCORE
+   if (fitOption.Vectorized && !linear && !fitOption.Gradient && !(fitOption.User && TVirtualFitter::GetFitter()) &&
+       f1->GetFormula() && !f1->IsVectorized()) {
+      std::string minimType = minOption.MinimizerType();
+      bool vecSupported = !opt.fIntegral && !opt.fExpErrors && !opt.fBinVolume && (fitOption.Like & 2) == 0 &&
+                          minimType != "Fumili" && minimType != "Fumili2" && minimType != "GSLMultiFit" &&
+                          fitdata->GetErrorType() != ROOT::Fit::BinData::kCoordError &&
+                          fitdata->GetErrorType() != ROOT::Fit::BinData::kAsymError;
+      if (vecSupported) {
+         f1->SetVectorized(true);
+         setVectorized = f1->GetFormula()->IsVectorized();
+         if (setVectorized && !f1->GetFormula()->IsValid()) {
+            Warning("Fit", "Cannot compile the vectorized version of the function %s - fit in scalar mode",
+                    f1->GetName());
+            f1->SetVectorized(false);
+            setVectorized = false;
+         }
+      } else if (!fitOption.Quiet) {
+         Info("Fit", "Ignore option VEC: the vectorized evaluation is not supported with the requested fit options");
+      }
+   }
+#else
+   if (fitOption.Vectorized && !fitOption.Quiet)
+      Info("Fit", "Ignore option VEC: ROOT is built without VecCore support");
+#endif
+
    // set the fit function
    // if option grad is specified use gradient
    if ( (linear || fitOption.Gradient) )
@@ -374,6 +403,9 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
       Warning("Fit","Abnormal termination of minimization.");
    iret |= !fitok;
 
+   // the stored function and the later evaluations use again the scalar signature
+   if (setVectorized) f1->SetVectorized(false);
+
 
    const ROOT::Fit::FitResult & fitResult = fitter->Result();
    // one could set directly the fit result in TF1
@@ -709,6 +741,12 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
             opt.ReplaceAll("WIDTH","");
       }
 
+      // must be parsed before the "V", "E" and "C" options
+      if (opt.Contains("VEC")) {
+         fitOption.Vectorized = 1;
+         opt.ReplaceAll("VEC","");
+      }
+
       // if (opt.Contains("MULTIPROC")) {
       //    fitOption.ExecPolicy = ROOT::Fit::kMultiprocess;
       //    opt.ReplaceAll("MULTIPROC","");
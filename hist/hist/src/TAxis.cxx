@@ -434,6 +434,48 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers of the n abscissas x[0], x[stride], ... x[(n-1)*stride] and store them in bins.
+///
+/// The bins are the ones returned by TAxis::FindFixBin. The bins are computed in a loop without branches
+/// for fixed bins, and with a binary search without branches for variable bin sizes, which are faster than
+/// successive calls to FindFixBin.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t stride, Int_t *bins) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   const Int_t nbins = fNbins;
+   if (!fXbins.fN) {
+      const Double_t width = xmax - xmin;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         // use xmin in the bin computation of underflows and overflows to avoid an undefined conversion to int
+         const Bool_t inRange = (xi >= xmin) && (xi < xmax);
+         const Int_t bin = 1 + Int_t(nbins * ((inRange) ? xi - xmin : 0.) / width);
+         bins[i] = (inRange) ? bin : ((xi < xmin) ? 0 : nbins + 1);
+      }
+   } else {
+      const Double_t *edges = fXbins.fArray;
+      const Long64_t nedges = fXbins.fN;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         // same as std::lower_bound, as in TMath::BinarySearch
+         const Double_t *base = edges;
+         Long64_t len = nedges;
+         while (len > 1) {
+            const Long64_t half = len / 2;
+            base = (base[half] < xi) ? base + half : base;
+            len -= half;
+         }
+         const Double_t *first = base + (*base < xi);
+         const Long64_t index = (first != edges + nedges && *first == xi) ? first - edges : first - edges - 1;
+         const Bool_t inRange = (xi >= xmin) && (xi < xmax);
+         bins[i] = (inRange) ? Int_t(1 + index) : ((xi < xmin) ? 0 : nbins + 1);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
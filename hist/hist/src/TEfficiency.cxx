@@ -7,6 +7,7 @@
 #include <cmath>
 #include <stdlib.h>
 #include <cassert>
+#include <mutex>
 
 //ROOT headers
 #include "Math/DistFuncMathCore.h"
@@ -25,6 +26,10 @@
 #include "TError.h"
 #include "Math/BrentMinimizer1D.h"
 #include "Math/WrappedFunction.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
 
 //custom headers
 #include "TEfficiency.h"
@@ -39,6 +44,44 @@ const Double_t kDefConfLevel = 0.682689492137; // 1 sigma
 const TEfficiency::EStatOption kDefStatOpt = TEfficiency::kFCP;
 const Double_t kDefWeight = 1;
 
+////////////////////////////////////////////////////////////////////////////////
+/// The lower and upper errors of the bins for which they were computed, with the
+/// statistic options they were computed for. The methods changing the contents of
+/// the histograms mark the cache stale; a change of the options is detected when
+/// the cache is used.
+
+struct TEfficiency::TIntervalCache {
+   std::mutex fMutex;
+   Bool_t fStale = true;
+   EStatOption fStatisticOption = kDefStatOpt;
+   Double_t fConfLevel = 0;
+   Double_t fBetaAlpha = 0;
+   Double_t fBetaBeta = 0;
+   Int_t fBits = 0;
+   std::vector<Double_t> fLow;
+   std::vector<Double_t> fUp;
+   std::vector<char> fIsCached;
+
+   /// Drop the errors if they were not computed for the current contents and options of eff
+   void Sync(const TEfficiency &eff)
+   {
+      const Int_t bits = eff.TestBits(kIsBayesian | kPosteriorMode | kShortestInterval | kUseBinPrior | kUseWeights);
+      const std::size_t ncells = eff.fTotalHistogram->GetNcells();
+      if (!fStale && fStatisticOption == eff.fStatisticOption && fConfLevel == eff.fConfLevel &&
+          fBetaAlpha == eff.fBeta_alpha && fBetaBeta == eff.fBeta_beta && fBits == bits && fIsCached.size() == ncells)
+         return;
+      fStale = false;
+      fStatisticOption = eff.fStatisticOption;
+      fConfLevel = eff.fConfLevel;
+      fBetaAlpha = eff.fBeta_alpha;
+      fBetaBeta = eff.fBeta_beta;
+      fBits = bits;
+      fLow.assign(ncells, 0.);
+      fUp.assign(ncells, 0.);
+      fIsCached.assign(ncells, 0);
+   }
+};
+
 ClassImp(TEfficiency);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -139,6 +182,7 @@ You can fill the TEfficiency object by calling the TEfficiency::Fill(Bool_t bPas
 The "bPassed" boolean flag indicates whether the current event is good
 (both histograms are filled) or not (only TEfficiency::fTotalHistogram is filled).
 The x, y and z variables determine the bin which is filled. For lower dimensions, the z- or even the y-value may be omitted.
+Arrays of events can be filled at once with TEfficiency::FillN, where an array of flags tells which events passed.
 
 Begin_Macro(source)
 {
@@ -1050,6 +1094,7 @@ TEfficiency::~TEfficiency()
    delete fPassedHistogram;
    delete fPaintGraph;
    delete fPaintHisto;
+   delete fIntervalCache;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1608,6 +1653,78 @@ TGraphAsymmErrors * TEfficiency::CreateGraph(Option_t * opt) const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create the empty cache of the confidence intervals of a new TEfficiency
+
+TEfficiency::TIntervalCache* TEfficiency::NewIntervalCache()
+{
+   return new TIntervalCache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the errors of all the bins which are not cached yet
+///
+/// The bins are computed in parallel if the implicit multi-threading is enabled
+/// and there are enough of them.
+
+void TEfficiency::CacheIntervals() const
+{
+   std::lock_guard<std::mutex> lock(fIntervalCache->fMutex);
+   TIntervalCache &cache = *fIntervalCache;
+   cache.Sync(*this);
+   auto computeBin = [&](Int_t bin) {
+      if (cache.fIsCached[bin])
+         return;
+      cache.fLow[bin] = ComputeEfficiencyErrorLow(bin);
+      cache.fUp[bin] = ComputeEfficiencyErrorUp(bin);
+      cache.fIsCached[bin] = 1;
+   };
+   const Int_t ncells = cache.fIsCached.size();
+#ifdef R__USE_IMT
+   // the errors of weighted events switch a frequentist option to kFNormal, which must not happen concurrently
+   const bool switchesOption = TestBit(kUseWeights) && !TestBit(kIsBayesian) && fStatisticOption != kFNormal;
+   constexpr Int_t kMinParallelCells = 1000;
+   if (ROOT::IsImplicitMTEnabled() && ncells >= kMinParallelCells && !switchesOption) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(computeBin, ROOT::TSeqI(ncells));
+      return;
+   }
+#endif
+   for (Int_t bin = 0; bin < ncells; ++bin)
+      computeBin(bin);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the lower and upper errors in the given global bin, computing them
+/// only if they are not cached for the current contents and options
+
+void TEfficiency::GetEfficiencyErrors(Int_t bin, Double_t &low, Double_t &up) const
+{
+   if (bin < 0 || bin >= fTotalHistogram->GetNcells()) {
+      low = ComputeEfficiencyErrorLow(bin);
+      up = ComputeEfficiencyErrorUp(bin);
+      return;
+   }
+   std::lock_guard<std::mutex> lock(fIntervalCache->fMutex);
+   TIntervalCache &cache = *fIntervalCache;
+   cache.Sync(*this);
+   if (!cache.fIsCached[bin]) {
+      cache.fLow[bin] = ComputeEfficiencyErrorLow(bin);
+      cache.fUp[bin] = ComputeEfficiencyErrorUp(bin);
+      cache.fIsCached[bin] = 1;
+   }
+   low = cache.fLow[bin];
+   up = cache.fUp[bin];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Mark the cached errors stale, after the contents of the histograms changed
+
+void TEfficiency::InvalidateIntervals()
+{
+   fIntervalCache->fStale = true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill the graph to be painted with information from TEfficiency
 /// Internal method called by TEfficiency::Paint or TEfficiency::CreateGraph
@@ -1634,14 +1751,14 @@ void TEfficiency::FillGraph(TGraphAsymmErrors * graph, Option_t * opt) const
    double * eyl = graph->GetEYlow();
    double * eyh = graph->GetEYhigh();
    Int_t npoints = fTotalHistogram->GetNbinsX();
+   CacheIntervals();
    for (Int_t i = 0; i < npoints; ++i) {
       if (!plot0Bins && fTotalHistogram->GetBinContent(i+1) == 0 )    continue;
       x = fTotalHistogram->GetBinCenter(i+1);
       y = GetEfficiency(i+1);
       xlow = fTotalHistogram->GetBinCenter(i+1) - fTotalHistogram->GetBinLowEdge(i+1);
       xup = fTotalHistogram->GetBinWidth(i+1) - xlow;
-      ylow = GetEfficiencyErrorLow(i+1);
-      yup = GetEfficiencyErrorUp(i+1);
+      GetEfficiencyErrors(i+1,ylow,yup);
       // in the case the graph already existed and extra points have been added
       if (j >= graph->GetN() ) {
          graph->SetPoint(j,x,y);
@@ -2281,6 +2398,7 @@ void TEfficiency::Fill(Bool_t bPassed,Double_t x,Double_t y,Double_t z)
             ((TH3*)(fPassedHistogram))->Fill(x,y,z);
          break;
    }
+   InvalidateIntervals();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2321,6 +2439,69 @@ void TEfficiency::FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_
             ((TH3*)(fPassedHistogram))->Fill(x,y,z,weight);
          break;
    }
+   InvalidateIntervals();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// This function is used for filling the two histograms with an array of events.
+///
+/// \param[in] n number of events
+/// \param[in] passed flags whether the events passed the selection
+/// \param[in] x x-values
+/// \param[in] y y-values (required for 2-D and 3-D efficiencies)
+/// \param[in] z z-values (required for 3-D efficiencies)
+/// \param[in] w weights of the events (default: no weights)
+///
+/// The events are filled with TH1::FillN / TH2::FillN, which avoids the
+/// overhead of calling Fill for each event.
+///
+/// Note: - if weights are given, this function will call SetUseWeightedEvents
+///         if it was not called by the user before
+
+void TEfficiency::FillN(Int_t n,const Bool_t* passed,const Double_t* x,const Double_t* y,
+                        const Double_t* z,const Double_t* w)
+{
+   const Int_t dim = GetDimension();
+   if((dim > 1 && !y) || (dim > 2 && !z)) {
+      Error("FillN","the coordinates of the events of a %d-d efficiency are missing",dim);
+      return;
+   }
+   if(w && !TestBit(kUseWeights))
+      SetUseWeightedEvents();
+
+   // the coordinates and weights of the passed events
+   std::vector<Double_t> px, py, pz, pw;
+   for(Int_t i = 0; i < n; ++i) {
+      if(!passed[i])
+         continue;
+      px.push_back(x[i]);
+      if(dim > 1)
+         py.push_back(y[i]);
+      if(dim > 2)
+         pz.push_back(z[i]);
+      if(w)
+         pw.push_back(w[i]);
+   }
+   const Int_t npassed = px.size();
+   const Double_t* passedW = w ? pw.data() : nullptr;
+
+   switch(dim) {
+      case 1:
+         fTotalHistogram->FillN(n,x,w);
+         fPassedHistogram->FillN(npassed,px.data(),passedW);
+         break;
+      case 2:
+         ((TH2*)(fTotalHistogram))->FillN(n,x,y,w);
+         ((TH2*)(fPassedHistogram))->FillN(npassed,px.data(),py.data(),passedW);
+         break;
+      case 3:
+         for(Int_t i = 0; i < n; ++i)
+            ((TH3*)(fTotalHistogram))->Fill(x[i],y[i],z[i],w ? w[i] : 1.);
+         for(Int_t i = 0; i < npassed; ++i)
+            ((TH3*)(fPassedHistogram))->Fill(px[i],py[i],pz[i],w ? pw[i] : 1.);
+         break;
+   }
+   InvalidateIntervals();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2528,10 +2709,24 @@ Double_t TEfficiency::GetEfficiency(Int_t bin) const
 /// chosen statistic option fStatisticOption. See SetStatisticOption(Int_t) for
 /// more details.
 ///
+/// The errors of a bin are computed once, and cached until the contents of the
+/// histograms or the statistic options change.
+///
 /// Note: If the histograms are filled with weights, only bayesian methods and the
 ///       normal approximation are supported.
 
 Double_t TEfficiency::GetEfficiencyErrorLow(Int_t bin) const
+{
+   Double_t low, up;
+   GetEfficiencyErrors(bin,low,up);
+   return low;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the lower error on the efficiency in the given global bin, without
+/// using the cached errors
+
+Double_t TEfficiency::ComputeEfficiencyErrorLow(Int_t bin) const
 {
    Double_t total = fTotalHistogram->GetBinContent(bin);
    Double_t passed = fPassedHistogram->GetBinContent(bin);
@@ -2608,10 +2803,24 @@ Double_t TEfficiency::GetEfficiencyErrorLow(Int_t bin) const
 /// chosen statistic option fStatisticOption. See SetStatisticOption(Int_t) for
 /// more details.
 ///
+/// The errors of a bin are computed once, and cached until the contents of the
+/// histograms or the statistic options change.
+///
 /// Note: If the histograms are filled with weights, only bayesian methods and the
 ///       normal approximation are supported.
 
 Double_t TEfficiency::GetEfficiencyErrorUp(Int_t bin) const
+{
+   Double_t low, up;
+   GetEfficiencyErrors(bin,low,up);
+   return up;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the upper error on the efficiency in the given global bin, without
+/// using the cached errors
+
+Double_t TEfficiency::ComputeEfficiencyErrorUp(Int_t bin) const
 {
    Double_t total = fTotalHistogram->GetBinContent(bin);
    Double_t passed = fPassedHistogram->GetBinContent(bin);
@@ -2805,6 +3014,7 @@ TEfficiency& TEfficiency::operator+=(const TEfficiency& rhs)
 
    fTotalHistogram->Add(rhs.fTotalHistogram);
    fPassedHistogram->Add(rhs.fPassedHistogram);
+   InvalidateIntervals();
 
    SetWeight((fWeight * rhs.GetWeight())/(fWeight + rhs.GetWeight()));
 
@@ -2845,6 +3055,7 @@ TEfficiency& TEfficiency::operator=(const TEfficiency& rhs)
          fTotalHistogram = (TH1*)(rhs.fTotalHistogram->Clone());
          fPassedHistogram = (TH1*)(rhs.fPassedHistogram->Clone());
       }
+      InvalidateIntervals();
       //delete temporary paint objects
       delete fPaintHisto;
       delete fPaintGraph;
@@ -3162,6 +3373,7 @@ void TEfficiency::SetBetaBinParameters(Int_t bin, Double_t alpha, Double_t beta)
    // vector contains also values for under/overflows
    fBeta_bin_params[bin] = std::make_pair(alpha,beta);
    SetBit(kUseBinPrior,true);
+   InvalidateIntervals();
 
 }
 
@@ -3182,6 +3394,7 @@ Bool_t TEfficiency::SetBins(Int_t nx, Double_t xmin, Double_t xmax)
    }
    fPassedHistogram->SetBins(nx,xmin,xmax);
    fTotalHistogram->SetBins(nx,xmin,xmax);
+   InvalidateIntervals();
    return kTRUE;
 }
 
@@ -3202,6 +3415,7 @@ Bool_t TEfficiency::SetBins(Int_t nx, const Double_t *xBins)
    }
    fPassedHistogram->SetBins(nx,xBins);
    fTotalHistogram->SetBins(nx,xBins);
+   InvalidateIntervals();
    return kTRUE;
 }
 
@@ -3222,6 +3436,7 @@ Bool_t TEfficiency::SetBins(Int_t nx, Double_t xmin, Double_t xmax, Int_t ny, Do
    }
    fPassedHistogram->SetBins(nx,xmin,xmax,ny,ymin,ymax);
    fTotalHistogram->SetBins(nx,xmin,xmax,ny,ymin,ymax);
+   InvalidateIntervals();
    return kTRUE;
 }
 
@@ -3242,6 +3457,7 @@ Bool_t TEfficiency::SetBins(Int_t nx, const Double_t *xBins, Int_t ny, const Dou
    }
    fPassedHistogram->SetBins(nx,xBins,ny,yBins);
    fTotalHistogram->SetBins(nx,xBins,ny,yBins);
+   InvalidateIntervals();
    return kTRUE;
 }
 
@@ -3263,6 +3479,7 @@ Bool_t TEfficiency::SetBins(Int_t nx, Double_t xmin, Double_t xmax, Int_t ny, Do
    }
    fPassedHistogram->SetBins(nx,xmin,xmax,ny,ymin,ymax,nz,zmin,zmax);
    fTotalHistogram->SetBins (nx,xmin,xmax,ny,ymin,ymax,nz,zmin,zmax);
+   InvalidateIntervals();
    return kTRUE;
 }
 
@@ -3284,6 +3501,7 @@ Bool_t TEfficiency::SetBins(Int_t nx, const Double_t *xBins, Int_t ny, const Dou
    }
    fPassedHistogram->SetBins(nx,xBins,ny,yBins,nz,zBins);
    fTotalHistogram->SetBins(nx,xBins,ny,yBins,nz,zBins);
+   InvalidateIntervals();
    return kTRUE;
 }
 
@@ -3350,6 +3568,7 @@ Bool_t TEfficiency::SetPassedEvents(Int_t bin,Int_t events)
 {
    if(events <= fTotalHistogram->GetBinContent(bin)) {
       fPassedHistogram->SetBinContent(bin,events);
+      InvalidateIntervals();
       return true;
    }
    else {
@@ -3544,6 +3763,7 @@ Bool_t TEfficiency::SetTotalEvents(Int_t bin,Int_t events)
 {
    if(events >= fPassedHistogram->GetBinContent(bin)) {
       fTotalHistogram->SetBinContent(bin,events);
+      InvalidateIntervals();
       return true;
    }
    else {
@@ -3616,6 +3836,7 @@ void TEfficiency::SetUseWeightedEvents(bool on)
       fTotalHistogram->Sumw2();
    if (on && fPassedHistogram->GetSumw2N() != fTotalHistogram->GetNcells() )
       fPassedHistogram->Sumw2();
+   InvalidateIntervals();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include "strlcpy.h"
 #include "snprintf.h"
@@ -1544,6 +1545,118 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a one-dimensional function at all the points of the array x and write the values in out.
+///
+/// This is equivalent to calling EvalPar for each point, but the evaluation mode is resolved once for the whole
+/// batch and vectorized functions (TF1::IsVectorized()) are evaluated on SIMD vectors of points.
+/// If params is omitted or equal 0, the current values of the parameters are used.
+
+void TF1::EvalBatch(std::span<const Double_t> x, std::span<Double_t> out, const Double_t *params)
+{
+   if (out.size() != x.size()) {
+      Error("EvalBatch", "The output array has size %zu, but %zu points are given", out.size(), x.size());
+      return;
+   }
+   const Double_t *coords[1] = {x.data()};
+   DoEvalBatch(x.size(), coords, 1, out.data(), params);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a two-dimensional function at the points (x[i], y[i]), see the one-dimensional version.
+
+void TF1::EvalBatch(std::span<const Double_t> x, std::span<const Double_t> y, std::span<Double_t> out,
+                    const Double_t *params)
+{
+   if (y.size() != x.size() || out.size() != x.size()) {
+      Error("EvalBatch", "The coordinate and output arrays have different sizes");
+      return;
+   }
+   const Double_t *coords[2] = {x.data(), y.data()};
+   DoEvalBatch(x.size(), coords, 2, out.data(), params);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a three-dimensional function at the points (x[i], y[i], z[i]), see the one-dimensional version.
+
+void TF1::EvalBatch(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> z,
+                    std::span<Double_t> out, const Double_t *params)
+{
+   if (y.size() != x.size() || z.size() != x.size() || out.size() != x.size()) {
+      Error("EvalBatch", "The coordinate and output arrays have different sizes");
+      return;
+   }
+   const Double_t *coords[3] = {x.data(), y.data(), z.data()};
+   DoEvalBatch(x.size(), coords, 3, out.data(), params);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at n points given by the arrays of coordinates coords[0], ..., coords[ncoords-1].
+
+void TF1::DoEvalBatch(std::size_t n, const Double_t *const *coords, Int_t ncoords, Double_t *out,
+                      const Double_t *params)
+{
+   if (fNdim > ncoords) {
+      Error("EvalBatch", "Function %s has dimension %d, but points with %d coordinates are given", GetName(), fNdim,
+            ncoords);
+      return;
+   }
+   if (!params)
+      params = GetParameters();
+   const Double_t norm = (fNormalized && fNormIntegral != 0) ? 1. / fNormIntegral : 1.;
+
+#ifdef R__HAS_VECCORE
+   const bool vecFormula = fType == EFType::kFormula && fFormula->IsVectorized();
+   if (vecFormula || (fType == EFType::kTemplVec && fFunctor)) {
+      constexpr std::size_t vecSize = vecCore::VectorSize<ROOT::Double_v>();
+      ROOT::Double_v xv[3];
+      for (std::size_t first = 0; first < n; first += vecSize) {
+         const std::size_t m = std::min(vecSize, n - first);
+         for (Int_t idim = 0; idim < ncoords; ++idim) {
+            if (m == vecSize) {
+               vecCore::Load<ROOT::Double_v>(xv[idim], coords[idim] + first);
+            } else {
+               // pad the last vector with copies of the last point
+               for (std::size_t k = 0; k < vecSize; ++k)
+                  vecCore::Set(xv[idim], k, coords[idim][first + std::min(k, m - 1)]);
+            }
+         }
+         ROOT::Double_v res =
+            vecFormula ? fFormula->EvalParVec(xv, params)
+                       : ((TF1FunctorPointerImpl<ROOT::Double_v> *)fFunctor.get())->fImpl(xv, (Double_t *)params);
+         for (std::size_t k = 0; k < m; ++k)
+            out[first + k] = norm * vecCore::Get(res, k);
+      }
+      return;
+   }
+#endif
+
+   Double_t xx[3];
+   if (fType == EFType::kFormula) {
+      for (std::size_t i = 0; i < n; ++i) {
+         for (Int_t idim = 0; idim < ncoords; ++idim)
+            xx[idim] = coords[idim][i];
+         out[i] = norm * fFormula->EvalPar(xx, params);
+      }
+   } else if ((fType == EFType::kPtrScalarFreeFcn || fType == EFType::kTemplScalar) && fFunctor) {
+      auto &func = ((TF1FunctorPointerImpl<Double_t> *)fFunctor.get())->fImpl;
+      for (std::size_t i = 0; i < n; ++i) {
+         for (Int_t idim = 0; idim < ncoords; ++idim)
+            xx[idim] = coords[idim][i];
+         out[i] = norm * func(xx, (Double_t *)params);
+      }
+   } else {
+      // interpreted, composite and saved functions: go through EvalPar, which also applies the normalization
+      InitArgs(xx, params);
+      for (std::size_t i = 0; i < n; ++i) {
+         for (Int_t idim = 0; idim < ncoords; ++idim)
+            xx[idim] = coords[idim][i];
+         out[i] = EvalPar(xx, params);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -3065,7 +3178,6 @@ void TF1::Paint(Option_t *choptin)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = 0;
 
@@ -3133,13 +3245,13 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    // Restore axis titles.
    histogram->GetXaxis()->SetTitle(xtitle.Data());
    histogram->GetYaxis()->SetTitle(ytitle.Data());
-   Double_t *parameters = GetParameters();
-
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   std::vector<Double_t> xbinCenters(fNpx);
+   std::vector<Double_t> fvalues(fNpx);
+   for (i = 1; i <= fNpx; i++)
+      xbinCenters[i - 1] = histogram->GetBinCenter(i);
+   EvalBatch(xbinCenters, fvalues);
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, fvalues[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -3214,12 +3326,10 @@ void TF1::Save(Double_t xmin, Double_t xmax, Double_t, Double_t, Double_t, Doubl
       xmin = fXmin + 0.5 * dx;
       xmax = fXmax - 0.5 * dx;
    }
-   Double_t xv[1];
-   InitArgs(xv, parameters);
-   for (Int_t i = 0; i <= fNpx; i++) {
-      xv[0]    = xmin + dx * i;
-      fSave[i] = EvalPar(xv, parameters);
-   }
+   std::vector<Double_t> xv(fNpx + 1);
+   for (Int_t i = 0; i <= fNpx; i++)
+      xv[i] = xmin + dx * i;
+   EvalBatch(xv, std::span<Double_t>(fSave.data(), fNpx + 1), parameters);
    fSave[fNpx + 1] = xmin;
    fSave[fNpx + 2] = xmax;
 }
@@ -0,0 +1,116 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TF1Sampler.h"
+#include "TF1.h"
+#include "TMath.h"
+#include "TRandom.h"
+
+#include <algorithm>
+#include <limits>
+
+/** \class TF1Sampler
+    \ingroup Functions
+Generate random numbers following the shape of a one-dimensional function.
+
+The sampler uses the same tabulated cumulative distribution and parabolic interpolation as TF1::GetRandom(), but
+the tables are copied in the sampler when it is constructed and the sampling methods are const. A sampler can
+therefore be shared by several threads, each using its own random number generator:
+
+~~~ {.cpp}
+TF1 f("f", "exp(-x) * x * x", 0, 20);
+const TF1Sampler sampler(f);
+// in each thread
+TRandomMixMax rng(seed);
+std::vector<double> values(1000000);
+sampler.GetRandom(values, rng);
+~~~
+
+The bin of the tabulated distribution containing a random number is found with a guide table instead of a binary
+search, so that the cost of a random number does not depend on the number of points TF1::GetNpx().
+The construction of the sampler is not thread safe, because it tabulates the integral of the function.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+/// Tabulate the cumulative distribution of the function f in its range, with f.GetNpx() bins.
+///
+/// @param f The function; its parameters are the ones at the time of the construction
+/// @param option "LOG" or "LIN" to force the usage of a log or linear scale for computing the cumulative
+///               integral table, see TF1::GetRandom()
+
+TF1Sampler::TF1Sampler(TF1 &f, Option_t *option)
+{
+   if (!f.ComputeCdfTable(option))
+      return;
+
+   fNpx = f.fNpx;
+   fLogBins = f.fAlpha[fNpx] > 0;
+   fIntegral = f.fIntegral;
+   fAlpha = f.fAlpha;
+   fBeta = f.fBeta;
+   fGamma = f.fGamma;
+
+   fGuide.resize(fNpx + 1);
+   Int_t bin = 0;
+   for (Int_t k = 0; k <= fNpx; ++k) {
+      const Double_t r = Double_t(k) / fNpx;
+      while (bin < fNpx - 1 && fIntegral[bin + 1] <= r)
+         ++bin;
+      fGuide[k] = bin;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the value x for which the approximated cumulative distribution is r.
+
+Double_t TF1Sampler::Quantile(Double_t r) const
+{
+   Int_t bin = fGuide[static_cast<Int_t>(r * fNpx)];
+   // same bin as TMath::BinarySearch(fNpx, fIntegral.data(), r)
+   while (bin > 0 && fIntegral[bin] > r)
+      --bin;
+   while (bin < fNpx - 1 && fIntegral[bin + 1] <= r)
+      ++bin;
+
+   const Double_t rr = r - fIntegral[bin];
+   Double_t yy;
+   if (fGamma[bin] != 0)
+      yy = (-fBeta[bin] + TMath::Sqrt(fBeta[bin] * fBeta[bin] + 2 * fGamma[bin] * rr)) / fGamma[bin];
+   else
+      yy = rr / fBeta[bin];
+   const Double_t x = fAlpha[bin] + yy;
+   return fLogBins ? TMath::Power(10, x) : x;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a random number following the function shape, generated with rng.
+
+Double_t TF1Sampler::GetRandom(TRandom &rng) const
+{
+   if (!IsValid())
+      return TMath::QuietNaN();
+   return Quantile(rng.Rndm());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill out with random numbers following the function shape, generated with rng.
+
+void TF1Sampler::GetRandom(std::span<Double_t> out, TRandom &rng) const
+{
+   if (!IsValid()) {
+      std::fill(out.begin(), out.end(), TMath::QuietNaN());
+      return;
+   }
+   constexpr std::size_t maxChunk = std::numeric_limits<Int_t>::max();
+   for (std::size_t first = 0; first < out.size(); first += maxChunk)
+      rng.RndmArray(static_cast<Int_t>(std::min(maxChunk, out.size() - first)), out.data() + first);
+   for (auto &x : out)
+      x = Quantile(x);
+}
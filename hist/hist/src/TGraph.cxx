@@ -922,6 +922,9 @@ void TGraph::DrawPanel()
 ///   If the points are sorted in X a binary search is used (significantly faster)
 ///   One needs to set the bit  TGraph::SetBit(TGraph::kIsSortedX) before calling
 ///   TGraph::Eval to indicate that the graph is sorted in X.
+///
+///   To evaluate a graph many times, use a TGraphInterpolator: it sorts the
+///   points and computes the spline coefficients only once.
 
 Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 {
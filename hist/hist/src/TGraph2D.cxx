@@ -30,6 +30,7 @@
 #include <cassert>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -540,7 +541,7 @@ TGraph2D::TGraph2D(const TGraph2D &g)
    (*this) = g;
 
    // append TGraph2D to gdirectory
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && !TDirectory::IsThreadDetached()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          // append without replacing existing objects
@@ -634,7 +635,7 @@ void TGraph2D::Build(Int_t n)
    fPainter   = 0;
    fUserHisto = kFALSE;
 
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && !TDirectory::IsThreadDetached()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          fDirectory->Append(this, kTRUE);
@@ -1099,18 +1100,29 @@ TH2D *TGraph2D::GetHistogram(Option_t *option)
 
    Double_t x, y, z;
 
-   for (Int_t ix = 1; ix <= fNpx; ix++) {
-      x  = hxmin + (ix - 0.5) * dx;
-      for (Int_t iy = 1; iy <= fNpy; iy++) {
-         y  = hymin + (iy - 0.5) * dy;
-         // do interpolation
-         if (oldInterp)
+   if (oldInterp) {
+      for (Int_t ix = 1; ix <= fNpx; ix++) {
+         x  = hxmin + (ix - 0.5) * dx;
+         for (Int_t iy = 1; iy <= fNpy; iy++) {
+            y  = hymin + (iy - 0.5) * dy;
+            // do interpolation
             z  = ((TGraphDelaunay*)fDelaunay)->ComputeZ(x, y);
-         else
-            z  = ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(x, y);
 
-         fHistogram->Fill(x, y, z);
+            fHistogram->Fill(x, y, z);
+         }
       }
+   } else {
+      // interpolate all the bin centres at once
+      std::vector<Double_t> xs(fNpx * fNpy), ys(fNpx * fNpy), zs(fNpx * fNpy);
+      for (Int_t ix = 1; ix <= fNpx; ix++) {
+         for (Int_t iy = 1; iy <= fNpy; iy++) {
+            xs[(ix - 1) * fNpy + iy - 1] = hxmin + (ix - 0.5) * dx;
+            ys[(ix - 1) * fNpy + iy - 1] = hymin + (iy - 0.5) * dy;
+         }
+      }
+      ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(xs.size(), xs.data(), ys.data(), zs.data());
+      for (std::size_t i = 0; i < zs.size(); i++)
+         fHistogram->Fill(xs[i], ys[i], zs[i]);
    }
 
 
@@ -1237,6 +1249,24 @@ Double_t TGraph2D::Interpolate(Double_t x, Double_t y)
    return TMath::QuietNaN();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Finds the z values z[i] at the n positions (x[i],y[i]) thanks to
+/// the Delaunay interpolation. With the default interpolation, the positions
+/// are interpolated in parallel when the implicit multi-threading is enabled.
+
+void TGraph2D::Interpolate(Int_t n, const Double_t *x, const Double_t *y, Double_t *z)
+{
+   if (n <= 0) return;
+
+   // the first position sets up the interpolation
+   z[0] = Interpolate(x[0], y[0]);
+   if (fDelaunay && fDelaunay->IsA() == TGraphDelaunay2D::Class()) {
+      ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(n - 1, x + 1, y + 1, z + 1);
+   } else {
+      for (Int_t i = 1; i < n; i++) z[i] = Interpolate(x[i], y[i]);
+   }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Paints this 2D graph with its current attributes
@@ -11,6 +11,7 @@
 
 #include "TGraph2D.h"
 #include "TGraphDelaunay2D.h"
+#include "TROOT.h"
 
 ClassImp(TGraphDelaunay2D);
 
@@ -56,3 +57,14 @@ TGraphDelaunay2D::TGraphDelaunay2D(TGraph2D *g ) :
 
 {}
 
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the z values of the n points (x[i],y[i]) into z[i]. The points
+/// are interpolated in parallel when the implicit multi-threading is enabled.
+
+void TGraphDelaunay2D::ComputeZ(Int_t n, const Double_t *x, const Double_t *y, Double_t *z)
+{
+   auto policy = ROOT::IsImplicitMTEnabled() ? ROOT::EExecutionPolicy::kMultiThread
+                                             : ROOT::EExecutionPolicy::kSequential;
+   fDelaunay.Interpolate(n, x, y, z, policy);
+}
+
@@ -0,0 +1,142 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TGraphInterpolator.h"
+#include "TError.h"
+#include "TGraph.h"
+#include "TSpline.h"
+
+#include <algorithm>
+#include <numeric>
+
+/** \class TGraphInterpolator
+    \ingroup Graphs
+Evaluate the interpolation of a TGraph many times.
+
+The interpolator copies the points of the graph sorted by their abscissae and, for the spline method, computes the
+coefficients of the TSpline3 through them once, when it is constructed. TGraph::Eval instead searches the points at
+each call, looping over all of them if the graph is not sorted, and builds a new spline at each call with option "S".
+
+~~~ {.cpp}
+const TGraphInterpolator calib(*graph, TGraphInterpolator::EMethod::kSpline);
+double y = calib(x);
+// batch evaluation, O(1) per point when the x are in increasing order
+calib.Eval(xs, ys);
+// as a function
+TF1 f("f", calib, graph->GetPointX(0), graph->GetPointX(graph->GetN() - 1), 0);
+~~~
+
+The results are those of TGraph::Eval(x) and TGraph::Eval(x, nullptr, "S"). For the linear method of a graph whose
+points are not sorted (see TGraph::Sort) they are the same within the range of the points, and the extrapolation
+outside of it uses the two first or last points. The interpolator does not follow the changes of the graph after its
+construction. All the evaluation methods are const and can be called concurrently.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the points of `graph` and prepare the interpolation with `method`.
+
+TGraphInterpolator::TGraphInterpolator(const TGraph &graph, EMethod method) : fMethod(method)
+{
+   const Int_t n = graph.GetN();
+   std::vector<Int_t> index(n);
+   std::iota(index.begin(), index.end(), 0);
+   const Double_t *x = graph.GetX();
+   const Double_t *y = graph.GetY();
+   std::stable_sort(index.begin(), index.end(), [x](Int_t i, Int_t j) { return x[i] < x[j]; });
+   fX.resize(n);
+   fY.resize(n);
+   for (Int_t i = 0; i < n; ++i) {
+      fX[i] = x[index[i]];
+      fY[i] = y[index[i]];
+   }
+
+   if (fMethod != EMethod::kSpline || n < 2)
+      return;
+   TSpline3 spline("", fX.data(), fY.data(), n);
+   fB.resize(n);
+   fC.resize(n);
+   fD.resize(n);
+   for (Int_t i = 0; i < n; ++i)
+      spline.GetCoeff(i, fX[i], fY[i], fB[i], fC[i], fD[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Index of the first point whose abscissa is not less than x.
+
+Int_t TGraphInterpolator::LowerBound(Double_t x) const
+{
+   return std::lower_bound(fX.begin(), fX.end(), x) - fX.begin();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate at x, given the index of the first point whose abscissa is not less than x.
+
+Double_t TGraphInterpolator::EvalAt(Double_t x, Int_t lowerBound) const
+{
+   const Int_t n = fX.size();
+   if (n == 0)
+      return 0;
+   if (n == 1)
+      return fY[0];
+
+   if (fMethod == EMethod::kSpline) {
+      // the polynomial of the knot k with fX[k] < x <= fX[k+1], as in TSpline3::Eval
+      const Int_t k = std::max(0, std::min(n - 2, lowerBound - 1));
+      const Double_t dx = x - fX[k];
+      return (fY[k] + dx * (fB[k] + dx * (fC[k] + dx * fD[k])));
+   }
+
+   // same as TMath::BinarySearch in TGraph::Eval
+   Int_t low = (lowerBound < n && fX[lowerBound] == x) ? lowerBound : lowerBound - 1;
+   if (low == -1)
+      low = 0;
+   if (fX[low] == x)
+      return fY[low];
+   if (low == n - 1)
+      low--;
+   const Int_t up = low + 1;
+   if (fX[low] == fX[up])
+      return fY[low];
+   return fY[up] + (x - fX[up]) * (fY[low] - fY[up]) / (fX[low] - fX[up]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate the graph at x, in O(log(n)) for n points.
+
+Double_t TGraphInterpolator::Eval(Double_t x) const
+{
+   return EvalAt(x, LowerBound(x));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate the graph at all the x, and store the results in y.
+/// The points around each x are found by walking from the ones of the previous value, so that the cost per value is
+/// constant if the x are in increasing order; the search is restarted when an x is smaller than the previous one.
+
+void TGraphInterpolator::Eval(std::span<const Double_t> x, std::span<Double_t> y) const
+{
+   if (x.size() != y.size()) {
+      Error("TGraphInterpolator::Eval", "The numbers of values %zu and of results %zu differ", x.size(), y.size());
+      return;
+   }
+   const Int_t n = fX.size();
+   Int_t lowerBound = 0;
+   Double_t previous = 0;
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      if (i == 0 || !(x[i] >= previous)) {
+         lowerBound = LowerBound(x[i]);
+      } else {
+         while (lowerBound < n && fX[lowerBound] < x[i])
+            ++lowerBound;
+      }
+      previous = x[i];
+      y[i] = EvalAt(x[i], lowerBound);
+   }
+}
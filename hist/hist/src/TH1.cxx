@@ -778,7 +778,7 @@ void TH1::Build()
 
    UseCurrentStyle();
 
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && !TDirectory::IsThreadDetached()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          fFunctions->UseRWLock();
@@ -1260,6 +1260,8 @@ void TH1::AddBinContent(Int_t, Double_t)
 /// Note that one histogram can be removed from its support directory
 /// by calling h->SetDirectory(nullptr) or h->SetDirectory(dir) to add it
 /// to the list of objects in the directory dir.
+/// The histograms created by a thread detached with TDirectory::DetachThread
+/// are never added, whatever the value of this flag.
 ///
 /// NOTE that this is a static function. To call it, use;
 /// TH1::AddDirectory
@@ -2713,7 +2715,7 @@ void TH1::Copy(TObject &obj) const
    // will be added to gDirectory independently of the fDirectory stored.
    // and if the AddDirectoryStatus() is false it will not be added to
    // any directory (fDirectory = nullptr)
-   if (fgAddDirectory && gDirectory) {
+   if (fgAddDirectory && gDirectory && !TDirectory::IsThreadDetached()) {
       gDirectory->Append(&obj);
       ((TH1&)obj).fFunctions->UseRWLock();
       ((TH1&)obj).fDirectory = gDirectory;
@@ -3473,22 +3475,30 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   // if the axis cannot be extended, FindBin is FindFixBin and the bins are computed in bulk
+   const Bool_t fixBins = !fXaxis.CanExtend() || fXaxis.IsAlphanumeric();
+   constexpr Int_t kChunkSize = 256;
+   Int_t bins[kChunkSize];
+   for (Int_t first = 0; first < ntimes; first += kChunkSize) {
+      const Int_t n = std::min(kChunkSize, ntimes - first);
+      if (fixBins) fXaxis.FindFixBins(n, &x[first*stride], stride, bins);
+      for (Int_t k = 0; k < n; ++k) {
+         i = (first + k)*stride;
+         bin = (fixBins) ? bins[k] : fXaxis.FindBin(x[i]);
+         if (bin <0) continue;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (bin == 0 || bin > nbins) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
       }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
    }
 }
 
@@ -3961,6 +3971,7 @@ TFitResultPtr TH1::Fit(const char *fname ,Option_t *option ,Option_t *goption, D
 ///   "WIDTH" | Scales the histogran bin content by the bin width (useful for variable bins histograms)
 ///   "SERIAL" | Runs in serial mode. By defult if ROOT is built with MT support and MT is enables, the fit is perfomed in multi-thread     - "E"  Perform better Errors estimation using Minos technique
 ///   "MULTITHREAD" | Forces usage of multi-thread execution whenever possible
+///   "VEC" | Evaluates a formula-based function (e.g. `TF1("f", "[0]*exp(-0.5*((x-[1])/[2])^2)")`) on SIMD vectors of points. It requires ROOT built with VecCore and it is ignored for linear, integral ("I"), gradient ("G"), "WIDTH", "P" and "WL" fits.
 ///
 /// The default fitting of an histogram (when no option is given) is perfomed as following:
 ///   - a chi-square fit (see below Chi-square Fits) computed using the bin histogram errors and excluding bins with zero errors (empty bins);
@@ -0,0 +1,178 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TH1ConcurrentFill.h"
+#include "TError.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+
+#include <utility>
+
+/** \class TH1ConcurrentFillManager
+    \ingroup Histograms
+Manages the concurrent filling of a one, two or three dimensional histogram from several threads.
+
+The manager hands out TH1ConcurrentFiller objects, one per thread. A filler buffers the calls to Fill() and fills
+the histogram with the whole buffer when it is full, while holding the lock of the manager. The histogram is
+therefore exactly the same as if it was filled from a single thread (up to the order of the fills), including its
+statistics, but without a clone of the histogram per thread:
+
+~~~ {.cpp}
+TH2D h("h", "h", 100, -5, 5, 100, -5, 5);
+TH1ConcurrentFillManager manager(h);
+// in each thread
+auto filler = manager.MakeFiller();
+for (auto &p : points)
+   filler.Fill(p.x, p.y, p.w);
+// the destructor of the filler fills the rest of its buffer
+~~~
+
+Profiles are not supported. The histogram must not be used while it is filled by the fillers: its content is complete when all the fillers
+have been flushed or destroyed.
+*/
+
+/** \class TH1ConcurrentFiller
+    \ingroup Histograms
+Buffers the fills of a thread, see TH1ConcurrentFillManager.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+/// Manage the concurrent filling of hist, which must not be a profile
+
+TH1ConcurrentFillManager::TH1ConcurrentFillManager(TH1 &hist) : fHist(hist)
+{
+   if (hist.InheritsFrom("TProfile") || hist.InheritsFrom("TProfile2D") || hist.InheritsFrom("TProfile3D"))
+      ::Error("TH1ConcurrentFillManager", "Profiles are not supported: the weights would be filled as values of %s",
+              hist.GetName());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a filler of the histogram, to be used by a single thread
+
+TH1ConcurrentFiller TH1ConcurrentFillManager::MakeFiller(std::size_t bufferSize)
+{
+   return TH1ConcurrentFiller(*this, bufferSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram with n entries of coordinates coords (GetDimension() per entry) and weights
+
+void TH1ConcurrentFillManager::FillN(std::size_t n, const Double_t *coords, const Double_t *weights)
+{
+   std::lock_guard<std::mutex> lock(fFillMutex);
+   switch (fHist.GetDimension()) {
+   case 1:
+      for (std::size_t i = 0; i < n; ++i)
+         fHist.Fill(coords[i], weights[i]);
+      break;
+   case 2:
+      for (std::size_t i = 0; i < n; ++i)
+         static_cast<TH2 &>(fHist).Fill(coords[2 * i], coords[2 * i + 1], weights[i]);
+      break;
+   case 3:
+      for (std::size_t i = 0; i < n; ++i)
+         static_cast<TH3 &>(fHist).Fill(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2], weights[i]);
+      break;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a filler buffering bufferSize fills (at least one) of the histogram of the manager
+
+TH1ConcurrentFiller::TH1ConcurrentFiller(TH1ConcurrentFillManager &manager, std::size_t bufferSize)
+   : fManager(&manager), fNDim(manager.GetHist().GetDimension()), fBufferSize(bufferSize > 0 ? bufferSize : 1)
+{
+   fCoords.reserve(fBufferSize * fNDim);
+   fWeights.reserve(fBufferSize);
+}
+
+TH1ConcurrentFiller::TH1ConcurrentFiller(TH1ConcurrentFiller &&other)
+   : fManager(other.fManager), fNDim(other.fNDim), fBufferSize(other.fBufferSize),
+     fCoords(std::move(other.fCoords)), fWeights(std::move(other.fWeights))
+{
+   other.fCoords.clear();
+   other.fWeights.clear();
+}
+
+void TH1ConcurrentFiller::Push(const Double_t *coords, Double_t w)
+{
+   fCoords.insert(fCoords.end(), coords, coords + fNDim);
+   fWeights.push_back(w);
+   if (fWeights.size() >= fBufferSize)
+      Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill x with weight 1 (TH1 only)
+
+void TH1ConcurrentFiller::Fill(Double_t x)
+{
+   if (fNDim != 1) {
+      ::Error("TH1ConcurrentFiller::Fill", "Fill(x) is only valid for a 1D histogram");
+      return;
+   }
+   Push(&x, 1.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill x with weight y for a TH1, (x, y) with weight 1 for a TH2
+
+void TH1ConcurrentFiller::Fill(Double_t x, Double_t y)
+{
+   if (fNDim == 1) {
+      Push(&x, y);
+   } else if (fNDim == 2) {
+      const Double_t coords[2] = {x, y};
+      Push(coords, 1.);
+   } else {
+      ::Error("TH1ConcurrentFiller::Fill", "Fill(x, y) is not valid for a 3D histogram");
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill (x, y) with weight z for a TH2, (x, y, z) with weight 1 for a TH3
+
+void TH1ConcurrentFiller::Fill(Double_t x, Double_t y, Double_t z)
+{
+   const Double_t coords[3] = {x, y, z};
+   if (fNDim == 2) {
+      Push(coords, z);
+   } else if (fNDim == 3) {
+      Push(coords, 1.);
+   } else {
+      ::Error("TH1ConcurrentFiller::Fill", "Fill(x, y, z) is not valid for a 1D histogram");
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill (x, y, z) with weight w (TH3 only)
+
+void TH1ConcurrentFiller::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   if (fNDim != 3) {
+      ::Error("TH1ConcurrentFiller::Fill", "Fill(x, y, z, w) is only valid for a 3D histogram");
+      return;
+   }
+   const Double_t coords[3] = {x, y, z};
+   Push(coords, w);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram with the buffered entries
+
+void TH1ConcurrentFiller::Flush()
+{
+   if (fWeights.empty())
+      return;
+   fManager->FillN(fWeights.size(), fCoords.data(), fWeights.data());
+   fCoords.clear();
+   fWeights.clear();
+}
@@ -8,9 +8,16 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #define PRINTRANGE(a, b, bn)                                                                                          \
    Printf(" base: %f %f %d, %s: %f %f %d", a->GetXmin(), a->GetXmax(), a->GetNbins(), bn, b->GetXmin(), b->GetXmax(), \
@@ -762,6 +769,7 @@ Bool_t TH1Merger::SameAxesMerge() {
    fH0->GetStats(totstats);
    Double_t nentries = fH0->GetEntries();
 
+   std::vector<const TH1 *> hists;
    TIter next(&fInputList);
    while (TH1* hist=(TH1*)next()) {
       // process only if the histogram has limits; otherwise it was processed before
@@ -778,13 +786,33 @@ Bool_t TH1Merger::SameAxesMerge() {
       for (Int_t i=0; i<TH1::kNstat; i++)
          totstats[i] += stats[i];
       nentries += hist->GetEntries();
+      hists.push_back(hist);
+   }
 
-         //Int_t nx = hist->GetXaxis()->GetNbins();
-         // loop on bins of the histogram and do the merge
-      for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
-         MergeBin(hist, ibin, ibin);
+   // loop on bins of the histograms and do the merge.
+   // With implicit multi-threading, large histograms are merged concurrently by ranges of bins. Each bin is
+   // still merged with the histograms in the order of the list, so that the result does not depend on it.
+   const Int_t ncells = fH0->fNcells;
+   auto mergeBins = [&](Int_t firstBin, Int_t lastBin) {
+      for (const TH1 *hist : hists) {
+         for (Int_t ibin = firstBin; ibin < lastBin; ibin++) {
+            MergeBin(hist, ibin, ibin);
+         }
       }
-   }
+   };
+#ifdef R__USE_IMT
+   constexpr Int_t kMinBinsPerTask = 1 << 15;
+   if (ROOT::IsImplicitMTEnabled() && ncells >= 2 * kMinBinsPerTask && !hists.empty()) {
+      const Int_t nTasks = std::min<Int_t>(ncells / kMinBinsPerTask, 4 * ROOT::GetThreadPoolSize());
+      const Int_t binsPerTask = (ncells + nTasks - 1) / nTasks;
+      ROOT::TThreadExecutor pool;
+      auto mergeTask = [&](UInt_t task) {
+         mergeBins(task * binsPerTask, std::min(ncells, (Int_t)(task + 1) * binsPerTask));
+      };
+      pool.Foreach(mergeTask, ROOT::TSeqU(nTasks));
+   } else
+#endif
+      mergeBins(0, ncells);
    //copy merged stats
    fH0->PutStats(totstats);
    fH0->SetEntries(nentries);
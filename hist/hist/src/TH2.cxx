@@ -617,30 +617,44 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
    }
 
    Double_t ww = 1;
-   for (i=ifirst;i<ntimes;i+=stride) {
-      fEntries++;
-      binx = fXaxis.FindBin(x[i]);
-      biny = fYaxis.FindBin(y[i]);
-      if (binx <0 || biny <0) continue;
-      bin  = biny*(fXaxis.GetNbins()+2) + binx;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin,ww);
-      if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   // if the axes cannot be extended, FindBin is FindFixBin and the bins are computed in bulk
+   const Bool_t fixBins = (!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) &&
+                          (!fYaxis.CanExtend() || fYaxis.IsAlphanumeric());
+   constexpr Int_t kChunkSize = 256;
+   Int_t binsx[kChunkSize];
+   Int_t binsy[kChunkSize];
+   for (Int_t first = ifirst; first < ntimes; first += kChunkSize*stride) {
+      const Int_t n = std::min(kChunkSize, (ntimes - first + stride - 1) / stride);
+      if (fixBins) {
+         fXaxis.FindFixBins(n, &x[first], stride, binsx);
+         fYaxis.FindFixBins(n, &y[first], stride, binsy);
       }
-      if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+      for (Int_t k = 0; k < n; ++k) {
+         i = first + k*stride;
+         fEntries++;
+         binx = (fixBins) ? binsx[k] : fXaxis.FindBin(x[i]);
+         biny = (fixBins) ? binsy[k] : fYaxis.FindBin(y[i]);
+         if (binx <0 || biny <0) continue;
+         bin  = biny*(fXaxis.GetNbins()+2) + binx;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin,ww);
+         if (binx == 0 || binx > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         if (biny == 0 || biny > fYaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww; //(ww > 0 ? ww : -ww);
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+         fTsumwy  += z*y[i];
+         fTsumwy2 += z*y[i]*y[i];
+         fTsumwxy += z*x[i]*y[i];
       }
-      Double_t z= ww; //(ww > 0 ? ww : -ww);
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
-      fTsumwy  += z*y[i];
-      fTsumwy2 += z*y[i]*y[i];
-      fTsumwxy += z*x[i]*y[i];
    }
 }
 
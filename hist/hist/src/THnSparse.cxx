@@ -489,6 +489,74 @@ void THnSparseArrayChunk::Sumw2()
 }
 
 
+/** \class THnSparseBinIndex
+THnSparseBinIndex is a class used by THnSparse internally. It maps the
+hash of the compact coordinates of a filled bin (the compact coordinates
+themselves if they fit into 8 bytes) to the linear index of the bin, with
+an open addressing hash table.
+*/
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all bins
+
+void THnSparseBinIndex::Clear()
+{
+   fSlots.clear();
+   fSlots.shrink_to_fit();
+   fSize = 0;
+   fShift = 64;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make room for nbins bins, keeping the load of the table at most 1/2
+
+void THnSparseBinIndex::Reserve(Long64_t nbins)
+{
+   ULong64_t nslots = 16;
+   Int_t shift = 60;
+   while (nslots < 2 * (ULong64_t)nbins) {
+      nslots *= 2;
+      --shift;
+   }
+   if (nslots <= fSlots.size())
+      return;
+
+   std::vector<Slot> slots(nslots, Slot{0, 0});
+   fSlots.swap(slots);
+   fShift = shift;
+   fSize = 0;
+   for (const Slot &slot : slots) {
+      if (slot.fIndex)
+         Insert(slot.fHash, slot.fIndex - 1);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin with linear index "index" and the given hash
+
+void THnSparseBinIndex::Add(ULong64_t hash, Long64_t index)
+{
+   if (2 * (fSize + 1) > (Long64_t)fSlots.size())
+      Reserve(fSlots.size());
+   Insert(hash, index);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the bin in the first empty slot starting from its hash; the table must not be full
+
+void THnSparseBinIndex::Insert(ULong64_t hash, Long64_t index)
+{
+   const ULong64_t mask = fSlots.size() - 1;
+   ULong64_t i = FirstSlot(hash);
+   while (fSlots[i].fIndex)
+      i = (i + 1) & mask;
+   fSlots[i].fHash = hash;
+   fSlots[i].fIndex = index + 1;
+   ++fSize;
+}
+
+
 /** \class THnSparse
     \ingroup Hist
 
@@ -658,28 +726,14 @@ void THnSparse::FillExMap()
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   fBins.Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBins.Add(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -690,9 +744,7 @@ void THnSparse::Reserve(Long64_t nbins) {
    if (!fBins.GetSize() && fBinContent.GetSize()) {
       FillExMap();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   fBins.Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -792,18 +844,10 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
    ULong64_t hash = cc->GetHash();
    if (fBinContent.GetSize() && !fBins.GetSize())
       FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
+   Long64_t linidx = fBins.Find(hash, [&](Long64_t idx) {
+      return GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, cc->GetBuffer());
+   });
+   if (linidx >= 0) return linidx;
    if (!allocate) return -1;
 
    ++fFilledBins;
@@ -819,16 +863,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBins.Add(hash, newidx);
    return newidx;
 }
 
@@ -880,7 +915,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += fBins.GetMemorySize();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +997,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBins.Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
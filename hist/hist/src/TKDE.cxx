@@ -31,6 +31,7 @@
 #include <numeric>
 #include <limits>
 #include <cassert>
+#include <cmath>
 
 #include "Math/Error.h"
 #include "TMath.h"
@@ -748,6 +749,28 @@ Double_t TKDE::operator()(Double_t x) const {
    return (*fKernel)(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the kernel density estimate at all the points x, storing the results in values
+/// (which must have the same size as x).
+
+void TKDE::GetValues(std::span<const Double_t> x, std::span<Double_t> values) const {
+   if (x.size() != values.size()) {
+      Error("GetValues", "The number of points (%zu) differs from the number of values (%zu)", x.size(),
+            values.size());
+      return;
+   }
+   if (!fKernel) {
+      (const_cast<TKDE*>(this))->ReInit();
+      // in case of failed re-initialization
+      if (!fKernel) {
+         std::fill(values.begin(), values.end(), TMath::QuietNaN());
+         return;
+      }
+   }
+   for (std::size_t i = 0; i < x.size(); ++i)
+      values[i] = (*fKernel)(x[i]);
+}
+
 Double_t TKDE::GetMean() const {
    // return the mean of the data
    if (fNewData) (const_cast<TKDE*>(this))->InitFromNewData();
@@ -770,8 +793,22 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(1, weight)
-{}
+fWeights(1, weight),
+fMaxWeight(weight),
+fUseSupport(std::isfinite(kde->KernelSupport()))
+{
+   // the kernel sums run only over the data points within the kernel support of x, which are found
+   // by binary search: sort the data if needed (binned data are already sorted)
+   const std::vector<Double_t> &data = fKDE->fData;
+   if (fUseSupport && !std::is_sorted(data.begin(), data.end())) {
+      fSortedIndex.resize(data.size());
+      std::iota(fSortedIndex.begin(), fSortedIndex.end(), 0);
+      std::sort(fSortedIndex.begin(), fSortedIndex.end(), [&](UInt_t i, UInt_t j) { return data[i] < data[j]; });
+      fSortedData.resize(data.size());
+      for (UInt_t i = 0; i < data.size(); ++i)
+         fSortedData[i] = data[fSortedIndex[i]];
+   }
+}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
    // Gets the adaptive weights (bandwidths) for TKernel internal computation
@@ -808,6 +845,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    fWeights.resize(n);
    transform(weights.begin(), weights.end(), fWeights.begin(),
              std::bind(std::multiplies<Double_t>(), std::placeholders::_1, fKDE->fAdaptiveBandwidthFactor));
+   fMaxWeight = (n > 0) ? *std::max_element(fWeights.begin(), fWeights.end()) : fWeights[0];
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
 }
 
@@ -1020,24 +1058,51 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
    // in case of non-adaptive fWeights is a vector of size 1
    Bool_t hasAdaptiveWeights = (fWeights.size() == n);
    Double_t invWeight = (!hasAdaptiveWeights) ? 1. / fWeights[0] : 0;
-   for (UInt_t i = 0; i < n; ++i) {
+   // kernel contribution of the data point i, at position xi (which is the data value or its mirror)
+   auto kernelTerm = [&](UInt_t i, Double_t xi) {
       Double_t binCount = (useCount) ? fKDE->fBinCount[i] : 1.0;
       // uncommenting following line slows down so keep computation for
       // zero bincounts
       //if (binCount <= 0) continue;
       if (hasAdaptiveWeights) {
          // skip data points that have 0 bandwidth (this can happen, see TKernel::ComputeAdaptiveWeight)
-         if (fWeights[i] == 0) continue;
+         if (fWeights[i] == 0) return 0.;
          invWeight = 1. / fWeights[i];
       }
-      result += binCount * invWeight * (*fKDE->fKernelFunction)((x - fKDE->fData[i]) * invWeight );
-      if (fKDE->fAsymLeft) {
-         result += binCount * invWeight * (*fKDE->fKernelFunction)((x - (2. * fKDE->fXMin - fKDE->fData[i])) * invWeight);
-      }
-      if (fKDE->fAsymRight) {
-         result += binCount * invWeight * (*fKDE->fKernelFunction)((x - (2. * fKDE->fXMax - fKDE->fData[i])) * invWeight);
+      return binCount * invWeight * (*fKDE->fKernelFunction)((x - xi) * invWeight);
+   };
+   // the data may have been filled after the creation of the kernel
+   if (fUseSupport && n == fNWeights) {
+      // only the data points at a distance from x smaller than the kernel support times the bandwidth contribute.
+      // The range is slightly enlarged to be safe against rounding: the kernels are zero outside their support
+      const Double_t halfWidth = fKDE->KernelSupport() * fMaxWeight * (1. + 1.E-8);
+      const std::vector<Double_t> &data = (fSortedIndex.empty()) ? fKDE->fData : fSortedData;
+      // add the points with data value in [center - halfWidth, center + halfWidth], mirrored around
+      // reflectionPoint/2 if reflect is true
+      auto addRange = [&](Double_t center, Bool_t reflect, Double_t reflectionPoint) {
+         auto first = std::lower_bound(data.begin(), data.end(), center - halfWidth);
+         auto last = std::upper_bound(first, data.end(), center + halfWidth);
+         for (auto it = first; it != last; ++it) {
+            UInt_t i = it - data.begin();
+            if (!fSortedIndex.empty()) i = fSortedIndex[i];
+            result += kernelTerm(i, (reflect) ? reflectionPoint - *it : *it);
+         }
+      };
+      addRange(x, kFALSE, 0.);
+      if (fKDE->fAsymLeft) addRange(2. * fKDE->fXMin - x, kTRUE, 2. * fKDE->fXMin);
+      if (fKDE->fAsymRight) addRange(2. * fKDE->fXMax - x, kTRUE, 2. * fKDE->fXMax);
+   }
+   else {
+      for (UInt_t i = 0; i < n; ++i) {
+         result += kernelTerm(i, fKDE->fData[i]);
+         if (fKDE->fAsymLeft) {
+            result += kernelTerm(i, 2. * fKDE->fXMin - fKDE->fData[i]);
+         }
+         if (fKDE->fAsymRight) {
+            result += kernelTerm(i, 2. * fKDE->fXMax - fKDE->fData[i]);
+         }
+         // printf("data point %i  %f  %f  count %f weight % f result % f\n",i,fKDE->fData[i],fKDE->fEvents[i],binCount,fWeights[i], result);
       }
-      // printf("data point %i  %f  %f  count %f weight % f result % f\n",i,fKDE->fData[i],fKDE->fEvents[i],binCount,fWeights[i], result);
    }
    if ( TMath::IsNaN(result) ) {
       fKDE->Warning("operator()","Result is NaN for  x %f \n",x);
@@ -18,6 +18,7 @@
 #include "TError.h"
 #include "TClass.h"
 #include "TObjString.h"
+#include <algorithm>
 
 #include "TProfileHelper.h"
 
@@ -790,28 +791,39 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
-   for (i=ifirst;i<ntimes;i+=stride) {
-      if (fYmin != fYmax) {
-         if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
-      }
+   // if the axis cannot be extended, FindBin is FindFixBin and the bins are computed in bulk
+   const Bool_t fixBins = !fXaxis.CanExtend() || fXaxis.IsAlphanumeric();
+   const Bool_t checkY = fYmin != fYmax;
+   constexpr Int_t kChunkSize = 256;
+   Int_t bins[kChunkSize];
+   const Int_t nfill = (ntimes - ifirst + stride - 1) / stride;
+   for (Int_t first = 0; first < nfill; first += kChunkSize) {
+      const Int_t n = std::min(kChunkSize, nfill - first);
+      if (fixBins) fXaxis.FindFixBins(n, &x[ifirst + first*stride], stride, bins);
+      for (Int_t k = 0; k < n; ++k) {
+         i = ifirst + (first + k)*stride;
+         if (checkY) {
+            if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
+         }
 
-      Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
-      fEntries++;
-      bin =fXaxis.FindBin(x[i]);
-      AddBinContent(bin, u*y[i]);
-      fSumw2.fArray[bin] += u*y[i]*y[i];
-      if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
-      if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
-      fBinEntries.fArray[bin] += u;
-      if (bin == 0 || bin > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
+         fEntries++;
+         bin = (fixBins) ? bins[k] : fXaxis.FindBin(x[i]);
+         AddBinContent(bin, u*y[i]);
+         fSumw2.fArray[bin] += u*y[i]*y[i];
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
+         if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (bin == 0 || bin > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         fTsumw   += u;
+         fTsumw2  += u*u;
+         fTsumwx  += u*x[i];
+         fTsumwx2 += u*x[i]*x[i];
+         fTsumwy  += u*y[i];
+         fTsumwy2 += u*y[i]*y[i];
       }
-      fTsumw   += u;
-      fTsumw2  += u*u;
-      fTsumwx  += u*x[i];
-      fTsumwx2 += u*x[i]*x[i];
-      fTsumwy  += u*y[i];
-      fTsumwy2 += u*y[i]*y[i];
    }
 }
 
@@ -16,6 +16,7 @@
 #include "TError.h"
 #include "TClass.h"
 #include "TProfileHelper.h"
+#include <algorithm>
 #include <iostream>
 
 Bool_t TProfile2D::fgApproximate = kFALSE;
@@ -685,6 +686,81 @@ Int_t TProfile2D::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
    fTsumwz2 += u * z * z;
    return bin;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a Profile2D histogram with `ntimes` entries (x[i], y[i], z[i]) of weights w[i].
+/// If `w` is null, the weights are 1. This is equivalent to, but faster than, calling
+/// Fill(x[i], y[i], z[i], w[i]) for each entry: if the axes cannot be extended, the bins
+/// of the entries are computed in bulk.
+
+void TProfile2D::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w,
+                       Int_t stride)
+{
+   Int_t i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+   // If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i = 0; i < ntimes; i += stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         BufferFill(x[i], y[i], z[i], (w) ? w[i] : 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && !fBuffer)
+         ifirst = i;
+      else
+         return;
+   }
+
+   const Bool_t fixBins = (!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) &&
+                          (!fYaxis.CanExtend() || fYaxis.IsAlphanumeric());
+   const Bool_t checkZ = fZmin != fZmax;
+   constexpr Int_t kChunkSize = 256;
+   Int_t binsx[kChunkSize];
+   Int_t binsy[kChunkSize];
+   const Int_t nfill = (ntimes - ifirst + stride - 1) / stride;
+   for (Int_t first = 0; first < nfill; first += kChunkSize) {
+      const Int_t n = std::min(kChunkSize, nfill - first);
+      if (fixBins) {
+         fXaxis.FindFixBins(n, &x[ifirst + first * stride], stride, binsx);
+         fYaxis.FindFixBins(n, &y[ifirst + first * stride], stride, binsy);
+      }
+      for (Int_t k = 0; k < n; ++k) {
+         i = ifirst + (first + k) * stride;
+         if (checkZ) {
+            if (z[i] < fZmin || z[i] > fZmax || TMath::IsNaN(z[i])) continue;
+         }
+
+         Double_t u = (w) ? w[i] : 1.;
+         fEntries++;
+         const Int_t binx = (fixBins) ? binsx[k] : fXaxis.FindBin(x[i]);
+         const Int_t biny = (fixBins) ? binsy[k] : fYaxis.FindBin(y[i]);
+         if (binx < 0 || biny < 0) continue;
+         const Int_t bin = biny * (fXaxis.GetNbins() + 2) + binx;
+         AddBinContent(bin, u * z[i]);
+         fSumw2.fArray[bin] += u * z[i] * z[i];
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))
+            Sumw2(); // must be called before accumulating the entries
+         if (fBinSumw2.fN) fBinSumw2.fArray[bin] += u * u;
+         fBinEntries.fArray[bin] += u;
+
+         // the axes may have been extended by FindBin
+         if (binx == 0 || binx > fXaxis.GetNbins() || biny == 0 || biny > fYaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         fTsumw += u;
+         fTsumw2 += u * u;
+         fTsumwx += u * x[i];
+         fTsumwx2 += u * x[i] * x[i];
+         fTsumwy += u * y[i];
+         fTsumwy2 += u * y[i] * y[i];
+         fTsumwxy += u * x[i] * y[i];
+         fTsumwz += u * z[i];
+         fTsumwz2 += u * z[i] * z[i];
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a Profile2D histogram (no weights).
 
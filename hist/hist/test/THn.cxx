@@ -1,9 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 // Filling THn
 TEST(THn, Fill) {
    Int_t bins[2] = {2, 3};
@@ -111,3 +116,37 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Lookup of the filled bins of THnSparse, with compact coordinates that fit into 8 bytes or not
+TEST(THnSparse, BinIndex) {
+   for (Int_t nbinsPerAxis : {10, 1000}) {
+      const Int_t dim = 8;
+      std::vector<Int_t> bins(dim, nbinsPerAxis);
+      std::vector<Double_t> xmin(dim, 0.);
+      std::vector<Double_t> xmax(dim, 1.);
+      THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data(), 100);
+
+      std::map<std::vector<Int_t>, Double_t> contents;
+      std::vector<Int_t> coord(dim);
+      for (Int_t i = 0; i < 5000; ++i) {
+         for (Int_t d = 0; d < dim; ++d)
+            coord[d] = 1 + (i * (d + 3) + (i / 7) * d * d) % 5 * (nbinsPerAxis / 5);
+         hs.AddBinContent(coord.data(), 1. * (i % 3));
+         contents[coord] += 1. * (i % 3);
+      }
+      EXPECT_EQ(hs.GetNbins(), (Long64_t)contents.size());
+      for (const auto &c : contents) {
+         const Long64_t bin = hs.GetBin(c.first.data());
+         ASSERT_GE(bin, 0);
+         EXPECT_EQ(hs.GetBinContent(bin, coord.data()), c.second);
+         EXPECT_EQ(coord, c.first);
+      }
+      coord.assign(dim, 2);
+      EXPECT_EQ(static_cast<const THnSparse &>(hs).GetBin(coord.data()), -1);
+
+      // rebuilding the index from the bins gives the same bins
+      std::unique_ptr<THnSparse> clone(static_cast<THnSparse *>(hs.Clone("clone")));
+      for (const auto &c : contents)
+         EXPECT_EQ(clone->GetBinContent(c.first.data()), c.second);
+   }
+}
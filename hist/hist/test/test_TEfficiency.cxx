@@ -5,6 +5,8 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -399,4 +401,52 @@ TEST(TFEfficiency, ConfIntervals)
 TEST(TFEfficiency, ConsistencyWithTGraph)
 {
    testConsistencyWithTGraph();
-}
\ No newline at end of file
+}
+// FillN is equivalent to filling the events one by one, and the cached errors follow the changes of the contents
+TEST(TFEfficiency, FillNAndCachedErrors)
+{
+   gRandom->SetSeed(111);
+   const int n = 1000;
+   std::vector<double> x(n), w(n);
+   std::unique_ptr<Bool_t[]> passed(new Bool_t[n]);
+   for (int i = 0; i < n; ++i) {
+      x[i] = gRandom->Uniform(10);
+      w[i] = gRandom->Uniform(0.5, 2.);
+      passed[i] = gRandom->Rndm() < 0.7;
+   }
+
+   TEfficiency one("one", "one", 20, 0, 10);
+   TEfficiency bulk("bulk", "bulk", 20, 0, 10);
+   for (int i = 0; i < n; ++i)
+      one.Fill(passed[i], x[i]);
+   bulk.FillN(n, passed.get(), x.data());
+   for (int bin = 0; bin < 22; ++bin) {
+      EXPECT_EQ(one.GetTotalHistogram()->GetBinContent(bin), bulk.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_EQ(one.GetPassedHistogram()->GetBinContent(bin), bulk.GetPassedHistogram()->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(one.GetEfficiencyErrorLow(bin), bulk.GetEfficiencyErrorLow(bin));
+      EXPECT_DOUBLE_EQ(one.GetEfficiencyErrorUp(bin), bulk.GetEfficiencyErrorUp(bin));
+   }
+
+   // the errors are recomputed after a change of the contents or of the options
+   std::unique_ptr<TGraphAsymmErrors> graph{bulk.CreateGraph()};
+   bulk.Fill(true, 0.1);
+   one.Fill(true, 0.1);
+   EXPECT_DOUBLE_EQ(one.GetEfficiencyErrorUp(1), bulk.GetEfficiencyErrorUp(1));
+   bulk.SetStatisticOption(TEfficiency::kFWilson);
+   one.SetStatisticOption(TEfficiency::kFWilson);
+   bulk.SetConfidenceLevel(0.9);
+   one.SetConfidenceLevel(0.9);
+   EXPECT_DOUBLE_EQ(one.GetEfficiencyErrorLow(1), bulk.GetEfficiencyErrorLow(1));
+
+   TEfficiency oneW("oneW", "oneW", 20, 0, 10);
+   TEfficiency bulkW("bulkW", "bulkW", 20, 0, 10);
+   oneW.SetStatisticOption(TEfficiency::kBUniform);
+   bulkW.SetStatisticOption(TEfficiency::kBUniform);
+   for (int i = 0; i < n; ++i)
+      oneW.FillWeighted(passed[i], w[i], x[i]);
+   bulkW.FillN(n, passed.get(), x.data(), nullptr, nullptr, w.data());
+   for (int bin = 1; bin <= 20; ++bin) {
+      EXPECT_NEAR(oneW.GetEfficiency(bin), bulkW.GetEfficiency(bin), 1e-12);
+      EXPECT_NEAR(oneW.GetEfficiencyErrorLow(bin), bulkW.GetEfficiencyErrorLow(bin), 1e-12);
+   }
+}
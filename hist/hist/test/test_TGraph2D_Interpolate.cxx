@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+
+#include "TGraph2D.h"
+#include "TRandom3.h"
+
+#include <vector>
+
+namespace {
+// A plane is interpolated exactly within the convex hull of the points
+double Plane(double x, double y)
+{
+   return 2. * x + 3. * y + 1.;
+}
+
+TGraph2D MakeGraph(int n)
+{
+   TRandom3 rng(4357);
+   TGraph2D g(n);
+   for (int i = 0; i < n; ++i) {
+      const double x = rng.Uniform();
+      const double y = rng.Uniform();
+      g.SetPoint(i, x, y, Plane(x, y));
+   }
+   return g;
+}
+} // namespace
+
+TEST(TGraph2D, Interpolate)
+{
+   // enough points for a grid finer than the minimum one of the triangle lookup
+   TGraph2D g = MakeGraph(20000);
+   for (int i = 0; i < 50; ++i) {
+      const double x = 0.2 + 0.012 * i;
+      const double y = 0.8 - 0.011 * i;
+      EXPECT_NEAR(g.Interpolate(x, y), Plane(x, y), 1e-9) << x << " " << y;
+   }
+}
+
+TEST(TGraph2D, InterpolateBatch)
+{
+   TGraph2D g = MakeGraph(500);
+   std::vector<double> x, y;
+   for (int i = 0; i < 40; ++i) {
+      for (int j = 0; j < 40; ++j) {
+         x.push_back(-0.2 + 0.035 * i);
+         y.push_back(-0.2 + 0.035 * j);
+      }
+   }
+   std::vector<double> z(x.size());
+   g.Interpolate(x.size(), x.data(), y.data(), z.data());
+
+   TGraph2D reference = MakeGraph(500);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(z[i], reference.Interpolate(x[i], y[i])) << x[i] << " " << y[i];
+}
@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+
+#include "TF1.h"
+#include "TGraph.h"
+#include "TGraphInterpolator.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+// 20 points with irregular, unsorted abscissae
+TGraph MakeGraph()
+{
+   TGraph g;
+   for (int i = 0; i < 20; ++i) {
+      const double x = (i * 7) % 20 + 0.1 * (i % 3);
+      g.AddPoint(x, std::sin(0.3 * x) + 0.01 * x * x);
+   }
+   return g;
+}
+
+std::vector<double> MakeQueries(const TGraph &g)
+{
+   std::vector<double> x;
+   for (int i = -30; i < 230; ++i)
+      x.push_back(0.1 * i + 0.0137);
+   for (int i = 0; i < g.GetN(); ++i)
+      x.push_back(g.GetPointX(i));
+   return x;
+}
+} // namespace
+
+TEST(TGraphInterpolator, Linear)
+{
+   const TGraph unsortedGraph = MakeGraph();
+   TGraph g = unsortedGraph;
+   g.Sort();
+   g.SetBit(TGraph::kIsSortedX);
+   TGraphInterpolator interpolator(unsortedGraph);
+   EXPECT_EQ(20, interpolator.GetN());
+   for (double x : MakeQueries(g)) {
+      EXPECT_DOUBLE_EQ(g.Eval(x), interpolator.Eval(x)) << x;
+      // an unsorted graph gives the same result within the range of its points
+      if (x >= 0. && x <= 19.)
+         EXPECT_DOUBLE_EQ(unsortedGraph.Eval(x), interpolator.Eval(x)) << x;
+   }
+}
+
+TEST(TGraphInterpolator, Spline)
+{
+   TGraph g = MakeGraph();
+   TGraphInterpolator interpolator(g, TGraphInterpolator::EMethod::kSpline);
+   for (double x : MakeQueries(g))
+      EXPECT_DOUBLE_EQ(g.Eval(x, nullptr, "S"), interpolator.Eval(x)) << x;
+}
+
+TEST(TGraphInterpolator, Batch)
+{
+   TGraph g = MakeGraph();
+   for (auto method : {TGraphInterpolator::EMethod::kLinear, TGraphInterpolator::EMethod::kSpline}) {
+      TGraphInterpolator interpolator(g, method);
+      // sorted queries, followed by unsorted ones
+      std::vector<double> x = MakeQueries(g);
+      std::vector<double> y(x.size());
+      interpolator.Eval(x, y);
+      for (std::size_t i = 0; i < x.size(); ++i)
+         EXPECT_EQ(interpolator.Eval(x[i]), y[i]) << x[i];
+   }
+}
+
+TEST(TGraphInterpolator, FewPoints)
+{
+   TGraph g;
+   TGraphInterpolator empty(g);
+   EXPECT_EQ(0., empty.Eval(1.));
+   g.AddPoint(1., 3.);
+   TGraphInterpolator one(g, TGraphInterpolator::EMethod::kSpline);
+   EXPECT_EQ(3., one.Eval(5.));
+}
+
+TEST(TGraphInterpolator, TF1)
+{
+   TGraph g = MakeGraph();
+   const TGraphInterpolator interpolator(g, TGraphInterpolator::EMethod::kSpline);
+   TF1 f("f", interpolator, 0., 20., 0);
+   for (double x : {0.5, 3.3, 17.})
+      EXPECT_EQ(interpolator.Eval(x), f.Eval(x));
+}
@@ -2,7 +2,23 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH1ConcurrentFill.h"
+#include "TH2D.h"
+#include "TH3D.h"
+#include "TF1.h"
+#include "TFitResult.h"
 #include "THLimitsFinder.h"
+#include "TList.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TROOT.h"
+#include "TDirectory.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -46,3 +62,235 @@ TEST(THLimitsFinder, Degenerate)
    EXPECT_LE(xmin, centralValue - 5.);
    EXPECT_GE(xmax, centralValue + 5.);
 }
+
+// The option VEC gives the same fit result as the scalar evaluation of the function
+TEST(TH1, FitVectorized)
+{
+   TH1D h("h", "h", 50, -5, 5);
+   TF1 gen("gen", "gaus", -5, 5);
+   gen.SetParameters(1, 0.5, 1.2);
+   h.FillRandom("gen", 10000);
+
+   for (const char *fitType : {"", "L"}) {
+      TF1 f("f", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5, 5);
+      f.SetParameters(100, 0, 1);
+      auto scalar = h.Fit(&f, (std::string("Q0NS") + fitType).c_str());
+      ASSERT_EQ(scalar->Status(), 0);
+      std::vector<double> params(f.GetParameters(), f.GetParameters() + 3);
+
+      f.SetParameters(100, 0, 1);
+      auto vectorized = h.Fit(&f, (std::string("Q0NS VEC") + fitType).c_str());
+      ASSERT_EQ(vectorized->Status(), 0);
+      EXPECT_FALSE(f.IsVectorized());
+      for (int i = 0; i < 3; ++i)
+         EXPECT_NEAR(f.GetParameter(i), params[i], 1e-4 * std::abs(params[i]));
+      EXPECT_NEAR(vectorized->MinFcnValue(), scalar->MinFcnValue(), 1e-6 * std::abs(scalar->MinFcnValue()));
+   }
+}
+
+// Fill histograms from several threads with TH1ConcurrentFiller and compare with a sequential fill
+TEST(TH1, ConcurrentFill)
+{
+   const int nThreads = 4;
+   const int nFills = 10000;
+   auto coord = [](int i, int k) { return std::fmod(0.37 * i + 0.11 * k * k, 10.) - 1.; };
+   auto weight = [](int i) { return 1. + (i % 3); };
+
+   TH1D h1("h1", "h1", 20, 0, 8);
+   TH2D h2("h2", "h2", 20, 0, 8, 10, 0, 8);
+   TH3D h3("h3", "h3", 10, 0, 8, 10, 0, 8, 5, 0, 8);
+   TH1D r1("r1", "r1", 20, 0, 8);
+   TH2D r2("r2", "r2", 20, 0, 8, 10, 0, 8);
+   TH3D r3("r3", "r3", 10, 0, 8, 10, 0, 8, 5, 0, 8);
+   for (auto *h : std::vector<TH1 *>{&h1, &h2, &h3, &r1, &r2, &r3})
+      h->Sumw2();
+
+   TH1ConcurrentFillManager m1(h1);
+   TH1ConcurrentFillManager m2(h2);
+   TH1ConcurrentFillManager m3(h3);
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         auto f1 = m1.MakeFiller(100);
+         auto f2 = m2.MakeFiller(100);
+         auto f3 = m3.MakeFiller(100);
+         for (int i = t; i < nFills; i += nThreads) {
+            f1.Fill(coord(i, 0), weight(i));
+            f2.Fill(coord(i, 0), coord(i, 1));
+            f3.Fill(coord(i, 0), coord(i, 1), coord(i, 2), weight(i));
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   for (int i = 0; i < nFills; ++i) {
+      r1.Fill(coord(i, 0), weight(i));
+      r2.Fill(coord(i, 0), coord(i, 1));
+      r3.Fill(coord(i, 0), coord(i, 1), coord(i, 2), weight(i));
+   }
+
+   for (auto hr : std::vector<std::pair<TH1 *, TH1 *>>{{&h1, &r1}, {&h2, &r2}, {&h3, &r3}}) {
+      TH1 &h = *hr.first;
+      TH1 &r = *hr.second;
+      EXPECT_EQ(h.GetEntries(), r.GetEntries());
+      for (int bin = 0; bin < r.GetNcells(); ++bin) {
+         EXPECT_EQ(h.GetBinContent(bin), r.GetBinContent(bin));
+         EXPECT_EQ(h.GetBinError(bin), r.GetBinError(bin));
+      }
+      Double_t statsH[TH1::kNstat] = {0};
+      Double_t statsR[TH1::kNstat] = {0};
+      h.GetStats(statsH);
+      r.GetStats(statsR);
+      for (int i = 0; i < 11; ++i)
+         EXPECT_NEAR(statsH[i], statsR[i], 1.E-9 * std::abs(statsR[i]));
+   }
+}
+
+// FillN computes the bins in bulk: compare with Fill for fixed and variable bins
+TEST(TH1, FillN)
+{
+   const int n = 1000;
+   std::vector<double> xy(2 * n);
+   std::vector<double> w(2 * n);
+   for (int i = 0; i < 2 * n; ++i) {
+      xy[i] = std::fmod(0.731 * i, 12.) - 1.;
+      w[i] = 0.5 + (i % 4);
+   }
+   xy[10] = 0.;
+   xy[12] = 10.;
+   xy[14] = 2.5;
+   xy[16] = std::nan("");
+   const double edges[] = {0., 0.5, 2.5, 2.6, 7., 10.};
+
+   TH1D fixed1("fixed1", "fixed1", 30, 0., 10.);
+   TH1D fixed2("fixed2", "fixed2", 30, 0., 10.);
+   TH1D var1("var1", "var1", 5, edges);
+   TH1D var2("var2", "var2", 5, edges);
+   TH2D h2d1("h2d1", "h2d1", 5, edges, 30, 0., 10.);
+   TH2D h2d2("h2d2", "h2d2", 5, edges, 30, 0., 10.);
+   fixed1.FillN(n, xy.data(), w.data(), 2);
+   var1.FillN(n, xy.data(), w.data(), 2);
+   h2d1.FillN(n, xy.data(), xy.data() + 1, w.data(), 2);
+   for (int i = 0; i < 2 * n; i += 2) {
+      fixed2.Fill(xy[i], w[i]);
+      var2.Fill(xy[i], w[i]);
+      h2d2.Fill(xy[i], xy[i + 1], w[i]);
+   }
+
+   for (auto hr : std::vector<std::pair<TH1 *, TH1 *>>{{&fixed1, &fixed2}, {&var1, &var2}, {&h2d1, &h2d2}}) {
+      TH1 &h = *hr.first;
+      TH1 &r = *hr.second;
+      EXPECT_EQ(h.GetEntries(), r.GetEntries());
+      for (int bin = 0; bin < r.GetNcells(); ++bin) {
+         EXPECT_EQ(h.GetBinContent(bin), r.GetBinContent(bin));
+         EXPECT_EQ(h.GetBinError(bin), r.GetBinError(bin));
+      }
+      Double_t statsH[TH1::kNstat] = {0};
+      Double_t statsR[TH1::kNstat] = {0};
+      h.GetStats(statsH);
+      r.GetStats(statsR);
+      for (int i = 0; i < TH1::kNstat; ++i)
+         EXPECT_EQ(statsH[i], statsR[i]);
+   }
+}
+
+// TProfile::FillN and TProfile2D::FillN give the same result as filling entry by entry
+TEST(TProfile, FillN)
+{
+   const int n = 1000;
+   std::vector<double> xyz(3 * n);
+   std::vector<double> w(3 * n);
+   for (int i = 0; i < 3 * n; ++i) {
+      xyz[i] = std::fmod(0.731 * i, 12.) - 1.;
+      w[i] = 0.5 + (i % 4);
+   }
+   xyz[9] = 2.5;
+   xyz[12] = std::nan("");
+   const double edges[] = {0., 0.5, 2.5, 2.6, 7., 10.};
+
+   TProfile prof1("prof1", "prof1", 30, 0., 10., 0., 8.);
+   TProfile prof2("prof2", "prof2", 30, 0., 10., 0., 8.);
+   TProfile grow1("grow1", "grow1", 5, 0., 1.);
+   TProfile grow2("grow2", "grow2", 5, 0., 1.);
+   grow1.SetCanExtend(TH1::kAllAxes);
+   grow2.SetCanExtend(TH1::kAllAxes);
+   TProfile2D prof2d1("prof2d1", "prof2d1", 5, edges, 30, 0., 10.);
+   TProfile2D prof2d2("prof2d2", "prof2d2", 5, edges, 30, 0., 10.);
+   prof1.FillN(n, xyz.data(), xyz.data() + 1, w.data(), 3);
+   grow1.FillN(n, xyz.data() + 2, xyz.data() + 1, nullptr, 3);
+   prof2d1.FillN(n, xyz.data(), xyz.data() + 1, xyz.data() + 2, w.data(), 3);
+   for (int i = 0; i < 3 * n; i += 3) {
+      prof2.Fill(xyz[i], xyz[i + 1], w[i]);
+      grow2.Fill(xyz[i + 2], xyz[i + 1]);
+      prof2d2.Fill(xyz[i], xyz[i + 1], xyz[i + 2], w[i]);
+   }
+
+   for (auto hr : std::vector<std::pair<TH1 *, TH1 *>>{{&prof1, &prof2}, {&grow1, &grow2}, {&prof2d1, &prof2d2}}) {
+      TH1 &h = *hr.first;
+      TH1 &r = *hr.second;
+      EXPECT_EQ(h.GetEntries(), r.GetEntries());
+      ASSERT_EQ(h.GetNcells(), r.GetNcells());
+      for (int bin = 0; bin < r.GetNcells(); ++bin) {
+         EXPECT_EQ(h.GetBinContent(bin), r.GetBinContent(bin));
+         EXPECT_EQ(h.GetBinError(bin), r.GetBinError(bin));
+      }
+      Double_t statsH[TH1::kNstat] = {0};
+      Double_t statsR[TH1::kNstat] = {0};
+      h.GetStats(statsH);
+      r.GetStats(statsR);
+      for (int i = 0; i < TH1::kNstat; ++i)
+         EXPECT_EQ(statsH[i], statsR[i]);
+   }
+}
+
+#ifdef R__USE_IMT
+// Large histograms are merged concurrently by ranges of bins with implicit multi-threading
+TEST(TH1, MergeMT)
+{
+   std::vector<std::unique_ptr<TH2D>> inputs;
+   TList list;
+   for (int i = 0; i < 5; ++i) {
+      inputs.emplace_back(new TH2D(("in" + std::to_string(i)).c_str(), "in", 400, 0, 1, 400, 0, 1));
+      for (int j = 0; j < 20000; ++j)
+         inputs.back()->Fill(std::fmod(0.618 * j * (i + 1), 1.), std::fmod(0.414 * j, 1.), 0.1 * (i + 1));
+      list.Add(inputs.back().get());
+   }
+
+   TH2D serial("serial", "serial", 400, 0, 1, 400, 0, 1);
+   serial.Merge(&list);
+   ROOT::EnableImplicitMT(4);
+   TH2D parallel("parallel", "parallel", 400, 0, 1, 400, 0, 1);
+   parallel.Merge(&list);
+   ROOT::DisableImplicitMT();
+
+   EXPECT_EQ(parallel.GetEntries(), serial.GetEntries());
+   for (int bin = 0; bin < serial.GetNcells(); ++bin) {
+      EXPECT_EQ(parallel.GetBinContent(bin), serial.GetBinContent(bin));
+      EXPECT_EQ(parallel.GetBinError(bin), serial.GetBinError(bin));
+   }
+}
+#endif
+
+// Histograms booked by a detached thread are not added to gDirectory, on this thread only
+TEST(TH1, DetachedThread)
+{
+   TDirectory dir("dir", "dir");
+   TDirectory::TContext ctxt(&dir);
+   std::unique_ptr<TH1D> detached;
+   {
+      TDirectory::TDetachedThread detach;
+      EXPECT_TRUE(TDirectory::IsThreadDetached());
+      detached.reset(new TH1D("detached", "detached", 10, 0, 1));
+      std::unique_ptr<TH1D> copy(static_cast<TH1D *>(detached->Clone("copy")));
+      EXPECT_EQ(copy->GetDirectory(), nullptr);
+      std::thread([] { EXPECT_FALSE(TDirectory::IsThreadDetached()); }).join();
+   }
+   EXPECT_FALSE(TDirectory::IsThreadDetached());
+   EXPECT_TRUE(TH1::AddDirectoryStatus());
+   EXPECT_EQ(detached->GetDirectory(), nullptr);
+   EXPECT_EQ(dir.GetList()->FindObject("detached"), nullptr);
+
+   TH1D attached("attached", "attached", 10, 0, 1);
+   EXPECT_EQ(attached.GetDirectory(), &dir);
+}
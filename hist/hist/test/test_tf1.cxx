@@ -1,5 +1,8 @@
 #include "TF1.h"
+#include "TF2.h"
 #include "TF1NormSum.h"
+#include "TF1Sampler.h"
+#include "TRandom3.h"
 #include "TObjString.h"
 #include "TObjArray.h"
 
@@ -223,3 +226,60 @@ TEST(TF1, Constructors)
    for (auto tf1 : vtf1)
       EXPECT_EQ(tf1(&x, &p), 2);
 }
+
+// EvalBatch gives the same values as the evaluation point by point
+TEST(TF1, EvalBatch)
+{
+   std::vector<double> xs(103);
+   std::vector<double> ys(xs.size());
+   for (std::size_t i = 0; i < xs.size(); ++i) {
+      xs[i] = -5. + 0.1 * i;
+      ys[i] = 0.05 * i;
+   }
+   std::vector<double> out(xs.size());
+
+   TF1 formula("formula", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5, 5);
+   formula.SetParameters(2, 0.5, 1.2);
+   TF1 lambda("lambda", [](const double *x, const double *p) { return p[0] + p[1] * x[0] * x[0]; }, -5, 5, 2);
+   lambda.SetParameters(1, 3);
+   for (TF1 *f : {&formula, &lambda}) {
+      f->EvalBatch(xs, out);
+      for (std::size_t i = 0; i < xs.size(); ++i)
+         EXPECT_DOUBLE_EQ(out[i], f->Eval(xs[i])) << f->GetName() << " at x = " << xs[i];
+   }
+
+   const double params[] = {1, 2, 3};
+   formula.EvalBatch(xs, out, params);
+   for (std::size_t i = 0; i < xs.size(); ++i)
+      EXPECT_DOUBLE_EQ(out[i], formula.EvalPar(&xs[i], params));
+
+   TF2 f2("f2", "[0]*x*y + [1]*y", -5, 5, 0, 10);
+   f2.SetParameters(2, 3);
+   f2.EvalBatch(xs, ys, out);
+   for (std::size_t i = 0; i < xs.size(); ++i)
+      EXPECT_DOUBLE_EQ(out[i], f2.Eval(xs[i], ys[i]));
+}
+
+// TF1Sampler generates the same numbers as TF1::GetRandom
+TEST(TF1, Sampler)
+{
+   TF1 f("f", "x*x*exp(-x)", 0, 20);
+   const TF1Sampler sampler(f);
+   ASSERT_TRUE(sampler.IsValid());
+
+   TRandom3 rng1(42);
+   TRandom3 rng2(42);
+   for (int i = 0; i < 1000; ++i)
+      EXPECT_DOUBLE_EQ(sampler.GetRandom(rng1), f.GetRandom(&rng2));
+
+   std::vector<double> values(100000);
+   sampler.GetRandom(values, rng1);
+   double sum = 0;
+   for (double x : values) {
+      EXPECT_GE(x, 0.);
+      EXPECT_LE(x, 20.);
+      sum += x;
+   }
+   // the mean of the gamma distribution with shape 3 is 3
+   EXPECT_NEAR(sum / values.size(), 3., 0.03);
+}
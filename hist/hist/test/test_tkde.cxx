@@ -496,4 +496,40 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+/// The kernel sums run only over the data within the kernel support: compare with the sums over all data
+TEST(TKDE, tkde_kernel_support)
+{
+   const int n = 5000;
+   TRandom3 r(2222);
+   std::vector<double> data(n);
+   for (auto &x : data)
+      x = r.Uniform(0., 20.);
+
+   auto epanechnikov = [](double u) { return (u > -1. && u < 1.) ? 3. / 4. * (1. - u * u) : 0.0; };
+   auto gaussian = [](double u) { return (u > -9. && u < 9.) ? std::exp(-.5 * u * u) / std::sqrt(2. * M_PI) : 0.0; };
+
+   TKDE fixed(n, data.data(), 0., 20., "KernelType:Epanechnikov;Iteration:Fixed;Mirror:noMirror;Binning:Unbinned");
+   TKDE adaptive(n, data.data(), 0., 20., "KernelType:Gaussian;Iteration:Adaptive;Mirror:noMirror;Binning:Unbinned");
+   const double h = fixed.GetFixedWeight();
+   const double *hi = adaptive.GetAdaptiveWeights();
+   ASSERT_NE(hi, nullptr);
+
+   std::vector<double> xtest;
+   for (int i = 0; i < 41; ++i)
+      xtest.push_back(-0.5 + 0.5 * i);
+   std::vector<double> values(xtest.size());
+   adaptive.GetValues(xtest, values);
+
+   for (std::size_t j = 0; j < xtest.size(); ++j) {
+      double sumFixed = 0;
+      double sumAdaptive = 0;
+      for (int i = 0; i < n; ++i) {
+         sumFixed += epanechnikov((xtest[j] - data[i]) / h) / h;
+         sumAdaptive += gaussian((xtest[j] - data[i]) / hi[i]) / hi[i];
+      }
+      EXPECT_NEAR(fixed(xtest[j]), sumFixed / n, 1.E-12);
+      EXPECT_NEAR(adaptive(xtest[j]), sumAdaptive / n, 1.E-12);
+      EXPECT_EQ(values[j], adaptive(xtest[j]));
+   }
+}
@@ -99,6 +99,7 @@ public:
    virtual void       PaintCandlePlot(Option_t *option);
    virtual void       PaintColorLevels(Option_t *option);
    virtual void       PaintColorLevelsFast(Option_t *option);
+   virtual void       PaintColorLevelsRaster(const std::vector<Int_t> &raster, Int_t nx, Int_t ny);
    virtual std::vector<THistRenderingRegion> ComputeRenderingRegions(TAxis *pAxis, Int_t nPixels, bool isLog);
 
    virtual void       PaintTH2PolyBins(Option_t *option);
@@ -59,6 +59,8 @@
 #include "TArrow.h"
 #include "TVirtualPadEditor.h"
 #include "TVirtualX.h"
+#include "TVirtualPS.h"
+#include "TVirtualPadPainter.h"
 #include "TEnv.h"
 #include "TPoint.h"
 #include "TImage.h"
@@ -1199,6 +1201,14 @@ COL2 option renders the histogram as a bitmap. Therefore it cannot be saved in v
 graphics file format like PostScript or PDF (an empty image will be generated). It can
 be saved only in bitmap files like PNG format for instance.
 
+When the visible cells of a histogram drawn with the COL option outnumber the
+pixels of the frame, they are not painted one by one: each pixel of the frame
+takes the highest color of the cells it covers, so that isolated peaks stay visible,
+and the resulting image is painted at once. In PostScript, PDF and SVG files this
+image is embedded as a bitmap of the frame resolution, keeping the files small.
+This level of detail painting can be disabled with `TPad::SetLevelOfDetail(kFALSE)`
+or the resource `Canvas.LevelOfDetail: false`.
+
 
 \anchor HP140
 ### The CANDLE and VIOLIN options
@@ -5809,6 +5819,20 @@ void THistPainter::PaintColorLevels(Option_t*)
    if (!fH->TestBit(TH1::kUserContour)) fH->SetContour(ndiv);
    Double_t scale = (dz ? ndivz / dz : 1.0);
 
+   // With more visible cells than pixels in the frame, the cells are accumulated in an image
+   // of the frame resolution, each pixel keeping the highest color of the cells it covers
+   Int_t nxPixels = 0, nyPixels = 0;
+   std::vector<Int_t> raster;
+   if (Hoption.System == kCARTESIAN && TPad::GetLevelOfDetail()) {
+      nxPixels = gPad->XtoPixel(gPad->GetUxmax()) - gPad->XtoPixel(gPad->GetUxmin());
+      nyPixels = gPad->YtoPixel(gPad->GetUymin()) - gPad->YtoPixel(gPad->GetUymax());
+      Long64_t ncells = Long64_t(Hparam.xlast-Hparam.xfirst+1)*(Hparam.ylast-Hparam.yfirst+1);
+      if (nxPixels > 0 && nyPixels > 0 && ncells > Long64_t(nxPixels)*nyPixels)
+         raster.assign(nxPixels*nyPixels, -1);
+   }
+   Double_t xPixelScale = nxPixels/(gPad->GetUxmax() - gPad->GetUxmin());
+   Double_t yPixelScale = nyPixels/(gPad->GetUymax() - gPad->GetUymin());
+
    Int_t color;
    TProfile2D* prof2d = dynamic_cast<TProfile2D*>(fH);
    for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j++) {
@@ -5885,6 +5909,20 @@ void THistPainter::PaintColorLevels(Option_t*)
 
          Int_t theColor = Int_t((color+0.99)*Float_t(ncolors)/Float_t(ndivz));
          if (theColor > ncolors-1) theColor = ncolors-1;
+         if (!raster.empty()) {
+            // pixels covered by the cell, at least the one containing its low edges
+            Int_t ix1 = TMath::Min(Int_t((xlow-gPad->GetUxmin())*xPixelScale), nxPixels-1);
+            Int_t ix2 = TMath::Min(Int_t(TMath::Ceil((xup-gPad->GetUxmin())*xPixelScale))-1, nxPixels-1);
+            Int_t iy1 = TMath::Min(Int_t((gPad->GetUymax()-yup)*yPixelScale), nyPixels-1);
+            Int_t iy2 = TMath::Min(Int_t(TMath::Ceil((gPad->GetUymax()-ylow)*yPixelScale))-1, nyPixels-1);
+            for (Int_t iy=iy1; iy<=TMath::Max(iy1,iy2); iy++) {
+               for (Int_t ix=ix1; ix<=TMath::Max(ix1,ix2); ix++) {
+                  Int_t &pixel = raster[iy*nxPixels+ix];
+                  if (theColor > pixel) pixel = theColor;
+               }
+            }
+            continue;
+         }
          fH->SetFillColor(gStyle->GetColorPalette(theColor));
          fH->TAttFill::Modify();
          if (Hoption.System != kPOLAR) {
@@ -5900,6 +5938,8 @@ void THistPainter::PaintColorLevels(Option_t*)
       }
    }
 
+   if (!raster.empty()) PaintColorLevelsRaster(raster, nxPixels, nyPixels);
+
    if (Hoption.Zscale) PaintPalette();
 
    fH->SetFillStyle(fillsav);
@@ -5908,6 +5948,70 @@ void THistPainter::PaintColorLevels(Option_t*)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Paint the image of the frame accumulated by PaintColorLevels when the
+/// visible cells outnumber the pixels of the frame (see TPad::SetLevelOfDetail).
+///
+/// The image has nx x ny pixels, from the top left to the bottom right corner of
+/// the frame, each one holding the index of its color in the palette, or -1 if
+/// no cell was painted there. The PostScript, PDF and SVG outputs embed it as a
+/// cell array, with the empty pixels taking the color of the frame background,
+/// unless the histogram is drawn with the option SAME.
+/// On the screen and in the other outputs, each run of pixels of the same color
+/// along a row is painted as one box.
+
+void THistPainter::PaintColorLevelsRaster(const std::vector<Int_t> &raster, Int_t nx, Int_t ny)
+{
+   const Double_t uxmin = gPad->GetUxmin();
+   const Double_t uymax = gPad->GetUymax();
+   const Double_t dx = (gPad->GetUxmax() - uxmin)/nx;
+   const Double_t dy = (uymax - gPad->GetUymin())/ny;
+
+   const Bool_t cellArray = gVirtualPS && !Hoption.Same && (gVirtualPS->InheritsFrom("TPostScript") ||
+                                           gVirtualPS->InheritsFrom("TPDF") ||
+                                           gVirtualPS->InheritsFrom("TSVG"));
+   if (cellArray) {
+      auto toRGB = [](Int_t color, Int_t *rgb) {
+         TColor *col = gROOT->GetColor(color);
+         rgb[0] = col ? Int_t(255*col->GetRed()   + 0.5) : 255;
+         rgb[1] = col ? Int_t(255*col->GetGreen() + 0.5) : 255;
+         rgb[2] = col ? Int_t(255*col->GetBlue()  + 0.5) : 255;
+      };
+      const Int_t ncolors = gStyle->GetNumberOfColors();
+      std::vector<Int_t> palette(3*ncolors);
+      for (Int_t i=0; i<ncolors; i++) toRGB(gStyle->GetColorPalette(i), &palette[3*i]);
+      Int_t background[3];
+      toRGB(gPad->GetFrameFillStyle() ? gPad->GetFrameFillColor() : gPad->GetFillColor(), background);
+
+      gVirtualPS->CellArrayBegin(nx, ny, uxmin, uxmin + dx, uymax - dy, uymax);
+      for (auto index : raster) {
+         const Int_t *rgb = index < 0 ? background : &palette[3*index];
+         gVirtualPS->CellArrayFill(rgb[0], rgb[1], rgb[2]);
+      }
+      gVirtualPS->CellArrayEnd();
+      if (gPad->IsBatch() || !gPad->GetPainter()) return;
+   }
+
+   for (Int_t iy=0; iy<ny; iy++) {
+      const Int_t *row = &raster[iy*nx];
+      for (Int_t ix=0; ix<nx;) {
+         Int_t ixlast = ix;
+         while (ixlast+1 < nx && row[ixlast+1] == row[ix]) ixlast++;
+         if (row[ix] >= 0) {
+            fH->SetFillColor(gStyle->GetColorPalette(row[ix]));
+            fH->TAttFill::Modify();
+            Double_t xlow = uxmin + ix*dx;
+            Double_t xup  = uxmin + (ixlast+1)*dx;
+            Double_t yup  = uymax - iy*dy;
+            Double_t ylow = yup - dy;
+            if (cellArray) gPad->GetPainter()->DrawBox(xlow, ylow, xup, yup, TVirtualPadPainter::kFilled);
+            else           gPad->PaintBox(xlow, ylow, xup, yup);
+         }
+         ix = ixlast+1;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// [Control function to draw a 2D histogram as a contour plot.](\ref HP16)
 
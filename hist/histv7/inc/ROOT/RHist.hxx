@@ -24,6 +24,7 @@
 #include "ROOT/RLogger.hxx"
 #include <initializer_list>
 #include <stdexcept>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -159,6 +160,14 @@ public:
    /// Get the uncertainty on the content of the bin at `x`.
    double GetBinUncertainty(const CoordArray_t &x) const { return fImpl->GetBinUncertainty(x); }
 
+   /// Add the histograms in `others` to this one, see `Add()`. Throws if their axis binnings differ.
+   /// This is the interface used by RDataFrame to merge the partial results of the processing slots.
+   void Merge(const std::vector<RHist *> &others)
+   {
+      for (const RHist *other : others)
+         Add(*this, *other);
+   }
+
    const_iterator begin() const { return const_iterator(*fImpl, 1); }
 
    const_iterator end() const { return const_iterator(*fImpl, fImpl->GetNBinsNoOver() + 1); }
@@ -0,0 +1,58 @@
+/// \file ROOT/RHistConvert.hxx
+/// \ingroup HistV7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RHistConvert
+#define ROOT7_RHistConvert
+
+#include "ROOT/RHist.hxx"
+#include "ROOT/RStringView.hxx"
+
+#include <memory>
+
+class TH1D;
+class TH2D;
+
+namespace ROOT {
+namespace Experimental {
+
+/// \name Conversion between RHist and TH1
+///\{
+/// Convert histograms between ROOT 7 and ROOT 6, e.g. to draw, fit or store a RHist with the TH1 machinery.
+///
+/// The bin contents and the sums of squared weights, including the under- and overflow bins, are copied in one pass
+/// over the bins; both histogram classes order their bins with the first axis running fastest. Equidistant and
+/// irregular axes are converted to the corresponding binning, a growable axis to a fixed one of its current range:
+/// it has no under- and overflow bins, so the ones of the TH1 stay empty. The number of entries is copied; the
+/// moments of the TH1 are recomputed from the bin contents, as a RHist does not record them.
+///
+/// Converting from a TH1 without `Sumw2()` sets the sums of squared weights to the bin contents, i.e. the
+/// uncertainties are the Poisson ones that the TH1 reports.
+
+/// Create a TH1D called `name` with the binning and the content of `hist`.
+std::unique_ptr<TH1D> ConvertToTH1D(const RH1D &hist, std::string_view name);
+
+/// Create a TH2D called `name` with the binning and the content of `hist`.
+std::unique_ptr<TH2D> ConvertToTH2D(const RH2D &hist, std::string_view name);
+
+/// Create a RH1D with the binning and the content of `hist`.
+RH1D ConvertFromTH1D(const TH1D &hist);
+
+/// Create a RH2D with the binning and the content of `hist`.
+RH2D ConvertFromTH2D(const TH2D &hist);
+///\}
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -120,6 +120,9 @@ public:
    /// calls to Fill().
    int64_t GetEntries() const { return fEntries; }
 
+   /// Set the number of entries, e.g. when the bin contents are copied from another histogram.
+   void SetEntries(int64_t entries) { fEntries = entries; }
+
    /// Get the number of bins exluding under- and overflow.
    size_t sizeNoOver() const noexcept { return fBinContent.size(); }
 
@@ -0,0 +1,168 @@
+/// \file RHistConvert.cxx
+/// \ingroup HistV7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RHistConvert.hxx"
+
+#include "TArrayD.h"
+#include "TAxis.h"
+#include "TH1D.h"
+#include "TH2D.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+namespace {
+
+/// The configuration of a RAxis with the binning of `axis`.
+RAxisConfig AxisConfigFromTAxis(const TAxis &axis)
+{
+   const TArrayD &borders = *axis.GetXbins();
+   if (borders.GetSize() == 0)
+      return RAxisConfig(axis.GetTitle(), axis.GetNbins(), axis.GetXmin(), axis.GetXmax());
+   return RAxisConfig(axis.GetTitle(), std::vector<double>(borders.GetArray(), borders.GetArray() + borders.GetSize()));
+}
+
+/// Give `axis` the binning and the title of `raxis`, which has the same number of bins.
+void SetTAxisFromRAxis(TAxis &axis, const RAxisBase &raxis)
+{
+   axis.SetTitle(raxis.GetTitle().c_str());
+   if (auto irregular = dynamic_cast<const RAxisIrregular *>(&raxis))
+      axis.Set(raxis.GetNBinsNoOver(), irregular->GetBinBorders().data());
+}
+
+/// The local bin index on `axis` of the TH1 bin `bin` of an axis with `nBins` bins; `kInvalidBin` for the under- and
+/// overflow bins of a growable axis.
+int LocalBinFromTH1Bin(int bin, int nBins, const RAxisBase &axis)
+{
+   if (bin == 0)
+      return axis.GetUnderflowBin();
+   if (bin == nBins + 1)
+      return axis.GetOverflowBin();
+   return bin;
+}
+
+/// Call `f(binidx, th1Bin)` for all the bins of `impl`, where `binidx` is the bin index in `impl` and `th1Bin` the
+/// global bin number of the same bin in `th1`, which has the same number of bins on each axis.
+template <class IMPL, class F>
+void ForEachBin(const IMPL &impl, const TH1 &th1, F &&f)
+{
+   constexpr int kNDim = IMPL::GetNDim();
+   const int nx = th1.GetNbinsX();
+   // A single row of TH1 bins for a one-dimensional histogram.
+   const int ny = kNDim > 1 ? th1.GetNbinsY() : -1;
+   for (int iy = 0; iy <= ny + 1; ++iy) {
+      const bool regularRow = kNDim == 1 || (iy >= 1 && iy <= ny);
+      typename IMPL::BinArray_t localBins{};
+      if (kNDim > 1) {
+         localBins[kNDim - 1] = LocalBinFromTH1Bin(iy, ny, impl.GetAxis(kNDim - 1));
+         if (localBins[kNDim - 1] == RAxisBase::kInvalidBin)
+            continue;
+      }
+      const int th1RowBin = th1.GetBin(0, iy);
+      auto overflowBin = [&](int ix) {
+         localBins[0] = LocalBinFromTH1Bin(ix, nx, impl.GetAxis(0));
+         if (localBins[0] != RAxisBase::kInvalidBin)
+            f(impl.GetBinIndexFromLocalBins(localBins), th1RowBin + ix);
+      };
+      if (!regularRow) {
+         for (int ix = 0; ix <= nx + 1; ++ix)
+            overflowBin(ix);
+         continue;
+      }
+      // The regular bins of a row are contiguous in both histograms.
+      const int firstBinIdx = 1 + (kNDim > 1 ? nx * (iy - 1) : 0);
+      overflowBin(0);
+      for (int ix = 1; ix <= nx; ++ix)
+         f(firstBinIdx + ix - 1, th1RowBin + ix);
+      overflowBin(nx + 1);
+   }
+}
+
+/// Copy the bin contents, the sums of squared weights and the number of entries of `hist` to `th1`.
+template <class RHIST>
+void CopyToTH1(const RHIST &hist, TH1 &th1, TArrayD &th1Content)
+{
+   const auto &impl = *hist.GetImpl();
+   const auto &stat = impl.GetStat();
+   th1.SetDirectory(nullptr);
+   th1.Sumw2();
+   double *content = th1Content.GetArray();
+   double *sumw2 = th1.GetSumw2()->GetArray();
+   ForEachBin(impl, th1, [&](int binidx, int th1Bin) {
+      content[th1Bin] = stat.GetBinContent(binidx);
+      sumw2[th1Bin] = stat.GetSumOfSquaredWeights(binidx);
+   });
+   th1.ResetStats();
+   th1.SetEntries(hist.GetEntries());
+}
+
+/// Copy the bin contents, the sums of squared weights and the number of entries of `th1` to `hist`.
+template <class RHIST>
+void CopyFromTH1(const TH1 &th1, const TArrayD &th1Content, RHIST &hist)
+{
+   auto &impl = *hist.GetImpl();
+   auto &stat = impl.GetStat();
+   const double *content = th1Content.GetArray();
+   const TArrayD &th1Sumw2 = *th1.GetSumw2();
+   const double *sumw2 = th1Sumw2.GetSize() ? th1Sumw2.GetArray() : nullptr;
+   ForEachBin(impl, th1, [&](int binidx, int th1Bin) {
+      stat.GetBinContent(binidx) = content[th1Bin];
+      stat.GetSumOfSquaredWeights(binidx) = sumw2 ? sumw2[th1Bin] : std::abs(content[th1Bin]);
+   });
+   stat.SetEntries(std::llround(th1.GetEntries()));
+}
+
+} // unnamed namespace
+
+std::unique_ptr<TH1D> ROOT::Experimental::ConvertToTH1D(const RH1D &hist, std::string_view name)
+{
+   const auto &impl = *hist.GetImpl();
+   const RAxisBase &xaxis = impl.GetAxis(0);
+   auto th1 = std::make_unique<TH1D>(std::string(name).c_str(), impl.GetTitle().c_str(), xaxis.GetNBinsNoOver(),
+                                     xaxis.GetMinimum(), xaxis.GetMaximum());
+   SetTAxisFromRAxis(*th1->GetXaxis(), xaxis);
+   CopyToTH1(hist, *th1, *th1);
+   return th1;
+}
+
+std::unique_ptr<TH2D> ROOT::Experimental::ConvertToTH2D(const RH2D &hist, std::string_view name)
+{
+   const auto &impl = *hist.GetImpl();
+   const RAxisBase &xaxis = impl.GetAxis(0);
+   const RAxisBase &yaxis = impl.GetAxis(1);
+   auto th2 = std::make_unique<TH2D>(std::string(name).c_str(), impl.GetTitle().c_str(), xaxis.GetNBinsNoOver(),
+                                     xaxis.GetMinimum(), xaxis.GetMaximum(), yaxis.GetNBinsNoOver(),
+                                     yaxis.GetMinimum(), yaxis.GetMaximum());
+   SetTAxisFromRAxis(*th2->GetXaxis(), xaxis);
+   SetTAxisFromRAxis(*th2->GetYaxis(), yaxis);
+   CopyToTH1(hist, *th2, *th2);
+   return th2;
+}
+
+RH1D ROOT::Experimental::ConvertFromTH1D(const TH1D &hist)
+{
+   RH1D ret(hist.GetTitle(), AxisConfigFromTAxis(*hist.GetXaxis()));
+   CopyFromTH1(hist, hist, ret);
+   return ret;
+}
+
+RH2D ROOT::Experimental::ConvertFromTH2D(const TH2D &hist)
+{
+   RH2D ret(hist.GetTitle(), AxisConfigFromTAxis(*hist.GetXaxis()), AxisConfigFromTAxis(*hist.GetYaxis()));
+   CopyFromTH1(hist, hist, ret);
+   return ret;
+}
@@ -56,3 +56,20 @@ TEST(HistAddTest, AddHist) {
    EXPECT_EQ(2, hTo.GetEntries());
    EXPECT_FLOAT_EQ(0.59f, hTo.GetBinContent({0.1111}));
 }
+
+// Test that Merge() adds all the histograms
+TEST(HistAddTest, Merge) {
+   ROOT::Experimental::RH1D hist({10, 0., 1.});
+   ROOT::Experimental::RH1D other1({10, 0., 1.});
+   ROOT::Experimental::RH1D other2({10, 0., 1.});
+   hist.Fill({0.15});
+   other1.Fill({0.15}, 2.);
+   other2.Fill({0.95});
+   hist.Merge({&other1, &other2});
+   EXPECT_EQ(3, hist.GetEntries());
+   EXPECT_DOUBLE_EQ(3., hist.GetBinContent({0.15}));
+   EXPECT_DOUBLE_EQ(1., hist.GetBinContent({0.95}));
+
+   ROOT::Experimental::RH1D different({5, 0., 1.});
+   EXPECT_THROW(hist.Merge({&different}), std::runtime_error);
+}
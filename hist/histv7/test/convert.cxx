@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+
+#include "ROOT/RHistConvert.hxx"
+
+#include "TH1D.h"
+#include "TH2D.h"
+
+#include <cmath>
+
+using namespace ROOT::Experimental;
+
+// Test the round trip RH1D -> TH1D -> RH1D, including the under- and overflow bins
+TEST(HistConvertTest, RoundTrip1D)
+{
+   RH1D hist("title", RAxisConfig("x", {0., 1., 3., 6., 10.}));
+   hist.Fill({-1.}, 2.);
+   hist.Fill({0.5});
+   hist.Fill({2.});
+   hist.Fill({2.}, 3.);
+   hist.Fill({42.}, 0.5);
+
+   auto th1 = ConvertToTH1D(hist, "th1");
+   EXPECT_STREQ("th1", th1->GetName());
+   EXPECT_STREQ("title", th1->GetTitle());
+   EXPECT_STREQ("x", th1->GetXaxis()->GetTitle());
+   EXPECT_EQ(nullptr, th1->GetDirectory());
+   ASSERT_EQ(4, th1->GetNbinsX());
+   EXPECT_DOUBLE_EQ(6., th1->GetXaxis()->GetBinLowEdge(4));
+   EXPECT_DOUBLE_EQ(5, th1->GetEntries());
+   EXPECT_DOUBLE_EQ(2., th1->GetBinContent(0));
+   EXPECT_DOUBLE_EQ(1., th1->GetBinContent(1));
+   EXPECT_DOUBLE_EQ(4., th1->GetBinContent(2));
+   EXPECT_DOUBLE_EQ(0.5, th1->GetBinContent(5));
+   EXPECT_DOUBLE_EQ(std::sqrt(10.), th1->GetBinError(2));
+   EXPECT_DOUBLE_EQ(5., th1->GetSumOfWeights());
+   EXPECT_DOUBLE_EQ((0.5 + 2. * 4.) / 5., th1->GetMean());
+
+   RH1D back = ConvertFromTH1D(*th1);
+   EXPECT_EQ(5, back.GetEntries());
+   EXPECT_TRUE(back.GetImpl()->GetAxis(0).HasSameBinningAs(hist.GetImpl()->GetAxis(0)));
+   for (double x : {-1., 0.5, 2., 4., 8., 42.}) {
+      EXPECT_DOUBLE_EQ(hist.GetBinContent({x}), back.GetBinContent({x}));
+      EXPECT_DOUBLE_EQ(hist.GetBinUncertainty({x}), back.GetBinUncertainty({x}));
+   }
+}
+
+// Test the round trip TH2D -> RH2D -> TH2D
+TEST(HistConvertTest, RoundTrip2D)
+{
+   const double ybins[] = {-1., 0., 2.};
+   TH2D th2("th2", "title", 5, 0., 5., 2, ybins);
+   th2.SetDirectory(nullptr);
+   th2.Fill(-1., 1.);
+   th2.Fill(0.5, -0.5, 2.);
+   th2.Fill(3.5, 1.5);
+   th2.Fill(3.5, 7.);
+   th2.Fill(9., 9., 3.);
+
+   RH2D hist = ConvertFromTH2D(th2);
+   EXPECT_EQ(5, hist.GetEntries());
+   EXPECT_EQ("title", hist.GetImpl()->GetTitle());
+   EXPECT_DOUBLE_EQ(1., hist.GetBinContent({-1., 1.}));
+   EXPECT_DOUBLE_EQ(2., hist.GetBinContent({0.5, -0.5}));
+   EXPECT_DOUBLE_EQ(1., hist.GetBinContent({3.5, 1.5}));
+   EXPECT_DOUBLE_EQ(1., hist.GetBinContent({3.5, 7.}));
+   EXPECT_DOUBLE_EQ(3., hist.GetBinContent({9., 9.}));
+   EXPECT_DOUBLE_EQ(2., hist.GetBinUncertainty({0.5, -0.5}));
+
+   auto back = ConvertToTH2D(hist, "back");
+   ASSERT_EQ(th2.GetNcells(), back->GetNcells());
+   for (int bin = 0; bin < th2.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(th2.GetBinContent(bin), back->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(th2.GetBinError(bin), back->GetBinError(bin));
+   }
+   EXPECT_DOUBLE_EQ(th2.GetEntries(), back->GetEntries());
+}
+
+// Without Sumw2(), the uncertainties of the TH1 are the Poisson ones
+TEST(HistConvertTest, NoSumw2)
+{
+   TH1D th1("th1", "", 2, 0., 2.);
+   th1.SetDirectory(nullptr);
+   th1.SetBinContent(1, 4.);
+   RH1D hist = ConvertFromTH1D(th1);
+   EXPECT_DOUBLE_EQ(4., hist.GetBinContent({0.5}));
+   EXPECT_DOUBLE_EQ(2., hist.GetBinUncertainty({0.5}));
+}
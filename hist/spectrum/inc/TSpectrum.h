@@ -12,6 +12,9 @@
 #define ROOT_TSpectrum
 
 #include "TNamed.h"
+#include "ROOT/RSpan.hxx"
+
+#include <vector>
 
 class TH1;
 
@@ -72,6 +75,10 @@ public:
    Int_t               SearchHighRes(Double_t *source,Double_t *destVector, Int_t ssize,Double_t sigma, Double_t threshold,bool backgroundRemove,Int_t deconIterations,bool markov, Int_t averWindow);
    Int_t               Search1HighRes(Double_t *source,Double_t *destVector, Int_t ssize,Double_t sigma, Double_t threshold,bool backgroundRemove,Int_t deconIterations,bool markov, Int_t averWindow);
 
+   //processing of many spectra, concurrently with implicit multi-threading
+   const char         *BackgroundN(std::span<Double_t *const> spectra, Int_t ssize,Int_t numberIterations,Int_t direction, Int_t filterOrder,bool smoothing,Int_t smoothWindow,bool compton);
+   std::vector<std::vector<Double_t>> SearchHighResN(std::span<Double_t *const> sources, std::span<Double_t *const> destVectors, Int_t ssize,Double_t sigma, Double_t threshold,bool backgroundRemove,Int_t deconIterations,bool markov, Int_t averWindow);
+
    static Int_t        StaticSearch(const TH1 *hist, Double_t sigma=2, Option_t *option="goff", Double_t threshold=0.05);
    static TH1         *StaticBackground(const TH1 *hist,Int_t niter=20, Option_t *option="");
 
@@ -7,7 +7,12 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TROOT.h"
 #include "snprintf.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
 
 /** \class TSpectrum
     \ingroup Spectrum
@@ -2574,6 +2579,80 @@ Int_t TSpectrum::Search1HighRes(Double_t *source,Double_t *destVector, int ssize
                         deconIterations,markov,averWindow);
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call f(i) for all the spectra i < n, concurrently if implicit multi-threading is enabled.
+
+template <class F>
+void ForEachSpectrum(UInt_t n, F &&f)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && n > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(f, ROOT::TSeqU(n));
+      return;
+   }
+#endif
+   for (UInt_t i : ROOT::TSeqU(n))
+      f(i);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Estimate the background of each of the `spectra` of size `ssize`, see
+/// Background(Double_t *spectrum, ...) for the parameters. With implicit
+/// multi-threading (ROOT::EnableImplicitMT) the spectra are processed
+/// concurrently, which is useful for the spectra of the many channels of a
+/// detector.
+///
+/// Returns the error message of Background, or 0 if there is none.
+
+const char *TSpectrum::BackgroundN(std::span<Double_t *const> spectra, Int_t ssize,
+                                   Int_t numberIterations, Int_t direction, Int_t filterOrder,
+                                   bool smoothing, Int_t smoothWindow, bool compton)
+{
+   std::vector<const char *> errors(spectra.size(), nullptr);
+   ForEachSpectrum(spectra.size(), [&](UInt_t i) {
+      errors[i] = Background(spectra[i], ssize, numberIterations, direction, filterOrder, smoothing, smoothWindow,
+                             compton);
+   });
+   // the errors only depend on the parameters, common to all the spectra
+   return errors.empty() ? nullptr : errors[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Search the peaks in each of the `sources` of size `ssize`, storing the
+/// deconvolved spectra in `destVectors`, see SearchHighRes for the parameters.
+/// With implicit multi-threading (ROOT::EnableImplicitMT) the spectra are
+/// processed concurrently.
+///
+/// Returns the positions of the peaks found in each spectrum, at most the
+/// maximum number of peaks of this TSpectrum per spectrum. The peaks found by
+/// the last call of SearchHighRes (GetNPeaks, GetPositionX) are left unchanged.
+
+std::vector<std::vector<Double_t>>
+TSpectrum::SearchHighResN(std::span<Double_t *const> sources, std::span<Double_t *const> destVectors, Int_t ssize,
+                          Double_t sigma, Double_t threshold, bool backgroundRemove, Int_t deconIterations,
+                          bool markov, Int_t averWindow)
+{
+   if (sources.size() != destVectors.size()) {
+      Error("SearchHighResN", "The numbers of source spectra %zu and of destination spectra %zu differ",
+            sources.size(), destVectors.size());
+      return {};
+   }
+   std::vector<std::vector<Double_t>> positions(sources.size());
+   ForEachSpectrum(sources.size(), [&](UInt_t i) {
+      // the peaks are stored in the TSpectrum, so each spectrum needs its own
+      TSpectrum spectrum(fMaxPeaks, fResolution);
+      const Int_t npeaks = spectrum.SearchHighRes(sources[i], destVectors[i], ssize, sigma, threshold,
+                                                  backgroundRemove, deconIterations, markov, averWindow);
+      positions[i].assign(spectrum.fPositionX, spectrum.fPositionX + npeaks);
+   });
+   return positions;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Static function, interface to TSpectrum::Search.
 
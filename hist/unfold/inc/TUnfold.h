@@ -207,6 +207,13 @@ class TUnfold : public TObject {
    TMatrixDSparse *fEinv;
    /// matrix E
    TMatrixDSparse *fE;
+   /// cache of A<sup>T</sup>Vyy<sup>-1</sup>, which does not depend on tau
+   TMatrixDSparse *fAtVyyInv; //!
+   /// cache of A<sup>T</sup>Vyy<sup>-1</sup>A, which does not depend on tau
+   TMatrixDSparse *fAtVyyInvA; //!
+   /// cache of L<sup>T</sup>L, which does not depend on tau
+   TMatrixDSparse *fLSquared; //!
+   void ClearTauIndependentProducts(void); // clear the caches of the products which do not depend on tau
  protected:
    // Int_t IsNotSymmetric(TMatrixDSparse const &m) const;
    virtual Double_t DoUnfold(void);     // the unfolding algorithm
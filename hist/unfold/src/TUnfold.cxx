@@ -120,10 +120,58 @@ along with TUnfold.  If not, see <http://www.gnu.org/licenses/>.
 #include <TMath.h>
 #include "TUnfold.h"
 #include "TGraph.h"
+#include "TROOT.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
+
+#include <algorithm>
 #include <map>
 #include <vector>
 
+namespace {
+
+/// Nonzero elements of a sparse matrix, row by row
+struct SparseElements {
+   std::vector<Int_t> fRows;
+   std::vector<Int_t> fCols;
+   std::vector<Double_t> fData;
+};
+
+/// Fill the nonzero elements of the rows of a matrix product, calling
+/// fillRows(first,last,elements) to append the elements of the rows [first,last).
+/// If the implicit multi-threading is enabled and the product needs more than
+/// about nOperations=1E6 multiplications, the rows are filled in parallel in chunks,
+/// which are concatenated in order such that the result does not change.
+template <typename F>
+void FillRows(Int_t nRows, Double_t nOperations, F fillRows, SparseElements &elements)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && (nOperations > 1.E6) && (nRows > 1)) {
+      const Int_t nChunks = std::min<Int_t>(nRows, 4 * ROOT::GetThreadPoolSize());
+      std::vector<SparseElements> chunks(nChunks);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t chunk) {
+         fillRows(Int_t(Long64_t(nRows) * chunk / nChunks), Int_t(Long64_t(nRows) * (chunk + 1) / nChunks),
+                  chunks[chunk]);
+      }, ROOT::TSeqI(nChunks));
+      for (const SparseElements &chunk : chunks) {
+         elements.fRows.insert(elements.fRows.end(), chunk.fRows.begin(), chunk.fRows.end());
+         elements.fCols.insert(elements.fCols.end(), chunk.fCols.begin(), chunk.fCols.end());
+         elements.fData.insert(elements.fData.end(), chunk.fData.begin(), chunk.fData.end());
+      }
+      return;
+   }
+#else
+   (void)nOperations;
+#endif
+   fillRows(0, nRows, elements);
+}
+
+} // namespace
+
 //#define DEBUG
 //#define DEBUG_DETAIL
 //#define FORCE_EIGENVALUE_DECOMPOSITION
@@ -140,6 +188,7 @@ TUnfold::~TUnfold(void)
    DeleteMatrix(&fY);
    DeleteMatrix(&fX0);
    DeleteMatrix(&fVyyInv);
+   ClearTauIndependentProducts();
 
    ClearResults();
 }
@@ -181,6 +230,9 @@ void TUnfold::InitTUnfold(void)
    fDXDY = 0;
    fEinv = 0;
    fE = 0;
+   fAtVyyInv = 0;
+   fAtVyyInvA = 0;
+   fLSquared = 0;
    fEpsMatrix=1.E-13;
    fIgnoredBins=0;
 }
@@ -213,6 +265,21 @@ void TUnfold::DeleteMatrix(TMatrixDSparse **m)
    *m=0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the matrix products of DoUnfold which do not depend on tau.
+///
+/// They are kept from one call of DoUnfold to the next, such that a scan of
+/// tau only computes them once, and have to be cleared when the matrix A,
+/// the regularisation conditions L or the inverse of the input covariance
+/// change.
+
+void TUnfold::ClearTauIndependentProducts(void)
+{
+   DeleteMatrix(&fAtVyyInv);
+   DeleteMatrix(&fAtVyyInvA);
+   DeleteMatrix(&fLSquared);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset all results.
 
@@ -304,14 +371,21 @@ Double_t TUnfold::DoUnfold(void)
    //              T
    //            fA fV  = mAt_V
    //
-   TMatrixDSparse *AtVyyinv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+   // this matrix and the products AtVyyinv*fA, lSquared do not depend on tau,
+   // they are computed once for all calls of DoUnfold
+   if(!fAtVyyInv) {
+      fAtVyyInv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+      fAtVyyInvA=MultiplyMSparseMSparse(fAtVyyInv,fA);
+      fLSquared=MultiplyMSparseTranspMSparse(fL,fL);
+   }
+   const TMatrixDSparse *AtVyyinv=fAtVyyInv;
+   const TMatrixDSparse *lSquared=fLSquared;
    //
    // get
    //       T
    //     fA fVyyinv fY + fTauSquared fBiasScale Lsquared fX0 = rhs
    //
    TMatrixDSparse *rhs=MultiplyMSparseM(AtVyyinv,fY);
-   TMatrixDSparse *lSquared=MultiplyMSparseTranspMSparse(fL,fL);
    if (fBiasScale != 0.0) {
      TMatrixDSparse *rhs2=MultiplyMSparseM(lSquared,fX0);
       AddMSparse(rhs, fTauSquared * fBiasScale ,rhs2);
@@ -322,7 +396,7 @@ Double_t TUnfold::DoUnfold(void)
    // get matrix
    //              T
    //           (fA fV)fA + fTauSquared*fLsquared  = fEinv
-   fEinv=MultiplyMSparseMSparse(AtVyyinv,fA);
+   fEinv=new TMatrixDSparse(*fAtVyyInvA);
    AddMSparse(fEinv,fTauSquared,lSquared);
 
    //
@@ -428,8 +502,6 @@ Double_t TUnfold::DoUnfold(void)
       DeleteMatrix(&corr);
    }
 
-   DeleteMatrix(&AtVyyinv);
-
    //
    // get error matrix on x
    //   fDXDY * Vyy * fDXDY#
@@ -492,7 +564,6 @@ Double_t TUnfold::DoUnfold(void)
    DeleteMatrix(&epsilon);
 
    DeleteMatrix(&LsquaredDx);
-   DeleteMatrix(&lSquared);
 
    // calculate/store matrices defining the derivatives dx/dA
    fDXDAM[0]=new TMatrixDSparse(*fE);
@@ -637,42 +708,38 @@ TMatrixDSparse *TUnfold::MultiplyMSparseMSparse(const TMatrixDSparse *a,
       if(a_rows[irow+1]>a_rows[irow]) nMax += b->GetNcols();
    }
    if((nMax>0)&&(a_cols)&&(b_cols)) {
-      Int_t *r_rows=new Int_t[nMax];
-      Int_t *r_cols=new Int_t[nMax];
-      Double_t *r_data=new Double_t[nMax];
-      Double_t *row_data=new Double_t[b->GetNcols()];
-      Int_t n=0;
-      for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
-         if(a_rows[irow+1]<=a_rows[irow]) continue;
-         // clear row data
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            row_data[icol]=0.0;
-         }
-         // loop over a-columns in this a-row
-         for(Int_t ia=a_rows[irow];ia<a_rows[irow+1];ia++) {
-            Int_t k=a_cols[ia];
-            // loop over b-columns in b-row k
-            for(Int_t ib=b_rows[k];ib<b_rows[k+1];ib++) {
-               row_data[b_cols[ib]] += a_data[ia]*b_data[ib];
+      auto fillRows=[&](Int_t first,Int_t last,SparseElements &r_elements) {
+         std::vector<Double_t> row_data(b->GetNcols());
+         for (Int_t irow = first; irow < last; irow++) {
+            if(a_rows[irow+1]<=a_rows[irow]) continue;
+            // clear row data
+            std::fill(row_data.begin(),row_data.end(),0.0);
+            // loop over a-columns in this a-row
+            for(Int_t ia=a_rows[irow];ia<a_rows[irow+1];ia++) {
+               Int_t k=a_cols[ia];
+               // loop over b-columns in b-row k
+               for(Int_t ib=b_rows[k];ib<b_rows[k+1];ib++) {
+                  row_data[b_cols[ib]] += a_data[ia]*b_data[ib];
+               }
             }
-         }
-         // store nonzero elements
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            if(row_data[icol] != 0.0) {
-               r_rows[n]=irow;
-               r_cols[n]=icol;
-               r_data[n]=row_data[icol];
-               n++;
+            // store nonzero elements
+            for(Int_t icol=0;icol<b->GetNcols();icol++) {
+               if(row_data[icol] != 0.0) {
+                  r_elements.fRows.push_back(irow);
+                  r_elements.fCols.push_back(icol);
+                  r_elements.fData.push_back(row_data[icol]);
+               }
             }
          }
-      }
+      };
+      SparseElements r_elements;
+      FillRows(a->GetNrows(),Double_t(a_rows[a->GetNrows()])*b->GetNcols(),
+               fillRows,r_elements);
+      Int_t n=r_elements.fData.size();
       if(n>0) {
-         r->SetMatrixArray(n,r_rows,r_cols,r_data);
+         r->SetMatrixArray(n,r_elements.fRows.data(),r_elements.fCols.data(),
+                           r_elements.fData.data());
       }
-      delete[] r_rows;
-      delete[] r_cols;
-      delete[] r_data;
-      delete[] row_data;
    }
 
    return r;
@@ -866,52 +933,52 @@ TMatrixDSparse *TUnfold::MultiplyMSparseMSparseTranspVector
       v_rows=v_sparse->GetRowIndexArray();
       v_data=v_sparse->GetMatrixArray();
    }
-   Int_t num_r=num_m1*num_m2+1;
-   Int_t *row_r=new Int_t[num_r];
-   Int_t *col_r=new Int_t[num_r];
-   Double_t *data_r=new Double_t[num_r];
-   num_r=0;
-   for(Int_t i=0;i<m1->GetNrows();i++) {
-      for(Int_t j=0;j<m2->GetNrows();j++) {
-         data_r[num_r]=0.0;
-         Int_t index_m1=rows_m1[i];
-         Int_t index_m2=rows_m2[j];
-         while((index_m1<rows_m1[i+1])&&(index_m2<rows_m2[j+1])) {
-            Int_t k1=cols_m1[index_m1];
-            Int_t k2=cols_m2[index_m2];
-            if(k1<k2) {
-               index_m1++;
-            } else if(k1>k2) {
-               index_m2++;
-            } else {
-               if(v_sparse) {
-                  Int_t v_index=v_rows[k1];
-                  if(v_index<v_rows[k1+1]) {
-                     data_r[num_r] += data_m1[index_m1] * data_m2[index_m2]
-                        * v_data[v_index];
-                  }
-               } else if(v) {
-                  data_r[num_r] += data_m1[index_m1] * data_m2[index_m2]
-                     * (*v)(k1,0);
+   auto fillRows=[&](Int_t first,Int_t last,SparseElements &r_elements) {
+      for(Int_t i=first;i<last;i++) {
+         if(rows_m1[i]>=rows_m1[i+1]) continue;
+         for(Int_t j=0;j<m2->GetNrows();j++) {
+            Double_t data_r=0.0;
+            Int_t index_m1=rows_m1[i];
+            Int_t index_m2=rows_m2[j];
+            while((index_m1<rows_m1[i+1])&&(index_m2<rows_m2[j+1])) {
+               Int_t k1=cols_m1[index_m1];
+               Int_t k2=cols_m2[index_m2];
+               if(k1<k2) {
+                  index_m1++;
+               } else if(k1>k2) {
+                  index_m2++;
                } else {
-                  data_r[num_r] += data_m1[index_m1] * data_m2[index_m2];
+                  if(v_sparse) {
+                     Int_t v_index=v_rows[k1];
+                     if(v_index<v_rows[k1+1]) {
+                        data_r += data_m1[index_m1] * data_m2[index_m2]
+                           * v_data[v_index];
+                     }
+                  } else if(v) {
+                     data_r += data_m1[index_m1] * data_m2[index_m2]
+                        * (*v)(k1,0);
+                  } else {
+                     data_r += data_m1[index_m1] * data_m2[index_m2];
+                  }
+                  index_m1++;
+                  index_m2++;
                }
-               index_m1++;
-               index_m2++;
             }
-         }
-         if(data_r[num_r] !=0.0) {
-            row_r[num_r]=i;
-            col_r[num_r]=j;
-            num_r++;
+            if(data_r !=0.0) {
+               r_elements.fRows.push_back(i);
+               r_elements.fCols.push_back(j);
+               r_elements.fData.push_back(data_r);
+            }
          }
       }
-   }
+   };
+   SparseElements r_elements;
+   FillRows(m1->GetNrows(),Double_t(num_m1)*num_m2,fillRows,r_elements);
    TMatrixDSparse *r=CreateSparseMatrix(m1->GetNrows(),m2->GetNrows(),
-                                        num_r,row_r,col_r,data_r);
-   delete[] row_r;
-   delete[] col_r;
-   delete[] data_r;
+                                        r_elements.fData.size(),
+                                        r_elements.fRows.data(),
+                                        r_elements.fCols.data(),
+                                        r_elements.fData.data());
    return r;
 }
 
@@ -2016,6 +2083,7 @@ Bool_t TUnfold::AddRegularisationCondition
    // replace the old matrix fL
    if(r) {
       DeleteMatrix(&fL);
+      ClearTauIndependentProducts();
       fL=CreateSparseMatrix(rowMax+1,GetNx(),nF,l_row,l_col,l_data);
    }
    delete [] l_row;
@@ -2303,6 +2371,7 @@ Int_t TUnfold::SetInput(const TH1 *input, Double_t scaleBias,
                         const TH2 *hist_vyy_inv)
 {
   DeleteMatrix(&fVyyInv);
+  ClearTauIndependentProducts();
   fNdf=0;
 
   fBiasScale = scaleBias;
@@ -0,0 +1,131 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBlockCache
+#define ROOT_RBlockCache
+
+#include <ROOT/RRawFile.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RBlockCache RBlockCache.hxx
+ * \ingroup IO
+ *
+ * A persistent cache of the blocks of remote files on the local disk. Files are cut into blocks of fixed size;
+ * a block is stored in its own file `<directory>/<file id>/<block offset>` once it has been read from the remote
+ * file. The file id must identify the content of the remote file, e.g. the UUID of a ROOT file. Reads are served
+ * from the cached blocks where possible; the missing blocks are fetched in full, i.e. the reads are aligned to the
+ * block boundaries.
+ *
+ * Several processes can share the cache directory: blocks are written to a temporary file that is atomically
+ * renamed into place, and blocks of unexpected size are ignored. When the cache grows beyond its size limit, the
+ * least recently used blocks are removed; using a block updates its modification time.
+ *
+ * The process-wide cache returned by Get() is configured with the BlockCache.Dir, BlockCache.MaxSize (in MB) and
+ * BlockCache.BlockSize (in kB) resources. It is used by remote TFile and RRawFile implementations for files opened
+ * for reading.
+ */
+class RBlockCache {
+public:
+   /// Reads the given block-aligned requests from the remote file; must throw on failure
+   using FetchFunc_t = std::function<void(RRawFile::RIOVec *ioVec, unsigned int nReq)>;
+
+   static constexpr std::size_t kDefaultBlockSize = 256 * 1024;
+   static constexpr std::uint64_t kDefaultMaxSize = 10ull * 1024 * 1024 * 1024;
+
+private:
+   /// Up to that many consecutive missing blocks are fetched in a single request
+   static constexpr std::size_t kMaxBlocksPerRequest = 64;
+
+   std::string fDirectory;
+   std::uint64_t fMaxSize;
+   std::size_t fBlockSize;
+   /// Blocks stored by this process since the last clean-up; triggers the next one
+   std::atomic<std::uint64_t> fStoredSinceCleanUp;
+   std::atomic<std::uint64_t> fNHits{0};
+   std::atomic<std::uint64_t> fNMisses{0};
+   /// Only one thread of the process cleans up at a time
+   std::mutex fCleanUpMutex;
+
+   std::string GetBlockPath(const std::string &fileId, std::uint64_t offset) const;
+   bool LoadBlock(const std::string &path, unsigned char *buffer, std::size_t size);
+   void StoreBlock(const std::string &fileId, const std::string &path, const unsigned char *buffer, std::size_t size);
+
+public:
+   RBlockCache(std::string_view directory, std::uint64_t maxSize = kDefaultMaxSize,
+               std::size_t blockSize = kDefaultBlockSize);
+   RBlockCache(const RBlockCache &) = delete;
+   RBlockCache &operator=(const RBlockCache &) = delete;
+   ~RBlockCache() = default;
+
+   /// Returns the process-wide cache, or nullptr if no cache directory is configured
+   static std::shared_ptr<RBlockCache> Get();
+   /// Replaces the process-wide cache; nullptr disables caching for the files opened from now on
+   static void Set(std::shared_ptr<RBlockCache> cache);
+
+   /// Reads the ranges of the file identified by fileId, of size fileSize, from the cache. The missing blocks are
+   /// read with fetch() and added to the cache. Ranges beyond the end of the file are truncated.
+   void ReadV(const std::string &fileId, std::uint64_t fileSize, RRawFile::RIOVec *ioVec, unsigned int nReq,
+              const FetchFunc_t &fetch);
+
+   /// Removes the least recently used blocks until the cache is below 90% of its size limit. Called automatically
+   /// whenever the process has added a tenth of the size limit to the cache.
+   void CleanUp();
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+   std::size_t GetBlockSize() const { return fBlockSize; }
+   /// The number of blocks read from the cache
+   std::uint64_t GetNHits() const { return fNHits; }
+   /// The number of blocks fetched from the remote files
+   std::uint64_t GetNMisses() const { return fNMisses; }
+};
+
+/**
+ * \class RRawFileBlockCache RBlockCache.hxx
+ * \ingroup IO
+ *
+ * An RRawFile that reads another, remote RRawFile through an RBlockCache. As RRawFile has no notion of a file UUID,
+ * the cached blocks are keyed by the URL and the size of the file. RRawFile::Create() uses it for remote files if
+ * the process-wide cache is configured.
+ */
+class RRawFileBlockCache : public RRawFile {
+private:
+   std::unique_ptr<RRawFile> fRemote;
+   std::shared_ptr<RBlockCache> fCache;
+   std::string fFileId;
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   RRawFileBlockCache(std::unique_ptr<RRawFile> remote, std::shared_ptr<RBlockCache> cache);
+   std::unique_ptr<RRawFile> Clone() const final;
+   int GetFeatures() const final { return fRemote->GetFeatures() & kFeatureHasSize; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,71 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RFreeSegmentIndex
+#define ROOT_RFreeSegmentIndex
+
+#include <RtypesCore.h>
+
+#include <map>
+#include <set>
+#include <utility>
+
+class TFree;
+class TList;
+class TObjLink;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RFreeSegmentIndex RFreeSegmentIndex.hxx
+ * \ingroup IO
+ *
+ * An index of the free segments of a TFile, ordered by address and by size. The segments stay in the list of free
+ * segments of the file, ordered by address, which is the list written in the file; the index finds the best segment
+ * for a new record and the neighbours of a freed record in logarithmic time instead of by scanning the list.
+ *
+ * The modifications of the list must go through the index. The index is rebuilt if the number of segments in the
+ * list changed behind its back; the file drops the index when it replaces or empties its list.
+ */
+class RFreeSegmentIndex {
+   TList &fList;
+   /// The link of each segment in fList, by the first byte of the segment
+   std::map<Long64_t, TObjLink *> fLinks;
+   /// The size and the first byte of each segment
+   std::set<std::pair<Long64_t, Long64_t>> fSizes;
+
+   void Insert(TObjLink *link);
+   void Erase(const TFree &segment);
+   void Rebuild();
+   void Sync();
+
+public:
+   explicit RFreeSegmentIndex(TList &list);
+   RFreeSegmentIndex(const RFreeSegmentIndex &) = delete;
+   RFreeSegmentIndex &operator=(const RFreeSegmentIndex &) = delete;
+
+   /// Return the smallest segment where nbytes can be stored, either exactly or leaving room for the header of the
+   /// remaining gap; the segment with the lowest address among equally large ones. If there is none, the last
+   /// segment, which extends to the end of the file, is enlarged as in TFree::GetBestFree.
+   TFree *GetBestFree(Int_t nbytes);
+   /// Add the bytes [first, last] to the free segments, merging them with the adjacent segments, like
+   /// TFree::AddFree. Return the segment that contains them.
+   TFree *AddFree(Long64_t first, Long64_t last);
+   /// Change the bytes covered by a segment of the list.
+   void Resize(TFree &segment, Long64_t first, Long64_t last);
+   /// Remove a segment from the list and delete it.
+   void Remove(TFree *segment);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
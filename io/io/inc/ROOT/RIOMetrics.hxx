@@ -0,0 +1,125 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RIOMetrics
+#define ROOT_RIOMetrics
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+ * \class RIOMetrics RIOMetrics.hxx
+ * \ingroup IO
+ *
+ * Process-wide I/O counters, published by TFile and its remote implementations, the TFile caches, TBasket,
+ * TTreeCacheUnzip, TBranch and the RNTuple file page source. Unlike TTreePerfStats and RNTupleMetrics, which are
+ * attached to a single tree or reader, they cover all the reads of the process, such that the I/O of production
+ * jobs can be diagnosed without changing the job.
+ *
+ * Each thread increments its own set of counters, so that publishing does not contend between threads. Reading
+ * the metrics sums the counters of all threads, including the ones of the threads that have finished.
+ *
+ * The metrics are disabled by default, in which case publishing only costs a relaxed atomic load. They are enabled
+ * with Enable() or the `IO.Metrics` resource. They can be exported with ToJSON() and ToPrometheus(); THttpServer
+ * serves them as `io_metrics.json` and `io_metrics.txt`.
+ */
+class RIOMetrics {
+public:
+   enum ECounter : unsigned int {
+      /// Bytes requested by the readers of TFile (keys, baskets), whether served by a cache or by the storage
+      kBytesRequested,
+      /// Bytes read from the storage, including the reads of caches and read-ahead
+      kBytesRead,
+      /// Read calls to the storage, each vector read counting as one
+      kReadCalls,
+      /// Vector reads, i.e. reads of several byte ranges at once
+      kVectorReads,
+      /// Requests served by the read cache of a file (e.g. TTreeCache)
+      kCacheHits,
+      /// Requests not found in the read cache of a file
+      kCacheMisses,
+      /// Wall time spent decompressing, in nanoseconds
+      kUnzipTime,
+      /// Wall time spent deserializing TTree entries into memory, in nanoseconds
+      kDeserializeTime,
+      kNCounters
+   };
+   using Values_t = std::array<std::uint64_t, kNCounters>;
+
+   /// Adds the wall time of its scope to a time counter, if the metrics are enabled when it is created
+   class RTimer {
+      ECounter fCounter;
+      bool fIsActive;
+      std::chrono::steady_clock::time_point fStart;
+
+   public:
+      explicit RTimer(ECounter counter) : fCounter(counter), fIsActive(IsEnabled())
+      {
+         if (fIsActive)
+            fStart = std::chrono::steady_clock::now();
+      }
+      RTimer(const RTimer &) = delete;
+      RTimer &operator=(const RTimer &) = delete;
+      ~RTimer()
+      {
+         if (fIsActive)
+            Add(fCounter, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                            fStart).count());
+      }
+   };
+
+private:
+   /// 1 if enabled, 0 if disabled, -1 if not yet configured from the resources
+   static std::atomic<int> fgEnabled;
+
+   static bool ConfigureEnabled();
+   /// Returns the counters of the calling thread, registering them on first use
+   static std::atomic<std::uint64_t> *GetThreadCounters();
+
+public:
+   static bool IsEnabled()
+   {
+      const auto enabled = fgEnabled.load(std::memory_order_relaxed);
+      return enabled > 0 || (enabled < 0 && ConfigureEnabled());
+   }
+   static void Enable(bool enable = true);
+
+   static void Add(ECounter counter, std::uint64_t value)
+   {
+      if (IsEnabled())
+         GetThreadCounters()[counter].fetch_add(value, std::memory_order_relaxed);
+   }
+
+   /// Returns the counters summed over all threads
+   static Values_t GetValues();
+   /// Sets all counters to zero
+   static void Reset();
+
+   /// Returns the name of the counter in the JSON export, e.g. "bytesRead"
+   static const char *GetName(ECounter counter);
+   /// Returns a one-line description of the counter
+   static const char *GetDescription(ECounter counter);
+
+   /// Exports the counters as a JSON object, with the times in seconds
+   static std::string ToJSON();
+   /// Exports the counters in the Prometheus text format, as `root_io_*_total` counters with the times in seconds
+   static std::string ToPrometheus();
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -26,6 +26,8 @@ class RIoUring {
 private:
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
+   /// The number of read events submitted by SubmitReads() whose completion has not yet been reaped
+   std::uint32_t fNInFlight = 0;
 
 public:
    // Create an io_uring instance. The ring selects an appropriate queue depth. which can be queried
@@ -92,6 +94,8 @@ public:
       std::size_t fOutBytes = 0;
       /// The file descriptor
       int fFileDes = -1;
+      /// Set by the RIoUring instance when the read completed; only used by SubmitReads() and WaitForReads()
+      bool fIsDone = false;
    };
 
    /// Submit a number of read events and wait for completion. Events are submitted in batches if
@@ -167,6 +171,95 @@ public:
       }
       return;
    }
+
+   /// Submit a number of read events without waiting for their completion. The read events, and the buffers they
+   /// point to, must stay valid until they are marked as done by WaitForReads(). Reads from several calls to
+   /// SubmitReads() can be in flight at the same time; if the ring is full, the completions of earlier reads are
+   /// reaped first. Must not be mixed with concurrent calls to SubmitReadsAndWait().
+   void SubmitReads(RReadEvent *readEvents, unsigned int nReads) {
+      unsigned int nPrepared = 0;
+      for (unsigned int i = 0; i < nReads; ++i) {
+         if (readEvents[i].fFileDes == -1) {
+            throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(i) + "'");
+         }
+         if (readEvents[i].fBuffer == nullptr) {
+            throw std::runtime_error("null read buffer for read request '" + std::to_string(i) + "'");
+         }
+         readEvents[i].fIsDone = false;
+
+         if (fNInFlight + nPrepared == fDepth) {
+            // Submission queue is exhausted; flush what we have so far and make room by reaping a completion
+            SubmitPrepared(nPrepared);
+            nPrepared = 0;
+            ReapOne();
+         }
+
+         struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+         if (!sqe) {
+            throw std::runtime_error("get SQE failed for read request '" + std::to_string(i)
+               + "', error: " + std::string(strerror(errno)));
+         }
+         io_uring_prep_read(sqe,
+            readEvents[i].fFileDes,
+            readEvents[i].fBuffer,
+            readEvents[i].fSize,
+            readEvents[i].fOffset
+         );
+         sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+         io_uring_sqe_set_data(sqe, &readEvents[i]);
+         nPrepared++;
+      }
+      SubmitPrepared(nPrepared);
+   }
+
+   /// Block until all the given read events, previously passed to SubmitReads(), are done. Completions of other
+   /// in-flight read events that arrive in the meantime are recorded in their respective read events.
+   void WaitForReads(RReadEvent *readEvents, unsigned int nReads) {
+      for (unsigned int i = 0; i < nReads; ++i) {
+         while (!readEvents[i].fIsDone)
+            ReapOne();
+      }
+   }
+
+   /// The number of reads submitted by SubmitReads() that did not yet complete
+   std::uint32_t GetNInFlight() const {
+      return fNInFlight;
+   }
+
+private:
+   void SubmitPrepared(unsigned int nPrepared) {
+      if (nPrepared == 0)
+         return;
+      int submitted = io_uring_submit(&fRing);
+      if (submitted <= 0) {
+         throw std::runtime_error("ring submit failed, error: " + std::string(std::strerror(-submitted)));
+      }
+      if (submitted != static_cast<int>(nPrepared)) {
+         throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+            " events but requested " + std::to_string(nPrepared));
+      }
+      fNInFlight += nPrepared;
+   }
+
+   void ReapOne() {
+      R__ASSERT(fNInFlight > 0);
+      struct io_uring_cqe *cqe;
+      int ret = io_uring_wait_cqe(&fRing, &cqe);
+      if (ret < 0) {
+         throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+      }
+      auto event = reinterpret_cast<RReadEvent *>(io_uring_cqe_get_data(cqe));
+      if (cqe->res < 0) {
+         io_uring_cqe_seen(&fRing, cqe);
+         fNInFlight--;
+         throw std::runtime_error("asynchronous read failed at offset " + std::to_string(event->fOffset) +
+            ", error: " + std::string(std::strerror(-cqe->res)));
+      }
+      event->fOutBytes = static_cast<std::size_t>(cqe->res);
+      event->fIsDone = true;
+      io_uring_cqe_seen(&fRing, cqe);
+      fNInFlight--;
+   }
 };
 
 } // namespace Internal
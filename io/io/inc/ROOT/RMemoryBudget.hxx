@@ -0,0 +1,115 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RMemoryBudget
+#define ROOT_RMemoryBudget
+
+#include <cstdint>
+#include <string>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+ * \class RMemoryBudget RMemoryBudget.hxx
+ * \ingroup IO
+ *
+ * Process-wide accounting of the memory of the components whose allocations grow with the data being processed:
+ * the clusters loaded by the RNTuple cluster pools, the buffers of the TTree caches, the buffers queued by the
+ * TBufferMergers and the partial results of the RDataFrame processing slots (histogram clones, Take collections).
+ * The current and the peak usage of each component are available at any time, see GetReport().
+ *
+ * A limit can be set with SetLimit(), e.g. by RDataFrame for the duration of an event loop (see
+ * RInterfaceBase::SetMemoryLimit). When the tracked memory exceeds three quarters of the limit, the components reduce
+ * their read-ahead: the cluster pools only load the requested cluster, the TTree caches fill one cluster at a time
+ * and the TBufferMergers merge (or spill) their queue before accepting more buffers. The limit does not cause
+ * allocations to fail; the tracked memory excludes e.g. the memory of the users' objects and the code.
+ */
+class RMemoryBudget {
+public:
+   enum EComponent : unsigned int {
+      /// Compressed pages of the clusters loaded by the RNTuple cluster pools
+      kClusterPool,
+      /// Buffers of the TTree caches (TFileCacheRead) holding the prefetched baskets
+      kTreeCache,
+      /// Buffers written by the TBufferMergerFiles, waiting to be merged
+      kBufferMerger,
+      /// Copies of the results for the processing slots of RDataFrame, e.g. the histogram of each slot; estimated
+      kSlotResults,
+      /// Values collected by the Take actions of RDataFrame in the processing slots
+      kTakeResults,
+      kNComponents
+   };
+
+   /// Accounts for memory of a component for its lifetime, e.g. as a member next to the buffer it describes
+   class RAllocation {
+      EComponent fComponent;
+      std::uint64_t fSize = 0;
+
+   public:
+      explicit RAllocation(EComponent component, std::uint64_t size = 0) : fComponent(component) { Resize(size); }
+      RAllocation(const RAllocation &) = delete;
+      RAllocation &operator=(const RAllocation &) = delete;
+      RAllocation(RAllocation &&other) noexcept : fComponent(other.fComponent), fSize(other.fSize) { other.fSize = 0; }
+      RAllocation &operator=(RAllocation &&other) noexcept
+      {
+         if (this != &other) {
+            Resize(0);
+            fComponent = other.fComponent;
+            fSize = other.fSize;
+            other.fSize = 0;
+         }
+         return *this;
+      }
+      ~RAllocation() { Resize(0); }
+
+      /// Changes the accounted size, e.g. after the buffer was reallocated
+      void Resize(std::uint64_t size)
+      {
+         if (size > fSize)
+            Add(fComponent, size - fSize);
+         else if (size < fSize)
+            Release(fComponent, fSize - size);
+         fSize = size;
+      }
+      std::uint64_t GetSize() const { return fSize; }
+   };
+
+   /// Accounts for `bytes` more of memory used by the component
+   static void Add(EComponent component, std::uint64_t bytes);
+   /// Accounts for `bytes` of memory of the component that were freed
+   static void Release(EComponent component, std::uint64_t bytes);
+
+   /// Sets the limit of the tracked memory in bytes, 0 (the default) for no limit
+   static void SetLimit(std::uint64_t bytes);
+   static std::uint64_t GetLimit();
+   /// Whether the tracked memory exceeds three quarters of the limit, i.e. the components should reduce their
+   /// read-ahead. Costs an atomic load if there is no limit.
+   static bool IsUnderPressure();
+
+   static std::uint64_t GetUsage(EComponent component);
+   static std::uint64_t GetPeak(EComponent component);
+   /// Returns the tracked memory of all the components
+   static std::uint64_t GetTotalUsage();
+   /// Returns the peak of the tracked memory of all the components, which is not the sum of their peaks
+   static std::uint64_t GetTotalPeak();
+   /// Sets the peaks to the current usage, e.g. when a new event loop starts
+   static void ResetPeaks();
+
+   /// Returns the name of the component, e.g. "clusterPool"
+   static const char *GetName(EComponent component);
+   /// Returns a table with the current and the peak usage of each component and of all of them, and the limit
+   static std::string GetReport();
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -63,7 +63,12 @@ public:
        * that the protocol-dependent default block size should be used.
        */
       int fBlockSize;
-      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
+      /**
+       * For remote protocols that support it, split large vector reads over up to fNumConnections parallel
+       * connections. A value of zero or less indicates that the protocol-dependent default should be used.
+       */
+      int fNumConnections;
+      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1), fNumConnections(-1) {}
    };
 
    /// Used for vector reads from multiple offsets into multiple buffers. This is unlike readv(), which scatters a
@@ -137,6 +142,11 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default implemented as a synchronous ReadVImpl() call; derived classes with kFeatureHasAsyncIo should only
+   /// submit the requests and complete them in WaitReadVImpl()
+   virtual void ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) { ReadVImpl(ioVec, nReq); }
+   /// Counterpart of ReadVAsyncImpl(); the default implementation has nothing to wait for
+   virtual void WaitReadVImpl(RIOVec * /* ioVec */, unsigned int /* nReq */) {}
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +182,12 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and submits the vector read without waiting for its completion. The ioVec array
+   /// and the buffers it points to must stay valid until the matching WaitReadV() call returned. Several vector reads
+   /// can be in flight at the same time. Files that do not support kFeatureHasAsyncIo read synchronously.
+   void ReadVAsync(RIOVec *ioVec, unsigned int nReq);
+   /// Blocks until the vector read previously started by ReadVAsync() with the same ioVec array is finished
+   void WaitReadV(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
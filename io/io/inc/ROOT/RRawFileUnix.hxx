@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
@@ -27,15 +28,28 @@ namespace Internal {
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * If ROOT is built with io_uring support, vector reads are submitted to an io_uring instance that is owned by the
+ * file. In this case, the file supports asynchronous vector reads (ReadVAsync()), so that several vector reads can
+ * be in flight at the same time.
  */
 class RRawFileUnix : public RRawFile {
 private:
+   /// The io_uring instance and the bookkeeping of in-flight asynchronous reads; only used with R__HAS_URING
+   struct RUringState;
+
    int fFileDes;
+   std::unique_ptr<RUringState> fUringState;
+
+   /// Lazily sets up fUringState; returns false if io_uring is not available
+   bool InitUring();
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   void ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
+   void WaitReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
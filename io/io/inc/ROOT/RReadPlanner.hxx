@@ -0,0 +1,101 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RReadPlanner
+#define ROOT_RReadPlanner
+
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RReadPlanner RReadPlanner.hxx
+ * \ingroup IO
+ *
+ * The RReadPlanner turns a list of byte ranges that need to be read from a file into a list of read requests.
+ * Nearby ranges are coalesced into a single request if the number of extra bytes read in the gaps stays within
+ * the configured budget; requests do not grow beyond a maximum size, and large ranges can optionally be split.
+ * The data of all requests is meant to be stored back to back in a single destination buffer; the plan provides
+ * the location of every range in that buffer.
+ *
+ * The planner is shared by TFileCacheRead and the RNTuple file page source such that the vector read behavior of
+ * both is tuned in one place.  The default settings depend on the transport protocol and can be overwritten with
+ * the ReadPlanner.MaxGap, ReadPlanner.MaxOverheadFraction, and ReadPlanner.MaxRequestSize resources.
+ */
+class RReadPlanner {
+public:
+   /// Parameters of the request coalescing
+   struct RSettings {
+      /// Ranges separated by more than fMaxGap bytes are never coalesced
+      std::uint64_t fMaxGap = std::numeric_limits<std::uint64_t>::max();
+      /// The bytes read in gaps between ranges sum up to at most this fraction of the requested bytes.
+      /// A negative value removes the limit.
+      float fMaxOverheadFraction = 0.25;
+      /// Requests are not coalesced beyond this size. Zero means no limit.
+      std::uint64_t fMaxRequestSize = 0;
+      /// If set, ranges larger than fMaxRequestSize are split into several requests
+      bool fSplitLargeRanges = false;
+
+      /// The default settings for a transport protocol as returned by RRawFile::GetTransport(), e.g. "file"
+      /// or "root", including the overrides from the resource file
+      static RSettings GetForTransport(std::string_view transport);
+   };
+
+   /// A byte range that needs to be read
+   struct RRange {
+      std::uint64_t fOffset = 0;
+      std::uint64_t fSize = 0;
+   };
+
+   /// A single read request covering one or several ranges, or a part of a split range
+   struct RRequest {
+      /// The file offset
+      std::uint64_t fOffset = 0;
+      /// The number of bytes to read, including gaps
+      std::uint64_t fSize = 0;
+      /// The location of the request's data in the destination buffer
+      std::uint64_t fBufferOffset = 0;
+      /// The index of the first range that is (partially) covered by this request
+      std::size_t fFirstRange = 0;
+      /// The number of ranges covered by this request
+      std::size_t fNRanges = 0;
+   };
+
+   /// The result of planning the reads of a list of ranges
+   struct RPlan {
+      std::vector<RRequest> fRequests;
+      /// The location of every input range in the destination buffer
+      std::vector<std::uint64_t> fRangeBufferOffsets;
+      /// The required size of the destination buffer
+      std::uint64_t fBufferSize = 0;
+      /// The sum of the sizes of the input ranges
+      std::uint64_t fSzPayload = 0;
+      /// The number of extra bytes read in gaps
+      std::uint64_t fSzOverhead = 0;
+   };
+
+   /// Plans the reading of `nRanges` ranges, which must be sorted by offset and must not overlap
+   static RPlan Plan(const RRange *ranges, std::size_t nRanges, const RSettings &settings);
+   static RPlan Plan(const std::vector<RRange> &ranges, const RSettings &settings)
+   {
+      return Plan(ranges.data(), ranges.size(), settings);
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
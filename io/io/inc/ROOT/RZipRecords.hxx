@@ -0,0 +1,45 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RZipRecords
+#define ROOT_RZipRecords
+
+#include "RtypesCore.h"
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \file ROOT/RZipRecords.hxx
+ * \ingroup IO
+ *
+ * Compression of a buffer into several independently compressed records, as written for the data of keys and
+ * baskets larger than kMAXZIPBUF, and the corresponding inflate. With implicit multi-threading enabled, the records
+ * are compressed and inflated in parallel on the IMT pool. The output does not depend on the number of threads.
+ */
+
+/// Compresses srcSize bytes at src into consecutive records of at most chunkSize uncompressed bytes each, written to
+/// tgt, which must provide at least srcSize bytes. Returns the total compressed size, or 0 if a record does not shrink
+/// or cannot be compressed.
+Int_t ZipRecords(Int_t cxlevel, Int_t cxAlgorithm, char *src, Int_t srcSize, char *tgt, Int_t chunkSize);
+
+/// Inflates the consecutive records at src, of total size srcSize, into the tgtSize bytes at tgt. Returns the number
+/// of inflated bytes, or 0 if a record cannot be inflated.
+Int_t UnzipRecords(UChar_t *src, Int_t srcSize, char *tgt, Int_t tgtSize);
+
+/// Inflates the records at src in parallel on the IMT pool. Returns false, without a meaningful content of tgt, if
+/// there is a single record, if the record headers are inconsistent, or without IMT support; the caller then inflates
+/// sequentially. Otherwise sets nintot to the number of compressed bytes.
+bool UnzipRecordsInParallel(UChar_t *src, Int_t srcSize, char *tgt, Int_t tgtSize, Int_t &nintot);
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
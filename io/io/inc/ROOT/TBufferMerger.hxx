@@ -15,10 +15,15 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace ROOT {
 
@@ -35,10 +40,33 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * By default, the queue is merged by whichever thread happens to
+ * write a TBufferMergerFile while no other merge is in progress,
+ * and the queue can grow without bounds. SetMaxBuffered() limits
+ * the number of bytes held in the queue: once the limit is reached,
+ * writing threads either wait for the queue to be drained or spill
+ * their data into temporary files, see SetQueueFullPolicy(). The
+ * queued bytes are accounted for in the ROOT::Experimental::RMemoryBudget,
+ * and the queue is also considered full while the budget is under pressure.
+ * SetAsyncMerge() moves all merging to a dedicated thread such that
+ * writing threads never merge themselves.  The defaults can be set
+ * with the TBufferMerger.MaxBuffered, TBufferMerger.QueueFullPolicy
+ * ("block" or "spill") and TBufferMerger.AsyncMerge resources.
+ *
+ * To write to several output files in parallel, use one TBufferMerger
+ * per output file; the merges of different TBufferMergers never wait
+ * for each other.
  */
 
 class TBufferMerger {
 public:
+   /// The behavior of a writing thread when the queue holds more than GetMaxBuffered() bytes
+   enum class EQueueFullPolicy {
+      kBlock, ///< Wait until the queue is merged (or merge it in the writing thread if there is no merge thread)
+      kSpill  ///< Store the data in a temporary file on disk, which is merged later
+   };
+
    /** Constructor
     * @param name Output file name
     * @param option Output file creation options
@@ -79,6 +107,35 @@ public:
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Limits the number of bytes held in the merge queue. Writing a
+    *  TBufferMergerFile into a full queue applies the queue full policy,
+    *  see SetQueueFullPolicy(). A single buffer is always accepted into an
+    *  empty queue, even if it is larger than the limit. Zero (the default)
+    *  means no limit.
+    */
+   void SetMaxBuffered(size_t size);
+
+   /** Returns the maximum number of bytes held in the merge queue, zero if unlimited. */
+   size_t GetMaxBuffered() const;
+
+   /** Sets what happens when a TBufferMergerFile is written while the queue is full. */
+   void SetQueueFullPolicy(EQueueFullPolicy policy);
+
+   /** Returns the current queue full policy (default = kBlock). */
+   EQueueFullPolicy GetQueueFullPolicy() const;
+
+   /** If enabled, the queue is merged by a dedicated thread owned by the
+    *  TBufferMerger and TBufferMergerFile::Write() only pushes data onto the
+    *  queue. Must not be called while TBufferMergerFiles are being written.
+    */
+   void SetAsyncMerge(bool enable = true);
+
+   /** Returns whether the queue is merged by a dedicated thread. */
+   bool GetAsyncMerge() const
+   {
+      return fMergeThread.joinable();
+   }
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -149,11 +206,20 @@ private:
    /** TBufferMerger has no copy operator */
    TBufferMerger &operator=(const TBufferMerger &);
 
+   /** An entry of the merge queue: either an in-memory buffer or the name of a temporary file */
+   struct RQueueItem {
+      std::unique_ptr<TBufferFile> fBuffer;
+      std::string fSpillFile;
+   };
+
    void Init(std::unique_ptr<TFile>);
 
    void MergeImpl();
 
    void Merge();
+   void MergeLoop();
+   void StopMergeThread();
+   bool IsQueueFull(size_t size) const;
    void Push(TBufferFile *buffer);
    bool TryMerge(TBufferMergerFile *memfile);
 
@@ -163,7 +229,13 @@ private:
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
    mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
-   std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
+   std::queue<RQueueItem> fQueue;                                //< Queue to which data is pushed and merged
+   size_t fMaxBuffered{0};                                       //< Maximum number of bytes in fQueue, 0 for no limit
+   EQueueFullPolicy fQueueFullPolicy{EQueueFullPolicy::kBlock};  //< Behavior of Push() when fQueue is full
+   std::condition_variable fQueueCondition;                      //< Signals queue changes, used with fQueueMutex
+   unsigned int fNWaiting{0};                                    //< Number of writers waiting for fQueue to drain
+   bool fStopMergeThread{false};                                 //< Asks fMergeThread to drain fQueue and exit
+   std::thread fMergeThread;                                     //< Dedicated merge thread, if async merging is on
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
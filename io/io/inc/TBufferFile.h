@@ -46,12 +46,23 @@ namespace TStreamerInfoActions {
 
 class TBufferFile : public TBufferIO {
 
+public:
+   /// A non-owned part of the data read by a TBufferFile, see TBufferFile(TBuffer::EMode, const std::vector<RSegment> &)
+   struct RSegment {
+      const char *fBuffer = nullptr;
+      Int_t fSize = 0;
+   };
+
 protected:
    typedef std::vector<TStreamerInfo*> InfoList_t;
 
    TStreamerInfo  *fInfo{nullptr};  ///< Pointer to TStreamerInfo object writing/reading the buffer
    InfoList_t      fInfoStack;     ///< Stack of pointers to the TStreamerInfos
 
+   std::vector<RSegment> fSegments;    ///<! The data when reading from several segments, empty otherwise
+   std::vector<Int_t>    fSegmentEnds; ///<! The offset of the end of every segment in the data
+   std::vector<char>     fBridge;      ///<! Copy of the data of a read that spans several segments
+
    // Default ctor
    TBufferFile() {} // NOLINT: not allowed to use = default because of TObject::kIsOnHeap detection, see ROOT-10300
 
@@ -65,14 +76,26 @@ protected:
 
    void  WriteObjectClass(const void *actualObjStart, const TClass *actualClass, Bool_t cacheReuse) override;
 
+   void  SeekBuffer(Int_t offset) override;
+   void  SetWindow(Int_t offset, Int_t nbytes);
+   /// Makes sure that the next nbytes are in [fBufCur, fBufMax) when reading from several segments
+   void  CheckSegment(Int_t nbytes)
+   {
+      if (R__unlikely(fBufCur + nbytes > fBufMax) && !fSegments.empty())
+         SetWindow(Length(), nbytes);
+   }
+
 public:
    enum { kStreamedMemberWise = BIT(14) }; //added to version number to know if a collection has been stored member-wise
 
    TBufferFile(TBuffer::EMode mode);
    TBufferFile(TBuffer::EMode mode, Int_t bufsiz);
    TBufferFile(TBuffer::EMode mode, Int_t bufsiz, void *buf, Bool_t adopt = kTRUE, ReAllocCharFun_t reallocfunc = nullptr);
+   TBufferFile(TBuffer::EMode mode, const std::vector<RSegment> &segments);
    virtual ~TBufferFile();
 
+   Bool_t     IsSegmented() const { return !fSegments.empty(); }
+
    Int_t      CheckByteCount(UInt_t startpos, UInt_t bcnt, const TClass *clss) override;
    Int_t      CheckByteCount(UInt_t startpos, UInt_t bcnt, const char *classname) override;
    void       SetByteCount(UInt_t cntpos, Bool_t packInVersion = kFALSE) override;
@@ -368,12 +391,14 @@ inline void TBufferFile::WriteCharP(const Char_t *c)
 //______________________________________________________________________________
 inline void TBufferFile::ReadBool(Bool_t &b)
 {
+   CheckSegment(sizeof(Bool_t));
    frombuf(fBufCur, &b);
 }
 
 //______________________________________________________________________________
 inline void TBufferFile::ReadChar(Char_t &c)
 {
+   CheckSegment(sizeof(Char_t));
    frombuf(fBufCur, &c);
 }
 
@@ -386,6 +411,7 @@ inline void TBufferFile::ReadUChar(UChar_t &c)
 //______________________________________________________________________________
 inline void TBufferFile::ReadShort(Short_t &h)
 {
+   CheckSegment(sizeof(Short_t));
    frombuf(fBufCur, &h);
 }
 
@@ -398,6 +424,7 @@ inline void TBufferFile::ReadUShort(UShort_t &h)
 //______________________________________________________________________________
 inline void TBufferFile::ReadInt(Int_t &i)
 {
+   CheckSegment(sizeof(Int_t));
    frombuf(fBufCur, &i);
 }
 
@@ -425,6 +452,7 @@ inline void TBufferFile::ReadULong(ULong_t &ll)
 //______________________________________________________________________________
 inline void TBufferFile::ReadLong64(Long64_t &ll)
 {
+   CheckSegment(sizeof(Long64_t));
    frombuf(fBufCur, &ll);
 }
 
@@ -437,12 +465,14 @@ inline void TBufferFile::ReadULong64(ULong64_t &ll)
 //______________________________________________________________________________
 inline void TBufferFile::ReadFloat(Float_t &f)
 {
+   CheckSegment(sizeof(Float_t));
    frombuf(fBufCur, &f);
 }
 
 //______________________________________________________________________________
 inline void TBufferFile::ReadDouble(Double_t &d)
 {
+   CheckSegment(sizeof(Double_t));
    frombuf(fBufCur, &d);
 }
 
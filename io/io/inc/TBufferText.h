@@ -135,6 +135,8 @@ public:
 protected:
    static const char *fgFloatFmt;  ///<!  printf argument for floats, either "%f" or "%e" or "%10f" and so on
    static const char *fgDoubleFmt; ///<!  printf argument for doubles, either "%f" or "%e" or "%10f" and so on
+   static Int_t fgFloatPrec;       ///<!  precision of "%.Ne" float format, negative for other formats
+   static Int_t fgDoublePrec;      ///<!  precision of "%.Ne" double format, negative for other formats
 
    ClassDefOverride(TBufferText, 0); // a TBuffer subclass for all text-based streamers
 };
@@ -26,6 +26,8 @@
 #include "TDatime.h"
 #include "TList.h"
 
+#include <future>
+
 class TKey;
 class TFile;
 
@@ -122,6 +124,7 @@ public:
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsize=0) override;
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsize=0) const override;
            Int_t       WriteTObject(const TObject *obj, const char *name=nullptr, Option_t *option="", Int_t bufsize=0) override;
+           std::future<Int_t> WriteObjectAsync(const TObject *obj, const char *name=nullptr, Option_t *option="", Int_t bufsize=0);
            Int_t       WriteObjectAny(const void *obj, const char *classname, const char *name, Option_t *option="", Int_t bufsize=0) override;
            Int_t       WriteObjectAny(const void *obj, const TClass *cl, const char *name, Option_t *option="", Int_t bufsize=0) override;
            void        WriteDirHeader() override;
@@ -22,7 +22,9 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "Compression.h"
 #include "TDirectoryFile.h"
@@ -51,9 +53,20 @@ class TProcessID;
 class TStopwatch;
 class TFilePrefetch;
 
+namespace ROOT {
+namespace Internal {
+class RAsyncKeyWriter;
+class RBlockCache;
+class RFreeSegmentIndex;
+struct TFileOpenTask;
+}
+}
+
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
   friend class TFilePrefetch;
+  friend class TKey;
+  friend class ROOT::Internal::RAsyncKeyWriter;
 // TODO: We need to make sure only one TBasket is being written at a time
 // if we are writing multiple baskets in parallel.
 #ifdef R__USE_IMT
@@ -115,6 +128,19 @@ protected:
 
    bool             fGlobalRegistration = true; ///<! if true, bypass use of global lists
 
+   Int_t            fDictMaxBufferSize{0};    ///<!Buffers up to this size are compressed with the ZSTD dictionary (0: no dictionary)
+   UInt_t           fDictID{0};               ///<!ID of the ZSTD dictionary used for writing (0 until it is trained)
+   Bool_t           fDictWritten{kFALSE};     ///<!True if the dictionary fDictID is stored in the StreamerInfo record
+   TList           *fCompressionDicts{nullptr}; ///<!ZSTD dictionaries (as TObjString) of this file, stored in the StreamerInfo record
+   TString          fDictSamples;             ///<!Buffers collected to train the dictionary, one after the other
+   std::vector<Int_t> fDictSampleSizes;       ///<!Sizes of the buffers in fDictSamples
+   std::mutex       fDictMutex;               ///<!Lock for training and selecting the dictionary
+   ROOT::Internal::RAsyncKeyWriter *fAsyncKeyWriter{nullptr}; ///<!Background writer of the keys of WriteObjectAsync
+   std::shared_ptr<ROOT::Internal::RBlockCache> fBlockCache; ///<!Local disk cache of the blocks of a remote file opened for reading
+   ROOT::Internal::RFreeSegmentIndex *fFreeIndex{nullptr}; ///<!Index of fFree by address and by size, created on first use
+   std::string      fBlockCacheFileId;        ///<!Key of the file in fBlockCache, i.e. its UUID
+   Bool_t           fBlockCacheFetch{kFALSE}; ///<!True while the missing blocks of fBlockCache are read
+
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
    static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
@@ -139,7 +165,12 @@ protected:
    virtual void        Init(Bool_t create);
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
+           Int_t       ReadBuffersViaBlockCache(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
+           Long64_t    GetAsyncWriteEND();
+           std::future<Int_t> WriteKeyAsync(TKey *key, TKey *oldKey, Bool_t freeOldKeyFirst);
+           ROOT::Internal::RFreeSegmentIndex &GetFreeIndex();
+           void        ResetFreeIndex();
 
    ////////////////////////////////////////////////////////////////////////////////
    /// \brief Simple struct of the return value of GetStreamerInfoListImpl
@@ -219,6 +250,7 @@ public:
       TFileCacheWrite *GetCacheWrite() const;
            TArrayC    *GetClassIndex() const { return fClassIndex; }
            Int_t       GetCompressionAlgorithm() const;
+           UInt_t      GetCompressionDictionary(const char *buffer, Int_t size, Int_t algorithm);
            Int_t       GetCompressionLevel() const;
            Int_t       GetCompressionSettings() const;
            Float_t     GetCompressionFactor();
@@ -278,6 +310,7 @@ public:
    virtual void        SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    virtual void        SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    virtual void        SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
+           void        SetCompressionDictionary(Int_t maxBufferSize = 16384);
    virtual void        SetEND(Long64_t last) { fEND = last; }
    virtual void        SetOffset(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetOption(Option_t *option=">") { fOption = option; }
@@ -285,6 +318,7 @@ public:
    virtual void        ShowStreamerInfo();
            Int_t       Sizeof() const override;
            void        SumBuffer(Int_t bufsize);
+           void        WaitForAsyncWrites();
    virtual Bool_t      WriteBuffer(const char *buf, Int_t len);
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsiz=0) override;
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsiz=0) const override;
@@ -301,6 +335,7 @@ public:
                             const char *ftitle = "", Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault,
                             Int_t netopt = 0);
    static TFile       *Open(TFileOpenHandle *handle);
+   static void         CancelAsyncOpen(TFileOpenHandle *handle);
 
    static EFileType    GetType(const char *name, Option_t *option = "", TString *prefix = nullptr);
 
@@ -364,6 +399,7 @@ private:
    Int_t    fCompress{0};    ///< Compression level and algorithm
    Int_t    fNetOpt{0};      ///< Network options
    TFile   *fFile{nullptr};  ///< TFile instance of the file being opened
+   ROOT::Internal::TFileOpenTask *fTask{nullptr}; ///<! Standard open run in the background, see TFile::AsyncOpen
 
    TFileOpenHandle(TFile *f) : TNamed("",""), fOpt(""), fCompress(ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault),
                                fNetOpt(0), fFile(f) { }
@@ -376,7 +412,7 @@ private:
    TFile      *GetFile() const { return fFile; }
 
 public:
-   ~TFileOpenHandle() { }
+   ~TFileOpenHandle();
 
    Bool_t      Matches(const char *name);
 
@@ -69,8 +69,10 @@ protected:
    Int_t         *fBLen;         ///<[fBNb]
    Bool_t         fBIsSorted;
    Bool_t         fBIsTransferred;
+   Int_t          fAccountedBufferSize = 0; ///<! Size of fBuffer accounted for in the ROOT::Experimental::RMemoryBudget
 
    void SetEnablePrefetchingImpl(Bool_t setPrefetching = kFALSE); // Can not be virtual as it is called from the constructor.
+   void UpdateMemoryBudget();
 
 private:
    TFileCacheRead(const TFileCacheRead &) = delete;            //cannot be copied
@@ -25,6 +25,9 @@ class TKey;
 
 namespace ROOT {
 class TIOFeatures;
+namespace Internal {
+class RConcurrentMerges;
+}  // namespace Internal
 }  // namespace ROOT
 
 class TFileMerger : public TObject {
@@ -54,6 +57,8 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
+   Int_t          fParallelMergeBatch{0};     ///<! Number of histograms merged concurrently with implicit multi-threading (0 to merge sequentially)
+   ROOT::Internal::RConcurrentMerges *fConcurrentMerges{nullptr}; ///<! Histograms read and being merged concurrently
 
    Bool_t         OpenExcessFiles();
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
@@ -101,6 +106,8 @@ public:
    void        AddObjectNames(const char *name) {fObjectNames += name; fObjectNames += " ";}
    const char *GetObjectNames() const {return fObjectNames.Data();}
    void        ClearObjectNames() {fObjectNames.Clear();}
+   Int_t       GetParallelMergeBatch() const { return fParallelMergeBatch; }
+   void        SetParallelMergeBatch(Int_t nobjects);
 
     //--- file management interface
    virtual Bool_t SetCWD(const char * /*path*/) { MayNotUse("SetCWD"); return kFALSE; }
@@ -25,6 +25,7 @@ protected:
    void WriteMap(int nElements, TBuffer &b);
    void WriteObjects(int nElements, TBuffer &b);
    void WritePrimitives(int nElements, TBuffer &b);
+   void *GetContiguousBegin();
 
 //   typedef void (TGenCollectionStreamer::*ReadBufferConv_t)(TBuffer &b, void *obj, const TClass *onFileClass);
 //   ReadBufferConv_t fReadBufferConvFunc;
@@ -25,7 +25,15 @@ class TBrowser;
 class TDirectory;
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class RAsyncKeyWriter;
+}
+}
+
 class TKey : public TNamed {
+   friend class TDirectoryFile;
+   friend class ROOT::Internal::RAsyncKeyWriter;
 
 private:
    enum EStatusBits {
@@ -51,8 +59,12 @@ protected:
    UShort_t    fPidOffset;   ///<!Offset to be added to the pid index in this key/buffer.  This is actually saved in the high bits of fSeekPdir
    TDirectory *fMotherDir;   ///<!pointer to mother directory
 
+   TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* motherDir, Long64_t filepos);
+
            Int_t    Read(const char *name) override { return TObject::Read(name); }
    virtual void     Create(Int_t nbytes, TFile* f = nullptr);
+           Int_t    CompressObject();
+           void     CreateObjectKey(Int_t nbytes);
            void     Build(TDirectory* motherDir, const char* classname, Long64_t filepos);
            void     Reset(); // Currently only for the use of TBasket.
    virtual Int_t    WriteFileKeepBuffer(TFile *f = nullptr);
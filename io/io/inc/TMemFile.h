@@ -44,9 +44,17 @@ protected:
       UChar_t   *fBuffer{nullptr};
       Long64_t   fSize{0};
    };
+   /// A writable memory range which we do not control and which cannot grow.
+   struct FixedSizeView_t {
+      char *fStart;
+      const size_t fSize;
+      explicit FixedSizeView_t(char * start, const size_t size) : fStart(start), fSize(size) {}
+   };
+
    TMemBlock    fBlockList;               ///< Collection of memory blocks of size fgDefaultBlockSize
    ExternalDataPtr_t fExternalData;       ///< shared file data / content
    Bool_t       fIsOwnedByROOT{kFALSE};   ///< if this is a C-style memory region
+   Bool_t       fIsFixedSize{kFALSE};     ///< if the external memory region is written in place, without growing
    Long64_t     fSize{0};                 ///< Total file size (sum of the size of the chunks)
    Long64_t     fSysOffset{0};            ///< Seek offset in file
    TMemBlock   *fBlockSeek{nullptr};      ///< Pointer to the block we seeked to.
@@ -86,6 +94,8 @@ protected:
 
    TMemFile &operator=(const TMemFile&) = delete; // Not implemented.
 
+   TMemFile(const char *name, const FixedSizeView_t &datarange, Option_t *option, const char *ftitle, Int_t compress);
+
 public:
    TMemFile(const char *name, Option_t *option = "", const char *ftitle = "",
             Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
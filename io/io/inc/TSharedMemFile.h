@@ -0,0 +1,46 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TSharedMemFile
+#define ROOT_TSharedMemFile
+
+#include "TMemFile.h"
+
+class TSharedMemFile : public TMemFile {
+protected:
+   TString      fSegmentName;             ///< Name of the POSIX shared memory segment
+   void        *fSegment{nullptr};        ///<! Start of the mapped segment, including its header
+   Long64_t     fSegmentSize{0};          ///<! Size of the mapped segment
+
+   constexpr static Long64_t fgDefaultCapacity = 256 * 1024 * 1024;
+
+   static TString         NormalizeSegmentName(const char *name);
+   static FixedSizeView_t MapSegment(const char *name, Option_t *option, Long64_t capacity);
+
+   Int_t    SysClose(Int_t fd) override;
+
+   TSharedMemFile(const TSharedMemFile&) = delete;            // Not implemented.
+   TSharedMemFile &operator=(const TSharedMemFile&) = delete; // Not implemented.
+
+public:
+   TSharedMemFile(const char *name, Option_t *option = "", const char *ftitle = "",
+                  Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t capacity = 0LL);
+   virtual ~TSharedMemFile();
+
+           Long64_t GetCapacity() const { return fBlockList.fSize; }
+           Long64_t GetSize() const override;
+   const char      *GetSegmentName() const { return fSegmentName.Data(); }
+
+   static  Bool_t   Unlink(const char *name);
+
+   ClassDefOverride(TSharedMemFile, 0) // A ROOT file in a POSIX shared memory segment
+};
+
+#endif
@@ -109,6 +109,8 @@ private:
    TStreamerInfoActions::TActionSequence *fWriteMemberWise;       ///<! List of write action resulting from the compilation for use in member wise streaming.
    TStreamerInfoActions::TActionSequence *fWriteMemberWiseVecPtr; ///<! List of write action resulting from the compilation for use in member wise streaming.
    TStreamerInfoActions::TActionSequence *fWriteText;             ///<! List of text write action resulting for the compilation, used for JSON.
+   std::atomic<Bool_t> fMemberWiseActionsBuilt; ///<! The member wise sequences have been built since the last Compile.
+   std::atomic<Bool_t> fTextActionsBuilt;       ///<! The text sequences have been built since the last Compile.
 
    static std::atomic<Int_t>             fgCount;     ///<Number of TStreamerInfo instances
 
@@ -128,6 +130,8 @@ private:
    void AddReadTextAction(TStreamerInfoActions::TActionSequence *readSequence, Int_t index, TCompInfo *compinfo);
    void AddWriteTextAction(TStreamerInfoActions::TActionSequence *writeSequence, Int_t index, TCompInfo *compinfo);
    void AddReadMemberWiseVecPtrAction(TStreamerInfoActions::TActionSequence *readSequence, Int_t index, TCompInfo *compinfo);
+   void BuildMemberWiseActions();
+   void BuildTextActions();
    void AddWriteMemberWiseVecPtrAction(TStreamerInfoActions::TActionSequence *writeSequence, Int_t index, TCompInfo *compinfo);
 
 public:
@@ -205,12 +209,12 @@ public:
    TStreamerElement   *GetElem(Int_t id) const override { return fComp[id].fElem; }  // Return the element for the list of optimized elements (max GetNdata())
    TStreamerElement   *GetElement(Int_t id) const override {return (TStreamerElement*)fElements->At(id);} // Return the element for the complete list of elements (max GetElements()->GetEntries())
    Int_t               GetElementOffset(Int_t id) const override {return fCompFull[id]->fOffset;}
-   TStreamerInfoActions::TActionSequence *GetReadMemberWiseActions(Bool_t forCollection) { return forCollection ? fReadMemberWiseVecPtr : fReadMemberWise; }
+   TStreamerInfoActions::TActionSequence *GetReadMemberWiseActions(Bool_t forCollection) { if (!fMemberWiseActionsBuilt) BuildMemberWiseActions(); return forCollection ? fReadMemberWiseVecPtr : fReadMemberWise; }
    TStreamerInfoActions::TActionSequence *GetReadObjectWiseActions() { return fReadObjectWise; }
-   TStreamerInfoActions::TActionSequence *GetReadTextActions() { return fReadText; }
-   TStreamerInfoActions::TActionSequence *GetWriteMemberWiseActions(Bool_t forCollection) { return forCollection ? fWriteMemberWiseVecPtr : fWriteMemberWise; }
+   TStreamerInfoActions::TActionSequence *GetReadTextActions() { if (!fTextActionsBuilt) BuildTextActions(); return fReadText; }
+   TStreamerInfoActions::TActionSequence *GetWriteMemberWiseActions(Bool_t forCollection) { if (!fMemberWiseActionsBuilt) BuildMemberWiseActions(); return forCollection ? fWriteMemberWiseVecPtr : fWriteMemberWise; }
    TStreamerInfoActions::TActionSequence *GetWriteObjectWiseActions() { return fWriteObjectWise; }
-   TStreamerInfoActions::TActionSequence *GetWriteTextActions() { return fWriteText; }
+   TStreamerInfoActions::TActionSequence *GetWriteTextActions() { if (!fTextActionsBuilt) BuildTextActions(); return fWriteText; }
    Int_t               GetNdata()   const {return fNdata;}
    Int_t               GetNelement() const { return fElements->GetEntriesFast(); }
    Int_t               GetNumber()  const override { return fNumber; }
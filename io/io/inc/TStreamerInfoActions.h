@@ -67,6 +67,20 @@ namespace TStreamerInfoActions {
 
    typedef TVirtualCollectionProxy::Next_t Next_t;
 
+   /// Return an array of at least n values of type T, which the conversions of the values of a collection on file
+   /// to their type in memory reuse in each thread instead of allocating a temporary array at each read.
+   template <typename T>
+   T *GetConversionBuffer(Int_t n)
+   {
+      thread_local std::unique_ptr<T[]> buffer;
+      thread_local Int_t size = 0;
+      if (n > size) {
+         buffer.reset(new T[n]);
+         size = n;
+      }
+      return buffer.get();
+   }
+
    typedef Int_t (*TStreamerInfoAction_t)(TBuffer &buf, void *obj, const TConfiguration *conf);
    typedef Int_t (*TStreamerInfoVecPtrLoopAction_t)(TBuffer &buf, void *iter, const void *end, const TConfiguration *conf);
    typedef Int_t (*TStreamerInfoLoopAction_t)(TBuffer &buf, void *iter, const void *end, const TLoopConfiguration *loopconf, const TConfiguration *conf);
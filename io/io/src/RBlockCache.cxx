@@ -0,0 +1,340 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RBlockCache.hxx>
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TMD5.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Blocks used within that many seconds are not touched again, saving a system call per cache hit
+constexpr Long_t kTouchInterval = 60;
+/// Temporary files of blocks that are older than that many seconds are left over by crashed processes
+constexpr Long_t kStaleTemporaryAge = 3600;
+
+struct RGlobalBlockCache {
+   std::mutex fMutex;
+   bool fIsConfigured = false;
+   std::shared_ptr<ROOT::Internal::RBlockCache> fCache;
+};
+
+RGlobalBlockCache &GetGlobalBlockCache()
+{
+   static RGlobalBlockCache globalCache;
+   return globalCache;
+}
+
+/// A block file found when cleaning up the cache
+struct RCachedBlock {
+   Long_t fMtime;
+   std::uint64_t fSize;
+   std::string fPath;
+};
+
+} // anonymous namespace
+
+ROOT::Internal::RBlockCache::RBlockCache(std::string_view directory, std::uint64_t maxSize, std::size_t blockSize)
+   : fDirectory(directory), fMaxSize(maxSize), fBlockSize(blockSize), fStoredSinceCleanUp(maxSize / 10)
+{
+   // The first block stored by the process triggers a clean-up, such that a full cache of previous runs is trimmed
+   if (fBlockSize == 0)
+      throw std::runtime_error("invalid block size for the block cache in " + fDirectory);
+   if (gSystem->AccessPathName(fDirectory.c_str()) && gSystem->mkdir(fDirectory.c_str(), kTRUE) != 0 &&
+       gSystem->AccessPathName(fDirectory.c_str())) {
+      throw std::runtime_error("cannot create the block cache directory " + fDirectory);
+   }
+}
+
+std::shared_ptr<ROOT::Internal::RBlockCache> ROOT::Internal::RBlockCache::Get()
+{
+   auto &globalCache = GetGlobalBlockCache();
+   std::lock_guard<std::mutex> guard(globalCache.fMutex);
+   if (!globalCache.fIsConfigured) {
+      globalCache.fIsConfigured = true;
+      TString directory = gEnv ? gEnv->GetValue("BlockCache.Dir", "") : "";
+      if (!directory.IsNull()) {
+         gSystem->ExpandPathName(directory);
+         const std::uint64_t maxSizeMB = gEnv->GetValue("BlockCache.MaxSize", int(kDefaultMaxSize >> 20));
+         const std::size_t blockSizeKB = gEnv->GetValue("BlockCache.BlockSize", int(kDefaultBlockSize >> 10));
+         try {
+            globalCache.fCache = std::make_shared<RBlockCache>(directory.Data(), maxSizeMB << 20, blockSizeKB << 10);
+         } catch (const std::exception &e) {
+            ::Error("RBlockCache::Get", "block cache disabled: %s", e.what());
+         }
+      }
+   }
+   return globalCache.fCache;
+}
+
+void ROOT::Internal::RBlockCache::Set(std::shared_ptr<RBlockCache> cache)
+{
+   auto &globalCache = GetGlobalBlockCache();
+   std::lock_guard<std::mutex> guard(globalCache.fMutex);
+   globalCache.fIsConfigured = true;
+   globalCache.fCache = std::move(cache);
+}
+
+std::string ROOT::Internal::RBlockCache::GetBlockPath(const std::string &fileId, std::uint64_t offset) const
+{
+   char name[32];
+   snprintf(name, sizeof(name), "%016" PRIx64, offset);
+   return fDirectory + "/" + fileId + "/" + name;
+}
+
+/// Returns false if the block is not in the cache or does not have the expected size
+bool ROOT::Internal::RBlockCache::LoadBlock(const std::string &path, unsigned char *buffer, std::size_t size)
+{
+   std::ifstream in(path, std::ios::binary);
+   if (!in)
+      return false;
+   in.read(reinterpret_cast<char *>(buffer), size);
+   if (static_cast<std::size_t>(in.gcount()) != size || in.peek() != std::ifstream::traits_type::eof())
+      return false;
+   in.close();
+
+   // Keep the block from being evicted
+   FileStat_t stat;
+   const Long_t now = time(nullptr);
+   if (gSystem->GetPathInfo(path.c_str(), stat) == 0 && stat.fMtime + kTouchInterval < now)
+      gSystem->Utime(path.c_str(), now, 0);
+   return true;
+}
+
+void ROOT::Internal::RBlockCache::StoreBlock(const std::string &fileId, const std::string &path,
+                                             const unsigned char *buffer, std::size_t size)
+{
+   static std::atomic<unsigned int> gTemporaryCounter{0};
+
+   const std::string fileDirectory = fDirectory + "/" + fileId;
+   if (gSystem->AccessPathName(fileDirectory.c_str()))
+      gSystem->mkdir(fileDirectory.c_str());
+
+   // Readers in other processes must never see a partially written block
+   const auto slash = path.rfind('/');
+   const std::string temporary = path.substr(0, slash + 1) + "." + path.substr(slash + 1) + "." +
+                                 std::to_string(gSystem->GetPid()) + "." + std::to_string(gTemporaryCounter++);
+   {
+      std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+      out.write(reinterpret_cast<const char *>(buffer), size);
+      out.close();
+      if (!out) {
+         gSystem->Unlink(temporary.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(temporary.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(temporary.c_str());
+      return;
+   }
+
+   if ((fStoredSinceCleanUp += size) >= fMaxSize / 10)
+      CleanUp();
+}
+
+void ROOT::Internal::RBlockCache::CleanUp()
+{
+   std::unique_lock<std::mutex> lock(fCleanUpMutex, std::try_to_lock);
+   if (!lock.owns_lock())
+      return;
+   fStoredSinceCleanUp = 0;
+
+   const Long_t now = time(nullptr);
+   std::vector<RCachedBlock> blocks;
+   std::uint64_t totalSize = 0;
+   void *dirp = gSystem->OpenDirectory(fDirectory.c_str());
+   if (!dirp)
+      return;
+   while (const char *fileId = gSystem->GetDirEntry(dirp)) {
+      if (fileId[0] == '.')
+         continue;
+      const std::string fileDirectory = fDirectory + "/" + fileId;
+      void *fileDirp = gSystem->OpenDirectory(fileDirectory.c_str());
+      if (!fileDirp)
+         continue;
+      while (const char *name = gSystem->GetDirEntry(fileDirp)) {
+         if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+            continue;
+         const std::string path = fileDirectory + "/" + name;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+            continue;
+         if (name[0] == '.') {
+            if (stat.fMtime + kStaleTemporaryAge < now)
+               gSystem->Unlink(path.c_str());
+            continue;
+         }
+         blocks.push_back({stat.fMtime, static_cast<std::uint64_t>(stat.fSize), path});
+         totalSize += stat.fSize;
+      }
+      gSystem->FreeDirectory(fileDirp);
+   }
+   gSystem->FreeDirectory(dirp);
+
+   if (totalSize <= fMaxSize)
+      return;
+
+   // Concurrent clean-ups in other processes may remove the same blocks; failing to unlink them is harmless
+   std::sort(blocks.begin(), blocks.end(),
+             [](const RCachedBlock &a, const RCachedBlock &b) { return a.fMtime < b.fMtime; });
+   const std::uint64_t targetSize = fMaxSize / 10 * 9;
+   for (const auto &block : blocks) {
+      if (totalSize <= targetSize)
+         break;
+      gSystem->Unlink(block.fPath.c_str());
+      totalSize -= block.fSize;
+      // Removes the directory of the file once it is empty, fails otherwise
+      gSystem->Unlink(block.fPath.substr(0, block.fPath.rfind('/')).c_str());
+   }
+}
+
+void ROOT::Internal::RBlockCache::ReadV(const std::string &fileId, std::uint64_t fileSize, RRawFile::RIOVec *ioVec,
+                                        unsigned int nReq, const FetchFunc_t &fetch)
+{
+   // The sorted indexes of the blocks covered by the requests
+   std::vector<std::uint64_t> blocks;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = 0;
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min<std::uint64_t>(fileSize, ioVec[i].fOffset + ioVec[i].fSize);
+      for (std::uint64_t b = ioVec[i].fOffset / fBlockSize; b * fBlockSize < end; ++b)
+         blocks.emplace_back(b);
+   }
+   std::sort(blocks.begin(), blocks.end());
+   blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+   if (blocks.empty())
+      return;
+   auto blockSize = [&](std::uint64_t b) { return std::min<std::uint64_t>(fBlockSize, fileSize - b * fBlockSize); };
+
+   // The cached blocks are loaded at the beginning of the buffer, followed by the missing blocks. The missing blocks
+   // are thus consecutive in memory and can be fetched with a single vector read.
+   std::unique_ptr<unsigned char[]> buffer(new unsigned char[blocks.size() * fBlockSize]);
+   std::vector<unsigned char *> blockData(blocks.size(), nullptr);
+   std::vector<std::size_t> missing;
+   unsigned char *cursor = buffer.get();
+   for (std::size_t k = 0; k < blocks.size(); ++k) {
+      if (LoadBlock(GetBlockPath(fileId, blocks[k] * fBlockSize), cursor, blockSize(blocks[k]))) {
+         blockData[k] = cursor;
+         cursor += fBlockSize;
+      } else {
+         missing.emplace_back(k);
+      }
+   }
+   fNHits += blocks.size() - missing.size();
+   fNMisses += missing.size();
+
+   if (!missing.empty()) {
+      // Consecutive missing blocks are fetched as one request; only the last block of the file can be short
+      std::vector<RRawFile::RIOVec> requests;
+      for (std::size_t m = 0; m < missing.size(); ++m) {
+         const auto k = missing[m];
+         blockData[k] = cursor;
+         if (m > 0 && blocks[k] == blocks[missing[m - 1]] + 1 &&
+             requests.back().fSize < kMaxBlocksPerRequest * fBlockSize) {
+            requests.back().fSize += blockSize(blocks[k]);
+         } else {
+            RRawFile::RIOVec request;
+            request.fBuffer = cursor;
+            request.fOffset = blocks[k] * fBlockSize;
+            request.fSize = blockSize(blocks[k]);
+            requests.emplace_back(request);
+         }
+         cursor += fBlockSize;
+      }
+      fetch(requests.data(), requests.size());
+      for (const auto &request : requests) {
+         if (request.fOutBytes != request.fSize)
+            throw std::runtime_error("short read from the remote file while filling the block cache");
+      }
+      for (const auto k : missing)
+         StoreBlock(fileId, GetBlockPath(fileId, blocks[k] * fBlockSize), blockData[k], blockSize(blocks[k]));
+   }
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min<std::uint64_t>(fileSize, ioVec[i].fOffset + ioVec[i].fSize);
+      unsigned char *dest = static_cast<unsigned char *>(ioVec[i].fBuffer);
+      for (std::uint64_t pos = ioVec[i].fOffset; pos < end;) {
+         const std::uint64_t b = pos / fBlockSize;
+         const auto k = std::lower_bound(blocks.begin(), blocks.end(), b) - blocks.begin();
+         const std::uint64_t n = std::min(end, (b + 1) * fBlockSize) - pos;
+         memcpy(dest, blockData[k] + (pos - b * fBlockSize), n);
+         dest += n;
+         pos += n;
+      }
+      ioVec[i].fOutBytes = end - ioVec[i].fOffset;
+   }
+}
+
+ROOT::Internal::RRawFileBlockCache::RRawFileBlockCache(std::unique_ptr<RRawFile> remote,
+                                                       std::shared_ptr<RBlockCache> cache)
+   : RRawFile(remote->GetUrl(), ROptions()), fRemote(std::move(remote)), fCache(std::move(cache))
+{
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileBlockCache::Clone() const
+{
+   return std::make_unique<RRawFileBlockCache>(fRemote->Clone(), fCache);
+}
+
+void ROOT::Internal::RRawFileBlockCache::OpenImpl()
+{
+   const auto size = fRemote->GetSize();
+   if (size != kUnknownFileSize) {
+      const std::string key = fUrl + "#" + std::to_string(size);
+      TMD5 md5;
+      md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+      md5.Final();
+      fFileId = md5.AsString();
+   }
+   // The blocks are buffered by the cache
+   if (fOptions.fBlockSize < 0)
+      fOptions.fBlockSize = 0;
+}
+
+std::uint64_t ROOT::Internal::RRawFileBlockCache::GetSizeImpl()
+{
+   return fRemote->GetSize();
+}
+
+size_t ROOT::Internal::RRawFileBlockCache::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   RIOVec ioVec;
+   ioVec.fBuffer = buffer;
+   ioVec.fOffset = offset;
+   ioVec.fSize = nbytes;
+   ReadVImpl(&ioVec, 1);
+   return ioVec.fOutBytes;
+}
+
+void ROOT::Internal::RRawFileBlockCache::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // Without a size, the file cannot be cut into blocks
+   if (fFileId.empty()) {
+      fRemote->ReadV(ioVec, nReq);
+      return;
+   }
+   fCache->ReadV(fFileId, GetSize(), ioVec, nReq,
+                 [this](RIOVec *requests, unsigned int nRequests) { fRemote->ReadV(requests, nRequests); });
+}
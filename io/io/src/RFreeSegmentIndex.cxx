@@ -0,0 +1,125 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RFreeSegmentIndex.hxx>
+
+#include "TFree.h"
+#include "TList.h"
+
+#include <iterator>
+
+using ROOT::Internal::RFreeSegmentIndex;
+
+RFreeSegmentIndex::RFreeSegmentIndex(TList &list) : fList(list)
+{
+   Rebuild();
+}
+
+void RFreeSegmentIndex::Insert(TObjLink *link)
+{
+   auto segment = static_cast<TFree *>(link->GetObject());
+   fLinks[segment->GetFirst()] = link;
+   fSizes.emplace(segment->GetLast() - segment->GetFirst() + 1, segment->GetFirst());
+}
+
+void RFreeSegmentIndex::Erase(const TFree &segment)
+{
+   fLinks.erase(segment.GetFirst());
+   fSizes.erase({segment.GetLast() - segment.GetFirst() + 1, segment.GetFirst()});
+}
+
+void RFreeSegmentIndex::Rebuild()
+{
+   fLinks.clear();
+   fSizes.clear();
+   for (auto link = fList.FirstLink(); link; link = link->Next())
+      Insert(link);
+}
+
+void RFreeSegmentIndex::Sync()
+{
+   if (fLinks.size() != static_cast<std::size_t>(fList.GetSize()))
+      Rebuild();
+}
+
+TFree *RFreeSegmentIndex::GetBestFree(Int_t nbytes)
+{
+   Sync();
+   if (fLinks.empty())
+      return nullptr;
+
+   auto exact = fSizes.lower_bound({nbytes, 0});
+   if (exact != fSizes.end() && exact->first == nbytes)
+      return static_cast<TFree *>(fLinks[exact->second]->GetObject());
+   // the remainder of the segment needs room for the header of a gap
+   auto larger = fSizes.lower_bound({Long64_t(nbytes) + 4, 0});
+   if (larger != fSizes.end())
+      return static_cast<TFree *>(fLinks[larger->second]->GetObject());
+
+   // try big file
+   auto last = static_cast<TFree *>(fLinks.rbegin()->second->GetObject());
+   Resize(*last, last->GetFirst(), last->GetLast() + 1000000000LL);
+   return last;
+}
+
+TFree *RFreeSegmentIndex::AddFree(Long64_t first, Long64_t last)
+{
+   Sync();
+   auto next = fLinks.upper_bound(first);
+   if (next != fLinks.begin()) {
+      auto previous = static_cast<TFree *>(std::prev(next)->second->GetObject());
+      if (previous->GetLast() == first - 1) {
+         Long64_t newLast = last;
+         if (next != fLinks.end()) {
+            auto following = static_cast<TFree *>(next->second->GetObject());
+            if (following->GetFirst() <= last + 1) {
+               newLast = following->GetLast();
+               Remove(following);
+            }
+         }
+         Resize(*previous, previous->GetFirst(), newLast);
+         return previous;
+      }
+   }
+   if (next == fLinks.end())
+      return nullptr;
+   auto following = static_cast<TFree *>(next->second->GetObject());
+   if (following->GetFirst() == last + 1) {
+      Resize(*following, first, following->GetLast());
+      return following;
+   }
+
+   auto segment = new TFree();
+   segment->SetFirst(first);
+   segment->SetLast(last);
+   TObjLink *nextLink = next->second;
+   fList.AddBefore(nextLink, segment);
+   Insert(nextLink->Prev());
+   return segment;
+}
+
+void RFreeSegmentIndex::Resize(TFree &segment, Long64_t first, Long64_t last)
+{
+   Sync();
+   auto link = fLinks.at(segment.GetFirst());
+   Erase(segment);
+   segment.SetFirst(first);
+   segment.SetLast(last);
+   Insert(link);
+}
+
+void RFreeSegmentIndex::Remove(TFree *segment)
+{
+   Sync();
+   auto link = fLinks.at(segment->GetFirst());
+   Erase(*segment);
+   fList.Remove(link);
+   delete segment;
+}
@@ -0,0 +1,179 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RIOMetrics.hxx>
+
+#include "TEnv.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using ROOT::Experimental::RIOMetrics;
+
+namespace {
+
+struct RCounterInfo {
+   const char *fName;
+   /// Name in the Prometheus export, without the root_io_ prefix and the _total suffix
+   const char *fPrometheusName;
+   const char *fDescription;
+   bool fIsTime;
+};
+
+const RCounterInfo gCounterInfos[RIOMetrics::kNCounters] = {
+   {"bytesRequested", "bytes_requested", "Bytes requested by the readers of ROOT files", false},
+   {"bytesRead", "bytes_read", "Bytes read from the storage", false},
+   {"readCalls", "read_calls", "Read calls to the storage", false},
+   {"vectorReads", "vector_reads", "Vector reads from the storage", false},
+   {"cacheHits", "cache_hits", "Requests served by the read cache of a file", false},
+   {"cacheMisses", "cache_misses", "Requests not found in the read cache of a file", false},
+   {"unzipTime", "unzip_seconds", "Wall time spent decompressing", true},
+   {"deserializeTime", "deserialize_seconds", "Wall time spent deserializing TTree entries", true},
+};
+
+struct RThreadCounters {
+   std::array<std::atomic<std::uint64_t>, RIOMetrics::kNCounters> fValues{};
+};
+
+struct RRegistry {
+   std::mutex fMutex;
+   std::vector<RThreadCounters *> fThreadCounters;
+   /// Counters of the threads that have finished
+   RIOMetrics::Values_t fRetired{};
+};
+
+RRegistry &GetRegistry()
+{
+   // Never destroyed: threads may finish after the static objects are destroyed
+   static auto *registry = new RRegistry;
+   return *registry;
+}
+
+/// Registers the counters of a thread for its lifetime
+struct RThreadCountersHolder {
+   RThreadCounters fCounters;
+
+   RThreadCountersHolder()
+   {
+      auto &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      registry.fThreadCounters.push_back(&fCounters);
+   }
+
+   ~RThreadCountersHolder()
+   {
+      auto &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      for (unsigned int i = 0; i < RIOMetrics::kNCounters; ++i)
+         registry.fRetired[i] += fCounters.fValues[i].load(std::memory_order_relaxed);
+      auto &counters = registry.fThreadCounters;
+      counters.erase(std::remove(counters.begin(), counters.end(), &fCounters), counters.end());
+   }
+};
+
+double ToSeconds(std::uint64_t nanoseconds)
+{
+   return nanoseconds * 1e-9;
+}
+
+} // anonymous namespace
+
+std::atomic<int> RIOMetrics::fgEnabled{-1};
+
+bool RIOMetrics::ConfigureEnabled()
+{
+   int expected = -1;
+   const int enabled = (gEnv && gEnv->GetValue("IO.Metrics", 0) != 0) ? 1 : 0;
+   // Enable() may have been called concurrently, in which case its setting wins
+   fgEnabled.compare_exchange_strong(expected, enabled);
+   return fgEnabled.load() > 0;
+}
+
+void RIOMetrics::Enable(bool enable)
+{
+   fgEnabled = enable ? 1 : 0;
+}
+
+std::atomic<std::uint64_t> *RIOMetrics::GetThreadCounters()
+{
+   thread_local RThreadCountersHolder holder;
+   return holder.fCounters.fValues.data();
+}
+
+RIOMetrics::Values_t RIOMetrics::GetValues()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   auto values = registry.fRetired;
+   for (const auto *counters : registry.fThreadCounters) {
+      for (unsigned int i = 0; i < kNCounters; ++i)
+         values[i] += counters->fValues[i].load(std::memory_order_relaxed);
+   }
+   return values;
+}
+
+void RIOMetrics::Reset()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   registry.fRetired.fill(0);
+   for (auto *counters : registry.fThreadCounters) {
+      for (auto &value : counters->fValues)
+         value.store(0, std::memory_order_relaxed);
+   }
+}
+
+const char *RIOMetrics::GetName(ECounter counter)
+{
+   return gCounterInfos[counter].fName;
+}
+
+const char *RIOMetrics::GetDescription(ECounter counter)
+{
+   return gCounterInfos[counter].fDescription;
+}
+
+std::string RIOMetrics::ToJSON()
+{
+   const auto values = GetValues();
+   std::ostringstream os;
+   os.precision(9);
+   os << "{";
+   for (unsigned int i = 0; i < kNCounters; ++i) {
+      os << (i > 0 ? ", " : "") << '"' << gCounterInfos[i].fName << "\": ";
+      if (gCounterInfos[i].fIsTime)
+         os << ToSeconds(values[i]);
+      else
+         os << values[i];
+   }
+   os << "}";
+   return os.str();
+}
+
+std::string RIOMetrics::ToPrometheus()
+{
+   const auto values = GetValues();
+   std::ostringstream os;
+   os.precision(9);
+   for (unsigned int i = 0; i < kNCounters; ++i) {
+      const std::string name = std::string("root_io_") + gCounterInfos[i].fPrometheusName + "_total";
+      os << "# HELP " << name << ' ' << gCounterInfos[i].fDescription << '\n';
+      os << "# TYPE " << name << " counter\n";
+      os << name << ' ';
+      if (gCounterInfos[i].fIsTime)
+         os << ToSeconds(values[i]);
+      else
+         os << values[i];
+      os << '\n';
+   }
+   return os.str();
+}
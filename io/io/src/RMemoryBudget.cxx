@@ -0,0 +1,132 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RMemoryBudget.hxx>
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <sstream>
+
+using ROOT::Experimental::RMemoryBudget;
+
+namespace {
+
+const char *const gComponentNames[RMemoryBudget::kNComponents] = {"clusterPool", "treeCache", "bufferMerger",
+                                                                   "slotResults", "takeResults"};
+
+struct RCounters {
+   std::array<std::atomic<std::uint64_t>, RMemoryBudget::kNComponents> fUsage{};
+   std::array<std::atomic<std::uint64_t>, RMemoryBudget::kNComponents> fPeak{};
+   std::atomic<std::uint64_t> fTotalUsage{0};
+   std::atomic<std::uint64_t> fTotalPeak{0};
+   std::atomic<std::uint64_t> fLimit{0};
+};
+
+RCounters &GetCounters()
+{
+   // Never destroyed: buffers may be released after the static objects are destroyed
+   static auto *counters = new RCounters;
+   return *counters;
+}
+
+void UpdatePeak(std::atomic<std::uint64_t> &peak, std::uint64_t value)
+{
+   auto current = peak.load(std::memory_order_relaxed);
+   while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+   }
+}
+
+std::string ToMB(std::uint64_t bytes)
+{
+   char buffer[32];
+   std::snprintf(buffer, sizeof(buffer), "%12.1f", bytes / (1024. * 1024.));
+   return buffer;
+}
+
+} // anonymous namespace
+
+void RMemoryBudget::Add(EComponent component, std::uint64_t bytes)
+{
+   auto &counters = GetCounters();
+   UpdatePeak(counters.fPeak[component], counters.fUsage[component].fetch_add(bytes) + bytes);
+   UpdatePeak(counters.fTotalPeak, counters.fTotalUsage.fetch_add(bytes) + bytes);
+}
+
+void RMemoryBudget::Release(EComponent component, std::uint64_t bytes)
+{
+   auto &counters = GetCounters();
+   counters.fUsage[component].fetch_sub(bytes);
+   counters.fTotalUsage.fetch_sub(bytes);
+}
+
+void RMemoryBudget::SetLimit(std::uint64_t bytes)
+{
+   GetCounters().fLimit = bytes;
+}
+
+std::uint64_t RMemoryBudget::GetLimit()
+{
+   return GetCounters().fLimit.load(std::memory_order_relaxed);
+}
+
+bool RMemoryBudget::IsUnderPressure()
+{
+   const auto limit = GetLimit();
+   return limit > 0 && GetCounters().fTotalUsage.load(std::memory_order_relaxed) > limit / 4 * 3;
+}
+
+std::uint64_t RMemoryBudget::GetUsage(EComponent component)
+{
+   return GetCounters().fUsage[component].load();
+}
+
+std::uint64_t RMemoryBudget::GetPeak(EComponent component)
+{
+   return GetCounters().fPeak[component].load();
+}
+
+std::uint64_t RMemoryBudget::GetTotalUsage()
+{
+   return GetCounters().fTotalUsage.load();
+}
+
+std::uint64_t RMemoryBudget::GetTotalPeak()
+{
+   return GetCounters().fTotalPeak.load();
+}
+
+void RMemoryBudget::ResetPeaks()
+{
+   auto &counters = GetCounters();
+   for (unsigned int i = 0; i < kNComponents; ++i)
+      counters.fPeak[i] = counters.fUsage[i].load();
+   counters.fTotalPeak = counters.fTotalUsage.load();
+}
+
+const char *RMemoryBudget::GetName(EComponent component)
+{
+   return gComponentNames[component];
+}
+
+std::string RMemoryBudget::GetReport()
+{
+   std::ostringstream os;
+   os << "Component   Current [MB]    Peak [MB]\n";
+   for (unsigned int i = 0; i < kNComponents; ++i) {
+      const auto component = static_cast<EComponent>(i);
+      os << gComponentNames[i] << std::string(12 - std::string(gComponentNames[i]).size(), ' ')
+         << ToMB(GetUsage(component)) << ' ' << ToMB(GetPeak(component)) << '\n';
+   }
+   os << "total       " << ToMB(GetTotalUsage()) << ' ' << ToMB(GetTotalPeak()) << '\n';
+   if (GetLimit() > 0)
+      os << "limit       " << ToMB(GetLimit()) << '\n';
+   return os.str();
+}
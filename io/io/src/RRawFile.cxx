@@ -10,6 +10,7 @@
  *************************************************************************/
 
 #include <ROOT/RConfig.h>
+#include <ROOT/RBlockCache.hxx>
 #include <ROOT/RRawFile.hxx>
 #ifdef _WIN32
 #include <ROOT/RRawFileWin.hxx>
@@ -87,7 +88,10 @@ ROOT::Internal::RRawFile::Create(std::string_view url, ROptions options)
       if (TPluginHandler *h = gROOT->GetPluginManager()->
           FindHandler("ROOT::Internal::RRawFile", std::string(url).c_str())) {
          if (h->LoadPlugin() == 0) {
-            return std::unique_ptr<RRawFile>(reinterpret_cast<RRawFile *>(h->ExecPlugin(2, &url, &options)));
+            std::unique_ptr<RRawFile> file(reinterpret_cast<RRawFile *>(h->ExecPlugin(2, &url, &options)));
+            if (auto cache = RBlockCache::Get())
+               return std::make_unique<RRawFileBlockCache>(std::move(file), std::move(cache));
+            return file;
          }
          throw std::runtime_error("Cannot load plugin handler for " + plgclass);
       }
@@ -216,6 +220,19 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+void ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   ReadVAsyncImpl(ioVec, nReq);
+}
+
+void ROOT::Internal::RRawFile::WaitReadV(RIOVec *ioVec, unsigned int nReq)
+{
+   WaitReadVImpl(ioVec, nReq);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
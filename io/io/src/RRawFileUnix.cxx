@@ -23,6 +23,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,6 +36,18 @@ namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
 } // anonymous namespace
 
+#ifdef R__HAS_URING
+struct ROOT::Internal::RRawFileUnix::RUringState {
+   /// Created once per file and reused for all vector reads, which avoids the ring setup cost on every ReadV()
+   RIoUring fRing;
+   /// The read events of the vector reads that have been submitted by ReadVAsyncImpl() but not yet been waited
+   /// for, keyed by the ioVec array of the request
+   std::unordered_map<RIOVec *, std::vector<RIoUring::RReadEvent>> fAsyncReads;
+};
+#else
+struct ROOT::Internal::RRawFileUnix::RUringState {};
+#endif
+
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
    : RRawFile(url, options), fFileDes(-1)
 {
@@ -42,17 +55,53 @@ ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions option
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+#ifdef R__HAS_URING
+   // The kernel must not write into the destination buffers after the file is gone
+   if (fUringState) {
+      for (auto &read : fUringState->fAsyncReads) {
+         try {
+            fUringState->fRing.WaitForReads(read.second.data(), read.second.size());
+         } catch (const std::runtime_error &e) {
+            Warning("RRawFileUnix", "pending asynchronous read failed on close: %s", e.what());
+         }
+      }
+   }
+#endif
    if (fFileDes >= 0)
       close(fFileDes);
 }
 
+bool ROOT::Internal::RRawFileUnix::InitUring()
+{
+#ifdef R__HAS_URING
+   thread_local bool uring_failed = false;
+   if (fUringState)
+      return true;
+   if (uring_failed)
+      return false;
+   try {
+      fUringState = std::make_unique<RUringState>(); // throws std::runtime_error
+      return true;
+   } catch (const std::runtime_error &e) {
+      Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
+      Warning("RRawFileUnix", "io_uring setup failed, falling back to blocking I/O in ReadV");
+      uring_failed = true;
+   }
+#endif
+   return false;
+}
+
 std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone() const
 {
    return std::make_unique<RRawFileUnix>(fUrl, fOptions);
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#else
    return kFeatureHasSize | kFeatureHasMmap;
+#endif
 }
 
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
@@ -113,39 +162,68 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 }
 
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   if (InitUring()) {
+      ReadVAsyncImpl(ioVec, nReq);
+      WaitReadVImpl(ioVec, nReq);
+      return;
+   }
+   RRawFile::ReadVImpl(ioVec, nReq);
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
-   thread_local bool uring_failed = false;
-   if (!uring_failed) {
-      try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
-         return;
+   if (InitUring()) {
+      auto &reads = fUringState->fAsyncReads[ioVec];
+      R__ASSERT(reads.empty()); // the same ioVec array must not be submitted twice without waiting in between
+      reads.reserve(nReq);
+      for (std::size_t i = 0; i < nReq; ++i) {
+         RIoUring::RReadEvent ev;
+         ev.fBuffer = ioVec[i].fBuffer;
+         ev.fOffset = ioVec[i].fOffset;
+         ev.fSize = ioVec[i].fSize;
+         ev.fFileDes = fFileDes;
+         reads.push_back(ev);
       }
-      catch(const std::runtime_error &e) {
-         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
-         uring_failed = true;
+      try {
+         fUringState->fRing.SubmitReads(reads.data(), nReq);
+      } catch (const std::runtime_error &e) {
+         throw std::runtime_error("Cannot submit reads for '" + fUrl + "', error: " + e.what());
       }
+      return;
    }
 #endif
    RRawFile::ReadVImpl(ioVec, nReq);
 }
 
+void ROOT::Internal::RRawFileUnix::WaitReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   if (!fUringState)
+      return;
+   auto itr = fUringState->fAsyncReads.find(ioVec);
+   // Not found if the request fell back to synchronous reading
+   if (itr == fUringState->fAsyncReads.end())
+      return;
+   auto &reads = itr->second;
+   R__ASSERT(reads.size() == nReq);
+   try {
+      fUringState->fRing.WaitForReads(reads.data(), nReq);
+   } catch (const std::runtime_error &e) {
+      fUringState->fAsyncReads.erase(itr);
+      throw std::runtime_error("Cannot read from '" + fUrl + "', error: " + e.what());
+   }
+   for (std::size_t i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = reads[i].fOutBytes;
+   }
+   fUringState->fAsyncReads.erase(itr);
+#else
+   (void)ioVec;
+   (void)nReq;
+#endif
+}
+
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
    size_t total_bytes = 0;
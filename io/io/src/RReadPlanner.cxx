@@ -0,0 +1,136 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RReadPlanner.hxx>
+
+#include "TEnv.h"
+#include "TError.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+/// XRootD splits vector read elements larger than this into several elements anyway
+constexpr std::uint64_t kXRootDMaxReadVChunk = 2097136;
+} // anonymous namespace
+
+ROOT::Internal::RReadPlanner::RSettings
+ROOT::Internal::RReadPlanner::RSettings::GetForTransport(std::string_view transport)
+{
+   RSettings settings;
+   if (transport == "root" || transport == "roots") {
+      settings.fMaxRequestSize = kXRootDMaxReadVChunk;
+      settings.fSplitLargeRanges = true;
+   } else if (transport == "http" || transport == "https") {
+      // Every request is a round trip; rather read more bytes than issue more requests
+      settings.fMaxOverheadFraction = 0.5;
+   }
+
+   if (gEnv) {
+      if (gEnv->Defined("ReadPlanner.MaxGap"))
+         settings.fMaxGap = std::strtoull(gEnv->GetValue("ReadPlanner.MaxGap", "0"), nullptr, 10);
+      if (gEnv->Defined("ReadPlanner.MaxOverheadFraction"))
+         settings.fMaxOverheadFraction = gEnv->GetValue("ReadPlanner.MaxOverheadFraction", 0.);
+      if (gEnv->Defined("ReadPlanner.MaxRequestSize"))
+         settings.fMaxRequestSize = std::strtoull(gEnv->GetValue("ReadPlanner.MaxRequestSize", "0"), nullptr, 10);
+   }
+   return settings;
+}
+
+ROOT::Internal::RReadPlanner::RPlan
+ROOT::Internal::RReadPlanner::Plan(const RRange *ranges, std::size_t nRanges, const RSettings &settings)
+{
+   RPlan plan;
+   if (nRanges == 0)
+      return plan;
+
+   for (std::size_t i = 0; i < nRanges; ++i) {
+      R__ASSERT(i == 0 || ranges[i].fOffset >= ranges[i - 1].fOffset + ranges[i - 1].fSize);
+      plan.fSzPayload += ranges[i].fSize;
+   }
+
+   // In order to coalesce close-by ranges, we collect the sizes of the gaps between ranges.  We then order
+   // the gaps by size, sum them up and find a cutoff for the largest gap that we tolerate when coalescing ranges.
+   // The size of the cutoff is given by the fraction of extra bytes we are willing to read in order to reduce
+   // the number of read requests.  We thus schedule the lowest number of requests given a tolerable fraction
+   // of extra bytes.
+   std::uint64_t gapCut = settings.fMaxGap;
+   if (settings.fMaxOverheadFraction >= 0) {
+      const double maxOverhead = settings.fMaxOverheadFraction * double(plan.fSzPayload);
+      std::vector<std::uint64_t> gaps;
+      gaps.reserve(nRanges - 1);
+      for (std::size_t i = 1; i < nRanges; ++i)
+         gaps.emplace_back(ranges[i].fOffset - (ranges[i - 1].fOffset + ranges[i - 1].fSize));
+      std::sort(gaps.begin(), gaps.end());
+      std::uint64_t budgetCut = 0;
+      double szExtra = 0.0;
+      for (std::size_t i = 0; i < gaps.size();) {
+         const auto g = gaps[i];
+         for (; i < gaps.size() && gaps[i] == g; ++i)
+            szExtra += g;
+         if (szExtra > maxOverhead)
+            break;
+         budgetCut = g;
+      }
+      gapCut = std::min(gapCut, budgetCut);
+   }
+
+   const auto maxRequestSize = settings.fMaxRequestSize;
+   plan.fRangeBufferOffsets.resize(nRanges);
+   RRequest req;
+   bool isOpen = false;
+   auto fnCloseRequest = [&]() {
+      if (!isOpen)
+         return;
+      plan.fRequests.emplace_back(req);
+      plan.fBufferSize += req.fSize;
+      isOpen = false;
+   };
+
+   for (std::size_t i = 0; i < nRanges; ++i) {
+      const auto &r = ranges[i];
+      if (isOpen) {
+         const auto gap = r.fOffset - (req.fOffset + req.fSize);
+         if (gap <= gapCut && (maxRequestSize == 0 || req.fSize + gap + r.fSize <= maxRequestSize)) {
+            plan.fRangeBufferOffsets[i] = plan.fBufferSize + req.fSize + gap;
+            plan.fSzOverhead += gap;
+            req.fSize += gap + r.fSize;
+            req.fNRanges++;
+            continue;
+         }
+         fnCloseRequest();
+      }
+
+      plan.fRangeBufferOffsets[i] = plan.fBufferSize;
+      if (settings.fSplitLargeRanges && maxRequestSize > 0 && r.fSize > maxRequestSize) {
+         // Emit the pieces of the split range as separate requests that are not coalesced with other ranges
+         for (std::uint64_t pos = 0; pos < r.fSize; pos += maxRequestSize) {
+            req.fOffset = r.fOffset + pos;
+            req.fSize = std::min(maxRequestSize, r.fSize - pos);
+            req.fBufferOffset = plan.fBufferSize;
+            req.fFirstRange = i;
+            req.fNRanges = 1;
+            isOpen = true;
+            fnCloseRequest();
+         }
+         continue;
+      }
+
+      req.fOffset = r.fOffset;
+      req.fSize = r.fSize;
+      req.fBufferOffset = plan.fBufferSize;
+      req.fFirstRange = i;
+      req.fNRanges = 1;
+      isOpen = true;
+   }
+   fnCloseRequest();
+
+   return plan;
+}
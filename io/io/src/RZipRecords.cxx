@@ -0,0 +1,139 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RZipRecords.hxx>
+
+#include "RZip.h"
+#include "ROOT/RConfig.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#include "TROOT.h"
+#endif
+
+#include <cstring>
+#include <vector>
+
+Int_t ROOT::Internal::ZipRecords(Int_t cxlevel, Int_t cxAlgorithm, char *src, Int_t srcSize, char *tgt,
+                                 Int_t chunkSize)
+{
+   const Int_t nChunks = 1 + (srcSize - 1) / chunkSize;
+   // Every chunk is compressed into its own region of the output buffer such that the chunks can be compressed
+   // independently; the compressed chunks are moved next to each other afterwards.
+   std::vector<Int_t> nouts(nChunks, 0);
+   auto fnZipChunk = [&](Int_t i) {
+      Int_t srcsize = (i == nChunks - 1) ? srcSize - i * chunkSize : chunkSize;
+      Int_t tgtsize = srcsize;
+      R__zipMultipleAlgorithm(cxlevel, &srcsize, src + i * chunkSize, &tgtsize, tgt + i * chunkSize, &nouts[i],
+                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(cxAlgorithm));
+   };
+
+#ifdef R__USE_IMT
+   if (nChunks > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::Experimental::TTaskGroup chunkTasks;
+      for (Int_t i = 0; i < nChunks; ++i)
+         chunkTasks.Run([&fnZipChunk, i]() { fnZipChunk(i); });
+      chunkTasks.Wait();
+   } else
+#endif
+   {
+      for (Int_t i = 0; i < nChunks; ++i) {
+         fnZipChunk(i);
+         if (nouts[i] == 0)
+            return 0;
+      }
+   }
+
+   Int_t noutot = 0;
+   for (Int_t i = 0; i < nChunks; ++i) {
+      if (nouts[i] == 0)
+         return 0;
+      if (noutot != i * chunkSize)
+         memmove(tgt + noutot, tgt + i * chunkSize, nouts[i]);
+      noutot += nouts[i];
+   }
+   return noutot;
+}
+
+Int_t ROOT::Internal::UnzipRecords(UChar_t *src, Int_t srcSize, char *tgt, Int_t tgtSize)
+{
+   Int_t nintot = 0;
+   if (ROOT::IsImplicitMTEnabled() && UnzipRecordsInParallel(src, srcSize, tgt, tgtSize, nintot))
+      return tgtSize;
+
+   Int_t nin, nbuf, nout = 0;
+   Int_t noutot = 0;
+   while (1) {
+      Int_t hc = R__unzip_header(&nin, src, &nbuf);
+      if (hc != 0)
+         break;
+      R__unzip(&nin, src, &nbuf, (unsigned char *)tgt, &nout);
+      if (!nout)
+         break;
+      noutot += nout;
+      if (noutot >= tgtSize)
+         break;
+      src += nin;
+      tgt += nout;
+   }
+   return nout ? noutot : 0;
+}
+
+bool ROOT::Internal::UnzipRecordsInParallel(UChar_t *src, Int_t srcSize, char *tgt, Int_t tgtSize, Int_t &nintot)
+{
+#ifdef R__USE_IMT
+   constexpr Int_t kHeaderSize = 9;
+   struct RChunk {
+      Int_t fInOffset;
+      Int_t fOutOffset;
+      Int_t fNin;
+      Int_t fNbuf;
+   };
+   std::vector<RChunk> chunks;
+   Int_t inOffset = 0;
+   Int_t outOffset = 0;
+   while (outOffset < tgtSize) {
+      Int_t nin = 0, nbuf = 0;
+      if (srcSize - inOffset < kHeaderSize || R__unzip_header(&nin, src + inOffset, &nbuf) != 0)
+         return false;
+      if (nin <= kHeaderSize || nbuf <= 0 || nin > srcSize - inOffset || nbuf > tgtSize - outOffset)
+         return false;
+      chunks.push_back({inOffset, outOffset, nin, nbuf});
+      inOffset += nin;
+      outOffset += nbuf;
+   }
+   if (chunks.size() < 2)
+      return false;
+
+   std::vector<Int_t> nouts(chunks.size(), 0);
+   ROOT::Experimental::TTaskGroup chunkTasks;
+   for (std::size_t i = 0; i < chunks.size(); ++i) {
+      chunkTasks.Run([&chunks, &nouts, src, tgt, i]() {
+         Int_t nin = chunks[i].fNin;
+         Int_t nbuf = chunks[i].fNbuf;
+         R__unzip(&nin, src + chunks[i].fInOffset, &nbuf, (unsigned char *)tgt + chunks[i].fOutOffset, &nouts[i]);
+      });
+   }
+   chunkTasks.Wait();
+   for (std::size_t i = 0; i < chunks.size(); ++i) {
+      if (nouts[i] != chunks[i].fNbuf)
+         return false;
+   }
+   nintot = inOffset;
+   return true;
+#else
+   (void)src;
+   (void)srcSize;
+   (void)tgt;
+   (void)tgtSize;
+   (void)nintot;
+   return false;
+#endif
+}
@@ -20,6 +20,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include <string.h>
 #include <typeinfo>
 #include <string>
+#include <algorithm>
 
 #include "TFile.h"
 #include "TBufferFile.h"
@@ -35,8 +36,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
 
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
+#ifdef R__BYTESWAP
 #define USE_BSWAPCPY
 #endif
 
@@ -53,6 +53,8 @@ const Version_t kByteCountVMask = 0x4000;      // OR the version byte count with
 const Version_t kMaxVersion     = 0x3FFF;      // highest possible version number
 const Int_t  kMapOffset         = 2;   // first 2 map entries are taken by null obj and self obj
 
+static char gNoSegmentData = 0;        // the initial, empty buffer of a TBufferFile reading from segments
+
 
 ClassImp(TBufferFile);
 
@@ -106,6 +108,36 @@ TBufferFile::TBufferFile(TBuffer::EMode mode, Int_t bufsiz, void *buf, Bool_t ad
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create an I/O buffer object for reading from several non-owned segments,
+/// e.g. network packets or pages, without copying them into a contiguous
+/// buffer. The data is the concatenation of the segments, which must stay
+/// valid and unchanged for the lifetime of the buffer.
+///
+/// Reads are served from the current segment. Only the bytes of a single
+/// read that spans a segment boundary, e.g. an integer or an array cut by the
+/// boundary, are copied. Length() and SetBufferOffset() refer to the offset
+/// in the data; Buffer() and GetCurrent() refer to the current segment.
+
+TBufferFile::TBufferFile(TBuffer::EMode mode, const std::vector<RSegment> &segments) :
+   TBufferIO(mode, 0, &gNoSegmentData, kFALSE),
+   fInfo(nullptr), fInfoStack(), fSegments(segments)
+{
+   R__ASSERT(IsReading());
+
+   Long64_t size = 0;
+   fSegmentEnds.reserve(fSegments.size());
+   for (const auto &segment : fSegments) {
+      size += segment.fSize;
+      if (segment.fSize < 0 || size > kMaxInt)
+         Fatal("TBufferFile", "Request to read from segments of a total size of %lld for a max of %d.", size, kMaxInt);
+      fSegmentEnds.push_back(size);
+   }
+   fBufSize = Int_t(size);
+   if (!fSegments.empty())
+      SetWindow(0, 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Delete an I/O buffer object.
 
@@ -113,6 +145,56 @@ TBufferFile::~TBufferFile()
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Position the buffer at a given offset outside of the current segment.
+
+void TBufferFile::SeekBuffer(Int_t offset)
+{
+   if (fSegments.empty()) {
+      TBufferIO::SeekBuffer(offset);
+      return;
+   }
+   SetWindow(offset, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Position the buffer at offset in the data read from several segments such
+/// that the next nbytes are contiguous between fBufCur and fBufMax. fBuffer
+/// points to the segment containing them or, if they span several segments,
+/// to a copy of just these bytes.
+
+void TBufferFile::SetWindow(Int_t offset, Int_t nbytes)
+{
+   // The first segment that ends after offset
+   std::size_t idx = std::upper_bound(fSegmentEnds.begin(), fSegmentEnds.end(), offset) - fSegmentEnds.begin();
+   if (offset >= 0 && idx < fSegments.size() && offset + nbytes <= fSegmentEnds[idx]) {
+      const Int_t start = fSegmentEnds[idx] - fSegments[idx].fSize;
+      fBuffer = const_cast<char *>(fSegments[idx].fBuffer);
+      fBufOffset = start;
+      fBufCur = fBuffer + (offset - start);
+      fBufMax = fBuffer + fSegments[idx].fSize;
+      return;
+   }
+
+   if (offset < 0 || offset + nbytes > fBufSize) {
+      Error("SetWindow", "Reading %d bytes at offset %d, beyond the end of the buffer of size %d", nbytes, offset,
+            fBufSize);
+      offset = TMath::Max(0, TMath::Min(offset, fBufSize));
+   }
+   fBridge.assign(TMath::Max(nbytes, 1), 0);
+   Int_t ncopied = 0;
+   for (; ncopied < nbytes && idx < fSegments.size(); ++idx) {
+      const Int_t pos = offset + ncopied - (fSegmentEnds[idx] - fSegments[idx].fSize);
+      const Int_t n = TMath::Min(nbytes - ncopied, fSegments[idx].fSize - pos);
+      memcpy(fBridge.data() + ncopied, fSegments[idx].fBuffer + pos, n);
+      ncopied += n;
+   }
+   fBuffer = fBridge.data();
+   fBufOffset = offset;
+   fBufCur = fBuffer;
+   fBufMax = fBuffer + nbytes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment level.
 
@@ -171,6 +253,7 @@ static void frombufOld(char *&buf, Long_t *x)
 
 void TBufferFile::ReadLong(Long_t &l)
 {
+   CheckSegment(sizeof(Long_t));
    TFile *file = (TFile*)fParent;
    if (file && file->GetVersion() < 30006) {
       frombufOld(fBufCur, &l);
@@ -358,10 +441,13 @@ Int_t TBufferFile::CheckByteCount(UInt_t startpos, UInt_t bcnt, const TClass *cl
 
    Int_t  offset = 0;
 
-   Longptr_t endpos = Longptr_t(fBuffer) + startpos + bcnt + sizeof(UInt_t);
+   // Offsets in the data, fBuffer is not the start of the data when reading from several segments
+   Long64_t endpos = Long64_t(startpos) + bcnt + sizeof(UInt_t);
+   Long64_t curpos = Length();
+   Long64_t maxpos = fSegments.empty() ? Long64_t(fBufMax - fBuffer) : fBufSize;
 
-   if (Longptr_t(fBufCur) != endpos) {
-      offset = Int_t(Longptr_t(fBufCur) - endpos);
+   if (curpos != endpos) {
+      offset = Int_t(curpos - endpos);
 
       const char *name = clss ? clss->GetName() : classname ? classname : 0;
 
@@ -381,16 +467,16 @@ Int_t TBufferFile::CheckByteCount(UInt_t startpos, UInt_t bcnt, const TClass *cl
                        name);
          }
       }
-      if ( ((char *)endpos) > fBufMax ) {
-         offset = fBufMax-fBufCur;
+      if ( endpos > maxpos ) {
+         offset = Int_t(maxpos - curpos);
          Error("CheckByteCount",
                "Byte count probably corrupted around buffer position %d:\n\t%d for a possible maximum of %d",
                startpos, bcnt, offset);
-         fBufCur = fBufMax;
+         SetBufferOffset(Int_t(maxpos));
 
       } else {
 
-         fBufCur = (char *) endpos;
+         SetBufferOffset(Int_t(endpos));
 
       }
    }
@@ -471,6 +557,7 @@ void TBufferFile::ReadWithFactor(Float_t *ptr, Double_t factor, Double_t minvalu
 {
    //a range was specified. We read an integer and convert it back to a double.
    UInt_t aint;
+   CheckSegment(sizeof(UInt_t));
    frombuf(this->fBufCur,&aint);
    ptr[0] = (Float_t)(aint/factor + minvalue);
 }
@@ -489,6 +576,7 @@ void TBufferFile::ReadWithNbits(Float_t *ptr, Int_t nbits)
    } temp;
    UChar_t  theExp;
    UShort_t theMan;
+   CheckSegment(sizeof(UChar_t) + sizeof(UShort_t));
    frombuf(this->fBufCur,&theExp);
    frombuf(this->fBufCur,&theMan);
    temp.fIntValue = theExp;
@@ -506,6 +594,7 @@ void TBufferFile::ReadWithFactor(Double_t *ptr, Double_t factor, Double_t minval
 {
    //a range was specified. We read an integer and convert it back to a double.
    UInt_t aint;
+   CheckSegment(sizeof(UInt_t));
    frombuf(this->fBufCur,&aint);
    ptr[0] = (Double_t)(aint/factor + minvalue);
 }
@@ -524,6 +613,7 @@ void TBufferFile::ReadWithNbits(Double_t *ptr, Int_t nbits)
    } temp;
    UChar_t  theExp;
    UShort_t theMan;
+   CheckSegment(sizeof(UChar_t) + sizeof(UShort_t));
    frombuf(this->fBufCur,&theExp);
    frombuf(this->fBufCur,&theMan);
    temp.fIntValue = theExp;
@@ -706,6 +796,7 @@ Int_t TBufferFile::ReadArray(Bool_t *&b)
    *this >> n;
 
    if (n <= 0 || n > fBufSize) return 0;
+   CheckSegment(sizeof(Bool_t)*n);
 
    if (!b) b = new Bool_t[n];
 
@@ -735,6 +826,7 @@ Int_t TBufferFile::ReadArray(Char_t *&c)
    Int_t l = sizeof(Char_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!c) c = new Char_t[n];
 
@@ -758,6 +850,7 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    Int_t l = sizeof(Short_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!h) h = new Short_t[n];
 
@@ -791,6 +884,7 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    Int_t l = sizeof(Int_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!ii) ii = new Int_t[n];
 
@@ -824,6 +918,7 @@ Int_t TBufferFile::ReadArray(Long_t *&ll)
    Int_t l = sizeof(Long_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!ll) ll = new Long_t[n];
 
@@ -850,12 +945,18 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    Int_t l = sizeof(Long64_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &ll[i]);
+# endif
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -878,6 +979,7 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    Int_t l = sizeof(Float_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!f) f = new Float_t[n];
 
@@ -911,12 +1013,18 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    Int_t l = sizeof(Double_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &d[i]);
+# endif
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -981,6 +1089,7 @@ Int_t TBufferFile::ReadStaticArray(Bool_t *b)
    *this >> n;
 
    if (n <= 0 || n > fBufSize) return 0;
+   CheckSegment(sizeof(Bool_t)*n);
 
    if (!b) return 0;
 
@@ -1009,6 +1118,7 @@ Int_t TBufferFile::ReadStaticArray(Char_t *c)
    Int_t l = sizeof(Char_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!c) return 0;
 
@@ -1031,6 +1141,7 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    Int_t l = sizeof(Short_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!h) return 0;
 
@@ -1063,6 +1174,7 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    Int_t l = sizeof(Int_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!ii) return 0;
 
@@ -1095,6 +1207,7 @@ Int_t TBufferFile::ReadStaticArray(Long_t *ll)
    Int_t l = sizeof(Long_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!ll) return 0;
 
@@ -1120,12 +1233,18 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    Int_t l = sizeof(Long64_t)*n;
 
    if (l <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &ll[i]);
+# endif
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1147,6 +1266,7 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    Int_t l = sizeof(Float_t)*n;
 
    if (n <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!f) return 0;
 
@@ -1179,12 +1299,18 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    Int_t l = sizeof(Double_t)*n;
 
    if (n <= 0 || l > fBufSize) return 0;
+   CheckSegment(l);
 
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &d[i]);
+# endif
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1241,6 +1367,7 @@ Int_t TBufferFile::ReadStaticArrayDouble32(Double_t *d, TStreamerElement *ele)
 void TBufferFile::ReadFastArray(Bool_t *b, Int_t n)
 {
    if (n <= 0 || n > fBufSize) return;
+   CheckSegment(sizeof(Bool_t)*n);
 
    if (sizeof(Bool_t) > 1) {
       for (int i = 0; i < n; i++)
@@ -1258,6 +1385,7 @@ void TBufferFile::ReadFastArray(Bool_t *b, Int_t n)
 void TBufferFile::ReadFastArray(Char_t *c, Int_t n)
 {
    if (n <= 0 || n > fBufSize) return;
+   CheckSegment(sizeof(Char_t)*n);
 
    Int_t l = sizeof(Char_t)*n;
    memcpy(c, fBufCur, l);
@@ -1279,6 +1407,7 @@ void TBufferFile::ReadFastArrayString(Char_t *c, Int_t n)
    }
    if (len) {
       if (len <= 0 || len > fBufSize) return;
+      CheckSegment(len);
       Int_t blen = len;
       if (len >= n) len = n-1;
 
@@ -1299,6 +1428,7 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
 {
    Int_t l = sizeof(Short_t)*n;
    if (n <= 0 || l > fBufSize) return;
+   CheckSegment(l);
 
 #ifdef R__BYTESWAP
 # ifdef USE_BSWAPCPY
@@ -1321,6 +1451,7 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
 {
    Int_t l = sizeof(Int_t)*n;
    if (l <= 0 || l > fBufSize) return;
+   CheckSegment(l);
 
 #ifdef R__BYTESWAP
 # ifdef USE_BSWAPCPY
@@ -1343,6 +1474,7 @@ void TBufferFile::ReadFastArray(Long_t *ll, Int_t n)
 {
    Int_t l = sizeof(Long_t)*n;
    if (l <= 0 || l > fBufSize) return;
+   CheckSegment(l);
 
    TFile *file = (TFile*)fParent;
    if (file && file->GetVersion() < 30006) {
@@ -1359,10 +1491,16 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
 {
    Int_t l = sizeof(Long64_t)*n;
    if (l <= 0 || l > fBufSize) return;
+   CheckSegment(l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &ll[i]);
+# endif
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1376,6 +1514,7 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
 {
    Int_t l = sizeof(Float_t)*n;
    if (l <= 0 || l > fBufSize) return;
+   CheckSegment(l);
 
 #ifdef R__BYTESWAP
 # ifdef USE_BSWAPCPY
@@ -1398,10 +1537,16 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
 {
    Int_t l = sizeof(Double_t)*n;
    if (l <= 0 || l > fBufSize) return;
+   CheckSegment(l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &d[i]);
+# endif
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1832,8 +1977,13 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, ll, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, ll[i]);
+# endif
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1887,8 +2037,13 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, d, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, d[i]);
+# endif
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2076,8 +2231,13 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, ll, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, ll[i]);
+# endif
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2119,8 +2279,13 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, d, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, d[i]);
+# endif
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2354,7 +2519,7 @@ void *TBufferFile::ReadObjectAny(const TClass *clCast)
    InitMap();
 
    // before reading object save start position
-   UInt_t startpos = UInt_t(fBufCur-fBuffer);
+   UInt_t startpos = UInt_t(Length());
 
    // attempt to load next object as TClass clCast
    UInt_t tag;       // either tag or byte count
@@ -2408,7 +2573,7 @@ void *TBufferFile::ReadObjectAny(const TClass *clCast)
 
    // unknown class, skip to next object and return 0 obj
    if (clRef == (TClass*) -1) {
-      if (fBufCur >= fBufMax) return 0;
+      if (Length() >= fBufSize) return 0;
       if (fVersion > 0)
          MapObject((TObject*) -1, startpos+kMapOffset);
       else
@@ -2583,7 +2748,7 @@ TClass *TBufferFile::ReadClass(const TClass *clReq, UInt_t *objTag)
       bcnt = 0;
    } else {
       fVersion = 1;
-      startpos = UInt_t(fBufCur-fBuffer);
+      startpos = UInt_t(Length());
       *this >> tag;
    }
 
@@ -2694,11 +2859,14 @@ void TBufferFile::SkipVersion(const TClass *cl)
    Version_t version;
 
    // not interested in byte count
+   CheckSegment(sizeof(Version_t));
    frombuf(this->fBufCur,&version);
 
    // if this is a byte count, then skip next short and read version
    if (version & kByteCountVMask) {
+      CheckSegment(sizeof(Version_t));
       frombuf(this->fBufCur,&version);
+      CheckSegment(sizeof(Version_t));
       frombuf(this->fBufCur,&version);
    }
 
@@ -2706,6 +2874,7 @@ void TBufferFile::SkipVersion(const TClass *cl)
       if (version <= 0)  {
          UInt_t checksum = 0;
          //*this >> checksum;
+         CheckSegment(sizeof(UInt_t));
          frombuf(this->fBufCur,&checksum);
          TStreamerInfo *vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
          if (vinfo) {
@@ -2766,7 +2935,7 @@ Version_t TBufferFile::ReadVersion(UInt_t *startpos, UInt_t *bcnt, const TClass
 
    if (startpos) {
       // before reading object save start position
-      *startpos = UInt_t(fBufCur-fBuffer);
+      *startpos = UInt_t(Length());
    }
 
    // read byte count (older files don't have byte count)
@@ -2777,6 +2946,7 @@ Version_t TBufferFile::ReadVersion(UInt_t *startpos, UInt_t *bcnt, const TClass
       UInt_t     cnt;
       Version_t  vers[2];
    } v;
+   CheckSegment(sizeof(UInt_t));
 #ifdef R__BYTESWAP
    frombuf(this->fBufCur,&v.vers[1]);
    frombuf(this->fBufCur,&v.vers[0]);
@@ -2791,6 +2961,7 @@ Version_t TBufferFile::ReadVersion(UInt_t *startpos, UInt_t *bcnt, const TClass
       v.cnt = 0;
    }
    if (bcnt) *bcnt = (v.cnt & ~kByteCountMask);
+   CheckSegment(sizeof(Version_t));
    frombuf(this->fBufCur,&version);
 
    if (version<=1) {
@@ -2802,6 +2973,7 @@ Version_t TBufferFile::ReadVersion(UInt_t *startpos, UInt_t *bcnt, const TClass
                 ) {
                UInt_t checksum = 0;
                //*this >> checksum;
+               CheckSegment(sizeof(UInt_t));
                frombuf(this->fBufCur,&checksum);
                TStreamerInfo *vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
                if (vinfo) {
@@ -2829,8 +3001,10 @@ Version_t TBufferFile::ReadVersion(UInt_t *startpos, UInt_t *bcnt, const TClass
             UInt_t checksum = 0;
             //*this >> checksum;
             // If *bcnt < 6 then we have a class with 'just' version zero and no checksum
-            if (v.cnt && v.cnt >= 6)
+            if (v.cnt && v.cnt >= 6) {
+               CheckSegment(sizeof(UInt_t));
                frombuf(this->fBufCur,&checksum);
+            }
          }
       }  else if (version == 1 && fParent && ((TFile*)fParent)->GetVersion()<40000 && cl && cl->GetClassVersion() != 0) {
          // We could have a file created using a Foreign class before
@@ -2872,7 +3046,7 @@ Version_t TBufferFile::ReadVersionNoCheckSum(UInt_t *startpos, UInt_t *bcnt)
 
    if (startpos) {
       // before reading object save start position
-      *startpos = UInt_t(fBufCur-fBuffer);
+      *startpos = UInt_t(Length());
    }
 
    // read byte count (older files don't have byte count)
@@ -2883,6 +3057,7 @@ Version_t TBufferFile::ReadVersionNoCheckSum(UInt_t *startpos, UInt_t *bcnt)
       UInt_t     cnt;
       Version_t  vers[2];
    } v;
+   CheckSegment(sizeof(UInt_t));
 #ifdef R__BYTESWAP
    frombuf(this->fBufCur,&v.vers[1]);
    frombuf(this->fBufCur,&v.vers[0]);
@@ -2897,6 +3072,7 @@ Version_t TBufferFile::ReadVersionNoCheckSum(UInt_t *startpos, UInt_t *bcnt)
       v.cnt = 0;
    }
    if (bcnt) *bcnt = (v.cnt & ~kByteCountMask);
+   CheckSegment(sizeof(Version_t));
    frombuf(this->fBufCur,&version);
 
    return version;
@@ -2914,6 +3090,7 @@ Version_t TBufferFile::ReadVersionForMemberWise(const TClass *cl)
    Version_t version;
 
    // not interested in byte count
+   CheckSegment(sizeof(Version_t));
    frombuf(this->fBufCur,&version);
 
    if (version<=1) {
@@ -2921,6 +3098,7 @@ Version_t TBufferFile::ReadVersionForMemberWise(const TClass *cl)
          if (cl) {
             if (cl->GetClassVersion() != 0) {
                UInt_t checksum = 0;
+               CheckSegment(sizeof(UInt_t));
                frombuf(this->fBufCur,&checksum);
                TStreamerInfo *vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
                if (vinfo) {
@@ -2942,6 +3120,7 @@ Version_t TBufferFile::ReadVersionForMemberWise(const TClass *cl)
             }
          } else { // of if (cl) {
             UInt_t checksum = 0;
+            CheckSegment(sizeof(UInt_t));
             frombuf(this->fBufCur,&checksum);
          }
       }  else if (version == 1 && fParent && ((TFile*)fParent)->GetVersion()<40000 && cl && cl->GetClassVersion() != 0) {
@@ -3102,9 +3281,9 @@ UInt_t TBufferFile::CheckObject(UInt_t offset, const TClass *cl, Bool_t readClas
          // No class found at this location in map. It might have been skipped
          // as part of a skipped object. Try to explicitly read the class.
 
-         // save fBufCur and set to place specified by offset (-kMapOffset-sizeof(bytecount))
-         char *bufsav = fBufCur;
-         fBufCur = (char *)(fBuffer + offset-kMapOffset-sizeof(UInt_t));
+         // save the position and set to place specified by offset (-kMapOffset-sizeof(bytecount))
+         Int_t bufsav = Length();
+         SetBufferOffset(offset-kMapOffset-sizeof(UInt_t));
 
          TClass *c = ReadClass(cl);
          if (c == (TClass*) -1) {
@@ -3120,7 +3299,7 @@ UInt_t TBufferFile::CheckObject(UInt_t offset, const TClass *cl, Bool_t readClas
                        " pointers of that type will be 0");
          }
 
-         fBufCur = bufsav;
+         SetBufferOffset(bufsav);
 
       } else if (cli == -1) {
 
@@ -3134,9 +3313,9 @@ UInt_t TBufferFile::CheckObject(UInt_t offset, const TClass *cl, Bool_t readClas
          // No object found at this location in map. It might have been skipped
          // as part of a skipped object. Try to explicitly read the object.
 
-         // save fBufCur and set to place specified by offset (-kMapOffset)
-         char *bufsav = fBufCur;
-         fBufCur = (char *)(fBuffer + offset-kMapOffset);
+         // save the position and set to place specified by offset (-kMapOffset)
+         Int_t bufsav = Length();
+         SetBufferOffset(offset-kMapOffset);
 
          TObject *obj = ReadObject(cl);
          if (!obj) {
@@ -3148,7 +3327,7 @@ UInt_t TBufferFile::CheckObject(UInt_t offset, const TClass *cl, Bool_t readClas
             offset = 0;
          }
 
-         fBufCur = bufsav;
+         SetBufferOffset(bufsav);
 
       } else if (cli == -1) {
 
@@ -3172,7 +3351,8 @@ Int_t TBufferFile::ReadBuf(void *buf, Int_t max)
 
    if (max == 0) return 0;
 
-   Int_t n = TMath::Min(max, (Int_t)(fBufMax - fBufCur));
+   Int_t n = TMath::Min(max, fSegments.empty() ? (Int_t)(fBufMax - fBufCur) : fBufSize - Length());
+   CheckSegment(n);
 
    memcpy(buf, fBufCur, n);
    fBufCur += n;
@@ -93,6 +93,7 @@ class Container {
 #include "TBufferJSON.h"
 
 #include <typeinfo>
+#include <charconv>
 #include <string>
 #include <cstring>
 #include <locale.h>
@@ -3875,14 +3876,27 @@ void TBufferJSON::WriteCharStar(char *s)
    JsonWriteConstChar(s);
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// appends integer value to json value buffer, std::to_chars is much faster than snprintf
+
+template <typename T>
+void JsonAppendInteger(TString &out, T value)
+{
+   char buf[30];
+   auto res = std::to_chars(buf, buf + sizeof(buf), value);
+   out.Append(buf, res.ptr - buf);
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// converts Char_t to string and add to json value buffer
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, (Int_t) value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3890,9 +3904,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3900,9 +3912,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3910,9 +3920,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3920,7 +3928,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3968,9 +3976,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, (Int_t) value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3978,9 +3984,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3988,9 +3992,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3998,9 +4000,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4008,7 +4008,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
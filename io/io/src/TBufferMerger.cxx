@@ -10,14 +10,40 @@
  *************************************************************************/
 
 #include "ROOT/TBufferMerger.hxx"
+#include "ROOT/RMemoryBudget.hxx"
 
 #include "TBufferFile.h"
+#include "TEnv.h"
 #include "TError.h"
 #include "TROOT.h"
+#include "TString.h"
+#include "TSystem.h"
 #include "TVirtualMutex.h"
 
+#include <cstdio>
+#include <cstdlib>
 #include <utility>
 
+namespace {
+
+/// Writes the file image held by buffer into a temporary file. Returns the file name, or an empty string on failure.
+std::string SpillToTempFile(const TBufferFile &buffer)
+{
+   TString name = "tbuffermerger_spill";
+   FILE *f = gSystem->TempFileName(name);
+   if (!f)
+      return "";
+   const size_t size = buffer.Length();
+   const bool ok = (fwrite(buffer.Buffer(), 1, size, f) == size);
+   if (fclose(f) != 0 || !ok) {
+      gSystem->Unlink(name);
+      return "";
+   }
+   return name.Data();
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 
 TBufferMerger::TBufferMerger(const char *name, Option_t *option, Int_t compress)
@@ -39,6 +65,18 @@ void TBufferMerger::Init(std::unique_ptr<TFile> output)
       Error("TBufferMerger", "cannot write to output file");
 
    fMerger.OutputFile(std::move(output));
+
+   if (gEnv) {
+      if (gEnv->Defined("TBufferMerger.MaxBuffered"))
+         fMaxBuffered = std::strtoull(gEnv->GetValue("TBufferMerger.MaxBuffered", "0"), nullptr, 10);
+      TString policy = gEnv->GetValue("TBufferMerger.QueueFullPolicy", "block");
+      policy.ToLower();
+      if (policy == "spill")
+         fQueueFullPolicy = EQueueFullPolicy::kSpill;
+      else if (policy != "block")
+         Warning("TBufferMerger", "unknown TBufferMerger.QueueFullPolicy '%s', using 'block'", policy.Data());
+      SetAsyncMerge(gEnv->GetValue("TBufferMerger.AsyncMerge", 0) != 0);
+   }
 }
 
 TBufferMerger::~TBufferMerger()
@@ -46,6 +84,8 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
+   StopMergeThread();
+
    if (!fQueue.empty())
       Merge();
 
@@ -71,16 +111,56 @@ size_t TBufferMerger::GetQueueSize() const
    return fQueue.size();
 }
 
+bool TBufferMerger::IsQueueFull(size_t size) const
+{
+   // A single buffer is always accepted into an empty queue, else a buffer larger than the limit would never fit
+   if (fBuffered == 0)
+      return false;
+   return (fMaxBuffered > 0 && fBuffered + size > fMaxBuffered) || ROOT::Experimental::RMemoryBudget::IsUnderPressure();
+}
+
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   RQueueItem item{std::unique_ptr<TBufferFile>(buffer), {}};
+   const size_t size = buffer->BufferSize();
+   bool mustMerge = false;
    {
-      std::lock_guard<std::mutex> lock(fQueueMutex);
-      fBuffered += buffer->BufferSize();
-      fQueue.push(buffer);
+      std::unique_lock<std::mutex> lock(fQueueMutex);
+      if (IsQueueFull(size)) {
+         if (fQueueFullPolicy == EQueueFullPolicy::kSpill) {
+            // Don't hold the lock while writing to disk, the data is not in the queue yet anyway
+            lock.unlock();
+            item.fSpillFile = SpillToTempFile(*item.fBuffer);
+            if (!item.fSpillFile.empty())
+               item.fBuffer.reset();
+            else
+               Warning("TBufferMerger", "cannot spill buffer to disk, keeping it in memory");
+            lock.lock();
+         } else if (fMergeThread.joinable()) {
+            ++fNWaiting;
+            fQueueCondition.notify_all();
+            fQueueCondition.wait(lock, [this, size]() { return !IsQueueFull(size); });
+            --fNWaiting;
+         } else {
+            // Without a merge thread, the writer applies backpressure on itself by merging the queue
+            mustMerge = true;
+         }
+      }
+      if (item.fBuffer) {
+         fBuffered += size;
+         ROOT::Experimental::RMemoryBudget::Add(ROOT::Experimental::RMemoryBudget::kBufferMerger, size);
+      }
+      fQueue.push(std::move(item));
    }
 
-   if (fBuffered > fAutoSave)
+   if (fMergeThread.joinable()) {
+      fQueueCondition.notify_all();
+   } else if (mustMerge) {
+      std::lock_guard<std::mutex> lock(fMergeMutex);
+      MergeImpl();
+   } else if (fBuffered > fAutoSave) {
       Merge();
+   }
 }
 
 size_t TBufferMerger::GetAutoSave() const
@@ -104,6 +184,74 @@ void TBufferMerger::SetMergeOptions(const TString& options)
    fMerger.SetMergeOptions(options);
 }
 
+void TBufferMerger::SetMaxBuffered(size_t size)
+{
+   {
+      std::lock_guard<std::mutex> lock(fQueueMutex);
+      fMaxBuffered = size;
+   }
+   fQueueCondition.notify_all();
+}
+
+size_t TBufferMerger::GetMaxBuffered() const
+{
+   return fMaxBuffered;
+}
+
+void TBufferMerger::SetQueueFullPolicy(EQueueFullPolicy policy)
+{
+   std::lock_guard<std::mutex> lock(fQueueMutex);
+   fQueueFullPolicy = policy;
+}
+
+TBufferMerger::EQueueFullPolicy TBufferMerger::GetQueueFullPolicy() const
+{
+   return fQueueFullPolicy;
+}
+
+void TBufferMerger::SetAsyncMerge(bool enable)
+{
+   if (enable == fMergeThread.joinable())
+      return;
+
+   if (enable) {
+      fStopMergeThread = false;
+      fMergeThread = std::thread([this]() { MergeLoop(); });
+   } else {
+      StopMergeThread();
+   }
+}
+
+void TBufferMerger::StopMergeThread()
+{
+   if (!fMergeThread.joinable())
+      return;
+   {
+      std::lock_guard<std::mutex> lock(fQueueMutex);
+      fStopMergeThread = true;
+   }
+   fQueueCondition.notify_all();
+   fMergeThread.join();
+}
+
+void TBufferMerger::MergeLoop()
+{
+   std::unique_lock<std::mutex> lock(fQueueMutex);
+   while (true) {
+      fQueueCondition.wait(lock, [this]() {
+         return fStopMergeThread || (!fQueue.empty() && (fNWaiting > 0 || fBuffered >= fAutoSave));
+      });
+      if (fQueue.empty())
+         return; // only reached once asked to stop
+      lock.unlock();
+      {
+         std::lock_guard<std::mutex> mergeLock(fMergeMutex);
+         MergeImpl();
+      }
+      lock.lock();
+   }
+}
+
 void TBufferMerger::Merge()
 {
    if (fMergeMutex.try_lock()) {
@@ -114,26 +262,45 @@ void TBufferMerger::Merge()
 
 void TBufferMerger::MergeImpl()
 {
-   std::queue<TBufferFile *> queue;
+   std::queue<RQueueItem> queue;
    {
       std::lock_guard<std::mutex> q(fQueueMutex);
       std::swap(queue, fQueue);
+      ROOT::Experimental::RMemoryBudget::Release(ROOT::Experimental::RMemoryBudget::kBufferMerger, fBuffered);
       fBuffered = 0;
    }
+   // Writers waiting for the queue to drain can continue while we merge
+   fQueueCondition.notify_all();
 
+   std::vector<std::string> spillFiles;
    while (!queue.empty()) {
-      std::unique_ptr<TBufferFile> buffer{queue.front()};
-      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
+      auto &item = queue.front();
+      if (item.fBuffer) {
+         fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(item.fBuffer)));
+      } else {
+         spillFiles.emplace_back(item.fSpillFile);
+         if (TFile *spilled = TFile::Open(item.fSpillFile.c_str(), "READ"))
+            fMerger.AddAdoptFile(spilled);
+         else
+            Error("TBufferMerger", "cannot read back spilled buffer %s", item.fSpillFile.c_str());
+      }
       queue.pop();
    }
 
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
+
+   for (const auto &name : spillFiles)
+      gSystem->Unlink(name.c_str());
 }
 
 bool TBufferMerger::TryMerge(ROOT::TBufferMergerFile *memfile)
 {
+   // With a dedicated merge thread, writers never merge themselves
+   if (fMergeThread.joinable())
+      return false;
+
    if (fMergeMutex.try_lock()) {
       memfile->WriteStreamerInfo();
       fMerger.AddFile(memfile);
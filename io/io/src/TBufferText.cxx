@@ -32,10 +32,85 @@ actions list for both are the same.
 #include "TError.h"
 #include "snprintf.h"
 
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#define R__HAS_FLOAT_TO_CHARS
+#endif
+
 ClassImp(TBufferText);
 
 const char *TBufferText::fgFloatFmt = "%e";
 const char *TBufferText::fgDoubleFmt = "%.14e";
+Int_t TBufferText::fgFloatPrec = 6;
+Int_t TBufferText::fgDoublePrec = 14;
+
+namespace {
+
+const Int_t kOtherFormat = -1;    ///< any printf format, formatted with snprintf
+const Int_t kShortestFormat = -2; ///< "shortest" format, shortest representation which reads back to the same value
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns precision of the "%e" or "%.Ne" formats, which are reproduced with std::to_chars
+/// without much slower snprintf
+
+Int_t FormatPrecision(const char *fmt)
+{
+   if (!strcmp(fmt, "shortest"))
+      return kShortestFormat;
+   if (!strcmp(fmt, "%e"))
+      return 6;
+   if ((fmt[0] != '%') || (fmt[1] != '.'))
+      return kOtherFormat;
+   Int_t prec = 0;
+   const char *s = fmt + 2;
+   for (; (*s >= '0') && (*s <= '9') && (s - fmt < 5); ++s)
+      prec = prec * 10 + (*s - '0');
+   return ((s > fmt + 2) && (s[0] == 'e') && (s[1] == 0)) ? prec : kOtherFormat;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Formats float or double value with configured format and precision
+/// Output is exactly the same as produced by snprintf
+
+template <typename T>
+void FormatValue(T value, char *buf, unsigned len, const char *fmt, Int_t prec)
+{
+#ifdef R__HAS_FLOAT_TO_CHARS
+   if (prec != kOtherFormat) {
+      auto res = (prec == kShortestFormat)
+                    ? std::to_chars(buf, buf + len - 1, value)
+                    : std::to_chars(buf, buf + len - 1, value, std::chars_format::scientific, prec);
+      if (res.ec == std::errc()) {
+         *res.ptr = 0;
+         return;
+      }
+   }
+#endif
+   if (prec == kShortestFormat)
+      snprintf(buf, len, std::is_same<T, Float_t>::value ? "%.9g" : "%.17g", value);
+   else
+      snprintf(buf, len, fmt, value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Formats value without fractional part, same as snprintf with "%1.0f"
+
+void FormatIntegral(Double_t value, char *buf, unsigned len)
+{
+#ifdef R__HAS_FLOAT_TO_CHARS
+   auto res = std::to_chars(buf, buf + len - 1, value, std::chars_format::fixed, 0);
+   if (res.ec == std::errc()) {
+      *res.ptr = 0;
+      return;
+   }
+#endif
+   snprintf(buf, len, "%1.0f", value);
+}
+
+} // namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor
@@ -794,6 +869,8 @@ void TBufferText::CompactFloatString(char *sbuf, unsigned len)
 ////////////////////////////////////////////////////////////////////////////////
 /// set printf format for float/double members, default "%e"
 /// to change format only for doubles, use SetDoubleFormat
+/// Special "shortest" format produces shortest representation, which reads back exactly to the same value
+/// Default "%e" and "%.Ne" formats as well as "shortest" are converted without snprintf, which is much faster
 
 void TBufferText::SetFloatFormat(const char *fmt)
 {
@@ -801,6 +878,7 @@ void TBufferText::SetFloatFormat(const char *fmt)
       fmt = "%e";
    fgFloatFmt = fmt;
    fgDoubleFmt = fmt;
+   fgFloatPrec = fgDoublePrec = FormatPrecision(fmt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -820,6 +898,7 @@ void TBufferText::SetDoubleFormat(const char *fmt)
    if (!fmt)
       fmt = "%.14e";
    fgDoubleFmt = fmt;
+   fgDoublePrec = FormatPrecision(fmt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -836,12 +915,13 @@ const char *TBufferText::GetDoubleFormat()
 const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bool_t not_optimize)
 {
    if (not_optimize) {
-      snprintf(buf, len, fgFloatFmt, value);
+      FormatValue(value, buf, len, fgFloatFmt, fgFloatPrec);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e15)) {
-      snprintf(buf, len, "%1.0f", value);
+      FormatIntegral(value, buf, len);
    } else {
-      snprintf(buf, len, fgFloatFmt, value);
-      CompactFloatString(buf, len);
+      FormatValue(value, buf, len, fgFloatFmt, fgFloatPrec);
+      if (fgFloatPrec != kShortestFormat)
+         CompactFloatString(buf, len);
    }
    return buf;
 }
@@ -852,12 +932,13 @@ const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bo
 const char *TBufferText::ConvertDouble(Double_t value, char *buf, unsigned len, Bool_t not_optimize)
 {
    if (not_optimize) {
-      snprintf(buf, len, fgFloatFmt, value);
+      FormatValue(value, buf, len, fgFloatFmt, fgFloatPrec);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e25)) {
-      snprintf(buf, len, "%1.0f", value);
+      FormatIntegral(value, buf, len);
    } else {
-      snprintf(buf, len, fgDoubleFmt, value);
-      CompactFloatString(buf, len);
+      FormatValue(value, buf, len, fgDoubleFmt, fgDoublePrec);
+      if (fgDoublePrec != kShortestFormat)
+         CompactFloatString(buf, len);
    }
    return buf;
 }
@@ -319,8 +319,8 @@ void TDirectoryFile::BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir
    fSeekDir    = 0;
    fSeekParent = 0;
    fSeekKeys   = 0;
-   fList       = new THashList(100,50);
-   fKeys       = new THashList(100,50);
+   fList       = new THashList(100,3);
+   fKeys       = new THashList(100,3);
    fList->UseRWLock();
    fMother     = motherDir;
    fFile       = motherFile ? motherFile : TFile::CurrentFile();
@@ -623,6 +623,7 @@ void TDirectoryFile::Delete(const char *namecycle)
                GetName(), (namecycle ? namecycle : "null"));
 
    TDirectory::TContext ctxt(this);
+   if (fFile) fFile->WaitForAsyncWrites();
    Short_t  cycle;
    char     name[kMaxLen];
    const char *nmcy = (namecycle) ? namecycle : "";
@@ -1258,6 +1259,7 @@ TDirectory *TDirectoryFile::mkdir(const char *name, const char *title, Bool_t re
    }
 
    TDirectory::TContext ctxt(this);
+   if (fFile) fFile->WaitForAsyncWrites();
 
    newdir = new TDirectoryFile(name, title, "", this);
 
@@ -1277,6 +1279,7 @@ void TDirectoryFile::Purge(Short_t)
    if (!IsWritable()) return;
 
    TDirectory::TContext ctxt(this);
+   if (fFile) fFile->WaitForAsyncWrites();
 
    TKey  *key;
    TIter  prev(GetListOfKeys(), kIterBackward);
@@ -1414,18 +1417,22 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+      // Size the hash table for all the keys at once: for directories with many keys, growing it while they are
+      // added rehashes the keys read so far many times.
+      if (nkeys > 0)
+         static_cast<THashList *>(fKeys)->Rehash(fKeys->GetSize() + nkeys);
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
          if (key->GetSeekKey() < 64 || key->GetSeekKey() > fsize) {
             Error("ReadKeys","reading illegal key, exiting after %d keys",i);
-            fKeys->Remove(key);
+            delete key;
             nkeys = i;
             break;
          }
          if (key->GetSeekPdir() < 64 || key->GetSeekPdir() > fsize) {
             Error("ReadKeys","reading illegal key, exiting after %d keys",i);
-            fKeys->Remove(key);
+            delete key;
             nkeys = i;
             break;
          }
@@ -1611,6 +1618,7 @@ Int_t TDirectoryFile::SaveObjectAs(const TObject *obj, const char *filename, Opt
 void TDirectoryFile::SaveSelf(Bool_t force)
 {
    if (IsWritable() && (fModified || force) && fFile) {
+      fFile->WaitForAsyncWrites();
       Bool_t dowrite = kTRUE;
       if (fFile->GetListOfFree())
         dowrite = fFile->GetListOfFree()->First() != nullptr;
@@ -1821,6 +1829,7 @@ Int_t TDirectoryFile::Write(const char *, Int_t opt, Int_t bufsize)
 {
    if (!IsWritable()) return 0;
    TDirectory::TContext ctxt(this);
+   if (fFile) fFile->WaitForAsyncWrites();
 
    // Loop on all objects (including subdirs)
    TIter next(fList);
@@ -1910,6 +1919,8 @@ Int_t TDirectoryFile::WriteTObject(const TObject *obj, const char *name, Option_
 
    if (!obj) return 0;
 
+   fFile->WaitForAsyncWrites();
+
    TString opt = option;
    opt.ToLower();
 
@@ -1972,6 +1983,70 @@ Int_t TDirectoryFile::WriteTObject(const TObject *obj, const char *name, Option_
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write object obj to this directory in the background.
+///
+/// Like WriteTObject, but only the serialization of the object is done before
+/// returning: the object can be modified or deleted right after the call.  The
+/// compression, the reservation of the space in the file and the write are done
+/// by a thread owned by the file, in the order of the calls.  The returned future
+/// holds the value that WriteTObject would have returned.
+///
+/// The key is added to the list of keys of the directory immediately.  The
+/// options "Overwrite" and "WriteDelete" remove the previous key with the same
+/// name from this list immediately; its space in the file is released before,
+/// respectively after, the new object is written.
+///
+/// All the operations that modify the structure of the file (e.g. WriteTObject,
+/// Write, SaveSelf, mkdir, TFile::Flush, TFile::Close) first wait for the pending
+/// writes.  Before reading back an object written with this function, call
+/// TFile::WaitForAsyncWrites or wait for the future.  This function must be called
+/// from the thread using the file.
+///
+/// Without support for implicit multi-threading, and for files that are not
+/// binary ROOT files (e.g. XML), the object is written before returning.
+
+std::future<Int_t> TDirectoryFile::WriteObjectAsync(const TObject *obj, const char *name, Option_t *option,
+                                                    Int_t bufsize)
+{
+   if (!fFile || !fFile->IsWritable() || !obj || !fFile->IsBinary()) {
+      // Let WriteTObject report the errors, or write to the files that are not binary
+      std::promise<Int_t> result;
+      result.set_value(WriteTObject(obj, name, option, bufsize));
+      return result.get_future();
+   }
+
+   TDirectory::TContext ctxt(this);
+
+   TString opt = option;
+   opt.ToLower();
+
+   Int_t bsize = GetBufferSize();
+   if (bufsize > 0) bsize = bufsize;
+
+   TString oname = (name && *name) ? name : obj->GetName();
+   // Remove trailing blanks in object name
+   oname.Remove(TString::kTrailing, ' ');
+
+   // The previous key leaves the directory now, and the file once the writer gets to it
+   const Bool_t overwrite = opt.Contains("overwrite");
+   TKey *oldkey = nullptr;
+   if (overwrite || opt.Contains("writedelete")) {
+      oldkey = GetKey(oname);
+      if (oldkey && oldkey->TestBit(TKey::kIsDirectoryFile))
+         oldkey = nullptr; // see TKey::Delete
+      if (oldkey)
+         fKeys->Remove(oldkey);
+   }
+
+   // The position of the key determines the size of its header, use the end of
+   // the file after the keys that are not yet written
+   TKey *key = new TKey(obj, oname, bsize, this, fFile->GetAsyncWriteEND());
+   if (bufsize) fFile->SetBufferSize(bufsize);
+
+   return fFile->WriteKeyAsync(key, oldkey, overwrite);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write object from pointer of class classname in this directory.
 ///
@@ -2049,6 +2124,8 @@ Int_t TDirectoryFile::WriteObjectAny(const void *obj, const TClass *cl, const ch
 
    if (!obj) return 0;
 
+   fFile->WaitForAsyncWrites();
+
    const char *className = cl->GetName();
    const char *oname;
    if (name && *name)
@@ -2124,6 +2201,7 @@ void TDirectoryFile::WriteDirHeader()
 {
    TFile* f = GetFile();
    if (!f) return;
+   f->WaitForAsyncWrites();
 
    if (!f->IsBinary()) {
       fDatimeM.Set();
@@ -2153,6 +2231,7 @@ void TDirectoryFile::WriteKeys()
 {
    TFile* f = GetFile();
    if (!f) return;
+   f->WaitForAsyncWrites();
 
    if (!f->IsBinary()) {
       f->DirWriteKeys(this);
@@ -44,7 +44,8 @@ TEmulatedCollectionProxy::TEmulatedCollectionProxy(const TEmulatedCollectionProx
    : TGenCollectionProxy(copy)
 {
    // Build a Streamer for an emulated vector whose type is 'name'.
-   fProperties |= kIsEmulated;
+   // the emulated collections store their elements in a vector
+   fProperties |= kIsEmulated | kIsContiguous;
 }
 
 TEmulatedCollectionProxy::TEmulatedCollectionProxy(const char* cl_name, Bool_t silent)
@@ -56,7 +57,8 @@ TEmulatedCollectionProxy::TEmulatedCollectionProxy(const char* cl_name, Bool_t s
    if ( this->TEmulatedCollectionProxy::InitializeEx(silent) ) {
       fCreateEnv = TGenCollectionProxy::Env_t::Create;
    }
-   fProperties |= kIsEmulated;
+   // the emulated collections store their elements in a vector
+   fProperties |= kIsEmulated | kIsContiguous;
 }
 
 TEmulatedCollectionProxy::~TEmulatedCollectionProxy()
@@ -119,6 +119,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TVirtualMonitoring.h"
 #include "TVirtualMutex.h"
 #include "TMap.h"
+#include "RZip.h"
 #include "TMathBase.h"
 #include "TObjString.h"
 #include "TStopwatch.h"
@@ -131,7 +132,19 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "ROOT/RBlockCache.hxx"
+#include "ROOT/RFreeSegmentIndex.hxx"
+#include "ROOT/RIOMetrics.hxx"
+#include <condition_variable>
 #include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include <algorithm>
+#include <deque>
+#endif
 
 using std::sqrt;
 
@@ -171,6 +184,194 @@ AddPseudoGlobals() {
 }
 } gAddPseudoGlobals;
 }
+
+namespace ROOT {
+namespace Internal {
+
+/// The standard open of a file run by a background thread, for TFile::AsyncOpen with the backends that do not
+/// support asynchronous open natively.  The state is shared with the thread, such that deleting the handle does not
+/// need to wait for the open to complete: a file that was not taken is then closed by the thread.
+struct TFileOpenTask {
+   struct RState {
+      std::mutex fMutex;
+      std::condition_variable fCv;
+      TFile *fFile = nullptr;
+      bool fDone = false;
+      ~RState() { delete fFile; }
+   };
+   std::shared_ptr<RState> fState = std::make_shared<RState>();
+
+   bool IsDone()
+   {
+      std::lock_guard<std::mutex> lock(fState->fMutex);
+      return fState->fDone;
+   }
+
+   /// Wait for the open to complete and release the ownership of the file
+   TFile *Take()
+   {
+      std::unique_lock<std::mutex> lock(fState->fMutex);
+      fState->fCv.wait(lock, [this] { return fState->fDone; });
+      TFile *file = fState->fFile;
+      fState->fFile = nullptr;
+      return file;
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+namespace {
+/// Serializes the accesses to TFile::fgAsyncOpenRequests
+std::mutex gAsyncOpenRequestsMutex;
+/// Set while a background thread runs the standard open of TFile::AsyncOpen, which must not take its own request
+thread_local bool gInAsyncOpenTask = false;
+} // namespace
+
+#ifdef R__USE_IMT
+namespace ROOT {
+namespace Internal {
+
+/// Background writer of the keys of TDirectoryFile::WriteObjectAsync.  The objects
+/// are streamed by the caller; the keys are compressed, allocated in the file and
+/// written by one thread per file, in the order in which they were submitted.
+/// The allocation and the write are done under TFile::fWriteMutex, like for
+/// the TBasket-s written in parallel.  The lists of keys of the directories are
+/// only modified by the thread owning the file, in Wait.
+class RAsyncKeyWriter {
+   struct RItem {
+      TKey *fKey;                   ///< Key holding the streamed object
+      TKey *fOldKey;                ///< Key to be deleted from the file, if any
+      Bool_t fFreeOldKeyFirst;      ///< Release the space of fOldKey before allocating fKey ("overwrite")
+      std::promise<Int_t> fResult;  ///< Number of bytes written, 0 in case of failure
+   };
+
+   TFile &fFile;
+   std::mutex fMutex;                ///< Protects all the data members below
+   std::condition_variable fWorkCV;  ///< Signals new items or the end of the writer
+   std::condition_variable fDoneCV;  ///< Signals the completion of an item
+   std::deque<RItem> fQueue;         ///< Items not yet picked up by fThread
+   std::size_t fPending = 0;         ///< Items queued or being written
+   Long64_t fPendingBytes = 0;       ///< Upper bound of the size on file of the pending items
+   std::vector<TKey *> fFailed;      ///< Keys that could not be written, removed from their directory in Wait
+   Bool_t fStop = kFALSE;
+   std::thread fThread;
+
+   Int_t WriteItem(RItem &item)
+   {
+      TKey *key = item.fKey;
+      Int_t nbytes = key->CompressObject();
+
+      std::lock_guard<std::mutex> sentry(fFile.fWriteMutex);
+      if (item.fOldKey && item.fFreeOldKeyFirst)
+         FreeKey(item.fOldKey);
+      key->CreateObjectKey(nbytes);
+      nbytes = 0;
+      if (!key->GetSeekKey()) {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fFailed.push_back(key);
+      } else {
+         fFile.SumBuffer(key->GetObjlen());
+         nbytes = key->WriteFile(0);
+         if (fFile.TestBit(TFile::kWriteError))
+            nbytes = 0;
+      }
+      if (item.fOldKey && !item.fFreeOldKeyFirst)
+         FreeKey(item.fOldKey);
+      return nbytes;
+   }
+
+   /// Release the space of a key already removed from its directory, and delete it
+   void FreeKey(TKey *key)
+   {
+      Bool_t written = kTRUE;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         auto failed = std::find(fFailed.begin(), fFailed.end(), key);
+         if (failed != fFailed.end()) {
+            fFailed.erase(failed);
+            written = kFALSE;
+         }
+      }
+      if (written)
+         fFile.MakeFree(key->GetSeekKey(), key->GetSeekKey() + key->GetNbytes() - 1);
+      // The key is no longer in the list of keys of its directory, do not touch the list from this thread
+      key->SetMotherDir(nullptr);
+      delete key;
+   }
+
+   /// The compressed object is never larger than the uncompressed one, see TKey::CompressObject
+   static Long64_t MaxSize(const TKey *key) { return key->GetKeylen() + key->GetObjlen() + 28; }
+
+   void Work()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (true) {
+         fWorkCV.wait(lock, [this] { return fStop || !fQueue.empty(); });
+         if (fQueue.empty())
+            return;
+         RItem item = std::move(fQueue.front());
+         fQueue.pop_front();
+         const Long64_t size = MaxSize(item.fKey);
+         lock.unlock();
+         item.fResult.set_value(WriteItem(item));
+         lock.lock();
+         --fPending;
+         fPendingBytes -= size;
+         fDoneCV.notify_all();
+      }
+   }
+
+public:
+   RAsyncKeyWriter(TFile &file) : fFile(file), fThread([this] { Work(); }) {}
+
+   ~RAsyncKeyWriter()
+   {
+      Wait();
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fStop = kTRUE;
+      }
+      fWorkCV.notify_one();
+      fThread.join();
+   }
+
+   std::future<Int_t> Push(TKey *key, TKey *oldKey, Bool_t freeOldKeyFirst)
+   {
+      std::promise<Int_t> result;
+      auto future = result.get_future();
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fQueue.push_back(RItem{key, oldKey, freeOldKeyFirst, std::move(result)});
+         ++fPending;
+         fPendingBytes += MaxSize(key);
+      }
+      fWorkCV.notify_one();
+      return future;
+   }
+
+   Long64_t GetPendingBytes()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fPendingBytes;
+   }
+
+   /// Wait until all the keys are written, then drop the keys that could not be written
+   void Wait()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fDoneCV.wait(lock, [this] { return fPending == 0; });
+      for (auto key : fFailed) {
+         key->GetMotherDir()->GetListOfKeys()->Remove(key);
+         delete key;
+      }
+      fFailed.clear();
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+#endif
 ////////////////////////////////////////////////////////////////////////////////
 /// File default Constructor.
 
@@ -559,10 +760,15 @@ TFile::~TFile()
    SafeDelete(fCacheReadMap);
    SafeDelete(fCacheWrite);
    SafeDelete(fProcessIDs);
+   ResetFreeIndex();
    SafeDelete(fFree);
    SafeDelete(fArchive);
+   SafeDelete(fCompressionDicts);
    SafeDelete(fInfoCache);
    SafeDelete(fOpenPhases);
+#ifdef R__USE_IMT
+   delete fAsyncKeyWriter;
+#endif
 
    if (fGlobalRegistration) {
       R__LOCKGUARD(gROOTMutex);
@@ -639,6 +845,7 @@ void TFile::Init(Bool_t create)
 
    if (create) {
       //*-*---------------NEW file
+      SetCompressionDictionary(gEnv->GetValue("TFile.CompressionDictionary", 0));
       fFree        = new TList;
       fEND         = fBEGIN;    //Pointer to end of file
       new TFree(fFree, fBEGIN, Long64_t(kStartBigFile));  //Create new free list
@@ -769,6 +976,12 @@ void TFile::Init(Bool_t create)
          frombuf(buffer, &skeys);   fSeekKeys   = (Long64_t)skeys;
       }
       if (versiondir > 1) fUUID.ReadBuffer(buffer);
+      // The blocks of remote files opened for reading can be cached on the local disk, keyed by the file UUID
+      if (versiondir > 1 && !fWritable && fArchiveOffset == 0) {
+         fBlockCache = ROOT::Internal::RBlockCache::Get();
+         if (fBlockCache)
+            fBlockCacheFileId = fUUID.AsString();
+      }
 
       //*-*---------read TKey::FillBuffer info
       buffer_keyloc += sizeof(Int_t); // Skip NBytes;
@@ -922,6 +1135,12 @@ void TFile::Close(Option_t *option)
 
    if (!IsOpen()) return;
 
+#ifdef R__USE_IMT
+   // Write the pending keys of WriteObjectAsync before the directories and the keys lists
+   delete fAsyncKeyWriter;
+   fAsyncKeyWriter = nullptr;
+#endif
+
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
       SysClose(fD);
@@ -974,6 +1193,7 @@ void TFile::Close(Option_t *option)
    fClassIndex = nullptr;
 
    // Delete free segments from free list (but don't delete list header)
+   ResetFreeIndex();
    if (fFree) {
       fFree->Delete();
    }
@@ -1107,6 +1327,7 @@ void TFile::DrawMap(const char *keys, Option_t *option)
 
 void TFile::Flush()
 {
+   WaitForAsyncWrites();
    if (IsOpen() && fWritable) {
       FlushWriteCache();
       if (SysSync(fD) < 0) {
@@ -1450,9 +1671,8 @@ Bool_t TFile::IsOpen() const
 
 void TFile::MakeFree(Long64_t first, Long64_t last)
 {
-   TFree *f1      = (TFree*)fFree->First();
-   if (!f1) return;
-   TFree *newfree = f1->AddFree(fFree,first,last);
+   if (!fFree->First()) return;
+   TFree *newfree = GetFreeIndex().AddFree(first,last);
    if(!newfree) return;
    Long64_t nfirst = newfree->GetFirst();
    Long64_t nlast  = newfree->GetLast();
@@ -1475,6 +1695,27 @@ void TFile::MakeFree(Long64_t first, Long64_t last)
    delete [] psave;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the free segments, which finds the best segment for a
+/// new record and the neighbours of a freed one without scanning fFree.
+/// The free segments must be allocated and released through it.
+
+ROOT::Internal::RFreeSegmentIndex &TFile::GetFreeIndex()
+{
+   if (!fFreeIndex)
+      fFreeIndex = new ROOT::Internal::RFreeSegmentIndex(*fFree);
+   return *fFreeIndex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Drop the index of the free segments, before fFree is emptied or deleted.
+
+void TFile::ResetFreeIndex()
+{
+   delete fFreeIndex;
+   fFreeIndex = nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// List the contents of a file sequentially.
 /// For each logical record found, it prints:
@@ -1719,6 +1960,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
       fgBytesRead += siz;
       fReadCalls++;
       fgReadCalls++;
+      ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, siz);
+      ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
 
       if (gMonitoringWriter)
          gMonitoringWriter->SendFileReadProgress(this);
@@ -1766,6 +2009,8 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
       fgBytesRead += siz;
       fReadCalls++;
       fgReadCalls++;
+      ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, siz);
+      ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
 
       if (gMonitoringWriter)
          gMonitoringWriter->SendFileReadProgress(this);
@@ -1796,6 +2041,7 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       }
       return kFALSE;
    }
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kVectorReads, 1);
 
    Int_t k = 0;
    Bool_t result = kTRUE;
@@ -1847,6 +2093,65 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read buffers via the local disk cache of the blocks of the file, see
+/// ROOT::Internal::RBlockCache. The buffers are specified as in ReadBuffers().
+///
+/// Implementations of remote files call this before reading from the network;
+/// the missing blocks are read with ReadBuffers(), which then bypasses the
+/// block cache.
+///
+/// Returns 0 if the block cache is not used for this file, 1 in case read via
+/// the block cache was successful, 2 in case read via the block cache failed.
+
+Int_t TFile::ReadBuffersViaBlockCache(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
+{
+   if (!fBlockCache || fBlockCacheFetch || nbuf <= 0)
+      return 0;
+
+   std::vector<ROOT::Internal::RRawFile::RIOVec> ioVec(nbuf);
+   char *cursor = buf;
+   for (Int_t i = 0; i < nbuf; ++i) {
+      ioVec[i].fBuffer = cursor;
+      ioVec[i].fOffset = pos[i];
+      ioVec[i].fSize = len[i];
+      cursor += len[i];
+   }
+
+   auto fetch = [this](ROOT::Internal::RRawFile::RIOVec *requests, unsigned int nRequests) {
+      std::vector<Long64_t> fetchPos(nRequests);
+      std::vector<Int_t> fetchLen(nRequests);
+      for (unsigned int i = 0; i < nRequests; ++i) {
+         fetchPos[i] = requests[i].fOffset;
+         fetchLen[i] = requests[i].fSize;
+      }
+      // The block cache provides the requests one after the other in a single buffer
+      fBlockCacheFetch = kTRUE;
+      Bool_t failed = ReadBuffers(static_cast<char *>(requests[0].fBuffer), fetchPos.data(), fetchLen.data(),
+                                  nRequests);
+      fBlockCacheFetch = kFALSE;
+      if (failed)
+         throw std::runtime_error("cannot read the blocks missing in the block cache");
+      for (unsigned int i = 0; i < nRequests; ++i)
+         requests[i].fOutBytes = requests[i].fSize;
+   };
+
+   try {
+      fBlockCache->ReadV(fBlockCacheFileId, fEND, ioVec.data(), nbuf, fetch);
+   } catch (const std::exception &e) {
+      Error("ReadBuffersViaBlockCache", "%s: %s", GetName(), e.what());
+      return 2;
+   }
+   for (Int_t i = 0; i < nbuf; ++i) {
+      if (ioVec[i].fOutBytes != static_cast<std::size_t>(len[i])) {
+         Error("ReadBuffersViaBlockCache", "%s: cannot read %d bytes at %lld beyond the end of the file", GetName(),
+               len[i], pos[i]);
+         return 2;
+      }
+   }
+   return 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read buffer via cache.
 ///
@@ -1855,16 +2160,21 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 
 Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
 {
+   using ROOT::Experimental::RIOMetrics;
    Long64_t off = GetRelOffset();
+   if (buf)
+      RIOMetrics::Add(RIOMetrics::kBytesRequested, len);
    if (fCacheRead) {
       Int_t st = fCacheRead->ReadBuffer(buf, off, len);
       if (st < 0)
          return 2;  // failure reading
       else if (st == 1) {
+         RIOMetrics::Add(RIOMetrics::kCacheHits, 1);
          // fOffset might have been changed via TFileCacheRead::ReadBuffer(), reset it
          SetOffset(off + len);
          return 1;
       }
+      RIOMetrics::Add(RIOMetrics::kCacheMisses, 1);
       // fOffset might have been changed via TFileCacheRead::ReadBuffer(), reset it
       Seek(off);
    } else {
@@ -2106,7 +2416,7 @@ Int_t TFile::Recover()
       if (max_file_size < fEND) max_file_size = fEND+1000000000;
       TFree *last = (TFree*)fFree->Last();
       if (last) {
-         last->AddFree(fFree,fEND,max_file_size);
+         GetFreeIndex().AddFree(fEND,max_file_size);
       } else {
          new TFree(fFree,fEND,max_file_size);
       }
@@ -2160,6 +2470,7 @@ Int_t TFile::ReOpen(Option_t *mode)
          FlushWriteCache();
 
          // delete free segments from free list
+         ResetFreeIndex();
          fFree->Delete();
          SafeDelete(fFree);
 
@@ -2307,6 +2618,85 @@ void TFile::SetCompressionSettings(Int_t settings)
    fCompress = settings;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the small buffers written to this file with a ZSTD dictionary.
+///
+/// Objects and baskets of a few kilobytes compress badly on their own since every
+/// buffer starts from an empty compression history.  With a dictionary trained on
+/// the content of the file, e.g. per-lumi-section histograms or the baskets of
+/// low-rate branches compress (and decompress) much better.
+///
+/// The buffers of up to maxBufferSize bytes are collected until enough samples
+/// are known to train the dictionary; the buffers written afterwards are
+/// compressed with it, provided the compression algorithm is ZSTD
+/// (ROOT::RCompressionSetting::EAlgorithm::kZSTD).  The dictionary is stored in
+/// the StreamerInfo record and registered when the file is opened again, such
+/// that the buffers are decompressed transparently.  Note that files using a
+/// dictionary cannot be read by older versions of ROOT nor with
+/// TFile::SetReadStreamerInfo(kFALSE).
+///
+/// A maxBufferSize of 0 disables the dictionary, which is the default unless set
+/// by the resource TFile.CompressionDictionary.
+
+void TFile::SetCompressionDictionary(Int_t maxBufferSize)
+{
+   std::lock_guard<std::mutex> lock(fDictMutex);
+   fDictMaxBufferSize = maxBufferSize > 0 ? maxBufferSize : 0;
+}
+
+namespace {
+
+/// Size of the dictionaries trained by TFile::GetCompressionDictionary
+constexpr Int_t kDictCapacity = 32 * 1024;
+/// The dictionary is trained once this many samples or bytes of samples are collected
+constexpr std::size_t kDictNSamples = 2000;
+constexpr Int_t kDictSampleBytes = 2 * 1024 * 1024;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ID of the ZSTD dictionary with which the buffer of size bytes is to
+/// be compressed with the given algorithm, 0 if it is to be compressed without
+/// dictionary.  Used by TKey and TBasket, see SetCompressionDictionary.
+///
+/// Until the dictionary is trained, the buffer is kept as training sample.
+
+UInt_t TFile::GetCompressionDictionary(const char *buffer, Int_t size, Int_t algorithm)
+{
+   if (!fDictMaxBufferSize || size > fDictMaxBufferSize || algorithm != ROOT::RCompressionSetting::EAlgorithm::kZSTD)
+      return 0;
+
+   std::lock_guard<std::mutex> lock(fDictMutex);
+   if (fDictID || !fDictMaxBufferSize)
+      return fDictID;
+
+   fDictSamples.Append(buffer, size);
+   fDictSampleSizes.push_back(size);
+   if (fDictSampleSizes.size() < kDictNSamples && fDictSamples.Length() < kDictSampleBytes)
+      return 0;
+
+   std::vector<char> dict(kDictCapacity);
+   Int_t dictSize = R__TrainCompressionDictionary(dict.data(), kDictCapacity, fDictSamples.Data(),
+                                                  fDictSampleSizes.data(), fDictSampleSizes.size());
+   UInt_t id = dictSize > 0 ? R__AddCompressionDictionary(dict.data(), dictSize) : 0;
+   fDictSamples.Clear();
+   fDictSampleSizes.clear();
+   fDictSampleSizes.shrink_to_fit();
+   if (!id) {
+      Warning("GetCompressionDictionary", "cannot train a compression dictionary for %s, not using one", GetName());
+      fDictMaxBufferSize = 0;
+      return 0;
+   }
+   if (!fCompressionDicts) {
+      fCompressionDicts = new TList;
+      fCompressionDicts->SetOwner(kTRUE);
+   }
+   fCompressionDicts->Add(new TObjString(TString(dict.data(), dictSize)));
+   fDictID = id;
+   fDictWritten = kFALSE;
+   return 0; // Like the other samples, this buffer is compressed without the dictionary
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a pointer to the read cache.
 ///
@@ -2402,6 +2792,7 @@ void TFile::SumBuffer(Int_t bufsize)
 
 Int_t TFile::Write(const char *, Int_t opt, Int_t bufsiz)
 {
+   WaitForAsyncWrites();
    if (!IsWritable()) {
       if (!TestBit(kWriteError)) {
          // Do not print the warning if we already had a SysError.
@@ -2436,6 +2827,77 @@ Int_t TFile::Write(const char *n, Int_t opt, Int_t bufsize) const
    return const_cast<TFile*>(this)->Write(n, opt, bufsize);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until all the objects passed to TDirectoryFile::WriteObjectAsync for
+/// this file and its directories are written.
+///
+/// This is done by all the operations modifying the file structure (e.g. Write,
+/// WriteTObject, Flush, Close); it has to be called explicitly before reading
+/// back from the file objects that are written asynchronously.
+
+void TFile::WaitForAsyncWrites()
+{
+#ifdef R__USE_IMT
+   if (fAsyncKeyWriter)
+      fAsyncKeyWriter->Wait();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return an upper bound of the end of the file once all the keys passed to
+/// WriteKeyAsync are written.
+
+Long64_t TFile::GetAsyncWriteEND()
+{
+#ifdef R__USE_IMT
+   if (fAsyncKeyWriter) {
+      Long64_t pending = fAsyncKeyWriter->GetPendingBytes();
+      std::lock_guard<std::mutex> sentry(fWriteMutex);
+      return fEND + pending;
+   }
+#endif
+   return fEND;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress, allocate and write on a background thread the key, in which an
+/// object was streamed by TDirectoryFile::WriteObjectAsync.  If oldKey is given,
+/// it is deleted from the file before (freeOldKeyFirst) or after key is written;
+/// it must already have been removed from its directory.
+/// Without support for implicit multi-threading, the key is written now.
+
+std::future<Int_t> TFile::WriteKeyAsync(TKey *key, TKey *oldKey, Bool_t freeOldKeyFirst)
+{
+#ifdef R__USE_IMT
+   if (!fAsyncKeyWriter)
+      fAsyncKeyWriter = new ROOT::Internal::RAsyncKeyWriter(*this);
+   return fAsyncKeyWriter->Push(key, oldKey, freeOldKeyFirst);
+#else
+   auto freeKey = [this](TKey *k) {
+      MakeFree(k->GetSeekKey(), k->GetSeekKey() + k->GetNbytes() - 1);
+      delete k;
+   };
+   if (oldKey && freeOldKeyFirst)
+      freeKey(oldKey);
+   key->CreateObjectKey(key->CompressObject());
+   Int_t nbytes = 0;
+   if (!key->GetSeekKey()) {
+      key->GetMotherDir()->GetListOfKeys()->Remove(key);
+      delete key;
+   } else {
+      SumBuffer(key->GetObjlen());
+      nbytes = key->WriteFile(0);
+      if (TestBit(kWriteError))
+         nbytes = 0;
+   }
+   if (oldKey && !freeOldKeyFirst)
+      freeKey(oldKey);
+   std::promise<Int_t> result;
+   result.set_value(nbytes);
+   return result.get_future();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write a buffer to the file. This is the basic low level write operation.
 /// Returns kTRUE in case of failure.
@@ -2509,6 +2971,7 @@ Int_t TFile::WriteBufferViaCache(const char *buf, Int_t len)
 
 void TFile::WriteFree()
 {
+   WaitForAsyncWrites();
    //*-* Delete old record if it exists
    if (fSeekFree != 0) {
       MakeFree(fSeekFree, fSeekFree + fNbytesFree -1);
@@ -2581,6 +3044,7 @@ void TFile::WriteFree()
 
 void TFile::WriteHeader()
 {
+   WaitForAsyncWrites();
    SafeDelete(fInfoCache);
    TFree *lastfree = (TFree*)fFree->Last();
    if (lastfree) fEND  = lastfree->GetFirst();
@@ -3613,6 +4077,28 @@ void TFile::ReadStreamerInfo()
       }
    }
 
+   // Register the compression dictionaries before anything else is read from the file
+   if (auto dicts = dynamic_cast<TList *>(list->FindObject("compressionDictionaries"))) {
+      if (!fCompressionDicts) {
+         fCompressionDicts = new TList;
+         fCompressionDicts->SetOwner(kTRUE);
+      }
+      TIter nextDict(dicts);
+      while (auto dict = static_cast<TObjString *>(nextDict())) {
+         UInt_t id = R__AddCompressionDictionary(dict->String().Data(), dict->String().Length());
+         if (id == 0) {
+            Warning("ReadStreamerInfo", "%s has an invalid compression dictionary", GetName());
+            continue;
+         }
+         fCompressionDicts->Add(new TObjString(dict->String()));
+         if (!fDictID) {
+            // Used if more small buffers are written to this file, see SetCompressionDictionary
+            fDictID = id;
+            fDictWritten = kTRUE;
+         }
+      }
+   }
+
    // loop on all TStreamerInfo classes
    for (int mode=0;mode<2; ++mode) {
       // In order for the collection proxy to be initialized properly, we need
@@ -3627,7 +4113,9 @@ void TFile::ReadStreamerInfo()
          if (info->IsA() != TStreamerInfo::Class()) {
             if (mode==1) {
                TObject *obj = (TObject*)info;
-               if (strcmp(obj->GetName(),"listOfRules")==0) {
+               if (strcmp(obj->GetName(),"compressionDictionaries")==0) {
+                  // Already registered in mode 0
+               } else if (strcmp(obj->GetName(),"listOfRules")==0) {
 #if 0
                   // Completely ignore the rules for now.
                   TList *listOfRules = (TList*)obj;
@@ -3756,12 +4244,13 @@ UShort_t TFile::WriteProcessID(TProcessID *pidd)
 
 void TFile::WriteStreamerInfo()
 {
+   WaitForAsyncWrites();
    //if (!gFile) return;
    if (!fWritable) return;
    if (!fClassIndex) return;
    if (fIsPcmFile) return; // No schema evolution for ROOT PCM files.
    if (fClassIndex->fArray[0] == 0
-       && fSeekInfo != 0) {
+       && fSeekInfo != 0 && (!fDictID || fDictWritten)) {
       // No need to update the index if no new classes added to the file
       // but write once an empty StreamerInfo list to mark that there is no need
       // for StreamerInfos in this file.
@@ -3814,10 +4303,24 @@ void TFile::WriteStreamerInfo()
       list.Add(&listOfRules);
    }
 
+   TList dicts;
+   dicts.SetName("compressionDictionaries");
+   {
+      std::lock_guard<std::mutex> lock(fDictMutex);
+      if (fCompressionDicts && fCompressionDicts->GetEntries()) {
+         dicts.AddAll(fCompressionDicts);
+         list.Add(&dicts);
+      }
+      fDictWritten = fDictID != 0;
+   }
+
    //free previous StreamerInfo record
    if (fSeekInfo) MakeFree(fSeekInfo,fSeekInfo+fNbytesInfo-1);
-   //Create new key
+   //Create new key; the record holding the dictionary cannot be compressed with it
+   const Int_t dictMaxBufferSize = fDictMaxBufferSize;
+   fDictMaxBufferSize = 0;
    TKey key(&list,"StreamerInfo",GetBestBuffer(), this);
+   fDictMaxBufferSize = dictMaxBufferSize;
    fKeys->Remove(&key);
    fSeekInfo   = key.GetSeekKey();
    fNbytesInfo = key.GetNbytes();
@@ -3826,7 +4329,8 @@ void TFile::WriteStreamerInfo()
 
    fClassIndex->fArray[0] = 0;
 
-   list.RemoveLast(); // remove the listOfRules.
+   list.Remove(&dicts);
+   list.Remove(&listOfRules);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4130,7 +4634,7 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
             if (xtms <= 0)
                ::Error("TFile::Open", "timeout expired while opening '%s'", expandedUrl.Data());
             // Cleanup the request
-            SafeDelete(fh);
+            CancelAsyncOpen(fh);
          }
          // Done
          return f;
@@ -4177,14 +4681,23 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
       // e.g. /protocol/path/to/file.root -> protocol:/path/to/file.root
       TUrl urlname(n, kTRUE);
       name = urlname.GetUrl();
-      // Check first if a pending async open request matches this one
-      if (fgAsyncOpenRequests && (fgAsyncOpenRequests->GetSize() > 0)) {
-         TIter nxr(fgAsyncOpenRequests);
-         TFileOpenHandle *fh = nullptr;
-         while ((fh = (TFileOpenHandle *)nxr()))
-            if (fh->Matches(name))
-               return TFile::Open(fh);
+      // Check first if a pending async open request matches this one; the requests
+      // opened in the background must also have been submitted with the same option
+      TFileOpenHandle *pending = nullptr;
+      if (!gInAsyncOpenTask) {
+         std::lock_guard<std::mutex> lock(gAsyncOpenRequestsMutex);
+         if (fgAsyncOpenRequests && (fgAsyncOpenRequests->GetSize() > 0)) {
+            TIter nxr(fgAsyncOpenRequests);
+            TFileOpenHandle *fh = nullptr;
+            while ((fh = (TFileOpenHandle *)nxr()) && !pending)
+               if (fh->Matches(name) && (!fh->fTask || !strcasecmp(fh->GetOpt(), option))) {
+                  fgAsyncOpenRequests->Remove(fh);
+                  pending = fh;
+               }
+         }
       }
+      if (pending)
+         return TFile::Open(pending);
 
       TString urlOptions(urlname.GetOptions());
       if (urlOptions.BeginsWith("pmerge") || urlOptions.Contains("&pmerge") || urlOptions.Contains(" pmerge")) {
@@ -4303,11 +4816,13 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
 ///
 ///     TFile::Open(const char *, ...)
 ///
-/// To be effective, the underlying TFile implementation must be able to
-/// support asynchronous open functionality. Currently, only TXNetFile
-/// supports it. If the functionality is not implemented, this call acts
-/// transparently by returning an handle with the arguments for the
-/// standard synchronous open run by TFile::Open(TFileOpenHandle *).
+/// The XRootD implementations of TFile support asynchronous open natively.
+/// For the other ones, if the thread safety of ROOT is enabled (e.g. by
+/// ROOT::EnableImplicitMT()), the standard open is run by a background thread.
+/// Otherwise this call acts transparently by returning an handle with the
+/// arguments for the standard synchronous open run by TFile::Open(TFileOpenHandle *).
+/// A later TFile::Open(const char *, ...) of the same url takes the pending
+/// request, e.g. when a TChain switches to a file that was opened ahead of time.
 /// The retuned handle will be adopted by TFile after opening completion
 /// in TFile::Open(TFileOpenHandle *); if opening is not finalized the
 /// handle must be deleted by the caller.
@@ -4391,6 +4906,24 @@ TFileOpenHandle *TFile::AsyncOpen(const char *url, Option_t *option,
       // Save the arguments in the handler, so that a standard open can be
       // attempted later on
       fh = new TFileOpenHandle(name, option, ftitle, compress, netopt);
+      // With thread safety enabled (ROOT::EnableThreadSafety()), start it right away in the background
+      if (gGlobalMutex) {
+         fh->fTask = new ROOT::Internal::TFileOpenTask;
+         auto state = fh->fTask->fState;
+         TString url = name, opt = option, title = ftitle;
+         std::thread([state, url, opt, title, compress, netopt]() {
+            gInAsyncOpenTask = true;
+            TFile *file = nullptr;
+            {
+               TDirectory::TContext ctxt;
+               file = TFile::Open(url, opt, title, compress, netopt);
+            }
+            std::lock_guard<std::mutex> lock(state->fMutex);
+            state->fFile = file;
+            state->fDone = true;
+            state->fCv.notify_all();
+         }).detach();
+      }
    } else if (f) {
       // Fill the opaque handler to be use to attach the file later on
       fh = new TFileOpenHandle(f);
@@ -4398,6 +4931,7 @@ TFileOpenHandle *TFile::AsyncOpen(const char *url, Option_t *option,
 
    // Record this request
    if (fh) {
+      std::lock_guard<std::mutex> lock(gAsyncOpenRequestsMutex);
       // Create the lst, if not done already
       if (!fgAsyncOpenRequests)
          fgAsyncOpenRequests = new TList;
@@ -4422,9 +4956,15 @@ TFile *TFile::Open(TFileOpenHandle *fh)
    if (fh && fgAsyncOpenRequests) {
       // Remove it from the pending list: we need to do it at this level to avoid
       // recursive calls in the standard TFile::Open
-      fgAsyncOpenRequests->Remove(fh);
+      {
+         std::lock_guard<std::mutex> lock(gAsyncOpenRequestsMutex);
+         fgAsyncOpenRequests->Remove(fh);
+      }
       // Was asynchronous open functionality implemented?
-      if ((f = fh->GetFile()) && !(f->IsZombie())) {
+      if (fh->fTask) {
+         // The standard open run in the background
+         f = fh->fTask->Take();
+      } else if ((f = fh->GetFile()) && !(f->IsZombie())) {
          // Yes: wait for the completion of the open phase, if needed
          Bool_t cr = (!strcmp(f->GetOption(),"CREATE") ||
                       !strcmp(f->GetOption(),"RECREATE") ||
@@ -4445,6 +4985,29 @@ TFile *TFile::Open(TFileOpenHandle *fh)
    return f;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Withdraws a pending asynchronous open request that is not needed anymore and
+/// deletes its handle. A file opened in the background is closed once its open
+/// completes, without waiting for it here. Requests that were already taken by
+/// TFile::Open are left alone: their handle belongs to the opened file.
+
+void TFile::CancelAsyncOpen(TFileOpenHandle *fh)
+{
+   {
+      // Only the objects of the list are dereferenced, fh may have been deleted with its file
+      std::lock_guard<std::mutex> lock(gAsyncOpenRequestsMutex);
+      if (!fh || !fgAsyncOpenRequests || !fgAsyncOpenRequests->Remove(fh))
+         return;
+   }
+   // A natively asynchronous open has to complete before the file can be deleted
+   if (fh->fFile) {
+      if (!fh->fFile->IsZombie() && fh->fFile->GetAsyncOpenStatus() == kAOSInProgress)
+         fh->fFile->Init(kFALSE);
+      SafeDelete(fh->fFile);
+   }
+   delete fh;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to system open. All arguments like in POSIX open().
 
@@ -4753,6 +5316,15 @@ Bool_t TFile::Matches(const char *url)
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor. A file opened in the background and not taken by TFile::Open is
+/// closed by the background thread.
+
+TFileOpenHandle::~TFileOpenHandle()
+{
+   delete fTask;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE if this async request matches the open request
 /// specified by 'url'
@@ -4870,6 +5442,7 @@ TFile::EFileType TFile::GetType(const char *name, Option_t *option, TString *pre
 TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(const char* name)
 {
    // Check the list of pending async open requests
+   std::unique_lock<std::mutex> lock(gAsyncOpenRequestsMutex);
    if (fgAsyncOpenRequests && (fgAsyncOpenRequests->GetSize() > 0)) {
       TIter nxr(fgAsyncOpenRequests);
       TFileOpenHandle *fh = nullptr;
@@ -4877,6 +5450,7 @@ TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(const char* name)
          if (fh->Matches(name))
             return TFile::GetAsyncOpenStatus(fh);
    }
+   lock.unlock();
 
    // Check also the list of files open
    R__LOCKGUARD(gROOTMutex);
@@ -4898,6 +5472,13 @@ TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(const char* name)
 
 TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(TFileOpenHandle *handle)
 {
+   if (handle && handle->fTask) {
+      if (!handle->fTask->IsDone())
+         return TFile::kAOSInProgress;
+      std::lock_guard<std::mutex> lock(handle->fTask->fState->fMutex);
+      TFile *f = handle->fTask->fState->fFile;
+      return (f && !f->IsZombie()) ? TFile::kAOSSuccess : TFile::kAOSFailure;
+   }
    if (handle && handle->fFile) {
       if (!handle->fFile->IsZombie())
          return handle->fFile->GetAsyncOpenStatus();
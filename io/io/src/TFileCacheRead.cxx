@@ -31,9 +31,50 @@
 #include "TFileCacheWrite.h"
 #include "TFilePrefetch.h"
 #include "TMathBase.h"
+#include "TUrl.h"
+
+#include <ROOT/RMemoryBudget.hxx>
+#include <ROOT/RReadPlanner.hxx>
+
+#include <cstring>
+#include <vector>
 
 ClassImp(TFileCacheRead);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Plan the reading of the `nseek` sorted blocks of the cache for the given file.
+/// On local files, only adjacent blocks are merged; the 16 MBytes limit is
+/// empirical and may depend on the file system.  Increasing this number must be
+/// done with care, as it may increase the job real time (mismatch with OS buffers).
+/// On remote files, the planner may merge blocks separated by small gaps.
+
+ROOT::Internal::RReadPlanner::RPlan
+PlanCacheReads(TFile *file, Int_t nseek, const Long64_t *seekSort, const Int_t *seekSortLen)
+{
+   using ROOT::Internal::RReadPlanner;
+   const char *protocol = (file && file->GetEndpointUrl()) ? file->GetEndpointUrl()->GetProtocol() : "file";
+   auto settings = RReadPlanner::RSettings::GetForTransport(protocol);
+   if (!strcmp(protocol, "file")) {
+      settings.fMaxGap = 0;
+      settings.fMaxRequestSize = 16000000;
+   }
+   // Blocks are looked up in a single request, so they must not be split; the Int_t lengths also need to fit.
+   settings.fSplitLargeRanges = false;
+   if (settings.fMaxRequestSize == 0 || settings.fMaxRequestSize > kMaxInt)
+      settings.fMaxRequestSize = kMaxInt;
+
+   std::vector<RReadPlanner::RRange> ranges(nseek);
+   for (Int_t i = 0; i < nseek; ++i) {
+      ranges[i].fOffset = seekSort[i];
+      ranges[i].fSize = seekSortLen[i];
+   }
+   return RReadPlanner::Plan(ranges, settings);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -169,6 +210,8 @@ TFileCacheRead::~TFileCacheRead()
    delete [] fLen;
    if (fBuffer)
       delete [] fBuffer;
+   fBuffer = nullptr;
+   UpdateMemoryBudget();
    delete [] fBSeek;
    delete [] fBSeekIndex;
    delete [] fBSeekSort;
@@ -551,6 +594,7 @@ void TFileCacheRead::SetFile(TFile *file, TFile::ECacheAction action)
       if (file && file->ReadBufferAsync(0, 0)) {
          fAsyncReading = kFALSE;
          fBuffer       = new char[fBufferSize];
+         UpdateMemoryBudget();
       }
    }
 
@@ -566,14 +610,13 @@ void TFileCacheRead::SetFile(TFile *file, TFile::ECacheAction action)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Sort buffers to be prefetched in increasing order of positions.
-/// Merge consecutive blocks if necessary.
+/// Merge close-by blocks if necessary, see ROOT::Internal::RReadPlanner.
 
 void TFileCacheRead::Sort()
 {
    if (!fNseek) return;
    TMath::Sort(fNseek,fSeek,fSeekIndex,kFALSE);
    Int_t i;
-   Int_t nb = 0;
    Int_t effectiveNseek = 0;
    for (i=0;i<fNseek;i++) {
       // Skip duplicates
@@ -590,33 +633,25 @@ void TFileCacheRead::Sort()
       ++effectiveNseek;
    }
    fNseek = effectiveNseek;
-   if (fNtot > fBufferSizeMin) {
-      fBufferSize = fNtot + 100;
+   const auto plan = PlanCacheReads(fFile, fNseek, fSeekSort, fSeekSortLen);
+   const auto bufferSize = static_cast<Long64_t>(plan.fBufferSize);
+   if (bufferSize > fBufferSizeMin) {
+      fBufferSize = static_cast<Int_t>(bufferSize + 100);
       delete [] fBuffer;
       fBuffer = 0;
       // If ReadBufferAsync is not supported by this implementation
       // it means that we are using sync primitives, hence we need the local buffer
       if (!fAsyncReading)
          fBuffer = new char[fBufferSize];
+      UpdateMemoryBudget();
    }
-   fPos[0]  = fSeekSort[0];
-   fLen[0]  = fSeekSortLen[0];
-   fSeekPos[0] = 0;
-   for (i=1;i<fNseek;i++) {
-      fSeekPos[i] = fSeekPos[i-1] + fSeekSortLen[i-1];
-      //in the test below 16 MBytes is pure empirirical and may depend on the file system.
-      //increasing this number must be done with care, as it may increase
-      //the job real time (mismatch with OS buffers)
-      if ((fSeekSort[i] != fSeekSort[i-1]+fSeekSortLen[i-1]) ||
-          (fLen[nb] > 16000000)) {
-         nb++;
-         fPos[nb] = fSeekSort[i];
-         fLen[nb] = fSeekSortLen[i];
-      } else {
-         fLen[nb] += fSeekSortLen[i];
-      }
+   for (i = 0; i < fNseek; i++)
+      fSeekPos[i] = plan.fRangeBufferOffsets[i];
+   fNb = plan.fRequests.size();
+   for (i = 0; i < fNb; i++) {
+      fPos[i] = plan.fRequests[i].fOffset;
+      fLen[i] = plan.fRequests[i].fSize;
    }
-   fNb = nb+1;
    fIsSorted = kTRUE;
 }
 
@@ -624,14 +659,13 @@ void TFileCacheRead::Sort()
 ////////////////////////////////////////////////////////////////////////////////
 /// Sort buffers to be prefetched in increasing order of positions.
 ///
-/// Merge consecutive blocks if necessary.
+/// Merge close-by blocks if necessary, see ROOT::Internal::RReadPlanner.
 
 void TFileCacheRead::SecondSort()
 {
    if (!fBNseek) return;
    TMath::Sort(fBNseek,fBSeek,fBSeekIndex,kFALSE);
    Int_t i;
-   Int_t nb = 0;
    Int_t effectiveNseek = 0;
    for (i=0;i<fBNseek;i++) {
       // Skip duplicates
@@ -648,33 +682,25 @@ void TFileCacheRead::SecondSort()
       ++effectiveNseek;
    }
    fBNseek = effectiveNseek;
-   if (fBNtot > fBufferSizeMin) {
-      fBufferSize = fBNtot + 100;
+   const auto plan = PlanCacheReads(fFile, fBNseek, fBSeekSort, fBSeekSortLen);
+   const auto bufferSize = static_cast<Long64_t>(plan.fBufferSize);
+   if (bufferSize > fBufferSizeMin) {
+      fBufferSize = static_cast<Int_t>(bufferSize + 100);
       delete [] fBuffer;
       fBuffer = 0;
       // If ReadBufferAsync is not supported by this implementation
       // it means that we are using sync primitives, hence we need the local buffer
       if (!fAsyncReading)
          fBuffer = new char[fBufferSize];
+      UpdateMemoryBudget();
    }
-   fBPos[0]  = fBSeekSort[0];
-   fBLen[0]  = fBSeekSortLen[0];
-   fBSeekPos[0] = 0;
-   for (i=1;i<fBNseek;i++) {
-      fBSeekPos[i] = fBSeekPos[i-1] + fBSeekSortLen[i-1];
-      //in the test below 16 MBytes is pure empirirical and may depend on the file system.
-      //increasing this number must be done with care, as it may increase
-      //the job real time (mismatch with OS buffers)
-      if ((fBSeekSort[i] != fBSeekSort[i-1]+fBSeekSortLen[i-1]) ||
-         (fBLen[nb] > 16000000)) {
-         nb++;
-         fBPos[nb] = fBSeekSort[i];
-         fBLen[nb] = fBSeekSortLen[i];
-      } else {
-         fBLen[nb] += fBSeekSortLen[i];
-      }
+   for (i = 0; i < fBNseek; i++)
+      fBSeekPos[i] = plan.fRangeBufferOffsets[i];
+   fBNb = plan.fRequests.size();
+   for (i = 0; i < fBNb; i++) {
+      fBPos[i] = plan.fRequests[i].fOffset;
+      fBLen[i] = plan.fRequests[i].fSize;
    }
-   fBNb = nb+1;
    fBIsSorted = kTRUE;
 }
 
@@ -749,6 +775,7 @@ Int_t TFileCacheRead::SetBufferSize(Int_t buffersize)
    fBuffer = np;
    fBufferSizeMin = buffersize;
    fBufferSize = buffersize;
+   UpdateMemoryBudget();
 
    if (inval) {
       return 1;
@@ -812,7 +839,23 @@ void TFileCacheRead::SetEnablePrefetchingImpl(Bool_t setPrefetching)
       if (!fAsyncReading && fBuffer == 0) {
          // we use sync primitives, hence we need the local buffer
          fBuffer = new char[fBufferSize];
+         UpdateMemoryBudget();
       }
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Account for the size of fBuffer in the ROOT::Experimental::RMemoryBudget of the TTree caches, to be called
+/// whenever fBuffer is allocated or freed.
+
+void TFileCacheRead::UpdateMemoryBudget()
+{
+   using ROOT::Experimental::RMemoryBudget;
+   const Int_t size = fBuffer ? fBufferSize : 0;
+   if (size > fAccountedBufferSize)
+      RMemoryBudget::Add(RMemoryBudget::kTreeCache, size - fAccountedBufferSize);
+   else if (size < fAccountedBufferSize)
+      RMemoryBudget::Release(RMemoryBudget::kTreeCache, fAccountedBufferSize - size);
+   fAccountedBufferSize = size;
+}
+
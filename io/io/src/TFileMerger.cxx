@@ -20,6 +20,13 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+With implicit multi-threading enabled and SetParallelMergeBatch called, the
+histograms are merged concurrently: they are read from the input files in
+batches, each batch is summed on the thread pool while the next one is read,
+and the merged histograms are then written to the output file in the order of
+the sequential merge.  The other objects, in particular the trees which keep
+being fast cloned, are merged as before by the calling thread.
 */
 
 #include "TFileMerger.h"
@@ -40,6 +47,10 @@ to be merged, like the standalone hadd program.
 #include "TMemFile.h"
 #include "TVirtualMutex.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
 #ifdef WIN32
 // For _getmaxstdio
 #include <cstdio>
@@ -49,7 +60,10 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -447,6 +461,137 @@ Bool_t WriteCycleInOrder(const TString &name, TIter &nextkey, TIter &peeknextkey
 
 } // anonymous namespace
 
+namespace ROOT {
+namespace Internal {
+
+/// Histograms read from the input files and merged on the implicit multi-threading
+/// pool.  The objects of a batch are merged while the next batch is read, and
+/// written to the output, in the order in which they were read, once the next
+/// batch is complete or at the end of the directory.
+class RConcurrentMerges {
+public:
+   struct RItem {
+      TDirectory *fTarget;            ///< Directory where the merged object is written
+      TString fName;                  ///< Name of the key
+      TClass *fClass;                 ///< Class of the object
+      TObject *fObject;               ///< Read from the first file, receives the merge result; owned
+      TList fInputs;                  ///< Same-name objects of the other files
+      TList fToDelete;                ///< Objects of fInputs that were read from a key; owned
+      Bool_t fOneGo;                  ///< Merge all inputs in one call
+      TFileMergeInfo fInfo;
+      Long64_t fResult{0};            ///< Smallest value returned by the merge function
+
+      RItem(TDirectory *target, const char *name, TClass *cl, TObject *obj, Bool_t oneGo, const TFileMergeInfo &info)
+         : fTarget(target), fName(name), fClass(cl), fObject(obj), fOneGo(oneGo), fInfo(info.fOutputDirectory)
+      {
+         fInfo.fOptions = info.fOptions;
+         fInfo.fIOFeatures = info.fIOFeatures;
+      }
+
+      ~RItem()
+      {
+         fInputs.Clear();
+         fToDelete.Delete();
+         if (fObject)
+            fClass->Destructor(fObject);
+      }
+
+      void Merge()
+      {
+         ROOT::MergeFunc_t func = fClass->GetMerge();
+         if (fOneGo || fInputs.IsEmpty()) {
+            fResult = func(fObject, &fInputs, &fInfo);
+            return;
+         }
+         TList single;
+         TIter next(&fInputs);
+         while (TObject *input = next()) {
+            single.Add(input);
+            fResult = std::min(fResult, func(fObject, &single, &fInfo));
+            fInfo.fIsFirst = kFALSE;
+            single.Clear();
+         }
+      }
+   };
+
+private:
+   UInt_t fBatchSize;
+   std::vector<std::unique_ptr<RItem>> fReading; ///< Read, waiting for the current batch to be merged
+   std::vector<std::unique_ptr<RItem>> fMerging; ///< Being merged by fTasks
+#ifdef R__USE_IMT
+   ROOT::Experimental::TTaskGroup fTasks;
+#endif
+
+   /// Wait for the merge of the current batch and write its objects.
+   Bool_t WriteMerged()
+   {
+#ifdef R__USE_IMT
+      fTasks.Wait();
+#endif
+      Bool_t status = kTRUE;
+      for (auto &item : fMerging) {
+         if (item->fResult < 0) {
+            ::Error("TFileMerger::MergeRecursive", "calling Merge() on '%s' with the corresponding objects of %s",
+                    item->fName.Data(), item->fTarget->GetPath());
+         }
+         item->fTarget->cd();
+         status = WriteOneAndDelete(item->fName, item->fClass, item->fObject, kTRUE, kTRUE, item->fTarget) && status;
+         item->fObject = nullptr;
+      }
+      fMerging.clear();
+      return status;
+   }
+
+   /// Write the current batch and start the merge of the batch read since.
+   Bool_t NextBatch()
+   {
+      Bool_t status = WriteMerged();
+      fMerging.swap(fReading);
+      for (auto &item : fMerging) {
+         RItem *ptr = item.get();
+#ifdef R__USE_IMT
+         fTasks.Run([ptr]() { ptr->Merge(); });
+#else
+         ptr->Merge();
+#endif
+      }
+      return status;
+   }
+
+public:
+   RConcurrentMerges(UInt_t batchSize) : fBatchSize(batchSize) {}
+
+   ~RConcurrentMerges()
+   {
+      // Only left over after an error: the objects that were not written are dropped
+#ifdef R__USE_IMT
+      fTasks.Wait();
+#endif
+   }
+
+   /// Queue a histogram whose inputs were all read; returns false if writing the
+   /// objects merged in the meantime failed.
+   Bool_t Add(std::unique_ptr<RItem> item)
+   {
+      fReading.push_back(std::move(item));
+      if (fReading.size() < fBatchSize)
+         return kTRUE;
+      return NextBatch();
+   }
+
+   /// Merge and write all the queued histograms.
+   Bool_t Flush()
+   {
+      if (fReading.empty() && fMerging.empty())
+         return kTRUE;
+      Bool_t status = NextBatch();
+      return WriteMerged() && status;
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type, TFileMergeInfo &info,
                              TString &oldkeyname, THashList &allNames, Bool_t &status, Bool_t &onlyListed,
                              const TString &path, TDirectory *current_sourcedir, TFile *current_file, TKey *key,
@@ -519,6 +664,13 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          }
       }
    }
+   // Histograms read from keys can be merged concurrently, the other objects are
+   // merged sequentially after the queued ones have been written to keep the order
+   Bool_t mergeConcurrently = fConcurrentMerges && key && !(type & kIncremental) && cl->IsTObject() &&
+                              cl->GetMerge() && cl->InheritsFrom(R__TH1_Class);
+   if (fConcurrentMerges && !mergeConcurrently && !fConcurrentMerges->Flush())
+      status = kFALSE;
+
    // read object from first source file
    if (type & kIncremental) {
       if (!obj)
@@ -614,6 +766,46 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       // Check if already treated
       if (alreadyseen) return kTRUE;
 
+      if (mergeConcurrently) {
+         // Read all the inputs now, the merge and the write are done by fConcurrentMerges
+         obj->ResetBit(kMustCleanup);
+         current_sourcedir->GetList()->Remove(obj);
+         std::unique_ptr<ROOT::Internal::RConcurrentMerges::RItem> item(
+            new ROOT::Internal::RConcurrentMerges::RItem(target, keyname, cl, obj, fHistoOneGo, info));
+         TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
+         while (nextsource) {
+            TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
+            if (ndir) {
+               TObject *hobj = ndir->GetList()->FindObject(keyname);
+               if (!hobj) {
+                  TKey *key2 = (TKey*)ndir->GetListOfKeys()->FindObject(keyname);
+                  if (key2) {
+                     ndir->cd();
+                     hobj = key2->ReadObj();
+                     if (!hobj) {
+                        Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+                           keyname, keytitle, nextsource->GetName());
+                        return kTRUE;
+                     }
+                     // Owned by the item, not by the input directory which is not thread-safe
+                     ndir->GetList()->Remove(hobj);
+                     item->fToDelete.Add(hobj);
+                  }
+               }
+               if (hobj) {
+                  hobj->ResetBit(kMustCleanup);
+                  item->fInputs.Add(hobj);
+               }
+            }
+            nextsource = (TFile*)sourcelist->After( nextsource );
+         }
+         if (!fConcurrentMerges->Add(std::move(item)))
+            status = kFALSE;
+         oldkeyname = keyname;
+         info.Reset();
+         return kTRUE;
+      }
+
       TList inputs;
       TList todelete;
       Bool_t oneGo = fHistoOneGo && cl->InheritsFrom(R__TH1_Class);
@@ -890,6 +1082,10 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
          current_sourcedir = 0;
       }
    }
+   // The queued histograms must be written before the directory
+   if (fConcurrentMerges && !fConcurrentMerges->Flush())
+      status = kFALSE;
+
    // save modifications to the target directory.
    if (!(type&kIncremental)) {
       // In case of incremental build, we will call Write on the top directory/file, so we do not need
@@ -962,10 +1158,17 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
 
    TDirectory::TContext ctxt;
 
+#ifdef R__USE_IMT
+   if (fParallelMergeBatch > 0 && !(in_type & kIncremental) && ROOT::IsImplicitMTEnabled())
+      fConcurrentMerges = new ROOT::Internal::RConcurrentMerges(fParallelMergeBatch);
+#endif
+
    Bool_t result = kTRUE;
    Int_t type = in_type;
    while (result && fFileList.GetEntries()>0) {
       result = MergeRecursive(fOutputFile, &fFileList, type);
+      // The next set of files, if any, is merged incrementally
+      SafeDelete(fConcurrentMerges);
 
       // Remove local copies if there are any
       TIter next(&fFileList);
@@ -1102,6 +1305,21 @@ void TFileMerger::SetMaxOpenedFiles(Int_t newmax)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the histograms concurrently when implicit multi-threading is enabled.
+///
+/// The histograms are read in batches of nobjects; a batch is summed on the
+/// thread pool while the next one is read.  All the inputs of a batch are held
+/// in memory, i.e. up to twice nobjects times the number of input files.  The
+/// output file has the same content and key order as with a sequential merge.
+/// A value of 0 (default) disables the concurrent merge.  Incremental merges are
+/// always sequential.
+
+void TFileMerger::SetParallelMergeBatch(Int_t nobjects)
+{
+   fParallelMergeBatch = nobjects > 0 ? nobjects : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the prefix to be used when printing informational message.
 
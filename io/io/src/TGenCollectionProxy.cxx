@@ -951,6 +951,9 @@ TGenCollectionProxy *TGenCollectionProxy::InitializeEx(Bool_t silent)
                   fValDiff = fVal->fSize;
                   fValDiff += (slong - fValDiff%slong)%slong;
                }
+               if ( (fSTL_type == ROOT::kSTLvector && fVal->fKind != kBool_t) || fSTL_type == ROOT::kROOTRVec ) {
+                  fProperties |= kIsContiguous;
+               }
                if (num > 2 && !inside[2].empty()) {
                   if (! TClassEdit::IsDefAlloc(inside[2].c_str(),inside[0].c_str())) {
                      fProperties |= kCustomAlloc;
@@ -27,6 +27,7 @@ size(), clear(), resize(). resize() may be a void operation.
 #include "TError.h"
 #include "TROOT.h"
 #include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
 #include "TStreamerElement.h"
 #include "TVirtualCollectionIterators.h"
 
@@ -210,6 +211,17 @@ void DispatchConvertArray(int writeType, TGenCollectionProxy::StreamHelper *read
    }
 }
 
+void *TGenCollectionStreamer::GetContiguousBegin()
+{
+   // Address of the first element of a collection with the kIsContiguous property.
+   if (fSTL_type == ROOT::kSTLvector) {
+      TVirtualVectorIterators iterators(fFunctionCreateIterators);
+      iterators.CreateIterators(fEnv->fObject);
+      return iterators.fBegin;
+   }
+   return fFirst.invoke(fEnv);
+}
+
 void TGenCollectionStreamer::ReadPrimitives(int nElements, TBuffer &b, const TClass *onFileClass)
 {
    // Primitive input streamer.
@@ -220,16 +232,14 @@ void TGenCollectionStreamer::ReadPrimitives(int nElements, TBuffer &b, const TCl
    StreamHelper* itmstore = 0;
    StreamHelper* itmconv = 0;
    fEnv->fSize = nElements;
-   // TODO could RVec use something faster the default?
    switch (fSTL_type)  {
       case ROOT::kSTLvector:
-         if (fVal->fKind != kBool_t)  {
+      case ROOT::kROOTRVec:
+         if (fProperties & kIsContiguous)  {
             fResize(fEnv->fObject,fEnv->fSize);
             fEnv->fIdx = 0;
 
-            TVirtualVectorIterators iterators(fFunctionCreateIterators);
-            iterators.CreateIterators(fEnv->fObject);
-            itmstore = (StreamHelper*)iterators.fBegin;
+            itmstore = (StreamHelper*)GetContiguousBegin();
             fEnv->fStart = itmstore;
             break;
          }
@@ -376,15 +386,12 @@ void TGenCollectionStreamer::ReadObjects(int nElements, TBuffer &b, const TClass
    switch (fSTL_type)  {
          // Simple case: contiguous memory. get address of first, then jump.
       case ROOT::kSTLvector:
+      case ROOT::kROOTRVec:
 #define DOLOOP(x) {int idx=0; while(idx<nElements) {StreamHelper* i=(StreamHelper*)(((char*)itm) + fValDiff*idx); { x ;} ++idx;} break;}
          fResize(fEnv->fObject,fEnv->fSize);
          fEnv->fIdx = 0;
 
-         {
-            TVirtualVectorIterators iterators(fFunctionCreateIterators);
-            iterators.CreateIterators(fEnv->fObject);
-            itm = (StreamHelper*)iterators.fBegin;
-         }
+         itm = (StreamHelper*)GetContiguousBegin();
          fEnv->fStart = itm;
          switch (fVal->fCase) {
             case kIsClass:
@@ -406,7 +413,6 @@ void TGenCollectionStreamer::ReadObjects(int nElements, TBuffer &b, const TClass
       case ROOT::kSTLlist:
       case ROOT::kSTLforwardlist:
       case ROOT::kSTLdeque:
-      case ROOT::kROOTRVec: // TODO could we do something faster?
 #define DOLOOP(x) {int idx=0; while(idx<nElements) {StreamHelper* i=(StreamHelper*)TGenCollectionProxy::At(idx); { x ;} ++idx;} break;}
          fResize(fEnv->fObject,fEnv->fSize);
          fEnv->fIdx = 0;
@@ -897,7 +903,8 @@ void TGenCollectionStreamer::WritePrimitives(int nElements, TBuffer &b)
    StreamHelper* itm = 0;
    switch (fSTL_type)  {
       case ROOT::kSTLvector:
-         if (fVal->fKind != kBool_t)  {
+      case ROOT::kROOTRVec:
+         if (fProperties & kIsContiguous)  {
             itm = (StreamHelper*)(fEnv->fStart = fFirst.invoke(fEnv));
             break;
          }
@@ -969,6 +976,7 @@ void TGenCollectionStreamer::WriteObjects(int nElements, TBuffer &b)
    switch (fSTL_type)  {
          // Simple case: contiguous memory. get address of first, then jump.
       case ROOT::kSTLvector:
+      case ROOT::kROOTRVec:
 #define DOLOOP(x) {int idx=0; while(idx<nElements) {StreamHelper* i=(StreamHelper*)(((char*)itm) + fValDiff*idx); { x ;} ++idx;} break;}
          itm = (StreamHelper*)fFirst.invoke(fEnv);
          switch (fVal->fCase) {
@@ -1000,7 +1008,6 @@ void TGenCollectionStreamer::WriteObjects(int nElements, TBuffer &b)
       case ROOT::kSTLset:
       case ROOT::kSTLunorderedset:
       case ROOT::kSTLunorderedmultiset:
-      case ROOT::kROOTRVec: // TODO could we do something faster?
 #define DOLOOP(x) {int idx=0; while(idx<nElements) {StreamHelper* i=(StreamHelper*)TGenCollectionProxy::At(idx); { x ;} ++idx;} break;}
          switch (fVal->fCase) {
             case kIsClass:
@@ -1112,37 +1119,34 @@ void TGenCollectionStreamer::WriteMap(int nElements, TBuffer &b)
 template <typename From, typename To>
 void TGenCollectionStreamer::ConvertBufferVectorPrimitives(TBuffer &b, void *obj, Int_t nElements)
 {
-   From *temp = new From[nElements];
+   From *temp = TStreamerInfoActions::GetConversionBuffer<From>(nElements);
    b.ReadFastArray(temp, nElements);
    std::vector<To> *const vec = (std::vector<To>*)(obj);
    for(Int_t ind = 0; ind < nElements; ++ind) {
       (*vec)[ind] = (To)temp[ind];
    }
-   delete [] temp;
 }
 
 template <typename To>
 void TGenCollectionStreamer::ConvertBufferVectorPrimitivesFloat16(TBuffer &b, void *obj, Int_t nElements)
 {
-   Float16_t *temp = new Float16_t[nElements];
+   Float16_t *temp = TStreamerInfoActions::GetConversionBuffer<Float16_t>(nElements);
    b.ReadFastArrayFloat16(temp, nElements);
    std::vector<To> *const vec = (std::vector<To>*)(obj);
    for(Int_t ind = 0; ind < nElements; ++ind) {
       (*vec)[ind] = (To)temp[ind];
    }
-   delete [] temp;
 }
 
 template <typename To>
 void TGenCollectionStreamer::ConvertBufferVectorPrimitivesDouble32(TBuffer &b, void *obj, Int_t nElements)
 {
-   Double32_t *temp = new Double32_t[nElements];
+   Double32_t *temp = TStreamerInfoActions::GetConversionBuffer<Double32_t>(nElements);
    b.ReadFastArrayDouble32(temp, nElements);
    std::vector<To> *const vec = (std::vector<To>*)(obj);
    for(Int_t ind = 0; ind < nElements; ++ind) {
       (*vec)[ind] = (To)temp[ind];
    }
-   delete [] temp;
 }
 
 template <typename To>
@@ -1351,7 +1355,7 @@ void TGenCollectionStreamer::ReadBufferGeneric(TBuffer &b, void *obj, const TCla
          case ROOT::kSTLset:
          case ROOT::kSTLunorderedset:
          case ROOT::kSTLunorderedmultiset:
-         case ROOT::kROOTRVec: // TODO could we do something faster?
+         case ROOT::kROOTRVec:
             if (obj) {
                if (fProperties & kNeedDelete)   {
                   TGenCollectionProxy::Clear("force");
@@ -1407,7 +1411,7 @@ void TGenCollectionStreamer::Streamer(TBuffer &b)
             case ROOT::kSTLset:
             case ROOT::kSTLunorderedset:
             case ROOT::kSTLunorderedmultiset:
-            case ROOT::kROOTRVec: // TODO could we do something faster?
+            case ROOT::kROOTRVec:
                switch (fVal->fCase) {
                   case kIsFundamental:  // Only handle primitives this way
                   case kIsEnum:
@@ -1442,7 +1446,7 @@ void TGenCollectionStreamer::Streamer(TBuffer &b)
             case ROOT::kSTLset:
             case ROOT::kSTLunorderedset:
             case ROOT::kSTLunorderedmultiset:
-            case ROOT::kROOTRVec: // TODO could we do something faster?
+            case ROOT::kROOTRVec:
                switch (fVal->fCase) {
                   case kIsFundamental:  // Only handle primitives this way
                   case kIsEnum:
@@ -66,6 +66,8 @@
 #include "ThreadLocalStorage.h"
 
 #include "RZip.h"
+#include "ROOT/RFreeSegmentIndex.hxx"
+#include "ROOT/RZipRecords.hxx"
 
 const Int_t kTitleMax = 32000;
 #if 0
@@ -224,6 +226,20 @@ TKey::TKey(const TString &name, const TString &title, const TClass *cl, Int_t nb
 ///  by the regular expression parser (see TRegexp).
 
 TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* motherDir)
+     : TKey(obj, name, bufsize, motherDir, -1)
+{
+   CreateObjectKey(CompressObject());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a TKey object for a TObject* and stream the object into fBufferRef.
+///
+/// The key is not allocated on file: this is left to the caller, with
+/// CreateObjectKey(CompressObject()), as done for TDirectoryFile::WriteObjectAsync.
+/// filepos is the position of the key on file, or an upper bound of it; it
+/// determines the size of the key header (see Build).
+
+TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* motherDir, Long64_t filepos)
      : TNamed(name, obj->GetTitle())
 {
    R__ASSERT(obj);
@@ -236,9 +252,8 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
               obj->ClassName());
    }
 
-   Build(motherDir, obj->ClassName(), -1);
+   Build(motherDir, obj->ClassName(), filepos);
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
    fBufferRef = new TBufferFile(TBuffer::kWrite, bufsize);
    fBufferRef->SetParent(GetFile());
    fCycle     = fMotherDir->AppendKey(this);
@@ -247,46 +262,7 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
    fKeylen    = fBufferRef->Length();
    fBufferRef->MapObject(obj);    //register obj in map in case of self reference
    ((TObject*)obj)->Streamer(*fBufferRef);    //write object
-   lbuf       = fBufferRef->Length();
-   fObjlen    = lbuf - fKeylen;
-
-   Int_t cxlevel = GetFile() ? GetFile()->GetCompressionLevel() : 0;
-   ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(GetFile() ? GetFile()->GetCompressionAlgorithm() : 0);
-   if (cxlevel > 0 && fObjlen > 256) {
-      Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
-      Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
-      fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
-      }
-      Create(noutot);
-      fBufferRef->SetBufferOffset(0);
-      Streamer(*fBufferRef);         //write key itself again
-      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
-      delete fBufferRef; fBufferRef = 0;
-   } else {
-      fBuffer = fBufferRef->Buffer();
-      Create(fObjlen);
-      fBufferRef->SetBufferOffset(0);
-      Streamer(*fBufferRef);         //write key itself again
-   }
+   fObjlen    = fBufferRef->Length() - fKeylen;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -334,13 +310,24 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
    Streamer(*fBufferRef);         //write key itself
    fKeylen    = fBufferRef->Length();
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
-
    fBufferRef->MapObject(actualStart,clActual);         //register obj in map in case of self reference
    clActual->Streamer((void*)actualStart, *fBufferRef); //write object
-   lbuf       = fBufferRef->Length();
-   fObjlen    = lbuf - fKeylen;
+   fObjlen    = fBufferRef->Length() - fKeylen;
+
+   CreateObjectKey(CompressObject());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the object streamed into fBufferRef into a new fBuffer, if the
+/// compression settings of the file require it.
+///
+/// Returns the number of bytes of the object data to be written: if it is
+/// fObjlen, the object is not compressed and fBuffer is the buffer of fBufferRef.
+/// Does not modify the file; several keys may be compressed at the same time.
 
+Int_t TKey::CompressObject()
+{
+   Int_t nout, noutot, bufmax;
    Int_t cxlevel = GetFile() ? GetFile()->GetCompressionLevel() : 0;
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(GetFile() ? GetFile()->GetCompressionAlgorithm() : 0);
    if (cxlevel > 0 && fObjlen > 256) {
@@ -349,34 +336,43 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
       fBuffer = new char[buflen];
       char *objbuf = fBufferRef->Buffer() + fKeylen;
       char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
+      if (nbuffers > 1) {
+         // Large objects are compressed in records of kMAXZIPBUF, in parallel if implicit MT is enabled
+         noutot = ROOT::Internal::ZipRecords(cxlevel, cxAlgorithm, objbuf, fObjlen, bufcur, kMAXZIPBUF);
+         if (noutot == 0 || noutot >= fObjlen) {
+            delete [] fBuffer;
             fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
+            return fObjlen;
          }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+         return noutot;
+      }
+      // Small objects may be compressed with the dictionary of the file
+      UInt_t dictID = GetFile()->GetCompressionDictionary(objbuf, fObjlen, cxAlgorithm);
+      bufmax = fObjlen;
+      R__zipWithDictionary(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm, dictID);
+      if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
+         delete [] fBuffer;
+         fBuffer = fBufferRef->Buffer();
+         return fObjlen;
       }
-      Create(noutot);
-      fBufferRef->SetBufferOffset(0);
-      Streamer(*fBufferRef);         //write key itself again
+      return nout;
+   }
+   fBuffer = fBufferRef->Buffer();
+   return fObjlen;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate the space on file for the key and the nbytes of object data
+/// returned by CompressObject, and write the key header into the output buffer.
+
+void TKey::CreateObjectKey(Int_t nbytes)
+{
+   Create(nbytes);
+   fBufferRef->SetBufferOffset(0);
+   Streamer(*fBufferRef);         //write key itself again
+   if (fBuffer != fBufferRef->Buffer()) {
       memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
       delete fBufferRef; fBufferRef = 0;
-   } else {
-      fBuffer = fBufferRef->Buffer();
-      Create(fObjlen);
-      fBufferRef->SetBufferOffset(0);
-      Streamer(*fBufferRef);         //write key itself again
    }
 }
 
@@ -468,11 +464,10 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
    }
 
    Int_t nsize      = nbytes + fKeylen;
-   TList *lfree     = f->GetListOfFree();
-   TFree *f1        = (TFree*)lfree->First();
+   ROOT::Internal::RFreeSegmentIndex &freeIndex = f->GetFreeIndex();
 //*-*-------------------find free segment
 //*-*                    =================
-   TFree *bestfree  = f1->GetBestFree(lfree,nsize);
+   TFree *bestfree  = freeIndex.GetBestFree(nsize);
    if (bestfree == 0) {
       Error("Create","Cannot allocate %d bytes for ID = %s Title = %s",
             nsize,GetName(),GetTitle());
@@ -487,10 +482,11 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
 //*-*----------------- Case Add at the end of the file
    if (fSeekKey >= f->GetEND()) {
       f->SetEND(fSeekKey+nsize);
-      bestfree->SetFirst(fSeekKey+nsize);
-      if (f->GetEND() > bestfree->GetLast()) {
-         bestfree->SetLast(bestfree->GetLast() + 1000000000);
+      Long64_t last = bestfree->GetLast();
+      if (f->GetEND() > last) {
+         last += 1000000000;
       }
+      freeIndex.Resize(*bestfree, fSeekKey+nsize, last);
       fLeft   = -1;
       if (!fBuffer) fBuffer = new char[nsize];
    } else {
@@ -502,8 +498,7 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
       if (!fBuffer) {
          fBuffer = new char[nsize];
       }
-      lfree->Remove(bestfree);
-      delete bestfree;
+      freeIndex.Remove(bestfree);
    }
 //*-*----------------- Case where new object is placed in a deleted gap larger than itself
    if (fLeft > 0) {    // found a bigger segment
@@ -513,7 +508,7 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
       char *buffer  = fBuffer+nsize;
       Int_t nbytesleft = -fLeft;  // set header of remaining record
       tobuf(buffer, nbytesleft);
-      bestfree->SetFirst(fSeekKey+nsize);
+      freeIndex.Resize(*bestfree, fSeekKey+nsize, bestfree->GetLast());
    }
 
    fSeekPdir = externFile ? externFile->GetSeekDir() : fMotherDir->GetSeekDir();
@@ -817,18 +812,7 @@ TObject *TKey::ReadObj()
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipRecords(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       compressedBuffer.reset(nullptr);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
@@ -942,18 +926,7 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&bufferRead[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipRecords(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
       } else {
@@ -1086,18 +1059,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipRecords(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       if (nout) {
          cl->Streamer((void*)pobj, bufferRef, clOnfile);    //read object
       } else {
@@ -1174,18 +1136,7 @@ Int_t TKey::Read(TObject *obj)
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipRecords(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       if (nout) obj->Streamer(bufferRef);
    } else {
       obj->Streamer(bufferRef);
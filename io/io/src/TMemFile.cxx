@@ -127,6 +127,31 @@ TMemFile::TMemFile(const char *path, const ZeroCopyView_t &datarange)
    Init(/* create */ false);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor to create a TMemFile writing in place into external C-Style
+/// storage, e.g. a shared memory segment. The storage is not owned and the file
+/// cannot grow beyond datarange.fSize; writing past its end fails with ENOSPC.
+/// With option "READ" the range is read as an existing file.
+
+TMemFile::TMemFile(const char *path, const FixedSizeView_t &datarange, Option_t *option, const char *ftitle,
+                   Int_t compress)
+   : TFile(path, "WEB", ftitle, compress),
+     fBlockList(reinterpret_cast<UChar_t *>(datarange.fStart), datarange.fSize), fIsFixedSize(kTRUE),
+     fSize(datarange.fSize), fBlockSeek(&(fBlockList))
+{
+   EMode optmode = ParseOption(option);
+
+   if (!fBlockList.fBuffer) {
+      MakeZombie();
+      gDirectory = gROOT;
+      return;
+   }
+
+   fD = 0;
+   fWritable = NeedsToWrite(optmode);
+   Init(!NeedsExistingFile(optmode));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor to create a TMemFile re-using external storage.
 
@@ -327,6 +352,7 @@ void TMemFile::ResetAfterMerge(TFileMergeInfo *info)
    fMustFlush = kTRUE;
    fInitDone = kFALSE;
 
+   ResetFreeIndex();
    if (fFree) {
       fFree->Delete();
       delete fFree;
@@ -599,11 +625,17 @@ Int_t TMemFile::SysWriteImpl(Int_t /* fd */, const void *buf, Long64_t len)
 {
    TRACE("WRITE")
 
-   if (IsExternalData()) {
+   if (IsExternalData() && !fIsFixedSize) {
       gSystem->SetErrorStr("A memory file with shared data is read-only.");
       return 0;
    }
 
+   if (fIsFixedSize && fSysOffset + len > fSize) {
+      errno = ENOSPC;
+      gSystem->SetErrorStr("The fixed-size memory file is full.");
+      return -1;
+   }
+
    if (fBlockList.fBuffer == 0) {
       errno = EBADF;
       gSystem->SetErrorStr("The memory file is not open.");
@@ -0,0 +1,255 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+\class TSharedMemFile TSharedMemFile.cxx
+\ingroup IO
+
+A TMemFile whose content lives in a POSIX shared memory segment.
+
+The writing process creates the segment and fills it like any other TMemFile:
+~~~{.cpp}
+   TSharedMemFile out("/worker_3", "RECREATE");
+   hist->Write();
+   tree->Write();
+   out.Close();
+~~~
+Once the writer has closed the file, any process on the same host can open the same
+bytes as a read-only file, without copying or deserializing the whole buffer:
+~~~{.cpp}
+   TSharedMemFile in("/worker_3");
+   auto hist = in.Get<TH1>("hist");
+   ...
+   TSharedMemFile::Unlink("/worker_3");
+~~~
+Closing the file does not remove the segment, which remains available until
+TSharedMemFile::Unlink is called, typically by the reader once it is done.
+
+The segment is created with a fixed capacity (256 MB by default, see the
+constructor). Its pages are only allocated when they are written, so the capacity
+may be generous; writing beyond it fails like writing to a full disk.
+
+The segment starts with a small header holding the size of the file. It stays 0
+until the writer has closed the file; readers refuse to open the segment before.
+Writing and reading the file at the same time is not supported.
+*/
+
+#include "TSharedMemFile.h"
+
+#include "TError.h"
+#include "TROOT.h"
+#include "TSystem.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#ifndef R__WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ClassImp(TSharedMemFile);
+
+namespace {
+
+constexpr char kMagic[8] = {'R', 'O', 'O', 'T', 'S', 'H', 'M', 'F'};
+
+/// The header at the start of the segment, followed by the file content
+struct RSegmentHeader {
+   char fMagic[8];
+   std::uint64_t fSegmentSize;
+   /// Size of the file, published by the writer when closing it
+   std::atomic<std::uint64_t> fFileSize;
+};
+
+/// Keeps the file content aligned
+constexpr Long64_t kHeaderSize = 64;
+static_assert(sizeof(RSegmentHeader) <= kHeaderSize, "Segment header too large");
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the leading '/' required for POSIX shared memory names.
+
+TString TSharedMemFile::NormalizeSegmentName(const char *name)
+{
+   TString segmentName(name);
+   if (!segmentName.BeginsWith("/"))
+      segmentName.Prepend("/");
+   return segmentName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create (options "CREATE", "NEW" and "RECREATE") or open (otherwise) the
+/// segment and map it. Returns the range holding the file content, starting
+/// after the segment header, or an empty range in case of failure.
+
+TMemFile::FixedSizeView_t TSharedMemFile::MapSegment(const char *name, Option_t *option, Long64_t capacity)
+{
+   const TString segmentName = NormalizeSegmentName(name);
+   TString opt = option;
+   opt.ToUpper();
+   const bool create = (opt == "CREATE" || opt == "NEW" || opt == "RECREATE");
+   if (!create && opt != "" && opt != "READ") {
+      ::Error("TSharedMemFile", "option %s is not supported, the segment %s is either created or read", option,
+              segmentName.Data());
+      return FixedSizeView_t(nullptr, 0);
+   }
+
+#ifndef R__WIN32
+   if (create) {
+      if (opt == "RECREATE")
+         shm_unlink(segmentName);
+      const Long64_t segmentSize = kHeaderSize + (capacity > 0 ? capacity : fgDefaultCapacity);
+      int fd = shm_open(segmentName, O_RDWR | O_CREAT | O_EXCL, 0644);
+      if (fd < 0) {
+         ::SysError("TSharedMemFile", "cannot create the shared memory segment %s", segmentName.Data());
+         return FixedSizeView_t(nullptr, 0);
+      }
+      if (ftruncate(fd, segmentSize) != 0) {
+         ::SysError("TSharedMemFile", "cannot resize the shared memory segment %s", segmentName.Data());
+         close(fd);
+         shm_unlink(segmentName);
+         return FixedSizeView_t(nullptr, 0);
+      }
+      void *addr = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close(fd);
+      if (addr == MAP_FAILED) {
+         ::SysError("TSharedMemFile", "cannot map the shared memory segment %s", segmentName.Data());
+         shm_unlink(segmentName);
+         return FixedSizeView_t(nullptr, 0);
+      }
+      // The segment is zero-initialized: the file size is 0 until the writer closes the file
+      auto header = new (addr) RSegmentHeader();
+      memcpy(header->fMagic, kMagic, sizeof(kMagic));
+      header->fSegmentSize = segmentSize;
+      return FixedSizeView_t(static_cast<char *>(addr) + kHeaderSize, segmentSize - kHeaderSize);
+   }
+
+   int fd = shm_open(segmentName, O_RDONLY, 0);
+   if (fd < 0) {
+      ::SysError("TSharedMemFile", "cannot open the shared memory segment %s", segmentName.Data());
+      return FixedSizeView_t(nullptr, 0);
+   }
+   struct stat info;
+   if (fstat(fd, &info) != 0 || info.st_size < kHeaderSize) {
+      ::Error("TSharedMemFile", "%s is not a shared memory file", segmentName.Data());
+      close(fd);
+      return FixedSizeView_t(nullptr, 0);
+   }
+   // Mapping the whole segment does not read it: only the pages that are accessed are touched
+   void *addr = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED) {
+      ::SysError("TSharedMemFile", "cannot map the shared memory segment %s", segmentName.Data());
+      return FixedSizeView_t(nullptr, 0);
+   }
+   auto header = static_cast<RSegmentHeader *>(addr);
+   const std::uint64_t fileSize = header->fFileSize.load(std::memory_order_acquire);
+   if (memcmp(header->fMagic, kMagic, sizeof(kMagic)) != 0 || header->fSegmentSize != std::uint64_t(info.st_size)) {
+      ::Error("TSharedMemFile", "%s is not a shared memory file", segmentName.Data());
+   } else if (fileSize == 0) {
+      ::Error("TSharedMemFile", "the shared memory file %s has not been closed by its writer", segmentName.Data());
+   } else if (fileSize > std::uint64_t(info.st_size - kHeaderSize)) {
+      ::Error("TSharedMemFile", "the shared memory file %s is corrupted", segmentName.Data());
+   } else {
+      return FixedSizeView_t(static_cast<char *>(addr) + kHeaderSize, fileSize);
+   }
+   munmap(addr, info.st_size);
+#else
+   (void)capacity;
+   ::Error("TSharedMemFile", "shared memory files are not supported on this platform");
+#endif
+   return FixedSizeView_t(nullptr, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Usual constructor.
+///
+/// With option "CREATE" (or "NEW") a new shared memory segment called name is
+/// created, "RECREATE" replaces an existing segment. The created segment can
+/// hold a file of at most capacity bytes; 0 selects the default of 256 MB.
+///
+/// Otherwise ("READ" or ""), the existing segment is opened read-only; this
+/// requires that its writer has closed the file.
+///
+/// Shared memory names start with a '/', which is prepended if missing.
+
+TSharedMemFile::TSharedMemFile(const char *name, Option_t *option, const char *ftitle, Int_t compress,
+                               Long64_t capacity)
+   : TMemFile(name, MapSegment(name, option, capacity), option, ftitle, compress),
+     fSegmentName(NormalizeSegmentName(name))
+{
+   if (fBlockList.fBuffer) {
+      fSegment = fBlockList.fBuffer - kHeaderSize;
+      fSegmentSize = static_cast<RSegmentHeader *>(fSegment)->fSegmentSize;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Close the file and unmap the segment. The segment itself is kept, see Unlink().
+
+TSharedMemFile::~TSharedMemFile()
+{
+   // Close while the segment is still mapped, ~TMemFile would be too late
+   Close();
+#ifndef R__WIN32
+   if (fSegment)
+      munmap(fSegment, fSegmentSize);
+#endif
+   fSegment = nullptr;
+   // Make ~TMemFile forget about the unmapped block
+   fBlockList.fBuffer = nullptr;
+   fBlockList.fSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Publish the size of the file to the readers when the writer closes it.
+
+Int_t TSharedMemFile::SysClose(Int_t fd)
+{
+   if (fSegment && fWritable && !TestBit(kWriteError)) {
+      static_cast<RSegmentHeader *>(fSegment)->fFileSize.store(fEND, std::memory_order_release);
+      // The file does not grow anymore
+      fSize = fEND;
+   }
+   return TMemFile::SysClose(fd);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the size of the file, not the capacity of the segment.
+
+Long64_t TSharedMemFile::GetSize() const
+{
+   return fWritable ? fEND : fSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the shared memory segment name. The memory is released once the
+/// processes that have it mapped have unmapped it. Returns kFALSE in case of failure.
+
+Bool_t TSharedMemFile::Unlink(const char *name)
+{
+#ifndef R__WIN32
+   const TString segmentName = NormalizeSegmentName(name);
+   if (shm_unlink(segmentName) != 0) {
+      ::SysError("TSharedMemFile::Unlink", "cannot remove the shared memory segment %s", segmentName.Data());
+      return kFALSE;
+   }
+   return kTRUE;
+#else
+   (void)name;
+   return kFALSE;
+#endif
+}
@@ -2024,12 +2024,11 @@ namespace TStreamerInfoActions
             buf.ReadInt(nvalues);
             vec->resize(nvalues);
 
-            From *temp = new From[nvalues];
+            From *temp = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArray(temp, nvalues);
             for(Int_t ind = 0; ind < nvalues; ++ind) {
                (*vec)[ind] = (To)temp[ind];
             }
-            delete [] temp;
 
             buf.CheckByteCount(start,count,config->fTypeName);
             return 0;
@@ -2051,12 +2050,11 @@ namespace TStreamerInfoActions
             buf.ReadInt(nvalues);
             vec->resize(nvalues);
 
-            From *temp = new From[nvalues];
+            From *temp = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArrayWithNbits(temp, nvalues, 0);
             for(Int_t ind = 0; ind < nvalues; ++ind) {
                (*vec)[ind] = (To)temp[ind];
             }
-            delete [] temp;
 
             buf.CheckByteCount(start,count,config->fTypeName);
             return 0;
@@ -2077,12 +2075,11 @@ namespace TStreamerInfoActions
          buf.ReadInt(nvalues);
          vec->resize(nvalues);
 
-         Double32_t *temp = new Double32_t[nvalues];
+         Double32_t *temp = GetConversionBuffer<Double32_t>(nvalues);
          buf.ReadFastArrayDouble32(temp, nvalues);
          for(Int_t ind = 0; ind < nvalues; ++ind) {
             (*vec)[ind] = (To)temp[ind];
          }
-         delete [] temp;
 
          buf.CheckByteCount(start,count,config->fTypeName);
          return 0;
@@ -2301,13 +2298,12 @@ namespace TStreamerInfoActions
       struct ConvertRead {
          static INLINE_TEMPLATE_ARGS void Action(TBuffer &buf, void *addr, Int_t nvalues)
          {
-            From *temp = new From[nvalues];
+            From *temp = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArray(temp, nvalues);
             To *vec = (To*)addr;
             for(Int_t ind = 0; ind < nvalues; ++ind) {
                vec[ind] = (To)temp[ind];
             }
-            delete [] temp;
          }
       };
 
@@ -2315,13 +2311,12 @@ namespace TStreamerInfoActions
       struct ConvertRead<NoFactorMarker<From>,To> {
          static INLINE_TEMPLATE_ARGS void Action(TBuffer &buf, void *addr, Int_t nvalues)
          {
-            From *temp = new From[nvalues];
+            From *temp = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArrayWithNbits(temp, nvalues,0);
             To *vec = (To*)addr;
             for(Int_t ind = 0; ind < nvalues; ++ind) {
                vec[ind] = (To)temp[ind];
             }
-            delete [] temp;
          }
       };
 
@@ -2329,14 +2324,13 @@ namespace TStreamerInfoActions
       struct ConvertRead<WithFactorMarker<From>,To> {
          static INLINE_TEMPLATE_ARGS void Action(TBuffer &buf, void *addr, Int_t nvalues)
          {
-            From *temp = new From[nvalues];
+            From *temp = GetConversionBuffer<From>(nvalues);
             double factor,min; // needs to be initialized.
             buf.ReadFastArrayWithFactor(temp, nvalues, factor, min);
             To *vec = (To*)addr;
             for(Int_t ind = 0; ind < nvalues; ++ind) {
                vec[ind] = (To)temp[ind];
             }
-            delete [] temp;
          }
       };
 
@@ -2467,10 +2461,9 @@ namespace TStreamerInfoActions
             TVirtualCollectionProxy *proxy = loopconfig->fProxy;
             Int_t nvalues = proxy->Size();
 
-            From *items = new From[nvalues];
+            From *items = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArray(items, nvalues);
             Converter<From,To>::ConvertAction(items,start,end,loopconfig,config);
-            delete [] items;
             return 0;
          }
       };
@@ -2524,10 +2517,9 @@ namespace TStreamerInfoActions
 
             TConfSTLWithFactor *conf = (TConfSTLWithFactor *)config;
 
-            From *items = new From[nvalues];
+            From *items = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArrayWithFactor(items, nvalues, conf->fFactor, conf->fXmin);
             Converter<From,To>::ConvertAction(items,start,end,loopconfig,config);
-            delete [] items;
             return 0;
          }
       };
@@ -2544,10 +2536,9 @@ namespace TStreamerInfoActions
 
             TConfSTLNoFactor *conf = (TConfSTLNoFactor *)config;
 
-            From *items = new From[nvalues];
+            From *items = GetConversionBuffer<From>(nvalues);
             buf.ReadFastArrayWithNbits(items, nvalues, conf->fNbits);
             Converter<From,To>::ConvertAction(items,start,end,loopconfig,config);
-            delete [] items;
             return 0;
          }
       };
@@ -3040,23 +3031,10 @@ void TStreamerInfo::Compile()
    if (fWriteObjectWise) fWriteObjectWise->fActions.clear();
    else fWriteObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fReadMemberWise) fReadMemberWise->fActions.clear();
-   else fReadMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
-
-   if (fReadText) fReadText->fActions.clear();
-   else fReadText = new TStreamerInfoActions::TActionSequence(this,ndata);
-
-   if (fWriteMemberWise) fWriteMemberWise->fActions.clear();
-   else fWriteMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
-
-   if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->fActions.clear();
-   else fReadMemberWiseVecPtr = new TStreamerInfoActions::TActionSequence(this, ndata, kTRUE);
-
-   if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->fActions.clear();
-   else fWriteMemberWiseVecPtr = new TStreamerInfoActions::TActionSequence(this, ndata, kTRUE);
-
-   if (fWriteText) fWriteText->fActions.clear();
-   else fWriteText = new TStreamerInfoActions::TActionSequence(this,ndata);
+   // The member wise and text sequences are only needed for a fraction of the classes;
+   // they are built on first use by BuildMemberWiseActions and BuildTextActions.
+   fMemberWiseActionsBuilt = kFALSE;
+   fTextActionsBuilt = kFALSE;
 
    if (!ndata) {
       // This may be the case for empty classes (e.g., TAtt3D).
@@ -3219,7 +3197,45 @@ void TStreamerInfo::Compile()
       AddReadAction(fReadObjectWise, i, fCompOpt[i]);
       AddWriteAction(fWriteObjectWise, i, fCompOpt[i]);
    }
-   for (i = 0; i < fNfulldata; ++i) {
+   ComputeSize();
+
+   fOptimized = isOptimized;
+   SetIsCompiled();
+
+   if (gDebug > 0) {
+      ls();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the member wise read and write action sequences, both for objects and
+/// for collections of pointers, from the result of Compile.
+/// Most classes are only ever streamed object wise, so this is deferred from
+/// Compile until one of the sequences is requested.
+
+void TStreamerInfo::BuildMemberWiseActions()
+{
+   if (!IsCompiled())
+      return;
+   R__LOCKGUARD(gInterpreterMutex);
+   if (fMemberWiseActionsBuilt)
+      return;
+
+   Int_t ndata = fElements->GetEntriesFast();
+
+   if (fReadMemberWise) fReadMemberWise->fActions.clear();
+   else fReadMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
+
+   if (fWriteMemberWise) fWriteMemberWise->fActions.clear();
+   else fWriteMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
+
+   if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->fActions.clear();
+   else fReadMemberWiseVecPtr = new TStreamerInfoActions::TActionSequence(this, ndata, kTRUE);
+
+   if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->fActions.clear();
+   else fWriteMemberWiseVecPtr = new TStreamerInfoActions::TActionSequence(this, ndata, kTRUE);
+
+   for (Int_t i = 0; i < fNfulldata; ++i) {
       if (!fCompFull[i]->fElem || fCompFull[i]->fElem->GetType()< 0) {
          continue;
       }
@@ -3227,18 +3243,38 @@ void TStreamerInfo::Compile()
       AddWriteAction(fWriteMemberWise, i, fCompFull[i]);
       AddReadMemberWiseVecPtrAction(fReadMemberWiseVecPtr, i, fCompFull[i]);
       AddWriteMemberWiseVecPtrAction(fWriteMemberWiseVecPtr, i, fCompFull[i]);
-
-      AddReadTextAction(fReadText, i, fCompFull[i]);
-      AddWriteTextAction(fWriteText, i, fCompFull[i]);
    }
-   ComputeSize();
+   fMemberWiseActionsBuilt = kTRUE;
+}
 
-   fOptimized = isOptimized;
-   SetIsCompiled();
+////////////////////////////////////////////////////////////////////////////////
+/// Create the text read and write action sequences, used by TBufferText, from
+/// the result of Compile.  Deferred from Compile until first requested.
 
-   if (gDebug > 0) {
-      ls();
+void TStreamerInfo::BuildTextActions()
+{
+   if (!IsCompiled())
+      return;
+   R__LOCKGUARD(gInterpreterMutex);
+   if (fTextActionsBuilt)
+      return;
+
+   Int_t ndata = fElements->GetEntriesFast();
+
+   if (fReadText) fReadText->fActions.clear();
+   else fReadText = new TStreamerInfoActions::TActionSequence(this,ndata);
+
+   if (fWriteText) fWriteText->fActions.clear();
+   else fWriteText = new TStreamerInfoActions::TActionSequence(this,ndata);
+
+   for (Int_t i = 0; i < fNfulldata; ++i) {
+      if (!fCompFull[i]->fElem || fCompFull[i]->fElem->GetType()< 0) {
+         continue;
+      }
+      AddReadTextAction(fReadText, i, fCompFull[i]);
+      AddWriteTextAction(fWriteText, i, fCompFull[i]);
    }
+   fTextActionsBuilt = kTRUE;
 }
 
 template <typename From>
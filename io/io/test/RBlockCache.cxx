@@ -0,0 +1,189 @@
+#include "ROOT/RBlockCache.hxx"
+#include "ROOT/RRawFile.hxx"
+
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using RBlockCache = ROOT::Internal::RBlockCache;
+using RRawFile = ROOT::Internal::RRawFile;
+using RRawFileBlockCache = ROOT::Internal::RRawFileBlockCache;
+
+namespace {
+
+/// Creates a fresh cache directory and removes it at the end of the test
+class RCacheDirGuard {
+   std::string fPath;
+
+public:
+   explicit RCacheDirGuard(const std::string &name)
+      : fPath(std::string(gSystem->TempDirectory()) + "/" + name + "_" + std::to_string(gSystem->GetPid()))
+   {
+      gSystem->Exec(("rm -rf " + fPath).c_str());
+   }
+   ~RCacheDirGuard() { gSystem->Exec(("rm -rf " + fPath).c_str()); }
+   const std::string &GetPath() const { return fPath; }
+};
+
+/// The content of the remote file, bytes 0, 1, ..., 255, 0, 1, ...
+std::vector<unsigned char> MakeContent(std::size_t size)
+{
+   std::vector<unsigned char> content(size);
+   for (std::size_t i = 0; i < size; ++i)
+      content[i] = i % 256;
+   return content;
+}
+
+/// Serves the fetch requests of the cache from content and counts the fetched bytes
+struct RFakeRemote {
+   const std::vector<unsigned char> &fContent;
+   std::uint64_t fNBytesFetched = 0;
+
+   void operator()(RRawFile::RIOVec *ioVec, unsigned int nReq)
+   {
+      for (unsigned int i = 0; i < nReq; ++i) {
+         std::copy(fContent.begin() + ioVec[i].fOffset, fContent.begin() + ioVec[i].fOffset + ioVec[i].fSize,
+                   static_cast<unsigned char *>(ioVec[i].fBuffer));
+         ioVec[i].fOutBytes = ioVec[i].fSize;
+         fNBytesFetched += ioVec[i].fSize;
+      }
+   }
+};
+
+std::uint64_t GetDirectorySize(const std::string &path)
+{
+   std::uint64_t size = 0;
+   void *dirp = gSystem->OpenDirectory(path.c_str());
+   if (!dirp)
+      return 0;
+   while (const char *name = gSystem->GetDirEntry(dirp)) {
+      if (name[0] == '.')
+         continue;
+      const std::string entry = path + "/" + name;
+      FileStat_t stat;
+      gSystem->GetPathInfo(entry.c_str(), stat);
+      size += R_ISDIR(stat.fMode) ? GetDirectorySize(entry) : stat.fSize;
+   }
+   gSystem->FreeDirectory(dirp);
+   return size;
+}
+
+} // anonymous namespace
+
+TEST(RBlockCache, ReadV)
+{
+   RCacheDirGuard dir("rblockcache_readv");
+   const std::size_t blockSize = 1024;
+   RBlockCache cache(dir.GetPath(), 1024 * 1024, blockSize);
+   // The last block is short
+   const auto content = MakeContent(10 * blockSize + 100);
+   RFakeRemote remote{content};
+
+   unsigned char buffer[3][2000];
+   RRawFile::RIOVec ioVec[3];
+   // Within a block, across a block boundary, and beyond the end of the file
+   const std::uint64_t offsets[] = {10, 3 * blockSize - 5, 10 * blockSize + 50};
+   const std::size_t sizes[] = {100, 2000, 1000};
+   for (int i = 0; i < 3; ++i) {
+      ioVec[i].fBuffer = buffer[i];
+      ioVec[i].fOffset = offsets[i];
+      ioVec[i].fSize = sizes[i];
+   }
+
+   auto check = [&]() {
+      EXPECT_EQ(100u, ioVec[0].fOutBytes);
+      EXPECT_EQ(2000u, ioVec[1].fOutBytes);
+      EXPECT_EQ(50u, ioVec[2].fOutBytes);
+      for (int i = 0; i < 3; ++i) {
+         for (std::size_t j = 0; j < ioVec[i].fOutBytes; ++j)
+            ASSERT_EQ(content[offsets[i] + j], buffer[i][j]);
+      }
+   };
+
+   cache.ReadV("file", content.size(), ioVec, 3, std::ref(remote));
+   check();
+   // Blocks 0, 2, 3, 4, and the short block 10
+   EXPECT_EQ(4 * blockSize + 100, remote.fNBytesFetched);
+   EXPECT_EQ(0u, cache.GetNHits());
+   EXPECT_EQ(5u, cache.GetNMisses());
+
+   for (int i = 0; i < 3; ++i)
+      memset(buffer[i], 0, sizeof(buffer[i]));
+   cache.ReadV("file", content.size(), ioVec, 3, std::ref(remote));
+   check();
+   EXPECT_EQ(4 * blockSize + 100, remote.fNBytesFetched);
+   EXPECT_EQ(5u, cache.GetNHits());
+
+   // Another cache on the same directory, e.g. in another process, finds the blocks but not those of other files
+   RBlockCache otherCache(dir.GetPath(), 1024 * 1024, blockSize);
+   otherCache.ReadV("file", content.size(), ioVec, 1, std::ref(remote));
+   EXPECT_EQ(1u, otherCache.GetNHits());
+   otherCache.ReadV("other", content.size(), ioVec, 1, std::ref(remote));
+   EXPECT_EQ(1u, otherCache.GetNMisses());
+}
+
+TEST(RBlockCache, CleanUp)
+{
+   RCacheDirGuard dir("rblockcache_cleanup");
+   const std::size_t blockSize = 1024;
+   const std::uint64_t maxSize = 20 * blockSize;
+   RBlockCache cache(dir.GetPath(), maxSize, blockSize);
+   const auto content = MakeContent(100 * blockSize);
+   RFakeRemote remote{content};
+
+   std::vector<unsigned char> buffer(blockSize);
+   for (std::size_t b = 0; b < 100; ++b) {
+      RRawFile::RIOVec ioVec;
+      ioVec.fBuffer = buffer.data();
+      ioVec.fOffset = b * blockSize;
+      ioVec.fSize = blockSize;
+      cache.ReadV("file", content.size(), &ioVec, 1, std::ref(remote));
+      ASSERT_EQ(blockSize, ioVec.fOutBytes);
+      EXPECT_LE(GetDirectorySize(dir.GetPath()), maxSize + maxSize / 10);
+   }
+   cache.CleanUp();
+   EXPECT_LE(GetDirectorySize(dir.GetPath()), maxSize);
+   EXPECT_GT(GetDirectorySize(dir.GetPath()), 0u);
+}
+
+TEST(RBlockCache, RawFile)
+{
+   RCacheDirGuard dir("rblockcache_rawfile");
+   const auto fileName = "rblockcache_rawfile.dat";
+   const auto content = MakeContent(5000);
+   {
+      std::ofstream out(fileName, std::ios::binary);
+      out.write(reinterpret_cast<const char *>(content.data()), content.size());
+   }
+   auto cache = std::make_shared<RBlockCache>(dir.GetPath(), 1024 * 1024, 1024);
+
+   RRawFileBlockCache file(RRawFile::Create(fileName), cache);
+   EXPECT_EQ(content.size(), file.GetSize());
+   unsigned char buffer[1500];
+   EXPECT_EQ(1500u, file.ReadAt(buffer, 1500, 1000));
+   EXPECT_EQ(content[1000], buffer[0]);
+   EXPECT_EQ(content[2499], buffer[1499]);
+   EXPECT_EQ(0u, cache->GetNHits());
+
+   auto clone = file.Clone();
+   RRawFile::RIOVec ioVec;
+   ioVec.fBuffer = buffer;
+   ioVec.fOffset = 4500;
+   ioVec.fSize = 1000;
+   clone->ReadV(&ioVec, 1);
+   EXPECT_EQ(500u, ioVec.fOutBytes);
+   EXPECT_EQ(content[4500], buffer[0]);
+   EXPECT_EQ(content[4999], buffer[499]);
+   EXPECT_EQ(1000u, clone->ReadAt(buffer, 1000, 1200));
+   EXPECT_EQ(content[1200], buffer[0]);
+   // Blocks 1 and 2 were read before by the original file
+   EXPECT_EQ(2u, cache->GetNHits());
+
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,91 @@
+#include "ROOT/RIOMetrics.hxx"
+
+#include "TFile.h"
+#include "TNamed.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using RIOMetrics = ROOT::Experimental::RIOMetrics;
+
+TEST(RIOMetrics, Disabled)
+{
+   RIOMetrics::Enable(false);
+   RIOMetrics::Reset();
+   RIOMetrics::Add(RIOMetrics::kBytesRead, 100);
+   {
+      RIOMetrics::RTimer timer(RIOMetrics::kUnzipTime);
+   }
+   for (auto value : RIOMetrics::GetValues())
+      EXPECT_EQ(0u, value);
+}
+
+TEST(RIOMetrics, Threads)
+{
+   RIOMetrics::Enable();
+   RIOMetrics::Reset();
+
+   // The counters of finished threads are kept
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 4; ++i) {
+      threads.emplace_back([] {
+         for (int j = 0; j < 1000; ++j) {
+            RIOMetrics::Add(RIOMetrics::kBytesRead, 10);
+            RIOMetrics::Add(RIOMetrics::kReadCalls, 1);
+         }
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   RIOMetrics::Add(RIOMetrics::kVectorReads, 3);
+
+   auto values = RIOMetrics::GetValues();
+   EXPECT_EQ(40000u, values[RIOMetrics::kBytesRead]);
+   EXPECT_EQ(4000u, values[RIOMetrics::kReadCalls]);
+   EXPECT_EQ(3u, values[RIOMetrics::kVectorReads]);
+   EXPECT_EQ(0u, values[RIOMetrics::kCacheHits]);
+
+   EXPECT_NE(std::string::npos, RIOMetrics::ToJSON().find("\"bytesRead\": 40000,"));
+   const auto prometheus = RIOMetrics::ToPrometheus();
+   EXPECT_NE(std::string::npos, prometheus.find("# TYPE root_io_read_calls_total counter\n"));
+   EXPECT_NE(std::string::npos, prometheus.find("\nroot_io_vector_reads_total 3\n"));
+
+   RIOMetrics::Reset();
+   for (auto value : RIOMetrics::GetValues())
+      EXPECT_EQ(0u, value);
+   RIOMetrics::Enable(false);
+}
+
+TEST(RIOMetrics, TFile)
+{
+   const std::string fileName = "RIOMetrics_TFile.root";
+   {
+      auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "RECREATE"));
+      TNamed named("named", std::string(10000, 'x').c_str());
+      named.Write();
+   }
+
+   RIOMetrics::Enable();
+   RIOMetrics::Reset();
+   {
+      auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str()));
+      ASSERT_TRUE(f);
+      auto named = f->Get<TNamed>("named");
+      ASSERT_NE(nullptr, named);
+      EXPECT_EQ(10000u, strlen(named->GetTitle()));
+      delete named;
+   }
+   const auto values = RIOMetrics::GetValues();
+   RIOMetrics::Enable(false);
+   gSystem->Unlink(fileName.c_str());
+
+   EXPECT_GT(values[RIOMetrics::kReadCalls], 0u);
+   EXPECT_GT(values[RIOMetrics::kBytesRead], 0u);
+   EXPECT_GE(values[RIOMetrics::kBytesRequested], values[RIOMetrics::kBytesRead]);
+}
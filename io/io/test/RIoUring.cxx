@@ -43,6 +43,43 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RIoUring, SubmitReadsAsync)
+{
+   auto file = "test_uring_async";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   RRawFileUnix f(file, RRawFile::ROptions());
+   auto size = f.GetSize();
+
+   RIoUring ring(16);
+   // More requests than the queue depth, split into two interleaved batches
+   unsigned int nReads = 3 * ring.GetQueueDepth();
+   auto iovecs = make_iovecs(2 * nReads, size);
+   std::vector<RIoUring::RReadEvent> reads(2 * nReads);
+   for (std::size_t i = 0; i < reads.size(); ++i) {
+      reads[i].fBuffer = iovecs[i].fBuffer;
+      reads[i].fOffset = iovecs[i].fOffset;
+      reads[i].fSize = iovecs[i].fSize;
+      reads[i].fFileDes = f.GetFd();
+   }
+
+   ring.SubmitReads(reads.data(), nReads);
+   ring.SubmitReads(reads.data() + nReads, nReads);
+   EXPECT_LE(ring.GetNInFlight(), ring.GetQueueDepth());
+   ring.WaitForReads(reads.data() + nReads, nReads);
+   ring.WaitForReads(reads.data(), nReads);
+   EXPECT_EQ(0U, ring.GetNInFlight());
+
+   for (std::size_t i = 0; i < reads.size(); ++i) {
+      EXPECT_TRUE(reads[i].fIsDone);
+      EXPECT_EQ(std::min<std::uint64_t>(reads[i].fSize, size - reads[i].fOffset), reads[i].fOutBytes);
+      for (std::size_t j = 0; j < reads[i].fOutBytes; ++j) {
+         EXPECT_EQ('a', ((unsigned char*)reads[i].fBuffer)[j]);
+      }
+      free(iovecs[i].fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
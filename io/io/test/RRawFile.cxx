@@ -138,6 +138,41 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   char buffer[4];
+   memset(buffer, 0, sizeof(buffer));
+   RRawFile::RIOVec iovecA[2];
+   iovecA[0].fBuffer = &buffer[0];
+   iovecA[0].fOffset = 0;
+   iovecA[0].fSize = 1;
+   iovecA[1].fBuffer = &buffer[1];
+   iovecA[1].fOffset = 11;
+   iovecA[1].fSize = 2;
+   RRawFile::RIOVec iovecB[1];
+   iovecB[0].fBuffer = &buffer[2];
+   iovecB[0].fOffset = 7;
+   iovecB[0].fSize = 2;
+
+   // Two vector reads in flight at the same time, waited for in reverse order
+   f->ReadVAsync(iovecA, 2);
+   f->ReadVAsync(iovecB, 1);
+   f->WaitReadV(iovecB, 1);
+   f->WaitReadV(iovecA, 2);
+
+   EXPECT_EQ(1U, iovecA[0].fOutBytes);
+   EXPECT_EQ(1U, iovecA[1].fOutBytes);
+   EXPECT_EQ(2U, iovecB[0].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('d', buffer[1]);
+   EXPECT_EQ('W', buffer[2]);
+   EXPECT_EQ('o', buffer[3]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
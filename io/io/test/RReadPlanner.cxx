@@ -0,0 +1,83 @@
+#include "ROOT/RReadPlanner.hxx"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using RReadPlanner = ROOT::Internal::RReadPlanner;
+
+TEST(RReadPlanner, Empty)
+{
+   auto plan = RReadPlanner::Plan(std::vector<RReadPlanner::RRange>(), RReadPlanner::RSettings());
+   EXPECT_TRUE(plan.fRequests.empty());
+   EXPECT_EQ(0u, plan.fBufferSize);
+}
+
+TEST(RReadPlanner, Gaps)
+{
+   // Gaps of 0, 10, and 100 bytes between ranges of 100 bytes each
+   std::vector<RReadPlanner::RRange> ranges{{0, 100}, {100, 100}, {210, 100}, {410, 100}};
+
+   RReadPlanner::RSettings settings;
+   settings.fMaxOverheadFraction = -1;
+   settings.fMaxGap = 0;
+   auto plan = RReadPlanner::Plan(ranges, settings);
+   ASSERT_EQ(3u, plan.fRequests.size());
+   EXPECT_EQ(0u, plan.fRequests[0].fOffset);
+   EXPECT_EQ(200u, plan.fRequests[0].fSize);
+   EXPECT_EQ(2u, plan.fRequests[0].fNRanges);
+   EXPECT_EQ(200u, plan.fRequests[1].fBufferOffset);
+   EXPECT_EQ(400u, plan.fSzPayload);
+   EXPECT_EQ(0u, plan.fSzOverhead);
+   EXPECT_EQ(400u, plan.fBufferSize);
+   EXPECT_EQ(std::vector<std::uint64_t>({0, 100, 200, 300}), plan.fRangeBufferOffsets);
+
+   // 10% of 400 bytes allow for the 10 bytes gap but not the 100 bytes gap
+   settings.fMaxGap = std::uint64_t(-1);
+   settings.fMaxOverheadFraction = 0.1;
+   plan = RReadPlanner::Plan(ranges, settings);
+   ASSERT_EQ(2u, plan.fRequests.size());
+   EXPECT_EQ(310u, plan.fRequests[0].fSize);
+   EXPECT_EQ(3u, plan.fRequests[0].fNRanges);
+   EXPECT_EQ(410u, plan.fRequests[1].fOffset);
+   EXPECT_EQ(3u, plan.fRequests[1].fFirstRange);
+   EXPECT_EQ(10u, plan.fSzOverhead);
+   EXPECT_EQ(std::vector<std::uint64_t>({0, 100, 210, 310}), plan.fRangeBufferOffsets);
+
+   settings.fMaxOverheadFraction = 1.0;
+   plan = RReadPlanner::Plan(ranges, settings);
+   ASSERT_EQ(1u, plan.fRequests.size());
+   EXPECT_EQ(510u, plan.fRequests[0].fSize);
+   EXPECT_EQ(510u, plan.fBufferSize);
+}
+
+TEST(RReadPlanner, MaxRequestSize)
+{
+   std::vector<RReadPlanner::RRange> ranges{{0, 100}, {100, 100}, {200, 250}, {450, 50}};
+
+   RReadPlanner::RSettings settings;
+   settings.fMaxRequestSize = 200;
+   auto plan = RReadPlanner::Plan(ranges, settings);
+   ASSERT_EQ(3u, plan.fRequests.size());
+   EXPECT_EQ(200u, plan.fRequests[0].fSize);
+   EXPECT_EQ(250u, plan.fRequests[1].fSize);
+   EXPECT_EQ(50u, plan.fRequests[2].fSize);
+
+   settings.fSplitLargeRanges = true;
+   plan = RReadPlanner::Plan(ranges, settings);
+   ASSERT_EQ(4u, plan.fRequests.size());
+   EXPECT_EQ(200u, plan.fRequests[1].fOffset);
+   EXPECT_EQ(200u, plan.fRequests[1].fSize);
+   EXPECT_EQ(400u, plan.fRequests[2].fOffset);
+   EXPECT_EQ(50u, plan.fRequests[2].fSize);
+   EXPECT_EQ(2u, plan.fRequests[2].fFirstRange);
+   EXPECT_EQ(450u, plan.fRequests[3].fOffset);
+   EXPECT_EQ(std::vector<std::uint64_t>({0, 100, 200, 450}), plan.fRangeBufferOffsets);
+}
+
+TEST(RReadPlanner, Transport)
+{
+   EXPECT_EQ(0u, RReadPlanner::RSettings::GetForTransport("file").fMaxRequestSize);
+   EXPECT_GT(RReadPlanner::RSettings::GetForTransport("root").fMaxRequestSize, 0u);
+   EXPECT_TRUE(RReadPlanner::RSettings::GetForTransport("root").fSplitLargeRanges);
+}
@@ -2,6 +2,13 @@
 
 #include "TBufferFile.h"
 #include "TClass.h"
+#include "TNamed.h"
+#include "TObjArray.h"
+#include "TString.h"
+#include "TVirtualCollectionProxy.h"
+
+#include <memory>
+#include <string>
 #include <vector>
 #include <iostream>
 
@@ -26,3 +33,93 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+TEST(TBufferFile, Segments)
+{
+   std::vector<double> v(1000);
+   for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = 0.5 * i;
+   TObjArray arr;
+   arr.SetOwner();
+   for (int i = 0; i < 20; ++i)
+      arr.Add(new TNamed(TString::Format("name%d", i), TString(i * 10, 'x')));
+
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf << 42;
+   wbuf.WriteObjectAny(&v, TClass::GetClass("vector<double>"));
+   wbuf.WriteObject(&arr);
+   TString str(300, 'y');
+   wbuf << str;
+   const Int_t size = wbuf.Length();
+
+   // Segments of different sizes cut integers, arrays, strings and byte counts
+   for (Int_t segmentSize : {1, 3, 16, 333, 4096, size}) {
+      std::vector<std::vector<char>> storage;
+      std::vector<TBufferFile::RSegment> segments;
+      storage.reserve(size / segmentSize + 1);
+      for (Int_t offset = 0; offset < size; offset += segmentSize) {
+         const Int_t n = std::min(segmentSize, size - offset);
+         storage.emplace_back(wbuf.Buffer() + offset, wbuf.Buffer() + offset + n);
+         segments.push_back({storage.back().data(), n});
+         // Empty segments are skipped
+         segments.push_back({nullptr, 0});
+      }
+
+      TBufferFile rbuf(TBuffer::kRead, segments);
+      EXPECT_TRUE(rbuf.IsSegmented());
+      EXPECT_EQ(size, rbuf.BufferSize());
+      int i = 0;
+      rbuf >> i;
+      EXPECT_EQ(42, i);
+      std::unique_ptr<std::vector<double>> readv(
+         static_cast<std::vector<double> *>(rbuf.ReadObjectAny(TClass::GetClass("vector<double>"))));
+      ASSERT_TRUE(readv != nullptr);
+      EXPECT_EQ(v, *readv);
+      std::unique_ptr<TObjArray> readArr(static_cast<TObjArray *>(rbuf.ReadObject(TObjArray::Class())));
+      ASSERT_TRUE(readArr != nullptr);
+      readArr->SetOwner();
+      ASSERT_EQ(arr.GetEntries(), readArr->GetEntries());
+      for (int j = 0; j < arr.GetEntries(); ++j) {
+         EXPECT_STREQ(arr.At(j)->GetName(), readArr->At(j)->GetName());
+         EXPECT_STREQ(arr.At(j)->GetTitle(), readArr->At(j)->GetTitle());
+      }
+      TString readStr;
+      rbuf >> readStr;
+      EXPECT_EQ(str, readStr);
+      EXPECT_EQ(size, rbuf.Length());
+
+      // Seeking back across segments
+      rbuf.SetBufferOffset(0);
+      rbuf >> i;
+      EXPECT_EQ(42, i);
+      rbuf.SetBufferOffset(size - readStr.Length());
+      char c = 0;
+      rbuf >> c;
+      EXPECT_EQ('y', c);
+   }
+}
+
+// The vectors and RVecs advertise that their elements are contiguous and are streamed through their storage
+TEST(TBufferFile, ContiguousCollections)
+{
+   auto properties = [](const char *name) { return TClass::GetClass(name)->GetCollectionProxy()->GetProperties(); };
+   EXPECT_TRUE(properties("vector<int>") & TVirtualCollectionProxy::kIsContiguous);
+   EXPECT_TRUE(properties("vector<string>") & TVirtualCollectionProxy::kIsContiguous);
+   EXPECT_FALSE(properties("vector<bool>") & TVirtualCollectionProxy::kIsContiguous);
+   EXPECT_FALSE(properties("list<int>") & TVirtualCollectionProxy::kIsContiguous);
+
+   std::vector<std::string> v{"a", "bb", "", "dddd"};
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteObjectAny(&v, TClass::GetClass("vector<string>"));
+   wbuf.SetReadMode();
+   wbuf.Reset();
+   std::unique_ptr<std::vector<std::string>> readv(
+      static_cast<std::vector<std::string> *>(wbuf.ReadObjectAny(TClass::GetClass("vector<string>"))));
+   ASSERT_TRUE(readv != nullptr);
+   EXPECT_EQ(v, *readv);
+
+   TClass *rvecClass = TClass::GetClass("ROOT::VecOps::RVec<float>");
+   if (!rvecClass || !rvecClass->GetCollectionProxy())
+      return;
+   EXPECT_TRUE(rvecClass->GetCollectionProxy()->GetProperties() & TVirtualCollectionProxy::kIsContiguous);
+}
@@ -1,5 +1,10 @@
 #include "TBufferJSON.h"
 #include "TNamed.h"
+#include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -47,3 +52,58 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// the text and member wise action sequences are only created when first requested
+TEST(TBufferJSON, ActionsOnDemand)
+{
+   auto info = dynamic_cast<TStreamerInfo *>(TNamed::Class()->GetStreamerInfo());
+   ASSERT_NE(info, nullptr);
+   ASSERT_TRUE(info->IsCompiled());
+
+   auto readText = info->GetReadTextActions();
+   ASSERT_NE(readText, nullptr);
+   EXPECT_FALSE(readText->fActions.empty());
+   EXPECT_EQ(readText, info->GetReadTextActions());
+   ASSERT_NE(info->GetWriteTextActions(), nullptr);
+   EXPECT_EQ(readText->fActions.size(), info->GetWriteTextActions()->fActions.size());
+
+   auto readMemberWise = info->GetReadMemberWiseActions(kFALSE);
+   ASSERT_NE(readMemberWise, nullptr);
+   EXPECT_FALSE(readMemberWise->fActions.empty());
+   ASSERT_NE(info->GetWriteMemberWiseActions(kTRUE), nullptr);
+   EXPECT_FALSE(info->GetWriteMemberWiseActions(kTRUE)->fActions.empty());
+
+   TNamed named0("name", "title");
+   auto json = TBufferJSON::ToJSON(&named0);
+   auto named1 = TBufferJSON::FromJSON<TNamed>(json.Data());
+   ASSERT_NE(named1, nullptr);
+   EXPECT_STREQ("title", named1->GetTitle());
+}
+
+// numbers are formatted without snprintf, output should stay the same as for the printf formats
+TEST(TBufferJSON, NumberFormat)
+{
+   char buf[100], ref[100];
+   const Double_t values[] = {0.1, -3.75, 3.75e-3, 3.75e-4, 1.1e-10, 123.456, -1e300, 5e-324, 1e24, -7, 0};
+   for (auto value : values) {
+      snprintf(ref, sizeof(ref), (value == std::nearbyint(value)) ? "%1.0f" : "%.14e", value);
+      TBufferText::CompactFloatString(ref, sizeof(ref));
+      EXPECT_STREQ(ref, TBufferText::ConvertDouble(value, buf, sizeof(buf)));
+      Float_t fvalue = value;
+      if (std::isinf(fvalue))
+         continue;
+      snprintf(ref, sizeof(ref), (fvalue == std::nearbyint(fvalue)) ? "%1.0f" : "%e", fvalue);
+      TBufferText::CompactFloatString(ref, sizeof(ref));
+      EXPECT_STREQ(ref, TBufferText::ConvertFloat(fvalue, buf, sizeof(buf)));
+   }
+
+   TBufferText::SetFloatFormat("shortest");
+   for (auto value : values) {
+      EXPECT_EQ(value, std::strtod(TBufferText::ConvertDouble(value, buf, sizeof(buf)), nullptr));
+      Float_t fvalue = value;
+      EXPECT_EQ(fvalue, std::strtof(TBufferText::ConvertFloat(fvalue, buf, sizeof(buf)), nullptr));
+   }
+   EXPECT_STREQ("0.1", TBufferText::ConvertDouble(0.1, buf, sizeof(buf)));
+   TBufferText::SetFloatFormat();
+   TBufferText::SetDoubleFormat();
+}
@@ -266,3 +266,103 @@ TEST(TBufferMerger, SetMaxTreeSize)
 
    RemoveFile("tbuffermerger_setmaxtreesize.root");
 }
+
+static void FillInParallel(TBufferMerger &merger)
+{
+   const int nthreads = 4;
+   const int nwrites = 8;
+   const int nevents = 32;
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nthreads; ++i) {
+      threads.emplace_back([=, &merger]() {
+         auto myfile = merger.GetFile();
+         auto mytree = new TTree("mytree", "mytree");
+         int n = 0;
+         mytree->Branch("n", &n, "n/I");
+         for (int w = 0; w < nwrites; ++w) {
+            for (int j = 0; j < nevents; ++j) {
+               n = (i * nwrites + w) * nevents + j;
+               mytree->Fill();
+            }
+            myfile->Write();
+         }
+         mytree->ResetBranchAddresses();
+      });
+   }
+
+   for (auto &&t : threads)
+      t.join();
+}
+
+static void CheckSum(const char *name, int nentries)
+{
+   TFile f(name);
+   auto t = f.Get<TTree>("mytree");
+   ASSERT_TRUE(t != nullptr);
+   EXPECT_EQ(nentries, t->GetEntries());
+
+   long long n_sum = 0;
+   int n = 0;
+   t->SetBranchAddress("n", &n);
+   for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+      t->GetEntry(i);
+      n_sum += n;
+   }
+   EXPECT_EQ((long long)nentries * (nentries - 1) / 2, n_sum);
+}
+
+TEST(TBufferMerger, AsyncMerge)
+{
+   ROOT::EnableThreadSafety();
+   const char *name = "tbuffermerger_async.root";
+
+   {
+      TBufferMerger merger(name);
+      merger.SetAsyncMerge();
+      EXPECT_TRUE(merger.GetAsyncMerge());
+      FillInParallel(merger);
+   }
+
+   CheckSum(name, 4 * 8 * 32);
+   RemoveFile(name);
+}
+
+TEST(TBufferMerger, BlockWhenFull)
+{
+   ROOT::EnableThreadSafety();
+
+   for (bool async : {false, true}) {
+      const char *name = "tbuffermerger_block.root";
+      {
+         TBufferMerger merger(name);
+         merger.SetMaxBuffered(1);
+         merger.SetQueueFullPolicy(TBufferMerger::EQueueFullPolicy::kBlock);
+         merger.SetAsyncMerge(async);
+         EXPECT_EQ(1u, merger.GetMaxBuffered());
+         FillInParallel(merger);
+         // At most one buffer can be queued at any time
+         EXPECT_LE(merger.GetQueueSize(), 1u);
+      }
+
+      CheckSum(name, 4 * 8 * 32);
+      RemoveFile(name);
+   }
+}
+
+TEST(TBufferMerger, SpillWhenFull)
+{
+   ROOT::EnableThreadSafety();
+   const char *name = "tbuffermerger_spill.root";
+
+   {
+      TBufferMerger merger(name);
+      merger.SetMaxBuffered(1);
+      merger.SetQueueFullPolicy(TBufferMerger::EQueueFullPolicy::kSpill);
+      EXPECT_EQ(TBufferMerger::EQueueFullPolicy::kSpill, merger.GetQueueFullPolicy());
+      FillInParallel(merger);
+   }
+
+   CheckSum(name, 4 * 8 * 32);
+   RemoveFile(name);
+}
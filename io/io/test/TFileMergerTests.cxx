@@ -2,9 +2,17 @@
 
 #include "TFileMerger.h"
 
+#include "TFile.h"
+#include "TH1F.h"
+#include "TKey.h"
 #include "TMemFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <string>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +76,84 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+#ifdef R__USE_IMT
+namespace {
+
+void CreateHistoFile(const char *fileName, int index)
+{
+   TFile f(fileName, "RECREATE");
+   auto fill = [index](TDirectory *dir, const char *prefix) {
+      dir->cd();
+      for (int i = 0; i < 50; ++i) {
+         auto h = new TH1F((prefix + std::to_string(i)).c_str(), "h", 10, 0, 10);
+         h->Fill(i % 10, index + 1);
+      }
+   };
+   fill(&f, "h");
+   double x = index;
+   auto t = new TTree("t", "t");
+   t->SetImplicitMT(false);
+   t->Branch("x", &x);
+   t->Fill();
+   fill(f.mkdir("sub"), "s");
+   f.Write();
+}
+
+std::vector<std::string> GetKeyNames(TDirectory *dir)
+{
+   std::vector<std::string> names;
+   for (auto key : TRangeDynCast<TKey>(dir->GetListOfKeys()))
+      names.push_back(key->GetName());
+   return names;
+}
+
+} // anonymous namespace
+
+TEST(TFileMerger, ParallelHistoMerge)
+{
+   const std::vector<std::string> inputs{"parallelhistomerge0.root", "parallelhistomerge1.root",
+                                         "parallelhistomerge2.root"};
+   for (std::size_t i = 0; i < inputs.size(); ++i)
+      CreateHistoFile(inputs[i].c_str(), i);
+
+   auto merge = [&](const char *output, bool parallel) {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetPrintLevel(0);
+      if (parallel) {
+         ROOT::EnableImplicitMT(4);
+         // Smaller than the number of histograms, such that several batches are merged
+         merger.SetParallelMergeBatch(7);
+      }
+      for (auto &input : inputs)
+         merger.AddFile(input.c_str(), kFALSE);
+      merger.OutputFile(output, "RECREATE");
+      EXPECT_TRUE(merger.Merge());
+      ROOT::DisableImplicitMT();
+   };
+   merge("parallelhistomerge_seq.root", false);
+   merge("parallelhistomerge_mt.root", true);
+
+   TFile seq("parallelhistomerge_seq.root");
+   TFile mt("parallelhistomerge_mt.root");
+   EXPECT_EQ(GetKeyNames(&seq), GetKeyNames(&mt));
+   EXPECT_EQ(GetKeyNames(seq.GetDirectory("sub")), GetKeyNames(mt.GetDirectory("sub")));
+   for (const char *prefix : {"h", "sub/s"}) {
+      for (int i = 0; i < 50; ++i) {
+         const auto name = prefix + std::to_string(i);
+         auto h = mt.Get<TH1F>(name.c_str());
+         ASSERT_NE(nullptr, h);
+         EXPECT_EQ(6., h->GetBinContent(h->FindBin(i % 10)));
+         EXPECT_EQ(3., h->GetEntries());
+      }
+   }
+   auto t = mt.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   EXPECT_EQ(3, t->GetEntries());
+
+   for (auto &input : inputs)
+      gSystem->Unlink(input.c_str());
+   gSystem->Unlink("parallelhistomerge_seq.root");
+   gSystem->Unlink("parallelhistomerge_mt.root");
+}
+#endif
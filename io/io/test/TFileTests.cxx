@@ -1,4 +1,6 @@
+#include <future>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -135,3 +137,248 @@ TEST(TFile, ReadWithoutGlobalRegistrationNet)
    const auto netFile = "root://eospublic.cern.ch//eos/root-eos/h1/dstarmb.root";
    TestReadWithoutGlobalRegistrationIfPossible(netFile);
 }
+
+TEST(TFile, CompressionDictionary)
+{
+   const auto filename = "TFileTestCompressionDictionary.root";
+   const auto filenameNoDict = "TFileTestCompressionDictionaryNoDict.root";
+   const int nobjects = 6000;
+   auto makeTitle = [](int i) {
+      std::string title;
+      for (int j = 0; j < 40; ++j)
+         title += "lumi section " + std::to_string(i % 97) + " bin " + std::to_string(j) + " / ";
+      return title;
+   };
+
+   auto write = [&](const char *name, bool useDictionary) {
+      TFile f(name, "RECREATE", "", 505);
+      if (useDictionary)
+         f.SetCompressionDictionary();
+      for (int i = 0; i < nobjects; ++i) {
+         TNamed named("n", makeTitle(i).c_str());
+         f.WriteObject(&named, ("n" + std::to_string(i)).c_str());
+      }
+      f.Close();
+      return f.GetEND();
+   };
+   const auto sizeDict = write(filename, true);
+   const auto sizeNoDict = write(filenameNoDict, false);
+   EXPECT_LT(sizeDict, sizeNoDict);
+
+   {
+      TFile f(filename);
+      for (int i = 0; i < nobjects; i += 7) {
+         auto named = f.Get<TNamed>(("n" + std::to_string(i)).c_str());
+         ASSERT_TRUE(named != nullptr);
+         EXPECT_EQ(makeTitle(i), named->GetTitle());
+         delete named;
+      }
+   }
+
+   gSystem->Unlink(filename);
+   gSystem->Unlink(filenameNoDict);
+}
+
+TEST(TFile, WriteObjectAsync)
+{
+   const auto filename = "tfile_test_writeobjectasync.root";
+   const int nobjects = 200;
+   auto makeTitle = [](int i, int cycle) { return std::string(300, 'a' + i % 26) + std::to_string(i * 10 + cycle); };
+   {
+      TFile f(filename, "RECREATE");
+      auto subdir = static_cast<TDirectoryFile *>(f.mkdir("sub"));
+      std::vector<std::future<Int_t>> results;
+      for (int cycle = 0; cycle < 3; ++cycle) {
+         for (int i = 0; i < nobjects; ++i) {
+            TNamed named(("n" + std::to_string(i)).c_str(), makeTitle(i, cycle).c_str());
+            // The object is serialized before returning, it can go out of scope
+            results.emplace_back(f.WriteObjectAsync(&named, nullptr, cycle ? "overwrite" : ""));
+         }
+         TNamed named("s", makeTitle(0, cycle).c_str());
+         results.emplace_back(subdir->WriteObjectAsync(&named, nullptr, "writedelete"));
+      }
+      // A synchronous write in between waits for the pending ones
+      TNamed last("last", "last");
+      EXPECT_GT(f.WriteTObject(&last), 0);
+      for (auto &r : results)
+         EXPECT_GT(r.get(), 0);
+
+      TNamed late("late", "late");
+      auto lateResult = f.WriteObjectAsync(&late);
+      f.Write();
+      EXPECT_GT(lateResult.get(), 0);
+   }
+
+   {
+      TFile f(filename);
+      // "overwrite" and "writedelete" leave a single cycle
+      EXPECT_EQ(nobjects + 3, f.GetListOfKeys()->GetSize());
+      for (int i = 0; i < nobjects; ++i) {
+         auto named = f.Get<TNamed>(("n" + std::to_string(i)).c_str());
+         ASSERT_TRUE(named != nullptr);
+         EXPECT_EQ(makeTitle(i, 2), named->GetTitle());
+         delete named;
+      }
+      auto subdir = f.Get<TDirectory>("sub");
+      ASSERT_TRUE(subdir != nullptr);
+      EXPECT_EQ(1, subdir->GetListOfKeys()->GetSize());
+      auto named = subdir->Get<TNamed>("s");
+      ASSERT_TRUE(named != nullptr);
+      EXPECT_EQ(makeTitle(0, 2), named->GetTitle());
+      EXPECT_TRUE(f.Get<TNamed>("late") != nullptr);
+   }
+
+   gSystem->Unlink(filename);
+}
+
+// A key larger than kMAXZIPBUF consists of several compressed records, which are compressed and inflated in
+// parallel with implicit multi-threading
+static void TestLargeKey(const char *filename)
+{
+   std::vector<int> vec(8 * 1024 * 1024);
+   for (std::size_t i = 0; i < vec.size(); ++i)
+      vec[i] = (i * 2654435761u) % 1000;
+   {
+      TFile f(filename, "RECREATE");
+      f.WriteObject(&vec, "vec");
+      auto key = f.GetKey("vec");
+      ASSERT_TRUE(key != nullptr);
+      // Compressed, i.e. written in several records
+      EXPECT_LT(key->GetNbytes() - key->GetKeylen(), key->GetObjlen());
+   }
+   {
+      TFile f(filename);
+      std::unique_ptr<std::vector<int>> read(f.Get<std::vector<int>>("vec"));
+      ASSERT_TRUE(read != nullptr);
+      EXPECT_EQ(vec, *read);
+   }
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, LargeKey)
+{
+   TestLargeKey("tfile_test_largekey.root");
+}
+
+#ifdef R__USE_IMT
+TEST(TFile, LargeKeyMT)
+{
+   ROOT::EnableImplicitMT(4);
+   TestLargeKey("tfile_test_largekey_mt.root");
+   ROOT::DisableImplicitMT();
+}
+#endif
+
+// With thread safety enabled, the standard files are opened asynchronously in a background thread
+TEST(TFile, AsyncOpen)
+{
+   ROOT::EnableThreadSafety();
+   const char *filename = "tfile_test_asyncopen.root";
+   {
+      TFile f(filename, "RECREATE");
+      TNamed n("n", "title");
+      f.WriteObject(&n, "n");
+   }
+
+   auto handle = TFile::AsyncOpen(filename);
+   ASSERT_TRUE(handle != nullptr);
+   std::unique_ptr<TFile> f(TFile::Open(handle));
+   ASSERT_TRUE(f && !f->IsZombie());
+   std::unique_ptr<TNamed> n(f->Get<TNamed>("n"));
+   ASSERT_TRUE(n != nullptr);
+   EXPECT_STREQ(n->GetTitle(), "title");
+   f.reset();
+
+   // A pending request is taken over by opening the same file by name
+   handle = TFile::AsyncOpen(filename, "READ");
+   EXPECT_NE(TFile::GetAsyncOpenStatus(handle), TFile::kAOSNotAsync);
+   f.reset(TFile::Open(filename));
+   ASSERT_TRUE(f && !f->IsZombie());
+   // the handle belongs to the file now, cancelling it does nothing
+   TFile::CancelAsyncOpen(handle);
+   n.reset(f->Get<TNamed>("n"));
+   EXPECT_TRUE(n != nullptr);
+   f.reset();
+
+   // Requests that are not needed anymore can be cancelled
+   TFile::CancelAsyncOpen(TFile::AsyncOpen(filename));
+   gSystem->Unlink(filename);
+}
+
+// The keys of a directory with many keys are found by name and cycle after reopening the file
+TEST(TFile, ManyKeys)
+{
+   auto filename{"tfile_manykeys.root"};
+   const int nKeys = 20000;
+   {
+      TFile f(filename, "RECREATE");
+      for (int i = 0; i < nKeys; ++i) {
+         TNamed n(("n" + std::to_string(i)).c_str(), std::to_string(i).c_str());
+         n.Write();
+      }
+      for (int cycle = 2; cycle <= 3; ++cycle) {
+         TNamed n("n7", ("cycle" + std::to_string(cycle)).c_str());
+         n.Write();
+      }
+   }
+
+   TFile f(filename);
+   EXPECT_EQ(f.GetNkeys(), nKeys + 2);
+   for (int i = 0; i < nKeys; i += 997) {
+      std::unique_ptr<TNamed> n(f.Get<TNamed>(("n" + std::to_string(i)).c_str()));
+      ASSERT_TRUE(n != nullptr);
+      EXPECT_EQ(std::to_string(i), n->GetTitle());
+   }
+   std::unique_ptr<TNamed> latest(f.Get<TNamed>("n7"));
+   ASSERT_TRUE(latest != nullptr);
+   EXPECT_STREQ(latest->GetTitle(), "cycle3");
+   std::unique_ptr<TNamed> first(f.Get<TNamed>("n7;1"));
+   ASSERT_TRUE(first != nullptr);
+   EXPECT_STREQ(first->GetTitle(), "7");
+   ASSERT_TRUE(f.GetKey("n7", 2) != nullptr);
+   EXPECT_EQ(f.GetKey("n7", 2)->GetCycle(), 2);
+   f.Close();
+   gSystem->Unlink(filename);
+}
+
+// A new record goes to the smallest free segment that can hold it
+TEST(TFile, BestFreeSegment)
+{
+   auto filename{"tfile_bestfreesegment.root"};
+   auto writeNamed = [](const char *name, std::size_t titleSize) {
+      TNamed n(name, std::string(titleSize, 'x').c_str());
+      n.Write();
+   };
+   auto freeKey = [](TFile &f, const char *name) {
+      TKey *key = f.GetKey(name);
+      const Long64_t seek = key->GetSeekKey();
+      key->Delete();
+      delete key;
+      return seek;
+   };
+   {
+      TFile f(filename, "RECREATE", "", 0);
+      writeNamed("big", 2000);
+      writeNamed("separator1", 10);
+      writeNamed("medium", 300);
+      writeNamed("separator2", 10);
+      const Long64_t bigSeek = freeKey(f, "big");
+      const Long64_t mediumSeek = freeKey(f, "medium");
+
+      writeNamed("small", 200);
+      EXPECT_EQ(f.GetKey("small")->GetSeekKey(), mediumSeek);
+      writeNamed("large", 1500);
+      EXPECT_EQ(f.GetKey("large")->GetSeekKey(), bigSeek);
+   }
+
+   TFile f(filename);
+   EXPECT_EQ(f.GetNkeys(), 4);
+   std::unique_ptr<TNamed> small(f.Get<TNamed>("small"));
+   ASSERT_TRUE(small != nullptr);
+   EXPECT_EQ(std::string(small->GetTitle()), std::string(200, 'x'));
+   std::unique_ptr<TNamed> large(f.Get<TNamed>("large"));
+   ASSERT_TRUE(large != nullptr);
+   EXPECT_EQ(std::string(large->GetTitle()), std::string(1500, 'x'));
+   f.Close();
+   gSystem->Unlink(filename);
+}
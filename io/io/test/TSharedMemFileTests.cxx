@@ -0,0 +1,110 @@
+#include "TSharedMemFile.h"
+
+#include "TError.h"
+#include "TNamed.h"
+#include "TSystem.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+/// Create a segment name that is unique for this process
+std::string SegmentName(const char *test)
+{
+   return "/root_tsharedmemfile_" + std::string(test) + "_" + std::to_string(gSystem->GetPid());
+}
+
+void WriteNames(const std::string &segment, int n, Long64_t capacity = 0)
+{
+   TSharedMemFile file(segment.c_str(), "RECREATE", "", 101, capacity);
+   ASSERT_FALSE(file.IsZombie());
+   for (int i = 0; i < n; ++i) {
+      TNamed named(("name" + std::to_string(i)).c_str(), ("title" + std::to_string(i)).c_str());
+      named.Write();
+   }
+}
+
+} // anonymous namespace
+
+TEST(TSharedMemFile, WriteAndRead)
+{
+   const auto segment = SegmentName("WriteAndRead");
+   WriteNames(segment, 100);
+
+   TSharedMemFile file(segment.c_str());
+   ASSERT_FALSE(file.IsZombie());
+   EXPECT_FALSE(file.IsWritable());
+   for (int i = 0; i < 100; i += 7) {
+      auto named = file.Get<TNamed>(("name" + std::to_string(i)).c_str());
+      ASSERT_NE(nullptr, named);
+      EXPECT_EQ("title" + std::to_string(i), named->GetTitle());
+   }
+   EXPECT_TRUE(TSharedMemFile::Unlink(segment.c_str()));
+}
+
+TEST(TSharedMemFile, OtherProcess)
+{
+   const auto segment = SegmentName("OtherProcess");
+   pid_t pid = fork();
+   ASSERT_NE(-1, pid);
+   if (pid == 0) {
+      {
+         TSharedMemFile file(segment.c_str(), "CREATE");
+         TNamed named("name", "written by the child process");
+         file.WriteTObject(&named);
+      }
+      _exit(0);
+   }
+   int status = 0;
+   ASSERT_EQ(pid, waitpid(pid, &status, 0));
+   ASSERT_TRUE(WIFEXITED(status));
+
+   TSharedMemFile file(segment.c_str());
+   ASSERT_FALSE(file.IsZombie());
+   auto named = file.Get<TNamed>("name");
+   ASSERT_NE(nullptr, named);
+   EXPECT_STREQ("written by the child process", named->GetTitle());
+   EXPECT_TRUE(TSharedMemFile::Unlink(segment.c_str()));
+}
+
+TEST(TSharedMemFile, NotClosed)
+{
+   const auto segment = SegmentName("NotClosed");
+   TSharedMemFile writer(segment.c_str(), "RECREATE");
+   ASSERT_FALSE(writer.IsZombie());
+   {
+      auto oldIgnoreLevel = gErrorIgnoreLevel;
+      gErrorIgnoreLevel = kBreak;
+      TSharedMemFile reader(segment.c_str());
+      EXPECT_TRUE(reader.IsZombie());
+      gErrorIgnoreLevel = oldIgnoreLevel;
+   }
+   writer.Close();
+   TSharedMemFile reader(segment.c_str());
+   EXPECT_FALSE(reader.IsZombie());
+   EXPECT_EQ(writer.GetEND(), reader.GetSize());
+   EXPECT_TRUE(TSharedMemFile::Unlink(segment.c_str()));
+}
+
+TEST(TSharedMemFile, Full)
+{
+   const auto segment = SegmentName("Full");
+   auto oldIgnoreLevel = gErrorIgnoreLevel;
+   gErrorIgnoreLevel = kBreak;
+   {
+      TSharedMemFile file(segment.c_str(), "RECREATE", "", 0, 64 * 1024);
+      ASSERT_FALSE(file.IsZombie());
+      TNamed named("name", std::string(128 * 1024, 'x').c_str());
+      EXPECT_EQ(0, file.WriteTObject(&named));
+      EXPECT_TRUE(file.TestBit(TFile::kWriteError));
+   }
+   EXPECT_TRUE(TSharedMemFile::Unlink(segment.c_str()));
+   // The segment is gone
+   EXPECT_FALSE(TSharedMemFile::Unlink(segment.c_str()));
+   gErrorIgnoreLevel = oldIgnoreLevel;
+}
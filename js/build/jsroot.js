@@ -53916,7 +53916,7 @@ let PadButtonsHandler = {
 
 
 // identifier used in TWebCanvas painter
-const webSnapIds = { kNone: 0,  kObject: 1, kSVG: 2, kSubPad: 3, kColors: 4, kStyle: 5 };
+const webSnapIds = { kNone: 0,  kObject: 1, kSVG: 2, kSubPad: 3, kColors: 4, kStyle: 5, kUnchanged: 6 };
 
 /**
   * @summary Painter for TPad object
@@ -55074,6 +55074,8 @@ class TPadPainter extends ObjectPainter {
          } else if (snap.fKind === webSnapIds.kSVG) { // update SVG
             if (objpainter.updateObject(snap.fSnapshot))
                promise = objpainter.redraw();
+         } else if (snap.fKind === webSnapIds.kUnchanged) { // object not changed, data not send again
+            promise = objpainter.redraw();
          }
 
          return getPromise(promise).then(() => this.drawNextSnap(lst, indx)); // call next
@@ -30,6 +30,7 @@
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
+  \param -mt  Merge the histograms concurrently with `n` threads (use 0 for the number of cores)
   \param -n   Open at most `n` at once (use 0 to request to use the system maximum)
   \param -experimental-io-features `<feature>` Enables the corresponding experimental feature for output trees
   \return hadd returns a status code: 0 if OK, -1 otherwise
@@ -80,6 +81,10 @@
   (i.e. direct copy of the raw byte on disk). The "fast" mode is typically
   5 times faster than the mode unzipping and unstreaming the baskets.
 
+  With the option -mt the histograms are summed concurrently on a pool of threads,
+  while the trees are merged (or fast cloned) one after the other.  With -j only
+  the final merge of the partial files uses the threads.
+
   If the option -cachesize is used, hadd will resize (or disable if 0) the
   prefetching cache use to speed up I/O operations.
 
@@ -101,6 +106,7 @@
 #include "ROOT/TIOFeatures.hxx"
 #include "TFile.h"
 #include "THashList.h"
+#include "TROOT.h"
 #include "TKey.h"
 #include "TClass.h"
 #include "TSystem.h"
@@ -141,6 +147,7 @@ int main( int argc, char **argv )
    Bool_t multiproc = kFALSE;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
+   Int_t nThreads = -1;
    Int_t verbosity = 99;
    TString cacheSize;
    SysInfo_t s;
@@ -213,6 +220,22 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, use the number of cores.
+         nThreads = 0;
+         if (a + 1 != argc && argv[a + 1][0] != '-') {
+            char *end = nullptr;
+            Long_t request = strtol(argv[a + 1], &end, 10);
+            if (*end == '\0' && request < kMaxInt && request >= 0) {
+               nThreads = (Int_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of threads passed after -mt: " << argv[a + 1]
+                         << ". We will use the number of logical cores.\n";
+            }
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -466,6 +489,8 @@ int main( int argc, char **argv )
       merger.SetNotrees(noTrees);
       merger.SetMergeOptions(cacheSize);
       merger.SetIOFeatures(features);
+      if (nThreads >= 0)
+         merger.SetParallelMergeBatch(1000);
       Bool_t status;
       if (append)
          status = merger.PartialMerge(TFileMerger::kIncremental | TFileMerger::kAll);
@@ -530,6 +555,9 @@ int main( int argc, char **argv )
       auto res = p.Map(parallelMerge, ROOT::TSeqI(ffirst, argc, step));
       status = std::accumulate(res.begin(), res.end(), 0U) == partialFiles.size();
       if (status) {
+         // The thread pool is only started after the worker processes are done
+         if (nThreads >= 0)
+            ROOT::EnableImplicitMT(nThreads);
          status = reductionFunc();
       } else {
          std::cout << "hadd failed at the parallel stage" << std::endl;
@@ -540,9 +568,13 @@ int main( int argc, char **argv )
          }
       }
    } else {
+      if (nThreads >= 0)
+         ROOT::EnableImplicitMT(nThreads);
       status = sequentialMerge(fileMerger, ffirst, filesToProcess);
    }
 #else
+   if (nThreads >= 0)
+      ROOT::EnableImplicitMT(nThreads);
    status = sequentialMerge(fileMerger, ffirst, filesToProcess);
 #endif
 
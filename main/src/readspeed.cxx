@@ -11,6 +11,9 @@
 #include "ReadSpeedCLI.hxx"
 #include "ReadSpeed.hxx"
 
+#include <fstream>
+#include <iostream>
+
 using namespace ReadSpeed;
 
 int main(int argc, char **argv)
@@ -20,7 +23,16 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   const auto runs = RunBenchmarks(args);
+
+   if (!args.fJSONFile.empty()) {
+      std::ofstream json(args.fJSONFile);
+      if (!json) {
+         std::cerr << "Could not open file '" << args.fJSONFile << "' to write the results\n";
+         return 1;
+      }
+      WriteJSON(runs, json);
+   }
 
    return 0;
 }
@@ -72,6 +72,7 @@ protected:
    Double_t fMCerror;         ///< and its error
 
    Double_t *fAlpha;          ///< [fDim] Internal parameters of the hyper-rectangle
+   Int_t     fBatchSize{0};   ///<! No. of points per cell evaluated at once in cell exploration, 0 for one by one
 
 public:
    TFoam();                          // Default constructor (used only by ROOT streamer)
@@ -84,6 +85,7 @@ public:
    virtual void InitCells();                 // Initializes first cells inside original cube
    virtual Int_t  CellFill(Int_t, TFoamCell*);  // Allocates new empty cell and return its index
    virtual void Explore(TFoamCell *Cell);       // Exploration of the new cell, determine <wt>, wtMax etc.
+   virtual void ExploreCells(TFoamCell **cells, Int_t nCells); // Exploration of several cells, in batches of points
    virtual void Carver(Int_t&,Double_t&,Double_t&);// Determines the best edge, wt_max reduction
    virtual void Varedu(Double_t [], Int_t&, Double_t&,Double_t&); // Determines the best edge, variance reduction
    virtual void MakeAlpha();                 // Provides random point inside hyper-rectangle
@@ -94,6 +96,7 @@ public:
    virtual void GenerCel2(TFoamCell *&);     // Chose an active cell the with probability ~ Primary integral
    // Generation
    virtual Double_t Eval(Double_t *);        // Evaluates value of the distribution function
+   virtual void     EvalBatch(Int_t, Double_t *, Double_t *); // Evaluates distribution function at several points
    virtual void     MakeEvent();             // Makes (generates) single MC event
    virtual void     GetMCvect(Double_t *);   // Provides generated randomly MC vector
    virtual void     GetMCwt(Double_t &);     // Provides generated MC weight
@@ -121,6 +124,7 @@ public:
    virtual void SetOptDrive(Int_t OptDrive){fOptDrive =OptDrive;}  // Sets optimization switch
    virtual void SetEvPerBin(Int_t EvPerBin){fEvPerBin =EvPerBin;}  // Sets max. no. of effective events per bin
    virtual void SetMaxWtRej(Double_t MaxWtRej){fMaxWtRej=MaxWtRej;}  // Sets max. weight for rejection
+   virtual void SetBatchSize(Int_t BatchSize){fBatchSize =BatchSize;} // Sets no. of points per cell evaluated at once
    virtual void SetInhiDiv(Int_t, Int_t );            // Set inhibition of cell division along certain edge
    virtual void SetXdivPRD(Int_t, Int_t, Double_t[]); // Set predefined division points
    // Getters and Setters
@@ -130,6 +134,7 @@ public:
    virtual void GetPrimary(Double_t &prime) {prime = fPrime;}      // Get value of primary integral R'
    virtual Long_t GetnCalls() const {return fNCalls;}            // Get total no. of the function calls
    virtual Long_t GetnEffev() const {return fNEffev;}            // Get total no. of effective wt=1 events
+   virtual Int_t  GetBatchSize() const {return fBatchSize;}      // Get no. of points per cell evaluated at once
    // Debug
    virtual void CheckAll(Int_t);     // Checks correctness of the entire data structure in the FOAM object
    virtual void PrintCells();        // Prints content of all cells
@@ -11,6 +11,7 @@ public:
    TFoamIntegrand() { };
    ~TFoamIntegrand() override { };
    virtual Double_t Density(Int_t ndim, Double_t *) = 0;
+   virtual void DensityBatch(Int_t ndim, Int_t npoints, Double_t *x, Double_t *result);
 
    ClassDefOverride(TFoamIntegrand,1); //n-dimensional real positive integrand of FOAM
 };
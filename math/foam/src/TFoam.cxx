@@ -68,6 +68,12 @@ Only `kDim` HAS TO BE redefined, the other parameters may be left at their defau
 Increasing `nSampl` sometimes helps, but it may cost CPU time.
 `MaxWtRej` may need to be increased for wild a distribution, while using `OptRej=0`.
 
+For integrands that are expensive to evaluate, `FoamObject->SetBatchSize(n)` makes the
+exploration of the cells draw up to n points per cell at once, and evaluate the points of
+both daughters of a divided cell in one call of TFoamIntegrand::DensityBatch, which may
+evaluate them in parallel. The cells are then explored with a different sequence of random
+numbers, and the points drawn after the exploration of a cell converged are not used.
+
 Past versions of FOAM: August 2003, v.1.00; September 2003 v.1.01
 Adopted starting from FOAM-2.06 by P. Sawicki
 
@@ -521,148 +527,188 @@ Int_t TFoam::CellFill(Int_t Status, TFoamCell *parent)
 
 void TFoam::Explore(TFoamCell *cell)
 {
-   Double_t wt, dx, xBest=0, yBest=0;
-   Double_t intOld, driOld;
+   ExploreCells(&cell, 1);
+} // TFoam::Explore
 
-   Long_t iev;
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method used by Initialize.
+///
+/// Explores the given cells like Explore. Their MC samples are drawn in
+/// chunks of up to fBatchSize points per cell (one point if the batch size is
+/// not set), and the points of all the cells are evaluated together with
+/// EvalBatch, such that an integrand may evaluate them in parallel.
+/// The exploration of a cell stops at the same point as in Explore, the
+/// points drawn beyond it are not used.
+
+void TFoam::ExploreCells(TFoamCell **cells, Int_t nCells)
+{
+   Double_t wt, xBest=0, yBest=0;
    Double_t nevMC;
    Int_t i, j, k;
-   Int_t nProj, kBest;
-   Double_t ceSum[5], xproj;
+   Int_t kBest;
+   Double_t xproj;
+
+   const Int_t batchSize = fBatchSize > 0 ? fBatchSize : 1;
 
    TFoamVect  cellSize(fDim);
    TFoamVect  cellPosi(fDim);
-
-   cell->GetHcub(cellPosi,cellSize);
-
-   TFoamCell  *parent;
-
-   Double_t *xRand = new Double_t[fDim];
-
-   Double_t *volPart=0;
-
-   cell->CalcVolume();
-   dx = cell->GetVolume();
-   intOld = cell->GetIntg(); //memorize old values,
-   driOld = cell->GetDriv(); //will be needed for correcting parent cells
-
-
-   /////////////////////////////////////////////////////
-   //    Special Short MC sampling to probe cell      //
-   /////////////////////////////////////////////////////
-   ceSum[0]=0;
-   ceSum[1]=0;
-   ceSum[2]=0;
-   ceSum[3]=gHigh;  //wtmin
-   ceSum[4]=gVlow;  //wtmax
-   //
-   for(i=0;i<fDim;i++) ((TH1D *)(*fHistEdg)[i])->Reset(); // Reset histograms
-   fHistWt->Reset();
+   std::vector<Double_t> posi(nCells*fDim), size(nCells*fDim);
+   std::vector<Double_t> dx(nCells), intOld(nCells), driOld(nCells);
+   std::vector<Double_t> ceSum(nCells*5), nevEff(nCells, 0.);
+   std::vector<Int_t> nDrawn(nCells, 0);
+   std::vector<Bool_t> done(nCells, kFALSE);
+   // alphas and weights of the samples used for each cell
+   std::vector<std::vector<Double_t>> alphas(nCells), weights(nCells);
+
+   for(i=0; i<nCells; i++) {
+      TFoamCell *cell = cells[i];
+      cell->GetHcub(cellPosi,cellSize);
+      for(j=0; j<fDim; j++) {
+         posi[i*fDim+j] = cellPosi[j];
+         size[i*fDim+j] = cellSize[j];
+      }
+      cell->CalcVolume();
+      dx[i] = cell->GetVolume();
+      intOld[i] = cell->GetIntg(); //memorize old values,
+      driOld[i] = cell->GetDriv(); //will be needed for correcting parent cells
+
+      /////////////////////////////////////////////////////
+      //    Special Short MC sampling to probe cell      //
+      /////////////////////////////////////////////////////
+      ceSum[i*5+0]=0;
+      ceSum[i*5+1]=0;
+      ceSum[i*5+2]=0;
+      ceSum[i*5+3]=gHigh;  //wtmin
+      ceSum[i*5+4]=gVlow;  //wtmax
+   }
    //
    // ||||||||||||||||||||||||||BEGIN MC LOOP|||||||||||||||||||||||||||||
-   Double_t nevEff=0.;
-   for(iev=0;iev<fNSampl;iev++){
-      MakeAlpha();               // generate uniformly vector inside hypercube
-
-      if(fDim>0){
-      for(j=0; j<fDim; j++)
-         xRand[j]= cellPosi[j] +fAlpha[j]*(cellSize[j]);
+   std::vector<Double_t> xBatch, alphaBatch, valBatch;
+   std::vector<Int_t> cellBatch;
+   while(true) {
+      xBatch.clear();
+      alphaBatch.clear();
+      cellBatch.clear();
+      for(i=0; i<nCells; i++) {
+         if(nDrawn[i] >= fNSampl) done[i] = kTRUE;
+         if(done[i]) continue;
+         Int_t nPoints = TMath::Min(batchSize, fNSampl-nDrawn[i]);
+         for(Int_t iev=0; iev<nPoints; iev++) {
+            MakeAlpha();               // generate uniformly vector inside hypercube
+            for(j=0; j<fDim; j++) {
+               alphaBatch.push_back(fAlpha[j]);
+               xBatch.push_back(posi[i*fDim+j] +fAlpha[j]*size[i*fDim+j]);
+            }
+            cellBatch.push_back(i);
+         }
+         nDrawn[i] += nPoints;
       }
+      if(cellBatch.empty()) break;
+
+      valBatch.resize(cellBatch.size());
+      EvalBatch(cellBatch.size(), xBatch.data(), valBatch.data());
+      fNCalls += cellBatch.size();
+
+      for(std::size_t iPoint=0; iPoint<cellBatch.size(); iPoint++) {
+         i = cellBatch[iPoint];
+         if(done[i]) continue;
+         wt=dx[i]*valBatch[iPoint];
+         alphas[i].insert(alphas[i].end(), alphaBatch.begin()+iPoint*fDim, alphaBatch.begin()+(iPoint+1)*fDim);
+         weights[i].push_back(wt);
+         //
+         Double_t *sum = &ceSum[i*5];
+         sum[0] += wt;    // sum of weights
+         sum[1] += wt*wt; // sum of weights squared
+         sum[2]++;        // sum of 1
+         if (sum[3]>wt) sum[3]=wt;  // minimum weight;
+         if (sum[4]<wt) sum[4]=wt;  // maximum weight
+         // test MC loop exit condition
+         nevEff[i] = sum[1] == 0. ? 0. : sum[0]*sum[0]/sum[1];
+         if( nevEff[i] >= fNBin*fEvPerBin) done[i] = kTRUE;
+      }
+   }   // ||||||||||||||||||||||||||END MC LOOP|||||||||||||||||||||||||||||
 
-      wt=dx*Eval(xRand);
-
-      nProj = 0;
-      if(fDim>0) {
+   for(Int_t iCell=0; iCell<nCells; iCell++) {
+      TFoamCell *cell = cells[iCell];
+      Double_t *cellSum = &ceSum[iCell*5];
+      for(k=0; k<fDim; k++) {
+         cellPosi[k] = posi[iCell*fDim+k];
+         cellSize[k] = size[iCell*fDim+k];
+      }
+      //
+      for(i=0;i<fDim;i++) ((TH1D *)(*fHistEdg)[i])->Reset(); // Reset histograms
+      fHistWt->Reset();
+      for(std::size_t iev=0; iev<weights[iCell].size(); iev++) {
          for(k=0; k<fDim; k++) {
-            xproj =fAlpha[k];
-            ((TH1D *)(*fHistEdg)[nProj])->Fill(xproj,wt);
-            nProj++;
+            xproj = alphas[iCell][iev*fDim+k];
+            ((TH1D *)(*fHistEdg)[k])->Fill(xproj,weights[iCell][iev]);
          }
       }
-      //
-      fNCalls++;
-      ceSum[0] += wt;    // sum of weights
-      ceSum[1] += wt*wt; // sum of weights squared
-      ceSum[2]++;        // sum of 1
-      if (ceSum[3]>wt) ceSum[3]=wt;  // minimum weight;
-      if (ceSum[4]<wt) ceSum[4]=wt;  // maximum weight
-      // test MC loop exit condition
-      nevEff = ceSum[1] == 0. ? 0. : ceSum[0]*ceSum[0]/ceSum[1];
-      if( nevEff >= fNBin*fEvPerBin) break;
-   }   // ||||||||||||||||||||||||||END MC LOOP|||||||||||||||||||||||||||||
-   //------------------------------------------------------------------
-   //---  predefine logics of searching for the best division edge ---
-   for(k=0; k<fDim;k++){
-      fMaskDiv[k] =1;                       // default is all
-      if( fInhiDiv[k]==1) fMaskDiv[k] =0; // inhibit some...
-   }
-   // Note that predefined division below overrule inhibition above
-   kBest=-1;
-   Double_t rmin,rmax,rdiv;
-   if(fOptPRD) {          // quick check
-      for(k=0; k<fDim; k++) {
-         rmin= cellPosi[k];
-         rmax= cellPosi[k] +cellSize[k];
-         if( fXdivPRD[k] != 0) {
-            Int_t n= (fXdivPRD[k])->GetDim();
-            for(j=0; j<n; j++) {
-               rdiv=(*fXdivPRD[k])[j];
-               // check predefined divisions is available in this cell
-               if( (rmin +1e-99 <rdiv) && (rdiv< rmax -1e-99)) {
-                  kBest=k;
-                  xBest= (rdiv-cellPosi[k])/cellSize[k] ;
-                  goto ee05;
+      //------------------------------------------------------------------
+      //---  predefine logics of searching for the best division edge ---
+      for(k=0; k<fDim;k++){
+         fMaskDiv[k] =1;                       // default is all
+         if( fInhiDiv[k]==1) fMaskDiv[k] =0; // inhibit some...
+      }
+      // Note that predefined division below overrule inhibition above
+      kBest=-1;
+      Double_t rmin,rmax,rdiv;
+      if(fOptPRD) {          // quick check
+         for(k=0; k<fDim && kBest==-1; k++) {
+            rmin= cellPosi[k];
+            rmax= cellPosi[k] +cellSize[k];
+            if( fXdivPRD[k] != 0) {
+               Int_t n= (fXdivPRD[k])->GetDim();
+               for(j=0; j<n; j++) {
+                  rdiv=(*fXdivPRD[k])[j];
+                  // check predefined divisions is available in this cell
+                  if( (rmin +1e-99 <rdiv) && (rdiv< rmax -1e-99)) {
+                     kBest=k;
+                     xBest= (rdiv-cellPosi[k])/cellSize[k] ;
+                     break;
+                  }
                }
             }
-         }
-      }//k
-   }
-   ee05:
-   /////////////////////////////////////////////////////////////////////////////
-
-   fNEffev += (Long_t)nevEff;
-   nevMC          = ceSum[2];
-   Double_t intTrue = ceSum[0]/(nevMC+0.000001);
-   Double_t intDriv=0.;
-   Double_t intPrim=0.;
-
-   switch(fOptDrive){
-   case 1:                       // VARIANCE REDUCTION
-      if(kBest == -1) Varedu(ceSum,kBest,xBest,yBest); // determine the best edge,
-      //intDriv =sqrt( ceSum[1]/nevMC -intTrue*intTrue ); // Older ansatz, numerically not bad
-      intDriv =sqrt(ceSum[1]/nevMC) -intTrue; // Foam build-up, sqrt(<w**2>) -<w>
-      intPrim =sqrt(ceSum[1]/nevMC);          // MC gen. sqrt(<w**2>) =sqrt(<w>**2 +sigma**2)
-      break;
-   case 2:                       // WTMAX  REDUCTION
-      if(kBest == -1) Carver(kBest,xBest,yBest);  // determine the best edge
-      intDriv =ceSum[4] -intTrue; // Foam build-up, wtmax-<w>
-      intPrim =ceSum[4];          // MC generation, wtmax!
-      break;
-   default:
-      Error("Explore", "Wrong fOptDrive = \n" );
-   }//switch
-   //=================================================================================
-   //hist_Neff_distrib.Fill( fLastCe/2.0+0.01, nevEff+0.01);  //
-   //hist_kBest_distrib.Fill( kBest+0.50, 1.0 ); //  debug
-   //hist_xBest_distrib.Fill( xBest+0.01, 1.0 ); //  debug
-   //=================================================================================
-   cell->SetBest(kBest);
-   cell->SetXdiv(xBest);
-   cell->SetIntg(intTrue);
-   cell->SetDriv(intDriv);
-   cell->SetPrim(intPrim);
-   // correct/update integrals in all parent cells to the top of the tree
-   Double_t  parIntg, parDriv;
-   for(parent = cell->GetPare(); parent!=0; parent = parent->GetPare()){
-      parIntg = parent->GetIntg();
-      parDriv = parent->GetDriv();
-      parent->SetIntg( parIntg   +intTrue -intOld );
-      parent->SetDriv( parDriv   +intDriv -driOld );
+         }//k
+      }
+      /////////////////////////////////////////////////////////////////////////////
+
+      fNEffev += (Long_t)nevEff[iCell];
+      nevMC          = cellSum[2];
+      Double_t intTrue = cellSum[0]/(nevMC+0.000001);
+      Double_t intDriv=0.;
+      Double_t intPrim=0.;
+
+      switch(fOptDrive){
+      case 1:                       // VARIANCE REDUCTION
+         if(kBest == -1) Varedu(cellSum,kBest,xBest,yBest); // determine the best edge,
+         //intDriv =sqrt( cellSum[1]/nevMC -intTrue*intTrue ); // Older ansatz, numerically not bad
+         intDriv =sqrt(cellSum[1]/nevMC) -intTrue; // Foam build-up, sqrt(<w**2>) -<w>
+         intPrim =sqrt(cellSum[1]/nevMC);          // MC gen. sqrt(<w**2>) =sqrt(<w>**2 +sigma**2)
+         break;
+      case 2:                       // WTMAX  REDUCTION
+         if(kBest == -1) Carver(kBest,xBest,yBest);  // determine the best edge
+         intDriv =cellSum[4] -intTrue; // Foam build-up, wtmax-<w>
+         intPrim =cellSum[4];          // MC generation, wtmax!
+         break;
+      default:
+         Error("Explore", "Wrong fOptDrive = \n" );
+      }//switch
+      cell->SetBest(kBest);
+      cell->SetXdiv(xBest);
+      cell->SetIntg(intTrue);
+      cell->SetDriv(intDriv);
+      cell->SetPrim(intPrim);
+      // correct/update integrals in all parent cells to the top of the tree
+      Double_t  parIntg, parDriv;
+      for(TFoamCell *parent = cell->GetPare(); parent!=0; parent = parent->GetPare()){
+         parIntg = parent->GetIntg();
+         parDriv = parent->GetDriv();
+         parent->SetIntg( parIntg   +intTrue -intOld[iCell] );
+         parent->SetDriv( parDriv   +intDriv -driOld[iCell] );
+      }
    }
-   delete [] volPart;
-   delete [] xRand;
-   //cell->Print();
-} // TFoam::Explore
+} // TFoam::ExploreCells
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method used by Initialize.
@@ -951,8 +997,14 @@ Int_t TFoam::Divide(TFoamCell *cell)
    Int_t d2 = CellFill(1,   cell);
    cell->SetDau0((fCells[d1]));
    cell->SetDau1((fCells[d2]));
-   Explore( (fCells[d1]) );
-   Explore( (fCells[d2]) );
+   if(fBatchSize > 0) {
+      // sample both daughters at once
+      TFoamCell *daughters[2] = {fCells[d1], fCells[d2]};
+      ExploreCells(daughters, 2);
+   } else {
+      Explore( (fCells[d1]) );
+      Explore( (fCells[d2]) );
+   }
    return 1;
 } // TFoam_Divide
 
@@ -1078,6 +1130,20 @@ Double_t TFoam::Eval(Double_t *xRand)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method.
+/// Evaluates distribution at nPoints points, stored one after the other in
+/// xRand, in one call of TFoamIntegrand::DensityBatch.
+
+void TFoam::EvalBatch(Int_t nPoints, Double_t *xRand, Double_t *result)
+{
+   if(!fRho) {   //interactive mode
+      for(Int_t i=0; i<nPoints; i++) result[i] = Eval(xRand+i*fDim);
+   } else {       //compiled mode
+      fRho->DensityBatch(fDim, nPoints, xRand, result);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method.
 /// Return randomly chosen active cell with probability equal to its
@@ -7,4 +7,17 @@
 Abstract class representing n-dimensional real positive integrand function
 */
 
-ClassImp(TFoamIntegrand);
\ No newline at end of file
+ClassImp(TFoamIntegrand);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluates the integrand at npoints points of ndim coordinates, stored one
+/// after the other in x, into result. Used by TFoam to explore the cells when
+/// TFoam::SetBatchSize is set. The default calls Density for each point;
+/// integrands that are expensive to evaluate and thread-safe can override it
+/// to evaluate the points in parallel.
+
+void TFoamIntegrand::DensityBatch(Int_t ndim, Int_t npoints, Double_t *x, Double_t *result)
+{
+   for (Int_t i = 0; i < npoints; ++i)
+      result[i] = Density(ndim, x + i * ndim);
+}
@@ -2,11 +2,15 @@
 // Author: Stephan Hageboeck, CERN  04/2020
 
 #include "TFoam.h"
+#include "TFoamIntegrand.h"
 #include "TFile.h"
 #include "TMath.h"
+#include "TRandom3.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 Double_t sqr(Double_t x){
    return x*x;
 }
@@ -50,3 +54,42 @@ TEST(TFoam, Readv1) {
     EXPECT_NEAR(x[1], results[i][1], 1.E-9);
   }
 }
+
+// Counts the batches of points evaluated during the exploration of the cells
+class BatchedCamel2 : public TFoamIntegrand {
+public:
+   int fNBatches = 0;
+   int fMaxPoints = 0;
+
+   Double_t Density(Int_t nDim, Double_t *x) override { return Camel2(nDim, x); }
+   void DensityBatch(Int_t nDim, Int_t nPoints, Double_t *x, Double_t *result) override
+   {
+      ++fNBatches;
+      fMaxPoints = std::max(fMaxPoints, static_cast<int>(nPoints));
+      TFoamIntegrand::DensityBatch(nDim, nPoints, x, result);
+   }
+};
+
+TEST(TFoam, BatchExploration)
+{
+   TRandom3 rng(4357);
+   BatchedCamel2 rho;
+   TFoam foam("foam");
+   foam.SetkDim(2);
+   foam.SetnCells(500);
+   foam.SetChat(0);
+   foam.SetRho(&rho);
+   foam.SetPseRan(&rng);
+   foam.SetBatchSize(50);
+   foam.Initialize();
+
+   EXPECT_GT(rho.fNBatches, 0);
+   // both daughters of a divided cell are evaluated together
+   EXPECT_EQ(rho.fMaxPoints, 100);
+
+   for (int i = 0; i < 20000; ++i)
+      foam.MakeEvent();
+   double integral, error;
+   foam.GetIntegMC(integral, error);
+   EXPECT_NEAR(integral, 1., 5 * error + 1e-3);
+}
@@ -16,6 +16,8 @@
 
 #include "RtypesCore.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 #include <vector>
 #include <string>
 
@@ -42,6 +44,7 @@ struct GeneticMinimizerParameters {
    Double_t fSC_factor;
    Double_t fConvCrit;
    Int_t fSeed;
+   ROOT::EExecutionPolicy fExecutionPolicy; // how the fitness of the individuals of a generation is evaluated
 
 
    // constructor with default value
@@ -56,6 +59,11 @@ struct GeneticMinimizerParameters {
 
    Minimizer class based on the Gentic algorithm implemented in TMVA
 
+   With the execution policy ROOT::EExecutionPolicy::kMultiThread the individuals of
+   each generation are evaluated in parallel, which requires a thread-safe objective
+   function. The random numbers are only drawn between the evaluations, so the
+   result does not depend on the execution policy.
+
    @ingroup MultiMin
 */
 class GeneticMinimizer: public ROOT::Math::Minimizer {
@@ -93,6 +101,8 @@ public:
 
    void SetRandomSeed(int seed) { fParameters.fSeed = seed; }
 
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy) { fParameters.fExecutionPolicy = policy; }
+
    const GeneticMinimizerParameters & MinimizerParameters() const { return fParameters; }
 
    ROOT::Math::MinimizerOptions Options() const override;
@@ -8,7 +8,14 @@
 
 #include "TError.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
+
 #include <cassert>
+#include <cfloat>
+#include <memory>
 
 namespace ROOT {
 namespace Math {
@@ -73,12 +80,66 @@ public:
       return fFunc(&x[0]);
    }
 
+   // evaluate without using the shared vector of the parameters, to be called from several threads
+   Double_t EvaluateConcurrently(const std::vector<double> & factors ) const {
+      unsigned int n = fValues.size();
+      if (n == 0 || fNFree == n )
+         return fFunc(&factors[0]);
+
+      std::vector<double> x(fValues);
+      for (unsigned int i = 0, j = 0; i < n ; ++i) {
+         if (!fFixedParFlag[i] ) x[i] = factors[j++];
+      }
+      return fFunc(&x[0]);
+   }
+
+   void AddCalls(unsigned int ncalls) { fNCalls += ncalls; }
+
    Double_t EstimatorFunction(std::vector<double> & factors ){
       fNCalls += 1;
       return Evaluate( factors);
    }
 };
 
+// genetic algorithm evaluating the individuals of a generation in parallel
+class ParallelGeneticAlgorithm : public TMVA::GeneticAlgorithm {
+private:
+   MultiGenFunctionFitness& fFitness;
+
+public:
+   ParallelGeneticAlgorithm(MultiGenFunctionFitness& fitness, Int_t populationSize,
+                            const std::vector<TMVA::Interval*>& ranges, UInt_t seed)
+      : TMVA::GeneticAlgorithm(fitness, populationSize, ranges, seed), fFitness(fitness)
+   {}
+
+   Double_t CalculateFitness() override {
+#ifdef R__USE_IMT
+      // only the evaluations run in parallel, the population is updated in order as in the base class
+      const int n = fPopulation.GetPopulationSize();
+      std::vector<double> values(n);
+      auto evaluate = [&](int index) {
+         values[index] = fFitness.EvaluateConcurrently(fPopulation.GetGenes(index)->GetFactors());
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(evaluate, ROOT::TSeqI(n));
+      fFitness.AddCalls(n);
+
+      fBestFitness = DBL_MAX;
+      for (int index = 0; index < n; ++index) {
+         TMVA::GeneticGenes* genes = fPopulation.GetGenes(index);
+         Double_t fitness = NewFitness(genes->GetFitness(), values[index]);
+         genes->SetFitness(fitness);
+         if (fBestFitness > fitness)
+            fBestFitness = fitness;
+      }
+      fPopulation.Sort();
+      return fBestFitness;
+#else
+      return TMVA::GeneticAlgorithm::CalculateFitness();
+#endif
+   }
+};
+
 GeneticMinimizerParameters::GeneticMinimizerParameters()
 {
    // constructor of parameters with default values (use 100 is max iterations is not defined)
@@ -92,6 +153,7 @@ GeneticMinimizerParameters::GeneticMinimizerParameters()
    fConvCrit =10.0 * ROOT::Math::MinimizerOptions::DefaultTolerance(); // default is 0.001
    if (fConvCrit <=0 ) fConvCrit = 0.001;
    fSeed=0;  // random seed
+   fExecutionPolicy = ROOT::EExecutionPolicy::kSequential;
 }
 
 // genetic minimizer class
@@ -211,6 +273,7 @@ void  GeneticMinimizer::GetGeneticOptions(ROOT::Math::MinimizerOptions & opt) co
    geneticOpt.SetValue("SC_factor",fParameters.fSC_factor);
    geneticOpt.SetValue("ConvCrit",fParameters.fConvCrit);
    geneticOpt.SetValue("RandomSeed",fParameters.fSeed);
+   geneticOpt.SetValue("ExecutionPolicy",static_cast<int>(fParameters.fExecutionPolicy));
 
    opt.SetExtraOptions(geneticOpt);
 }
@@ -240,6 +303,9 @@ void GeneticMinimizer::SetOptions(const ROOT::Math::MinimizerOptions & opt)
    geneticOpt->GetValue("SC_factor",fParameters.fSC_factor);
    geneticOpt->GetValue("ConvCrit",fParameters.fConvCrit);
    geneticOpt->GetValue("RandomSeed",fParameters.fSeed);
+   int policy = static_cast<int>(fParameters.fExecutionPolicy);
+   if (geneticOpt->GetValue("ExecutionPolicy",policy))
+      fParameters.fExecutionPolicy = static_cast<ROOT::EExecutionPolicy>(policy);
 
    // use same of options in base class
    int maxiter = opt.MaxIterations();
@@ -262,7 +328,27 @@ bool GeneticMinimizer::Minimize()
    if (MaxIterations() > 0) fParameters.fNsteps = MaxIterations();
    if (Tolerance() > 0) fParameters.fConvCrit = 10* Tolerance();
 
-   TMVA::GeneticAlgorithm mg( *fFitness, fParameters.fPopSize, fRanges, fParameters.fSeed );
+   ROOT::EExecutionPolicy policy = fParameters.fExecutionPolicy;
+#ifndef R__USE_IMT
+   if (policy == ROOT::EExecutionPolicy::kMultiThread) {
+      Warning("GeneticMinimizer::Minimize", "Multithread execution policy requires IMT, which is disabled. Changing "
+                                            "to ROOT::EExecutionPolicy::kSequential.");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
+   if (policy == ROOT::EExecutionPolicy::kMultiProcess) {
+      Warning("GeneticMinimizer::Minimize", "Multiprocess execution policy is not supported. Changing "
+                                            "to ROOT::EExecutionPolicy::kSequential.");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+
+   std::unique_ptr<TMVA::GeneticAlgorithm> algorithm;
+   if (policy == ROOT::EExecutionPolicy::kMultiThread)
+      algorithm.reset(new ParallelGeneticAlgorithm(*static_cast<MultiGenFunctionFitness*>(fFitness),
+                                                   fParameters.fPopSize, fRanges, fParameters.fSeed));
+   else
+      algorithm.reset(new TMVA::GeneticAlgorithm(*fFitness, fParameters.fPopSize, fRanges, fParameters.fSeed));
+   TMVA::GeneticAlgorithm &mg = *algorithm;
 
    if (PrintLevel() > 0) {
       std::cout << "GeneticMinimizer::Minimize  - Start iterating - max iterations = " <<  MaxIterations()
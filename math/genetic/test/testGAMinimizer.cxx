@@ -1,3 +1,4 @@
+#include <atomic>
 #include <iostream>
 
 #include "Math/GeneticMinimizer.h"
@@ -23,7 +24,7 @@ public :
    unsigned int getNCalls() { return fNCalls; }
 
    private:
-   mutable unsigned int fNCalls;
+   mutable std::atomic<unsigned int> fNCalls;
 
    inline double DoEval (const double * x) const {
       fNCalls++;
@@ -121,6 +122,29 @@ int testGAMinimizer(int verbose = 0) {
    if (!ok) Error("testGAMinimizer","Test failed for MultiMin");
    status |= !ok;
 
+#ifdef R__USE_IMT
+   if (verbose) {
+      cout << "****************************************************\n";
+      cout << "Rosenbrock Function Minimization in parallel \n";
+   }
+   ROOT::Math::GeneticMinimizer gaParallel;
+   RosenBrockFunction parallelRosenBrock;
+   gaParallel.SetFunction(parallelRosenBrock);
+   gaParallel.SetLimitedVariable(0, "x", 0, 0, -5, +5);
+   gaParallel.SetLimitedVariable(1, "y", 0, 0, -5, +5);
+   gaParallel.SetPrintLevel(verbose);
+   gaParallel.SetMaxIterations(500);
+   gaParallel.SetRandomSeed(111);
+   gaParallel.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread);
+   gaParallel.Minimize();
+   cout << "Parallel RosenBrock min: " << gaParallel.MinValue() << endl;
+   // the random numbers do not depend on the evaluation order
+   ok = gaParallel.MinValue() == gaRosenBrock.MinValue() && gaParallel.X()[0] == xmin[0] &&
+        gaParallel.X()[1] == xmin[1] && gaParallel.NCalls() == gaRosenBrock.NCalls();
+   if (!ok) Error("testGAMinimizer","Test failed for parallel RosenBrock");
+   status |= !ok;
+#endif
+
    if (status) cout << "Test Failed !" << endl;
    else cout << "Done!" << endl;
 
@@ -18,6 +18,8 @@
 
 #include "Math/VirtualIntegrator.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 namespace ROOT {
 namespace Math {
 
@@ -166,6 +168,14 @@ public:
    ///set max points
    void SetMaxPts(unsigned int n) { fMaxPts = n; }
 
+   /// set the execution policy used to evaluate the integrand on the nodes of a region.
+   /// With ROOT::EExecutionPolicy::kMultiThread the function is evaluated concurrently, so it must be thread safe.
+   /// The result does not depend on the execution policy.
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy) { fExecPolicy = policy; }
+
+   /// get the execution policy used to evaluate the integrand
+   ROOT::EExecutionPolicy GetExecutionPolicy() const { return fExecPolicy; }
+
    /// set the options
    void SetOptions(const ROOT::Math::IntegratorMultiDimOptions & opt) override;
 
@@ -191,6 +201,7 @@ protected:
    double fRelError;      ///< Relative error
    int    fNEval;         ///< number of function evaluation
    int fStatus;           ///< status of algorithm (error if not zero)
+   ROOT::EExecutionPolicy fExecPolicy; ///< execution policy of the function evaluations
 
    const IMultiGenFunction* fFun;   // pointer to integrand function
 
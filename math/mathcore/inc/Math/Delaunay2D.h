@@ -22,6 +22,7 @@
 
 
 #include "RtypesCore.h"
+#include "ROOT/EExecutionPolicy.hxx"
 
 #include <map>
 #include <vector>
@@ -97,6 +98,12 @@ public:
    /// points are aligned, then a default value of zero is always return
    double  Interpolate(double x, double y);
 
+   /// Compute the interpolated z values of n points (x[i],y[i]) into z[i].
+   /// With the kMultiThread execution policy the points are interpolated in parallel,
+   /// after the triangles are found.
+   void    Interpolate(int n, const double *x, const double *y, double *z,
+                       ROOT::EExecutionPolicy executionPolicy = ROOT::EExecutionPolicy::kSequential);
+
    /// Find all triangles
    void      FindAllTriangles();
 
@@ -261,12 +268,17 @@ protected:
    /* To speed up localisation of points a grid is layed over normalized space
     *
     * A reference to triangle ABC is added to _all_ grid cells that include ABC's bounding box
+    * The number of cells grows with the number of points, such that a cell holds a few triangles.
+    * The triangles of cell c are fCellTriangles[fCellStart[c]] to fCellTriangles[fCellStart[c+1]-1],
+    * in increasing order.
     */
 
-   static const int fNCells = 25; ///<! number of cells to divide the normalized space
+   static const int fMinNCells = 25; ///<! minimum number of cells to divide the normalized space
+   int fNCells = fMinNCells; ///<! number of cells to divide the normalized space
    double fXCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fXNmax - fXNmin)
    double fYCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fYNmax - fYNmin)
-   std::set<UInt_t> fCells[(fNCells+1)*(fNCells+1)]; ///<! grid cells with containing triangles
+   std::vector<UInt_t> fCellStart; ///<! index of the first triangle of each grid cell in fCellTriangles
+   std::vector<UInt_t> fCellTriangles; ///<! triangles of the grid cells
 
    inline unsigned int Cell(UInt_t x, UInt_t y) const {
       return x*(fNCells+1) + y;
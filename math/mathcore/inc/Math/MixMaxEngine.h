@@ -131,6 +131,9 @@ http://dx.doi.org/10.1016/j.chaos.2016.05.003
          /// set the generator seed
          void  SetSeed(Result_t seed);
 
+         /// set the seed of the independent stream `stream` of the generator, the stream 0 is the same as SetSeed(seed)
+         void  SetSeed(Result_t seed, uint32_t stream);
+
          // generate a random number (virtual interface)
          double Rndm() override { return Rndm_impl(); }
 
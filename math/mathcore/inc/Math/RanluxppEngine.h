@@ -38,11 +38,15 @@ public:
    double Rndm() override;
    /// Generate a double-precision random number (non-virtual method)
    double operator()();
+   /// Generate `n` double-precision random numbers, equal to `n` calls of operator()
+   void RndmArray(int n, double *array);
    /// Generate a random integer value with 48 bits
    uint64_t IntRndm();
 
    /// Initialize and seed the state of the generator
    void SetSeed(uint64_t seed);
+   /// Initialize the state of the generator at the start of the independent stream `stream` of `seed`
+   void SetSeed(uint64_t seed, uint32_t stream);
    /// Skip `n` random numbers without generating them
    void Skip(uint64_t n);
 
@@ -43,6 +43,53 @@
 #include "TRandom.h"
 
 #include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ROOT {
+namespace Internal {
+
+/// Whether the engine generates arrays of numbers with a RndmArray(int n, double *array) method
+template <class Engine, class = void>
+struct HasRndmArray : std::false_type {};
+template <class Engine>
+struct HasRndmArray<Engine, decltype(std::declval<Engine &>().RndmArray(0, (double *)nullptr), void())>
+   : std::true_type {};
+
+/// Whether the engine has independent streams, set with a SetSeed(uint64_t seed, uint32_t stream) method
+template <class Engine, class = void>
+struct HasSeedStream : std::false_type {};
+template <class Engine>
+struct HasSeedStream<Engine, decltype(std::declval<Engine &>().SetSeed(0, 0u), void())> : std::true_type {};
+
+template <class Engine>
+void EngineRndmArray(Engine &engine, int n, double *array, std::true_type)
+{
+   engine.RndmArray(n, array);
+}
+template <class Engine>
+void EngineRndmArray(Engine &engine, int n, double *array, std::false_type)
+{
+   for (int i = 0; i < n; ++i)
+      array[i] = engine();
+}
+
+/// Return false if the engine does not support streams and a stream other than 0 is requested
+template <class Engine>
+bool EngineSetSeed(Engine &engine, unsigned long seed, unsigned int stream, std::true_type)
+{
+   engine.SetSeed(seed, stream);
+   return true;
+}
+template <class Engine>
+bool EngineSetSeed(Engine &engine, unsigned long seed, unsigned int stream, std::false_type)
+{
+   engine.SetSeed(seed);
+   return stream == 0;
+}
+
+} // namespace Internal
+} // namespace ROOT
 
 template<class Engine>
 class TRandomGen : public TRandom {
@@ -57,6 +104,13 @@ public:
       SetName(TString::Format("Random_%s", std::string(fEngine.Name()).c_str()));
       SetTitle(TString::Format("Random number generator: %s", std::string(fEngine.Name()).c_str()));
    }
+   /// Create the generator at the start of the independent stream `stream` of `seed`, e.g. one stream per thread.
+   /// It is supported by the MixMax and Ranlux++ engines.
+   TRandomGen(ULong_t seed, UInt_t stream) {
+      SetSeed(seed, stream);
+      SetName(TString::Format("Random_%s", std::string(fEngine.Name()).c_str()));
+      SetTitle(TString::Format("Random number generator: %s", std::string(fEngine.Name()).c_str()));
+   }
    ~TRandomGen() override {}
    using TRandom::Rndm;
     Double_t Rndm( ) override { return fEngine(); }
@@ -64,11 +118,16 @@ public:
       for (int i = 0; i < n; ++i) array[i] = fEngine();
    }
     void     RndmArray(Int_t n, Double_t *array) override {
-            for (int i = 0; i < n; ++i) array[i] = fEngine();
+      ROOT::Internal::EngineRndmArray(fEngine, n, array, ROOT::Internal::HasRndmArray<Engine>{});
    }
     void     SetSeed(ULong_t seed=0) override {
       fEngine.SetSeed(seed);
    }
+   /// Set the seed of the independent stream `stream` of `seed`, the stream 0 is the same as SetSeed(seed).
+   void     SetSeed(ULong_t seed, UInt_t stream) {
+      if (!ROOT::Internal::EngineSetSeed(fEngine, seed, stream, ROOT::Internal::HasSeedStream<Engine>{}))
+         Error("SetSeed", "The engine %s does not support independent streams", std::string(fEngine.Name()).c_str());
+   }
 
    ClassDefOverride(TRandomGen,1)  //Generic Random number generator template on the Engine type
 };
@@ -6,8 +6,16 @@
 #include "Math/IntegratorOptions.h"
 #include "Math/Error.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
+
+#include <cassert>
 #include <cmath>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Math {
@@ -25,6 +33,7 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double rel
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
+   fExecPolicy(ROOT::EExecutionPolicy::kSequential),
    fFun(0)
 {
    // constructor - without passing a function
@@ -45,6 +54,7 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim( const IMultiGenFunction
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
+   fExecPolicy(ROOT::EExecutionPolicy::kSequential),
    fFun(&f)
 {
    // constructur passing a multi-dimensional function interface
@@ -182,7 +192,31 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
 
    unsigned int j1, k, l, m, idvaxn=0, idvax0=0, isbtmp, isbtpp;
 
-   //InitArgs(z,fParams);
+   // The irlcls nodes of the rule of a region are first all computed, then the function
+   // is evaluated on them (concurrently with the multi-thread execution policy), and finally
+   // the sums of the function values are computed in the original order
+   std::vector<double> nodes(irlcls * n);
+   std::vector<double> fvals(irlcls);
+   unsigned int inode;
+   auto addNode = [&]() {
+      std::copy(z, z + n, nodes.begin() + inode * n);
+      ++inode;
+   };
+   auto evalNode = [&](unsigned int i) { fvals[i] = (*fFun)(nodes.data() + i * n); };
+   auto nodeValue = [&](unsigned int i) { return absValue ? std::abs(fvals[i]) : fvals[i]; };
+
+   ROOT::EExecutionPolicy execPolicy = fExecPolicy;
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> pool;
+   if (execPolicy == ROOT::EExecutionPolicy::kMultiThread)
+      pool = std::make_unique<ROOT::TThreadExecutor>();
+#else
+   if (execPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_WARN_MSG("AdaptiveIntegratorMultiDim::Integral",
+                    "Multithread execution policy requires IMT, which is disabled. Integrate sequentially");
+      execPolicy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
 
 L20:
    rgnvol = twondm;//=2^n
@@ -190,39 +224,23 @@ L20:
       rgnvol *= wth[j]; //region volume
       z[j]    = ctr[j]; //temporary node
    }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
-
-   difmax = 0;
-   sum2   = 0;
-   sum3   = 0;
+   inode = 0;
+   addNode(); // center of the region
 
    //loop over coordinates
    for (j=0; j<n; j++) {
       z[j]    = ctr[j] - xl2*wth[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
+      addNode();
       z[j]    = ctr[j] + xl2*wth[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
+      addNode();
       wthl[j] = xl4*wth[j];
       z[j]    = ctr[j] - wthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
+      addNode();
       z[j]    = ctr[j] + wthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
-      sum2   += f2;//sum func eval with different weights separately
-      sum3   += f3;//for a given region
-      dif     = std::abs(7*f2-f3-12*sum1);
-      //storing dimension with biggest error/difference (?)
-      if (dif >= difmax) {
-         difmax=dif;
-         idvaxn=j+1;
-      }
+      addNode();
       z[j]    = ctr[j];
    }
 
-   sum4 = 0;
    for (j=1;j<n;j++) {
       j1 = j-1;
       for (k=j;k<n;k++) {
@@ -232,8 +250,7 @@ L20:
             for (m=0;m<2;m++) {
                wthl[k] = -wthl[k];
                z[k]    = ctr[k] + wthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
+               addNode();
             }
          }
          z[k] = ctr[k];
@@ -241,21 +258,61 @@ L20:
       z[j1] = ctr[j1];
    }
 
-   sum5 = 0;
-
    for (j=0;j<n;j++) {
       wthl[j] = -xl5*wth[j];
       z[j] = ctr[j] + wthl[j];
    }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
-   for (j=0;j<n;j++) {
-      wthl[j] = -wthl[j];
-      z[j] = ctr[j] + wthl[j];
-      if (wthl[j] > 0) goto L90;
+   //end nodes ~gray codes
+   for (bool moreNodes = true; moreNodes;) {
+      addNode();
+      moreNodes = false;
+      for (j=0;j<n;j++) {
+         wthl[j] = -wthl[j];
+         z[j] = ctr[j] + wthl[j];
+         if (wthl[j] > 0) {
+            moreNodes = true;
+            break;
+         }
+      }
+   }
+   assert(inode == irlcls);
+
+#ifdef R__USE_IMT
+   if (pool)
+      pool->Foreach(evalNode, ROOT::TSeqU(irlcls));
+   else
+#endif
+      for (inode = 0; inode < irlcls; inode++)
+         evalNode(inode);
+
+   inode = 0;
+   sum1 = fvals[inode++]; //function value at the center
+
+   difmax = 0;
+   sum2   = 0;
+   sum3   = 0;
+   for (j=0; j<n; j++) {
+      f2 = nodeValue(inode) + nodeValue(inode + 1);
+      f3 = nodeValue(inode + 2) + nodeValue(inode + 3);
+      inode += 4;
+      sum2   += f2;//sum func eval with different weights separately
+      sum3   += f3;//for a given region
+      dif     = std::abs(7*f2-f3-12*sum1);
+      //storing dimension with biggest error/difference (?)
+      if (dif >= difmax) {
+         difmax=dif;
+         idvaxn=j+1;
+      }
    }
 
+   sum4 = 0;
+   for (unsigned int i4 = 0; i4 < 2 * n * (n - 1); i4++)
+      sum4 += nodeValue(inode++);
+
+   sum5 = 0;
+   while (inode < irlcls)
+      sum5 += nodeValue(inode++);
+
    rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
    rgnval  = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
    rgnval *= rgnvol;
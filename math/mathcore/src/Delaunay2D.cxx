@@ -13,6 +13,12 @@
 
 #include "Math/Delaunay2D.h"
 #include "Rtypes.h"
+#include "Math/Error.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
 
 //#include <thread>
 
@@ -23,6 +29,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <stdlib.h>
 
 namespace ROOT {
@@ -135,6 +142,31 @@ double Delaunay2D::Interpolate(double x, double y)
    return zz;
 }
 
+//______________________________________________________________________________
+void Delaunay2D::Interpolate(int n, const double *x, const double *y, double *z,
+                             ROOT::EExecutionPolicy executionPolicy)
+{
+   // Compute the interpolated z values of n points
+
+   // find the triangles once, the interpolation of the points only reads them
+   FindAllTriangles();
+
+   auto interpolate = [&](int i) { z[i] = Interpolate(x[i], y[i]); };
+
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+#ifdef R__USE_IMT
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(interpolate, ROOT::TSeqI(n));
+      return;
+#else
+      MATH_WARN_MSG("Delaunay2D::Interpolate",
+                    "Multithread execution policy requires IMT, which is disabled. Interpolate sequentially");
+#endif
+   }
+   for (int i = 0; i < n; ++i)
+      interpolate(i);
+}
+
 //______________________________________________________________________________
 void Delaunay2D::FindAllTriangles()
 {
@@ -253,11 +285,18 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
 
 /// Triangle implementation for normalizing the points
 void Delaunay2D::DoNormalizePoints() {
+   fXN.clear();
+   fYN.clear();
+   fXN.reserve(fNpoints);
+   fYN.reserve(fNpoints);
    for (Int_t n = 0; n < fNpoints; n++) {
       fXN.push_back(Linear_transform(fX[n], fOffsetX, fScaleFactorX));
       fYN.push_back(Linear_transform(fY[n], fOffsetY, fScaleFactorY));
    }
 
+   // about one point, i.e. two triangles, per cell for large sets of points
+   fNCells = std::max(fMinNCells, std::min(2048, int(std::sqrt(double(fNpoints)))));
+
    //also initialize fXCellStep and FYCellStep
    fXCellStep = fNCells / (fXNmax - fXNmin);
    fYCellStep = fNCells / (fYNmax - fYNmin);
@@ -334,6 +373,23 @@ void Delaunay2D::DoFindTriangles() {
 
    triangulate((char *) "zQN", &in, &out, nullptr);
 
+   auto cellRange = [&] (const Triangle & tri, unsigned int & cellXmin, unsigned int & cellXmax,
+                         unsigned int & cellYmin, unsigned int & cellYmax) {
+      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
+      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
+
+      cellXmin = CellX(bx.first);
+      cellXmax = CellX(bx.second);
+
+      cellYmin = CellY(by.first);
+      cellYmax = CellY(by.second);
+   };
+
+   // count the triangles of each grid cell, then store them one cell after the other
+   const unsigned int nGridCells = (fNCells+1)*(fNCells+1);
+   fCellStart.assign(nGridCells + 1, 0);
+   fCellTriangles.clear();
+
    fTriangles.resize(out.numberoftriangles);
    for(int t = 0; t < out.numberoftriangles; ++t){
       Triangle tri;
@@ -363,19 +419,26 @@ void Delaunay2D::DoFindTriangles() {
 
       fTriangles[t] = tri;
 
-      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
-      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
-
-      unsigned int cellXmin = CellX(bx.first);
-      unsigned int cellXmax = CellX(bx.second);
-
-      unsigned int cellYmin = CellY(by.first);
-      unsigned int cellYmax = CellY(by.second);
+      unsigned int cellXmin, cellXmax, cellYmin, cellYmax;
+      cellRange(tri, cellXmin, cellXmax, cellYmin, cellYmax);
+      for(unsigned int i = cellXmin; i <= cellXmax; ++i) {
+         for(unsigned int j = cellYmin; j <= cellYmax; ++j) {
+            ++fCellStart[Cell(i,j) + 1];
+         }
+      }
+   }
 
+   for(unsigned int c = 0; c < nGridCells; ++c)
+      fCellStart[c + 1] += fCellStart[c];
+   fCellTriangles.resize(fCellStart[nGridCells]);
+   std::vector<UInt_t> next(fCellStart.begin(), fCellStart.end() - 1);
+   for(int t = 0; t < out.numberoftriangles; ++t){
+      unsigned int cellXmin, cellXmax, cellYmin, cellYmax;
+      cellRange(fTriangles[t], cellXmin, cellXmax, cellYmin, cellYmax);
       for(unsigned int i = cellXmin; i <= cellXmax; ++i) {
          for(unsigned int j = cellYmin; j <= cellYmax; ++j) {
             //printf("(%u,%u) = %u\n", i, j, Cell(i,j));
-            fCells[Cell(i,j)].insert(t);
+            fCellTriangles[next[Cell(i,j)]++] = t;
          }
       }
    }
@@ -413,7 +476,9 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
    if(cX < 0 || cX > fNCells || cY < 0 || cY > fNCells)
       return fZout; //TODO some more fancy interpolation here
 
-    for(unsigned int t : fCells[Cell(cX, cY)]){
+    const unsigned int cell = Cell(cX, cY);
+    for(unsigned int k = fCellStart[cell]; k < fCellStart[cell + 1]; ++k){
+       const unsigned int t = fCellTriangles[k];
        auto coords = bayCoords(t);
 
        if(inTriangle(coords)){
@@ -436,14 +501,15 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
           //brute force found a triangle -> grid not
           printf("Found triangle %u for (%f,%f) -> (%u,%u)\n", t, xx,yy, cX, cY);
           printf("Triangles in grid cell: ");
-          for(unsigned int x : fCells[Cell(cX, cY)])
-             printf("%u ", x);
+          for(unsigned int k = fCellStart[Cell(cX, cY)]; k < fCellStart[Cell(cX, cY) + 1]; ++k)
+             printf("%u ", fCellTriangles[k]);
           printf("\n");
 
           printf("Triangle %u is in cells: ", t);
           for(unsigned int i = 0; i <= fNCells; ++i)
              for(unsigned int j = 0; j <= fNCells; ++j)
-                if(fCells[Cell(i,j)].count(t))
+                if(std::count(fCellTriangles.begin() + fCellStart[Cell(i,j)],
+                              fCellTriangles.begin() + fCellStart[Cell(i,j) + 1], t))
                    printf("(%u,%u) ", i, j);
           printf("\n");
           for(unsigned int i = 0; i < 3; ++i)
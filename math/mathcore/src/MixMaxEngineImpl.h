@@ -56,6 +56,7 @@ namespace ROOT {
       }
       ~MixMaxEngineImpl() {}
       void SetSeed(uint64_t) { }
+      void SetSeed(uint64_t, uint32_t) { }
       double Rndm() { return -1; }
       double IntRndm() { return 0; }
       void SetState(const std::vector<uint64_t> &) { }
@@ -63,6 +64,7 @@ namespace ROOT {
       int Counter() { return -1; }
       void SetCounter(int) {}
       void Iterate() {} 
+      void IterateAndConvert(double *) {}
    };
 
 
@@ -88,6 +90,9 @@ public:
       //seed_spbox(fRngState, seed);
       seed_uniquestream(fRngState, 0, 0, (uint32_t)(seed>>32), (uint32_t)seed );
    }
+   void SetSeed(Result_t seed, uint32_t stream) {
+      seed_uniquestream(fRngState, 0, stream, (uint32_t)(seed>>32), (uint32_t)seed );
+   }
    double Rndm() {
        return get_next_float(fRngState);
    }
@@ -108,6 +113,13 @@ public:
    void Iterate() {
       iterate(fRngState); 
    }
+   // iterate and convert the N-1 new numbers in array, in the same order as Rndm()
+   void IterateAndConvert(double * array) {
+      fRngState->sumtot = iterate_raw_vec(fRngState->V, fRngState->sumtot);
+      fRngState->counter = ROOT_MM_N;
+      for (int i = 1; i < ROOT_MM_N; ++i)
+         array[i-1] = (int64_t)fRngState->V[i] * (double)(INV_MERSBASE);
+   }
    int Counter() const {
       return fRngState->counter; 
    }
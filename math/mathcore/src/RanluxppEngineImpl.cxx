@@ -42,6 +42,7 @@ chaotic dynamical system.
 #include "ranluxpp/ranlux_lcg.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 
 namespace {
@@ -181,6 +182,20 @@ private:
       Advance(RanluxppData<24>::kA);
    }
 
+   /// Return the w random bits of the current block starting at the given position
+   uint64_t RandomBitsAt(int position) const
+   {
+      int idx = position / 64;
+      int offset = position % 64;
+      int numBits = 64 - offset;
+
+      uint64_t bits = fState[idx] >> offset;
+      if (numBits < w) {
+         bits |= fState[idx + 1] << numBits;
+      }
+      return bits & ((uint64_t(1) << w) - 1);
+   }
+
 public:
    /// Return the next random bits, generate a new block if necessary
    uint64_t NextRandomBits()
@@ -189,15 +204,7 @@ public:
          Advance();
       }
 
-      int idx = fPosition / 64;
-      int offset = fPosition % 64;
-      int numBits = 64 - offset;
-
-      uint64_t bits = fState[idx] >> offset;
-      if (numBits < w) {
-         bits |= fState[idx + 1] << numBits;
-      }
-      bits &= ((uint64_t(1) << w) - 1);
+      uint64_t bits = RandomBitsAt(fPosition);
 
       fPosition += w;
       assert(fPosition <= kMaxPos && "position out of range!");
@@ -213,6 +220,30 @@ public:
       return bits * div;
    }
 
+   /// Fill the array with the next n floating point numbers, in the same order as NextRandomFloat().
+   void NextRandomFloats(double *array, std::size_t n)
+   {
+      static constexpr double div = 1.0 / (uint64_t(1) << w);
+      static constexpr int kNumbersPerBlock = kMaxPos / w;
+
+      std::size_t i = 0;
+      // Use the numbers left in the current block.
+      for (; i < n && fPosition + w <= kMaxPos; i++) {
+         array[i] = NextRandomFloat();
+      }
+      // Convert whole blocks, with the positions of the numbers known at compile time.
+      for (; n - i >= std::size_t(kNumbersPerBlock); i += kNumbersPerBlock) {
+         Advance();
+         for (int j = 0; j < kNumbersPerBlock; j++) {
+            array[i + j] = RandomBitsAt(j * w) * div;
+         }
+         fPosition = kNumbersPerBlock * w;
+      }
+      for (; i < n; i++) {
+         array[i] = NextRandomFloat();
+      }
+   }
+
    /// Initialize and seed the state of the generator as in James' implementation
    void SetSeedJames(uint64_t s)
    {
@@ -290,7 +321,10 @@ public:
    }
 
    /// Initialize and seed the state of the generator as proposed by Sibidanov
-   void SetSeedSibidanov(uint64_t s)
+   ///
+   /// The sequences of two seeds are 2 ** 96 states apart. Within the sequence of a seed, the streams start 2 ** 64
+   /// states apart, so that the streams of all seeds are independent.
+   void SetSeedSibidanov(uint64_t s, uint32_t stream = 0)
    {
       uint64_t lcg[9];
       lcg[0] = 1;
@@ -304,6 +338,14 @@ public:
       powermod(a_seed, a_seed, uint64_t(1) << 48);
       // Skip another s states.
       powermod(a_seed, a_seed, s);
+      if (stream > 0) {
+         // Skip stream * 2 ** 64 states.
+         uint64_t a_stream[9];
+         powermod(kA, a_stream, uint64_t(1) << 32);
+         powermod(a_stream, a_stream, uint64_t(1) << 32);
+         powermod(a_stream, a_stream, stream);
+         mulmod(a_stream, a_seed);
+      }
       mulmod(a_seed, lcg);
 
       to_ranlux(lcg, fState, fCarry);
@@ -380,7 +422,7 @@ public:
       n -= left;
       // Need to advance and possibly skip over blocks.
       int nPerState = kMaxPos / w;
-      int skip = (n / nPerState);
+      uint64_t skip = (n / nPerState);
 
       uint64_t a_skip[9];
       powermod(kA, a_skip, skip + 1);
@@ -419,6 +461,12 @@ double RanluxppEngine<p>::operator()()
    return fImpl->NextRandomFloat();
 }
 
+template <int p>
+void RanluxppEngine<p>::RndmArray(int n, double *array)
+{
+   fImpl->NextRandomFloats(array, n);
+}
+
 template <int p>
 uint64_t RanluxppEngine<p>::IntRndm()
 {
@@ -431,6 +479,12 @@ void RanluxppEngine<p>::SetSeed(uint64_t seed)
    fImpl->SetSeedSibidanov(seed);
 }
 
+template <int p>
+void RanluxppEngine<p>::SetSeed(uint64_t seed, uint32_t stream)
+{
+   fImpl->SetSeedSibidanov(seed, stream);
+}
+
 template <int p>
 void RanluxppEngine<p>::Skip(uint64_t n)
 {
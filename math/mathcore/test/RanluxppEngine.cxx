@@ -16,6 +16,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 using namespace ROOT::Math;
 
 TEST(RanluxppEngine, random2048)
@@ -47,6 +49,41 @@ TEST(RanluxppEngine, random2048)
    EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
 
+TEST(RanluxppEngine, RndmArray)
+{
+   RanluxppEngine2048 rng1(314159265);
+   RanluxppEngine2048 rng2(314159265);
+
+   // Start in the middle of a block, then fill several whole blocks and a partial one.
+   for (int i = 0; i < 5; i++) {
+      EXPECT_EQ(rng1.Rndm(), rng2.Rndm());
+   }
+   std::vector<double> array(100);
+   rng1.RndmArray(array.size(), array.data());
+   for (double x : array) {
+      EXPECT_EQ(x, rng2.Rndm());
+   }
+   EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+}
+
+TEST(RanluxppEngine, Streams)
+{
+   RanluxppEngine2048 rng(314159265);
+   RanluxppEngine2048 stream0(1);
+   stream0.SetSeed(314159265, 0);
+   EXPECT_EQ(rng.IntRndm(), stream0.IntRndm());
+
+   // The stream 1 of a seed is 2 ** 64 states after its start, i.e. 12 * 2 ** 64 numbers.
+   RanluxppEngine2048 stream1(1);
+   stream1.SetSeed(314159265, 1);
+   RanluxppEngine2048 skipped(314159265);
+   for (int i = 0; i < 24; i++) {
+      skipped.Skip(uint64_t(1) << 63);
+   }
+   EXPECT_EQ(stream1.IntRndm(), skipped.IntRndm());
+   EXPECT_EQ(stream1.Rndm(), skipped.Rndm());
+}
+
 TEST(RanluxppCompatEngineJames, P3)
 {
    RanluxppCompatEngineJamesP3 rng(314159265);
@@ -0,0 +1,33 @@
+#include "Math/AdaptiveIntegratorMultiDim.h"
+#include "Math/Functor.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+namespace {
+double Integrand(const double *x)
+{
+   return std::exp(-x[0] * x[0] - 2 * x[1] * x[1] - 0.5 * x[2] * x[2]) * std::cos(x[0] * x[1] + x[2]);
+}
+} // namespace
+
+// The result of the integration must not depend on the execution policy of the function evaluations
+TEST(AdaptiveIntegratorMultiDim, ExecutionPolicy)
+{
+   ROOT::Math::Functor f(&Integrand, 3);
+   const double a[3] = {-2, -1, -3};
+   const double b[3] = {2, 3, 1};
+
+   ROOT::Math::AdaptiveIntegratorMultiDim ig(1.E-12, 1.E-9, 200000);
+   ig.SetFunction(f);
+   EXPECT_EQ(ig.GetExecutionPolicy(), ROOT::EExecutionPolicy::kSequential);
+   const double result = ig.Integral(a, b);
+   const double error = ig.Error();
+   const int nEval = ig.NEval();
+
+   ig.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread);
+   EXPECT_EQ(ig.Integral(a, b), result);
+   EXPECT_EQ(ig.Error(), error);
+   EXPECT_EQ(ig.NEval(), nEval);
+}
@@ -30,6 +30,13 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TDecompLU.h"
 #include "TMatrixDEigen.h"
 #include "TMath.h"
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "ROOT/TSeq.hxx"
+
+#include <algorithm>
 
 templateClassImp(TMatrixT);
 
@@ -3071,51 +3078,89 @@ TMatrixT<Element> &TMatrixTAutoloadOps::ElementDiv(TMatrixT<Element> &target,con
    return target;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call f(first, last) on ranges [first, last) of the nrows rows of the result
+/// of a matrix product that takes nmultPerRow multiplications per row. With
+/// implicit multi-threading, the ranges of rows of large products are computed
+/// concurrently; each element of the result is computed as without it.
+
+template <class F>
+void ForEachRowRange(Int_t nrows, Long64_t nmultPerRow, F &&f)
+{
+#ifdef R__USE_IMT
+   constexpr Long64_t kMinMultPerTask = 1 << 20;
+   const Long64_t nmult = nrows * nmultPerRow;
+   if (ROOT::IsImplicitMTEnabled() && nrows > 1 && nmult >= 2 * kMinMultPerTask) {
+      const Int_t nTasks = std::min<Long64_t>({(Long64_t)nrows, nmult / kMinMultPerTask,
+                                               4 * (Long64_t)ROOT::GetThreadPoolSize()});
+      const Int_t rowsPerTask = (nrows + nTasks - 1) / nTasks;
+      ROOT::TThreadExecutor pool;
+      auto task = [&](UInt_t itask) { f(itask * rowsPerTask, std::min(nrows, (Int_t)(itask + 1) * rowsPerTask)); };
+      pool.Foreach(task, ROOT::TSeqU(nTasks));
+      return;
+   }
+#else
+   (void)nmultPerRow;
+#endif
+   f(0, nrows);
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B
+///
+/// The products A[i,k]*B[k,j] are summed in the order of k as in a dot product,
+/// but the rows of B and C are scanned contiguously in the innermost loop, so
+/// that it vectorizes.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                     // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp+nb) {                     // Scan the i-th row of A and
-            cij += *arp++ * *bcp;                   // the j-th col of B
-            bcp += ncolsb;
+   if (na == 0 || ncolsb == 0) return;
+   const Int_t nrowsa = na/ncolsa;
+   const Int_t nrowsb = nb/ncolsb;
+   ForEachRowRange(nrowsa, (Long64_t)nrowsb*ncolsb, [&](Int_t first, Int_t last) {
+      for (Int_t i = first; i < last; i++) {
+         const Element *arp = ap+i*ncolsa;          // Pointer to the i-th row of A
+               Element *crp = cp+i*ncolsb;          // Pointer to the i-th row of C
+         std::fill(crp, crp+ncolsb, Element(0));
+         for (Int_t k = 0; k < nrowsb; k++) {
+            const Element aik = arp[k];
+            const Element *brp = bp+k*ncolsb;       // Pointer to the k-th row of B
+            for (Int_t j = 0; j < ncolsb; j++)
+               crp[j] += aik * brp[j];
          }
-         *cp++ = cij;
-         bcp -= nb-1;                              // Set bcp to the (j+1)-th col
       }
-      arp0 += ncolsa;                             // Set ap to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A^T*B
+///
+/// As in AMultB, the innermost loop scans the rows of B and C contiguously.
 
 template<class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element * const ap,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+ncolsa) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
+   if (ncolsa == 0 || ncolsb == 0) return;
+   const Int_t nrowsb = nb/ncolsb;
+   ForEachRowRange(ncolsa, (Long64_t)nrowsb*ncolsb, [&](Int_t first, Int_t last) {
+      for (Int_t i = first; i < last; i++) {
+         Element *crp = cp+i*ncolsb;                // Pointer to the i-th row of C
+         std::fill(crp, crp+ncolsb, Element(0));
+         for (Int_t k = 0; k < nrowsb; k++) {
+            const Element aki = ap[k*ncolsa+i];
+            const Element *brp = bp+k*ncolsb;       // Pointer to the k-th row of B
+            for (Int_t j = 0; j < ncolsb; j++)
+               crp[j] += aki * brp[j];
          }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
       }
-      acp0++;                           // Set acp0 to the (i+1)-th col
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3125,20 +3170,23 @@ template<class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                    // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      const Element *brp0 = bp;                  // Pointer to  B[j,0];
-      while (brp0 < bp+nb) {
-         const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
-            cij += *arp++ * *brp++;                 // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
+   if (na == 0 || ncolsa == 0) return;
+   const Int_t nrowsa = na/ncolsa;
+   ForEachRowRange(nrowsa, (Long64_t)nb, [&](Int_t first, Int_t last) {
+      Element *crp = cp+first*(ncolsb ? nb/ncolsb : 0);
+      for (const Element *arp0 = ap+first*ncolsa; arp0 < ap+last*ncolsa; arp0 += ncolsa) { // Pointer to A[i,0]
+         const Element *brp0 = bp;                  // Pointer to  B[j,0];
+         while (brp0 < bp+nb) {
+            const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
+            const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
+            Element cij = 0;
+            while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
+               cij += *arp++ * *brp++;                 // the j-th row of B
+            *crp++ = cij;
+            brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
+         }
       }
-      arp0 += ncolsa;                             // Set arp0 to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
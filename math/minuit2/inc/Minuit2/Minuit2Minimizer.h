@@ -30,6 +30,7 @@ class ModularFunctionMinimizer;
 class FCNBase;
 class FunctionMinimum;
 class MnTraceObject;
+class MinosError;
 
 // enumeration specifying the type of Minuit2 minimizers
 enum EMinimizerType { kMigrad, kSimplex, kCombined, kScan, kFumili, kMigradBFGS };
@@ -236,6 +237,16 @@ public:
    */
    bool GetMinosError(unsigned int i, double &errLow, double &errUp, int = 0) override;
 
+   /**
+      get the minos errors for several parameters, return false if Minos failed for any of them
+      The Minos scans of all the parameters are run concurrently if ROOT implicit multi-threading
+      is enabled, in which case the FCN has to be thread safe.
+      If a new minimum is found, the minimization is run again and the Minos errors are computed
+      one after the other with GetMinosError.
+   */
+   bool GetMinosErrors(const std::vector<unsigned int> &ipars, std::vector<double> &errLow,
+                       std::vector<double> &errUp);
+
    /**
       MINOS status code of last Minos run
        `status & 1 > 0`  : invalid lower error
@@ -304,6 +315,8 @@ protected:
 
    // internal function to compute Minos errors
    int RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt);
+   int ProcessMinosError(const ROOT::Minuit2::MinosError &me, bool runLower, bool runUpper, double &errLow,
+                         double &errUp);
 
 private:
    unsigned int fDim; // dimension of the function to be minimized
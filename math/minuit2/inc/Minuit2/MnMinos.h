@@ -13,6 +13,7 @@
 #include "Minuit2/MnStrategy.h"
 
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 
@@ -57,6 +58,12 @@ public:
    /// can be printed via std::cout
    MinosError Minos(unsigned int, unsigned int maxcalls = 0, double toler = 0.1) const;
 
+   /// ask for the MinosErrors of several parameters. The lower and upper crossings
+   /// are computed concurrently if the strategy allows it (MnStrategy::SetParallelMinos)
+   /// and ROOT implicit multi-threading is enabled, in which case the FCN has to be thread safe
+   std::vector<MinosError>
+   Minos(const std::vector<unsigned int> &, unsigned int maxcalls = 0, double toler = 0.1) const;
+
 protected:
    /// internal method to get crossing value via MnFunctionCross
    MnCross FindCrossValue(int dir, unsigned int, unsigned int maxcalls, double toler) const;
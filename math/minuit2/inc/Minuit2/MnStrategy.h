@@ -48,6 +48,9 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   bool ParallelGradient() const { return fParallelGradient; }
+   bool ParallelMinos() const { return fParallelMinos; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy >= 2; }
@@ -69,6 +72,16 @@ public:
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   // compute the derivatives of the numerical gradient for the different
+   // parameters concurrently on the ROOT implicit multi-threading pool, if
+   // it is enabled. The FCN has to be thread safe.
+   void SetParallelGradient(bool on) { fParallelGradient = on; }
+
+   // compute the Minos crossings of several parameters concurrently on the
+   // ROOT implicit multi-threading pool, if it is enabled, see
+   // MnMinos::Minos(const std::vector<unsigned int> &). The FCN has to be thread safe.
+   void SetParallelMinos(bool on) { fParallelMinos = on; }
+
 private:
    unsigned int fStrategy;
 
@@ -80,6 +93,8 @@ private:
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
    int fStoreLevel;
+   bool fParallelGradient;
+   bool fParallelMinos;
 };
 
 } // namespace Minuit2
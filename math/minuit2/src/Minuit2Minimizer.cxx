@@ -494,6 +494,10 @@ bool Minuit2Minimizer::Minimize()
       strategy.SetHessianStepTolerance(hessStepTol);
       strategy.SetHessianG2Tolerance(hessStepTol);
 
+      int parallelGradient = 0;
+      minuit2Opt->GetValue("ParallelGradient", parallelGradient);
+      strategy.SetParallelGradient(parallelGradient);
+
       int storageLevel = 1;
       bool ret = minuit2Opt->GetValue("StorageLevel", storageLevel);
       if (ret)
@@ -900,6 +904,92 @@ bool Minuit2Minimizer::GetMinosError(unsigned int i, double &errLow, double &err
    return isValid;
 }
 
+bool Minuit2Minimizer::GetMinosErrors(const std::vector<unsigned int> &ipars, std::vector<double> &errLow,
+                                      std::vector<double> &errUp)
+{
+   // return the minos errors for the parameters ipars, computing the lower and
+   // upper errors of all parameters at the same time
+
+   errLow.assign(ipars.size(), 0.);
+   errUp.assign(ipars.size(), 0.);
+
+   assert(fMinuitFCN);
+
+   MnPrint print("Minuit2Minimizer::GetMinosErrors", PrintLevel());
+
+   if (fMinimum == 0) {
+      print.Error("Failed - no function minimum existing");
+      return false;
+   }
+
+   if (!fMinimum->IsValid()) {
+      print.Error("Failed - invalid function minimum");
+      return false;
+   }
+
+   fMinuitFCN->SetErrorDef(ErrorDef());
+   // if error def has been changed update it in FunctionMinimum
+   if (ErrorDef() != fMinimum->Up())
+      fMinimum->SetErrorDef(ErrorDef());
+
+   // Minos errors can't be computed for constant or fixed parameters
+   std::vector<unsigned int> varPars;
+   for (unsigned int i : ipars) {
+      if (!fState.Parameter(i).IsConst() && !fState.Parameter(i).IsFixed())
+         varPars.push_back(i);
+   }
+
+   const int debugLevel = PrintLevel();
+   // switch off Minuit2 printing
+   const int prev_level = (debugLevel <= 0) ? TurnOffPrintInfoLevel() : -2;
+   const int prevGlobalLevel = MnPrint::SetGlobalLevel(debugLevel);
+
+   // set the precision if needed
+   if (Precision() > 0)
+      fState.SetPrecision(Precision());
+
+   // same strategy and tolerance for the migrad calls inside Minos as in RunMinosError
+   ROOT::Minuit2::MnStrategy strategy(1);
+   strategy.SetParallelMinos(true);
+   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum, strategy);
+   std::vector<ROOT::Minuit2::MinosError> minosErrors =
+      minos.Minos(varPars, MaxFunctionCalls(), std::max(Tolerance(), 0.01));
+
+   // restore global print level
+   if (prev_level > -2)
+      RestoreGlobalPrintLevel(prev_level);
+   MnPrint::SetGlobalLevel(prevGlobalLevel);
+
+   bool isValid = varPars.size() == ipars.size();
+   int newMinPar = -1;
+   auto me = minosErrors.begin();
+   for (std::size_t k = 0; k < ipars.size(); ++k) {
+      if (me == minosErrors.end() || me->Parameter() != ipars[k])
+         continue;
+      int mstatus = ProcessMinosError(*me, true, true, errLow[k], errUp[k]);
+      ++me;
+      if ((mstatus & 8) != 0 && newMinPar < 0)
+         newMinPar = ipars[k];
+      fStatus += 10 * mstatus;
+      fMinosStatus = mstatus;
+      isValid &= ((mstatus & 1) == 0) && ((mstatus & 2) == 0);
+   }
+
+   if (newMinPar >= 0) {
+      print.Info("Found a new minimum: run again the Minimization and Minos one parameter after the other");
+      // release parameter that was fixed in the returned state from Minos
+      ReleaseVariable(newMinPar);
+      if (!Minimize())
+         return false;
+      isValid = true;
+      for (std::size_t k = 0; k < ipars.size(); ++k) {
+         isValid &= GetMinosError(ipars[k], errLow[k], errUp[k]);
+      }
+   }
+
+   return isValid;
+}
+
 int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt)
 {
 
@@ -963,6 +1053,18 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       RestoreGlobalPrintLevel(prev_level);
    MnPrint::SetGlobalLevel(prevGlobalLevel);
 
+   return ProcessMinosError(me, runLower, runUpper, errLow, errUp);
+}
+
+int Minuit2Minimizer::ProcessMinosError(const ROOT::Minuit2::MinosError &me, bool runLower, bool runUpper,
+                                        double &errLow, double &errUp)
+{
+   // print the result of a Minos run, fill the errors and return the Minos status code
+
+   const unsigned int i = me.Parameter();
+   const int debugLevel = PrintLevel();
+   const char *par_name = fState.Name(i);
+
    // debug result of Minos
    // print error message in Minos
    // Note that the only invalid condition can happen when the (npar-1) minimization fails
@@ -1056,11 +1158,11 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
    // in case of new minimum found update also the  minimum state
    if ((runLower && me.LowerNewMin()) && (runUpper && me.UpperNewMin())) {
       // take state with lower function value
-      fState = (low.State().Fval() < up.State().Fval()) ? low.State() : up.State();
+      fState = (me.LowerState().Fval() < me.UpperState().Fval()) ? me.LowerState() : me.UpperState();
    } else if (runLower && me.LowerNewMin()) {
-      fState = low.State();
+      fState = me.LowerState();
    } else if (runUpper && me.UpperNewMin()) {
-      fState = up.State();
+      fState = me.UpperState();
    }
 
    return mstatus;
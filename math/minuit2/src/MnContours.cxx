@@ -56,7 +56,10 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    double valx = fMinimum.UserState().Value(px);
    double valy = fMinimum.UserState().Value(py);
 
-   MinosError mex = minos.Minos(px);
+   // the Minos errors of both parameters can be computed at the same time
+   std::vector<MinosError> mexy = minos.Minos(std::vector<unsigned int>{px, py});
+
+   MinosError mex = mexy[0];
    nfcn += mex.NFcn();
    if (!mex.IsValid()) {
       print.Error("unable to find first two points");
@@ -64,7 +67,7 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
    std::pair<double, double> ex = mex();
 
-   MinosError mey = minos.Minos(py);
+   MinosError mey = mexy[1];
    nfcn += mey.NFcn();
    if (!mey.IsValid()) {
       print.Error("unable to find second two points");
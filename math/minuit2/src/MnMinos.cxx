@@ -15,6 +15,16 @@
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnPrint.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -91,6 +101,37 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
    return MinosError(par, fMinimum.UserState().Value(par), lo, up);
 }
 
+std::vector<MinosError>
+MnMinos::Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls, double toler) const
+{
+   // do full minos error analysis for several parameters
+   // each crossing is an independent sequence of minimizations starting from the
+   // function minimum, so they can all be computed at the same time
+
+   std::vector<MnCross> crosses(2 * pars.size());
+   auto findCross = [&](unsigned int k) {
+      crosses[k] = FindCrossValue(k % 2 == 0 ? -1 : 1, pars[k / 2], maxcalls, toler);
+   };
+
+#ifdef R__USE_IMT
+   if (fStrategy.ParallelMinos() && ROOT::IsImplicitMTEnabled() && crosses.size() > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(findCross, ROOT::TSeqU(crosses.size()));
+   } else
+#endif
+   {
+      for (unsigned int k = 0; k < crosses.size(); ++k)
+         findCross(k);
+   }
+
+   std::vector<MinosError> result;
+   result.reserve(pars.size());
+   for (unsigned int i = 0; i < pars.size(); ++i) {
+      result.emplace_back(pars[i], fMinimum.UserState().Value(pars[i]), crosses[2 * i], crosses[2 * i + 1]);
+   }
+   return result;
+}
+
 MnCross MnMinos::FindCrossValue(int direction, unsigned int par, unsigned int maxcalls, double toler) const
 {
    // get crossing value in the parameter direction :
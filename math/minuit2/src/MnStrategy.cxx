@@ -13,13 +13,13 @@ namespace ROOT {
 
 namespace Minuit2 {
 
-MnStrategy::MnStrategy() : fStoreLevel(1)
+MnStrategy::MnStrategy() : fStoreLevel(1), fParallelGradient(false), fParallelMinos(false)
 {
    // default strategy
    SetMediumStrategy();
 }
 
-MnStrategy::MnStrategy(unsigned int stra) : fStoreLevel(1)
+MnStrategy::MnStrategy(unsigned int stra) : fStoreLevel(1), fParallelGradient(false), fParallelMinos(false)
 {
    // user defined strategy (0, 1, >=2)
    if (stra == 0)
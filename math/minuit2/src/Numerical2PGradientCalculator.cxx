@@ -21,9 +21,20 @@
 #include <omp.h>
 #endif
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 #include <cmath>
 #include <cassert>
 #include <iomanip>
+#include <mutex>
 
 #include "Minuit2/MPIProcess.h"
 
@@ -97,42 +108,18 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around value", fcnmin, "at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // Computes the derivative with respect to the internal parameter i,
+   // changing only the element i of x and restoring it at the end. The steps
+   // of the different parameters are independent of each other, so that the
+   // result does not depend on the order of the computations.
+   std::mutex printMutex;
+   auto computeComponent = [&](unsigned int i, MnAlgebraicVector &x, MnPrint &prt) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
       for (unsigned int j = 0; j < ncycle; j++) {
          double optstp = std::sqrt(dfmin / (std::fabs(g2(i)) + epspri));
          double step = std::max(optstp, std::fabs(0.1 * gstep(i)));
-         //       std::cout<<"step: "<<step;
          if (Trafo().Parameter(Trafo().ExtOfInt(i)).HasLimits()) {
             if (step > 0.5)
                step = 0.5;
@@ -140,24 +127,14 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          double stpmax = 10. * std::fabs(gstep(i));
          if (step > stpmax)
             step = stpmax;
-         //       std::cout<<" "<<step;
          double stpmin = std::max(vrysml, 8. * std::fabs(eps2 * x(i)));
          if (step < stpmin)
             step = stpmin;
-         //       std::cout<<" "<<step<<std::endl;
-         //       std::cout<<"step: "<<step<<std::endl;
          if (std::fabs((step - stepb4) / step) < StepTolerance()) {
-            //    std::cout<<"(step-stepb4)/step"<<std::endl;
-            //    std::cout<<"j= "<<j<<std::endl;
-            //    std::cout<<"step= "<<step<<std::endl;
             break;
          }
          gstep(i) = step;
          stepb4 = step;
-         //       MnAlgebraicVector pstep(n);
-         //       pstep(i) = step;
-         //       double fs1 = Fcn()(pstate + pstep);
-         //       double fs2 = Fcn()(pstate - pstep);
 
          x(i) = xtf + step;
          double fs1 = Fcn()(x);
@@ -169,30 +146,16 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
          {
-#ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
+            std::lock_guard<std::mutex> lock(printMutex);
             if (i == 0 && j == 0) {
-#ifdef _OPENMP
-               printtl.Debug([&](std::ostream &os) {
-#else
-               print.Debug([&](std::ostream &os) {
-#endif
+               prt.Debug([&](std::ostream &os) {
                   os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
                      << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
                      << std::setw(15) << "g2" << std::endl;
                });
             }
-#ifdef _OPENMP
-            printtl.Debug([&](std::ostream &os) {
-#else
-            print.Debug([&](std::ostream &os) {
-#endif
+            prt.Debug([&](std::ostream &os) {
                const int pr = os.precision(13);
                const int iext = Trafo().ExtOfInt(i);
                os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
@@ -202,24 +165,59 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          }
 
          if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / step) < GradTolerance()) {
-            //    std::cout<<"j= "<<j<<std::endl;
-            //    std::cout<<"step= "<<step<<std::endl;
-            //    std::cout<<"fs1, fs2: "<<fs1<<" "<<fs2<<std::endl;
-            //    std::cout<<"fs1-fs2: "<<fs1-fs2<<std::endl;
             break;
          }
       }
+   };
+
+#ifdef R__USE_IMT
+   if (Strategy().ParallelGradient() && ROOT::IsImplicitMTEnabled() && n > 1) {
+      // each task works on its own copy of the parameter vector
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            // must create thread-local MnPrint instances when printing inside threads
+            MnPrint printtl("Numerical2PGradientCalculator[IMT]");
+            MnAlgebraicVector x = par.Vec();
+            computeComponent(i, x, printtl);
+         },
+         ROOT::TSeqU(n));
+   } else
+#endif
+   {
+#ifndef _OPENMP
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
-   }
+      MPIProcess mpiproc(n, 0);
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
+         computeComponent(i, x, print);
+      }
+
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(g2);
+      mpiproc.SyncVector(gstep);
+
+#else
+
+      // parallelize this loop using OpenMP
+#pragma omp parallel
+#pragma omp for
+      for (int i = 0; i < int(n); i++) {
+         // create in loop since each thread will use its own copy
+         MnAlgebraicVector x = par.Vec();
+         // must create thread-local MnPrint instances when printing inside threads
+         MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
+         computeComponent(i, x, printtl);
+      }
 
-#ifndef _OPENMP
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(g2);
-   mpiproc.SyncVector(gstep);
 #endif
+   }
 
    // print after parallel processing to avoid synchronization issues
    print.Debug([&](std::ostream &os) {
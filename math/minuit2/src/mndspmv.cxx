@@ -218,18 +218,29 @@ int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, co
       /*        Form  y  when AP contains the Upper triangle. */
 
       if (incx == 1 && incy == 1) {
+         // Column j of the upper triangle is contiguous in AP. The dot product of
+         // the column with x is accumulated in four partial sums, which are
+         // independent and can be computed in one SIMD register.
          i__1 = n;
          for (j = 1; j <= i__1; ++j) {
             temp1 = alpha * x[j];
-            temp2 = 0.;
-            k = kk;
+            const double *col = &ap[kk];
+            double *yp = &y[1];
+            const double *xp = &x[1];
+            double sum[4] = {0., 0., 0., 0.};
             i__2 = j - 1;
-            for (i__ = 1; i__ <= i__2; ++i__) {
-               y[i__] += temp1 * ap[k];
-               temp2 += ap[k] * x[i__];
-               ++k;
-               /* L50: */
+            int i4 = i__2 - i__2 % 4;
+            for (i__ = 0; i__ < i4; i__ += 4) {
+               for (int l = 0; l < 4; ++l) {
+                  yp[i__ + l] += temp1 * col[i__ + l];
+                  sum[l] += col[i__ + l] * xp[i__ + l];
+               }
+            }
+            for (i__ = i4; i__ < i__2; ++i__) {
+               yp[i__] += temp1 * col[i__];
+               sum[0] += col[i__] * xp[i__];
             }
+            temp2 = (sum[0] + sum[1]) + (sum[2] + sum[3]);
             y[j] = y[j] + temp1 * ap[kk + j - 1] + alpha * temp2;
             kk += j;
             /* L60: */
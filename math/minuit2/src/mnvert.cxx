@@ -18,6 +18,11 @@ namespace Minuit2 {
 /** Inverts a symmetric matrix. Matrix is first scaled to have all ones on
     the diagonal (equivalent to change of units) but no pivoting is done
     since matrix is positive-definite.
+
+    The loops over all matrix elements run column by column over the packed
+    storage of the upper triangle, where the elements of a column are
+    contiguous, so that the compiler can vectorize them. Each element gets
+    the same operations as in the row-wise loops of the Fortran version.
  */
 
 int mnvert(MnAlgebraicSymMatrix &a)
@@ -28,6 +33,12 @@ int mnvert(MnAlgebraicSymMatrix &a)
    MnAlgebraicVector q(nrow);
    MnAlgebraicVector pp(nrow);
 
+   // the element (i, j) with i <= j is at index i + j * (j + 1) / 2
+   double *ap = a.Data();
+   const double *sp = s.Data();
+   const double *qp = q.Data();
+   const double *ppp = pp.Data();
+
    for (unsigned int i = 0; i < nrow; i++) {
       double si = a(i, i);
       if (si < 0.)
@@ -35,9 +46,11 @@ int mnvert(MnAlgebraicSymMatrix &a)
       s(i) = 1. / std::sqrt(si);
    }
 
-   for (unsigned int i = 0; i < nrow; i++)
-      for (unsigned int j = i; j < nrow; j++)
-         a(i, j) *= (s(i) * s(j));
+   for (unsigned int j = 0, off = 0; j < nrow; off += ++j) {
+      const double sj = sp[j];
+      for (unsigned int i = 0; i <= j; i++)
+         ap[off + i] *= (sp[i] * sj);
+   }
 
    for (unsigned i = 0; i < nrow; i++) {
       unsigned int k = i;
@@ -61,14 +74,18 @@ int mnvert(MnAlgebraicSymMatrix &a)
             a(k, j) = 0.;
          }
       }
-      for (unsigned int j = 0; j < nrow; j++)
-         for (k = j; k < nrow; k++)
-            a(j, k) += (pp(j) * q(k));
+      for (unsigned int l = 0, off = 0; l < nrow; off += ++l) {
+         const double ql = qp[l];
+         for (unsigned int j = 0; j <= l; j++)
+            ap[off + j] += (ppp[j] * ql);
+      }
    }
 
-   for (unsigned int j = 0; j < nrow; j++)
-      for (unsigned int k = j; k < nrow; k++)
-         a(j, k) *= (s(j) * s(k));
+   for (unsigned int j = 0, off = 0; j < nrow; off += ++j) {
+      const double sj = sp[j];
+      for (unsigned int i = 0; i <= j; i++)
+         ap[off + i] *= (sp[i] * sj);
+   }
 
    return 0;
 }
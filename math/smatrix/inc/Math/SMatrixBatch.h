@@ -0,0 +1,331 @@
+// @(#)root/smatrix:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_Math_SMatrixBatch
+#define ROOT_Math_SMatrixBatch
+
+#include "Math/SMatrix.h"
+
+#include <cmath>
+
+namespace ROOT {
+
+namespace Math {
+
+//__________________________________________________________________________
+/**
+    SMatrixBatch: a batch of W fixed size D1 x D2 matrices in "structure of
+    arrays" layout.
+
+    The W values of the element (i,j) of the matrices are contiguous in memory,
+    so that the batch functions (ROOT::Math::Multiply, ROOT::Math::Similarity,
+    ROOT::Math::InvertChol...) compute the same operation for the W matrices
+    with loops over the matrices as innermost loops, which the compiler can
+    vectorize. This is the layout needed to fit many tracks at once, for
+    example to compute the Kalman filter update of W tracks:
+
+    ~~~ {.cpp}
+    using namespace ROOT::Math;
+    SMatrixBatch<double, 5, 5, 8> C;   // track covariances
+    SMatrixBatch<double, 2, 5, 8> H;   // projection matrices
+    SMatrixBatch<double, 2, 2, 8> V;   // measurement covariances
+    for (unsigned int n = 0; n < 8; ++n) {
+       C.Place(n, tracks[n].Covariance());
+       ...
+    }
+    SMatrixBatch<double, 2, 2, 8> R;
+    Similarity(H, C, R);               // R = H * C * H^T
+    R += V;
+    InvertChol(R);
+    SMatrixBatch<double, 5, 2, 8> CHt, K;
+    MultiplyTransposed(C, H, CHt);     // CHt = C * H^T
+    Multiply(CHt, R, K);               // K = C * H^T * R^-1
+    ~~~
+
+    A batch of vectors is a batch of D x 1 matrices.
+
+    @ingroup SMatrixSVector
+*/
+template <class T, unsigned int D1, unsigned int D2 = D1, unsigned int W = 8>
+class SMatrixBatch {
+public:
+   /** contained scalar type */
+   typedef T value_type;
+
+   enum {
+      /// return no. of matrix rows
+      kRows = D1,
+      /// return no. of matrix columns
+      kCols = D2,
+      /// return no. of elements of each matrix: rows*columns
+      kSize = D1 * D2,
+      /// return no. of matrices in the batch
+      kWidth = W
+   };
+
+   /// Default constructor: the elements are not initialized
+   SMatrixBatch() {}
+
+   /// Set all the elements of all the matrices to a
+   explicit SMatrixBatch(const T &a)
+   {
+      for (unsigned int k = 0; k < kSize * W; ++k)
+         fArray[k] = a;
+   }
+
+   /// Access the element (i,j) of the n-th matrix
+   const T &operator()(unsigned int i, unsigned int j, unsigned int n) const { return fArray[(i * D2 + j) * W + n]; }
+   T &operator()(unsigned int i, unsigned int j, unsigned int n) { return fArray[(i * D2 + j) * W + n]; }
+
+   /// Pointer to the W values of the element (i,j)
+   const T *Lanes(unsigned int i, unsigned int j) const { return fArray + (i * D2 + j) * W; }
+   T *Lanes(unsigned int i, unsigned int j) { return fArray + (i * D2 + j) * W; }
+
+   /// Pointer to the internal array: the element (i,j) of the n-th matrix is at index (i*D2+j)*W+n
+   const T *Array() const { return fArray; }
+   T *Array() { return fArray; }
+
+   /// Copy the matrix m into the n-th matrix of the batch
+   template <class R>
+   void Place(unsigned int n, const SMatrix<T, D1, D2, R> &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            (*this)(i, j, n) = m(i, j);
+   }
+
+   /// Copy the n-th matrix of the batch into m, which is symmetric only if the n-th matrix is.
+   template <class R>
+   void Get(unsigned int n, SMatrix<T, D1, D2, R> &m) const
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            m(i, j) = (*this)(i, j, n);
+   }
+
+   /// Return the n-th matrix of the batch
+   SMatrix<T, D1, D2> Get(unsigned int n) const
+   {
+      SMatrix<T, D1, D2> m;
+      Get(n, m);
+      return m;
+   }
+
+   /// Element-wise addition of the matrices of another batch
+   SMatrixBatch &operator+=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * W; ++k)
+         fArray[k] += rhs.fArray[k];
+      return *this;
+   }
+
+   /// Element-wise subtraction of the matrices of another batch
+   SMatrixBatch &operator-=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * W; ++k)
+         fArray[k] -= rhs.fArray[k];
+      return *this;
+   }
+
+   /// Multiply all the matrices by a scalar
+   SMatrixBatch &operator*=(const T &a)
+   {
+      for (unsigned int k = 0; k < kSize * W; ++k)
+         fArray[k] *= a;
+      return *this;
+   }
+
+private:
+   T fArray[kSize * W];
+};
+
+/**
+   Batch matrix product: compute \f$ C_n = A_n B_n \f$ for the W matrices of the batches.
+   C must not be A or B.
+
+   @ingroup MatrixFunctions
+ */
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int W>
+inline void Multiply(const SMatrixBatch<T, D1, D, W> &a, const SMatrixBatch<T, D, D2, W> &b,
+                     SMatrixBatch<T, D1, D2, W> &c)
+{
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *cij = c.Lanes(i, j);
+         for (unsigned int n = 0; n < W; ++n)
+            cij[n] = 0;
+         for (unsigned int k = 0; k < D; ++k) {
+            const T *aik = a.Lanes(i, k);
+            const T *bkj = b.Lanes(k, j);
+            for (unsigned int n = 0; n < W; ++n)
+               cij[n] += aik[n] * bkj[n];
+         }
+      }
+   }
+}
+
+/**
+   Batch matrix product with a transposed matrix: compute \f$ C_n = A_n B_n^T \f$
+   for the W matrices of the batches. C must not be A or B.
+
+   @ingroup MatrixFunctions
+ */
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int W>
+inline void MultiplyTransposed(const SMatrixBatch<T, D1, D, W> &a, const SMatrixBatch<T, D2, D, W> &b,
+                               SMatrixBatch<T, D1, D2, W> &c)
+{
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *cij = c.Lanes(i, j);
+         for (unsigned int n = 0; n < W; ++n)
+            cij[n] = 0;
+         for (unsigned int k = 0; k < D; ++k) {
+            const T *aik = a.Lanes(i, k);
+            const T *bjk = b.Lanes(j, k);
+            for (unsigned int n = 0; n < W; ++n)
+               cij[n] += aik[n] * bjk[n];
+         }
+      }
+   }
+}
+
+/**
+   Batch similarity matrix product: compute \f$ C_n = U_n A_n U_n^T \f$ for the W
+   matrices of the batches, where the A matrices are symmetric. Only the lower
+   triangle of A is used and the C matrices are symmetric.
+
+   @ingroup MatrixFunctions
+ */
+template <class T, unsigned int D1, unsigned int D2, unsigned int W>
+inline void Similarity(const SMatrixBatch<T, D1, D2, W> &u, const SMatrixBatch<T, D2, D2, W> &a,
+                       SMatrixBatch<T, D1, D1, W> &c)
+{
+   // tmp = U * A, reading the upper triangle of A from the lower one
+   SMatrixBatch<T, D1, D2, W> tmp(0);
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *tij = tmp.Lanes(i, j);
+         for (unsigned int k = 0; k < D2; ++k) {
+            const T *uik = u.Lanes(i, k);
+            const T *akj = k >= j ? a.Lanes(k, j) : a.Lanes(j, k);
+            for (unsigned int n = 0; n < W; ++n)
+               tij[n] += uik[n] * akj[n];
+         }
+      }
+   }
+   // C = tmp * U^T, of which only the lower triangle is computed
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *cij = c.Lanes(i, j);
+         for (unsigned int n = 0; n < W; ++n)
+            cij[n] = 0;
+         for (unsigned int k = 0; k < D2; ++k) {
+            const T *tik = tmp.Lanes(i, k);
+            const T *ujk = u.Lanes(j, k);
+            for (unsigned int n = 0; n < W; ++n)
+               cij[n] += tik[n] * ujk[n];
+         }
+         if (j < i) {
+            T *cji = c.Lanes(j, i);
+            for (unsigned int n = 0; n < W; ++n)
+               cji[n] = cij[n];
+         }
+      }
+   }
+}
+
+/**
+   Batch inversion of symmetric positive definite matrices using the Cholesky
+   decomposition, without pivoting so that the W matrices are inverted at once.
+   Only the lower triangle of the matrices is used.
+   Return true if all the matrices are positive definite; otherwise the content
+   of the matrices which are not is undefined.
+
+   @ingroup MatrixFunctions
+ */
+template <class T, unsigned int D, unsigned int W>
+inline bool InvertChol(SMatrixBatch<T, D, D, W> &m)
+{
+   // the lower triangle of m is replaced by the one of L, with the inverse of its diagonal
+   bool ok = true;
+   for (unsigned int j = 0; j < D; ++j) {
+      T *ljj = m.Lanes(j, j);
+      for (unsigned int k = 0; k < j; ++k) {
+         const T *ljk = m.Lanes(j, k);
+         for (unsigned int n = 0; n < W; ++n)
+            ljj[n] -= ljk[n] * ljk[n];
+      }
+      for (unsigned int n = 0; n < W; ++n)
+         ok &= ljj[n] > 0;
+      for (unsigned int n = 0; n < W; ++n)
+         ljj[n] = 1 / std::sqrt(ljj[n]);
+      for (unsigned int i = j + 1; i < D; ++i) {
+         T *lij = m.Lanes(i, j);
+         for (unsigned int k = 0; k < j; ++k) {
+            const T *lik = m.Lanes(i, k);
+            const T *ljk = m.Lanes(j, k);
+            for (unsigned int n = 0; n < W; ++n)
+               lij[n] -= lik[n] * ljk[n];
+         }
+         for (unsigned int n = 0; n < W; ++n)
+            lij[n] *= ljj[n];
+      }
+   }
+
+   // linv = L^-1, lower triangular
+   SMatrixBatch<T, D, D, W> linv;
+   for (unsigned int j = 0; j < D; ++j) {
+      const T *ljj = m.Lanes(j, j);
+      T *vjj = linv.Lanes(j, j);
+      for (unsigned int n = 0; n < W; ++n)
+         vjj[n] = ljj[n];
+      for (unsigned int i = j + 1; i < D; ++i) {
+         T *vij = linv.Lanes(i, j);
+         for (unsigned int n = 0; n < W; ++n)
+            vij[n] = 0;
+         for (unsigned int k = j; k < i; ++k) {
+            const T *lik = m.Lanes(i, k);
+            const T *vkj = linv.Lanes(k, j);
+            for (unsigned int n = 0; n < W; ++n)
+               vij[n] -= lik[n] * vkj[n];
+         }
+         const T *lii = m.Lanes(i, i);
+         for (unsigned int n = 0; n < W; ++n)
+            vij[n] *= lii[n];
+      }
+   }
+
+   // m^-1 = L^-T L^-1
+   for (unsigned int i = 0; i < D; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *mij = m.Lanes(i, j);
+         for (unsigned int n = 0; n < W; ++n)
+            mij[n] = 0;
+         for (unsigned int k = i; k < D; ++k) {
+            const T *vki = linv.Lanes(k, i);
+            const T *vkj = linv.Lanes(k, j);
+            for (unsigned int n = 0; n < W; ++n)
+               mij[n] += vki[n] * vkj[n];
+         }
+         if (j < i) {
+            T *mji = m.Lanes(j, i);
+            for (unsigned int n = 0; n < W; ++n)
+               mji[n] = mij[n];
+         }
+      }
+   }
+   return ok;
+}
+
+}  // namespace Math
+
+}  // namespace ROOT
+
+#endif
@@ -23,6 +23,8 @@ class TUnuranDiscrDist;
 class TUnuranMultiContDist;
 class TUnuranEmpDist;
 
+#include "ROOT/RSpan.hxx"
+
 #include <memory>
 
 
@@ -52,9 +54,14 @@ class TUnuranEmpDist;
     - TUnuran::SampleDiscr()  returns an integer for one-dimensional discrete distribution
     - TUnuran::Sample(double *) sample a multi-dimensional distribution. A pointer to a vector with
       size at least equal to the distribution dimension must be passed
+    - the overloads taking a std::span fill it with a batch of random numbers
 
    In addition is possible to set the random number generator in the constructor of the class, its seed
    via the TUnuran::SetSeed() method.
+
+   A generator cannot be used by several threads at the same time, since sampling can modify its state.
+   TUnuran::Clone returns a copy of an initialized generator using another random engine, which avoids
+   repeating the setup of the method in each thread.
 */
 
 
@@ -95,7 +102,7 @@ private:
    // usually copying is non trivial, so we make this unaccessible
 
    /**
-      Copy constructor
+      Copy constructor, used by TUnuran::Clone, which then sets the random generator
    */
    TUnuran(const TUnuran &);
 
@@ -211,6 +218,35 @@ public:
    */
    int SampleDiscr();
 
+   /**
+      Fill x with random numbers of a 1D continuous distribution.
+      User is responsible for having previously correctly initialized with TUnuran::Init
+   */
+   void Sample(std::span<double> x);
+
+   /**
+      Fill x with random numbers of a 1D discrete distribution.
+      User is responsible for having previously correctly initialized with TUnuran::Init
+   */
+   void SampleDiscr(std::span<int> x);
+
+   /**
+      Sample x.size() / GetDimension() points of a multidimensional distribution.
+      The coordinates of each point are stored contiguously in x. Return false if
+      the generator is not initialized or if the size of x is not a multiple of the dimension.
+   */
+   bool SampleMulti(std::span<double> x);
+
+   /**
+      Return a new generator with a copy of the state of this one, which uses the random engine r.
+      The clone samples the same distribution without repeating the setup of the method, e.g. one
+      clone can be created for each thread, each with its own random engine. The distribution
+      is shared with this object, which must therefore outlive the clone, and its functions must
+      be safe to call concurrently. Cloning must not be done while this object is sampling.
+      The clone cannot be re-initialized. Return a null pointer if the generator is not initialized.
+   */
+   TUnuran * Clone(TRandom * r) const;
+
    /**
       Set the random engine.
       Must be called before init to have effect
@@ -166,6 +166,13 @@ public:
     */
    bool SampleBin(double prob, double & value, double *error = nullptr) override;
 
+   /**
+      Return a copy of the initialized UNU.RAN generator using the random engine r,
+      to sample the distribution in another thread (see TUnuran::Clone).
+      The caller owns the returned object.
+   */
+   TUnuran * CloneGenerator(TRandom * r) const;
+
 
 
 protected:
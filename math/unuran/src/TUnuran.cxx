@@ -59,10 +59,18 @@ TUnuran::~TUnuran()
    if (fUdistr != 0) unur_distr_free(fUdistr);
 }
 
-//private (no impl.)
-TUnuran::TUnuran(const TUnuran &)
+//private (used by Clone)
+TUnuran::TUnuran(const TUnuran & rhs) :
+   fGen(0),
+   fUdistr(0),
+   fUrng(0),
+   fRng(rhs.fRng),
+   fMethod(rhs.fMethod)
 {
    // Implementation of copy constructor.
+   // the distribution is not copied: the cloned UNU.RAN generator refers to the one of rhs,
+   // unless it owns a private copy of it
+   if (rhs.fGen != 0) fGen = unur_gen_clone(rhs.fGen);
 }
 
 TUnuran & TUnuran::operator = (const TUnuran &rhs)
@@ -441,6 +449,56 @@ bool TUnuran::SampleMulti(double * x)
    return true;
 }
 
+void TUnuran::Sample(std::span<double> x)
+{
+   // sample a batch of a one-dimensional distribution
+   assert(fGen != 0);
+   for (auto & xi : x)
+      xi = unur_sample_cont(fGen);
+}
+
+void TUnuran::SampleDiscr(std::span<int> x)
+{
+   // sample a batch of a discrete distribution
+   assert(fGen != 0);
+   for (auto & xi : x)
+      xi = unur_sample_discr(fGen);
+}
+
+bool TUnuran::SampleMulti(std::span<double> x)
+{
+   // sample a batch of a multidimensional distribution, storing one point after the other
+   if (fGen == 0) return false;
+   const std::size_t ndim = unur_get_dimension(fGen);
+   if (ndim == 0 || x.size() % ndim != 0) {
+      Error("SampleMulti","the size of the batch is not a multiple of the dimension %zu", ndim);
+      return false;
+   }
+   for (std::size_t i = 0; i < x.size(); i += ndim)
+      unur_sample_vec(fGen, x.data() + i);
+   return true;
+}
+
+TUnuran * TUnuran::Clone(TRandom * r) const
+{
+   // clone the initialized generator, to sample with the random engine r
+   if (fGen == 0) {
+      Error("Clone","the generator is not initialized");
+      return nullptr;
+   }
+   if (r == 0) {
+      Error("Clone","a random engine must be given");
+      return nullptr;
+   }
+   std::unique_ptr<TUnuran> clone(new TUnuran(*this));
+   clone->fRng = r;
+   if (clone->fGen == 0 || !clone->SetRandomGenerator()) {
+      Error("Clone","cannot clone the generator object");
+      return nullptr;
+   }
+   return clone.release();
+}
+
 void TUnuran::SetSeed(unsigned int seed) {
    return fRng->SetSeed(seed);
 }
@@ -291,6 +291,11 @@ bool TUnuranSampler::SampleBin(double prob, double & value, double *error) {
    return true;
 }
 
+TUnuran * TUnuranSampler::CloneGenerator(TRandom * r) const {
+   // clone the generator for sampling with another random engine
+   return fUnuran->Clone(r);
+}
+
 void TUnuranSampler::SetMode(const std::vector<double> &mode)
 {
    // set modes for multidim distribution
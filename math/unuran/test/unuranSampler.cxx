@@ -8,6 +8,14 @@
 #include "Math/Functor.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TRandom3.h"
+#include "TUnuran.h"
+
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 using namespace ROOT::Math; 
 
@@ -229,4 +237,40 @@ TEST(MultiDim, DistSamplerOptAPI){
     EXPECT_NEAR(h1->GetRMS(2), 2, 10*h1->GetRMSError(2));
     EXPECT_NEAR(h1->GetCorrelationFactor(1,2), 0.7, 0.1);
     
-}
\ No newline at end of file
+}
+
+// test sampling batches with clones of a generator in several threads
+TEST(OneDim, ClonedGenerators)
+{
+    TRandom3 r(111);
+    TUnuran unr(&r);
+    bool ret = unr.Init("normal(3.,0.75); domain = (0,6)", "method = tdr; c = 0");
+    EXPECT_EQ(ret, true);
+    if (!ret) return;
+
+    // a clone starts from the state of the generator
+    TRandom3 rClone(111);
+    std::unique_ptr<TUnuran> clone(unr.Clone(&rClone));
+    ASSERT_NE(clone, nullptr);
+    std::vector<double> batch(1000);
+    clone->Sample(batch);
+    for (double x : batch)
+        EXPECT_EQ(x, unr.Sample());
+
+    const int nthreads = 4;
+    std::vector<std::vector<double>> samples(nthreads, std::vector<double>(10000));
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nthreads; ++i) {
+        threads.emplace_back([&, i]() {
+            TRandom3 rThread(i + 1);
+            std::unique_ptr<TUnuran> gen(unr.Clone(&rThread));
+            gen->Sample(samples[i]);
+        });
+    }
+    for (auto & t : threads)
+        t.join();
+    for (auto & s : samples) {
+        double mean = std::accumulate(s.begin(), s.end(), 0.) / s.size();
+        EXPECT_NEAR(mean, 3., 5 * 0.75 / std::sqrt(s.size()));
+    }
+}
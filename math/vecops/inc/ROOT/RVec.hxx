@@ -134,6 +134,76 @@ inline uint64_t NextPowerOf2(uint64_t A)
    return A + 1;
 }
 
+/** \brief A bump allocator for the buffers of the RVecs used within a short scope, e.g. one entry of an event loop.
+
+While an RVecArena::RScope is alive, the buffers that RVecs allocate on the thread come from the arena: allocating is
+a pointer increment, freeing does nothing, and all the memory is recycled at once when the scope ends. RVecs whose
+buffer was allocated in the arena must therefore not outlive the scope: their content must be copied, outside of the
+scope or within an RVecArena::RPause, to RVecs that own heap memory.
+*/
+class RVecArena {
+   struct RBlock {
+      std::unique_ptr<char[]> fData;
+      std::size_t fSize;
+   };
+   std::vector<RBlock> fBlocks;
+   std::size_t fCurrentBlock = 0u; ///< The block the next allocation is taken from
+   std::size_t fOffset = 0u;       ///< The offset of the first free byte in the current block
+   bool fIsEnabled = false;
+
+public:
+   static constexpr std::size_t kMinBlockSize = 64u * 1024u;
+
+   /// Make the RVec allocations of the current thread use the arena for its lifetime, then recycle the memory.
+   class RScope {
+      RVecArena &fArena;
+      RVecArena *fPrevArena;
+      bool fPrevIsEnabled;
+
+   public:
+      explicit RScope(RVecArena &arena);
+      ~RScope();
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+   };
+
+   /// Make the RVec allocations of the current thread use the heap for its lifetime, e.g. to copy a value out of the
+   /// arena. Buffers allocated in the arena can still be freed.
+   class RPause {
+      RVecArena &fArena;
+      bool fPrevIsEnabled;
+
+   public:
+      explicit RPause(RVecArena &arena) : fArena(arena), fPrevIsEnabled(arena.fIsEnabled) { fArena.fIsEnabled = false; }
+      ~RPause() { fArena.fIsEnabled = fPrevIsEnabled; }
+      RPause(const RPause &) = delete;
+      RPause &operator=(const RPause &) = delete;
+   };
+
+   RVecArena() = default;
+   RVecArena(const RVecArena &) = delete;
+   RVecArena &operator=(const RVecArena &) = delete;
+
+   void *Allocate(std::size_t nBytes);
+   bool Contains(const void *ptr) const;
+   bool IsEnabled() const { return fIsEnabled; }
+   /// Recycle all the memory of the arena; the blocks are kept for the next allocations.
+   void Reset()
+   {
+      fCurrentBlock = 0u;
+      fOffset = 0u;
+   }
+   /// The total size of the blocks of the arena, in bytes.
+   std::size_t GetCapacity() const;
+};
+
+/// Allocate the buffer of an RVec: in the enabled arena of the current thread if there is one, on the heap otherwise.
+void *RVecMalloc(std::size_t nBytes);
+/// Grow the buffer of an RVec, allocated with RVecMalloc, preserving its first oldBytes bytes.
+void *RVecRealloc(void *ptr, std::size_t oldBytes, std::size_t nBytes);
+/// Free the buffer of an RVec, allocated with RVecMalloc.
+void RVecFree(void *ptr);
+
 /// This is all the stuff common to all SmallVectors.
 class R__CLING_PTRCHECK(off) SmallVectorBase {
 public:
@@ -401,7 +471,7 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
    // Always grow, even from zero.
    size_t NewCapacity = size_t(NextPowerOf2(this->capacity() + 2));
    NewCapacity = std::min(std::max(NewCapacity, MinSize), this->SizeTypeMax());
-   T *NewElts = static_cast<T *>(malloc(NewCapacity * sizeof(T)));
+   T *NewElts = static_cast<T *>(RVecMalloc(NewCapacity * sizeof(T)));
    R__ASSERT(NewElts != nullptr);
 
    // Move the elements over.
@@ -413,7 +483,7 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
 
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall())
-         free(this->begin());
+         RVecFree(this->begin());
    }
 
    this->fBeginX = NewElts;
@@ -537,6 +607,38 @@ void UninitializedValueConstruct(ForwardIt first, ForwardIt last)
 #endif
 }
 
+/// Copy the n elements of in for which conds is true to out, which must have room for n elements, and return their
+/// number. Trivially copyable elements are all written without branching, but only the selected ones are kept: this
+/// avoids the mispredicted branches of unpredictable masks.
+template <typename T, typename V>
+std::size_t CompressStore(const T *in, const V *conds, std::size_t n, T *out, std::true_type /*isTriviallyCopyable*/)
+{
+   std::size_t j = 0u;
+   for (std::size_t i = 0u; i < n; ++i) {
+      out[j] = in[i];
+      j += static_cast<bool>(conds[i]);
+   }
+   return j;
+}
+
+template <typename T, typename V>
+std::size_t CompressStore(const T *in, const V *conds, std::size_t n, T *out, std::false_type /*isTriviallyCopyable*/)
+{
+   std::size_t j = 0u;
+   for (std::size_t i = 0u; i < n; ++i) {
+      if (conds[i]) {
+         out[j] = in[i];
+         ++j;
+      }
+   }
+   return j;
+}
+
+/// The type used to read the elements selected by Where: a copy for arithmetic types, so that both alternatives are
+/// loaded unconditionally and the selection can be vectorized, a reference otherwise.
+template <typename T>
+using WhereElement_t = std::conditional_t<std::is_arithmetic<T>::value, const T, const T &>;
+
 } // namespace VecOps
 } // namespace Internal
 
@@ -567,7 +669,7 @@ public:
       // Subclass has already destructed this vector's elements.
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall() && this->Owns())
-         free(this->begin());
+         ROOT::Internal::VecOps::RVecFree(this->begin());
    }
 
    // also give up adopted memory if applicable
@@ -1044,7 +1146,7 @@ RVecImpl<T> &RVecImpl<T>::operator=(RVecImpl<T> &&RHS)
       if (this->Owns()) {
          this->destroy_range(this->begin(), this->end());
          if (!this->isSmall())
-            free(this->begin());
+            ROOT::Internal::VecOps::RVecFree(this->begin());
       }
       this->fBeginX = RHS.fBeginX;
       this->fSize = RHS.fSize;
@@ -1246,15 +1348,9 @@ public:
 
       RVecN ret;
       ret.reserve(n);
-      size_type j = 0u;
-      for (size_type i = 0u; i < n; ++i) {
-         if (conds[i]) {
-            // the begin() is to go around the R__ASSERT in operator[]
-            ret.begin()[j] = this->operator[](i);
-            ++j;
-         }
-      }
-      ret.set_size(j);
+      const auto nSelected = Internal::VecOps::CompressStore(this->begin(), conds.begin(), n, ret.begin(),
+                                                             std::is_trivially_copyable<T>{});
+      ret.set_size(nSelected);
       return ret;
    }
 
@@ -1701,6 +1797,225 @@ RVEC_LOGICAL_OPERATOR(&&)
 RVEC_LOGICAL_OPERATOR(||)
 #undef RVEC_LOGICAL_OPERATOR
 
+///@}
+///@name RVec Expression Templates
+///@{
+
+/// \cond
+template <typename Derived>
+class RVecExpr;
+/// \endcond
+
+} // namespace VecOps
+
+namespace Internal {
+namespace VecOps {
+
+template <typename T>
+using IsRVecExpr = std::is_base_of<ROOT::VecOps::RVecExpr<T>, T>;
+
+/// True if the operands of a binary operator or function build an RVec expression: at least one of them is an
+/// expression and the other one is an expression or an arithmetic scalar.
+template <typename L, typename R>
+using IsRVecExprOperands = std::integral_constant<
+   bool, (IsRVecExpr<L>::value || IsRVecExpr<R>::value) && (IsRVecExpr<L>::value || std::is_arithmetic<L>::value) &&
+            (IsRVecExpr<R>::value || std::is_arithmetic<R>::value)>;
+
+} // namespace VecOps
+} // namespace Internal
+
+namespace VecOps {
+
+/** \brief Base class of the lazily-evaluated RVec expressions, see Lazy().
+
+The expressions are evaluated element by element, in a single loop, when they are converted to an RVec or assigned
+to one with Assign().
+*/
+template <typename Derived>
+class RVecExpr {
+public:
+   const Derived &Self() const { return static_cast<const Derived &>(*this); }
+
+   /// Evaluate the expression in a new RVec.
+   template <typename T>
+   operator RVec<T>() const
+   {
+      RVec<T> ret;
+      Assign(ret, Self());
+      return ret;
+   }
+};
+
+/// \cond
+/// A leaf of an expression: refers to an RVec, which must outlive the expression.
+template <typename T>
+class RVecRefExpr : public RVecExpr<RVecRefExpr<T>> {
+   const RVec<T> *fVec;
+
+public:
+   using value_type = T;
+   static constexpr bool kIsScalar = false;
+
+   explicit RVecRefExpr(const RVec<T> &v) : fVec(&v) {}
+   std::size_t size() const { return fVec->size(); }
+   const T &operator[](std::size_t i) const { return (*fVec)[i]; }
+};
+
+/// A leaf of an expression: a scalar, which has the same value for all elements.
+template <typename T>
+class RVecScalarExpr : public RVecExpr<RVecScalarExpr<T>> {
+   T fValue;
+
+public:
+   using value_type = T;
+   static constexpr bool kIsScalar = true;
+
+   explicit RVecScalarExpr(const T &value) : fValue(value) {}
+   std::size_t size() const { return 0u; }
+   const T &operator[](std::size_t) const { return fValue; }
+};
+
+template <typename F, typename E>
+class RVecUnaryExpr : public RVecExpr<RVecUnaryExpr<F, E>> {
+   F fFunc;
+   E fExpr;
+
+public:
+   using value_type = decltype(std::declval<const F &>()(std::declval<typename E::value_type>()));
+   static constexpr bool kIsScalar = E::kIsScalar;
+
+   RVecUnaryExpr(const F &f, const E &e) : fFunc(f), fExpr(e) {}
+   std::size_t size() const { return fExpr.size(); }
+   value_type operator[](std::size_t i) const { return fFunc(fExpr[i]); }
+};
+
+template <typename F, typename L, typename R>
+class RVecBinaryExpr : public RVecExpr<RVecBinaryExpr<F, L, R>> {
+   F fFunc;
+   L fLeft;
+   R fRight;
+
+public:
+   using value_type = decltype(std::declval<const F &>()(std::declval<typename L::value_type>(),
+                                                         std::declval<typename R::value_type>()));
+   static constexpr bool kIsScalar = L::kIsScalar && R::kIsScalar;
+
+   RVecBinaryExpr(const F &f, const L &l, const R &r, const char *errorMessage) : fFunc(f), fLeft(l), fRight(r)
+   {
+      if (!L::kIsScalar && !R::kIsScalar && fLeft.size() != fRight.size())
+         throw std::runtime_error(errorMessage);
+   }
+   std::size_t size() const { return L::kIsScalar ? fRight.size() : fLeft.size(); }
+   value_type operator[](std::size_t i) const { return fFunc(fLeft[i], fRight[i]); }
+};
+
+template <typename E>
+const E &ToRVecExpr(const RVecExpr<E> &e)
+{
+   return e.Self();
+}
+
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+RVecScalarExpr<T> ToRVecExpr(const T &x)
+{
+   return RVecScalarExpr<T>(x);
+}
+
+template <typename T>
+using RVecExpr_t = typename std::decay<decltype(ToRVecExpr(std::declval<const T &>()))>::type;
+
+template <typename F, typename L, typename R>
+RVecBinaryExpr<F, RVecExpr_t<L>, RVecExpr_t<R>> MakeRVecBinaryExpr(const F &f, const L &l, const R &r,
+                                                                 const char *errorMessage)
+{
+   return RVecBinaryExpr<F, RVecExpr_t<L>, RVecExpr_t<R>>(f, ToRVecExpr(l), ToRVecExpr(r), errorMessage);
+}
+/// \endcond
+
+/// Start a lazily-evaluated expression with v.
+///
+/// Arithmetic and comparison operators and the mathematical functions of this header applied to the returned object
+/// do not compute anything: they build an expression that is evaluated when it is converted to an RVec or assigned to
+/// one with Assign(). The evaluation is done element by element in a single loop, without the temporary RVecs that
+/// each operation on RVecs allocates, and Assign() reuses the buffer of its target.
+/// All the RVec operands of an expression must be wrapped with Lazy(); scalars can be used as they are. The
+/// expression refers to its RVec operands, which must outlive it.
+///
+/// Example code, at the ROOT prompt:
+/// ~~~{.cpp}
+/// using namespace ROOT::VecOps;
+/// RVec<double> px {1., 2., 3.};
+/// RVec<double> py {4., 5., 6.};
+/// RVec<double> pt = sqrt(Lazy(px) * Lazy(px) + Lazy(py) * Lazy(py));
+/// pt
+/// // (ROOT::VecOps::RVec<double> &) { 4.1231056, 5.3851648, 6.7082039 }
+/// Assign(pt, 2. * Lazy(pt)); // no allocation
+/// ~~~
+template <typename T>
+RVecRefExpr<T> Lazy(const RVec<T> &v)
+{
+   return RVecRefExpr<T>(v);
+}
+
+/// Evaluate the expression in v, resizing v to the size of the expression and reusing its buffer if it is large
+/// enough. v may be an operand of the expression.
+template <typename T, typename E>
+RVec<T> &Assign(RVec<T> &v, const RVecExpr<E> &expr)
+{
+   const auto &e = expr.Self();
+   const std::size_t n = e.size();
+   v.resize(n);
+   T *out = v.data();
+   for (std::size_t i = 0u; i < n; ++i)
+      out[i] = e[i];
+   return v;
+}
+
+#define RVEC_EXPR_UNARY_OPERATOR(OP)                                           \
+template <typename E>                                                          \
+auto operator OP(const RVecExpr<E> &e)                                         \
+{                                                                              \
+   auto op = [](const typename E::value_type &x) { return OP x; };             \
+   return RVecUnaryExpr<decltype(op), E>(op, e.Self());                        \
+}                                                                              \
+
+RVEC_EXPR_UNARY_OPERATOR(+)
+RVEC_EXPR_UNARY_OPERATOR(-)
+RVEC_EXPR_UNARY_OPERATOR(~)
+RVEC_EXPR_UNARY_OPERATOR(!)
+#undef RVEC_EXPR_UNARY_OPERATOR
+
+#define RVEC_EXPR_BINARY_OPERATOR(OP, RET)                                     \
+template <typename L, typename R,                                              \
+          typename std::enable_if<                                             \
+             Internal::VecOps::IsRVecExprOperands<L, R>::value, int>::type = 0> \
+auto operator OP(const L &l, const R &r)                                       \
+{                                                                              \
+   using LV = typename RVecExpr_t<L>::value_type;                              \
+   using RV = typename RVecExpr_t<R>::value_type;                              \
+   auto op = [](const LV &x, const RV &y) -> RET { return x OP y; };           \
+   return MakeRVecBinaryExpr(op, l, r, ERROR_MESSAGE(OP));                     \
+}                                                                              \
+
+RVEC_EXPR_BINARY_OPERATOR(+, decltype(x + y))
+RVEC_EXPR_BINARY_OPERATOR(-, decltype(x - y))
+RVEC_EXPR_BINARY_OPERATOR(*, decltype(x * y))
+RVEC_EXPR_BINARY_OPERATOR(/, decltype(x / y))
+RVEC_EXPR_BINARY_OPERATOR(%, decltype(x % y))
+RVEC_EXPR_BINARY_OPERATOR(^, decltype(x ^ y))
+RVEC_EXPR_BINARY_OPERATOR(|, decltype(x | y))
+RVEC_EXPR_BINARY_OPERATOR(&, decltype(x & y))
+// comparisons and logical operators return int, as their RVec counterparts
+RVEC_EXPR_BINARY_OPERATOR(<, int)
+RVEC_EXPR_BINARY_OPERATOR(>, int)
+RVEC_EXPR_BINARY_OPERATOR(==, int)
+RVEC_EXPR_BINARY_OPERATOR(!=, int)
+RVEC_EXPR_BINARY_OPERATOR(<=, int)
+RVEC_EXPR_BINARY_OPERATOR(>=, int)
+RVEC_EXPR_BINARY_OPERATOR(&&, int)
+RVEC_EXPR_BINARY_OPERATOR(||, int)
+#undef RVEC_EXPR_BINARY_OPERATOR
+
 ///@}
 ///@name RVec Standard Mathematical Functions
 ///@{
@@ -1730,6 +2045,14 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T &x) { return FUNC(x); };                             \
       std::transform(v.begin(), v.end(), ret.begin(), f);                      \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   template <typename E>                                                       \
+   auto NAME(const RVecExpr<E> &e)                                             \
+   {                                                                           \
+      using T = typename E::value_type;                                        \
+      auto f = [](const T &x) -> PromoteType<T> { return FUNC(x); };           \
+      return RVecUnaryExpr<decltype(f), E>(f, e.Self());                       \
    }
 
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
@@ -1761,6 +2084,17 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T0 &x, const T1 &y) { return FUNC(x, y); };            \
       std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), f);        \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1,                                         \
+             typename std::enable_if<                                          \
+                Internal::VecOps::IsRVecExprOperands<T0, T1>::value, int>::type = 0> \
+   auto NAME(const T0 &x, const T1 &y)                                         \
+   {                                                                           \
+      using V0 = typename RVecExpr_t<T0>::value_type;                          \
+      using V1 = typename RVecExpr_t<T1>::value_type;                          \
+      auto f = [](const V0 &a, const V1 &b) -> PromoteTypes<V0, V1> { return FUNC(a, b); }; \
+      return MakeRVecBinaryExpr(f, x, y, ERROR_MESSAGE(NAME));                 \
    }                                                                           \
 
 #define RVEC_STD_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, std::F)
@@ -2508,13 +2842,12 @@ inline RVec<RVec<std::size_t>> Combinations(const std::size_t size1, const std::
    RVec<RVec<size_type>> r(2);
    r[0].resize(size1*size2);
    r[1].resize(size1*size2);
-   size_type c = 0;
-   for(size_type i=0; i<size1; i++) {
-      for(size_type j=0; j<size2; j++) {
-         r[0][c] = i;
-         r[1][c] = j;
-         c++;
-      }
+   // one block of size2 combinations per index of the first collection
+   auto *first = r[0].data();
+   auto *second = r[1].data();
+   for (size_type i = 0; i < size1; i++) {
+      std::fill_n(first + i * size2, size2, i);
+      std::iota(second + i * size2, second + (i + 1) * size2, size_type(0));
    }
    return r;
 }
@@ -2692,10 +3025,11 @@ RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 {
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
+   RVec<T> r(size);
+   for (size_type i = 0; i < size; i++) {
+      Internal::VecOps::WhereElement_t<T> a = v1[i];
+      Internal::VecOps::WhereElement_t<T> b = v2[i];
+      r[i] = c[i] != 0 ? a : b;
    }
    return r;
 }
@@ -2720,10 +3054,10 @@ RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_typ
 {
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2);
+   RVec<T> r(size);
+   for (size_type i = 0; i < size; i++) {
+      Internal::VecOps::WhereElement_t<T> a = v1[i];
+      r[i] = c[i] != 0 ? a : v2;
    }
    return r;
 }
@@ -2748,10 +3082,10 @@ RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>
 {
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2[i]);
+   RVec<T> r(size);
+   for (size_type i = 0; i < size; i++) {
+      Internal::VecOps::WhereElement_t<T> b = v2[i];
+      r[i] = c[i] != 0 ? v1 : b;
    }
    return r;
 }
@@ -2774,10 +3108,9 @@ RVec<T> Where(const RVec<int>& c, T v1, T v2)
 {
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2);
+   RVec<T> r(size);
+   for (size_type i = 0; i < size; i++) {
+      r[i] = c[i] != 0 ? v1 : v2;
    }
    return r;
 }
@@ -2887,8 +3220,18 @@ RVec<T> DeltaPhi(T v1, const RVec<T>& v2, const T c = M_PI)
 template <typename T>
 RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   using size_type = typename RVec<T>::size_type;
+   const size_type size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("Cannot compute DeltaR2 of collections of different sizes.");
+   // a single pass over the inputs, without the temporary collections of the element-wise operations
+   auto r = RVec<T>(size);
+   for (size_type i = 0; i < size; i++) {
+      const auto deta = eta1[i] - eta2[i];
+      const auto dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2901,7 +3244,10 @@ RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, c
 template <typename T>
 RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   auto r = DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2960,6 +3306,58 @@ RVec<T> InvariantMasses(
    return inv_masses;
 }
 
+/// Return the invariant masses of pairs of particles of a single collection, given the
+/// quantities transverse momentum (pt), rapidity (eta), azimuth (phi) and mass, and the
+/// indices idx1 and idx2 of the particles of each pair.
+///
+/// This is equivalent to
+/// `InvariantMasses(Take(pt, idx1), Take(eta, idx1), ..., Take(pt, idx2), ...)`, but each particle is
+/// converted to the (x, y, z, e) coordinate system only once, whatever the number of pairs it belongs to,
+/// and no temporary collection is created for the particles of the pairs.
+///
+/// Example code, at the ROOT prompt:
+/// ~~~{.cpp}
+/// using namespace ROOT::VecOps;
+/// RVecD pt = {15.5, 34.32, 12.95};
+/// RVecD eta = {0.3, 2.2, 1.32};
+/// RVecD phi = {0.1, 3.02, 2.2};
+/// RVecD mass = {0.105, 0.105, 0.105};
+/// auto pairs = Combinations(pt, 2);
+/// auto masses = InvariantMasses(pt, eta, phi, mass, pairs[0], pairs[1]);
+/// ~~~
+template <typename T, typename I>
+RVec<T> InvariantMasses(const RVec<T> &pt, const RVec<T> &eta, const RVec<T> &phi, const RVec<T> &mass,
+                        const RVec<I> &idx1, const RVec<I> &idx2)
+{
+   const std::size_t size = pt.size();
+
+   R__ASSERT(eta.size() == size && phi.size() == size && mass.size() == size);
+   R__ASSERT(idx1.size() == idx2.size());
+
+   // Conversion from (pt, eta, phi, mass) to (x, y, z, e) coordinate system
+   RVec<T> x(size), y(size), z(size), e(size);
+   for (std::size_t i = 0u; i < size; ++i) {
+      x[i] = pt[i] * std::cos(phi[i]);
+      y[i] = pt[i] * std::sin(phi[i]);
+      z[i] = pt[i] * std::sinh(eta[i]);
+      e[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + mass[i] * mass[i]);
+   }
+
+   RVec<T> inv_masses(idx1.size());
+   for (std::size_t k = 0u; k < idx1.size(); ++k) {
+      const auto i = idx1[k];
+      const auto j = idx2[k];
+      const auto e_sum = e[i] + e[j];
+      const auto x_sum = x[i] + x[j];
+      const auto y_sum = y[i] + y[j];
+      const auto z_sum = z[i] + z[j];
+      inv_masses[k] = std::sqrt(e_sum * e_sum - x_sum * x_sum - y_sum * y_sum - z_sum * z_sum);
+   }
+
+   // Return invariant mass with (+, -, -, -) metric
+   return inv_masses;
+}
+
 /// Return the invariant mass of multiple particles given the collections of the
 /// quantities transverse momentum (pt), rapidity (eta), azimuth (phi) and mass.
 ///
@@ -11,6 +11,11 @@
  *************************************************************************/
 
 #include "ROOT/RVec.hxx"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
 using namespace ROOT::VecOps;
 
 // Check that no bytes are wasted and everything is well-aligned.
@@ -69,14 +74,14 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
 
    void *NewElts;
    if (fBeginX == FirstEl || !this->Owns()) {
-      NewElts = malloc(NewCapacity * TSize);
+      NewElts = RVecMalloc(NewCapacity * TSize);
       R__ASSERT(NewElts != nullptr);
 
       // Copy the elements over.  No need to run dtors on PODs.
       memcpy(NewElts, this->fBeginX, size() * TSize);
    } else {
       // If this wasn't grown from the inline copy, grow the allocated space.
-      NewElts = realloc(this->fBeginX, NewCapacity * TSize);
+      NewElts = RVecRealloc(this->fBeginX, size() * TSize, NewCapacity * TSize);
       R__ASSERT(NewElts != nullptr);
    }
 
@@ -84,6 +89,95 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    this->fCapacity = NewCapacity;
 }
 
+namespace {
+/// The arena used by the RVec allocations of this thread, see RVecArena::RScope
+thread_local ROOT::Internal::VecOps::RVecArena *gRVecArena = nullptr;
+} // anonymous namespace
+
+constexpr std::size_t ROOT::Internal::VecOps::RVecArena::kMinBlockSize;
+
+ROOT::Internal::VecOps::RVecArena::RScope::RScope(RVecArena &arena)
+   : fArena(arena), fPrevArena(gRVecArena), fPrevIsEnabled(arena.fIsEnabled)
+{
+   gRVecArena = &fArena;
+   fArena.fIsEnabled = true;
+}
+
+ROOT::Internal::VecOps::RVecArena::RScope::~RScope()
+{
+   fArena.fIsEnabled = fPrevIsEnabled;
+   gRVecArena = fPrevArena;
+   // nested scopes on the same arena leave the memory to the outermost one
+   if (fPrevArena != &fArena)
+      fArena.Reset();
+}
+
+void *ROOT::Internal::VecOps::RVecArena::Allocate(std::size_t nBytes)
+{
+   constexpr std::size_t kAlign = alignof(std::max_align_t);
+   nBytes = (nBytes + kAlign - 1) / kAlign * kAlign;
+   while (fCurrentBlock < fBlocks.size() && fOffset + nBytes > fBlocks[fCurrentBlock].fSize) {
+      ++fCurrentBlock;
+      fOffset = 0u;
+   }
+   if (fCurrentBlock == fBlocks.size()) {
+      // each block is at least as large as all the previous ones together, so that few blocks are needed
+      const auto blockSize = std::max({kMinBlockSize, nBytes, GetCapacity()});
+      fBlocks.push_back({std::unique_ptr<char[]>(new char[blockSize]), blockSize});
+   }
+   void *ptr = fBlocks[fCurrentBlock].fData.get() + fOffset;
+   fOffset += nBytes;
+   return ptr;
+}
+
+bool ROOT::Internal::VecOps::RVecArena::Contains(const void *ptr) const
+{
+   const auto *p = static_cast<const char *>(ptr);
+   for (const auto &block : fBlocks) {
+      const char *begin = block.fData.get();
+      if (std::less_equal<const char *>()(begin, p) && std::less<const char *>()(p, begin + block.fSize))
+         return true;
+   }
+   return false;
+}
+
+std::size_t ROOT::Internal::VecOps::RVecArena::GetCapacity() const
+{
+   std::size_t capacity = 0u;
+   for (const auto &block : fBlocks)
+      capacity += block.fSize;
+   return capacity;
+}
+
+void *ROOT::Internal::VecOps::RVecMalloc(std::size_t nBytes)
+{
+   auto *arena = gRVecArena;
+   if (arena != nullptr && arena->IsEnabled())
+      return arena->Allocate(nBytes);
+   return malloc(nBytes);
+}
+
+void *ROOT::Internal::VecOps::RVecRealloc(void *ptr, std::size_t oldBytes, std::size_t nBytes)
+{
+   auto *arena = gRVecArena;
+   if (arena == nullptr || (!arena->IsEnabled() && !arena->Contains(ptr)))
+      return realloc(ptr, nBytes);
+   void *newPtr = RVecMalloc(nBytes);
+   if (newPtr != nullptr) {
+      memcpy(newPtr, ptr, oldBytes);
+      RVecFree(ptr);
+   }
+   return newPtr;
+}
+
+void ROOT::Internal::VecOps::RVecFree(void *ptr)
+{
+   auto *arena = gRVecArena;
+   if (arena != nullptr && arena->Contains(ptr))
+      return; // recycled when the scope of the arena ends
+   free(ptr);
+}
+
 #if (_VECOPS_USE_EXTERN_TEMPLATES)
 
 namespace ROOT {
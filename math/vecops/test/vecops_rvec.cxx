@@ -319,6 +319,11 @@ TEST(VecOps, Filter)
    vOdd = Filter(v, [](int i) { return 1 == i % 2; });
    CheckEqual(vEven, vEvenRef, "Even check");
    CheckEqual(vOdd, vOddRef, "Odd check");
+
+   // elements that are not trivially copyable
+   RVec<std::string> s{"a", "b", "c", "d"};
+   CheckEqual(s[RVec<int>{0, 1, 1, 0}], RVec<std::string>{"b", "c"});
+   EXPECT_TRUE(s[RVec<int>(4, 0)].empty());
 }
 
 template <typename T, typename V>
@@ -507,6 +512,75 @@ TEST(VecOps, PhysicsSelections)
    CheckEqual(goodMuons_pt, goodMuons_pt_ref, "Muons quality cut");
 }
 
+TEST(VecOps, LazyExpressions)
+{
+   RVec<double> px{1., 2., 3.};
+   RVec<double> py{4., 5., 6.};
+
+   RVec<double> pt = sqrt(Lazy(px) * Lazy(px) + Lazy(py) * Lazy(py));
+   CheckEqual(pt, sqrt(px * px + py * py), " error checking lazy expression");
+
+   // assignment reuses the buffer of the target, which can be an operand
+   const auto *buffer = pt.data();
+   Assign(pt, 2. * Lazy(pt) - 1);
+   EXPECT_EQ(buffer, pt.data());
+   CheckEqual(pt, 2. * sqrt(px * px + py * py) - 1, " error checking lazy assignment");
+
+   RVec<double> funcs = pow(Lazy(px), 2) + atan2(Lazy(py), Lazy(px)) + abs(-Lazy(px));
+   CheckEqual(funcs, pow(px, 2) + atan2(py, px) + abs(-px), " error checking lazy math functions");
+
+   RVec<int> mask = Lazy(px) > 1.5 && Lazy(py) < 6.;
+   CheckEqual(mask, RVec<int>{0, 1, 0}, " error checking lazy logical operators");
+
+   // mathematical functions promote integers as their eager counterparts
+   RVec<int> i{-1, 2, -3};
+   RVec<double> absI = abs(Lazy(i));
+   CheckEqual(absI, abs(i), " error checking lazy promotion");
+
+   RVec<double> shorter{1.};
+   EXPECT_THROW(Lazy(px) + Lazy(shorter), std::runtime_error);
+}
+
+TEST(VecOps, RVecArena)
+{
+   using ROOT::Internal::VecOps::RVecArena;
+   RVecArena arena;
+   ROOT::RVec<double> heap{1., 2., 3.};
+   ROOT::RVec<double> copy;
+   {
+      RVecArena::RScope scope(arena);
+      EXPECT_TRUE(arena.IsEnabled());
+      ROOT::RVec<double> v;
+      for (int i = 0; i < 1000; ++i)
+         v.push_back(i);
+      EXPECT_TRUE(arena.Contains(v.data()));
+      EXPECT_FALSE(arena.Contains(heap.data()));
+      heap.push_back(4.); // buffers allocated on the heap are freed on the heap
+      auto w = v[v > 500.] * 2.;
+      EXPECT_TRUE(arena.Contains(w.data()));
+      {
+         RVecArena::RPause pause(arena);
+         copy = w;
+         EXPECT_FALSE(arena.Contains(copy.data()));
+      }
+   }
+   EXPECT_FALSE(arena.IsEnabled());
+   ASSERT_EQ(copy.size(), 499u);
+   EXPECT_EQ(copy[0], 1002.);
+   CheckEqual(heap, ROOT::RVec<double>{1., 2., 3., 4.});
+   const auto capacity = arena.GetCapacity();
+   EXPECT_GE(capacity, RVecArena::kMinBlockSize);
+   {
+      // the memory is recycled at the end of the scope
+      RVecArena::RScope scope(arena);
+      ROOT::RVec<double> v(1000, 1.);
+      EXPECT_TRUE(arena.Contains(v.data()));
+   }
+   EXPECT_EQ(arena.GetCapacity(), capacity);
+   ROOT::RVec<double> outside(1000, 1.);
+   EXPECT_FALSE(arena.Contains(outside.data()));
+}
+
 template<typename T0>
 void CheckEq(const T0 &v, const T0 &ref)
 {
@@ -1228,6 +1302,16 @@ TEST(VecOps, InvariantMass)
    }
 
    EXPECT_NEAR(p5.M(), invMass3, 1e-4);
+
+   // Compute the invariant masses of all the pairs of particles of a single collection
+   const auto pairs = Combinations(pt1, 2);
+   const auto pairMasses = InvariantMasses(pt1, eta1, phi1, mass1, pairs[0], pairs[1]);
+   const auto expected = InvariantMasses(Take(pt1, pairs[0]), Take(eta1, pairs[0]), Take(phi1, pairs[0]),
+                                          Take(mass1, pairs[0]), Take(pt1, pairs[1]), Take(eta1, pairs[1]),
+                                          Take(phi1, pairs[1]), Take(mass1, pairs[1]));
+   ASSERT_EQ(pairMasses.size(), 10u);
+   for (std::size_t i = 0; i < pairMasses.size(); i++)
+      EXPECT_DOUBLE_EQ(pairMasses[i], expected[i]);
 }
 
 TEST(VecOps, DeltaR)
@@ -1253,6 +1337,8 @@ TEST(VecOps, DeltaR)
       auto dr4 = DeltaR(eta1[i], eta2[i], phi1[i], phi2[i]);
       EXPECT_NEAR(dr3, dr4, 1e-6);
    }
+
+   EXPECT_THROW(DeltaR(eta1, RVec<double>{0.}, phi1, phi2), std::runtime_error);
 }
 
 TEST(VecOps, Map)
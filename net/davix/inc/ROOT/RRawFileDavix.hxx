@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -30,11 +31,19 @@ The RRawFileDavix class provides read-only access to remote non-ROOT files.  It
 the transport layer.  It instructs the RRawFile base class to buffer in larger chunks than the default for
 local files, assuming that remote file access has high(er) latency.
 
+Large vector reads are split over up to ROptions::fNumConnections parallel connections (by default the value of
+the Davix.ReadV.Connections rootrc setting, or 1), such that more bytes are in flight on high-latency links.
+
 */
 
 class RRawFileDavix : public RRawFile {
 private:
    std::unique_ptr<Internal::RDavixFileDes> fFileDes;
+   /// Additional connections for parallel vector reads, opened on first use
+   std::vector<std::unique_ptr<Internal::RDavixFileDes>> fConnections;
+
+   /// Vector read of the given requests over the given connection
+   void ReadVConnection(Internal::RDavixFileDes &fileDes, RIOVec *ioVec, unsigned int nReq);
 
 protected:
    void OpenImpl() final;
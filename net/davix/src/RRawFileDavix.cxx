@@ -11,8 +11,12 @@
 
 #include "ROOT/RRawFileDavix.hxx"
 
+#include <TEnv.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <exception>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -22,6 +26,9 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+/// Vector reads are only split if every connection gets at least that many bytes; below, the latency of a single
+/// request dominates and additional connections do not pay off
+constexpr std::size_t kMinBytesPerConnection = 1024 * 1024;
 } // anonymous namespace
 
 namespace ROOT {
@@ -51,6 +58,8 @@ ROOT::Internal::RRawFileDavix::~RRawFileDavix()
 {
    if (fFileDes->fd != nullptr)
       fFileDes->pos.close(fFileDes->fd, nullptr);
+   for (auto &connection : fConnections)
+      connection->pos.close(connection->fd, nullptr);
 }
 
 std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileDavix::Clone() const
@@ -77,6 +86,8 @@ void ROOT::Internal::RRawFileDavix::OpenImpl()
    }
    if (fOptions.fBlockSize < 0)
       fOptions.fBlockSize = kDefaultBlockSize;
+   if (fOptions.fNumConnections <= 0)
+      fOptions.fNumConnections = std::max(1, gEnv->GetValue("Davix.ReadV.Connections", 1));
 }
 
 size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
@@ -89,7 +100,7 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
    return static_cast<size_t>(retval);
 }
 
-void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+void ROOT::Internal::RRawFileDavix::ReadVConnection(RDavixFileDes &fileDes, RIOVec *ioVec, unsigned int nReq)
 {
    Davix::DavixError *davixErr = NULL;
    std::vector<Davix::DavIOVecInput> in(nReq);
@@ -102,7 +113,7 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       R__ASSERT(ioVec[i].fSize > 0);
    }
 
-   auto ret = fFileDes->pos.preadVec(fFileDes->fd, in.data(), out.data(), nReq, &davixErr);
+   auto ret = fileDes.pos.preadVec(fileDes.fd, in.data(), out.data(), nReq, &davixErr);
    if (ret < 0) {
       throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + davixErr->getErrMsg());
    }
@@ -111,3 +122,61 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       ioVec[i].fOutBytes = out[i].diov_size;
    }
 }
+
+void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   std::size_t nbytes = 0;
+   for (unsigned int i = 0; i < nReq; ++i)
+      nbytes += ioVec[i].fSize;
+   const unsigned int nConnections = std::min({static_cast<std::size_t>(fOptions.fNumConnections),
+                                               static_cast<std::size_t>(nReq), nbytes / kMinBytesPerConnection});
+   if (nConnections <= 1) {
+      ReadVConnection(*fFileDes, ioVec, nReq);
+      return;
+   }
+
+   while (fConnections.size() < nConnections - 1) {
+      auto connection = std::make_unique<RDavixFileDes>();
+      Davix::DavixError *err = nullptr;
+      connection->fd = connection->pos.open(nullptr, fUrl, O_RDONLY, &err);
+      if (connection->fd == nullptr) {
+         throw std::runtime_error("Cannot open additional connection to '" + fUrl + "', error: " + err->getErrMsg());
+      }
+      fConnections.emplace_back(std::move(connection));
+   }
+
+   // Split the requests into consecutive slices of about the same number of bytes. The first slice is read
+   // by the calling thread, the others by one thread per additional connection.
+   std::vector<unsigned int> sliceStart{0};
+   std::size_t sliceBytes = 0;
+   for (unsigned int i = 0; i < nReq && sliceStart.size() < nConnections; ++i) {
+      sliceBytes += ioVec[i].fSize;
+      if (sliceBytes * nConnections >= nbytes * sliceStart.size() && i + 1 < nReq)
+         sliceStart.emplace_back(i + 1);
+   }
+   sliceStart.emplace_back(nReq);
+
+   std::vector<std::future<void>> futures;
+   for (std::size_t s = 1; s + 1 < sliceStart.size(); ++s) {
+      futures.emplace_back(std::async(std::launch::async, &RRawFileDavix::ReadVConnection, this,
+                                      std::ref(*fConnections[s - 1]), ioVec + sliceStart[s],
+                                      sliceStart[s + 1] - sliceStart[s]));
+   }
+   // All the slices must be finished before an error is reported, the buffers belong to the caller
+   std::exception_ptr error;
+   try {
+      ReadVConnection(*fFileDes, ioVec, sliceStart[1]);
+   } catch (...) {
+      error = std::current_exception();
+   }
+   for (auto &f : futures) {
+      try {
+         f.get();
+      } catch (...) {
+         if (!error)
+            error = std::current_exception();
+      }
+   }
+   if (error)
+      std::rethrow_exception(error);
+}
@@ -30,6 +30,7 @@
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
+#include "ROOT/RIOMetrics.hxx"
 #include "ROOT/RLogger.hxx"
 #include "TDavixFile.h"
 #include "TROOT.h"
@@ -740,6 +741,16 @@ Bool_t TDavixFile::ReadBuffer(char *buf, Int_t len)
    Davix_fd *fd;
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
+
+   // Try to read from the local block cache
+   Long64_t pos = fOffset;
+   if (Int_t status = ReadBuffersViaBlockCache(buf, &pos, &len, 1)) {
+      if (status == 2)
+         return kTRUE;
+      fOffset += len;
+      return kFALSE;
+   }
+
    Long64_t ret = DavixReadBuffer(fd, buf, len);
    if (ret < 0)
       return kTRUE;
@@ -759,6 +770,10 @@ Bool_t TDavixFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
 
+   // Try to read from the local block cache
+   if (Int_t status = ReadBuffersViaBlockCache(buf, &pos, &len, 1))
+      return status == 2;
+
    Long64_t ret = DavixPReadBuffer(fd, buf, pos, len);
    if (ret < 0)
       return kTRUE;
@@ -793,9 +808,14 @@ Bool_t TDavixFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
 
+   // Try to read from the local block cache
+   if (Int_t status = ReadBuffersViaBlockCache(buf, pos, len, nbuf))
+      return status == 2;
+
    Long64_t ret = DavixReadBuffers(fd, buf, pos, len, nbuf);
    if (ret < 0)
       return kTRUE;
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kVectorReads, 1);
 
    if (gDebug > 1)
       Info("ReadBuffers", "%lld bytes of data read from a list of %d buffers",
@@ -897,6 +917,8 @@ void TDavixFile::eventStop(Double_t t_start, Long64_t len, bool read)
 
    SetFileBytesRead(GetFileBytesRead() + len);
    SetFileReadCalls(GetFileReadCalls() + 1);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, len);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
 
    if (gPerfStats)
       gPerfStats->FileReadEvent(this, (Int_t) len, t_start);
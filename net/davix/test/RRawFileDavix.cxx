@@ -63,3 +63,27 @@ TEST(RRawFileDavix, ReadV)
    EXPECT_EQ('H', buffer[0]);
    EXPECT_EQ('d', buffer[1]);
 }
+
+
+TEST(RRawFileDavix, ReadVConnections)
+{
+   RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   options.fNumConnections = 4;
+   std::unique_ptr<RRawFileDavix> f(new RRawFileDavix("http://root.cern.ch/files/davix.test", options));
+
+   char buffer[3];
+   RRawFile::RIOVec iovec[3];
+   for (unsigned int i = 0; i < 3; ++i) {
+      iovec[i].fBuffer = &buffer[i];
+      iovec[i].fOffset = 5 * i;
+      iovec[i].fSize = 1;
+   }
+   f->ReadV(iovec, 3);
+
+   for (unsigned int i = 0; i < 3; ++i)
+      EXPECT_EQ(1U, iovec[i].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ(',', buffer[1]);
+   EXPECT_EQ('l', buffer[2]);
+}
@@ -215,6 +215,8 @@ public:
 
    Bool_t CompressWithGzip();
 
+   Bool_t CompressWithZstd();
+
    void SetZipping(Int_t mode = kZipLarge) { fZipping = mode; }
    Int_t GetZipping() const { return fZipping; }
 
@@ -39,6 +39,8 @@ protected:
    Bool_t fOwnThread{kFALSE};           ///<! true when specialized thread allocated for processing requests
    std::thread fThrd;                   ///<! own thread
    Bool_t fWSOnly{kFALSE};              ///<! when true, handle only websockets / longpoll engine
+   Bool_t fReadInThreads{kFALSE};       ///<! when true, read requests are processed in engine threads
+   std::recursive_mutex fObjectsMutex;  ///<! mutex to protect objects when read requests processed in threads
 
    TString fJSROOTSYS;       ///<! location of local JSROOT files
    TString fTopName{"ROOT"}; ///<! name of top folder, default - "ROOT"
@@ -72,6 +74,10 @@ protected:
 
    static Bool_t VerifyFilePath(const char *fname);
 
+   Bool_t IsReadRequest(const THttpCallArg &arg) const;
+
+   void ProcessLockedRequest(std::shared_ptr<THttpCallArg> &arg);
+
    THttpServer(const THttpServer &) = delete;
    THttpServer &operator=(const THttpServer &) = delete;
 
@@ -130,6 +136,14 @@ public:
 
    void CreateServerThread();
 
+   void SetReadRequestsInThreads(Bool_t on = kTRUE);
+
+   /** returns kTRUE if read requests are processed in engine threads */
+   Bool_t IsReadRequestsInThreads() const { return fReadInThreads; }
+
+   /** returns mutex, which must be locked when modifying objects accessed via server */
+   std::recursive_mutex &GetObjectsMutex() { return fObjectsMutex; }
+
    /** Check if file is requested, thread safe */
    Bool_t IsFileRequested(const char *uri, TString &res) const;
 
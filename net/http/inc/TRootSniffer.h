@@ -14,6 +14,7 @@
 
 #include "TNamed.h"
 #include "TList.h"
+#include <map>
 #include <memory>
 #include <string>
 
@@ -128,6 +129,15 @@ protected:
    TList fRestrictions;                ///<! list of restrictions for different locations
    TString fAutoLoad;                  ///<! scripts names, which are add as _autoload parameter to h.json request
 
+   struct CachedItem_t {
+      ULong_t fHash{0};      ///<! hash of object memory when content was produced
+      std::string fContent;  ///<! produced content
+      TString fClassName;    ///<! value of RootClassName header for binary content
+   };
+
+   Int_t fCacheSize{0};                          ///<! maximal number of cached items, 0 - no caching
+   std::map<std::string, CachedItem_t> fCache; ///<! json and binary representations of histograms
+
    void ScanObjectMembers(TRootSnifferScanRec &rec, TClass *cl, char *ptr);
 
    virtual void ScanObjectProperties(TRootSnifferScanRec &rec, TObject *obj);
@@ -177,6 +187,8 @@ protected:
    virtual Bool_t
    ProduceMulti(const std::string &path, const std::string &options, std::string &res, Bool_t asjson = kTRUE);
 
+   Bool_t ProduceCached(const std::string &path, const std::string &file, const std::string &options, std::string &res);
+
 public:
    TRootSniffer(const char *name, const char *objpath = "Objects");
    virtual ~TRootSniffer();
@@ -205,6 +217,14 @@ public:
 
    const char *GetAutoLoad() const;
 
+   void SetCacheSize(Int_t sz = 1000);
+
+   /** Returns maximal number of cached items */
+   Int_t GetCacheSize() const { return fCacheSize; }
+
+   /** Clears cached json and binary representations */
+   void ClearCache() { fCache.clear(); }
+
    /** Returns true when sniffer allowed to scan global directories */
    Bool_t IsScanGlobalDir() const { return fScanGlobalDir; }
 
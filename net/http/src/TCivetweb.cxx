@@ -376,7 +376,7 @@ static int begin_request_handler(struct mg_connection *conn, void *)
          mg_send_file(conn, filename.Data());
    } else {
 
-      Bool_t dozip = kFALSE;
+      Bool_t dozip = kFALSE, dozstd = kFALSE;
       switch (arg->GetZipping()) {
       case THttpCallArg::kNoZip: dozip = kFALSE; break;
       case THttpCallArg::kZipLarge:
@@ -389,6 +389,7 @@ static int begin_request_handler(struct mg_connection *conn, void *)
                continue;
             TString value = request_info->http_headers[n].value;
             dozip = (value.Index("gzip", 0, TString::kIgnoreCase) != kNPOS);
+            dozstd = (value.Index("zstd", 0, TString::kIgnoreCase) != kNPOS);
             break;
          }
 
@@ -396,6 +397,10 @@ static int begin_request_handler(struct mg_connection *conn, void *)
       case THttpCallArg::kZipAlways: dozip = kTRUE; break;
       }
 
+      // zstd is preferred when supported by the client, it is faster and compresses better
+      if (dozstd && arg->CompressWithZstd())
+         dozip = kFALSE;
+
       if (dozip)
          arg->CompressWithGzip();
 
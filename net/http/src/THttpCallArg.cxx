@@ -443,6 +443,44 @@ Bool_t THttpCallArg::CompressWithGzip()
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress reply data with zstd compression
+///
+/// Returns kFALSE and keeps content unchanged if it cannot be compressed,
+/// for instance when it is too small or larger than 16 MB
+
+Bool_t THttpCallArg::CompressWithZstd()
+{
+   Long_t objlen = GetContentLength();
+   // ROOT compression handles blocks up to 16 MB
+   if ((objlen <= 0) || (objlen > 0xffffff))
+      return kFALSE;
+
+   int srcsize = (int)objlen;
+   int tgtsize = (int)objlen;
+   int irep = 0;
+
+   std::string buffer;
+   buffer.resize(tgtsize);
+
+   R__zipMultipleAlgorithm(ROOT::RCompressionSetting::ELevel::kDefaultZSTD, &srcsize, (char *)GetContent(), &tgtsize,
+                           (char *)buffer.data(), &irep, ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+
+   // first 9 bytes is ROOT header, followed by standard zstd frame
+   const int hdrsize = 9;
+   if (irep <= hdrsize)
+      return kFALSE;
+
+   buffer.resize(irep);
+   buffer.erase(0, hdrsize);
+
+   SetContent(std::move(buffer));
+
+   SetEncoding("zstd");
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Method used to notify condition which waiting when operation will complete
 ///
@@ -31,6 +31,8 @@
 #include "TCivetweb.h"
 #include "TFastCgi.h"
 
+#include <ROOT/RIOMetrics.hxx>
+
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
@@ -87,6 +89,11 @@ If objects content is changing in the application, one could
 enable monitoring flag in the browser - than objects view
 will be regularly updated.
 
+The I/O metrics of the process (see ROOT::Experimental::RIOMetrics) are
+served as JSON at "http://localhost:8080/io_metrics.json" and in the
+Prometheus text format at "http://localhost:8080/io_metrics.txt", once
+enabled with ROOT::Experimental::RIOMetrics::Enable().
+
 More information: https://root.cern/root/htmldoc/guides/HttpServer/HttpServer.html
 */
 
@@ -583,11 +590,77 @@ Bool_t THttpServer::IsFileRequested(const char *uri, TString &res) const
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable processing of read requests directly in the engine threads
+///
+/// By default all requests are queued and processed in the main thread by
+/// ProcessRequests(), so that slow requests and a busy main thread delay the
+/// replies. When enabled, requests which only read objects - like h.json,
+/// root.json, root.bin or item.json without post data - are processed
+/// directly in the thread of the http engine which received them.
+/// Requests which may modify objects - like exe.json or cmd.json - as well as
+/// images production and websockets are still processed in the main thread.
+///
+/// All requests are processed with locked mutex returned by GetObjectsMutex(),
+/// in the engine or in the main thread, therefore they are processed one after
+/// another and never while main thread processes requests. User code must lock
+/// this mutex when modifying or deleting objects accessible via the server:
+///
+///     {
+///        std::lock_guard<std::recursive_mutex> lock(serv->GetObjectsMutex());
+///        for (int n = 0; n < 1000; ++n)
+///           hpx->Fill(gRandom->Gaus());
+///     }
+///
+/// Enabling this mode also enables ROOT thread safety, see ROOT::EnableThreadSafety()
+
+void THttpServer::SetReadRequestsInThreads(Bool_t on)
+{
+   if (on)
+      ROOT::EnableThreadSafety();
+   fReadInThreads = on;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if request only reads objects and can be processed in engine thread
+
+Bool_t THttpServer::IsReadRequest(const THttpCallArg &arg) const
+{
+   if (!arg.fPostData.empty() || (!arg.fMethod.IsNull() && (arg.fMethod != "GET")))
+      return kFALSE;
+
+   TString filename = arg.fFileName;
+   if (filename.EndsWith(".gz"))
+      filename.Resize(filename.Length() - 3);
+
+   return (filename == "h.json") || (filename == "h.xml") || (filename == "get.xml") || (filename == "root.json") ||
+          (filename == "root.bin") || (filename == "root.xml") || (filename == "item.json") ||
+          (filename == "item.xml");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process request with locked objects mutex, set current call argument for the sniffer
+
+void THttpServer::ProcessLockedRequest(std::shared_ptr<THttpCallArg> &arg)
+{
+   std::lock_guard<std::recursive_mutex> grd(fObjectsMutex);
+
+   fSniffer->SetCurrentCallArg(arg.get());
+
+   try {
+      ProcessRequest(arg);
+      fSniffer->SetCurrentCallArg(nullptr);
+   } catch (...) {
+      fSniffer->SetCurrentCallArg(nullptr);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Executes http request, specified in THttpCallArg structure
 ///
 /// Method can be called from any thread
 /// Actual execution will be done in main ROOT thread, where analysis code is running.
+/// Read requests may be executed in the calling thread, see SetReadRequestsInThreads()
 
 Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
 {
@@ -597,11 +670,21 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
    if ((fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       // should not happen, but one could process requests directly without any signaling
 
-      ProcessRequest(arg);
+      if (fReadInThreads) {
+         std::lock_guard<std::recursive_mutex> grd(fObjectsMutex);
+         ProcessRequest(arg);
+      } else {
+         ProcessRequest(arg);
+      }
 
       return kTRUE;
    }
 
+   if (fReadInThreads && IsReadRequest(*arg)) {
+      ProcessLockedRequest(arg);
+      return kTRUE;
+   }
+
    // add call arg to the list
    std::unique_lock<std::mutex> lk(fMutex);
    fArgs.push(arg);
@@ -631,7 +714,18 @@ Bool_t THttpServer::SubmitHttp(std::shared_ptr<THttpCallArg> arg, Bool_t can_run
       return kFALSE;
 
    if (can_run_immediately && (fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
-      ProcessRequest(arg);
+      if (fReadInThreads) {
+         std::lock_guard<std::recursive_mutex> grd(fObjectsMutex);
+         ProcessRequest(arg);
+      } else {
+         ProcessRequest(arg);
+      }
+      arg->NotifyCondition();
+      return kTRUE;
+   }
+
+   if (fReadInThreads && IsReadRequest(*arg)) {
+      ProcessLockedRequest(arg);
       arg->NotifyCondition();
       return kTRUE;
    }
@@ -685,14 +779,19 @@ Int_t THttpServer::ProcessRequests()
          continue;
       }
 
-      fSniffer->SetCurrentCallArg(arg.get());
+      cnt++;
 
-      try {
-         cnt++;
-         ProcessRequest(arg);
-         fSniffer->SetCurrentCallArg(nullptr);
-      } catch (...) {
-         fSniffer->SetCurrentCallArg(nullptr);
+      if (fReadInThreads) {
+         ProcessLockedRequest(arg);
+      } else {
+         fSniffer->SetCurrentCallArg(arg.get());
+
+         try {
+            ProcessRequest(arg);
+            fSniffer->SetCurrentCallArg(nullptr);
+         } catch (...) {
+            fSniffer->SetCurrentCallArg(nullptr);
+         }
       }
 
       arg->NotifyCondition();
@@ -1033,6 +1132,13 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
       fSniffer->ScanHierarchy(topname, arg->fPathName.Data(), &store);
       arg->SetContent(std::string(res.Data()));
       arg->SetJson();
+   } else if ((filename == "io_metrics.json") && arg->fPathName.IsNull()) {
+      arg->SetContent(ROOT::Experimental::RIOMetrics::ToJSON());
+      arg->SetJson();
+   } else if ((filename == "io_metrics.txt") && arg->fPathName.IsNull()) {
+      // Prometheus text exposition format
+      arg->SetContent(ROOT::Experimental::RIOMetrics::ToPrometheus());
+      arg->SetContentType("text/plain; version=0.0.4");
    } else if (fSniffer->Produce(arg->fPathName.Data(), filename.Data(), arg->fQuery.Data(), arg->fContent)) {
       // define content type base on extension
       arg->SetContentType(GetMimeType(filename.Data()));
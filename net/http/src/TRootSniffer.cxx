@@ -1475,6 +1475,79 @@ Bool_t TRootSniffer::ProduceImage(Int_t /*kind*/, const std::string & /*path*/,
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable caching of json and binary representations of histograms
+///
+/// Online monitoring clients poll the same histograms again and again, while
+/// most of them do not change between two requests. With caching enabled,
+/// "root.json" and "root.bin" requests for histograms return stored content
+/// as long as the histogram object is unchanged. Modification is detected by
+/// hashing the memory of the histogram object itself, which changes with
+/// every Fill(), SetBinContent() or Reset() call since they update the number
+/// of entries or statistics. Modifications only of the bins content, for instance
+/// with AddBinContent(), are not detected - call ClearCache() after them.
+///
+/// @param sz maximal number of cached items, 0 disables caching
+
+void TRootSniffer::SetCacheSize(Int_t sz)
+{
+   fCacheSize = sz > 0 ? sz : 0;
+   if (!fCacheSize)
+      fCache.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Produce json or binary data, reusing previously produced content
+/// if histogram was not changed since. See SetCacheSize() for details
+
+Bool_t TRootSniffer::ProduceCached(const std::string &path, const std::string &file, const std::string &options,
+                                   std::string &res)
+{
+   Bool_t asjson = (file == "root.json");
+
+   const char *path_ = path.c_str();
+   if (*path_ == '/')
+      path_++;
+
+   TObject *obj = FindTObjectInHierarchy(path_);
+
+   // only histograms, other objects like canvases or graphs may change without change of own memory
+   if (!obj || !obj->InheritsFrom("TH1"))
+      return asjson ? ProduceJson(path, options, res) : ProduceBinary(path, options, res);
+
+   ULong_t hash = TString::Hash(obj, obj->IsA()->Size());
+
+   std::string key = file + ":" + path_ + "?" + options;
+
+   auto iter = fCache.find(key);
+   if ((iter != fCache.end()) && (iter->second.fHash == hash)) {
+      res = iter->second.fContent;
+      if (fCurrentArg && (iter->second.fClassName.Length() > 0))
+         fCurrentArg->SetExtraHeader("RootClassName", iter->second.fClassName.Data());
+      return kTRUE;
+   }
+
+   Bool_t res_ok = asjson ? ProduceJson(path, options, res) : ProduceBinary(path, options, res);
+
+   if (!res_ok) {
+      if (iter != fCache.end())
+         fCache.erase(iter);
+      return kFALSE;
+   }
+
+   if (iter == fCache.end()) {
+      if ((Int_t)fCache.size() >= fCacheSize)
+         fCache.erase(fCache.begin());
+      iter = fCache.emplace(key, CachedItem_t()).first;
+   }
+
+   iter->second.fHash = hash;
+   iter->second.fContent = res;
+   iter->second.fClassName = (fCurrentArg && !asjson) ? fCurrentArg->GetHeader("RootClassName") : TString();
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Method produce different kind of data out of object
 ///
@@ -1499,6 +1572,9 @@ Bool_t TRootSniffer::Produce(const std::string &path, const std::string &file, c
    if (file.empty())
       return kFALSE;
 
+   if ((fCacheSize > 0) && ((file == "root.bin") || (file == "root.json")))
+      return ProduceCached(path, file, options, res);
+
    if (file == "root.bin")
       return ProduceBinary(path, options, res);
 
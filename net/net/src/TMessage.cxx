@@ -26,9 +26,14 @@
 #include "Bytes.h"
 #include "TProcessID.h"
 #include "RZip.h"
+#include "TROOT.h"
+#include "ROOT/RZipRecords.hxx"
 
 Bool_t TMessage::fgEvolution = kFALSE;
 
+// size of the records of large messages compressed with implicit multi-threading
+static const Int_t kMTZIPBUF = 0x100000;
+
 
 ClassImp(TMessage);
 
@@ -299,6 +304,8 @@ void TMessage::SetCompressionSettings(Int_t settings)
 ////////////////////////////////////////////////////////////////////////////////
 /// Compress the message. The message will only be compressed if the
 /// compression level > 0 and the if the message is > 256 bytes.
+/// With implicit multi-threading enabled, large messages are compressed in
+/// records of kMTZIPBUF bytes, which are compressed in parallel.
 /// Returns -1 in case of error (when compression fails or
 /// when the message increases in size in some pathological cases),
 /// otherwise returns 0.
@@ -343,37 +350,26 @@ Int_t TMessage::Compress()
 
    Int_t hdrlen   = 2*sizeof(UInt_t);
    Int_t messlen  = Length() - hdrlen;
-   Int_t nbuffers = 1 + (messlen - 1) / kMAXZIPBUF;
+   // the receiver inflates the records whatever their size
+   Int_t reclen   = (ROOT::IsImplicitMTEnabled() && messlen > 2*kMTZIPBUF) ? kMTZIPBUF : kMAXZIPBUF;
+   Int_t nbuffers = 1 + (messlen - 1) / reclen;
    Int_t chdrlen  = 3*sizeof(UInt_t);   // compressed buffer header length
    Int_t buflen   = std::max(512, chdrlen + messlen + 9*nbuffers);
    fBufComp       = new char[buflen];
-   char *messbuf  = Buffer() + hdrlen;
-   char *bufcur   = fBufComp + chdrlen;
-   Int_t nzip     = 0;
-   Int_t nout, bufmax;
-   for (Int_t i = 0; i < nbuffers; ++i) {
-      if (i == nbuffers - 1)
-         bufmax = messlen - nzip;
-      else
-         bufmax = kMAXZIPBUF;
-      R__zipMultipleAlgorithm(compressionLevel, &bufmax, messbuf, &bufmax, bufcur, &nout,
-                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compressionAlgorithm));
-      if (nout == 0 || nout >= messlen) {
-         //this happens when the buffer cannot be compressed
-         delete [] fBufComp;
-         fBufComp    = nullptr;
-         fBufCompCur = nullptr;
-         fCompPos    = nullptr;
-         return -1;
-      }
-      bufcur  += nout;
-      messbuf += kMAXZIPBUF;
-      nzip    += kMAXZIPBUF;
+   Int_t nzip     = ROOT::Internal::ZipRecords(compressionLevel, compressionAlgorithm, Buffer() + hdrlen, messlen,
+                                               fBufComp + chdrlen, reclen);
+   if (nzip == 0) {
+      //this happens when the buffer cannot be compressed
+      delete [] fBufComp;
+      fBufComp    = nullptr;
+      fBufCompCur = nullptr;
+      fCompPos    = nullptr;
+      return -1;
    }
-   fBufCompCur = bufcur;
+   fBufCompCur = fBufComp + chdrlen + nzip;
    fCompPos    = fBufCur;
 
-   bufcur = fBufComp;
+   char *bufcur = fBufComp;
    tobuf(bufcur, (UInt_t)(CompLength() - sizeof(UInt_t)));
    Int_t what = fWhat | kMESS_ZIP;
    tobuf(bufcur, what);
@@ -385,6 +381,8 @@ Int_t TMessage::Compress()
 ////////////////////////////////////////////////////////////////////////////////
 /// Uncompress the message. The message will only be uncompressed when
 /// kMESS_ZIP is set. Returns -1 in case of error, 0 otherwise.
+/// With implicit multi-threading enabled, the records of the message are
+/// inflated in parallel.
 
 Int_t TMessage::Uncompress()
 {
@@ -410,18 +408,7 @@ Int_t TMessage::Uncompress()
    fBufMax  = fBuffer + fBufSize;
    char *messbuf = fBuffer + hdrlen;
 
-   Int_t nout;
-   Int_t noutot = 0;
-   while (1) {
-      Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-      if (hc!=0) break;
-      R__unzip(&nin, bufcur, &nbuf, (unsigned char*) messbuf, &nout);
-      if (!nout) break;
-      noutot += nout;
-      if (noutot >= buflen - hdrlen) break;
-      bufcur  += nin;
-      messbuf += nout;
-   }
+   ROOT::Internal::UnzipRecords(bufcur, fBufCompCur - (char *)bufcur, messbuf, buflen - hdrlen);
 
    fWhat &= ~kMESS_ZIP;
    fCompress = 1;
@@ -19,6 +19,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TWebFile.h"
+#include "ROOT/RIOMetrics.hxx"
 #include "TROOT.h"
 #include "TSocket.h"
 #include "Bytes.h"
@@ -500,6 +501,8 @@ Bool_t TWebFile::ReadBuffer10(char *buf, Int_t len)
 
 Bool_t TWebFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 {
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kVectorReads, 1);
+
    if (!fHasModRoot)
       return ReadBuffers10(buf, pos, len, nbuf);
 
@@ -659,6 +662,8 @@ Int_t TWebFile::GetFromWeb(char *buf, Int_t len, const TString &msg)
    fgBytesRead += len;
    fgReadCalls++;
 #endif
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, len);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
 
    if (gPerfStats)
       gPerfStats->FileReadEvent(this, len, start);
@@ -960,6 +965,8 @@ Int_t TWebFile::GetFromWeb10(char *buf, Int_t len, const TString &msg, Int_t nse
    fgBytesRead += len;
    fgReadCalls++;
 #endif
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, len);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
 
    if (gPerfStats)
       gPerfStats->FileReadEvent(this, len, start);
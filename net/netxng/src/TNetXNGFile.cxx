@@ -20,6 +20,7 @@
 
 #include "TArchiveFile.h"
 #include "TNetXNGFile.h"
+#include "ROOT/RIOMetrics.hxx"
 #include "TEnv.h"
 #include "TSystem.h"
 #include "TTimeStamp.h"
@@ -416,6 +417,14 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
       return kFALSE;
    }
 
+   // Try to read from the local block cache
+   if ((status = ReadBuffersViaBlockCache(buffer, &position, &length, 1))) {
+      if (status == 2)
+         return kTRUE;
+      fOffset += length;
+      return kFALSE;
+   }
+
    Double_t start = 0;
    if (gPerfStats) start = TTimeStamp();
 
@@ -442,6 +451,8 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
    fgBytesRead += bytesRead;
    fReadCalls  ++;
    fgReadCalls ++;
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, bytesRead);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
 
    if (gPerfStats)
       gPerfStats->FileReadEvent(this, (Int_t)bytesRead, start);
@@ -473,6 +484,10 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if (!IsUseable())
       return kTRUE;
 
+   // Try to read from the local block cache
+   if (Int_t status = ReadBuffersViaBlockCache(buffer, position, length, nbuffs))
+      return status == 2;
+
    std::vector<ChunkList>      chunkLists;
    ChunkList                   chunks;
    std::vector<XRootDStatus*> *statuses;
@@ -577,6 +592,9 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    fgBytesRead += totalBytes;
    fReadCalls  ++;
    fgReadCalls ++;
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kBytesRead, totalBytes);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kReadCalls, 1);
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kVectorReads, 1);
 
    if (gPerfStats) {
       fOffset = position[0];
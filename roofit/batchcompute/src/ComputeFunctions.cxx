@@ -488,6 +488,103 @@ __rooglobal__ void computeNovosibirsk(BatchesHandle batches)
       batches._output[i] = fast_exp(batches._output[i]);
 }
 
+/* The inputs are the nominal template followed by the low and high variations of each parameter. The extra
+ * arguments are the value and the interpolation code of each parameter, followed by whether the output is
+ * initialised with the nominal template, such that the parameters can be split between several calls, and whether
+ * negative values are set to zero. As the code and the value of a parameter are the same for all events, the
+ * interpolation regime is chosen outside of the loops over the events, which are free of branches.
+ */
+__rooglobal__ void computePiecewiseInterpolation(BatchesHandle batches)
+{
+   const int nParams = (batches.getNExtraArgs() - 2) / 2;
+   Batch nominal = batches[0];
+   if (batches.extraArg(2 * nParams) != 0.0)
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+         batches._output[i] = nominal[i];
+
+   for (int param = 0; param < nParams; param++) {
+      Batch low = batches[1 + 2 * param], high = batches[2 + 2 * param];
+      const double x = batches.extraArg(2 * param);
+      switch (static_cast<int>(batches.extraArg(2 * param + 1))) {
+      case 0: // piece-wise linear
+         if (x > 0)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] += x * (high[i] - nominal[i]);
+         else
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] += x * (nominal[i] - low[i]);
+         break;
+      case 1: // piece-wise log
+         if (x >= 0)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] *= pow(high[i] / nominal[i], +x);
+         else
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] *= pow(low[i] / nominal[i], -x);
+         break;
+      case 2: // parabolic with linear
+      case 3: // parabolic version of log-normal
+         if (x > 1.)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+               const double a = 0.5 * (high[i] + low[i]) - nominal[i];
+               const double b = 0.5 * (high[i] - low[i]);
+               batches._output[i] += (2 * a + b) * (x - 1) + high[i] - nominal[i];
+            }
+         else if (x < -1.)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+               const double a = 0.5 * (high[i] + low[i]) - nominal[i];
+               const double b = 0.5 * (high[i] - low[i]);
+               batches._output[i] += -1 * (2 * a - b) * (x + 1) + low[i] - nominal[i];
+            }
+         else
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+               const double a = 0.5 * (high[i] + low[i]) - nominal[i];
+               const double b = 0.5 * (high[i] - low[i]);
+               batches._output[i] += a * x * x + b * x;
+            }
+         break;
+      case 4: // polynomial interpolation and linear extrapolation
+         if (x > 1.)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] += x * (high[i] - nominal[i]);
+         else if (x < -1.)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] += x * (nominal[i] - low[i]);
+         else
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+               const double epsPlus = high[i] - nominal[i];
+               const double epsMinus = nominal[i] - low[i];
+               const double S = 0.5 * (epsPlus + epsMinus);
+               const double A = 0.0625 * (epsPlus - epsMinus);
+               const double val = nominal[i] + x * (S + x * A * (15. + x * x * (-10. + x * x * 3.)));
+               batches._output[i] += (val < 0. ? 0. : val) - nominal[i];
+            }
+         break;
+      case 5: // parabolic interpolation and linear extrapolation
+         if (x > 1.)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] += x * (high[i] - nominal[i]);
+         else if (x < -1.)
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+               batches._output[i] += x * (nominal[i] - low[i]);
+         else
+            for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+               const double epsPlus = high[i] - nominal[i];
+               const double epsMinus = nominal[i] - low[i];
+               const double S = (epsPlus + epsMinus) / 2;
+               const double A = (epsPlus - epsMinus) / 2;
+               const double val = nominal[i] + S * x + 3 * A / 2 * x * x - A / 2 * x * x * x * x;
+               batches._output[i] += nominal[i] != 0. ? (val < 0. ? 0. : val) - nominal[i] : 0.;
+            }
+         break;
+      }
+   }
+
+   if (batches.extraArg(2 * nParams + 1) != 0.0)
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+         batches._output[i] = batches._output[i] < 0. ? 0. : batches._output[i];
+}
+
 __rooglobal__ void computePoisson(BatchesHandle batches)
 {
    Batch x = batches[0], mean = batches[1];
@@ -619,6 +716,7 @@ std::vector<void (*)(BatchesHandle)> getFunctions()
            computeLognormal,
            computeNegativeLogarithms,
            computeNovosibirsk,
+           computePiecewiseInterpolation,
            computePoisson,
            computePolynomial,
            computeProdPdf,
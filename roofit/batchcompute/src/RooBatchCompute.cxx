@@ -69,7 +69,9 @@ public:
    /** Compute multiple values using optimized functions.
    This method creates a Batches object and passes it to the correct compute function.
    In case Implicit Multithreading is enabled, the events to be processed are equally
-   divided among the tasks to be generated and computed in parallel.
+   divided among the tasks to be generated and computed in parallel, as long as
+   each task gets at least `minEventsPerTask` events. This function can be called
+   concurrently, e.g. by the RooFitDriver for independent nodes of the computation graph.
    \param computer An enum specifying the compute function to be used.
    \param output The array where the computation results are stored.
    \param nEvents The number of events to be processed.
@@ -78,12 +80,15 @@ public:
    void compute(cudaStream_t *, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
                 const ArgVector &extraArgs) override
    {
-      static std::vector<double> buffer;
-      buffer.resize(vars.size() * bufferSize);
+      // The buffers for the scalar variables, one per thread since Batches::Batches() fills them
+      thread_local std::vector<double> buffer;
 
-      if (ROOT::IsImplicitMTEnabled()) {
+      // Splitting smaller spans in parallel tasks costs more than it gains
+      constexpr std::size_t minEventsPerTask = 16 * bufferSize;
+
+      if (ROOT::IsImplicitMTEnabled() && nEvents >= 2 * minEventsPerTask) {
          ROOT::Internal::TExecutor ex;
-         std::size_t nThreads = ex.GetPoolSize();
+         std::size_t nThreads = std::min<std::size_t>(ex.GetPoolSize(), nEvents / minEventsPerTask);
 
          std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
 
@@ -94,6 +99,7 @@ public:
 
             // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
             // Then advance every object but the first to split the work between threads
+            buffer.resize(vars.size() * bufferSize);
             Batches batches(output, nEventsPerThread, vars, extraArgs, buffer.data());
             batches.advance(batches.getNEvents() * idx);
 
@@ -122,6 +128,7 @@ public:
       } else {
          // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
          // Then advance every object but the first to split the work between threads
+         buffer.resize(vars.size() * bufferSize);
          Batches batches(output, nEvents, vars, extraArgs, buffer.data());
 
          int events = batches.getNEvents();
@@ -43,7 +43,7 @@ namespace HistFactory{
 
     void setInterpCode(RooAbsReal& param, int code);
     void setAllInterpCodes(int code);
-    void setGlobalBoundary(double boundary) {_interpBoundary = boundary;}
+    void setGlobalBoundary(double boundary) {_interpBoundary = boundary; _logInit = false; _cachedTerms.clear();}
     void setNominal(double newNominal);
     void setLow(RooAbsReal& param, double newLow);
     void setHigh(RooAbsReal& param, double newHigh);
@@ -64,6 +64,7 @@ namespace HistFactory{
   private:
 
     double PolyInterpValue(int i, double x) const;
+    double interpolationTerm(int i, double x) const;
 
   protected:
 
@@ -76,6 +77,8 @@ namespace HistFactory{
 
     mutable bool         _logInit ;            ///<! flag used for caching polynomial coefficients
     mutable std::vector< double>  _polCoeff;     ///<! cached polynomial coefficients
+    mutable std::vector<double> _cachedParamVals; ///<! parameter values for which the terms were cached
+    mutable std::vector<double> _cachedTerms;     ///<! cached term of each parameter, see evaluate()
 
     double evaluate() const override;
 
@@ -17,6 +17,7 @@
 
 #include "Riostream.h"
 #include <math.h>
+#include <limits>
 #include "TMath.h"
 
 #include "RooAbsReal.h"
@@ -197,6 +198,7 @@ void FlexibleInterpVar::setInterpCode(RooAbsReal& param, int code){
   }
   // GHL: Adding suggestion by Swagato:
   _logInit = false ;
+  _cachedTerms.clear();
   setValueDirty();
 }
 
@@ -208,6 +210,7 @@ void FlexibleInterpVar::setAllInterpCodes(int code){
   }
   // GHL: Adding suggestion by Swagato:
   _logInit = false ;
+  _cachedTerms.clear();
   setValueDirty();
 
 }
@@ -219,6 +222,7 @@ void FlexibleInterpVar::setNominal(double newNominal){
   _nominal = newNominal;
 
   _logInit = false ;
+  _cachedTerms.clear();
 
   setValueDirty();
 }
@@ -237,6 +241,7 @@ void FlexibleInterpVar::setLow(RooAbsReal& param, double newLow){
   }
 
   _logInit = false ;
+  _cachedTerms.clear();
 
   setValueDirty();
 }
@@ -255,6 +260,7 @@ void FlexibleInterpVar::setHigh(RooAbsReal& param, double newHigh){
   }
 
   _logInit = false ;
+  _cachedTerms.clear();
   setValueDirty();
 }
 
@@ -358,90 +364,95 @@ const std::vector<double>& FlexibleInterpVar::low() const { return _low; }
 const std::vector<double>& FlexibleInterpVar::high() const { return _high; }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Calculate and return value of polynomial
+/// Return the contribution of the i-th parameter at value x: a factor for the interpolation codes 1 and 4, which
+/// are multiplicative, and a term added to the total for the other codes.
 
-double FlexibleInterpVar::evaluate() const
+double FlexibleInterpVar::interpolationTerm(int i, double x) const
 {
-  double total(_nominal) ;
-  int i=0;
-
-  for (auto arg : _paramList) {
-    auto param = static_cast<const RooAbsReal*>(arg);
-
-    Int_t icode = _interpCode[i] ;
-
-    switch(icode) {
-
-    case 0: {
-      // piece-wise linear
-      if(param->getVal()>0)
-   total +=  param->getVal()*(_high[i] - _nominal );
-      else
-   total += param->getVal()*(_nominal - _low[i]);
-      break ;
+  switch(_interpCode[i]) {
+
+  case 0: {
+    // piece-wise linear
+    if(x>0)
+      return x*(_high[i] - _nominal );
+    else
+      return x*(_nominal - _low[i]);
+  }
+  case 1: {
+    // pice-wise log
+    if(x>=0)
+      return pow(_high[i]/_nominal, +x);
+    else
+      return pow(_low[i]/_nominal,  -x);
+  }
+  case 2:
+  case 3: {
+    // parabolic with linear, and parabolic version of log-normal
+    double a = 0.5*(_high[i]+_low[i])-_nominal;
+    double b = 0.5*(_high[i]-_low[i]);
+    double c = 0;
+    if(x>1 ){
+      return (2*a+b)*(x-1)+_high[i]-_nominal;
+    } else if(x<-1 ) {
+      return -1*(2*a-b)*(x+1)+_low[i]-_nominal;
+    } else {
+      return a*pow(x,2) + b*x+c;
     }
-    case 1: {
-      // pice-wise log
-      if(param->getVal()>=0)
-   total *= pow(_high[i]/_nominal, +param->getVal());
-      else
-   total *= pow(_low[i]/_nominal,  -param->getVal());
-      break ;
+  }
+  case 4: {
+    double boundary = _interpBoundary;
+
+    if(x >= boundary)
+    {
+       return std::pow(_high[i]/_nominal, +x);
     }
-    case 2: {
-      // parabolic with linear
-      double a = 0.5*(_high[i]+_low[i])-_nominal;
-      double b = 0.5*(_high[i]-_low[i]);
-      double c = 0;
-      if(param->getVal()>1 ){
-   total += (2*a+b)*(param->getVal()-1)+_high[i]-_nominal;
-      } else if(param->getVal()<-1 ) {
-   total += -1*(2*a-b)*(param->getVal()+1)+_low[i]-_nominal;
-      } else {
-   total +=  a*pow(param->getVal(),2) + b*param->getVal()+c;
-      }
-      break ;
+    else if (x <= -boundary)
+    {
+       return std::pow(_low[i]/_nominal, -x);
     }
-    case 3: {
-      //parabolic version of log-normal
-      double a = 0.5*(_high[i]+_low[i])-_nominal;
-      double b = 0.5*(_high[i]-_low[i]);
-      double c = 0;
-      if(param->getVal()>1 ){
-   total += (2*a+b)*(param->getVal()-1)+_high[i]-_nominal;
-      } else if(param->getVal()<-1 ) {
-   total += -1*(2*a-b)*(param->getVal()+1)+_low[i]-_nominal;
-      } else {
-   total +=  a*pow(param->getVal(),2) + b*param->getVal()+c;
-      }
-      break ;
+    else if (x != 0)
+    {
+       return PolyInterpValue(i, x);
     }
+    return 1.;
+  }
+  default: {
+    coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  " << _paramList[i].GetName()
+           << " with unknown interpolation code" << endl ;
+    return 0.;
+  }
+  }
+}
 
-    case 4: {
-      double boundary = _interpBoundary;
-      double x = param->getVal();
-      //std::cout << icode << " param " << param->GetName() << "  " << param->getVal() << " boundary " << boundary << std::endl;
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate and return value of polynomial
+///
+/// The term of each parameter is cached, and only recomputed when the value of the parameter has changed. This
+/// avoids most of the calls to `pow` in fits, where only a few of the many parameters of a HistFactory model change
+/// between two evaluations, e.g. in the computation of the numerical gradient.
 
-      if(x >= boundary)
-      {
-         total *= std::pow(_high[i]/_nominal, +param->getVal());
-      }
-      else if (x <= -boundary)
-      {
-         total *= std::pow(_low[i]/_nominal, -param->getVal());
-      }
-      else if (x != 0)
-      {
-         total *= PolyInterpValue(i, x);
-      }
-      break ;
-    }
-    default: {
-      coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  " << param->GetName()
-             << " with unknown interpolation code" << endl ;
+double FlexibleInterpVar::evaluate() const
+{
+  const std::size_t nParams = _paramList.size();
+  if (_cachedTerms.size() != nParams) {
+    _cachedTerms.assign(nParams, 0.);
+    _cachedParamVals.assign(nParams, std::numeric_limits<double>::quiet_NaN());
+  }
+
+  double total(_nominal) ;
+  for (std::size_t i = 0; i < nParams; ++i) {
+    const double x = static_cast<const RooAbsReal&>(_paramList[i]).getVal();
+    // the cache is initialised with NaN, which never compares equal
+    if (!(x == _cachedParamVals[i])) {
+      _cachedTerms[i] = interpolationTerm(i, x);
+      _cachedParamVals[i] = x;
     }
+    const int icode = _interpCode[i];
+    if (icode == 1 || icode == 4) {
+      total *= _cachedTerms[i];
+    } else {
+      total += _cachedTerms[i];
     }
-    ++i;
   }
 
   if(total<=0) {
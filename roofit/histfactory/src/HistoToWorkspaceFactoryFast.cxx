@@ -319,6 +319,19 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
   return observables;
 }
 
+  namespace {
+
+  /// Convert a template histogram to a RooDataHist that is moved into the workspace, such that importing the functions
+  /// reading it does not copy it again.
+  RooDataHist &importDataHist(RooWorkspace &proto, const std::string &name, const RooArgList &observables,
+                              const TH1 *hist)
+  {
+    proto.import(std::make_unique<RooDataHist>(name.c_str(), "", observables, hist), RooFit::Embedded());
+    return *static_cast<RooDataHist *>(proto.embeddedData(name));
+  }
+
+  }
+
   /// Create the nominal hist function from `hist`, and register it in the workspace.
   RooHistFunc* HistoToWorkspaceFactoryFast::MakeExpectedHistFunc(const TH1* hist,RooWorkspace* proto, string prefix,
       const RooArgList& observables) const {
@@ -340,8 +353,7 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
 
     prefix += "_Hist_alphanominal";
 
-    RooDataHist histDHist((prefix + "DHist").c_str(),"",observables,hist);
-    RooHistFunc histFunc(prefix.c_str(),"",observables,histDHist,0);
+    RooHistFunc histFunc(prefix.c_str(),"",observables,importDataHist(*proto, prefix + "DHist", observables, hist),0);
 
     proto->import(histFunc, RecycleConflictNodes());
     auto histFuncInWS = static_cast<RooHistFunc*>(proto->arg(prefix.c_str()));
@@ -412,12 +424,12 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
       str<<"_"<<j;
 
       const HistoSys& histoSys = histoSysList.at(j);
-      RooDataHist* lowDHist = new RooDataHist((prefix+str.str()+"lowDHist").c_str(),"",observables, histoSys.GetHistoLow());
-      RooDataHist* highDHist = new RooDataHist((prefix+str.str()+"highDHist").c_str(),"",observables, histoSys.GetHistoHigh());
-      RooHistFunc* lowFunc = new RooHistFunc((prefix+str.str()+"low").c_str(),"",observables,*lowDHist,0) ;
-      RooHistFunc* highFunc = new RooHistFunc((prefix+str.str()+"high").c_str(),"",observables,*highDHist,0) ;
-      lowSet.add(*lowFunc);
-      highSet.add(*highFunc);
+      RooDataHist &lowDHist =
+         importDataHist(*proto, prefix + str.str() + "lowDHist", observables, histoSys.GetHistoLow());
+      RooDataHist &highDHist =
+         importDataHist(*proto, prefix + str.str() + "highDHist", observables, histoSys.GetHistoHigh());
+      lowSet.addOwned(std::make_unique<RooHistFunc>((prefix+str.str()+"low").c_str(),"",observables,lowDHist,0));
+      highSet.addOwned(std::make_unique<RooHistFunc>((prefix+str.str()+"high").c_str(),"",observables,highDHist,0));
     }
 
     // this is sigma(params), a piece-wise linear interpolation
@@ -0,0 +1,89 @@
+// Tests for the PiecewiseInterpolation and the FlexibleInterpVar
+
+#include <RooArgList.h>
+#include <RooConstVar.h>
+#include <RooDataSet.h>
+#include <RooFormulaVar.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+#include <RooStats/HistFactory/FlexibleInterpVar.h>
+#include <RooStats/HistFactory/PiecewiseInterpolation.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/// Validate the BatchMode results of the PiecewiseInterpolation against the scalar ones, for all interpolation codes
+/// and more parameters than fit in a single call of the RooBatchCompute library.
+TEST(PiecewiseInterpolation, BatchModeMatchesScalar)
+{
+   RooRealVar x{"x", "x", 0., 10.};
+   RooFormulaVar nominal{"nominal", "2. + 0.1 * x", x};
+
+   const int nParams = 150;
+   RooArgList params;
+   RooArgList lows;
+   RooArgList highs;
+   std::vector<std::unique_ptr<RooAbsArg>> owned;
+   for (int i = 0; i < nParams; ++i) {
+      const std::string suffix = std::to_string(i);
+      auto param = std::make_unique<RooRealVar>(("alpha" + suffix).c_str(), "", 0., -5., 5.);
+      // the values cover the interpolation and the extrapolation regimes
+      param->setVal(-2.5 + 5. * i / nParams);
+      auto low = std::make_unique<RooFormulaVar>(("low" + suffix).c_str(), "(1.9 + 0.01 * @1) + 0.09 * @0",
+                                                 RooArgList{x, RooFit::RooConst(i % 7)});
+      auto high = std::make_unique<RooFormulaVar>(("high" + suffix).c_str(), "(2.1 + 0.01 * @1) + 0.12 * @0",
+                                                  RooArgList{x, RooFit::RooConst(i % 5)});
+      params.add(*param);
+      lows.add(*low);
+      highs.add(*high);
+      owned.push_back(std::move(param));
+      owned.push_back(std::move(low));
+      owned.push_back(std::move(high));
+   }
+
+   RooDataSet data{"data", "data", x};
+   for (int i = 0; i < 100; ++i) {
+      x.setVal(RooRandom::uniform() * 10.);
+      data.add(x);
+   }
+
+   for (int code = 0; code <= 5; ++code) {
+      PiecewiseInterpolation interp{"interp", "", nominal, lows, highs, params};
+      interp.setAllInterpCodes(code);
+      interp.setPositiveDefinite();
+
+      auto resultsBatch = interp.getValues(data);
+      for (int i = 0; i < data.numEntries(); ++i) {
+         x.setVal(data.get(i)->getRealValue("x"));
+         EXPECT_NEAR(resultsBatch[i], interp.getVal(), 1e-9 * std::abs(interp.getVal()))
+            << "interpolation code " << code << ", entry " << i;
+      }
+   }
+}
+
+/// The cached terms of the FlexibleInterpVar are recomputed when the parameters or the interpolation codes change.
+TEST(FlexibleInterpVar, CachedTermsFollowChanges)
+{
+   RooRealVar alpha{"alpha", "", 0., -5., 5.};
+   RooRealVar beta{"beta", "", 0., -5., 5.};
+   RooStats::HistFactory::FlexibleInterpVar interp{"interp", "", {alpha, beta}, 1., {0.9, 0.8}, {1.1, 1.3}};
+
+   EXPECT_DOUBLE_EQ(interp.getVal(), 1.);
+
+   alpha.setVal(1.);
+   EXPECT_DOUBLE_EQ(interp.getVal(), 1.1);
+   beta.setVal(-1.);
+   EXPECT_DOUBLE_EQ(interp.getVal(), 1.1 - 0.2);
+
+   interp.setAllInterpCodes(1);
+   EXPECT_DOUBLE_EQ(interp.getVal(), 1.1 * 0.8);
+
+   alpha.setVal(2.);
+   EXPECT_DOUBLE_EQ(interp.getVal(), 1.1 * 1.1 * 0.8);
+
+   interp.setHigh(alpha, 1.2);
+   EXPECT_DOUBLE_EQ(interp.getVal(), 1.2 * 1.2 * 0.8);
+}
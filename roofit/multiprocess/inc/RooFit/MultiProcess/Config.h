@@ -30,6 +30,7 @@ public:
 
       static std::size_t defaultNEventTasks;
       static std::size_t defaultNComponentTasks;
+      static bool defaultLoadBalancing;
    };
 private:
    static unsigned int defaultNWorkers_;
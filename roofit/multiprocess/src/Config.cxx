@@ -29,7 +29,8 @@ namespace MultiProcess {
  * are:
  * 1. the number of workers to be deployed,
  * 2. the number of event-tasks in LikelihoodJobs,
- * 3. and the number of component-tasks in LikelihoodJobs.
+ * 3. the number of component-tasks in LikelihoodJobs,
+ * 4. and whether LikelihoodJobs balance the load of their tasks dynamically.
  *
  * The default number of workers is set using 'std::thread::hardware_concurrency()'.
  * To change it, use 'Config::setDefaultNWorkers()' to set it to a different value
@@ -52,6 +53,14 @@ namespace MultiProcess {
  * number of workers in the JobManager, with events divided equally over workers. For
  * components, the automatic mode uses just 1 task for all components. These automatic
  * modes may change in the future (for instance, we may switch them around).
+ *
+ * When Config::LikelihoodJob::defaultLoadBalancing is set to true (the default is
+ * false), newly created LikelihoodJobs don't split the work by a fixed number of
+ * event and component ranges. Instead, the product of the numbers of event- and
+ * component-tasks gives the total number of tasks, and each task gets a part of the
+ * (component, event range) pairs of the likelihood with roughly the same cost. The
+ * cost of the components is measured by timing the tasks on the workers, and the
+ * tasks are redistributed between evaluations when their durations get unbalanced.
  */
 
 void Config::setDefaultNWorkers(unsigned int N_workers)
@@ -74,6 +83,7 @@ unsigned int Config::getDefaultNWorkers()
 unsigned int Config::defaultNWorkers_ = std::thread::hardware_concurrency();
 std::size_t Config::LikelihoodJob::defaultNEventTasks = Config::LikelihoodJob::automaticNEventTasks;
 std::size_t Config::LikelihoodJob::defaultNComponentTasks = Config::LikelihoodJob::automaticNComponentTasks;
+bool Config::LikelihoodJob::defaultLoadBalancing = false;
 
 } // namespace MultiProcess
 } // namespace RooFit
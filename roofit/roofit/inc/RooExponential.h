@@ -41,6 +41,10 @@ protected:
   double evaluate() const override;
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  bool canComputeBatchGradient() const override { return true; }
+  bool computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &,
+                            RooFit::Detail::GradientMap &gradMap) const override;
+  bool translate(RooFit::Detail::CodeSquashContext &ctx) const override;
 
 private:
   ClassDefOverride(RooExponential,1) // Exponential PDF
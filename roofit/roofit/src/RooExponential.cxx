@@ -29,9 +29,11 @@ range and values of the arguments.
 
 #include "RooRealVar.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 
 #include <cmath>
+#include <string>
 
 using namespace std;
 
@@ -68,6 +70,37 @@ void RooExponential::computeBatch(cudaStream_t* stream, double* output, size_t n
   dispatch->compute(stream, RooBatchCompute::Exponential, output, nEvents, {dataMap.at(x),dataMap.at(c)});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Propagate the gradient with respect to the values \f$ f = \exp(c x) \f$
+/// to the inputs, using \f$ \partial f / \partial c = x f \f$ and
+/// \f$ \partial f / \partial x = c f \f$.
+
+bool RooExponential::computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &dataMap,
+                                          RooFit::Detail::GradientMap &gradMap) const
+{
+  auto values = dataMap.at(this);
+  auto xVals = dataMap.at(x);
+  auto cVals = dataMap.at(c);
+  RooSpan<double> xGrad = gradMap.at(x);
+  RooSpan<double> cGrad = gradMap.at(c);
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    const double gradTimesValue = grad[i] * values[i];
+    if (!xGrad.empty()) RooFit::Detail::GradientMap::add(xGrad, i, gradTimesValue * cVals[cVals.size() == 1 ? 0 : i]);
+    if (!cGrad.empty()) RooFit::Detail::GradientMap::add(cGrad, i, gradTimesValue * xVals[xVals.size() == 1 ? 0 : i]);
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the code that computes the exponential for the code generation backend.
+
+bool RooExponential::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  ctx.addResult(this, "std::exp(" + ctx.getResult(c) + " * " + ctx.getResult(x) + ")");
+  return true;
+}
+
 
 Int_t RooExponential::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
 {
@@ -25,7 +25,9 @@ Plain Gaussian p.d.f
 #include "RooHelpers.h"
 #include "RooMath.h"
 #include "RooRandom.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
+#include <string>
 #include <vector>
 
 ClassImp(RooGaussian);
@@ -70,6 +72,46 @@ void RooGaussian::computeBatch(cudaStream_t* stream, double* output, size_t nEve
           {dataMap.at(x), dataMap.at(mean), dataMap.at(sigma)});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Propagate the gradient with respect to the (unnormalized) values
+/// \f$ f = \exp(-\frac{1}{2} (x - \mu)^2 / \sigma^2) \f$ to the inputs, using
+/// \f$ \partial f / \partial \mu = -\partial f / \partial x = f (x - \mu) / \sigma^2 \f$ and
+/// \f$ \partial f / \partial \sigma = f (x - \mu)^2 / \sigma^3 \f$.
+
+bool RooGaussian::computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &dataMap,
+                                       RooFit::Detail::GradientMap &gradMap) const
+{
+  auto values = dataMap.at(this);
+  auto xVals = dataMap.at(x);
+  auto meanVals = dataMap.at(mean);
+  auto sigmaVals = dataMap.at(sigma);
+  RooSpan<double> xGrad = gradMap.at(x);
+  RooSpan<double> meanGrad = gradMap.at(mean);
+  RooSpan<double> sigmaGrad = gradMap.at(sigma);
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    const double arg = xVals[xVals.size() == 1 ? 0 : i] - meanVals[meanVals.size() == 1 ? 0 : i];
+    const double sig = sigmaVals[sigmaVals.size() == 1 ? 0 : i];
+    const double dMean = grad[i] * values[i] * arg / (sig * sig);
+    if (!xGrad.empty()) RooFit::Detail::GradientMap::add(xGrad, i, -dMean);
+    if (!meanGrad.empty()) RooFit::Detail::GradientMap::add(meanGrad, i, dMean);
+    if (!sigmaGrad.empty()) RooFit::Detail::GradientMap::add(sigmaGrad, i, dMean * arg / sig);
+  }
+  return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the code that computes the Gaussian for the code generation backend.
+
+bool RooGaussian::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  const std::string arg = "(" + ctx.getResult(x) + " - " + ctx.getResult(mean) + ")";
+  const std::string sig = ctx.getResult(sigma);
+  ctx.addResult(this, "std::exp(-0.5 * " + arg + " * " + arg + " / (" + sig + " * " + sig + "))");
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooGaussian::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
@@ -47,6 +47,11 @@ namespace Experimental {
 class RooFitDriver ;
 }
 }
+namespace RooFit {
+namespace Detail {
+class CodeSquashContext;
+}
+}
 
 class TH1;
 class TH1F;
@@ -394,6 +399,29 @@ protected:
                      RooArgSet *&cloneSet, const char* rangeName=nullptr, const RooArgSet* condObs=nullptr) const;
   virtual void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const;
 
+  /// Whether computeBatchGradient() is implemented for this class.
+  virtual bool canComputeBatchGradient() const { return false; }
+  /// Propagate the gradient `grad` with respect to the `size` output values of
+  /// this node to the gradients of its servers in `gradMap`, given their output
+  /// values in `dataMap`. Returns `false` if the gradient can't be computed for
+  /// the current inputs, in which case nothing must have been propagated.
+  virtual bool computeBatchGradient(double const * /*grad*/, size_t /*size*/, RooFit::Detail::DataMap const &,
+                                    RooFit::Detail::GradientMap &) const
+  {
+    return false;
+  }
+
+  /// Whether the gradient() of this function with respect to its parameters is available.
+  virtual bool hasGradient() const { return false; }
+  /// Fill `out` with the derivatives of this function with respect to the parameters in `params`.
+  virtual void gradient(RooArgList const & /*params*/, double * /*out*/) const {}
+
+  /// Add the C++ code that computes the value of this node to the context of
+  /// the code generation backend, see RooFit::Detail::CodeSquashContext.
+  /// Returns `false` if the code can't be generated, in which case nothing
+  /// must have been added to the context.
+  virtual bool translate(RooFit::Detail::CodeSquashContext & /*ctx*/) const { return false; }
+
  protected:
 
   RooFitResult* chi2FitDriver(RooAbsReal& fcn, RooLinkedList& cmdList) ;
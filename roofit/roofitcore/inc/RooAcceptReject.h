@@ -20,11 +20,19 @@
 #include "RooPrintable.h"
 #include "RooArgSet.h"
 
+#include <memory>
+#include <vector>
+
 class RooAbsReal;
 class RooRealVar;
 class RooDataSet;
 class RooRealBinding;
 class RooNumGenFactory ;
+namespace ROOT {
+namespace Experimental {
+class RooFitDriver;
+}
+} // namespace ROOT
 
 class RooAcceptReject : public RooAbsNumGenerator {
 public:
@@ -32,6 +40,7 @@ public:
     // coverity[UNINIT_CTOR]
   } ;
   RooAcceptReject(const RooAbsReal &func, const RooArgSet &genVars, const RooNumGenConfig& config, bool verbose=false, const RooAbsReal* maxFuncVal=nullptr);
+  ~RooAcceptReject() override;
   RooAbsNumGenerator* clone(const RooAbsReal& func, const RooArgSet& genVars, const RooArgSet& /*condVars*/,
              const RooNumGenConfig& config, bool verbose=false, const RooAbsReal* maxFuncVal=nullptr) const override {
     return new RooAcceptReject(func,genVars,config,verbose,maxFuncVal) ;
@@ -52,6 +61,8 @@ protected:
   static void registerSampler(RooNumGenFactory& fact) ;
 
   void addEventToCache();
+  void addEventsToCache(Long64_t nEvents);
+  void storeEvent(double val);
   const RooArgSet *nextAcceptedEvent();
 
   double _maxFuncVal, _funcSum;       ///< Maximum function value found, and sum of all samples made
@@ -61,6 +72,10 @@ protected:
   UInt_t _eventsUsed;                   ///< Accepted number of function samples
 
   UInt_t _minTrialsArray[4];            ///< Minimum number of trials samples for 1,2,3 dimensional problems
+  UInt_t _batchSize = 0;                ///< Number of trial samples evaluated together, zero to disable batches
+
+  std::unique_ptr<ROOT::Experimental::RooFitDriver> _driver; ///<! Evaluates the function for batches of trial samples
+  std::vector<double> _trialValues;                         ///<! Values of the generated variables in the current batch
 
   ClassDefOverride(RooAcceptReject,0) // Context for generating a dataset from a PDF
 };
@@ -55,6 +55,10 @@ public:
   bool isBinnedDistribution(const RooArgSet& obs) const override  ;
 
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
+  bool canComputeBatchGradient() const override { return true; }
+  bool computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &,
+                            RooFit::Detail::GradientMap &gradMap) const override;
+  bool translate(RooFit::Detail::CodeSquashContext &ctx) const override;
 
 protected:
 
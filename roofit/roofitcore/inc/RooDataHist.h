@@ -100,6 +100,8 @@ public:
                std::function<double(int)> getBinScale = [](int){ return 1.0; } );
 
   void weights(double* output, RooSpan<double const> xVals, int intOrder, bool correctForBinSize, bool cdfBoundaries);
+  bool weights(double* output, std::vector<RooSpan<double const>> const& xVals, std::size_t nEvents,
+               bool correctForBinSize);
   /// Return weight of i-th bin. \see getIndex()
   double weight(std::size_t i) const { return _wgt[i]; }
   double weightFast(const RooArgSet& bin, int intOrder, bool correctForBinSize, bool cdfBoundaries);
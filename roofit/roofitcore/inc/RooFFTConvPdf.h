@@ -19,6 +19,9 @@
 #include "RooHistPdf.h"
 #include "TVirtualFFT.h"
 
+#include <complex>
+#include <vector>
+
 class RooRealVar;
 
 ///PDF for the numerical (FFT) convolution of two PDFs.
@@ -89,6 +92,25 @@ protected:
 
     std::unique_ptr<RooAbsBinning> histBinning;
     std::unique_ptr<RooAbsBinning> scanBinning;
+
+    /// The Fourier transform of the sampling of an input pdf in one cache slice
+    struct Spectrum {
+      std::vector<std::complex<double>> values;
+      Int_t binShift = 0;
+    };
+
+    // The spectra of the input pdfs are kept for each cache slice, such that
+    // they are only recomputed for the input pdf whose parameters changed.
+    std::vector<Spectrum> spectra1;
+    std::vector<Spectrum> spectra2;
+    RooArgSet pdf1Params;
+    RooArgSet pdf2Params;
+    std::vector<double> pdf1ParamValues;
+    std::vector<double> pdf2ParamValues;
+    bool recompute1 = true;
+    bool recompute2 = true;
+    Int_t nBins = 0;           ///< Number of bins of the convolution observable
+    Int_t nBinsWithBuffer = 0; ///< Number of sampled bins, including the buffer zones
   };
 
   friend class FFTCacheElem ;
@@ -99,7 +121,7 @@ protected:
   RooArgSet* actualParameters(const RooArgSet& nset) const override ;
   RooAbsArg& pdfObservable(RooAbsArg& histObservable) const override ;
   void fillCacheObject(PdfCacheElem& cache) const override ;
-  void fillCacheSlice(FFTCacheElem& cache, const RooArgSet& slicePosition) const ;
+  void fillCacheSlice(FFTCacheElem& cache, const RooArgSet& slicePosition, std::size_t sliceIndex=0) const ;
 
   PdfCacheElem* createCache(const RooArgSet* nset) const override ;
   TString histNameSuffix() const override ;
@@ -0,0 +1,99 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_Detail_CodeSquashContext_h
+#define RooFit_Detail_CodeSquashContext_h
+
+#include <RooAbsArg.h>
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+template <class T>
+class RooTemplateProxy;
+
+namespace RooFit {
+namespace Detail {
+
+/// \class RooFit::Detail::CodeSquashContext
+/// Collects the C++ code of a computation graph that is "squashed" into a
+/// single function by the code generation backend of the RooFitDriver, see
+/// RooAbsReal::translate().
+///
+/// The generated function has the signature
+/// `double f(double const *params, double const *const *data, double const *ext)`.
+/// Nodes whose output is a single value are computed once per function call,
+/// the nodes with one value per event are computed in the event loops that
+/// are opened by the reducer nodes with beginLoop() and endLoop(). The code of
+/// such a per-event node is generated when its result is first requested in a
+/// loop. Values that can't be expressed as code are passed in the `ext` array,
+/// which is filled before each call, see addExternals().
+class CodeSquashContext {
+public:
+   /// Return the expression for the value of `arg` in the current scope,
+   /// generating the code that computes it if necessary.
+   std::string const &getResult(RooAbsArg const &arg);
+   template <class T>
+   std::string const &getResult(RooTemplateProxy<T> const &proxy)
+   {
+      return getResult(proxy.arg());
+   }
+
+   /// Declare a variable that holds the value of `arg`, computed with the expression `expr`.
+   void addResult(RooAbsArg const *arg, std::string const &expr);
+   void addToCodeBody(std::string const &code) { _code += code; }
+   std::string getTmpVarName(std::string const &prefix = "tmp");
+
+   bool isPerEvent(RooAbsArg const &arg) const;
+   void beginLoop(RooAbsArg const *reducer);
+   void endLoop();
+
+   std::size_t addExternals(std::size_t n, std::function<void(double *)> fillValues);
+
+   static std::string buildLiteral(double value);
+
+   /// \name Interface for the RooFitDriver
+   /// @{
+   void setOutputSize(RooAbsArg const &arg, std::size_t size) { _outputSizes[arg.namePtr()] = size; }
+   std::size_t addDataInput(RooAbsArg const &arg);
+   std::string assembleCode(std::string const &funcName, std::string const &returnExpr) const;
+   /// The number of values in the `ext` array of the generated function.
+   std::size_t nExternals() const { return _nExternals; }
+   void fillExternals(double *ext) const;
+   /// @}
+
+private:
+   using Scope = std::unordered_map<TNamed const *, std::string>;
+
+   struct Externals {
+      std::size_t first = 0;
+      std::size_t n = 0;
+      std::function<void(double *)> fillValues;
+   };
+
+   std::size_t outputSize(RooAbsArg const &arg) const;
+
+   std::string _code;
+   std::deque<Scope> _scopes = std::deque<Scope>(1); ///< The outer scope and the scope of the current event loop
+   std::unordered_map<TNamed const *, std::size_t> _outputSizes;
+   std::unordered_map<TNamed const *, std::size_t> _dataIndices;
+   std::vector<Externals> _externals;
+   std::size_t _nExternals = 0;
+   std::size_t _tmpCounter = 0;
+};
+
+} // namespace Detail
+} // namespace RooFit
+
+#endif
@@ -112,6 +112,38 @@ private:
    std::vector<RooSpan<const double>> _dataMap;
 };
 
+/// \class RooFit::Detail::GradientMap
+/// Holds the gradient of the top node of a computation graph with respect to
+/// the outputs of the other nodes, indexed like the DataMap. It is filled by
+/// the RooFitDriver in a reverse pass over the graph, where each node adds its
+/// contributions to the gradients of its servers in
+/// RooAbsReal::computeBatchGradient(). The span of a node that doesn't depend
+/// on any floating parameter is empty.
+class GradientMap {
+public:
+   auto size() const { return _gradMap.size(); }
+   auto resize(std::size_t n) { return _gradMap.resize(n); }
+
+   inline auto &at(RooAbsArg const *arg) { return _gradMap[arg->dataToken()]; }
+
+   template <class T>
+   inline auto &at(RooTemplateProxy<T> const &proxy)
+   {
+      return at(&proxy.arg());
+   }
+
+   /// Add `value` to the gradient with respect to the `i`-th output value of a
+   /// server. For a server with a single output value, i.e. a parameter, all
+   /// contributions are summed up.
+   static inline void add(RooSpan<double> grad, std::size_t i, double value)
+   {
+      grad[grad.size() == 1 ? 0 : i] += value;
+   }
+
+private:
+   std::vector<RooSpan<double>> _gradMap;
+};
+
 } // namespace Detail
 } // namespace RooFit
 
@@ -107,6 +107,12 @@ public:
    /// likelihood classes without a cached dataset, like RooSubsidiaryL.
    virtual void constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt);
 
+   /// \brief Move the dataset to read-only shared memory before the MultiProcess workers are forked.
+   ///
+   /// The default implementation does so for the data of this likelihood if it is stored in a RooVectorDataStore.
+   /// Overridden in RooSumL to forward the call to all components.
+   virtual void moveDataToSharedMemory();
+
    virtual std::string GetName() const;
    virtual std::string GetTitle() const;
    virtual std::string GetInfo() const { return GetClassName() + "::" + pdf_->GetName(); }
@@ -37,6 +37,7 @@ public:
    ROOT::Math::KahanSum<double> getSubsidiaryValue();
 
    void constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt) override;
+   void moveDataToSharedMemory() override;
 
    virtual std::string GetClassName() const  override { return "RooSumL"; };
 
@@ -65,7 +65,7 @@ enum MPSplit { BulkPartition=0, Interleave=1, SimComponents=2, Hybrid=3 } ;
 
 /// For setting the batch mode flag with the BatchMode() command argument to
 /// RooAbsPdf::fitTo();
-enum class BatchModeOption { Off, Cpu, Cuda, Old };
+enum class BatchModeOption { Off, Cpu, Cuda, Old, CodeGen };
 
 /**
  * \defgroup CmdArgs RooFit command arguments
@@ -266,6 +266,7 @@ RooCmdArg Integrate(bool flag) ;
 RooCmdArg Minimizer(const char* type, const char* alg=nullptr) ;
 RooCmdArg Offset(bool flag=true) ;
 RooCmdArg RecoverFromUndefinedRegions(double strength);
+RooCmdArg AnalyticalGradient(bool flag=true) ;
 /** @} */
 
 // RooAbsPdf::paramOn arguments
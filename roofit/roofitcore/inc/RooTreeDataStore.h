@@ -74,13 +74,8 @@ public:
   void weightError(double& lo, double& hi, RooAbsData::ErrorType etype=RooAbsData::Poisson) const override ;
   bool isWeighted() const override { return (_wgtVar!=nullptr||_extWgtArray!=nullptr) ; }
 
-  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len) const override {
-    //TODO
-    std::cerr << "This functionality is not yet implemented for tree data stores." << std::endl;
-    throw std::logic_error("getBatches() not implemented in RooTreeDataStore.");
-    (void)first; (void)len;
-    return {};
-  }
+  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len) const override;
+  RooAbsData::CategorySpans getCategoryBatches(std::size_t first, std::size_t len) const override;
   RooSpan<const double> getWeightBatch(std::size_t first, std::size_t len) const override;
 
   // Change observable name
@@ -171,6 +166,13 @@ public:
   const double* _extWgtErrHiArray{nullptr};    ///<! External weight array - high error
   const double* _extSumW2Array{nullptr};       ///<! External sum of weights array
   mutable std::unique_ptr<std::vector<double>> _weightBuffer; //! Buffer for weights in case a batch of values is requested.
+  /// Columns of the observables, read from the tree when a batch of values is first requested
+  mutable std::vector<std::pair<const RooAbsReal *, std::vector<double>>> _realColumns; //!
+  mutable std::vector<std::pair<const RooAbsCategory *, std::vector<RooAbsCategory::value_type>>> _catColumns; //!
+  mutable bool _columnsLoaded = false; //!
+
+  void loadColumns() const;
+  void clearColumnBuffers();
 
   mutable double  _curWgt = 1.0;      ///< Weight of current event
   mutable double  _curWgtErrLo = 0.0; ///< Weight of current event
@@ -171,9 +171,20 @@ public:
   const RooVectorDataStore* cache() const { return _cache ; }
 
   void loadValues(const RooAbsDataStore *tds, const RooFormulaVar* select=nullptr, const char* rangeName=nullptr, std::size_t nStart=0, std::size_t nStop = std::numeric_limits<std::size_t>::max()) override;
+  /// Load the values of the branches of a TTree, without an intermediate copy of the tree.
+  void loadValues(const TTree *t, const RooFormulaVar* select=nullptr);
 
   void dump() override;
 
+  /// \name Sharing of the data columns with forked processes
+  /// Used by the RooFit::MultiProcess workers, not meant for user code.
+  /// @{
+  void moveToSharedMemory();
+  void releaseSharedMemory();
+  /// Whether the data columns are currently in read-only shared memory, see moveToSharedMemory().
+  bool isInSharedMemory() const { return _isShared; }
+  /// @}
+
   void setExternalWeightArray(const double* arrayWgt, const double* arrayWgtErrLo,
       const double* arrayWgtErrHi, const double* arraySumW2) override {
     _extWgtArray = arrayWgt ;
@@ -684,6 +695,7 @@ public:
   RooAbsArg* _cacheOwner = nullptr; ///<! Cache owner
 
   bool _forcedUpdate = false; ///<! Request for forced cache update
+  bool _isShared = false; ///<! Whether the data columns are in shared memory, see moveToSharedMemory()
 
   ClassDefOverride(RooVectorDataStore, 7) // STL-vector-based Data Storage class
 };
@@ -36,6 +36,7 @@ namespace ROOT {
 namespace Experimental {
 
 struct NodeInfo;
+struct GeneratedCode;
 
 class RooFitDriver {
 public:
@@ -57,6 +58,8 @@ public:
    ~RooFitDriver();
    std::vector<double> getValues();
    double getVal();
+   bool hasGradient() const;
+   void gradient(RooArgList const &params, double *out);
    RooAbsReal &topNode() const;
 
    void print(std::ostream &os) const;
@@ -66,9 +69,17 @@ private:
    // Private member functions
 
    double getValHeterogeneous();
+   double getValMultiThreaded();
+   bool updateGeneratedCode();
+   bool generateCode();
+   double getValGeneratedCode();
    void markGPUNodes();
    void assignToGPU(NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
+   void updateVariable(NodeInfo &info);
+   void recomputeCPUNode(NodeInfo &info);
+   std::vector<bool> nodesNeedingGradient() const;
+   void computeNumericalGradient(NodeInfo &info);
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void determineOutputSizes();
 
@@ -85,6 +96,10 @@ private:
    RooFit::Detail::DataMap _dataMapCPU;
    RooFit::Detail::DataMap _dataMapCUDA;
 
+   // the gradients of the top node with respect to the outputs of the nodes
+   RooFit::Detail::GradientMap _gradMap;
+   std::vector<std::vector<double>> _gradBuffers;
+
    // the ordered computation graph
    std::vector<NodeInfo> _nodes;
 
@@ -96,6 +111,10 @@ private:
    std::stack<RooHelpers::ChangeOperModeRAII> _changeOperModeRAIIs;
 
    std::vector<std::unique_ptr<RooAbsData>> _splittedDataSets;
+
+   // the function generated by the code generation backend
+   std::unique_ptr<GeneratedCode> _generatedCode;
+   bool _codeGenerationFailed = false;
 };
 
 } // end namespace Experimental
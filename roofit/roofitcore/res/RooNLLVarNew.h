@@ -45,6 +45,10 @@ public:
 
    inline RooAbsPdf *getPdf() const { return &*_pdf; }
    void computeBatch(cudaStream_t *, double *output, size_t nOut, RooFit::Detail::DataMap const &) const override;
+   bool canComputeBatchGradient() const override { return true; }
+   bool computeBatchGradient(double const *grad, size_t nOut, RooFit::Detail::DataMap const &,
+                             RooFit::Detail::GradientMap &gradMap) const override;
+   bool translate(RooFit::Detail::CodeSquashContext &ctx) const override;
    inline bool isReducerNode() const override { return true; }
 
    RooArgSet prefixArgNames(std::string const &prefix);
@@ -123,6 +123,9 @@ public:
 
    double getValV(const RooArgSet *) const override { return evaluate(); }
 
+   bool hasGradient() const override { return _driver->hasGradient(); }
+   void gradient(RooArgList const &params, double *out) const override { _driver->gradient(params, out); }
+
    void applyWeightSquared(bool flag) override
    {
       const_cast<RooAbsReal &>(_driver->topNode()).applyWeightSquared(flag);
@@ -255,4 +258,7 @@ void RooFit::BatchModeHelpers::logArchitectureInfo(RooFit::BatchModeOption batch
    if (batchMode == RooFit::BatchModeOption::Cuda) {
       log("using CUDA computation library");
    }
+   if (batchMode == RooFit::BatchModeOption::CodeGen) {
+      log("using code generation backend");
+   }
 }
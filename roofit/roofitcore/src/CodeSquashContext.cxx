@@ -0,0 +1,172 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooFit/Detail/CodeSquashContext.h>
+
+#include <RooAbsReal.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace RooFit {
+namespace Detail {
+
+std::string const &CodeSquashContext::getResult(RooAbsArg const &arg)
+{
+   for (auto scope = _scopes.rbegin(); scope != _scopes.rend(); ++scope) {
+      auto found = scope->find(arg.namePtr());
+      if (found != scope->end()) {
+         return found->second;
+      }
+   }
+
+   const bool perEvent = isPerEvent(arg);
+   if (perEvent && _scopes.size() == 1) {
+      throw std::runtime_error(std::string("CodeSquashContext: the values of \"") + arg.GetName() +
+                               "\" depend on the event, but they are used outside of an event loop.");
+   }
+
+   auto dataIndex = _dataIndices.find(arg.namePtr());
+   if (dataIndex != _dataIndices.end()) {
+      Scope &scope = perEvent ? _scopes.back() : _scopes.front();
+      std::string expr = "data[" + std::to_string(dataIndex->second) + "][" + (perEvent ? "i" : "0") + "]";
+      return scope[arg.namePtr()] = std::move(expr);
+   }
+
+   auto *absReal = dynamic_cast<RooAbsReal const *>(&arg);
+   if (!absReal || !absReal->translate(*this)) {
+      throw std::runtime_error(std::string("CodeSquashContext: the class ") + arg.ClassName() + " of \"" +
+                               arg.GetName() + "\" doesn't support the code generation.");
+   }
+   auto found = _scopes.back().find(arg.namePtr());
+   if (found == _scopes.back().end()) {
+      throw std::logic_error(std::string("CodeSquashContext: ") + arg.ClassName() +
+                             "::translate() didn't add the result of \"" + arg.GetName() + "\".");
+   }
+   return found->second;
+}
+
+void CodeSquashContext::addResult(RooAbsArg const *arg, std::string const &expr)
+{
+   std::string name = getTmpVarName(arg->GetName());
+   _code += std::string(3 * _scopes.size(), ' ') + "const double " + name + " = " + expr + ";\n";
+   _scopes.back()[arg->namePtr()] = std::move(name);
+}
+
+/// Return a new variable name that starts with the given prefix, with all
+/// characters that are not allowed in C++ identifiers replaced.
+std::string CodeSquashContext::getTmpVarName(std::string const &prefix)
+{
+   std::string name = prefix;
+   for (char &c : name) {
+      if (!std::isalnum(static_cast<unsigned char>(c))) {
+         c = '_';
+      }
+   }
+   // The loop index "i" and the arguments of the function can't clash with
+   // the names ending with the counter.
+   return "_" + name + "_" + std::to_string(_tmpCounter++);
+}
+
+bool CodeSquashContext::isPerEvent(RooAbsArg const &arg) const
+{
+   return outputSize(arg) > 1;
+}
+
+/// Open the loop over the events of the servers of the reducer node, in which
+/// the per-event values it depends on are computed.
+void CodeSquashContext::beginLoop(RooAbsArg const *reducer)
+{
+   if (_scopes.size() > 1) {
+      throw std::runtime_error(std::string("CodeSquashContext: the reducer \"") + reducer->GetName() +
+                               "\" is evaluated inside an event loop.");
+   }
+   std::size_t nEvents = 1;
+   for (RooAbsArg *server : reducer->servers()) {
+      if (server->isValueServer(*reducer)) {
+         nEvents = std::max(nEvents, outputSize(*server));
+      }
+   }
+   _code += "   for (std::size_t i = 0; i < " + std::to_string(nEvents) + "; ++i) {\n";
+   _scopes.emplace_back();
+}
+
+void CodeSquashContext::endLoop()
+{
+   _scopes.pop_back();
+   _code += "   }\n";
+}
+
+/// Reserve `n` values of the `ext` array for values that can't be computed
+/// in the generated code. The function `fillValues` is called with a pointer
+/// to the first of these values before each call of the generated function.
+/// \return The index of the first of the reserved values.
+std::size_t CodeSquashContext::addExternals(std::size_t n, std::function<void(double *)> fillValues)
+{
+   _externals.push_back({_nExternals, n, std::move(fillValues)});
+   _nExternals += n;
+   return _externals.back().first;
+}
+
+void CodeSquashContext::fillExternals(double *ext) const
+{
+   for (auto const &externals : _externals) {
+      externals.fillValues(ext + externals.first);
+   }
+}
+
+/// Return a C++ literal that represents the given value exactly.
+std::string CodeSquashContext::buildLiteral(double value)
+{
+   if (std::isnan(value)) {
+      return "std::numeric_limits<double>::quiet_NaN()";
+   }
+   if (std::isinf(value)) {
+      return value > 0 ? "std::numeric_limits<double>::infinity()" : "(-std::numeric_limits<double>::infinity())";
+   }
+   std::stringstream ss;
+   ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+   std::string out = ss.str();
+   // Make sure that the literal is a double, also in integer divisions
+   if (out.find_first_of(".e") == std::string::npos) {
+      out += ".";
+   }
+   return value < 0 ? "(" + out + ")" : out;
+}
+
+/// Register a node whose values are taken from the dataset, which are passed
+/// to the function as `data[index]`.
+std::size_t CodeSquashContext::addDataInput(RooAbsArg const &arg)
+{
+   const std::size_t index = _dataIndices.size();
+   _dataIndices[arg.namePtr()] = index;
+   return index;
+}
+
+std::string CodeSquashContext::assembleCode(std::string const &funcName, std::string const &returnExpr) const
+{
+   return "#include <cmath>\n#include <cstddef>\n#include <limits>\n\ndouble " + funcName +
+          "(double const *params, double const *const *data, double const *ext)\n{\n" + _code + "   return " +
+          returnExpr + ";\n}\n";
+}
+
+std::size_t CodeSquashContext::outputSize(RooAbsArg const &arg) const
+{
+   auto found = _outputSizes.find(arg.namePtr());
+   return found != _outputSizes.end() ? found->second : 1;
+}
+
+} // namespace Detail
+} // namespace RooFit
@@ -18,6 +18,11 @@
 
 #include "RooNormalizedPdf.h"
 
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <string>
+
 namespace {
 
 using RooFit::Detail::DataKey;
@@ -138,6 +143,56 @@ void treeNodeServerListAndNormSets(const RooAbsArg &arg, RooAbsCollection &list,
    }
 }
 
+/// Hash of the structure of the computation graph of `arg`: the class names
+/// and meta arguments of the nodes, and the names of the leaves. Like this,
+/// pdfs that were cloned from the same prototype and only differ by their name
+/// get the same fingerprint.
+std::size_t fingerprint(RooAbsArg const &arg, std::unordered_map<DataKey, std::size_t> &fingerprints)
+{
+   auto found = fingerprints.find(&arg);
+   if (found != fingerprints.end())
+      return found->second;
+
+   std::stringstream ss;
+   ss << arg.ClassName();
+   if (arg.servers().empty()) {
+      ss << "::" << arg.GetName();
+   } else {
+      arg.printMetaArgs(ss);
+      for (RooAbsArg *server : arg.servers()) {
+         ss << "," << fingerprint(*server, fingerprints) << (server->isValueServer(arg) ? "v" : "")
+            << (server->isShapeServer(arg) ? "s" : "");
+      }
+   }
+   const std::size_t hash = std::hash<std::string>{}(ss.str());
+   fingerprints.emplace(&arg, hash);
+   return hash;
+}
+
+/// Hash that is equal for the normalization integrals of two pdfs if they are
+/// equivalent.
+std::size_t normIntegralFingerprint(RooAbsPdf const &pdf, RooArgSet const &normSet,
+                                    std::unordered_map<DataKey, std::size_t> &fingerprints)
+{
+   std::stringstream ss;
+   ss << fingerprint(pdf, fingerprints) << "|" << (pdf.normRange() ? pdf.normRange() : "") << "|"
+      << pdf.getIntegratorConfig() << "|";
+   for (RooAbsArg *arg : normSet) {
+      ss << arg->GetName() << ",";
+   }
+   return std::hash<std::string>{}(ss.str());
+}
+
+/// Check that the values and normalization integrals of two pdfs with the same
+/// fingerprint agree for the current values of the observables and
+/// parameters, to guard against configuration that is not visible in the
+/// computation graph.
+bool haveSameNormalization(RooAbsPdf const &pdf1, RooAbsPdf const &pdf2, RooArgSet const &normSet)
+{
+   auto equal = [](double a, double b) { return a == b || std::abs(a - b) <= 1e-12 * std::abs(a); };
+   return equal(pdf1.getVal(normSet), pdf2.getVal(normSet)) && equal(pdf1.getNorm(normSet), pdf2.getNorm(normSet));
+}
+
 std::vector<std::unique_ptr<RooAbsArg>> unfoldIntegrals(RooAbsArg const &topNode, RooArgSet const &normSet,
                                                         std::unordered_map<DataKey, RooArgSet *> &normSets,
                                                         RooArgSet &replacedArgs, RooArgSet &newArgs)
@@ -199,6 +254,13 @@ std::vector<std::unique_ptr<RooAbsArg>> unfoldIntegrals(RooAbsArg const &topNode
       newArg.setAttribute(attrib.c_str(), false);
    };
 
+   // The normalized pdfs that own their integral, by fingerprint of the
+   // integral. Equivalent pdfs, like the channels of a RooSimultaneous that
+   // were built from the same prototype, share one normalization integral, so
+   // that it is only computed once when the shared parameters change.
+   std::unordered_map<std::size_t, std::pair<RooAbsPdf *, RooNormalizedPdf *>> normalizedPdfs;
+   std::unordered_map<DataKey, std::size_t> fingerprints;
+
    // Replace all pdfs that need to be normalized with a pdf wrapper that
    // applies the right normalization.
    for (RooAbsArg *node : nodes) {
@@ -217,7 +279,15 @@ std::vector<std::unique_ptr<RooAbsArg>> unfoldIntegrals(RooAbsArg const &topNode
          if (pdf->selfNormalized() && !dynamic_cast<RooAbsCachedPdf *>(pdf))
             continue;
 
-         auto normalizedPdf = std::make_unique<RooNormalizedPdf>(*pdf, currNormSet);
+         std::unique_ptr<RooNormalizedPdf> normalizedPdf;
+         const std::size_t key = normIntegralFingerprint(*pdf, currNormSet, fingerprints);
+         auto found = normalizedPdfs.find(key);
+         if (found != normalizedPdfs.end() && haveSameNormalization(*found->second.first, *pdf, currNormSet)) {
+            normalizedPdf = std::make_unique<RooNormalizedPdf>(*pdf, currNormSet, *found->second.second);
+         } else {
+            normalizedPdf = std::make_unique<RooNormalizedPdf>(*pdf, currNormSet);
+            normalizedPdfs.emplace(key, std::make_pair(pdf, normalizedPdf.get()));
+         }
 
          replaceArg(*normalizedPdf, *pdf);
 
@@ -98,6 +98,7 @@ for single nodes.
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
 
 using namespace std;
 
@@ -495,39 +496,45 @@ void RooAbsArg::branchNodeServerList(RooAbsCollection* list, const RooAbsArg* ar
 /// \param[in] doLeaf Add leaf nodes to the list.
 /// \param[in] valueOnly Only check if an element is a value server (no shape server).
 /// \param[in] recurseFundamental
+///
+/// Each node is visited once, even if it is reached through several paths of the graph, such that the cost is
+/// linear in the number of nodes also for models sharing many components, e.g. the parameters of HistFactory models.
 
 void RooAbsArg::treeNodeServerList(RooAbsCollection* list, const RooAbsArg* arg, bool doBranch, bool doLeaf, bool valueOnly, bool recurseFundamental) const
 {
-//   if (arg==0) {
-//     cout << "treeNodeServerList(" << GetName() << ") doBranch=" << (doBranch?"T":"F") << " doLeaf = " << (doLeaf?"T":"F") << " valueOnly=" << (valueOnly?"T":"F") << endl ;
-//   }
-
   if (!arg) {
     list->reserve(10);
     arg=this ;
   }
 
-  // Decide if to add current node
-  if ((doBranch&&doLeaf) ||
-      (doBranch&&arg->isDerived()) ||
-      (doLeaf&&arg->isFundamental()&&(!(recurseFundamental&&arg->isDerived()))) ||
-      (doLeaf && !arg->isFundamental() && !arg->isDerived())) {
+  std::unordered_set<const RooAbsArg*> visited;
+  auto visit = [&](const RooAbsArg* node, auto& self) -> void {
+    if (!visited.insert(node).second) {
+      return ;
+    }
 
-    list->add(*arg,true) ;
-  }
+    // Decide if to add current node
+    if ((doBranch&&doLeaf) ||
+        (doBranch&&node->isDerived()) ||
+        (doLeaf&&node->isFundamental()&&(!(recurseFundamental&&node->isDerived()))) ||
+        (doLeaf && !node->isFundamental() && !node->isDerived())) {
 
-  // Recurse if current node is derived
-  if (arg->isDerived() && (!arg->isFundamental() || recurseFundamental)) {
-    for (const auto server : arg->_serverList) {
+      list->add(*node,true) ;
+    }
+
+    // Recurse if current node is derived
+    if (node->isDerived() && (!node->isFundamental() || recurseFundamental)) {
+      for (const auto server : node->_serverList) {
 
-      // Skip non-value server nodes if requested
-      bool isValueSrv = server->_clientListValue.containsByNamePtr(arg);
-      if (valueOnly && !isValueSrv) {
-        continue ;
+        // Skip non-value server nodes if requested
+        if (valueOnly && !server->_clientListValue.containsByNamePtr(node)) {
+          continue ;
+        }
+        self(server, self) ;
       }
-      treeNodeServerList(list,server,doBranch,doLeaf,valueOnly,recurseFundamental) ;
     }
-  }
+  };
+  visit(arg, visit) ;
 }
 
 
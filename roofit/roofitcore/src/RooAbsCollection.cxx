@@ -49,6 +49,7 @@ implemented using the container denoted by RooAbsCollection::Storage_t.
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <unordered_set>
 
 ClassImp(RooAbsCollection);
 
@@ -62,7 +63,8 @@ namespace Detail {
  * RooNameReg::renameCounter()
  * and tracks elements of this collection by name. If an element
  * gets renamed, this counter will be increased, and the name to
- * object map becomes invalid. In this case, it has to be recreated.
+ * object map becomes invalid. In this case, it has to be refreshed
+ * or recreated.
  */
 struct HashAssistedFind {
 
@@ -82,6 +84,31 @@ struct HashAssistedFind {
     return (currentRooNameRegCounter == rooNameRegCounterWhereMapWasValid);
   }
 
+  /// Re-key the elements that were renamed since the map was valid, which is cheaper
+  /// than recreating the map since most renames concern objects outside of this collection.
+  /// Returns false if the map has to be recreated, i.e. if the collection has several
+  /// elements with the same name, or an element was renamed to the name of another one.
+  template<typename It_t>
+  bool refresh(It_t first, It_t last) {
+    if (nameToItemMap.size() != static_cast<std::size_t>(std::distance(first, last))) return false;
+
+    std::vector<const RooAbsArg *> renamed;
+    for (auto item = nameToItemMap.begin(); item != nameToItemMap.end();) {
+      if (item->first != item->second->namePtr()) {
+        renamed.push_back(item->second);
+        item = nameToItemMap.erase(item);
+      } else {
+        ++item;
+      }
+    }
+    for (auto elm : renamed) {
+      if (!nameToItemMap.emplace(elm->namePtr(), elm).second) return false;
+    }
+
+    rooNameRegCounterWhereMapWasValid = currentRooNameRegCounter;
+    return true;
+  }
+
   RooAbsArg * find(const TNamed * nptr) const {
     assert(isValid());
 
@@ -742,6 +769,19 @@ bool RooAbsCollection::remove(const RooAbsCollection& list, bool /*silent*/, boo
       }
     }
   }
+  else if (list.size() >= _sizeThresholdForMapSearch) {
+    // look up the instances in a hash set instead of scanning the list for each element
+    std::unordered_set<const RooAbsArg*> instances(list._list.begin(), list._list.end());
+    auto argMatchAndMark = [&instances, &markedItems](const RooAbsArg* elm) {
+      if( instances.count(elm) ) {
+        markedItems.push_back(elm);
+        return true;
+      }
+      return false;
+    };
+
+    _list.erase(std::remove_if(_list.begin(), _list.end(), argMatchAndMark), _list.end());
+  }
   else {
     auto argMatchAndMark = [&list, &markedItems](const RooAbsArg* elm) {
       if( list.containsInstance(*elm) ) {
@@ -832,6 +872,7 @@ bool RooAbsCollection::selectCommon(const RooAbsCollection& refColl, RooAbsColle
 {
   outColl.clear();
   outColl.setName((std::string(GetName()) + "_selection").c_str());
+  outColl.reserve(std::min(_list.size(), refColl._list.size()));
 
   // Scan set contents for matching attribute
   for (auto arg : _list) {
@@ -904,6 +945,18 @@ bool RooAbsCollection::equals(const RooAbsCollection& otherColl) const
   if (size() != otherColl.size()) return false ;
 
   // Then check that each element of our list also occurs in the other list
+  if (size() >= _sizeThresholdForMapSearch) {
+    // compare the sorted names, as std::is_permutation is quadratic
+    auto sortedNamePtrs = [](const Storage_t & list) {
+      std::vector<const TNamed*> namePtrs;
+      namePtrs.reserve(list.size());
+      for (auto const* arg : list) namePtrs.push_back(arg->namePtr());
+      std::sort(namePtrs.begin(), namePtrs.end());
+      return namePtrs;
+    };
+    return sortedNamePtrs(_list) == sortedNamePtrs(otherColl._list);
+  }
+
   auto compareByNamePtr = [](const RooAbsArg * left, const RooAbsArg * right) {
     return left->namePtr() == right->namePtr();
   };
@@ -943,7 +996,8 @@ RooAbsArg * RooAbsCollection::find(const char *name) const
   if (!nptr) return nullptr;
 
   if (_hashAssistedFind || _list.size() >= _sizeThresholdForMapSearch) {
-    if (!_hashAssistedFind || !_hashAssistedFind->isValid()) {
+    if (!_hashAssistedFind ||
+        (!_hashAssistedFind->isValid() && !_hashAssistedFind->refresh(_list.begin(), _list.end()))) {
       _hashAssistedFind = std::make_unique<HashAssistedFind>(_list.begin(), _list.end());
     }
 
@@ -963,7 +1017,8 @@ RooAbsArg * RooAbsCollection::find(const RooAbsArg& arg) const
   const auto nptr = arg.namePtr();
 
   if (_hashAssistedFind || _list.size() >= _sizeThresholdForMapSearch) {
-    if (!_hashAssistedFind || !_hashAssistedFind->isValid()) {
+    if (!_hashAssistedFind ||
+        (!_hashAssistedFind->isValid() && !_hashAssistedFind->refresh(_list.begin(), _list.end()))) {
       _hashAssistedFind = std::make_unique<HashAssistedFind>(_list.begin(), _list.end());
     }
 
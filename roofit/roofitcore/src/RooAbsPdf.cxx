@@ -1405,6 +1405,9 @@ int RooAbsPdf::calcSumW2CorrectedCovariance(RooMinimizer &minimizer, RooAbsReal
 ///                                                          implemented for the PDFs of the model, likelihood computations are 2x to 10x faster.
 ///                                                          The relative difference of the single log-likelihoods w.r.t. the legacy mode is usually better than 1.E-12,
 ///                                                          and fit parameters usually agree to better than 1.E-6.
+///                                                          With `BatchMode("codegen")`, the likelihood is translated to a single C++ function that
+///                                                          is compiled with the interpreter, which removes the overhead of the computation graph for
+///                                                          small models. The parts of the model that don't support the code generation are computed as with `BatchMode("cpu")`.
 /// <tr><td> `IntegrateBins(double precision)` <td> In binned fits, integrate the PDF over the bins instead of using the probability density at the bin centre.
 ///                                                 This can reduce the bias observed when fitting functions with high curvature to binned data.
 ///                                                 - precision > 0: Activate bin integration everywhere. Use precision between 0.01 and 1.E-6, depending on binning.
@@ -1438,6 +1441,9 @@ int RooAbsPdf::calcSumW2CorrectedCovariance(RooMinimizer &minimizer, RooAbsReal
 ///                                                  this happens, try switching it off.
 /// <tr><td> `RecoverFromUndefinedRegions(double strength)` <td> When PDF is invalid (e.g. parameter in undefined region), try to direct minimiser away from that region.
 ///                                                              `strength` controls the magnitude of the penalty term. Leaving out this argument defaults to 10. Switch off with `strength = 0.`.
+/// <tr><td> `AnalyticalGradient(bool flag=true)` <td> Pass the gradient of the likelihood to the minimizer instead of letting it compute the
+///                                                    gradient with finite differences. This is only supported for likelihoods created with `BatchMode("cpu")`,
+///                                                    for the other likelihoods this option is ignored.
 ///
 /// <tr><td> `SumW2Error(bool flag)`         <td>  Apply correction to errors and covariance matrix.
 ///       This uses two covariance matrices, one with the weights, the other with squared weights,
@@ -1552,6 +1558,7 @@ std::unique_ptr<RooFitResult> RooAbsPdf::minimizeNLL(RooAbsReal & nll,
   minimizerConfig.parallelGradient = cfg.parallelGradient;
   minimizerConfig.parallelLikelihood = cfg.parallelLikelihood;
   minimizerConfig.nWorkers = cfg.nWorkers;
+  minimizerConfig.useGradient = cfg.useGradient;
   RooMinimizer m(nll, minimizerConfig);
 
   m.setMinimizerType(cfg.minType.c_str());
@@ -1635,6 +1642,7 @@ RooFitResult* RooAbsPdf::fitTo(RooAbsData& data, const RooLinkedList& cmdList)
   pc.defineInt("nWorkers", "Parallelize", 0, 0); // Three parallelize arguments
   pc.defineInt("parallelGradient", "Parallelize", 1, 0);
   pc.defineDouble("parallelLikelihood", "Parallelize", 2, 0);
+  pc.defineInt("useGradient", "AnalyticalGradient", 0, 0);
   pc.defineString("mintype","Minimizer",0,minimizerDefaults.minType.c_str()) ;
   pc.defineString("minalg","Minimizer",1,minimizerDefaults.minAlg.c_str()) ;
   pc.defineSet("minosSet","Minos",0,minimizerDefaults.minosSet) ;
@@ -1729,6 +1737,7 @@ RooFitResult* RooAbsPdf::fitTo(RooAbsData& data, const RooLinkedList& cmdList)
   cfg.nWorkers = pc.getInt("nWorkers");
   cfg.parallelGradient = pc.getInt("parallelGradient");
   cfg.parallelLikelihood = pc.getInt("parallelLikelihood");
+  cfg.useGradient = pc.getInt("useGradient");
 
   return minimizeNLL(*nll, data, cfg).release();
 }
@@ -24,6 +24,17 @@ the accept/reject sampling technique on any positively valued function.
 The RooAcceptReject generator is used by the various generator context
 classes to take care of generation of observables for which p.d.fs
 do not define internal methods
+
+The function is evaluated for each trial sample separately by default. If
+the `batchSize` parameter of the generator configuration is not zero, the
+trial samples that are drawn to estimate the function maximum and to fill the
+event cache are instead evaluated in batches of that size with the vectorized
+computation backend of RooFit:
+~~~ {.cpp}
+RooNumGenConfig::defaultConfig().getConfigSection("RooAcceptReject").setRealValue("batchSize", 10000);
+~~~
+The trial samples are drawn in the same order in both cases, so the generated
+events don't depend on the batch size.
 **/
 
 #include "Riostream.h"
@@ -41,7 +52,9 @@ do not define internal methods
 #include "RooRealBinding.h"
 #include "RooNumGenFactory.h"
 #include "RooNumGenConfig.h"
+#include "RooFitDriver.h"
 
+#include <algorithm>
 #include <assert.h>
 
 using namespace std;
@@ -59,9 +72,10 @@ void RooAcceptReject::registerSampler(RooNumGenFactory& fact)
   RooRealVar nTrial1D("nTrial1D","Number of trial samples for 1-dim generation",1000,0,1e9) ;
   RooRealVar nTrial2D("nTrial2D","Number of trial samples for 2-dim generation",100000,0,1e9) ;
   RooRealVar nTrial3D("nTrial3D","Number of trial samples for N-dim generation",10000000,0,1e9) ;
+  RooRealVar batchSize("batchSize","Number of trial samples evaluated together in batch mode (0 to disable)",0,0,1e9) ;
 
   RooAcceptReject* proto = new RooAcceptReject ;
-  fact.storeProtoSampler(proto,RooArgSet(nTrial0D,nTrial1D,nTrial2D,nTrial3D)) ;
+  fact.storeProtoSampler(proto,RooArgSet(nTrial0D,nTrial1D,nTrial2D,nTrial3D,batchSize)) ;
 }
 
 
@@ -79,6 +93,7 @@ RooAcceptReject::RooAcceptReject(const RooAbsReal &func, const RooArgSet &genVar
   _minTrialsArray[1] = static_cast<Int_t>(config.getConfigSection("RooAcceptReject").getRealValue("nTrial1D")) ;
   _minTrialsArray[2] = static_cast<Int_t>(config.getConfigSection("RooAcceptReject").getRealValue("nTrial2D")) ;
   _minTrialsArray[3] = static_cast<Int_t>(config.getConfigSection("RooAcceptReject").getRealValue("nTrial3D")) ;
+  _batchSize = static_cast<UInt_t>(config.getConfigSection("RooAcceptReject").getRealValue("batchSize", 0)) ;
 
   _realSampleDim = _realVars.getSize() ;
   _catSampleMult = 1 ;
@@ -146,6 +161,11 @@ RooAcceptReject::RooAcceptReject(const RooAbsReal &func, const RooArgSet &genVar
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+
+RooAcceptReject::~RooAcceptReject() = default;
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a pointer to a generated event. The caller does not own the event and it
 /// will be overwritten by a subsequent call. The input parameter 'remaining' should
@@ -164,7 +184,7 @@ const RooArgSet *RooAcceptReject::generateEvent(UInt_t remaining, double& resamp
     // maximum function value
 
     while(_totalEvents < _minTrials) {
-      addEventToCache();
+      addEventsToCache(std::min<Long64_t>(_minTrials - _totalEvents, std::max(_batchSize, 1u)));
 
       // Limit cache size to 1M events
       if (_cache->numEntries()>1000000) {
@@ -200,8 +220,10 @@ const RooArgSet *RooAcceptReject::generateEvent(UInt_t remaining, double& resamp
       Long64_t extra= 1 + (Long64_t)(1.05*remaining/eff);
       cxcoutD(Generation) << "RooAcceptReject::generateEvent: adding " << extra << " events to the cache, eff = " << eff << endl;
       double oldMax(_maxFuncVal);
-      while(extra--) {
-   addEventToCache();
+      while(extra > 0) {
+   const Long64_t nBatch = std::min<Long64_t>(extra, std::max(_batchSize, 1u));
+   addEventsToCache(nBatch);
+   extra -= nBatch;
    if((_maxFuncVal > oldMax)) {
      cxcoutD(Generation) << "RooAcceptReject::generateEvent: estimated function maximum increased from "
                << oldMax << " to " << _maxFuncVal << endl;
@@ -279,7 +301,69 @@ void RooAcceptReject::addEventToCache()
   for(auto * real : static_range_cast<RooRealVar*>(_realVars)) real->randomize();
 
   // calculate and store our function value at this new point
-  double val= _funcClone->getVal();
+  storeEvent(_funcClone->getVal());
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add `nEvents` trial events to our cache, like addEventToCache(). If batch
+/// evaluation is enabled in the configuration, all trial points are drawn
+/// first and the function is evaluated for all of them in one go.
+
+void RooAcceptReject::addEventsToCache(Long64_t nEvents)
+{
+  if (_batchSize == 0 || nEvents < 2) {
+    while (nEvents-- > 0) addEventToCache();
+    return;
+  }
+
+  if (!_driver) {
+    // No normalization set: like getVal() in addEventToCache(), the function is not normalized
+    _driver = std::make_unique<ROOT::Experimental::RooFitDriver>(*_funcClone, RooArgSet{});
+  }
+
+  const std::size_t n = nEvents;
+  const std::size_t nCats = _catVars.size();
+  _trialValues.resize((nCats + _realVars.size()) * n);
+
+  // draw the trial points in the same order as addEventToCache()
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t iVar = 0;
+    for (auto * cat : static_range_cast<RooCategory*>(_catVars)) {
+      cat->randomize();
+      _trialValues[iVar++ * n + i] = cat->getCurrentIndex();
+    }
+    for (auto * real : static_range_cast<RooRealVar*>(_realVars)) {
+      real->randomize();
+      _trialValues[iVar++ * n + i] = real->getVal();
+    }
+  }
+
+  ROOT::Experimental::RooFitDriver::DataSpansMap dataSpans;
+  std::size_t iVar = 0;
+  for (RooAbsArg * arg : _catVars) dataSpans[arg] = {_trialValues.data() + iVar++ * n, n};
+  for (RooAbsArg * arg : _realVars) dataSpans[arg] = {_trialValues.data() + iVar++ * n, n};
+  _driver->setData(dataSpans);
+  std::vector<double> vals = _driver->getValues();
+
+  for (std::size_t i = 0; i < n; ++i) {
+    iVar = 0;
+    for (auto * cat : static_range_cast<RooCategory*>(_catVars)) {
+      cat->setIndex(static_cast<int>(_trialValues[iVar++ * n + i]));
+    }
+    for (auto * real : static_range_cast<RooRealVar*>(_realVars)) {
+      real->setVal(_trialValues[iVar++ * n + i]);
+    }
+    storeEvent(vals[vals.size() == 1 ? 0 : i]);
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the current trial point with its function value `val` in our cache.
+
+void RooAcceptReject::storeEvent(double val)
+{
   _funcValPtr->setVal(val);
 
   // Update the estimated integral and maximum value. Increase our
@@ -306,7 +390,7 @@ double RooAcceptReject::getFuncMax()
 
   // Generate the minimum required number of samples for a reliable maximum estimate
   while(_totalEvents < _minTrials) {
-    addEventToCache();
+    addEventsToCache(std::min<Long64_t>(_minTrials - _totalEvents, std::max(_batchSize, 1u)));
 
     // Limit cache size to 1M events
     if (_cache->numEntries()>1000000) {
@@ -68,6 +68,7 @@ An (enforced) condition for this assumption is that each \f$ \mathrm{PDF}_i \f$
 #include "RooAddHelpers.h"
 #include "RooAddGenContext.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 #include "RooDataSet.h"
 #include "RooGlobalFunc.h"
 #include "RooRealProxy.h"
@@ -80,6 +81,7 @@ An (enforced) condition for this assumption is that each \f$ \mathrm{PDF}_i \f$
 #include <memory>
 #include <sstream>
 #include <set>
+#include <string>
 
 ClassImp(RooAddPdf);
 
@@ -536,6 +538,117 @@ void RooAddPdf::computeBatch(cudaStream_t* stream, double* output, size_t nEvent
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Propagate the gradient with respect to the output values to the component
+/// pdfs and to the coefficients. The output is linear in the component pdfs,
+/// with the final coefficients from updateCoefficients() as factors. These
+/// final coefficients are differentiated numerically with respect to the
+/// input coefficients, which only involves scalar computations. Per-event
+/// coefficients are not supported, like in computeBatch().
+
+bool RooAddPdf::computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &dataMap,
+                                     RooFit::Detail::GradientMap &gradMap) const
+{
+  const std::size_t nPdfs = _pdfList.size();
+  std::vector<double> inputCoefs(_coefList.size());
+  for (std::size_t i = 0; i < _coefList.size(); ++i) {
+    auto coefVals = dataMap.at(&_coefList[i]);
+    if (coefVals.size() > 1) return false;
+    inputCoefs[i] = coefVals[0];
+  }
+
+  auto normAndCache = getNormAndCache(nullptr);
+  const RooArgSet* nset = normAndCache.first;
+  AddCacheElem* cache = normAndCache.second;
+
+  // The final coefficients of the selected components, for the given input coefficients
+  auto finalCoefs = [&](std::vector<double> const& coefs) {
+    std::copy(coefs.begin(), coefs.end(), _coefCache.begin());
+    updateCoefficients(*cache, nset, /*syncCoefValues=*/false);
+    std::vector<double> out(nPdfs, 0.0);
+    for (std::size_t pdfNo = 0; pdfNo < nPdfs; ++pdfNo) {
+      if (static_cast<RooAbsPdf&>(_pdfList[pdfNo]).isSelectedComp()) {
+        out[pdfNo] = _coefCache[pdfNo] / cache->suppNormVal(pdfNo);
+      }
+    }
+    return out;
+  };
+
+  _coefCache.resize(nPdfs);
+  const std::vector<double> coefs = finalCoefs(inputCoefs);
+
+  for (std::size_t pdfNo = 0; pdfNo < nPdfs; ++pdfNo) {
+    RooSpan<double> pdfGrad = gradMap.at(&_pdfList[pdfNo]);
+    if (pdfGrad.empty() || coefs[pdfNo] == 0.0) continue;
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      RooFit::Detail::GradientMap::add(pdfGrad, i, grad[i] * coefs[pdfNo]);
+    }
+  }
+
+  std::vector<double> coefsUp(nPdfs);
+  std::vector<double> coefsDown(nPdfs);
+  for (std::size_t iCoef = 0; iCoef < _coefList.size(); ++iCoef) {
+    RooSpan<double> coefGrad = gradMap.at(&_coefList[iCoef]);
+    if (coefGrad.empty()) continue;
+
+    std::vector<double> shifted = inputCoefs;
+    const double step = 1e-6 * std::max(1.0, std::abs(inputCoefs[iCoef]));
+    shifted[iCoef] = inputCoefs[iCoef] + step;
+    coefsUp = finalCoefs(shifted);
+    shifted[iCoef] = inputCoefs[iCoef] - step;
+    coefsDown = finalCoefs(shifted);
+
+    double sum = 0.0;
+    for (std::size_t pdfNo = 0; pdfNo < nPdfs; ++pdfNo) {
+      const double dCoef = (coefsUp[pdfNo] - coefsDown[pdfNo]) / (2 * step);
+      if (dCoef == 0.0) continue;
+      auto pdfVals = dataMap.at(&_pdfList[pdfNo]);
+      for (std::size_t i = 0; i < nEvents; ++i) {
+        sum += grad[i] * dCoef * pdfVals[pdfVals.size() == 1 ? 0 : i];
+      }
+    }
+    coefGrad[0] += sum;
+  }
+
+  // Restore the coefficients of the last evaluation
+  finalCoefs(inputCoefs);
+  return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the code that sums the component pdfs for the code generation
+/// backend. The final coefficients are computed by updateCoefficients() before
+/// each call of the generated function and passed to it as external values.
+/// Per-event coefficients are not supported, like in computeBatch().
+
+bool RooAddPdf::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  for (const auto coef : _coefList) {
+    if (ctx.isPerEvent(*coef)) return false;
+  }
+
+  const std::size_t nPdfs = _pdfList.size();
+  const std::size_t firstCoef = ctx.addExternals(nPdfs, [this, nPdfs](double *coefs) {
+    auto normAndCache = getNormAndCache(nullptr);
+    AddCacheElem* cache = normAndCache.second;
+    updateCoefficients(*cache, normAndCache.first);
+    for (std::size_t pdfNo = 0; pdfNo < nPdfs; ++pdfNo) {
+      const bool isSelected = static_cast<RooAbsPdf&>(_pdfList[pdfNo]).isSelectedComp();
+      coefs[pdfNo] = isSelected ? _coefCache[pdfNo] / cache->suppNormVal(pdfNo) : 0.0;
+    }
+  });
+
+  std::string sum;
+  for (std::size_t pdfNo = 0; pdfNo < nPdfs; ++pdfNo) {
+    sum += (sum.empty() ? "" : " + ") + std::string("ext[") + std::to_string(firstCoef + pdfNo) + "] * " +
+           ctx.getResult(_pdfList[pdfNo]);
+  }
+  ctx.addResult(this, sum);
+  return true;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset error counter to given value, limiting the number
 /// of future error messages for this pdf to 'resetValue'
@@ -38,9 +38,11 @@ in the two sets.
 #include "RooChi2Var.h"
 #include "RooMsgService.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include <algorithm>
 #include <cmath>
+#include <string>
 
 ClassImp(RooAddition);
 
@@ -173,6 +175,36 @@ void RooAddition::computeBatch(cudaStream_t* stream, double* output, size_t nEve
   dispatch->compute(stream, RooBatchCompute::AddPdf, output, nEvents, pdfs, coefs);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// The gradient with respect to the output of the sum is also the gradient
+/// with respect to the outputs of each term.
+
+bool RooAddition::computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &,
+                                       RooFit::Detail::GradientMap &gradMap) const
+{
+  for (const auto arg : _set) {
+    RooSpan<double> argGrad = gradMap.at(arg);
+    if (argGrad.empty()) continue;
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      RooFit::Detail::GradientMap::add(argGrad, i, grad[i]);
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the code that sums the terms for the code generation backend.
+
+bool RooAddition::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string sum;
+  for (const auto arg : _set) {
+    sum += (sum.empty() ? "" : " + ") + ctx.getResult(*arg);
+  }
+  ctx.addResult(this, sum.empty() ? "0.0" : sum);
+  return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the default error level for MINUIT error analysis
@@ -0,0 +1,132 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+/**
+\class RooAnalyticalGradMinimizerFcn
+\ingroup Roofitcore
+
+Interface of a RooAbsReal that provides the gradient with respect to its
+parameters (see RooAbsReal::hasGradient()) to the ROOT minimizers, so that
+they don't have to compute it numerically. With Minuit2, the gradient is then
+used by the AnalyticalGradientCalculator. The RooMinimizer uses this class if
+the gradient is requested with RooMinimizer::Config::useGradient, and if the
+function supports it. This is the case for likelihoods created in the CPU
+BatchMode.
+**/
+
+#include "RooAnalyticalGradMinimizerFcn.h"
+
+#include "RooMinimizer.h"
+#include "RooMsgService.h"
+#include "RooNaNPacker.h"
+
+#include "Fit/Fitter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+RooArgSet getParameters(RooAbsReal const &funct)
+{
+   RooArgSet out;
+   funct.getParameters(nullptr, out);
+   return out;
+}
+
+} // namespace
+
+RooAnalyticalGradMinimizerFcn::RooAnalyticalGradMinimizerFcn(RooAbsReal *funct, RooMinimizer *context)
+   : RooAbsMinimizerFcn(getParameters(*funct), context), _funct(funct)
+{
+}
+
+RooAnalyticalGradMinimizerFcn::RooAnalyticalGradMinimizerFcn(const RooAnalyticalGradMinimizerFcn &other)
+   : ROOT::Math::IMultiGradFunction(other), RooAbsMinimizerFcn(other), _funct(other._funct), _grad(other._grad),
+     _gradParams(other._gradParams)
+{
+}
+
+ROOT::Math::IMultiGradFunction *RooAnalyticalGradMinimizerFcn::Clone() const
+{
+   return new RooAnalyticalGradMinimizerFcn(*this);
+}
+
+/// Evaluate function given the parameters in `x`.
+double RooAnalyticalGradMinimizerFcn::DoEval(const double *x) const
+{
+   // Set the parameter values for this iteration
+   for (unsigned index = 0; index < _nDim; index++) {
+      if (_logfile)
+         (*_logfile) << x[index] << " ";
+      SetPdfParamVal(index, x[index]);
+   }
+
+   // Calculate the function for these parameters
+   RooAbsReal::setHideOffset(false);
+   double fvalue = _funct->getVal();
+   RooAbsReal::setHideOffset(true);
+
+   if (!std::isfinite(fvalue) || RooAbsReal::numEvalErrors() > 0 || fvalue > 1e30) {
+      printEvalErrors();
+      RooAbsReal::clearEvalErrorLog();
+      _numBadNLL++;
+
+      if (_doEvalErrorWall) {
+         const double badness = RooNaNPacker::unpackNaN(fvalue);
+         fvalue = (std::isfinite(_maxFCN) ? _maxFCN : 0.) + _recoverFromNaNStrength * badness;
+      }
+   } else {
+      if (_evalCounter > 0 && _evalCounter == _numBadNLL) {
+         // This is the first time we get a valid function value, see RooMinimizerFcn::DoEval().
+         _funcOffset = -fvalue;
+      }
+      fvalue += _funcOffset;
+      _maxFCN = std::max(fvalue, _maxFCN);
+   }
+
+   // Optional logging
+   if (_logfile)
+      (*_logfile) << std::setprecision(15) << fvalue << std::setprecision(4) << std::endl;
+   if (isVerbose()) {
+      std::cout << "\nprevFCN" << (_funct->isOffsetting() ? "-offset" : "") << " = " << std::setprecision(10)
+                << fvalue << std::setprecision(4) << "  ";
+      std::cout.flush();
+   }
+
+   finishDoEval();
+
+   return fvalue;
+}
+
+/// Compute the gradient of the function for the parameters in `x` in a single
+/// call to RooAbsReal::gradient(). The constant offsets of DoEval() don't
+/// change the gradient.
+void RooAnalyticalGradMinimizerFcn::Gradient(const double *x, double *grad) const
+{
+   if (_gradParams.size() != _nDim || !std::equal(_gradParams.begin(), _gradParams.end(), x)) {
+      for (unsigned index = 0; index < _nDim; index++) {
+         SetPdfParamVal(index, x[index]);
+      }
+      _grad.resize(_nDim);
+      _funct->gradient(*_floatParamList, _grad.data());
+      _gradParams.assign(x, x + _nDim);
+   }
+   std::copy(_grad.begin(), _grad.end(), grad);
+}
+
+double RooAnalyticalGradMinimizerFcn::DoDerivative(const double *x, unsigned int icoord) const
+{
+   std::vector<double> grad(_nDim);
+   Gradient(x, grad.data());
+   return grad[icoord];
+}
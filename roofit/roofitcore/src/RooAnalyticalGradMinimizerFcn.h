@@ -0,0 +1,52 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_RooAnalyticalGradMinimizerFcn_h
+#define RooFit_RooAnalyticalGradMinimizerFcn_h
+
+#include "RooAbsMinimizerFcn.h"
+
+#include "Math/IFunction.h" // IMultiGradFunction
+
+#include <string>
+#include <vector>
+
+class RooAnalyticalGradMinimizerFcn : public ROOT::Math::IMultiGradFunction, public RooAbsMinimizerFcn {
+public:
+   RooAnalyticalGradMinimizerFcn(RooAbsReal *funct, RooMinimizer *context);
+   RooAnalyticalGradMinimizerFcn(const RooAnalyticalGradMinimizerFcn &other);
+
+   ROOT::Math::IMultiGradFunction *Clone() const override;
+   unsigned int NDim() const override { return getNDim(); }
+
+   void Gradient(const double *x, double *grad) const override;
+
+   std::string getFunctionName() const override { return _funct->GetName(); }
+   std::string getFunctionTitle() const override { return _funct->GetTitle(); }
+
+   void setOffsetting(bool flag) override { _funct->enableOffsetting(flag); }
+   bool fit(ROOT::Fit::Fitter &fitter) const override { return fitter.FitFCN(*this); };
+   ROOT::Math::IMultiGenFunction *getMultiGenFcn() override { return this; };
+
+private:
+   void setOptimizeConstOnFunction(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt) override
+   {
+      _funct->constOptimizeTestStatistic(opcode, doAlsoTrackingOpt);
+   }
+
+   double DoEval(const double *x) const override;
+   double DoDerivative(const double *x, unsigned int icoord) const override;
+
+   RooAbsReal *_funct;
+   mutable std::vector<double> _grad; ///< The gradient for the parameters in _gradParams
+   mutable std::vector<double> _gradParams;
+};
+
+#endif
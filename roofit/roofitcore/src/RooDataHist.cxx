@@ -1326,6 +1326,66 @@ void RooDataHist::weights(double* output, RooSpan<double const> xVals, int intOr
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// A vectorized version of RooDataHist::weight() without interpolation for
+/// histograms of any dimension. The bin indices are computed for all events
+/// together, one dimension after the other, with RooAbsBinning::binNumbers().
+/// Coordinates outside of the histogram boundaries get the weight zero.
+/// \param[out] output An array of weights for the `nEvents` coordinates.
+/// \param[in] xVals The coordinates in each dimension, in the order of the
+///                  histogram variables. A span with a single value is used
+///                  for all events.
+/// \param[in] nEvents The number of events.
+/// \param[in] correctForBinSize Enable the inverse bin volume correction factor.
+/// \return False if the weights can't be computed like this, because one of the
+///         histogram variables is a category. The output is not touched then.
+
+bool RooDataHist::weights(double* output, std::vector<RooSpan<double const>> const& xVals, std::size_t nEvents,
+                          bool correctForBinSize)
+{
+  checkInit() ;
+
+  if (xVals.size() != _lvbins.size()) return false;
+  for (std::size_t iDim = 0; iDim < _lvbins.size(); ++iDim) {
+    if (!_lvbins[iDim] || (xVals[iDim].size() != 1 && xVals[iDim].size() < nEvents)) return false;
+  }
+
+  // Reuse the output buffer for bin indices and zero-initialize it
+  auto binIndices = reinterpret_cast<int*>(output + nEvents) - nEvents;
+  std::fill(binIndices, binIndices + nEvents, 0);
+
+  for (std::size_t iDim = 0; iDim < _lvbins.size(); ++iDim) {
+    RooAbsBinning const& binning = *_lvbins[iDim];
+    RooSpan<double const> const& x = xVals[iDim];
+    if (x.size() == 1) {
+      const int idx = _idxMult[iDim] * binning.binNumber(x[0]);
+      for (std::size_t i = 0; i < nEvents; ++i) {
+        binIndices[i] += idx;
+      }
+    } else {
+      binning.binNumbers(x.data(), binIndices, nEvents, _idxMult[iDim]);
+    }
+  }
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    auto binIdx = binIndices[i];
+    output[i] = correctForBinSize ? _wgt[binIdx] / _binv[binIdx] : _wgt[binIdx];
+  }
+
+  for (std::size_t iDim = 0; iDim < _lvbins.size(); ++iDim) {
+    const double xlo = _lvbins[iDim]->lowBound();
+    const double xhi = _lvbins[iDim]->highBound();
+    RooSpan<double const> const& x = xVals[iDim];
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      const double xVal = x.size() == 1 ? x[0] : x[i];
+      output[i] = (xVal < xlo || xVal > xhi) ? 0. : output[i];
+    }
+  }
+
+  return true;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// A faster version of RooDataHist::weight that assumes the passed arguments
 /// are aligned with the histogram variables.
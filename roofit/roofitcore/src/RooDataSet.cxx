@@ -475,9 +475,7 @@ RooDataSet::RooDataSet(RooStringView name, RooStringView title, const RooArgSet&
         if (tstore) {
           tstore->loadValues(impTree,&cutVarTmp,cutRange);
         } else {
-          RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
-          tmpstore.loadValues(impTree,&cutVarTmp,cutRange) ;
-          _dstore->append(tmpstore) ;
+          static_cast<RooVectorDataStore&>(*_dstore).loadValues(impTree,&cutVarTmp) ;
         }
       } else if (fname && strlen(fname)) {
 
@@ -496,9 +494,7 @@ RooDataSet::RooDataSet(RooStringView name, RooStringView title, const RooArgSet&
         if (tstore) {
           tstore->loadValues(t,&cutVarTmp,cutRange);
         } else {
-          RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
-          tmpstore.loadValues(t,&cutVarTmp,cutRange) ;
-          _dstore->append(tmpstore) ;
+          static_cast<RooVectorDataStore&>(*_dstore).loadValues(t,&cutVarTmp) ;
         }
         f->Close() ;
 
@@ -534,9 +530,7 @@ RooDataSet::RooDataSet(RooStringView name, RooStringView title, const RooArgSet&
         if (tstore) {
           tstore->loadValues(impTree,cutVar,cutRange);
         } else {
-          RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
-          tmpstore.loadValues(impTree,cutVar,cutRange) ;
-          _dstore->append(tmpstore) ;
+          static_cast<RooVectorDataStore&>(*_dstore).loadValues(impTree,cutVar) ;
         }
       } else if (fname && strlen(fname)) {
         // Case 5b --- Import TTree from file with cutvar
@@ -553,9 +547,7 @@ RooDataSet::RooDataSet(RooStringView name, RooStringView title, const RooArgSet&
         if (tstore) {
           tstore->loadValues(t,cutVar,cutRange);
         } else {
-          RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
-          tmpstore.loadValues(t,cutVar,cutRange) ;
-          _dstore->append(tmpstore) ;
+          static_cast<RooVectorDataStore&>(*_dstore).loadValues(t,cutVar) ;
         }
 
         f->Close() ;
@@ -606,9 +598,7 @@ RooDataSet::RooDataSet(RooStringView name, RooStringView title, const RooArgSet&
         if (tstore) {
           tstore->loadValues(impTree,0,cutRange);
         } else {
-          RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
-          tmpstore.loadValues(impTree,0,cutRange) ;
-          _dstore->append(tmpstore) ;
+          static_cast<RooVectorDataStore&>(*_dstore).loadValues(impTree) ;
         }
       }
     }
@@ -33,6 +33,7 @@ retrieve these precalculated objects.
 #include "RooAbsCategory.h"
 #include "RooArgSet.h"
 #include "RooMsgService.h"
+#include <cstring>
 #include <iostream>
 
 ClassImp(RooExpensiveObjectCache);
@@ -297,8 +298,9 @@ void RooExpensiveObjectCache::ExpensiveObject::print() const
 
 void RooExpensiveObjectCache::importCacheObjects(RooExpensiveObjectCache& other, const char* ownerName, bool verbose)
 {
+  // This is called for every node imported in a workspace, so avoid constructing strings for each cache object
   for(auto const& item : other._map) {
-    if (std::string(ownerName)==item.second->ownerName()) {
+    if (strcmp(item.second->ownerName(), ownerName) == 0) {
       _map[item.first.Data()] = new ExpensiveObject(_nextUID++, *item.second) ;
       if (verbose) {
    oocoutI(item.second->payload(),Caching) << "RooExpensiveObjectCache::importCache() importing cache object "
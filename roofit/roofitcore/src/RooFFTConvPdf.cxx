@@ -123,6 +123,7 @@
 #include "RooGlobalFunc.h"
 #include "RooConstVar.h"
 #include "RooUniformBinning.h"
+#include "RooAbsCategory.h"
 
 #include "TClass.h"
 #include "TComplex.h"
@@ -135,6 +136,40 @@ using namespace std;
 
 ClassImp(RooFFTConvPdf);
 
+namespace {
+
+/// The current values of the parameters of an input pdf, to find out whether
+/// its spectrum has to be recomputed.
+std::vector<double> parameterValues(RooArgSet const& params)
+{
+  std::vector<double> values;
+  for (auto arg : params) {
+    if (auto real = dynamic_cast<RooAbsReal const*>(arg)) {
+      values.push_back(real->getVal());
+    } else if (auto cat = dynamic_cast<RooAbsCategory const*>(arg)) {
+      values.push_back(cat->getCurrentIndex());
+    }
+  }
+  return values;
+}
+
+/// Transform the sampled values of an input pdf, and copy the first half + 1
+/// of the complex output to the spectrum.
+void computeSpectrum(TVirtualFFT& fft, std::vector<double>& input, std::vector<std::complex<double>>& spectrum)
+{
+  fft.SetPoints(input.data());
+  fft.Transform();
+
+  spectrum.resize(input.size()/2 + 1);
+  for (std::size_t i = 0; i < spectrum.size(); ++i) {
+    double re, im;
+    fft.GetPointComplex(i, re, im);
+    spectrum[i] = {re, im};
+  }
+}
+
+} // namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for numerical (FFT) convolution of PDFs.
@@ -348,6 +383,11 @@ RooFFTConvPdf::FFTCacheElem::FFTCacheElem(const RooFFTConvPdf& self, const RooAr
   pdf1Clone->fixAddCoefNormalization(convSet, true);
   pdf2Clone->fixAddCoefNormalization(convSet, true);
 
+  // Keep track of the parameters of each input pdf, to transform them again
+  // only when their own parameters changed
+  pdf1Clone->getParameters(hist()->get(), pdf1Params);
+  pdf2Clone->getParameters(hist()->get(), pdf2Params);
+
   // Save copy of original histX binning and make alternate binning
   // for extended range scanning
 
@@ -408,9 +448,19 @@ RooArgList RooFFTConvPdf::FFTCacheElem::containedArgs(Action a)
 void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 {
   RooDataHist& cacheHist = *cache.hist() ;
+  auto& aux = static_cast<FFTCacheElem&>(cache);
+
+  aux.pdf1Clone->setOperMode(ADirty,true) ;
+  aux.pdf2Clone->setOperMode(ADirty,true) ;
 
-  ((FFTCacheElem&)cache).pdf1Clone->setOperMode(ADirty,true) ;
-  ((FFTCacheElem&)cache).pdf2Clone->setOperMode(ADirty,true) ;
+  // Only the input pdfs whose parameters changed since the last filling of
+  // the cache need to be sampled and transformed again
+  std::vector<double> paramValues1 = parameterValues(aux.pdf1Params);
+  std::vector<double> paramValues2 = parameterValues(aux.pdf2Params);
+  aux.recompute1 = paramValues1 != aux.pdf1ParamValues;
+  aux.recompute2 = paramValues2 != aux.pdf2ParamValues;
+  aux.pdf1ParamValues = std::move(paramValues1);
+  aux.pdf2ParamValues = std::move(paramValues2);
 
   // Determine if there other observables than the convolution observable in the cache
   RooArgSet otherObs ;
@@ -425,7 +475,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 
   // Handle trivial scenario -- no other observables
   if (otherObs.empty()) {
-    fillCacheSlice((FFTCacheElem&)cache,RooArgSet()) ;
+    fillCacheSlice(aux,RooArgSet()) ;
     return ;
   }
 
@@ -450,6 +500,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
   }
 
   bool loop(true) ;
+  std::size_t sliceIndex = 0;
   while(loop) {
     // Set current slice position
     for (Int_t j=0 ; j<n ; j++) { obsLV[j]->setBin(binCur[j],binningName()) ; }
@@ -457,7 +508,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 //     cout << "filling slice: bin of obsLV[0] = " << obsLV[0]->getBin() << endl ;
 
     // Fill current slice
-    fillCacheSlice((FFTCacheElem&)cache,otherObs) ;
+    fillCacheSlice(aux,otherObs,sliceIndex++) ;
 
     // Determine which iterator to increment
     while(binCur[curObs]==binMax[curObs]) {
@@ -483,9 +534,11 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Fill a slice of cachePdf with the output of the FFT convolution calculation
+/// Fill a slice of cachePdf with the output of the FFT convolution calculation.
+/// The spectrum of an input pdf is only recomputed if its parameters changed,
+/// otherwise the one of the previous filling of the slice is used.
 
-void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos) const
+void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos, std::size_t sliceIndex) const
 {
   // Extract histogram that is the basis of the RooHistPdf
   RooDataHist& cacheHist = *aux.hist() ;
@@ -501,16 +554,32 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   //
   //
 
-  Int_t N,N2,binShift1,binShift2 ;
+  if (aux.spectra1.size() <= sliceIndex) {
+    aux.spectra1.resize(sliceIndex + 1);
+    aux.spectra2.resize(sliceIndex + 1);
+  }
+  FFTCacheElem::Spectrum& spectrum1 = aux.spectra1[sliceIndex];
+  FFTCacheElem::Spectrum& spectrum2 = aux.spectra2[sliceIndex];
+  const bool recompute1 = aux.recompute1 || spectrum1.values.empty();
+  const bool recompute2 = aux.recompute2 || spectrum2.values.empty();
+
+  std::vector<double> input1;
+  std::vector<double> input2;
 
   RooRealVar* histX = (RooRealVar*) cacheHist.get()->find(_x.arg().GetName()) ;
   if (_bufStrat==Extend) histX->setBinning(*aux.scanBinning) ;
-  std::vector<double> input1 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf1Clone,cacheHist,slicePos,N,N2,binShift1,_shift1) ;
-  std::vector<double> input2 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+  if (recompute1) {
+    input1 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf1Clone,cacheHist,slicePos,
+                     aux.nBins,aux.nBinsWithBuffer,spectrum1.binShift,_shift1) ;
+  }
+  if (recompute2) {
+    input2 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf2Clone,cacheHist,slicePos,
+                     aux.nBins,aux.nBinsWithBuffer,spectrum2.binShift,_shift2) ;
+  }
   if (_bufStrat==Extend) histX->setBinning(*aux.histBinning) ;
 
-
-
+  Int_t N = aux.nBins;
+  Int_t N2 = aux.nBinsWithBuffer;
 
   // Retrieve previously defined FFT transformation plans
   if (!aux.fftr2c1) {
@@ -525,29 +594,23 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   }
 
   // Real->Complex FFT Transform on p.d.f. 1 sampling
-  aux.fftr2c1->SetPoints(input1.data());
-  aux.fftr2c1->Transform();
+  if (recompute1) computeSpectrum(*aux.fftr2c1, input1, spectrum1.values);
 
   // Real->Complex FFT Transform on p.d.f 2 sampling
-  aux.fftr2c2->SetPoints(input2.data());
-  aux.fftr2c2->Transform();
+  if (recompute2) computeSpectrum(*aux.fftr2c2, input2, spectrum2.values);
 
   // Loop over first half +1 of complex output results, multiply
   // and set as input of reverse transform
   for (Int_t i=0 ; i<N2/2+1 ; i++) {
-    double re1,re2,im1,im2 ;
-    aux.fftr2c1->GetPointComplex(i,re1,im1) ;
-    aux.fftr2c2->GetPointComplex(i,re2,im2) ;
-    double re = re1*re2 - im1*im2 ;
-    double im = re1*im2 + re2*im1 ;
-    TComplex t(re,im) ;
+    const std::complex<double> product = spectrum1.values[i] * spectrum2.values[i];
+    TComplex t(product.real(),product.imag()) ;
     aux.fftc2r->SetPointComplex(i,t) ;
   }
 
   // Reverse Complex->Real FFT transform product
   aux.fftc2r->Transform() ;
 
-  Int_t totalShift = binShift1 + (N2-N)/2 ;
+  Int_t totalShift = spectrum1.binShift + (N2-N)/2 ;
 
   // Store FFT result in cache
 
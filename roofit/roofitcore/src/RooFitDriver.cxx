@@ -24,6 +24,16 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The RooFitDriver class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+With the code generation backend (`BatchMode("codegen")`), the computation
+graph is instead translated to a single C++ function that is compiled with
+cling, see RooAbsReal::translate() and RooFit::Detail::CodeSquashContext. The
+constant parameters are inlined in the generated code, and the per-event
+computations are fused in one loop over the events for each likelihood term.
+The values that can't be translated to code, like the normalization
+integrals, are still computed by the RooFitDriver before each call of the
+generated function. If any per-event computation can't be translated, it falls
+back to the CPU batch mode.
 **/
 
 #include <RooFitDriver.h>
@@ -40,15 +50,20 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include <RooFit/BatchModeDataHelpers.h>
 #include <RooFit/BatchModeHelpers.h>
 #include <RooFit/CUDAHelpers.h>
+#include <RooFit/Detail/CodeSquashContext.h>
 #include <RooSimultaneous.h>
 
 #include "NormalizationHelpers.h"
 
+#include <ROOT/TExecutor.hxx>
+#include <TInterpreter.h>
 #include <TList.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 #include <thread>
+#include <unordered_map>
 
 #define COUT_DEBUG ooccoutD(nullptr, FastEvaluations)
 
@@ -74,6 +89,15 @@ struct NodeInfo {
       }
    }
 
+   /// Check whether the node has to be recomputed, i.e. if it was never
+   /// computed or if the value of one of its servers changed in the current
+   /// evaluation. The nodes whose servers didn't change keep their last output.
+   bool needsRecomputation() const
+   {
+      return isDirty || std::any_of(serverInfos.begin(), serverInfos.end(),
+                                    [](NodeInfo const *serverInfo) { return serverInfo->valueChanged; });
+   }
+
    RooAbsArg *absArg = nullptr;
 
    Detail::AbsBuffer *buffer = nullptr;
@@ -91,6 +115,7 @@ struct NodeInfo {
    bool fromDataset = false;
    bool isVariable = false;
    bool isDirty = true;
+   bool valueChanged = false; ///< If the output of the node changed in the current evaluation
    bool isCategory = false;
    std::size_t outputSize = 1;
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
@@ -110,6 +135,23 @@ struct NodeInfo {
    }
 };
 
+/// The function generated by the code generation backend of the RooFitDriver,
+/// together with the inputs that have to be passed to it.
+struct GeneratedCode {
+   using Func = double (*)(double const *params, double const *const *data, double const *ext);
+
+   Func func = nullptr;
+   RooFit::Detail::CodeSquashContext ctx;
+   std::vector<RooRealVar const *> params;
+   std::vector<double> paramValues;
+   std::vector<double const *> data;
+   std::vector<double> ext;
+   /// The constant parameters whose values were inlined in the generated code
+   std::vector<std::pair<RooRealVar const *, double>> inlinedConstants;
+   /// Whether a node has to be computed by the RooFitDriver for the external values of the function
+   std::vector<bool> isComputedByDriver;
+};
+
 /// Construct a new RooFitDriver. The constructor analyzes and saves metadata about the graph,
 /// useful for the evaluation of it that will be done later. In case the CUDA mode is selected,
 /// there's also some CUDA-related initialization.
@@ -144,6 +186,8 @@ RooFitDriver::RooFitDriver(const RooAbsReal &absReal, RooArgSet const &normSet,
 
    _dataMapCPU.resize(serverSet.size());
    _dataMapCUDA.resize(serverSet.size());
+   _gradMap.resize(serverSet.size());
+   _gradBuffers.resize(serverSet.size());
 
    std::unordered_map<TNamed const *, std::size_t> tokens;
    std::map<RooFit::Detail::DataKey, NodeInfo *> nodeInfos;
@@ -248,6 +292,10 @@ void RooFitDriver::setData(RooAbsData const &data, std::string const &rangeName,
 
 void RooFitDriver::setData(DataSpansMap const &dataSpans)
 {
+   // The generated code depends on the sizes of the data spans
+   _generatedCode.reset();
+   _codeGenerationFailed = false;
+
    // Iterate over the given data spans and add them to the data map. Check if
    // they are used in the computation graph. If yes, add the span to the data
    // map and set the node info accordingly.
@@ -319,7 +367,11 @@ RooFitDriver::~RooFitDriver()
 
 std::vector<double> RooFitDriver::getValues()
 {
-   getVal();
+   const double val = getVal();
+   if (_generatedCode) {
+      // The generated code can only compute a scalar top node
+      return {val};
+   }
    NodeInfo const &nodeInfo = _nodes.back();
    if (nodeInfo.computeInGPU) {
       std::size_t nOut = nodeInfo.outputSize;
@@ -377,7 +429,32 @@ void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
    }
 }
 
-/// Returns the value of the top node in the computation graph
+/// Update the value of a variable node if it was changed since the last evaluation.
+void RooFitDriver::updateVariable(NodeInfo &info)
+{
+   auto *var = static_cast<RooRealVar const *>(info.absArg);
+   if (info.lastSetValCount != var->valueResetCounter()) {
+      info.lastSetValCount = var->valueResetCounter();
+      computeCPUNode(info.absArg, info);
+      info.isDirty = false;
+      info.valueChanged = true;
+   }
+}
+
+/// Recompute a node whose servers have changed, and check whether its own
+/// value changed. Only the scalar values are compared, the outputs of nodes
+/// with a larger output size are always considered as changed.
+void RooFitDriver::recomputeCPUNode(NodeInfo &info)
+{
+   const double oldValue = info.scalarBuffer;
+   computeCPUNode(info.absArg, info);
+   info.valueChanged = info.isDirty || !info.isScalar || info.scalarBuffer != oldValue;
+   info.isDirty = false;
+}
+
+/// Returns the value of the top node in the computation graph. Only the nodes
+/// that depend on variables changed since the last evaluation are recomputed,
+/// and the invalidation stops at the nodes whose scalar value didn't change.
 double RooFitDriver::getVal()
 {
    ++_getValInvocations;
@@ -386,35 +463,403 @@ double RooFitDriver::getVal()
       return getValHeterogeneous();
    }
 
+   if (_batchMode == RooFit::BatchModeOption::CodeGen && updateGeneratedCode()) {
+      return getValGeneratedCode();
+   }
+
+   if (ROOT::IsImplicitMTEnabled()) {
+      return getValMultiThreaded();
+   }
+
    for (auto &nodeInfo : _nodes) {
-      RooAbsArg *node = nodeInfo.absArg;
-      if (!nodeInfo.fromDataset) {
-         if (nodeInfo.isVariable) {
-            auto *var = static_cast<RooRealVar const *>(node);
-            if (nodeInfo.lastSetValCount != var->valueResetCounter()) {
-               nodeInfo.lastSetValCount = var->valueResetCounter();
-               for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
-                  clientInfo->isDirty = true;
-               }
-               computeCPUNode(node, nodeInfo);
-               nodeInfo.isDirty = false;
-            }
-         } else {
-            if (nodeInfo.isDirty) {
-               for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
-                  clientInfo->isDirty = true;
-               }
-               computeCPUNode(node, nodeInfo);
-               nodeInfo.isDirty = false;
-            }
+      nodeInfo.valueChanged = false;
+      if (nodeInfo.fromDataset) {
+         continue;
+      }
+      if (nodeInfo.isVariable) {
+         updateVariable(nodeInfo);
+      } else if (nodeInfo.needsRecomputation()) {
+         recomputeCPUNode(nodeInfo);
+      }
+   }
+
+   // return the final value
+   return _dataMapCPU.at(&topNode())[0];
+}
+
+/// Returns the value of the top node in the computation graph, evaluating the
+/// nodes that don't depend on each other concurrently on the implicit
+/// multi-threading pool.
+///
+/// The nodes that might have to be recomputed are grouped in levels: the nodes
+/// of one level only depend on such nodes of the previous levels, so all nodes
+/// of a level can be computed in parallel. This is only done for the nodes that
+/// can also be computed on the GPU, because their computeBatch() implementation
+/// doesn't change the state of their servers. The other nodes, like the ones using the generic
+/// RooAbsReal::computeBatch() that temporarily sets the values of the servers,
+/// are computed one after the other after the parallel part of their level.
+/// The large data spans are split in chunks that are evaluated in parallel by
+/// RooBatchCompute itself.
+double RooFitDriver::getValMultiThreaded()
+{
+   // The level of each node that might have to be recomputed, -1 for the other nodes
+   std::vector<int> nodeLevels(_nodes.size(), -1);
+   std::vector<std::vector<NodeInfo *>> levels;
+
+   for (auto &nodeInfo : _nodes) {
+      nodeInfo.valueChanged = false;
+      if (nodeInfo.fromDataset) {
+         continue;
+      }
+      if (nodeInfo.isVariable) {
+         // Variables are cheap to "compute", and there is no need to schedule them.
+         updateVariable(nodeInfo);
+         continue;
+      }
+      int level = nodeInfo.isDirty ? 0 : -1;
+      for (NodeInfo *serverInfo : nodeInfo.serverInfos) {
+         if (serverInfo->valueChanged) {
+            level = std::max(level, 0);
+         } else if (nodeLevels[serverInfo->iNode] >= 0) {
+            level = std::max(level, nodeLevels[serverInfo->iNode] + 1);
          }
       }
+      if (level < 0) {
+         continue;
+      }
+      nodeLevels[nodeInfo.iNode] = level;
+      if (level >= static_cast<int>(levels.size())) {
+         levels.resize(level + 1);
+      }
+      levels[level].push_back(&nodeInfo);
+
+      // The buffer manager is not thread safe, so the buffers are created before the parallel evaluation.
+      if (nodeInfo.outputSize > 1 && !nodeInfo.buffer) {
+         nodeInfo.buffer = _bufferManager.makeCpuBuffer(nodeInfo.outputSize);
+      }
+   }
+
+   ROOT::Internal::TExecutor ex;
+   std::vector<NodeInfo *> concurrentNodes;
+   std::vector<NodeInfo *> sequentialNodes;
+   for (auto &level : levels) {
+      // Whether the nodes of this level really need to be recomputed is only
+      // known once the previous levels are done.
+      concurrentNodes.clear();
+      sequentialNodes.clear();
+      for (NodeInfo *nodeInfo : level) {
+         if (nodeInfo->needsRecomputation()) {
+            auto &nodes = nodeInfo->absArg->canComputeBatchWithCuda() ? concurrentNodes : sequentialNodes;
+            nodes.push_back(nodeInfo);
+         }
+      }
+      if (concurrentNodes.size() > 1) {
+         ex.Map(
+            [&](NodeInfo *nodeInfo) -> int {
+               recomputeCPUNode(*nodeInfo);
+               return 0;
+            },
+            concurrentNodes);
+      } else if (concurrentNodes.size() == 1) {
+         recomputeCPUNode(*concurrentNodes[0]);
+      }
+      for (NodeInfo *nodeInfo : sequentialNodes) {
+         recomputeCPUNode(*nodeInfo);
+      }
    }
 
    // return the final value
    return _dataMapCPU.at(&topNode())[0];
 }
 
+/// Make sure that the function generated by the code generation backend is
+/// up to date, i.e. that the values of the inlined constant parameters
+/// didn't change. Returns `false` if no function could be generated.
+bool RooFitDriver::updateGeneratedCode()
+{
+   if (_codeGenerationFailed) {
+      return false;
+   }
+   if (_generatedCode) {
+      auto const &constants = _generatedCode->inlinedConstants;
+      const bool isUpToDate = std::all_of(constants.begin(), constants.end(), [](auto const &item) {
+         return item.first->isConstant() && item.first->getVal() == item.second;
+      });
+      if (isUpToDate) {
+         return true;
+      }
+   }
+   _generatedCode.reset();
+   _codeGenerationFailed = !generateCode();
+   return !_codeGenerationFailed;
+}
+
+/// Translate the computation graph to C++ code and compile it with cling.
+///
+/// The nodes with a single output value are translated in topological order.
+/// The nodes whose value depends on the event are translated when the event
+/// loop of a reducer node like the RooNLLVarNew requests them. The constant
+/// parameters are inlined, while the values of the floating parameters are
+/// passed to the function. The scalar nodes that don't support the code
+/// generation are computed by the RooFitDriver like in the CPU mode, and their
+/// values are passed to the function too.
+bool RooFitDriver::generateCode()
+{
+   using RooFit::Detail::CodeSquashContext;
+
+   auto code = std::make_unique<GeneratedCode>();
+   CodeSquashContext &ctx = code->ctx;
+   code->isComputedByDriver.resize(_nodes.size(), false);
+
+   // Mark a node and all the nodes it depends on to be computed by the driver
+   auto computeByDriver = [&](NodeInfo &info) {
+      std::vector<NodeInfo *> stack{&info};
+      while (!stack.empty()) {
+         NodeInfo *current = stack.back();
+         stack.pop_back();
+         if (code->isComputedByDriver[current->iNode]) {
+            continue;
+         }
+         code->isComputedByDriver[current->iNode] = true;
+         stack.insert(stack.end(), current->serverInfos.begin(), current->serverInfos.end());
+      }
+   };
+
+   std::string returnExpr;
+   try {
+      for (NodeInfo const &info : _nodes) {
+         ctx.setOutputSize(*info.absArg, info.outputSize);
+      }
+
+      for (NodeInfo &info : _nodes) {
+         RooAbsArg const *arg = info.absArg;
+         if (info.fromDataset) {
+            ctx.addDataInput(*arg);
+            code->data.push_back(_dataMapCPU.at(arg).data());
+         } else if (info.isVariable) {
+            auto *var = static_cast<RooRealVar const *>(arg);
+            if (var->isConstant()) {
+               ctx.addResult(arg, CodeSquashContext::buildLiteral(var->getVal()));
+               code->inlinedConstants.emplace_back(var, var->getVal());
+            } else {
+               ctx.addResult(arg, "params[" + std::to_string(code->params.size()) + "]");
+               code->params.push_back(var);
+            }
+         } else if (info.isCategory) {
+            throw std::runtime_error(std::string("the category \"") + arg->GetName() + "\" is not in the dataset");
+         } else if (info.isScalar && !static_cast<RooAbsReal const *>(arg)->translate(ctx)) {
+            computeByDriver(info);
+            const std::size_t iExt =
+               ctx.addExternals(1, [this, arg](double *out) { out[0] = _dataMapCPU.at(arg)[0]; });
+            ctx.addResult(arg, "ext[" + std::to_string(iExt) + "]");
+         }
+      }
+
+      if (!_nodes.back().isScalar) {
+         throw std::runtime_error("the output of the top node is not a single value");
+      }
+      returnExpr = ctx.getResult(topNode());
+   } catch (std::exception const &error) {
+      oocoutW(static_cast<RooAbsArg *>(nullptr), Fitting)
+         << "RooFitDriver: the computation graph can't be translated to C++ code (" << error.what()
+         << "), falling back to the CPU batch mode" << std::endl;
+      return false;
+   }
+
+   static std::size_t nFunctions = 0;
+   const std::string funcName = "roofitGeneratedFunction" + std::to_string(nFunctions++);
+   const std::string funcCode = ctx.assembleCode(funcName, returnExpr);
+   oocxcoutD(static_cast<RooAbsArg *>(nullptr), Fitting) << "RooFitDriver: generated code\n" << funcCode << std::endl;
+
+   if (!gInterpreter->Declare(("#pragma cling optimize(2)\n" + funcCode).c_str())) {
+      oocoutW(static_cast<RooAbsArg *>(nullptr), Fitting)
+         << "RooFitDriver: the generated code can't be compiled, falling back to the CPU batch mode" << std::endl;
+      return false;
+   }
+   code->func = reinterpret_cast<GeneratedCode::Func>(gInterpreter->ProcessLine(("&" + funcName + ";").c_str()));
+   if (!code->func) {
+      return false;
+   }
+
+   code->paramValues.resize(code->params.size());
+   code->ext.resize(ctx.nExternals());
+   _generatedCode = std::move(code);
+   return true;
+}
+
+/// Returns the value of the top node computed by the generated function.
+double RooFitDriver::getValGeneratedCode()
+{
+   GeneratedCode &code = *_generatedCode;
+
+   // Compute the nodes that the generated function takes as external inputs
+   for (auto &nodeInfo : _nodes) {
+      nodeInfo.valueChanged = false;
+      if (nodeInfo.fromDataset || !code.isComputedByDriver[nodeInfo.iNode]) {
+         continue;
+      }
+      if (nodeInfo.isVariable) {
+         updateVariable(nodeInfo);
+      } else if (nodeInfo.needsRecomputation()) {
+         recomputeCPUNode(nodeInfo);
+      }
+   }
+
+   for (std::size_t i = 0; i < code.params.size(); ++i) {
+      code.paramValues[i] = code.params[i]->getVal();
+   }
+   code.ctx.fillExternals(code.ext.data());
+
+   return code.func(code.paramValues.data(), code.data.data(), code.ext.data());
+}
+
+/// Returns for each node whether it depends on a floating parameter, i.e. a
+/// non-constant RooRealVar that is not taken from the dataset.
+std::vector<bool> RooFitDriver::nodesNeedingGradient() const
+{
+   std::vector<bool> out(_nodes.size(), false);
+   for (auto const &info : _nodes) {
+      if (info.fromDataset) {
+         continue;
+      }
+      if (info.isVariable) {
+         out[info.iNode] = !static_cast<RooRealVar const *>(info.absArg)->isConstant();
+         continue;
+      }
+      out[info.iNode] = std::any_of(info.serverInfos.begin(), info.serverInfos.end(),
+                                    [&](NodeInfo const *serverInfo) { return out[serverInfo->iNode]; });
+   }
+   return out;
+}
+
+/// Check whether the gradient of the top node with respect to the parameters
+/// can be computed with gradient(). This is the case in the CPU mode if every
+/// node that depends on a floating parameter either implements
+/// RooAbsReal::computeBatchGradient(), or can be differentiated numerically in
+/// computeNumericalGradient().
+bool RooFitDriver::hasGradient() const
+{
+   if (_batchMode == RooFit::BatchModeOption::Cuda || _batchMode == RooFit::BatchModeOption::CodeGen ||
+       _nodes.back().outputSize != 1) {
+      return false;
+   }
+   std::vector<bool> needsGradient = nodesNeedingGradient();
+   for (auto const &info : _nodes) {
+      if (!needsGradient[info.iNode] || info.isVariable) {
+         continue;
+      }
+      if (info.isCategory) {
+         return false;
+      }
+      if (static_cast<RooAbsReal const *>(info.absArg)->canComputeBatchGradient()) {
+         continue;
+      }
+      for (NodeInfo const *serverInfo : info.serverInfos) {
+         if (needsGradient[serverInfo->iNode] && serverInfo->outputSize != 1 &&
+             (info.outputSize == 1 || serverInfo->outputSize != info.outputSize)) {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+/// Compute the derivatives of the top node with respect to the parameters in
+/// `params` in a single reverse pass over the computation graph, and store
+/// them in `out`. Parameters that are not in the graph get a zero derivative.
+/// Should only be called if hasGradient() returns `true`.
+void RooFitDriver::gradient(RooArgList const &params, double *out)
+{
+   getVal();
+
+   std::vector<bool> needsGradient = nodesNeedingGradient();
+   for (auto &info : _nodes) {
+      auto &buffer = _gradBuffers[info.iNode];
+      if (needsGradient[info.iNode]) {
+         buffer.assign(info.outputSize, 0.0);
+         _gradMap.at(info.absArg) = RooSpan<double>(buffer.data(), buffer.size());
+      } else {
+         buffer.clear();
+         _gradMap.at(info.absArg) = RooSpan<double>{};
+      }
+   }
+
+   if (needsGradient[_nodes.back().iNode]) {
+      _gradBuffers[_nodes.back().iNode][0] = 1.0;
+   }
+
+   for (auto it = _nodes.rbegin(); it != _nodes.rend(); ++it) {
+      NodeInfo &info = *it;
+      if (!needsGradient[info.iNode] || info.isVariable) {
+         continue;
+      }
+      auto *node = static_cast<RooAbsReal const *>(info.absArg);
+      double const *grad = _gradBuffers[info.iNode].data();
+      const bool isAnalytical = node->canComputeBatchGradient() &&
+                                node->computeBatchGradient(grad, info.outputSize, _dataMapCPU, _gradMap);
+      if (!isAnalytical) {
+         computeNumericalGradient(info);
+      }
+   }
+
+   std::unordered_map<TNamed const *, NodeInfo const *> nodesByName;
+   for (auto const &info : _nodes) {
+      nodesByName[info.absArg->namePtr()] = &info;
+   }
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      auto found = nodesByName.find(params[i].namePtr());
+      std::vector<double> const *buffer = found != nodesByName.end() ? &_gradBuffers[found->second->iNode] : nullptr;
+      out[i] = buffer && !buffer->empty() ? (*buffer)[0] : 0.0;
+   }
+}
+
+/// Propagate the gradient with respect to the output of a node that doesn't
+/// implement RooAbsReal::computeBatchGradient() to its servers, using central
+/// finite differences of the node alone. The servers with one value per event
+/// are varied all at once, assuming that the output for each event only
+/// depends on the input values for the same event.
+void RooFitDriver::computeNumericalGradient(NodeInfo &info)
+{
+   constexpr double relStep = 1e-6;
+
+   auto *node = static_cast<RooAbsReal const *>(info.absArg);
+   const std::size_t nOut = info.outputSize;
+   double const *grad = _gradBuffers[info.iNode].data();
+
+   std::vector<double> outUp(nOut);
+   std::vector<double> outDown(nOut);
+   std::vector<double> valuesUp;
+   std::vector<double> valuesDown;
+
+   for (NodeInfo *serverInfo : info.serverInfos) {
+      RooSpan<double> serverGrad = _gradMap.at(serverInfo->absArg);
+      if (serverGrad.empty()) {
+         continue;
+      }
+      auto &serverSpan = _dataMapCPU.at(serverInfo->absArg);
+      const RooSpan<const double> values = serverSpan;
+      valuesUp.assign(values.begin(), values.end());
+      valuesDown.assign(values.begin(), values.end());
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         const double step = relStep * std::max(1.0, std::abs(values[i]));
+         valuesUp[i] += step;
+         valuesDown[i] -= step;
+      }
+
+      serverSpan = RooSpan<const double>(valuesUp.data(), valuesUp.size());
+      node->computeBatch(nullptr, outUp.data(), nOut, _dataMapCPU);
+      serverSpan = RooSpan<const double>(valuesDown.data(), valuesDown.size());
+      node->computeBatch(nullptr, outDown.data(), nOut, _dataMapCPU);
+      serverSpan = values;
+
+      for (std::size_t i = 0; i < nOut; ++i) {
+         const std::size_t iServer = values.size() == 1 ? 0 : i;
+         const double derivative = (outUp[i] - outDown[i]) / (valuesUp[iServer] - valuesDown[iServer]);
+         RooFit::Detail::GradientMap::add(serverGrad, i, grad[i] * derivative);
+      }
+   }
+}
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getValHeterogeneous()
 {
@@ -186,10 +186,11 @@ namespace RooFit {
       if(lower == "off") mode = BatchModeOption::Off;
       else if(lower == "cpu") mode = BatchModeOption::Cpu;
       else if(lower == "cuda") mode = BatchModeOption::Cuda;
+      else if(lower == "codegen") mode = BatchModeOption::CodeGen;
       else if(lower == "old") mode = BatchModeOption::Old;
       // Note that the "old" argument is undocumented, because accessing the
       // old batch mode is an advanced developer feature.
-      else throw std::runtime_error("Only supported string values for BatchMode() are \"off\", \"cpu\", or \"cuda\".");
+      else throw std::runtime_error("Only supported string values for BatchMode() are \"off\", \"cpu\", \"cuda\", or \"codegen\".");
       return RooCmdArg("BatchMode", static_cast<int>(mode));
   }
   /// Integrate the PDF over bins. Improves accuracy for binned fits. Switch off using `0.` as argument. \see RooAbsPdf::fitTo().
@@ -267,6 +268,8 @@ namespace RooFit {
   /// When parameters are chosen such that a PDF is undefined, try to indicate to the minimiser how to leave this region.
   /// \param strength Strength of hints for minimiser. Set to zero to switch off.
   RooCmdArg RecoverFromUndefinedRegions(double strength) { return RooCmdArg("RecoverFromUndefinedRegions",0,0,strength,0,0,0,0,0) ; }
+  /// Pass the gradient of the likelihood to the minimizer if the likelihood can compute it, see RooAbsReal::hasGradient().
+  RooCmdArg AnalyticalGradient(bool flag)               { return RooCmdArg("AnalyticalGradient",flag,0,0,0,0,0,0,0) ; }
 
 
   // RooAbsPdf::paramOn arguments
@@ -201,7 +201,7 @@ void RooHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, RooFi
     _dataHist->weights(output, xVals, _intOrder, false, _cdfBoundaries);
     return;
   }
-  
+
   std::vector<RooSpan<const double>> inputValues;
   for (const auto& obs : _depList) {
     auto realObs = dynamic_cast<const RooAbsReal*>(obs);
@@ -213,6 +213,12 @@ void RooHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, RooFi
     }
   }
 
+  // Without interpolation, the weights of all events are computed by the batch
+  // kernel of the RooDataHist, unless one of the observables is a category
+  if (_intOrder == 0 && _dataHist->weights(output, inputValues, size, false)) {
+    return;
+  }
+
   for (std::size_t i = 0; i < size; ++i) {
     bool skip = false;
 
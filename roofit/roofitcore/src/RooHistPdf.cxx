@@ -190,14 +190,26 @@ RooHistPdf::~RooHistPdf()
 
 void RooHistPdf::computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const& dataMap) const {
 
-  // For interpolation and histograms of higher dimension, use base function
-  if(_pdfObsList.size() > 1) {
-      RooAbsReal::computeBatch(nullptr, output, nEvents, dataMap);
+  if(_pdfObsList.size() == 1) {
+    auto xVals = dataMap.at(_pdfObsList[0]);
+    _dataHist->weights(output, xVals, _intOrder, true, _cdfBoundaries);
+    return;
+  }
+
+  // Histograms of higher dimension are handled by the batch kernel of the
+  // RooDataHist if they are not interpolated and all observables are real
+  if(_intOrder == 0) {
+    std::vector<RooSpan<const double>> xVals;
+    for (const auto obs : _pdfObsList) {
+      if (!dynamic_cast<const RooAbsReal*>(obs)) break;
+      xVals.push_back(dataMap.at(obs));
+    }
+    if (xVals.size() == _pdfObsList.size() && _dataHist->weights(output, xVals, nEvents, !_unitNorm)) {
       return;
+    }
   }
 
-  auto xVals = dataMap.at(_pdfObsList[0]);
-  _dataHist->weights(output, xVals, _intOrder, true, _cdfBoundaries);
+  RooAbsReal::computeBatch(nullptr, output, nEvents, dataMap);
 }
 
 
@@ -50,6 +50,7 @@ automatic PDF optimization.
 #include "RooMsgService.h"
 #include "RooPlot.h"
 #include "RooMinimizerFcn.h"
+#include "RooAnalyticalGradMinimizerFcn.h"
 #include "RooGradMinimizerFcn.h"
 #include "RooFitResult.h"
 #include "TestStatistics/MinuitFcnGrad.h"
@@ -134,6 +135,8 @@ RooMinimizer::RooMinimizer(RooAbsReal &function, Config const &cfg) : _cfg(cfg)
 
       if (_cfg.parallelGradient) // Old test statistic with parallel gradient
          _fcn = std::make_unique<RooGradMinimizerFcn>(&function, this);
+      else if (_cfg.useGradient && function.hasGradient()) // function provides its own gradient
+         _fcn = std::make_unique<RooAnalyticalGradMinimizerFcn>(&function, this);
       else // Old test statistic non parallel
          _fcn = std::make_unique<RooMinimizerFcn>(&function, this);
    }
@@ -29,6 +29,7 @@ functions from `RooBatchCompute` library to provide faster computation times.
 #include <RooNaNPacker.h>
 #include <RooRealVar.h>
 #include <RooFit/Detail/Buffers.h>
+#include <RooFit/Detail/CodeSquashContext.h>
 
 #include <ROOT/StringUtils.hxx>
 
@@ -37,8 +38,11 @@ functions from `RooBatchCompute` library to provide faster computation times.
 #include <Math/Util.h>
 #include <TMath.h>
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 using namespace ROOT::Experimental;
@@ -207,6 +211,121 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
    output[0] = finalizeResult(std::move(kahanProb), _sumWeight);
 }
 
+/** Propagate the gradient with respect to the NLL value to the pdf values, and
+for extended fits also to the parameters of the expected number of events.
+
+The expected number of events is not an input of this node in the computation
+graph, so its derivatives with respect to the floating parameters are computed
+numerically by varying the parameters. This only involves scalar computations.
+The offset and the normalization term for simultaneous fits don't depend on the
+parameters.
+**/
+bool RooNLLVarNew::computeBatchGradient(double const *grad, size_t /*nOut*/, RooFit::Detail::DataMap const &dataMap,
+                                        RooFit::Detail::GradientMap &gradMap) const
+{
+   std::size_t nEvents = dataMap.at(_pdf).size();
+
+   auto weights = dataMap.at(_weightVar);
+   auto weightsSumW2 = dataMap.at(_weightSquaredVar);
+   auto weightSpan = _weightSquared ? weightsSumW2 : weights;
+   auto probas = dataMap.at(_pdf);
+   RooSpan<double> pdfGrad = gradMap.at(_pdf);
+
+   if (!pdfGrad.empty()) {
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         double eventWeight = weightSpan.size() > 1 ? weightSpan[i] : weightSpan[0];
+         if (_binnedL) {
+            // -d/dpred (-mu + N * log(mu)) with mu = pred * binw
+            const double mu = probas[i] * _binw[i];
+            if (mu > 0) {
+               RooFit::Detail::GradientMap::add(pdfGrad, i, grad[0] * (1.0 - eventWeight / mu) * _binw[i]);
+            }
+         } else if (0. != eventWeight * eventWeight) {
+            RooFit::Detail::GradientMap::add(pdfGrad, i, -grad[0] * eventWeight / probas[i]);
+         }
+      }
+   }
+
+   if (_isExtended && !_binnedL) {
+      const double sumWeight2 = _weightSquared ? _sumWeight2 : 0.0;
+      RooArgSet params;
+      _pdf->getParameters(&_observables, params);
+      for (auto *param : params) {
+         auto *var = dynamic_cast<RooRealVar *>(param);
+         if (!var || var->isConstant())
+            continue;
+         RooSpan<double> paramGrad = gradMap.at(var);
+         if (paramGrad.empty())
+            continue;
+         const double value = var->getVal();
+         const double step = 1e-6 * std::max(1.0, std::abs(value));
+         var->setVal(value + step);
+         const double valueUp = var->getVal();
+         const double termUp = _pdf->extendedTerm(_sumWeight, _pdf->expectedEvents(&_observables), sumWeight2);
+         var->setVal(value - step);
+         const double valueDown = var->getVal();
+         const double termDown = _pdf->extendedTerm(_sumWeight, _pdf->expectedEvents(&_observables), sumWeight2);
+         var->setVal(value);
+         if (valueUp != valueDown) {
+            paramGrad[0] += grad[0] * (termUp - termDown) / (valueUp - valueDown);
+         }
+      }
+   }
+
+   return true;
+}
+
+/** Generate the code of the event loop that sums the negative log
+probabilities, followed by the extended term and the normalization term for
+simultaneous fits, for the code generation backend. The expected number of
+events is computed by the pdf before each call of the generated function. The
+binned likelihood and the offsetting are not supported, and the sums are not
+done with Kahan summation.
+**/
+bool RooNLLVarNew::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   if (_binnedL || _doOffset)
+      return false;
+
+   const std::string nll = ctx.getTmpVarName("nll");
+   const std::string sumWeight = ctx.getTmpVarName("sumWeight");
+   const std::string sumWeight2 = ctx.getTmpVarName("sumWeight2");
+   ctx.addToCodeBody("   double " + nll + " = 0.0;\n   double " + sumWeight + " = 0.0;\n   double " + sumWeight2 +
+                     " = 0.0;\n");
+
+   ctx.beginLoop(this);
+   const std::string weight = ctx.getResult(_weightVar);
+   const std::string weightSquared = ctx.getResult(_weightSquaredVar);
+   const std::string proba = ctx.getResult(_pdf);
+   std::string const &eventWeight = _weightSquared ? weightSquared : weight;
+   ctx.addToCodeBody("      " + sumWeight + " += " + weight + ";\n      " + sumWeight2 + " += " + weightSquared +
+                     ";\n      if (" + eventWeight + " != 0.0) {\n         " + nll + " -= " + eventWeight +
+                     " * std::log(" + proba + ");\n      }\n");
+   ctx.endLoop();
+
+   if (_isExtended) {
+      const std::size_t iExpected =
+         ctx.addExternals(1, [this](double *expected) { expected[0] = _pdf->expectedEvents(&_observables); });
+      const std::string expected = "ext[" + std::to_string(iExpected) + "]";
+      // Same as RooAbsPdf::extendedTerm()
+      std::string term = "(std::abs(" + expected + ") < 1e-10 && std::abs(" + sumWeight + ") < 1e-10 ? 0.0 : " +
+                         expected + " - " + sumWeight + " * std::log(" + expected + "))";
+      if (_weightSquared) {
+         term += " * (" + sumWeight2 + " != 0.0 ? " + sumWeight2 + " / " + sumWeight + " : 1.0)";
+      }
+      ctx.addToCodeBody("   " + nll + " += " + term + ";\n");
+   }
+
+   if (_simCount > 1) {
+      ctx.addToCodeBody("   " + nll + " += " + sumWeight + " * " +
+                        RooFit::Detail::CodeSquashContext::buildLiteral(std::log(static_cast<double>(_simCount))) +
+                        ";\n");
+   }
+
+   ctx.addResult(this, nll);
+   return true;
+}
+
 void RooNLLVarNew::getParametersHook(const RooArgSet * /*nset*/, RooArgSet *params, bool /*stripDisconnected*/) const
 {
    // strip away the observables and weights
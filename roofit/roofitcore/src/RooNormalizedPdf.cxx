@@ -12,6 +12,8 @@
 
 #include "RooNormalizedPdf.h"
 
+#include "RooFit/Detail/CodeSquashContext.h"
+
 /**
  * \class RooNormalizedPdf
  *
@@ -36,3 +38,35 @@ void RooNormalizedPdf::computeBatch(cudaStream_t * /*stream*/, double *output, s
       }
    }
 }
+
+/// Propagate the gradient of the normalized pdf values `nums / integral` to
+/// the unnormalized values and to the normalization integral.
+bool RooNormalizedPdf::computeBatchGradient(double const *grad, size_t nEvents, RooFit::Detail::DataMap const &dataMap,
+                                            RooFit::Detail::GradientMap &gradMap) const
+{
+   auto nums = dataMap.at(_pdf);
+   auto integralSpan = dataMap.at(_normIntegral);
+   RooSpan<double> numsGrad = gradMap.at(_pdf);
+   RooSpan<double> integralGrad = gradMap.at(_normIntegral);
+
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double integral = integralSpan.size() == 1 ? integralSpan[0] : integralSpan[i];
+      const double num = nums.size() == 1 ? nums[0] : nums[i];
+      if (!numsGrad.empty()) {
+         RooFit::Detail::GradientMap::add(numsGrad, i, grad[i] / integral);
+      }
+      if (!integralGrad.empty()) {
+         RooFit::Detail::GradientMap::add(integralGrad, i, -grad[i] * num / (integral * integral));
+      }
+   }
+   return true;
+}
+
+/// Generate the code that divides the values of the pdf by the normalization
+/// integral for the code generation backend. Unlike in computeBatch(), the
+/// evaluation errors are not packed in the NaN payloads.
+bool RooNormalizedPdf::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   ctx.addResult(this, ctx.getResult(_pdf) + " / " + ctx.getResult(_normIntegral));
+   return true;
+}
@@ -29,6 +29,20 @@ public:
       SetTitle(name.c_str());
    }
 
+   /// Normalize `pdf` with the normalization integral of `other`, which has
+   /// to normalize an equivalent pdf over the same observables. The integral
+   /// remains owned by `other`.
+   RooNormalizedPdf(RooAbsPdf &pdf, RooArgSet const &normSet, RooNormalizedPdf const &other)
+      : _pdf("numerator", "numerator", this, pdf),
+        _normIntegral("denominator", "denominator", this, const_cast<RooAbsReal &>(other._normIntegral.arg()), true,
+                      false, false),
+        _normSet{normSet}
+   {
+      auto name = std::string(pdf.GetName()) + "_over_" + _normIntegral->GetName();
+      SetName(name.c_str());
+      SetTitle(name.c_str());
+   }
+
    RooNormalizedPdf(const RooNormalizedPdf &other, const char *name)
       : RooAbsPdf(other, name), _pdf("numerator", this, other._pdf),
         _normIntegral("denominator", this, other._normIntegral), _normSet{other._normSet}
@@ -60,6 +74,10 @@ public:
 
 protected:
    void computeBatch(cudaStream_t *, double *output, size_t size, RooFit::Detail::DataMap const &) const override;
+   bool canComputeBatchGradient() const override { return true; }
+   bool computeBatchGradient(double const *grad, size_t size, RooFit::Detail::DataMap const &,
+                             RooFit::Detail::GradientMap &gradMap) const override;
+   bool translate(RooFit::Detail::CodeSquashContext &ctx) const override;
    double evaluate() const override
    {
       // Evaluate() should not be called in the BatchMode, but we still need it
@@ -59,6 +59,7 @@ RooAbsData::convertToVectorStore().
 #include "TBranch.h"
 #include "TROOT.h"
 
+#include <algorithm>
 #include <iomanip>
 using namespace std ;
 
@@ -540,6 +541,7 @@ void RooTreeDataStore::loadValues(const RooAbsDataStore *ads, const RooFormulaVa
 
 Int_t RooTreeDataStore::fill()
 {
+   clearColumnBuffers();
    return _tree->Fill() ;
 }
 
@@ -782,6 +784,7 @@ bool RooTreeDataStore::changeObservableName(const char* from, const char* to)
 RooAbsArg* RooTreeDataStore::addColumn(RooAbsArg& newVar, bool adjustRange)
 {
   checkInit() ;
+  clearColumnBuffers();
 
   // Create a fundamental object of the right type to hold newVar values
   RooAbsArg* valHolder= newVar.createFundamental();
@@ -935,6 +938,7 @@ Int_t RooTreeDataStore::numEntries() const
 
 void RooTreeDataStore::reset()
 {
+  clearColumnBuffers();
   Reset() ;
 }
 
@@ -1190,6 +1194,81 @@ std::string RooTreeDataStore::makeTreeName() const {
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Get the real-valued observables of the events in the range [first, first+len).
+/// The columns are read from the tree on the first call, such that trees stored
+/// in a file are only loaded in memory when they are used by the batch evaluation.
+RooAbsData::RealSpans RooTreeDataStore::getBatches(std::size_t first, std::size_t len) const {
+  loadColumns();
+  RooAbsData::RealSpans evalData;
+  for (auto const &column : _realColumns) {
+    const std::size_t size = column.second.size();
+    const std::size_t begin = std::min(first, size);
+    evalData.emplace(column.first, RooSpan<const double>{column.second.data() + begin, std::min(len, size - begin)});
+  }
+  return evalData;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the category observables of the events in the range [first, first+len).
+/// Like for getBatches(), the columns are read from the tree on the first call.
+RooAbsData::CategorySpans RooTreeDataStore::getCategoryBatches(std::size_t first, std::size_t len) const {
+  loadColumns();
+  RooAbsData::CategorySpans evalData;
+  for (auto const &column : _catColumns) {
+    const std::size_t size = column.second.size();
+    const std::size_t begin = std::min(first, size);
+    evalData.emplace(column.first, RooSpan<const RooAbsCategory::value_type>{column.second.data() + begin,
+                                                                             std::min(len, size - begin)});
+  }
+  return evalData;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the columns of all observables from the tree, such that the tree can be
+/// used by the batch evaluation. The columns are kept until the data is modified.
+void RooTreeDataStore::loadColumns() const {
+  if (_columnsLoaded) return;
+
+  _realColumns.clear();
+  _catColumns.clear();
+  const Int_t nEntries = numEntries();
+  for (auto *arg : _vars) {
+    if (auto *real = dynamic_cast<const RooAbsReal *>(arg)) {
+      _realColumns.emplace_back(real, std::vector<double>{});
+      _realColumns.back().second.reserve(nEntries);
+    } else if (auto *cat = dynamic_cast<const RooAbsCategory *>(arg)) {
+      _catColumns.emplace_back(cat, std::vector<RooAbsCategory::value_type>{});
+      _catColumns.back().second.reserve(nEntries);
+    }
+  }
+
+  for (Int_t i = 0; i < nEntries; ++i) {
+    get(i);
+    for (auto &column : _realColumns) {
+      column.second.push_back(column.first->getVal());
+    }
+    for (auto &column : _catColumns) {
+      column.second.push_back(column.first->getCurrentIndex());
+    }
+  }
+  _columnsLoaded = true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the columns and the weights read for the batch evaluation, when the data changes.
+void RooTreeDataStore::clearColumnBuffers() {
+  _weightBuffer.reset();
+  if (!_columnsLoaded) return;
+  _realColumns.clear();
+  _catColumns.clear();
+  _columnsLoaded = false;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the weights of the events in the range [first, first+len).
 /// This implementation will fill a vector with every event retrieved one by one
@@ -30,6 +30,8 @@ e.g. the binning of class RooBinning.
 
 #include "Riostream.h"
 
+#include <algorithm>
+
 
 using namespace std;
 
@@ -112,14 +114,19 @@ void RooUniformBinning::setRange(double xlo, double xhi)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return the index of the bin that encloses 'x'
+/// Return the index of the bin that encloses 'x'. The bin number is clamped
+/// to the valid range, which keeps the loop free of branches so that the
+/// compiler can vectorize it.
 
 void RooUniformBinning::binNumbers(double const * x, int * bins, std::size_t n, int coef) const
 {
   const double oneOverW = 1./_binw;
+  const double xlo = _xlo;
+  const int lastBin = _nbins - 1;
 
   for(std::size_t i = 0; i < n; ++i) {
-    bins[i] += coef * (x[i] >= _xhi ? _nbins - 1 : std::max(0, int((x[i] - _xlo)*oneOverW)));
+    const int bin = static_cast<int>((std::min(std::max(x[i], xlo), _xhi) - xlo) * oneOverW);
+    bins[i] += coef * std::min(bin, lastBin);
   }
 }
 
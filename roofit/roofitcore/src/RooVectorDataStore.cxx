@@ -29,6 +29,11 @@ the requested column into the bound real.
 
 As a faster alternative to loading values one-by-one, one can use the function getBatches(),
 which returns spans pointing directly to the data.
+
+On Linux, the data columns can be moved to read-only shared memory with moveToSharedMemory(),
+which is done before the RooFit::MultiProcess workers are forked. Like this, the workers read
+the data of the parent process without any copy, and the pages of the data are only counted
+once in the memory usage. Modifying the store moves the data back to private memory first.
 **/
 
 #include "RooVectorDataStore.h"
@@ -40,6 +45,7 @@ which returns spans pointing directly to the data.
 #include "RooCategory.h"
 #include "RooHistError.h"
 #include "RooTrace.h"
+#include "TTree.h"
 #include "RooHelpers.h"
 
 #include "Math/Util.h"
@@ -47,11 +53,72 @@ which returns spans pointing directly to the data.
 #include "TBuffer.h"
 
 #include <iomanip>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 
 ClassImp(RooVectorDataStore);
 ClassImp(RooVectorDataStore::RealVector);
 
+namespace {
+
+#ifdef __linux__
+
+/// Replace the memory pages that are fully contained in the `nBytes` starting at `data` by a new mapping with the
+/// same content, which is created with the given mmap flags and memory protection. The bytes at the edges of the
+/// buffer, which share their page with other heap allocations, are not touched.
+void remapInteriorPages(void *data, std::size_t nBytes, int flags, int prot)
+{
+   static const std::uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+   const auto begin = reinterpret_cast<std::uintptr_t>(data);
+   const std::uintptr_t first = (begin + pageSize - 1) / pageSize * pageSize;
+   const std::uintptr_t last = (begin + nBytes) / pageSize * pageSize;
+   if (nBytes == 0 || last <= first)
+      return;
+
+   void *pages = reinterpret_cast<void *>(first);
+   const std::size_t len = last - first;
+   void *segment = mmap(nullptr, len, PROT_READ | PROT_WRITE, flags | MAP_ANONYMOUS, -1, 0);
+   if (segment == MAP_FAILED)
+      return;
+   std::memcpy(segment, pages, len);
+   if (mprotect(segment, len, prot) != 0 ||
+       mremap(segment, len, len, MREMAP_MAYMOVE | MREMAP_FIXED, pages) == MAP_FAILED) {
+      munmap(segment, len);
+   }
+}
+
+#endif
+
+template <class Vector_t>
+void moveVectorToSharedMemory(Vector_t &vec)
+{
+#ifdef __linux__
+   remapInteriorPages(vec.data(), vec.size() * sizeof(typename Vector_t::value_type), MAP_SHARED, PROT_READ);
+#else
+   (void)vec;
+#endif
+}
+
+template <class Vector_t>
+void moveVectorToPrivateMemory(Vector_t &vec)
+{
+#ifdef __linux__
+   remapInteriorPages(vec.data(), vec.size() * sizeof(typename Vector_t::value_type), MAP_PRIVATE,
+                      PROT_READ | PROT_WRITE);
+#else
+   (void)vec;
+#endif
+}
+
+} // namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -302,6 +369,8 @@ RooVectorDataStore::RooVectorDataStore(RooStringView name, RooStringView title,
 
 RooVectorDataStore::~RooVectorDataStore()
 {
+  releaseSharedMemory();
+
   for (auto elm : _realStoreList) {
     delete elm;
   }
@@ -324,6 +393,8 @@ RooVectorDataStore::~RooVectorDataStore()
 
 Int_t RooVectorDataStore::fill()
 {
+  releaseSharedMemory();
+
   for (auto realVec : _realStoreList) {
     realVec->fill() ;
   }
@@ -625,6 +696,8 @@ RooAbsArg* RooVectorDataStore::addColumn(RooAbsArg& newVar, bool /*adjustRange*/
     return 0;
   }
 
+  releaseSharedMemory();
+
   // Attention: need to do this now, as adding an empty column might give 0 as size
   const std::size_t numEvt = size();
 
@@ -698,6 +771,8 @@ RooAbsDataStore* RooVectorDataStore::merge(const RooArgSet& allVars, list<RooAbs
 
 void RooVectorDataStore::reserve(Int_t nEvts)
 {
+  releaseSharedMemory();
+
   for (auto elm : _realStoreList) {
     elm->reserve(nEvts);
   }
@@ -711,6 +786,98 @@ void RooVectorDataStore::reserve(Int_t nEvts)
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Load the entries of a TTree that are within the ranges of the variables and
+/// pass the optional selection, like RooTreeDataStore::loadValues(). The values
+/// are read directly into the columns, which are allocated once for all the
+/// entries of the tree.
+
+void RooVectorDataStore::loadValues(const TTree *t, const RooFormulaVar* select)
+{
+  // Our local copy of the tree, such that the branch addresses of the original are not changed.
+  // It needs to be deregistered from the directory of the original, which would tear it down
+  // at destruction time.
+  auto deleter = [](TTree* tree){tree->SetDirectory(nullptr); delete tree;};
+  std::unique_ptr<TTree, decltype(deleter)> tClone(static_cast<TTree*>(t->Clone()), deleter);
+  tClone->SetDirectory(t->GetDirectory());
+
+  std::unique_ptr<RooArgSet> sourceArgSet( _varsww.snapshot(false) );
+
+  bool missingBranches = false;
+  for (const auto var : *sourceArgSet) {
+    if (!tClone->GetBranch(var->GetName())) {
+      missingBranches = true;
+      coutE(InputArguments) << "Didn't find a branch in Tree '" << tClone->GetName() << "' to read variable '"
+                            << var->GetName() << "' from."
+                            << "\n\tNote: Name the RooFit variable the same as the branch." << std::endl;
+    }
+  }
+  if (missingBranches) {
+    coutE(InputArguments) << "Cannot import data from TTree '" << tClone->GetName()
+                          << "' because some branches are missing !" << std::endl;
+    return;
+  }
+
+  for (const auto sourceArg : *sourceArgSet) {
+    sourceArg->attachToTree(*tClone) ;
+  }
+
+  std::unique_ptr<RooFormulaVar> selectClone;
+  if (select) {
+    selectClone.reset( static_cast<RooFormulaVar*>(select->cloneTree()) );
+    selectClone->recursiveRedirectServers(*sourceArgSet) ;
+    selectClone->setOperMode(RooAbsArg::ADirty,true) ;
+  }
+
+  const Long64_t nevent = tClone->GetEntries();
+  reserve(numEntries() + nevent);
+
+  Int_t numInvalid(0) ;
+  for(Long64_t i=0; i < nevent; ++i) {
+    const auto entryNumber = tClone->GetEntryNumber(i);
+    if (entryNumber<0) break;
+    tClone->GetEntry(entryNumber,1);
+
+    bool allOK(true) ;
+    for (unsigned int j=0; j < sourceArgSet->size(); ++j) {
+      auto destArg = _varsww[j];
+      const auto sourceArg = (*sourceArgSet)[j];
+
+      destArg->copyCache(sourceArg) ;
+      sourceArg->copyCache(destArg) ;
+      if (!destArg->isValid()) {
+        numInvalid++ ;
+        allOK=false ;
+        if (numInvalid < 5) {
+          auto& log = coutI(DataHandling);
+          log << "RooVectorDataStore::loadValues(" << GetName() << ") Skipping event #" << i << " because " << destArg->GetName()
+              << " cannot accommodate the value ";
+          if(sourceArg->isCategory()) {
+            log << static_cast<RooAbsCategory*>(sourceArg)->getCurrentIndex();
+          } else {
+            log << static_cast<RooAbsReal*>(sourceArg)->getVal();
+          }
+          log << std::endl;
+        } else if (numInvalid == 5) {
+          coutI(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Skipping ..." << std::endl;
+        }
+        break ;
+      }
+    }
+
+    if (!allOK || (selectClone && selectClone->getVal()==0)) {
+      continue ;
+    }
+
+    fill() ;
+  }
+
+  if (numInvalid>0) {
+    coutW(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Ignored " << numInvalid << " out-of-range events" << std::endl ;
+  }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void RooVectorDataStore::append(RooAbsDataStore& other)
@@ -733,6 +900,8 @@ void RooVectorDataStore::append(RooAbsDataStore& other)
 
 void RooVectorDataStore::reset()
 {
+  releaseSharedMemory();
+
   _sumWeight=_sumWeightCarry=0 ;
 
   for (auto elm : _realStoreList) {
@@ -1106,6 +1275,60 @@ void RooVectorDataStore::dump()
 }
 
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move the values of the data columns to read-only shared memory, without
+/// changing their addresses. The processes that are forked afterwards, like the
+/// RooFit::MultiProcess workers, map the same physical pages as this process
+/// instead of getting a copy-on-write copy of them. The store must not be
+/// modified while the data is shared: all functions that change the data
+/// columns call releaseSharedMemory() first. This is only implemented on Linux,
+/// on other platforms this function does nothing.
+
+void RooVectorDataStore::moveToSharedMemory()
+{
+  if (_isShared) return;
+
+  for (auto elm : _realStoreList) {
+    moveVectorToSharedMemory(elm->_vec);
+  }
+
+  for (auto elm : _realfStoreList) {
+    moveVectorToSharedMemory(elm->_vec);
+  }
+
+  for (auto elm : _catStoreList) {
+    moveVectorToSharedMemory(elm->_vec);
+  }
+
+  _isShared = true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move the values of the data columns back to private, writable memory after
+/// a call to moveToSharedMemory().
+
+void RooVectorDataStore::releaseSharedMemory()
+{
+  if (!_isShared) return;
+
+  for (auto elm : _realStoreList) {
+    moveVectorToPrivateMemory(elm->_vec);
+  }
+
+  for (auto elm : _realfStoreList) {
+    moveVectorToPrivateMemory(elm->_vec);
+  }
+
+  for (auto elm : _catStoreList) {
+    moveVectorToPrivateMemory(elm->_vec);
+  }
+
+  _isShared = false;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stream an object of class RooVectorDataStore.
 
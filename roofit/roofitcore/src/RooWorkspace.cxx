@@ -726,6 +726,46 @@ bool RooWorkspace::import(RooAbsData& inData,
   args.Add((TObject*)&arg8) ;
   args.Add((TObject*)&arg9) ;
 
+  return importData(inData, nullptr, args) ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+///  Import a dataset (RooDataSet or RooDataHist) into the work space, which takes ownership of it instead of
+///  making a copy. This avoids copying large datasets or histograms that are only built to be imported. The
+///  accepted arguments are the same as for import(RooAbsData&,...). If the import fails, the dataset is deleted.
+bool RooWorkspace::import(std::unique_ptr<RooAbsData> data,
+             const RooCmdArg& arg1, const RooCmdArg& arg2, const RooCmdArg& arg3,
+             const RooCmdArg& arg4, const RooCmdArg& arg5, const RooCmdArg& arg6,
+             const RooCmdArg& arg7, const RooCmdArg& arg8, const RooCmdArg& arg9)
+
+{
+  if (!data) {
+    coutE(InputArguments) << "RooWorkspace::import(" << GetName() << ") ERROR cannot import a null dataset" << endl ;
+    return true ;
+  }
+
+  RooLinkedList args ;
+  args.Add((TObject*)&arg1) ;
+  args.Add((TObject*)&arg2) ;
+  args.Add((TObject*)&arg3) ;
+  args.Add((TObject*)&arg4) ;
+  args.Add((TObject*)&arg5) ;
+  args.Add((TObject*)&arg6) ;
+  args.Add((TObject*)&arg7) ;
+  args.Add((TObject*)&arg8) ;
+  args.Add((TObject*)&arg9) ;
+
+  RooAbsData& inData = *data ;
+  return importData(inData, std::move(data), args) ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Implementation of the dataset imports. If `ownedData` is given, it is `inData`, which is imported without copy.
+
+bool RooWorkspace::importData(RooAbsData& inData, std::unique_ptr<RooAbsData> ownedData, const RooLinkedList& args)
+{
   // Select the pdf-specific commands
   RooCmdConfig pc(Form("RooWorkspace::import(%s)",GetName())) ;
 
@@ -777,9 +817,14 @@ bool RooWorkspace::import(RooAbsData& inData,
   if (dsetName) {
     if (!silence)
       coutI(ObjectHandling) << "RooWorkSpace::import(" << GetName() << ") changing name of dataset from  " << inData.GetName() << " to " << dsetName << endl ;
-    clone = (RooAbsData*) inData.Clone(dsetName) ;
+    if (ownedData) {
+      clone = ownedData.release() ;
+      clone->SetName(dsetName) ;
+    } else {
+      clone = (RooAbsData*) inData.Clone(dsetName) ;
+    }
   } else {
-    clone = (RooAbsData*) inData.Clone(inData.GetName()) ;
+    clone = ownedData ? ownedData.release() : (RooAbsData*) inData.Clone(inData.GetName()) ;
   }
 
 
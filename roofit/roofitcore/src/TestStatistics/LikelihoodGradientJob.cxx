@@ -33,6 +33,8 @@ LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood
    // should also somehow be updated in this class.
    N_tasks_ = N_dim;
    minuit_internal_x_.reserve(N_dim);
+   // the workers are forked later, when the JobManager is activated, so that they all map the same data pages
+   likelihood_->moveDataToSharedMemory();
 }
 
 LikelihoodGradientJob::LikelihoodGradientJob(const LikelihoodGradientJob &other)
@@ -25,17 +25,87 @@
 #include "RooFit/TestStatistics/RooSumL.h"
 #include "RooRealVar.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
 namespace RooFit {
 namespace TestStatistics {
 
+namespace {
+
+// With load balancing, the tasks are redistributed when the longest one takes this fraction more than the average
+constexpr double maxLoadImbalance = 0.1;
+
+std::vector<std::size_t> componentEntries(RooAbsL &likelihood)
+{
+   std::vector<std::size_t> n_entries;
+   if (auto sum = dynamic_cast<RooSumL *>(&likelihood)) {
+      for (auto const &component : sum->GetComponents()) {
+         n_entries.push_back(component->numDataEntries());
+      }
+   } else {
+      n_entries.push_back(likelihood.numDataEntries());
+   }
+   return n_entries;
+}
+
+/// Distribute the events of all components over at most `n_tasks` tasks, such that the estimated cost of each task is
+/// about the same. A task is a list of pieces, each a fractional event range of one component, and the boundaries of
+/// the pieces are placed between events. Tasks without any piece are dropped.
+std::vector<std::vector<LikelihoodJob::task_piece_t>>
+buildTaskPieces(std::vector<double> const &component_costs, std::vector<std::size_t> const &n_entries,
+                std::size_t n_tasks)
+{
+   std::vector<std::vector<LikelihoodJob::task_piece_t>> pieces(n_tasks);
+   const double target = std::accumulate(component_costs.begin(), component_costs.end(), 0.) / n_tasks;
+
+   std::size_t task = 0;
+   double task_cost = 0;
+   for (std::size_t comp = 0; comp < component_costs.size(); ++comp) {
+      const double cost = component_costs[comp];
+      const double n = std::max<std::size_t>(n_entries[comp], 1);
+      double begin = 0;
+      while (begin < 1) {
+         double end = 1;
+         if (task < n_tasks - 1 && task_cost + cost * (1 - begin) > target) {
+            end = std::min(std::round((begin + (target - task_cost) / cost) * n) / n, 1.);
+         }
+         if (end > begin) {
+            pieces[task].push_back({task, comp, begin, end});
+            task_cost += cost * (end - begin);
+            begin = end;
+         }
+         if (begin < 1) {
+            ++task;
+            task_cost = 0;
+         }
+      }
+   }
+
+   pieces.erase(std::remove_if(pieces.begin(), pieces.end(), [](auto const &p) { return p.empty(); }), pieces.end());
+   for (std::size_t ix = 0; ix < pieces.size(); ++ix) {
+      for (auto &piece : pieces[ix]) {
+         piece.task = ix;
+      }
+   }
+   return pieces;
+}
+
+} // namespace
+
 LikelihoodJob::LikelihoodJob(
    std::shared_ptr<RooAbsL> likelihood,
    std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean)
    : LikelihoodWrapper(std::move(likelihood), std::move(calculation_is_clean)),
+     load_balancing_(MultiProcess::Config::LikelihoodJob::defaultLoadBalancing),
      n_event_tasks_(MultiProcess::Config::LikelihoodJob::defaultNEventTasks),
      n_component_tasks_(MultiProcess::Config::LikelihoodJob::defaultNComponentTasks)
 {
    init_vars();
+   // the workers are forked later, when the JobManager is activated, so that they all map the same data pages
+   likelihood_->moveDataToSharedMemory();
    // determine likelihood type
    if (dynamic_cast<RooUnbinnedL *>(likelihood_.get()) != nullptr) {
       likelihood_type_ = LikelihoodType::unbinned;
@@ -104,6 +174,20 @@ void LikelihoodJob::update_state()
          LikelihoodWrapper::enableOffsetting(get_manager()->messenger().receive_from_master_on_worker<bool>());
          break;
       }
+      case update_state_mode::task_pieces: {
+         state_id_ = get_manager()->messenger().receive_from_master_on_worker<RooFit::MultiProcess::State>();
+         auto message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>();
+         auto message_begin = message.data<task_piece_t>();
+         auto message_end = message_begin + message.size() / sizeof(task_piece_t);
+         task_pieces_.clear();
+         for (auto piece = message_begin; piece != message_end; ++piece) {
+            if (piece->task >= task_pieces_.size()) {
+               task_pieces_.resize(piece->task + 1);
+            }
+            task_pieces_[piece->task].push_back(*piece);
+         }
+         break;
+      }
       }
    }
 }
@@ -177,14 +261,73 @@ void LikelihoodJob::updateWorkersOffsetting()
    get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::offsetting, isOffsetting());
 }
 
+/// Estimate the evaluation time of each component from the durations of the tasks in the last evaluation, and
+/// distribute the events over the tasks again if these durations are too unbalanced. Before the first evaluation, the
+/// cost of a component is assumed to be proportional to its number of entries. The new task pieces are published to
+/// the workers as a state update.
+void LikelihoodJob::updateTaskPieces()
+{
+   const std::vector<std::size_t> n_entries = componentEntries(*likelihood_);
+   if (component_costs_.empty()) {
+      for (std::size_t n : n_entries) {
+         component_costs_.push_back(std::max<std::size_t>(n, 1));
+      }
+   } else {
+      std::vector<double> costs(component_costs_.size(), 0.);
+      double total_duration = 0;
+      double max_duration = 0;
+      for (std::size_t task = 0; task < task_pieces_.size(); ++task) {
+         // share the duration of the task among its pieces according to their estimated cost
+         double estimate = 0;
+         for (auto const &piece : task_pieces_[task]) {
+            estimate += component_costs_[piece.component] * (piece.end_fraction - piece.begin_fraction);
+         }
+         for (auto const &piece : task_pieces_[task]) {
+            if (estimate > 0) {
+               costs[piece.component] += task_durations_[task] * component_costs_[piece.component] *
+                                         (piece.end_fraction - piece.begin_fraction) / estimate;
+            }
+         }
+         total_duration += task_durations_[task];
+         max_duration = std::max(max_duration, task_durations_[task]);
+      }
+      if (total_duration <= 0) {
+         return;
+      }
+      // a component that was measured to take no time could never get a cost again otherwise
+      for (double &cost : costs) {
+         cost = std::max(cost, 1e-6 * total_duration);
+      }
+      component_costs_ = costs;
+      if (max_duration <= (1 + maxLoadImbalance) * total_duration / task_pieces_.size()) {
+         return;
+      }
+   }
+
+   task_pieces_ = buildTaskPieces(component_costs_, n_entries, getNEventTasks() * getNComponentTasks());
+
+   std::vector<task_piece_t> to_update;
+   for (auto const &pieces : task_pieces_) {
+      to_update.insert(to_update.end(), pieces.begin(), pieces.end());
+   }
+   ++state_id_;
+   zmq::message_t message(to_update.begin(), to_update.end());
+   get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::task_pieces, state_id_,
+                                                             std::move(message));
+}
+
 void LikelihoodJob::evaluate()
 {
    if (get_manager()->process_manager().is_master()) {
       // update parameters that changed since last calculation (or creation if first time)
       updateWorkersParameters();
+      if (load_balancing_) {
+         updateTaskPieces();
+      }
 
       // master fills queue with tasks
-      auto N_tasks = getNEventTasks() * getNComponentTasks();
+      auto N_tasks = load_balancing_ ? task_pieces_.size() : getNEventTasks() * getNComponentTasks();
+      task_durations_.assign(N_tasks, 0.);
       for (std::size_t ix = 0; ix < N_tasks; ++ix) {
          get_manager()->queue().add({id_, state_id_, ix});
       }
@@ -204,9 +347,9 @@ void LikelihoodJob::evaluate()
 
 // --- RESULT LOGISTICS ---
 
-void LikelihoodJob::send_back_task_result_from_worker(std::size_t /*task*/)
+void LikelihoodJob::send_back_task_result_from_worker(std::size_t task)
 {
-   task_result_t task_result{id_, result_.Result(), result_.Carry()};
+   task_result_t task_result{id_, task, result_.Result(), result_.Carry(), task_duration_};
    zmq::message_t message(sizeof(task_result_t));
    memcpy(message.data(), &task_result, sizeof(task_result_t));
    get_manager()->messenger().send_from_worker_to_master(std::move(message));
@@ -216,6 +359,9 @@ bool LikelihoodJob::receive_task_result_on_master(const zmq::message_t &message)
 {
    auto task_result = message.data<task_result_t>();
    results_.emplace_back(task_result->value, task_result->carry);
+   if (task_result->task_id < task_durations_.size()) {
+      task_durations_[task_result->task_id] = task_result->duration;
+   }
    --n_tasks_at_workers_;
    bool job_completed = (n_tasks_at_workers_ == 0);
    return job_completed;
@@ -227,6 +373,18 @@ void LikelihoodJob::evaluate_task(std::size_t task)
 {
    assert(get_manager()->process_manager().is_worker());
 
+   auto start = std::chrono::steady_clock::now();
+   if (load_balancing_) {
+      evaluateTaskPieces(task);
+   } else {
+      evaluateTaskRanges(task);
+   }
+   task_duration_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// Evaluate the task-th combination of the fixed event and component ranges.
+void LikelihoodJob::evaluateTaskRanges(std::size_t task)
+{
    double section_first = 0;
    double section_last = 1;
    if (getNEventTasks() > 1) {
@@ -272,6 +430,17 @@ void LikelihoodJob::evaluate_task(std::size_t task)
    }
 }
 
+/// Evaluate the pieces of a task that were assigned by the load balancing, see updateTaskPieces().
+void LikelihoodJob::evaluateTaskPieces(std::size_t task)
+{
+   result_ = {};
+   for (auto const &piece : task_pieces_[task]) {
+      const bool is_sum = likelihood_type_ == LikelihoodType::sum;
+      result_ += likelihood_->evaluatePartition({piece.begin_fraction, piece.end_fraction},
+                                                is_sum ? piece.component : 0, is_sum ? piece.component + 1 : 0);
+   }
+}
+
 void LikelihoodJob::enableOffsetting(bool flag)
 {
    LikelihoodWrapper::enableOffsetting(flag);
@@ -287,6 +456,7 @@ std::ostream &operator<<(std::ostream &out, const LikelihoodJob::update_state_mo
    switch (value) {
       PROCESS_VAL(LikelihoodJob::update_state_mode::offsetting);
       PROCESS_VAL(LikelihoodJob::update_state_mode::parameters);
+      PROCESS_VAL(LikelihoodJob::update_state_mode::task_pieces);
    default: s = std::to_string(static_cast<int>(value));
    }
    return out << s;
@@ -38,6 +38,7 @@ public:
 
    void updateWorkersParameters(); // helper for evaluate
    void updateWorkersOffsetting(); // helper for enableOffsetting
+   void updateTaskPieces();        // helper for evaluate, when load balancing is enabled
 
    // Job overrides:
    void evaluate_task(std::size_t task) override;
@@ -48,13 +49,23 @@ public:
       double value;
       bool is_constant;
    };
-   enum class update_state_mode : int { parameters, offsetting };
+   enum class update_state_mode : int { parameters, offsetting, task_pieces };
+
+   /// With load balancing, a task evaluates a list of pieces, each a fractional event range of one component.
+   struct task_piece_t {
+      std::size_t task;
+      std::size_t component;
+      double begin_fraction;
+      double end_fraction;
+   };
 
    // --- RESULT LOGISTICS ---
    struct task_result_t {
       std::size_t job_id; // job ID must always be the first part of any result message/type
+      std::size_t task_id;
       double value;
       double carry;
+      double duration; // wall time of evaluate_task on the worker, in seconds
    };
 
    void send_back_task_result_from_worker(std::size_t task) override;
@@ -62,6 +73,9 @@ public:
 
    void enableOffsetting(bool flag) override;
 
+   /// The durations in seconds of the tasks of the last evaluation, measured on the workers.
+   const std::vector<double> &getTaskDurations() const { return task_durations_; }
+
 private:
    ROOT::Math::KahanSum<double> result_;
    std::vector<ROOT::Math::KahanSum<double>> results_;
@@ -71,12 +85,22 @@ private:
 
    LikelihoodType likelihood_type_;
    std::size_t n_tasks_at_workers_ = 0;
+   double task_duration_ = 0; // on the worker, the duration of the last evaluated task
+
+   bool load_balancing_;
+   std::vector<std::vector<task_piece_t>> task_pieces_; // with load balancing, the pieces of each task
+   std::vector<double> component_costs_; // on the master, the estimated evaluation time of each component
+   std::vector<double> task_durations_;
 
    // warning: don't use the following values directly, use the getters instead!
    std::size_t n_event_tasks_;
    std::size_t n_component_tasks_;
    std::size_t getNEventTasks();
    std::size_t getNComponentTasks();
+
+   // helpers for evaluate_task
+   void evaluateTaskRanges(std::size_t task);
+   void evaluateTaskPieces(std::size_t task);
 };
 
 std::ostream &operator<<(std::ostream &out, const LikelihoodJob::update_state_mode value);
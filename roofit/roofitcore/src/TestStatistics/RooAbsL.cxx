@@ -13,6 +13,7 @@
 #include <RooFit/TestStatistics/RooAbsL.h>
 #include "ConstantTermsOptimizer.h"
 #include "RooAbsData.h"
+#include "RooVectorDataStore.h"
 
 // for dynamic casts in init_clones:
 #include "RooAbsRealLValue.h"
@@ -232,6 +233,15 @@ void RooAbsL::constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doA
    }
 }
 
+void RooAbsL::moveDataToSharedMemory()
+{
+   if (!data_)
+      return;
+   if (auto vectorStore = dynamic_cast<RooVectorDataStore *>(data_->store())) {
+      vectorStore->moveToSharedMemory();
+   }
+}
+
 std::string RooAbsL::GetName() const
 {
    std::string output("likelihood of pdf ");
@@ -117,5 +117,12 @@ void RooSumL::constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doA
    }
 }
 
+void RooSumL::moveDataToSharedMemory()
+{
+   for (auto &component : components_) {
+      component->moveDataToSharedMemory();
+   }
+}
+
 } // namespace TestStatistics
 } // namespace RooFit
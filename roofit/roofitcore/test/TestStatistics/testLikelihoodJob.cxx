@@ -28,6 +28,7 @@
 
 #include "Math/Util.h" // KahanSum
 
+#include <cmath>     // std::abs
 #include <stdexcept> // runtime_error
 
 #include "gtest/gtest.h"
@@ -475,6 +476,31 @@ TEST_F(LikelihoodJobTest, BatchedUnbinnedGaussianND)
    EXPECT_NEAR(nll0, nll1, 1e-14 * nll0);
 }
 
+TEST_F(LikelihoodJobSimBinnedConstrainedTest, LoadBalancing)
+{
+   nll.reset(pdf->createNLL(*data, RooFit::Constrain(RooArgSet(*w.var("alpha_bkg_obs_A"))),
+                            RooFit::GlobalObservables(RooArgSet(*w.var("alpha_bkg_obs_B")))));
+
+   likelihood = RooFit::TestStatistics::buildLikelihood(
+      pdf, data, RooFit::TestStatistics::ConstrainedParameters(RooArgSet(*w.var("alpha_bkg_obs_A"))),
+      RooFit::TestStatistics::GlobalObservables(RooArgSet(*w.var("alpha_bkg_obs_B"))));
+
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultLoadBalancing = true;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNEventTasks = 5;
+   auto nll_ts = LikelihoodWrapper::create(RooFit::TestStatistics::LikelihoodMode::multiprocess, likelihood, clean_flags);
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultLoadBalancing = false;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNEventTasks =
+      RooFit::MultiProcess::Config::LikelihoodJob::automaticNEventTasks;
+
+   // the tasks may be redistributed between the evaluations, which must not change the result
+   auto &mu_sig = *w.var("mu_sig");
+   for (double mu : {1.0, 1.5, 0.5, 1.2}) {
+      mu_sig.setVal(mu);
+      nll_ts->evaluate();
+      EXPECT_NEAR(nll->getVal(), nll_ts->getResult(), 1e-12 * std::abs(nll->getVal()));
+   }
+}
+
 class LikelihoodJobSplitStrategies : public LikelihoodJobSimBinnedConstrainedTest, public testing::WithParamInterface<std::tuple<std::size_t, std::size_t>> {};
 
 TEST_P(LikelihoodJobSplitStrategies, SimBinnedConstrainedAndOffset)
@@ -142,3 +142,39 @@ TEST(RooArgSet, HashAssistedFind) {
   EXPECT_EQ(list.find("a"), nullptr);
   EXPECT_EQ(list.find("a'"), & list[0]);
 }
+
+// The large collections use the hash map and the linear-time set operations
+TEST(RooArgSet, LargeCollections) {
+  RooArgList vars;
+  for (int i = 0; i < 300; ++i) {
+    std::string name = "x" + std::to_string(i);
+    vars.addOwned(*(new RooRealVar(name.c_str(), name.c_str(), 0.)));
+  }
+  RooArgSet set{vars};
+  RooArgList reversed;
+  for (int i = vars.size() - 1; i >= 0; --i) reversed.add(vars[i]);
+
+  EXPECT_TRUE(set.equals(reversed));
+  EXPECT_TRUE(set.overlaps(reversed));
+  RooArgSet common;
+  set.selectCommon(reversed, common);
+  EXPECT_EQ(common.size(), vars.size());
+
+  // the renamed elements are found under their new name
+  vars[10].SetName("renamed");
+  EXPECT_EQ(set.find("x10"), nullptr);
+  EXPECT_EQ(set.find("renamed"), &vars[10]);
+
+  // renaming to the name of another element makes the list find the first one
+  EXPECT_EQ(vars.find("x20"), &vars[20]);
+  vars[20].SetName("x5");
+  EXPECT_EQ(vars.find("x5"), &vars[5]);
+  EXPECT_EQ(vars.find("x20"), nullptr);
+
+  RooArgList toRemove;
+  for (int i = 0; i < 200; ++i) toRemove.add(vars[i]);
+  set.remove(toRemove);
+  EXPECT_EQ(set.size(), vars.size() - 200);
+  EXPECT_EQ(set.find("x100"), nullptr);
+  EXPECT_EQ(set.find("x250"), &vars[250]);
+}
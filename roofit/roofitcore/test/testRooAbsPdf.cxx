@@ -8,15 +8,18 @@
 #include <RooConstVar.h>
 #include <RooDataHist.h>
 #include <RooDataSet.h>
+#include <RooExponential.h>
 #include <RooFitResult.h>
 #include <RooFormulaVar.h>
 #include <RooGaussian.h>
 #include <RooGenericPdf.h>
 #include <RooHelpers.h>
+#include <RooNumGenConfig.h>
 #include <RooPoisson.h>
 #include <RooPolynomial.h>
 #include <RooProdPdf.h>
 #include <RooProduct.h>
+#include <RooRandom.h>
 #include <RooRealVar.h>
 #include <RooSimultaneous.h>
 #include <RooUniform.h>
@@ -26,7 +29,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <string>
+#include <vector>
 
 
 // ROOT-10668: Asympt. correct errors don't work when title and name differ
@@ -347,3 +354,141 @@ TEST(RooAbsPdf, NormSetChange)
    // value, so val2 should be different from val1. }
    EXPECT_NE(v1, v2);
 }
+
+// Verifies that the gradient of a likelihood computed by the RooFitDriver in
+// the CPU batch mode is consistent with finite differences of the likelihood,
+// and that a fit that uses it converges to the same result.
+TEST(RooAbsPdf, AnalyticalGradientBatchMode)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0, 10);
+   RooRealVar mean("mean", "mean", 5.0, 0.0, 10.0);
+   RooRealVar sigma("sigma", "sigma", 1.0, 0.1, 5.0);
+   RooRealVar c("c", "c", -0.3, -2.0, 0.0);
+   RooRealVar nsig("nsig", "nsig", 500, 0, 5000);
+   RooRealVar nbkg("nbkg", "nbkg", 1000, 0, 5000);
+   RooGaussian gauss("gauss", "gauss", x, mean, sigma);
+   RooExponential expo("expo", "expo", x, c);
+   RooAddPdf model("model", "model", {gauss, expo}, {nsig, nbkg});
+
+   std::unique_ptr<RooDataSet> data{model.generate(x)};
+
+   mean.setVal(4.8);
+   sigma.setVal(1.2);
+   c.setVal(-0.25);
+
+   std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, BatchMode("cpu"))};
+   ASSERT_TRUE(nll->hasGradient());
+
+   RooArgList params{mean, sigma, c, nsig, nbkg};
+   std::vector<double> grad(params.size());
+   nll->gradient(params, grad.data());
+
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      auto &param = static_cast<RooRealVar &>(params[i]);
+      const double val = param.getVal();
+      const double step = 1e-5 * std::max(1.0, std::abs(val));
+      param.setVal(val + step);
+      const double up = nll->getVal();
+      param.setVal(val - step);
+      const double down = nll->getVal();
+      param.setVal(val);
+      const double numerical = (up - down) / (2 * step);
+      EXPECT_NEAR(grad[i], numerical, 1e-4 * std::max(1.0, std::abs(numerical))) << param.GetName();
+   }
+
+   std::vector<std::unique_ptr<RooFitResult>> fitResults;
+   for (bool useGradient : {false, true}) {
+      mean.setVal(4.8);
+      sigma.setVal(1.2);
+      c.setVal(-0.25);
+      nsig.setVal(500);
+      nbkg.setVal(1000);
+      fitResults.emplace_back(
+         model.fitTo(*data, BatchMode("cpu"), AnalyticalGradient(useGradient), Save(), PrintLevel(-1)));
+   }
+
+   EXPECT_EQ(fitResults[1]->status(), 0);
+   EXPECT_TRUE(fitResults[1]->isIdentical(*fitResults[0], 1e-3, 1e-2));
+}
+
+// Verifies that the likelihood evaluated with the function generated by the
+// code generation backend is the same as with the CPU batch mode, also after
+// changing the inlined value of a constant parameter.
+TEST(RooAbsPdf, CodeGenerationBatchMode)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0, 10);
+   RooRealVar mean("mean", "mean", 5.0, 0.0, 10.0);
+   RooRealVar sigma("sigma", "sigma", 1.0, 0.1, 5.0);
+   RooRealVar c("c", "c", -0.3, -2.0, 0.0);
+   RooRealVar nsig("nsig", "nsig", 500, 0, 5000);
+   RooRealVar nbkg("nbkg", "nbkg", 1000, 0, 5000);
+   RooGaussian gauss("gauss", "gauss", x, mean, sigma);
+   RooExponential expo("expo", "expo", x, c);
+   RooAddPdf model("model", "model", {gauss, expo}, {nsig, nbkg});
+
+   std::unique_ptr<RooDataSet> data{model.generate(x)};
+
+   c.setConstant(true);
+
+   std::unique_ptr<RooAbsReal> nllCpu{model.createNLL(*data, BatchMode("cpu"))};
+   std::unique_ptr<RooAbsReal> nllCodegen{model.createNLL(*data, BatchMode("codegen"))};
+
+   EXPECT_NEAR(nllCodegen->getVal(), nllCpu->getVal(), 1e-8 * std::abs(nllCpu->getVal()));
+
+   mean.setVal(4.8);
+   sigma.setVal(1.2);
+   nsig.setVal(600);
+   EXPECT_NEAR(nllCodegen->getVal(), nllCpu->getVal(), 1e-8 * std::abs(nllCpu->getVal()));
+
+   // The value of the constant parameter is inlined in the generated code
+   c.setVal(-0.25);
+   EXPECT_NEAR(nllCodegen->getVal(), nllCpu->getVal(), 1e-8 * std::abs(nllCpu->getVal()));
+
+   // The fits give the same result
+   std::vector<std::unique_ptr<RooFitResult>> fitResults;
+   for (std::string batchMode : {"cpu", "codegen"}) {
+      mean.setVal(4.8);
+      sigma.setVal(1.2);
+      nsig.setVal(500);
+      nbkg.setVal(1000);
+      fitResults.emplace_back(model.fitTo(*data, BatchMode(batchMode), Save(), PrintLevel(-1)));
+   }
+   EXPECT_EQ(fitResults[1]->status(), 0);
+   EXPECT_TRUE(fitResults[1]->isIdentical(*fitResults[0], 1e-4, 1e-3));
+}
+
+// Accept-reject sampling with the trial samples evaluated in batches gives the same events as
+// the evaluation of one trial sample after the other.
+TEST(RooAbsPdf, AcceptRejectBatchEvaluation)
+{
+   RooRealVar x("x", "x", 0, -5, 5);
+   RooRealVar y("y", "y", 0, -5, 5);
+   RooGenericPdf pdf("pdf", "exp(-0.5*(x*x + y*y + x*y))", {x, y});
+
+   auto generate = [&](double batchSize) {
+      RooNumGenConfig config{RooNumGenConfig::defaultConfig()};
+      config.method2D(false, false).setLabel("RooAcceptReject");
+      config.getConfigSection("RooAcceptReject").setRealValue("batchSize", batchSize);
+      pdf.setGeneratorConfig(config);
+      RooRandom::randomGenerator()->SetSeed(1337);
+      return std::unique_ptr<RooDataSet>{pdf.generate({x, y}, 1000)};
+   };
+
+   std::unique_ptr<RooDataSet> data{generate(0)};
+   std::unique_ptr<RooDataSet> dataBatched{generate(5000)};
+   pdf.setGeneratorConfig();
+
+   ASSERT_EQ(data->numEntries(), dataBatched->numEntries());
+   for (int i = 0; i < data->numEntries(); ++i) {
+      EXPECT_DOUBLE_EQ(data->get(i)->getRealValue("x"), dataBatched->get(i)->getRealValue("x"));
+      EXPECT_DOUBLE_EQ(data->get(i)->getRealValue("y"), dataBatched->get(i)->getRealValue("y"));
+   }
+}
@@ -677,6 +677,45 @@ TEST(RooDataHist, CombinedRooDataHistBinning)
 }
 
 
+// The batched evaluation of two dimensional RooHistPdfs and RooHistFuncs
+// without interpolation, with a uniform and a non-uniform binning.
+TEST(RooDataHist, VectorizedWeights2D)
+{
+  RooHelpers::LocalChangeMsgLevel chmsglvl1{RooFit::WARNING, 0u, RooFit::DataHandling, true};
+  RooHelpers::LocalChangeMsgLevel chmsglvl2{RooFit::WARNING, 0u, RooFit::Fitting, true};
+
+  std::vector<double> yBoundaries{-1., -0.5, -0.2, 0., 0.1, 0.3, 0.7, 1.};
+  TH2D h2("h2", "h2", 20, -1., 1., yBoundaries.size() - 1, yBoundaries.data());
+  for (int i = 0; i < 10000; ++i) {
+    h2.Fill(RooRandom::gaussian() * 0.5, RooRandom::gaussian() * 0.5);
+  }
+
+  RooRealVar x("x", "x", 0, -1, 1);
+  RooRealVar y("y", "y", 0, -1, 1);
+  RooDataHist dh{"dh", "dh", {x, y}, &h2};
+
+  RooHistPdf histPdf("histPdf", "histPdf", {x, y}, dh);
+  RooHistFunc histFunc("histFunc", "histFunc", {x, y}, dh);
+
+  std::size_t nVals = 10000;
+  RooDataSet data{"data", "data", {x, y}};
+  for (std::size_t i = 0; i < nVals; ++i) {
+    x.setVal(-1. + 2. * RooRandom::uniform());
+    y.setVal(-1. + 2. * RooRandom::uniform());
+    data.add({x, y});
+  }
+
+  for (RooAbsReal *absReal : std::initializer_list<RooAbsReal *>{&histPdf, &histFunc}) {
+    auto weightsGetValues = absReal->getValues(data);
+    for (std::size_t i = 0; i < nVals; ++i) {
+      data.get(i);
+      x.setVal(data.get()->getRealValue("x"));
+      y.setVal(data.get()->getRealValue("y"));
+      EXPECT_NEAR(absReal->getVal({x, y}), weightsGetValues[i], 1e-6) << absReal->GetName();
+    }
+  }
+}
+
 
 class WeightsTest : public testing::TestWithParam<std::tuple<int, bool, bool, bool>> {
    void SetUp() override
@@ -9,6 +9,7 @@
 #include <RooHelpers.h>
 #include <RooCategory.h>
 #include <RooWorkspace.h>
+#include <RooVectorDataStore.h>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -308,3 +309,80 @@ TEST(RooDataSet, ReduceWithCompositeDataStore)
    EXPECT_EQ(dataSetWeighted.weight(), dataSetComposite.weight());
    EXPECT_EQ(dataSetComposite.weight(), dataSetReduced.weight());
 }
+
+// The data columns have to stay the same when they are moved to shared memory
+// for the MultiProcess workers, and the dataset must remain modifiable.
+TEST(RooDataSet, MoveToSharedMemory)
+{
+   RooRealVar x("x", "x", 0, 0, 100000);
+   RooCategory cat("cat", "cat", {{"a", 0}, {"b", 1}});
+
+   const std::size_t nEvents = 100000;
+   RooDataSet data("data", "data", {x, cat});
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      x.setVal(i);
+      cat.setIndex(i % 2);
+      data.add({x, cat});
+   }
+
+   auto &store = static_cast<RooVectorDataStore &>(*data.store());
+   store.moveToSharedMemory();
+   EXPECT_TRUE(store.isInSharedMemory());
+
+   auto checkValues = [&](std::size_t n) {
+      ASSERT_EQ(static_cast<std::size_t>(data.numEntries()), n);
+      auto xValues = data.getBatches(0, n).begin()->second;
+      for (std::size_t i = 0; i < n; ++i) {
+         ASSERT_EQ(xValues[i], i);
+         ASSERT_EQ(static_cast<RooCategory const &>((*data.get(i))["cat"]).getCurrentIndex(), int(i % 2));
+      }
+   };
+   checkValues(nEvents);
+
+   // Adding an event moves the data back to private memory
+   x.setVal(nEvents);
+   cat.setIndex(nEvents % 2);
+   data.add({x, cat});
+   EXPECT_FALSE(store.isInSharedMemory());
+   checkValues(nEvents + 1);
+}
+
+// The batches of a dataset with a tree store, which are read from the tree on
+// demand, have to match the ones of the vector store.
+TEST(RooDataSet, TreeStoreBatches)
+{
+   RooRealVar x("x", "x", 0, 0, 1000);
+   RooCategory cat("cat", "cat", {{"a", 0}, {"b", 1}});
+
+   const std::size_t nEvents = 1000;
+   RooDataSet data("data", "data", {x, cat});
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      x.setVal(i);
+      cat.setIndex(i % 2);
+      data.add({x, cat});
+   }
+   RooDataSet treeData{data, "treeData"};
+   treeData.convertToTreeStore();
+
+   auto checkBatches = [&](std::size_t first, std::size_t len) {
+      auto xValues = data.getBatches(first, len).begin()->second;
+      auto xTreeValues = treeData.getBatches(first, len).begin()->second;
+      auto catValues = data.getCategoryBatches(first, len).begin()->second;
+      auto catTreeValues = treeData.getCategoryBatches(first, len).begin()->second;
+      ASSERT_EQ(xTreeValues.size(), xValues.size());
+      ASSERT_EQ(catTreeValues.size(), catValues.size());
+      for (std::size_t i = 0; i < xValues.size(); ++i) {
+         EXPECT_EQ(xTreeValues[i], xValues[i]);
+         EXPECT_EQ(catTreeValues[i], catValues[i]);
+      }
+   };
+   checkBatches(0, nEvents);
+   checkBatches(100, 200);
+
+   // Adding an event invalidates the columns that were read from the tree
+   x.setVal(nEvents);
+   cat.setIndex(nEvents % 2);
+   data.add({x, cat});
+   treeData.add({x, cat});
+   checkBatches(0, nEvents + 1);
+}
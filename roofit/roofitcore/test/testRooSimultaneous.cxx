@@ -13,9 +13,13 @@
 #include <RooWorkspace.h>
 #include <RooThresholdCategory.h>
 
+#include <TROOT.h>
+
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /// GitHub issue #8307.
 /// A likelihood with a model wrapped in a RooSimultaneous in one category
@@ -191,3 +195,120 @@ TEST(RooSimultaneous, MultiRangeFitWithSplitRange)
    EXPECT_FLOAT_EQ(nllSimVal, nllSimRefVal);
    EXPECT_FLOAT_EQ(nllSimBatchVal, nllSimVal) << "BatchMode and old RooFit don't agree!";
 }
+
+/// In BatchMode, only the nodes that depend on a changed parameter are
+/// recomputed. The likelihood must be the same as the one of a new likelihood
+/// object created at the same parameter values.
+TEST(RooSimultaneous, IncrementalBatchModeEvaluation)
+{
+   using namespace RooFit;
+
+   RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+
+   RooWorkspace ws{"ws"};
+   ws.factory("Gaussian::pdf_a(x_a[0, 10], mu_a[4, 0, 10], sigma[1.0, 0.1, 10.0])");
+   ws.factory("Gaussian::pdf_b(x_b[0, 10], mu_b[6, 0, 10], sigma)");
+   ws.factory("SIMUL::simPdf(cat[a=0,b=1], a=pdf_a, b=pdf_b)");
+
+   RooAbsPdf &simPdf = *ws.pdf("simPdf");
+   std::unique_ptr<RooDataSet> data{simPdf.generate({*ws.var("x_a"), *ws.var("x_b"), *ws.cat("cat")}, 1000)};
+
+   std::unique_ptr<RooAbsReal> nll{simPdf.createNLL(*data, BatchMode("cpu"))};
+   nll->getVal();
+
+   auto checkAgainstNewNll = [&](const char *what) {
+      std::unique_ptr<RooAbsReal> newNll{simPdf.createNLL(*data, BatchMode("cpu"))};
+      EXPECT_DOUBLE_EQ(nll->getVal(), newNll->getVal()) << what;
+   };
+
+   ws.var("mu_a")->setVal(4.5);
+   checkAgainstNewNll("after changing a parameter of one channel");
+   ws.var("sigma")->setVal(1.2);
+   checkAgainstNewNll("after changing a shared parameter");
+   ws.var("mu_a")->setVal(4.0);
+   ws.var("mu_b")->setVal(5.5);
+   checkAgainstNewNll("after changing the parameters of both channels");
+}
+
+#ifdef R__USE_IMT
+/// The multi-threaded evaluation of the computation graph in BatchMode must give
+/// the same likelihood as the sequential one, also after changing parameters.
+TEST(RooSimultaneous, MultiThreadedBatchMode)
+{
+   using namespace RooFit;
+
+   RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+
+   constexpr int nChannels = 8;
+
+   RooWorkspace ws{"ws"};
+   ws.factory("sigma[1.0, 0.1, 10.0]");
+   RooCategory indexCat{"cat", "cat"};
+   RooSimultaneous simPdf{"simPdf", "", indexCat};
+   std::map<std::string, RooDataSet *> dsmap;
+   std::vector<std::unique_ptr<RooDataSet>> datasets;
+   RooArgSet observables;
+
+   for (int i = 0; i < nChannels; ++i) {
+      const std::string n = std::to_string(i);
+      ws.factory("Gaussian::gauss_" + n + "(x_" + n + "[0, 10], mu_" + n + "[5, 0, 10], sigma)");
+      ws.factory("Exponential::expo_" + n + "(x_" + n + ", c_" + n + "[-0.2, -1, 0])");
+      ws.factory("SUM::pdf_" + n + "(nsig_" + n + "[500, 0, 2000] * gauss_" + n + ", nbkg_" + n +
+                 "[500, 0, 2000] * expo_" + n + ")");
+      RooAbsPdf &pdf = *ws.pdf(("pdf_" + n).c_str());
+      RooRealVar &x = *ws.var(("x_" + n).c_str());
+      indexCat.defineType(("cat" + n).c_str());
+      simPdf.addPdf(pdf, ("cat" + n).c_str());
+      datasets.emplace_back(pdf.generate(x, 2000 + 100 * i));
+      dsmap["cat" + n] = datasets.back().get();
+      observables.add(x);
+   }
+
+   RooDataSet combData{"combData", "", observables, Index(indexCat), Import(dsmap)};
+
+   std::unique_ptr<RooAbsReal> nll{simPdf.createNLL(combData, BatchMode("cpu"))};
+   const double nllValSeq = nll->getVal();
+   ws.var("sigma")->setVal(1.5);
+   const double nllValSeqChanged = nll->getVal();
+   ws.var("sigma")->setVal(1.0);
+
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<RooAbsReal> nllMT{simPdf.createNLL(combData, BatchMode("cpu"))};
+   const double nllValMT = nllMT->getVal();
+   ws.var("sigma")->setVal(1.5);
+   const double nllValMTChanged = nllMT->getVal();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_DOUBLE_EQ(nllValMT, nllValSeq);
+   EXPECT_DOUBLE_EQ(nllValMTChanged, nllValSeqChanged);
+}
+#endif
+
+/// Channels with equivalent pdfs share their normalization integrals in
+/// BatchMode. The likelihood must still agree with the one of old RooFit,
+/// also after changing the shared parameters and the ones of a single channel.
+TEST(RooSimultaneous, SharedNormalizationIntegrals)
+{
+   using namespace RooFit;
+
+   RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+
+   RooWorkspace ws{"ws"};
+   ws.factory("x[0, 10]");
+   ws.factory("GenericPdf::pdf_a('exp(-0.5*(x - mu)*(x - mu)/(sigma*sigma))', {x, mu[5, 0, 10], sigma[1, 0.1, 10]})");
+   ws.factory("GenericPdf::pdf_b('exp(-0.5*(x - mu)*(x - mu)/(sigma*sigma))', {x, mu, sigma})");
+   ws.factory("GenericPdf::pdf_c('exp(-0.5*(x - mu_c)*(x - mu_c)/(sigma*sigma))', {x, mu_c[4, 0, 10], sigma})");
+   ws.factory("SIMUL::simPdf(cat[a=0,b=1,c=2], a=pdf_a, b=pdf_b, c=pdf_c)");
+
+   RooAbsPdf &simPdf = *ws.pdf("simPdf");
+   std::unique_ptr<RooDataSet> data{simPdf.generate({*ws.var("x"), *ws.cat("cat")}, 1000)};
+
+   std::unique_ptr<RooAbsReal> nll{simPdf.createNLL(*data, BatchMode("off"))};
+   std::unique_ptr<RooAbsReal> nllBatch{simPdf.createNLL(*data, BatchMode("cpu"))};
+
+   EXPECT_FLOAT_EQ(nllBatch->getVal(), nll->getVal());
+   ws.var("sigma")->setVal(1.5);
+   EXPECT_FLOAT_EQ(nllBatch->getVal(), nll->getVal()) << "after changing a shared parameter";
+   ws.var("mu_c")->setVal(6.0);
+   EXPECT_FLOAT_EQ(nllBatch->getVal(), nll->getVal()) << "after changing a parameter of one channel";
+}
@@ -5,6 +5,7 @@
 #include "RooHelpers.h"
 #include "RooGaussian.h"
 #include "RooArgList.h"
+#include "RooDataHist.h"
 #include "RooRealVar.h"
 #include "RooAbsReal.h"
 #include "RooProdPdf.h"
@@ -268,3 +269,28 @@ TEST(RooWorkspace, Issue_7809)
    ASSERT_EQ(static_cast<RooProdPdf*>(ws.pdf("p3"))->pdfList().size(), 2);
    ASSERT_EQ(static_cast<RooProduct*>(ws.function("p4"))->components().size(), 2);
 }
+
+/// Importing a dataset by moving it into the workspace takes ownership without copying it.
+TEST(RooWorkspace, ImportMovedData)
+{
+   RooWorkspace ws;
+   RooRealVar x("x", "x", 0., 10.);
+   x.setBins(10);
+
+   auto dataHist = std::make_unique<RooDataHist>("dataHist", "", x);
+   RooDataHist *dataHistPtr = dataHist.get();
+   ASSERT_FALSE(ws.import(std::move(dataHist), RooFit::Embedded()));
+   EXPECT_EQ(ws.embeddedData("dataHist"), dataHistPtr);
+
+   // a name conflict fails the import, and the dataset is deleted
+   {
+      RooHelpers::HijackMessageStream hijack(RooFit::ERROR, RooFit::ObjectHandling);
+      EXPECT_TRUE(ws.import(std::make_unique<RooDataHist>("dataHist", "", x), RooFit::Embedded()));
+      EXPECT_FALSE(hijack.str().empty());
+   }
+   EXPECT_EQ(ws.embeddedData("dataHist"), dataHistPtr);
+
+   ASSERT_FALSE(ws.import(std::make_unique<RooDataHist>("dataHist", "", x), RooFit::Rename("renamed")));
+   ASSERT_NE(ws.data("renamed"), nullptr);
+   EXPECT_NE(ws.var("x"), nullptr);
+}
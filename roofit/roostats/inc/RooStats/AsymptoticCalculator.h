@@ -13,8 +13,11 @@
 
 #include "RooStats/HypoTestCalculatorGeneric.h"
 #include "RooArgSet.h"
+#include "RooAbsReal.h"
 #include "Rtypes.h"
 
+#include <memory>
+
 class RooArgList;
 class RooCategory;
 class RooRealVar;
@@ -118,6 +121,12 @@ namespace RooStats {
 
       static double EvaluateNLL(RooAbsPdf & pdf, RooAbsData& data, const RooArgSet * condObs, const RooArgSet * globObs, const RooArgSet *poiSet = nullptr );
 
+      /// create the NLL used by EvaluateNLL, which can be minimized several times
+      static std::unique_ptr<RooAbsReal> CreateNLL(RooAbsPdf & pdf, RooAbsData& data, const RooArgSet * condObs, const RooArgSet * globObs);
+
+      /// minimize the NLL starting from the current parameter values, with the POI fixed if poiSet is given
+      static double EvaluateNLL(RooAbsReal & nll, const RooArgSet *poiSet = nullptr );
+
       static bool SetObsToExpected(RooAbsPdf &pdf, const RooArgSet &obs);
       static bool SetObsToExpected(RooProdPdf &prod, const RooArgSet &obs);
 
@@ -140,6 +149,11 @@ namespace RooStats {
       mutable RooArgSet  fBestFitPoi;     ///< snapshot of best fitted POI values
       mutable RooArgSet  fBestFitParams;  ///< snapshot of all best fitted Parameter values
 
+      // the NLLs are reused by the fits of all the tested points, which start from the parameters of the last point
+      mutable std::unique_ptr<RooAbsReal> fNLLObsFunc;    ///<! NLL of the observed data
+      mutable std::unique_ptr<RooAbsReal> fNLLAsimovFunc; ///<! NLL of the Asimov data
+      mutable RooArgSet  fCondFitParamsObs;    ///<! snapshot of the parameters of the last conditional fit to the data
+      mutable RooArgSet  fCondFitParamsAsimov; ///<! snapshot of the parameters of the last conditional fit to Asimov data
 
    };
 }
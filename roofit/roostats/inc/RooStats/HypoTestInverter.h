@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -146,6 +147,11 @@ public:
    /// set numerical error in test statistic evaluation (default is zero)
    void SetNumErr(double err) { fNumErr = err; }
 
+   /// Set the number of processes evaluating the points of RunFixedScan in parallel (default is 1, i.e. sequentially).
+   /// Each point is run with its own seed drawn from RooRandom::randomGenerator(), such that the result does not
+   /// depend on the number of processes. Not available on Windows.
+   void SetNumWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
@@ -163,6 +169,15 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   /// run the hypothesis test at a point, which is moved inside the range of the scanned variable
+   HypoTestResult * EvalPoint( double &rVal, bool adaptive, double clTarget ) const;
+
+   /// add the result of a point, merging it with the last point if they have the same value
+   void AddPointResult( double rVal, std::unique_ptr<HypoTestResult> result ) const;
+
+   /// run the points of a fixed scan in fNWorkers processes
+   bool RunParallelScan( const std::vector<double> &xValues ) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +214,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 1; ///<! number of processes running the points of a fixed scan
 
 protected:
 
@@ -80,6 +80,7 @@ class ToyMCSampler: public TestStatSampler {
       SamplingDistribution* GetSamplingDistribution(RooArgSet& paramPoint) override;
       virtual RooDataSet* GetSamplingDistributions(RooArgSet& paramPoint);
       virtual RooDataSet* GetSamplingDistributionsSingleWorker(RooArgSet& paramPoint);
+      virtual RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
 
       virtual SamplingDistribution* AppendSamplingDistribution(
          RooArgSet& allParameters,
@@ -226,6 +227,11 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Set the number of local processes generating the toys when no ProofConfig is given (default is 1).
+      /// Each process generates a batch of toys with its own seed drawn from RooRandom::randomGenerator().
+      /// Not available on Windows.
+      void SetNumWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -271,6 +277,7 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData; ///< in dev
 
       ProofConfig *fProofConfig;   ///<!
+      unsigned int fNWorkers = 1;  ///<! number of local processes generating the toys
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler; ///<!
 
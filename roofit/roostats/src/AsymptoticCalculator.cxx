@@ -184,11 +184,15 @@ bool AsymptoticCalculator::Initialize() const {
    fBestFitPoi.removeAll();
    fBestFitParams.removeAll();
    fAsimovGlobObs.removeAll();
+   fCondFitParamsObs.removeAll();
+   fCondFitParamsAsimov.removeAll();
+   fNLLAsimovFunc.reset();
 
    // evaluate the unconditional nll for the full model on the  observed data
    if (verbose >= 0)
       oocoutP(nullptr,Eval) << "AsymptoticCalculator::Initialize - Find  best unconditional NLL on observed data" << endl;
-   fNLLObs = EvaluateNLL( *nullPdf, data, GetNullModel()->GetConditionalObservables(),GetNullModel()->GetGlobalObservables());
+   fNLLObsFunc = CreateNLL( *nullPdf, data, GetNullModel()->GetConditionalObservables(),GetNullModel()->GetGlobalObservables());
+   fNLLObs = EvaluateNLL( *fNLLObsFunc );
    // fill also snapshot of best poi
    poi->snapshot(fBestFitPoi);
    RooRealVar * muBest = dynamic_cast<RooRealVar*>(fBestFitPoi.first());
@@ -270,7 +274,8 @@ bool AsymptoticCalculator::Initialize() const {
       oocoutP(nullptr,Eval) << "AsymptoticCalculator::Initialize Find  best conditional NLL on ASIMOV data set for given alt POI ( " <<
          muAlt->GetName() << " ) = " << muAlt->getVal() << std::endl;
 
-   fNLLAsimov =  EvaluateNLL( *nullPdf, *fAsimovData, GetNullModel()->GetConditionalObservables(), GetNullModel()->GetGlobalObservables(), &poiAlt );
+   fNLLAsimovFunc = CreateNLL( *nullPdf, *fAsimovData, GetNullModel()->GetConditionalObservables(), GetNullModel()->GetGlobalObservables() );
+   fNLLAsimov =  EvaluateNLL( *fNLLAsimovFunc, &poiAlt );
    // for unconditional fit
    //fNLLAsimov =  EvaluateNLL( *nullPdf, *fAsimovData);
    //poi->Print("v");
@@ -288,15 +293,20 @@ bool AsymptoticCalculator::Initialize() const {
 ////////////////////////////////////////////////////////////////////////////////
 
 double AsymptoticCalculator::EvaluateNLL(RooAbsPdf & pdf, RooAbsData& data,   const RooArgSet * condObs, const RooArgSet * globObs, const RooArgSet *poiSet) {
-    int verbose = fgPrintLevel;
+   std::unique_ptr<RooAbsReal> nll = CreateNLL(pdf, data, condObs, globObs);
+   return EvaluateNLL(*nll, poiSet);
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
+std::unique_ptr<RooAbsReal> AsymptoticCalculator::CreateNLL(RooAbsPdf & pdf, RooAbsData& data, const RooArgSet * condObs, const RooArgSet * globObs) {
+    int verbose = fgPrintLevel;
 
     RooFit::MsgLevel msglevel = RooMsgService::instance().globalKillBelow();
     if (verbose < 2) RooMsgService::instance().setGlobalKillBelow(RooFit::FATAL);
 
-
-    RooArgSet* allParams = pdf.getParameters(data);
-    RooStats::RemoveConstantParameters(allParams);
+    std::unique_ptr<RooArgSet> allParams{pdf.getParameters(data)};
+    RooStats::RemoveConstantParameters(allParams.get());
     // add constraint terms for all non-constant parameters
 
     RooArgSet conditionalObs;
@@ -306,10 +316,25 @@ double AsymptoticCalculator::EvaluateNLL(RooAbsPdf & pdf, RooAbsData& data,   co
 
     // need to call constrain for RooSimultaneous until stripDisconnected problem fixed
     auto& config = GetGlobalRooStatsConfig();
-    RooAbsReal* nll = pdf.createNLL(data, RooFit::CloneData(false),RooFit::Constrain(*allParams),RooFit::ConditionalObservables(conditionalObs), RooFit::GlobalObservables(globalObs),
-        RooFit::Offset(config.useLikelihoodOffset));
+    std::unique_ptr<RooAbsReal> nll{pdf.createNLL(data, RooFit::CloneData(false),RooFit::Constrain(*allParams),RooFit::ConditionalObservables(conditionalObs), RooFit::GlobalObservables(globalObs),
+        RooFit::Offset(config.useLikelihoodOffset))};
 
-    RooArgSet* attachedSet = nll->getVariables();
+    if (verbose < 2) RooMsgService::instance().setGlobalKillBelow(msglevel);
+
+    return nll;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double AsymptoticCalculator::EvaluateNLL(RooAbsReal & nll, const RooArgSet *poiSet) {
+    int verbose = fgPrintLevel;
+
+
+    RooFit::MsgLevel msglevel = RooMsgService::instance().globalKillBelow();
+    if (verbose < 2) RooMsgService::instance().setGlobalKillBelow(RooFit::FATAL);
+
+    auto& config = GetGlobalRooStatsConfig();
+    RooArgSet* attachedSet = nll.getVariables();
 
     // if poi are specified - do a conditional fit
     RooArgSet paramsSetConstant;
@@ -355,13 +380,13 @@ double AsymptoticCalculator::EvaluateNLL(RooAbsPdf & pdf, RooAbsData& data,   co
     bool skipFit = (nllParams.empty());
 
     if (skipFit)
-       val = nll->getVal(); // just evaluate nll in conditional fits with model without nuisance params
+       val = nll.getVal(); // just evaluate nll in conditional fits with model without nuisance params
     else {
 
 
        int minimPrintLevel = verbose;
 
-       RooMinimizer minim(*nll);
+       RooMinimizer minim(nll);
        int strategy = ROOT::Math::MinimizerOptions::DefaultStrategy();
        minim.setStrategy( strategy);
        minim.setEvalErrorWall(config.useEvalErrorWall);
@@ -420,7 +445,7 @@ double AsymptoticCalculator::EvaluateNLL(RooAbsPdf & pdf, RooAbsData& data,   co
           else {
              bool previous = RooAbsReal::hideOffset();
              RooAbsReal::setHideOffset(true) ;
-             val = nll->getVal();
+             val = nll.getVal();
              if (!previous)  RooAbsReal::setHideOffset(false) ;
           }
 
@@ -457,9 +482,6 @@ double AsymptoticCalculator::EvaluateNLL(RooAbsPdf & pdf, RooAbsData& data,   co
 
     if (verbose < 2) RooMsgService::instance().setGlobalKillBelow(msglevel);
 
-    delete allParams;
-    delete nll;
-
     return val;
 }
 
@@ -507,9 +529,12 @@ HypoTestResult* AsymptoticCalculator::GetHypoTest() const {
       oocoutW(nullptr,InputArguments) << "AsymptoticCalculator::GetHypoTest: snapshot has more than one POI - assume as POI first parameter " << std::endl;
    }
 
-   RooArgSet * allParams = nullPdf->getParameters(*GetData() );
+   std::unique_ptr<RooArgSet> allParams{nullPdf->getParameters(*GetData() )};
    allParams->assign(fBestFitParams);
-   delete allParams;
+   // start the conditional fit from the one of the previous point, which is close to it in a scan
+   allParams->assign(fCondFitParamsObs);
+   RooArgSet floatParams(*allParams);
+   RemoveConstantParameters(&floatParams);
 
    // set the one-side condition
    // (this works when we have only one params of interest
@@ -527,7 +552,11 @@ HypoTestResult* AsymptoticCalculator::GetHypoTest() const {
    }
 
    // evaluate the conditional NLL on the observed data for the snapshot value
-   double condNLL = EvaluateNLL( *nullPdf, const_cast<RooAbsData&>(*GetData()), GetNullModel()->GetConditionalObservables(), GetNullModel()->GetGlobalObservables(), &poiTest);
+   double condNLL = EvaluateNLL( *fNLLObsFunc, &poiTest);
+   if (!TMath::IsNaN(condNLL)) {
+      fCondFitParamsObs.removeAll();
+      floatParams.snapshot(fCondFitParamsObs);
+   }
 
    double qmu = 2.*(condNLL - fNLLObs);
 
@@ -549,7 +578,7 @@ HypoTestResult* AsymptoticCalculator::GetHypoTest() const {
                                            << std::endl;
 
 
-      double nll = EvaluateNLL( *nullPdf, const_cast<RooAbsData&>(*GetData()),GetNullModel()->GetConditionalObservables(),GetNullModel()->GetGlobalObservables());
+      double nll = EvaluateNLL( *fNLLObsFunc );
 
       if (nll < fNLLObs || (TMath::IsNaN(fNLLObs) && !TMath::IsNaN(nll) ) ) {
          oocoutW(nullptr,Minimization) << "AsymptoticCalculator:  Found a better unconditional minimum "
@@ -611,7 +640,12 @@ HypoTestResult* AsymptoticCalculator::GetHypoTest() const {
 
    if (verbose > 0) oocoutP(nullptr,Eval) << "AsymptoticCalculator::GetHypoTest -- Find  best conditional NLL on ASIMOV data set .... " << std::endl;
 
-   double condNLL_A = EvaluateNLL( *nullPdf, *fAsimovData, GetNullModel()->GetConditionalObservables(),  GetNullModel()->GetGlobalObservables(), &poiTest);
+   allParams->assign(fCondFitParamsAsimov);
+   double condNLL_A = EvaluateNLL( *fNLLAsimovFunc, &poiTest);
+   if (!TMath::IsNaN(condNLL_A)) {
+      fCondFitParamsAsimov.removeAll();
+      floatParams.snapshot(fCondFitParamsAsimov);
+   }
 
 
    double qmu_A = 2.*(condNLL_A - fNLLAsimov  );
@@ -629,7 +663,7 @@ HypoTestResult* AsymptoticCalculator::GetHypoTest() const {
                                            << std::endl;
 
 
-      double nll = EvaluateNLL( *nullPdf, *fAsimovData,  GetNullModel()->GetConditionalObservables(), GetNullModel()->GetGlobalObservables() );
+      double nll = EvaluateNLL( *fNLLAsimovFunc );
 
       if (nll < fNLLAsimov || (TMath::IsNaN(fNLLAsimov) && !TMath::IsNaN(nll) )) {
          oocoutW(nullptr,Minimization) << "AsymptoticCalculator:  Found a better unconditional minimum for Asimov data set"
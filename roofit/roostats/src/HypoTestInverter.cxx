@@ -64,8 +64,15 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 ClassImp(RooStats::HypoTestInverter);
@@ -406,6 +413,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -643,15 +651,18 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
+   std::vector<double> xValues(nBins, xMin);
+   for (int i=1; i<nBins; i++) { // avoids case of nBins = 1
+      if (scanLog)
+         xValues[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+      else
+         xValues[i] = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
+   }
 
-      if (i > 0) { // avoids case of nBins = 1
-         if (scanLog)
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
-         else
-            thisX = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
-      }
+   if (fNWorkers > 1 && nBins > 1)
+      return RunParallelScan(xValues);
+
+   for (double thisX : xValues) {
 
       const bool status = RunOnePoint(thisX);
 
@@ -664,6 +675,72 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the points of a fixed scan in parallel, in fNWorkers forked processes.
+/// The processes start from a copy of the state of this process, and the random generator is seeded
+/// for each point from RooRandom::randomGenerator(), such that the result does not depend on the
+/// number of processes. The results of the points are merged in the order of the scan.
+
+bool HypoTestInverter::RunParallelScan( const std::vector<double> &xValues ) const
+{
+#ifdef _MSC_VER
+   oocoutW(nullptr,InputArguments) << "HypoTestInverter::RunFixedScan - parallel scans are not supported on Windows,"
+                                   << " running the points sequentially" << std::endl;
+   for (double thisX : xValues) {
+      if (!RunOnePoint(thisX))
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX
+                               << " failed. Skipping." << std::endl;
+   }
+   return true;
+#else
+   const unsigned int nPoints = xValues.size();
+   std::vector<UInt_t> seeds(nPoints);
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   oocoutI(nullptr,Eval) << "HypoTestInverter::RunFixedScan - running " << nPoints << " points in "
+                         << std::min(fNWorkers, nPoints) << " processes" << std::endl;
+
+   // each process returns the point it ran as a result, which is empty if the point failed
+   auto runPoint = [&](unsigned int i) {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]);
+      auto pointResult = new HypoTestInverterResult(TString::Format("point_%010u", i));
+      double rVal = xValues[i];
+      std::unique_ptr<HypoTestResult> result(EvalPoint(rVal, false, -1));
+      if (result)
+         pointResult->Add(rVal, *result);
+      else
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << rVal
+                               << " failed. Skipping." << std::endl;
+      return pointResult;
+   };
+   ROOT::TProcessExecutor workers(std::min(fNWorkers, nPoints));
+   std::vector<HypoTestInverterResult *> pointResults = workers.Map(runPoint, ROOT::TSeqU(nPoints));
+
+   // the results arrive in the order in which the processes finish
+   std::vector<std::unique_ptr<HypoTestInverterResult>> ownedResults(pointResults.begin(), pointResults.end());
+   std::sort(ownedResults.begin(), ownedResults.end(),
+             [](const std::unique_ptr<HypoTestInverterResult> &a, const std::unique_ptr<HypoTestInverterResult> &b) {
+                return std::strcmp(a->GetName(), b->GetName()) < 0;
+             });
+   if (ownedResults.size() != nPoints)
+      oocoutE(nullptr,Eval) << "HypoTestInverter::RunFixedScan - only " << ownedResults.size() << " of the "
+                            << nPoints << " points were returned by the processes" << std::endl;
+
+   for (auto &pointResult : ownedResults) {
+      if (pointResult->ArraySize() == 0)
+         continue;
+      auto &yObjects = pointResult->fYObjects;
+      std::unique_ptr<HypoTestResult> result(static_cast<HypoTestResult *>(yObjects.Remove(yObjects.First())));
+      if (result->GetNullDistribution() && result->GetAltDistribution())
+         fTotalToysRun += result->GetAltDistribution()->GetSize() + result->GetNullDistribution()->GetSize();
+      AddPointResult(pointResult->GetXValue(0), std::move(result));
+   }
+
+   return true;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// run only one point at the given POI value
 
@@ -672,6 +749,20 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    CreateResults();
 
+   std::unique_ptr<HypoTestResult> result(EvalPoint(rVal, adaptive, clTarget));
+   if (!result)
+      return false;
+
+   AddPointResult(rVal, std::move(result));
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the hypothesis test at the given POI value, which is moved inside the range of
+/// the scanned variable. Returns nullptr if the test failed or gave invalid p values.
+
+HypoTestResult * HypoTestInverter::EvalPoint( double &rVal, bool adaptive, double clTarget) const
+{
    // check if rVal is in the range specified for fScannedVariable
    if ( rVal < fScannedVariable->getMin() ) {
       oocoutE(nullptr,InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the lower bound "
@@ -709,7 +800,7 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!result) {
       oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
    fScannedVariable->getVal() << endl;
-      return false;
+      return nullptr;
    }
    // in case of a dummy result
    const double nullPV = result->NullPValue();
@@ -717,9 +808,19 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!std::isfinite(nullPV) || nullPV < 0. || nullPV > 1. || !std::isfinite(altPV) || altPV < 0. || altPV > 1.) {
       oocoutW(nullptr,Eval) << "HypoTestInverter - Skipping invalid result for  point " << fScannedVariable->GetName() << " = " <<
          fScannedVariable->getVal() << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
-      return false;
+      return nullptr;
    }
 
+   fScannedVariable->setVal(oldValue);
+
+   return result.release();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// add the result of a point to the results, merging it with the last point if they have the same value
+
+void HypoTestInverter::AddPointResult( double rVal, std::unique_ptr<HypoTestResult> result) const
+{
    double lastXtested;
    if ( fResults->ArraySize()!=0 ) lastXtested = fResults->GetXValue(fResults->ArraySize()-1);
    else lastXtested = -999;
@@ -749,10 +850,6 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
      fResults->fYObjects.Add(result.release());
 
    }
-
-   fScannedVariable->setVal(oldValue);
-
-   return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,14 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <cstring>
+
 
 using namespace RooFit;
 using namespace std;
@@ -304,7 +312,8 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 
    // ======= S I N G L E   R U N ? =======
    if(!fProofConfig)
-      return GetSamplingDistributionsSingleWorker(paramPointIn);
+      return fNWorkers > 1 ? GetSamplingDistributionsMultiProcess(paramPointIn)
+                           : GetSamplingDistributionsSingleWorker(paramPointIn);
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -346,6 +355,68 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the toys in fNWorkers forked processes, which start from a copy of the state
+/// of this process. Each process generates a batch of toys with its own seed, drawn from
+/// RooRandom::randomGenerator(), and the batches are merged in order. Adaptive sampling
+/// is not supported, like for PROOF runs.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef _MSC_VER
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   // turn adaptive sampling off if given
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const Int_t totToys = fNToys;
+   const unsigned int nBatches = std::min<Int_t>(fNWorkers, totToys);
+   if (nBatches < 2)
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+
+   std::vector<UInt_t> seeds(nBatches);
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   auto runBatch = [&](unsigned int i) {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]);
+      fNToys = totToys / nBatches + (i < totToys % nBatches ? 1 : 0);
+      RooDataSet *batch = GetSamplingDistributionsSingleWorker(paramPointIn);
+      // the batches arrive in the order in which the processes finish
+      batch->SetName(TString::Format("batch_%010u", i));
+      return batch;
+   };
+   ROOT::TProcessExecutor workers(nBatches);
+   std::vector<RooDataSet *> batches = workers.Map(runBatch, ROOT::TSeqU(nBatches));
+   if (batches.empty()) {
+      oocoutE(nullptr, Generation) << "ToyMCSampler: no batch of toys was returned by the processes" << endl;
+      return nullptr;
+   }
+   std::sort(batches.begin(), batches.end(),
+             [](RooDataSet *a, RooDataSet *b) { return std::strcmp(a->GetName(), b->GetName()) < 0; });
+
+   RooDataSet *output = batches.front();
+   for (std::size_t i = 1; i < batches.size(); ++i) {
+      output->append(*batches[i]);
+      delete batches[i];
+   }
+   output->SetNameTitle(fSamplingDistName.c_str(), fSamplingDistName.c_str());
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
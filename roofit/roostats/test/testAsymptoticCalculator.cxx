@@ -0,0 +1,72 @@
+#include "RooRealVar.h"
+#include "RooDataSet.h"
+#include "RooWorkspace.h"
+#include "RooStats/AsymptoticCalculator.h"
+#include "RooStats/HypoTestResult.h"
+#include "RooStats/ModelConfig.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// Return the CLs of the given POI value, computed by the calculator
+double GetCLs(RooStats::AsymptoticCalculator &calc, RooStats::ModelConfig &sbModel, double mu)
+{
+   RooRealVar &poi = *static_cast<RooRealVar *>(sbModel.GetParametersOfInterest()->first());
+   poi.setVal(mu);
+   sbModel.SetSnapshot(RooArgSet(poi));
+   std::unique_ptr<RooStats::HypoTestResult> result{calc.GetHypoTest()};
+   result->SetBackgroundAsAlt(true);
+   return result->CLs();
+}
+
+} // namespace
+
+// The NLL and the starting point of the fits are reused between the points
+TEST(AsymptoticCalculator, ReusedFitsMatchFreshCalculators)
+{
+   RooStats::AsymptoticCalculator::SetPrintLevel(-1);
+
+   // counting experiment with a background constrained by an auxiliary measurement
+   RooWorkspace w("w");
+   w.factory("sum::nexp(prod::sig(mu[1,0,10],s[3]),b[2,0,10])");
+   w.factory("PROD::pdf(Poisson::pois(n[5,0,50],nexp),Gaussian::constr(b0[2,0,10],b,0.5))");
+   w.var("b0")->setConstant();
+   RooRealVar &n = *w.var("n");
+   RooRealVar &mu = *w.var("mu");
+   RooDataSet data("data", "data", n);
+   data.add(n);
+
+   RooStats::ModelConfig sbModel("sbModel", &w);
+   sbModel.SetPdf("pdf");
+   sbModel.SetObservables("n");
+   sbModel.SetParametersOfInterest("mu");
+   sbModel.SetNuisanceParameters("b");
+   sbModel.SetGlobalObservables("b0");
+   sbModel.SetSnapshot(RooArgSet(mu));
+   std::unique_ptr<RooStats::ModelConfig> bModel{static_cast<RooStats::ModelConfig *>(sbModel.Clone("bModel"))};
+   mu.setVal(0.);
+   bModel->SetSnapshot(RooArgSet(mu));
+   mu.setVal(1.);
+
+   std::unique_ptr<RooArgSet> initialParams{sbModel.GetPdf()->getParameters(data)};
+   RooArgSet initialValues;
+   initialParams->snapshot(initialValues);
+
+   const double muValues[] = {0.5, 1., 2., 4.};
+   RooStats::AsymptoticCalculator scanCalc(data, *bModel, sbModel);
+   scanCalc.SetOneSided(true);
+   std::vector<double> scanCLs;
+   for (double mu : muValues)
+      scanCLs.push_back(GetCLs(scanCalc, sbModel, mu));
+
+   for (std::size_t i = 0; i < scanCLs.size(); ++i) {
+      initialParams->assign(initialValues);
+      RooStats::AsymptoticCalculator freshCalc(data, *bModel, sbModel);
+      freshCalc.SetOneSided(true);
+      EXPECT_NEAR(scanCLs[i], GetCLs(freshCalc, sbModel, muValues[i]), 1e-4) << "mu = " << muValues[i];
+   }
+}
@@ -0,0 +1,64 @@
+#include "RooRealVar.h"
+#include "RooDataSet.h"
+#include "RooRandom.h"
+#include "RooWorkspace.h"
+#include "RooStats/FrequentistCalculator.h"
+#include "RooStats/HypoTestInverter.h"
+#include "RooStats/HypoTestInverterResult.h"
+#include "RooStats/ModelConfig.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+
+/// Run a fixed scan of a counting experiment with the given number of processes
+std::unique_ptr<RooStats::HypoTestInverterResult> RunCountingScan(unsigned int nWorkers)
+{
+   RooWorkspace w("w");
+   w.factory("sum::nexp(prod::sig(mu[1,0,5],s[3]),b[2])");
+   w.factory("Poisson::pdf(n[5,0,50],nexp)");
+   RooRealVar &n = *w.var("n");
+   RooRealVar &mu = *w.var("mu");
+   RooDataSet data("data", "data", n);
+   data.add(n);
+
+   RooStats::ModelConfig sbModel("sbModel", &w);
+   sbModel.SetPdf("pdf");
+   sbModel.SetObservables("n");
+   sbModel.SetParametersOfInterest("mu");
+   sbModel.SetSnapshot(RooArgSet(mu));
+   std::unique_ptr<RooStats::ModelConfig> bModel{static_cast<RooStats::ModelConfig *>(sbModel.Clone("bModel"))};
+   mu.setVal(0.);
+   bModel->SetSnapshot(RooArgSet(mu));
+
+   RooStats::FrequentistCalculator calc(data, *bModel, sbModel);
+   calc.SetToys(50, 50);
+   RooStats::HypoTestInverter inverter(calc);
+   inverter.UseCLs();
+   inverter.SetNumWorkers(nWorkers);
+
+   RooRandom::randomGenerator()->SetSeed(4357);
+   EXPECT_TRUE(inverter.RunFixedScan(4, 0.5, 3.));
+   return std::unique_ptr<RooStats::HypoTestInverterResult>{inverter.GetInterval()};
+}
+
+} // namespace
+
+// The points of a parallel scan are seeded independently of the number of processes
+TEST(HypoTestInverter, ParallelScanDoesNotDependOnWorkers)
+{
+   auto twoWorkers = RunCountingScan(2);
+   auto threeWorkers = RunCountingScan(3);
+
+   ASSERT_EQ(twoWorkers->ArraySize(), 4);
+   ASSERT_EQ(threeWorkers->ArraySize(), 4);
+   for (int i = 0; i < 4; ++i) {
+      EXPECT_DOUBLE_EQ(twoWorkers->GetXValue(i), threeWorkers->GetXValue(i));
+      EXPECT_DOUBLE_EQ(twoWorkers->CLs(i), threeWorkers->CLs(i));
+      // the points are kept in the order of the scan
+      if (i > 0)
+         EXPECT_LT(twoWorkers->GetXValue(i - 1), twoWorkers->GetXValue(i));
+   }
+}
@@ -0,0 +1,81 @@
+/// \file
+/// Benchmarks of the filling of histograms, one entry at a time and in bulk.
+
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TH1.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int kNValues = 100000;
+
+std::vector<double> MakeValues(unsigned int seed)
+{
+   std::mt19937 gen(seed);
+   std::normal_distribution<double> dist(0., 1.);
+   std::vector<double> values(kNValues);
+   for (auto &v : values)
+      v = dist(gen);
+   return values;
+}
+
+void BM_TH1D_Fill(benchmark::State &state)
+{
+   TH1::AddDirectory(false);
+   TH1D h("h", "h", state.range(0), -5., 5.);
+   const auto values = MakeValues(1);
+   for (auto _ : state) {
+      for (auto v : values)
+         h.Fill(v);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+void BM_TH1D_FillWeighted(benchmark::State &state)
+{
+   TH1::AddDirectory(false);
+   TH1D h("h", "h", state.range(0), -5., 5.);
+   h.Sumw2();
+   const auto values = MakeValues(1);
+   for (auto _ : state) {
+      for (auto v : values)
+         h.Fill(v, 0.5);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+void BM_TH1D_FillN(benchmark::State &state)
+{
+   TH1::AddDirectory(false);
+   TH1D h("h", "h", state.range(0), -5., 5.);
+   const auto values = MakeValues(1);
+   const std::vector<double> weights(values.size(), 0.5);
+   for (auto _ : state)
+      h.FillN(values.size(), values.data(), weights.data());
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+void BM_TH2D_Fill(benchmark::State &state)
+{
+   TH1::AddDirectory(false);
+   TH2D h("h", "h", state.range(0), -5., 5., state.range(0), -5., 5.);
+   const auto x = MakeValues(1);
+   const auto y = MakeValues(2);
+   for (auto _ : state) {
+      for (int i = 0; i < kNValues; ++i)
+         h.Fill(x[i], y[i]);
+   }
+   state.SetItemsProcessed(state.iterations() * kNValues);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_TH1D_Fill)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TH1D_FillWeighted)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TH1D_FillN)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TH2D_Fill)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
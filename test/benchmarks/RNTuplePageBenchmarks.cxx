@@ -0,0 +1,74 @@
+/// \file
+/// Benchmarks of the packing and unpacking of RNTuple pages, i.e. the conversions between the in-memory and the
+/// on-storage layout of the column elements done for each page written and read.
+
+#include "ROOT/RColumnElement.hxx"
+#include "ROOT/RColumnModel.hxx"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using ROOT::Experimental::EColumnType;
+using ROOT::Experimental::Detail::RColumnElementBase;
+
+namespace {
+
+/// The number of elements of a page of 64 kB of 32 bit elements
+constexpr std::size_t kNElements = 16 * 1024;
+
+std::vector<unsigned char> MakePage(const RColumnElementBase &element, EColumnType type)
+{
+   std::mt19937 gen(42);
+   std::vector<unsigned char> page(kNElements * element.GetSize());
+   if (type == EColumnType::kBit) {
+      // Only 0 and 1 are valid representations of bool
+      for (auto &byte : page)
+         byte = gen() % 2;
+   } else {
+      for (auto &byte : page)
+         byte = gen();
+   }
+   return page;
+}
+
+void BM_Pack(benchmark::State &state, EColumnType type)
+{
+   auto element = RColumnElementBase::Generate(type);
+   auto page = MakePage(*element, type);
+   std::vector<unsigned char> packed(element->GetPackedSize(kNElements));
+   for (auto _ : state) {
+      element->Pack(packed.data(), page.data(), kNElements);
+      benchmark::DoNotOptimize(packed.data());
+   }
+   state.SetBytesProcessed(state.iterations() * page.size());
+}
+
+void BM_Unpack(benchmark::State &state, EColumnType type)
+{
+   auto element = RColumnElementBase::Generate(type);
+   auto page = MakePage(*element, type);
+   std::vector<unsigned char> packed(element->GetPackedSize(kNElements));
+   element->Pack(packed.data(), page.data(), kNElements);
+   for (auto _ : state) {
+      element->Unpack(page.data(), packed.data(), kNElements);
+      benchmark::DoNotOptimize(page.data());
+   }
+   state.SetBytesProcessed(state.iterations() * page.size());
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_Pack, SplitReal32, EColumnType::kSplitReal32);
+BENCHMARK_CAPTURE(BM_Pack, SplitReal64, EColumnType::kSplitReal64);
+BENCHMARK_CAPTURE(BM_Pack, SplitInt32, EColumnType::kSplitInt32);
+BENCHMARK_CAPTURE(BM_Pack, SplitIndex32, EColumnType::kSplitIndex32);
+BENCHMARK_CAPTURE(BM_Pack, Bit, EColumnType::kBit);
+
+BENCHMARK_CAPTURE(BM_Unpack, SplitReal32, EColumnType::kSplitReal32);
+BENCHMARK_CAPTURE(BM_Unpack, SplitReal64, EColumnType::kSplitReal64);
+BENCHMARK_CAPTURE(BM_Unpack, SplitInt32, EColumnType::kSplitInt32);
+BENCHMARK_CAPTURE(BM_Unpack, SplitIndex32, EColumnType::kSplitIndex32);
+BENCHMARK_CAPTURE(BM_Unpack, Bit, EColumnType::kBit);
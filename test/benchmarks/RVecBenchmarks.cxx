@@ -0,0 +1,115 @@
+/// \file
+/// Benchmarks of the operations on RVecs used in the expressions of RDataFrame analyses.
+
+#include "ROOT/RVec.hxx"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using ROOT::RVecD;
+using ROOT::RVecF;
+
+namespace {
+
+RVecF MakeValues(std::size_t size, unsigned int seed)
+{
+   std::mt19937 gen(seed);
+   std::uniform_real_distribution<float> dist(0.f, 100.f);
+   RVecF values(size);
+   for (auto &v : values)
+      v = dist(gen);
+   return values;
+}
+
+// RVecs of the size of a collection of an event, e.g. the jets, are sized in the small buffer
+
+void BM_RVec_Construct(benchmark::State &state)
+{
+   const auto values = MakeValues(state.range(0), 1);
+   for (auto _ : state) {
+      RVecF copy(values.begin(), values.end());
+      benchmark::DoNotOptimize(copy.data());
+   }
+}
+
+void BM_RVec_Arithmetic(benchmark::State &state)
+{
+   const auto x = MakeValues(state.range(0), 1);
+   const auto y = MakeValues(state.range(0), 2);
+   for (auto _ : state) {
+      auto result = x * y + 2.f * x;
+      benchmark::DoNotOptimize(result.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RVec_Mask(benchmark::State &state)
+{
+   const auto x = MakeValues(state.range(0), 1);
+   const auto y = MakeValues(state.range(0), 2);
+   for (auto _ : state) {
+      auto result = x[x > 30.f && y < 70.f];
+      benchmark::DoNotOptimize(result.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RVec_Math(benchmark::State &state)
+{
+   const auto x = MakeValues(state.range(0), 1);
+   for (auto _ : state) {
+      auto result = ROOT::VecOps::sqrt(x) + ROOT::VecOps::log(x);
+      benchmark::DoNotOptimize(result.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RVec_Reductions(benchmark::State &state)
+{
+   const auto x = MakeValues(state.range(0), 1);
+   for (auto _ : state) {
+      benchmark::DoNotOptimize(ROOT::VecOps::Sum(x));
+      benchmark::DoNotOptimize(ROOT::VecOps::Max(x));
+      benchmark::DoNotOptimize(ROOT::VecOps::Mean(x));
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RVec_Sort(benchmark::State &state)
+{
+   const auto x = MakeValues(state.range(0), 1);
+   for (auto _ : state) {
+      auto result = ROOT::VecOps::Take(x, ROOT::VecOps::Argsort(x));
+      benchmark::DoNotOptimize(result.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RVec_Combinations(benchmark::State &state)
+{
+   const auto x = MakeValues(state.range(0), 1);
+   for (auto _ : state) {
+      auto idx = ROOT::VecOps::Combinations(x, 2);
+      auto sum = ROOT::VecOps::Take(x, idx[0]) + ROOT::VecOps::Take(x, idx[1]);
+      benchmark::DoNotOptimize(sum.data());
+   }
+}
+
+void BM_RVec_InvariantMass(benchmark::State &state)
+{
+   const RVecD pt = {30., 40.}, eta = {0.5, -1.2}, phi = {0.1, 2.5}, mass = {0.105, 0.105};
+   for (auto _ : state)
+      benchmark::DoNotOptimize(ROOT::VecOps::InvariantMass(pt, eta, phi, mass));
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_RVec_Construct)->Arg(8)->Arg(1024);
+BENCHMARK(BM_RVec_Arithmetic)->Arg(8)->Arg(1024);
+BENCHMARK(BM_RVec_Mask)->Arg(8)->Arg(1024);
+BENCHMARK(BM_RVec_Math)->Arg(8)->Arg(1024);
+BENCHMARK(BM_RVec_Reductions)->Arg(8)->Arg(1024);
+BENCHMARK(BM_RVec_Sort)->Arg(8)->Arg(1024);
+BENCHMARK(BM_RVec_Combinations)->Arg(8)->Arg(32);
+BENCHMARK(BM_RVec_InvariantMass);
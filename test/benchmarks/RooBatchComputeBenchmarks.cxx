@@ -0,0 +1,97 @@
+/// \file
+/// Benchmarks of the RooBatchCompute kernels evaluating pdfs on batches of events, on the CPU architecture selected
+/// at runtime (see RooBatchCompute::init).
+
+#include "RooBatchCompute.h"
+#include "RooBatchCompute/Initialisation.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using RooBatchCompute::Computer;
+
+namespace {
+
+std::vector<double> MakeValues(std::size_t size, double min, double max)
+{
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<double> dist(min, max);
+   std::vector<double> values(size);
+   for (auto &v : values)
+      v = dist(gen);
+   return values;
+}
+
+/// Evaluates a pdf of the observable x, whose parameters are scalars, i.e. spans of size one
+void RunKernel(benchmark::State &state, Computer computer, const std::vector<double> &parameters,
+               const RooBatchCompute::ArgVector &extraArgs = {})
+{
+   RooBatchCompute::init();
+   if (!RooBatchCompute::dispatchCPU) {
+      state.SkipWithError("no RooBatchCompute library could be loaded");
+      return;
+   }
+   const std::size_t nEvents = state.range(0);
+   const auto x = MakeValues(nEvents, 0., 10.);
+   std::vector<double> output(nEvents);
+   RooBatchCompute::VarVector vars{{x.data(), nEvents}};
+   for (const auto &parameter : parameters)
+      vars.emplace_back(&parameter, 1);
+
+   for (auto _ : state) {
+      RooBatchCompute::dispatchCPU->compute(nullptr, computer, output.data(), nEvents, vars, extraArgs);
+      benchmark::DoNotOptimize(output.data());
+   }
+   state.SetItemsProcessed(state.iterations() * nEvents);
+   state.SetLabel(RooBatchCompute::dispatchCPU->architectureName());
+}
+
+void BM_Gaussian(benchmark::State &state)
+{
+   RunKernel(state, RooBatchCompute::Gaussian, {5., 1.5});
+}
+
+void BM_Exponential(benchmark::State &state)
+{
+   RunKernel(state, RooBatchCompute::Exponential, {-0.3});
+}
+
+void BM_Poisson(benchmark::State &state)
+{
+   RunKernel(state, RooBatchCompute::Poisson, {4.}, {/*protectNegative*/ 1., /*noRounding*/ 0.});
+}
+
+void BM_Chebychev(benchmark::State &state)
+{
+   // The coefficients are followed by the range of the observable
+   RunKernel(state, RooBatchCompute::Chebychev, {}, {0.5, -0.2, 0.1, 0., 10.});
+}
+
+void BM_NegativeLogarithms(benchmark::State &state)
+{
+   RunKernel(state, RooBatchCompute::NegativeLogarithms, {});
+}
+
+void BM_SumReduce(benchmark::State &state)
+{
+   RooBatchCompute::init();
+   if (!RooBatchCompute::dispatchCPU) {
+      state.SkipWithError("no RooBatchCompute library could be loaded");
+      return;
+   }
+   const auto x = MakeValues(state.range(0), 0., 1.);
+   for (auto _ : state)
+      benchmark::DoNotOptimize(RooBatchCompute::dispatchCPU->sumReduce(nullptr, x.data(), x.size()));
+   state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_Gaussian)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_Exponential)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_Poisson)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_Chebychev)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_NegativeLogarithms)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_SumReduce)->Arg(1000)->Arg(100000);
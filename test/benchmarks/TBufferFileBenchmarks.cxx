@@ -0,0 +1,120 @@
+/// \file
+/// Benchmarks of the streaming of basic types, strings and objects in a TBufferFile, as done for each entry of a
+/// TTree branch and each key.
+
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TH1D.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+void BM_TBufferFile_WriteFastArray(benchmark::State &state)
+{
+   const std::vector<float> values(state.range(0), 1.5f);
+   TBufferFile buffer(TBuffer::kWrite, values.size() * sizeof(float) + 1024);
+   for (auto _ : state) {
+      buffer.SetBufferOffset(0);
+      buffer.WriteFastArray(values.data(), values.size());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(float));
+}
+
+void BM_TBufferFile_ReadFastArray(benchmark::State &state)
+{
+   std::vector<float> values(state.range(0), 1.5f);
+   TBufferFile buffer(TBuffer::kWrite, values.size() * sizeof(float) + 1024);
+   buffer.WriteFastArray(values.data(), values.size());
+   buffer.SetReadMode();
+   for (auto _ : state) {
+      buffer.SetBufferOffset(0);
+      buffer.ReadFastArray(values.data(), values.size());
+      benchmark::DoNotOptimize(values.data());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(float));
+}
+
+void BM_TBufferFile_Scalars(benchmark::State &state)
+{
+   constexpr int kNValues = 1000;
+   TBufferFile buffer(TBuffer::kWrite, kNValues * (sizeof(Int_t) + sizeof(Double_t)) + 1024);
+   for (auto _ : state) {
+      buffer.SetWriteMode();
+      buffer.SetBufferOffset(0);
+      for (int i = 0; i < kNValues; ++i) {
+         buffer << Int_t(i);
+         buffer << Double_t(i);
+      }
+      buffer.SetReadMode();
+      buffer.SetBufferOffset(0);
+      Int_t n;
+      Double_t x;
+      for (int i = 0; i < kNValues; ++i) {
+         buffer >> n;
+         buffer >> x;
+      }
+      benchmark::DoNotOptimize(x);
+   }
+   state.SetItemsProcessed(state.iterations() * 2 * kNValues);
+}
+
+void BM_TBufferFile_StdString(benchmark::State &state)
+{
+   const std::string value(state.range(0), 'x');
+   std::string read;
+   TBufferFile buffer(TBuffer::kWrite, value.size() + 1024);
+   for (auto _ : state) {
+      buffer.SetWriteMode();
+      buffer.SetBufferOffset(0);
+      buffer.WriteStdString(&value);
+      buffer.SetReadMode();
+      buffer.SetBufferOffset(0);
+      buffer.ReadStdString(&read);
+      benchmark::DoNotOptimize(read.data());
+   }
+}
+
+void BM_TBufferFile_WriteObject(benchmark::State &state)
+{
+   TH1::AddDirectory(false);
+   TH1D h("h", "h", state.range(0), 0., 1.);
+   h.FillRandom("gaus", 10000);
+   TBufferFile buffer(TBuffer::kWrite);
+   for (auto _ : state) {
+      buffer.Reset();
+      buffer.WriteObjectAny(&h, TH1D::Class());
+   }
+   state.SetBytesProcessed(state.iterations() * buffer.Length());
+}
+
+void BM_TBufferFile_ReadObject(benchmark::State &state)
+{
+   TH1::AddDirectory(false);
+   TH1D h("h", "h", state.range(0), 0., 1.);
+   h.FillRandom("gaus", 10000);
+   TBufferFile buffer(TBuffer::kWrite);
+   buffer.WriteObjectAny(&h, TH1D::Class());
+   const auto length = buffer.Length();
+   buffer.SetReadMode();
+   for (auto _ : state) {
+      buffer.ResetMap();
+      buffer.SetBufferOffset(0);
+      std::unique_ptr<TH1D> read(static_cast<TH1D *>(buffer.ReadObjectAny(TH1D::Class())));
+      benchmark::DoNotOptimize(read.get());
+   }
+   state.SetBytesProcessed(state.iterations() * length);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_TBufferFile_WriteFastArray)->Arg(16)->Arg(16 * 1024);
+BENCHMARK(BM_TBufferFile_ReadFastArray)->Arg(16)->Arg(16 * 1024);
+BENCHMARK(BM_TBufferFile_Scalars);
+BENCHMARK(BM_TBufferFile_StdString)->Arg(8)->Arg(1024);
+BENCHMARK(BM_TBufferFile_WriteObject)->Arg(100)->Arg(10000);
+BENCHMARK(BM_TBufferFile_ReadObject)->Arg(100)->Arg(10000);
@@ -0,0 +1,64 @@
+/// \file
+/// Benchmarks of the lookup of classes, which the I/O and the interpreter do for each streamed type.
+
+#include "TClass.h"
+#include "TH1D.h"
+
+#include <benchmark/benchmark.h>
+
+#include <typeinfo>
+#include <vector>
+
+namespace {
+
+void BM_TClass_GetClassByName(benchmark::State &state)
+{
+   TClass::GetClass("TH1D"); // the first call loads the library and the dictionary
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass("TH1D"));
+}
+
+void BM_TClass_GetClassByNormalizedName(benchmark::State &state)
+{
+   // Names that are not normalized go through TClassEdit before the lookup
+   TClass::GetClass("std::vector<float>");
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass("std::vector<float>"));
+}
+
+void BM_TClass_GetClassByTypeInfo(benchmark::State &state)
+{
+   TClass::GetClass(typeid(TH1D));
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass(typeid(TH1D)));
+}
+
+void BM_TClass_GetClassTemplate(benchmark::State &state)
+{
+   TClass::GetClass<std::vector<double>>();
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass<std::vector<double>>());
+}
+
+void BM_TClass_GetClassMissing(benchmark::State &state)
+{
+   // Unknown names are looked up in the autoload maps and the interpreter each time
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass("NoSuchClassForBenchmarks", /*load=*/true, /*silent=*/true));
+}
+
+void BM_TClass_InheritsFrom(benchmark::State &state)
+{
+   auto cl = TH1D::Class();
+   for (auto _ : state)
+      benchmark::DoNotOptimize(cl->InheritsFrom("TNamed"));
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_TClass_GetClassByName);
+BENCHMARK(BM_TClass_GetClassByNormalizedName);
+BENCHMARK(BM_TClass_GetClassByTypeInfo);
+BENCHMARK(BM_TClass_GetClassTemplate);
+BENCHMARK(BM_TClass_GetClassMissing);
+BENCHMARK(BM_TClass_InheritsFrom);
@@ -0,0 +1,88 @@
+/// \file
+/// Benchmarks of the compression and decompression of a block with each algorithm, as done for each basket and page.
+
+#include "Compression.h"
+#include "RZip.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using EAlgorithm = ROOT::RCompressionSetting::EAlgorithm::EValues;
+
+constexpr int kBlockSize = 1024 * 1024;
+
+/// Floats with a limited precision, which compress about as well as typical physics data
+std::vector<char> MakeBlock()
+{
+   std::mt19937 gen(42);
+   std::normal_distribution<float> dist(100.f, 10.f);
+   std::vector<float> values(kBlockSize / sizeof(float));
+   for (auto &v : values)
+      v = std::round(dist(gen) * 100.f) / 100.f;
+   std::vector<char> block(kBlockSize);
+   std::memcpy(block.data(), values.data(), kBlockSize);
+   return block;
+}
+
+std::vector<char> Zip(std::vector<char> &block, int level, EAlgorithm algorithm)
+{
+   // The compressed size is bounded by the size of the input plus the headers
+   std::vector<char> zipped(block.size() + 1024);
+   int srcSize = block.size();
+   int tgtSize = zipped.size();
+   int zippedSize = 0;
+   R__zipMultipleAlgorithm(level, &srcSize, block.data(), &tgtSize, zipped.data(), &zippedSize, algorithm);
+   if (zippedSize == 0)
+      throw std::runtime_error("the compression of the block failed");
+   zipped.resize(zippedSize);
+   return zipped;
+}
+
+void BM_Zip(benchmark::State &state, EAlgorithm algorithm)
+{
+   auto block = MakeBlock();
+   const int level = state.range(0);
+   std::size_t zippedSize = 0;
+   for (auto _ : state)
+      zippedSize = Zip(block, level, algorithm).size();
+   state.SetBytesProcessed(state.iterations() * block.size());
+   state.counters["ratio"] = double(block.size()) / zippedSize;
+}
+
+void BM_Unzip(benchmark::State &state, EAlgorithm algorithm)
+{
+   auto block = MakeBlock();
+   auto zipped = Zip(block, state.range(0), algorithm);
+   std::vector<unsigned char> unzipped(block.size());
+   for (auto _ : state) {
+      int srcSize = zipped.size();
+      int tgtSize = unzipped.size();
+      int unzippedSize = 0;
+      R__unzip(&srcSize, reinterpret_cast<unsigned char *>(zipped.data()), &tgtSize, unzipped.data(), &unzippedSize);
+      if (unzippedSize != kBlockSize)
+         state.SkipWithError("the decompression of the block failed");
+      benchmark::DoNotOptimize(unzipped.data());
+   }
+   state.SetBytesProcessed(state.iterations() * block.size());
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_Zip, ZLIB, EAlgorithm::kZLIB)->Arg(1)->Arg(6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Zip, LZMA, EAlgorithm::kLZMA)->Arg(1)->Arg(6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Zip, LZ4, EAlgorithm::kLZ4)->Arg(1)->Arg(4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Zip, ZSTD, EAlgorithm::kZSTD)->Arg(1)->Arg(5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Zip, Old, EAlgorithm::kOldCompressionAlgo)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_Unzip, ZLIB, EAlgorithm::kZLIB)->Arg(1)->Arg(6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Unzip, LZMA, EAlgorithm::kLZMA)->Arg(1)->Arg(6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Unzip, LZ4, EAlgorithm::kLZ4)->Arg(1)->Arg(4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Unzip, ZSTD, EAlgorithm::kZSTD)->Arg(1)->Arg(5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Unzip, Old, EAlgorithm::kOldCompressionAlgo)->Arg(1)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+################################################################################
+# Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+"""
+Compares the results of the benchmarks, as written by Google Benchmark in JSON,
+with stored baselines, and reports the benchmarks that became slower than their
+baseline by more than a tolerance. With --update, stores the results as the
+new baselines instead.
+
+The baselines are only meaningful for the machine and the build configuration
+on which they were recorded: benchmarks without a baseline are reported but
+do not fail the comparison.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import sys
+
+# Conversion of the time units of Google Benchmark to nanoseconds
+TIME_UNITS = {"ns": 1., "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path):
+    """Returns the CPU time per iteration in nanoseconds of each benchmark of a result file."""
+    with open(path) as f:
+        results = json.load(f)
+    times = {}
+    for benchmark in results.get("benchmarks", []):
+        # Only the individual runs, not the aggregates (mean, median...) of repeated runs
+        if benchmark.get("run_type", "iteration") != "iteration" or "error_occurred" in benchmark:
+            continue
+        times[benchmark["name"]] = benchmark["cpu_time"] * TIME_UNITS[benchmark.get("time_unit", "ns")]
+    return times
+
+
+def result_files(directory):
+    if not os.path.isdir(directory):
+        return []
+    return sorted(name for name in os.listdir(directory) if name.endswith(".json"))
+
+
+def update(args):
+    files = result_files(args.results)
+    if not files:
+        print(f"No benchmark results in {args.results}, run the benchmarks first with 'ctest -L benchmark'.")
+        return 1
+    os.makedirs(args.baselines, exist_ok=True)
+    for name in files:
+        shutil.copyfile(os.path.join(args.results, name), os.path.join(args.baselines, name))
+        print(f"Updated the baseline {os.path.join(args.baselines, name)}")
+    return 0
+
+
+def compare(args):
+    files = result_files(args.results)
+    if not files:
+        print(f"No benchmark results in {args.results}")
+        return 1
+
+    regressions = []
+    missing = []
+    print(f"{'Benchmark':60} {'Baseline [ns]':>14} {'Result [ns]':>14} {'Change':>8}")
+    for name in files:
+        times = load_times(os.path.join(args.results, name))
+        baseline_path = os.path.join(args.baselines, name)
+        baselines = load_times(baseline_path) if os.path.exists(baseline_path) else {}
+        for benchmark, time in times.items():
+            if benchmark not in baselines:
+                missing.append(benchmark)
+                continue
+            change = time / baselines[benchmark] - 1.
+            flag = ""
+            if change > args.tolerance:
+                regressions.append(benchmark)
+                flag = "  REGRESSION"
+            print(f"{benchmark:60} {baselines[benchmark]:14.1f} {time:14.1f} {change:+8.1%}{flag}")
+
+    if missing:
+        print(f"\n{len(missing)} benchmarks have no baseline in {args.baselines}, "
+              "record them with the benchmark-baselines target:")
+        for benchmark in missing:
+            print(f"  {benchmark}")
+    if regressions:
+        print(f"\n{len(regressions)} benchmarks are more than {args.tolerance:.0%} slower than their baseline:")
+        for benchmark in regressions:
+            print(f"  {benchmark}")
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--results", required=True, help="Directory of the JSON results of the benchmarks")
+    parser.add_argument("--baselines", required=True, help="Directory of the JSON baselines")
+    parser.add_argument("--tolerance", type=float, default=0.15,
+                        help="Relative slowdown above which a benchmark is a regression (default: 0.15)")
+    parser.add_argument("--update", action="store_true", help="Store the results as the new baselines")
+    args = parser.parse_args()
+    return update(args) if args.update else compare(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
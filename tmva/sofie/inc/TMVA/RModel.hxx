@@ -24,6 +24,8 @@ enum class Options {
    kDefault = 0x0,
    kNoSession = 0x1,
    kNoWeightFile = 0x2,
+   kNoMemoryReuse = 0x4, ///< each intermediate tensor has its own buffer, see RModel::Generate
+   kGPU = 0x8,           ///< generate a Session running the model on a CUDA device with cuBLAS and cuDNN
 };
 
 std::underlying_type_t<Options> operator|(Options opA, Options opB);
@@ -55,6 +57,12 @@ private:
    bool fUseWeightFile = true;
    bool fUseSession = true;
 
+   std::string GenerateIntermediateTensorsCode(const std::vector<std::string> &operatorsCode,
+                                               const std::string &sessionCode, bool reuseMemory,
+                                               bool onDevice = false);
+   void GenerateGPUSession(const std::vector<std::string> &operatorsCode, const std::string &sessionMembersCode,
+                           const std::string &initCode, bool reuseMemory);
+
 public:
 
    //explicit move ctor/assn
@@ -25,6 +25,10 @@ public:
    virtual std::vector<ETensorType> TypeInference(std::vector<ETensorType>) = 0;
    virtual void Initialize(RModel&) = 0;
    virtual std::string Generate(std::string OpName) = 0;  //expect unique opname for each operator within the same RModel
+   // generate the code of the operator for the GPU backend (Options::kGPU), where the tensors are in device memory
+   virtual std::string GenerateGPU(std::string /*OpName*/) {
+      throw std::runtime_error("TMVA SOFIE operator is not supported by the GPU backend");
+   }
    // generate initialization code
    virtual std::string GenerateInitCode() { return "";}
    // generate session data members specific to operator
@@ -40,6 +40,54 @@ namespace SOFIE{
 
       std::string fType;
 
+      /// Maximum number of multiplications m*n*k of a product computed with loops instead of calling BLAS
+      static constexpr size_t kMaxSizeLoops = 16384;
+
+      /// Generate the loops computing Y = alpha * A * B + beta * Y, with the sizes of the matrices as literals so that
+      /// the compiler can unroll and vectorize them. The innermost loop runs over contiguous elements of B.
+      std::string GenerateLoops(int m, int n, int k)
+      {
+         auto Literal = [](float value) {
+            std::stringstream literal;
+            literal << std::showpoint << std::setprecision(std::numeric_limits<float>::max_digits10) << value << "f";
+            return literal.str();
+         };
+         // the multiplication by a factor different from one, e.g. "0.500000000f * "
+         auto Factor = [&](float value) { return value == 1 ? std::string() : Literal(value) + " * "; };
+         std::stringstream out;
+         const std::string y = "tensor_" + fNY;
+         const std::string a = fAttrTransA ? "tensor_" + fNA + "[l * " + std::to_string(m) + " + i]"
+                                           : "tensor_" + fNA + "[i * " + std::to_string(k) + " + l]";
+         out << SP << "for (int i = 0; i < " << m << "; i++) {\n";
+         if (fAttrTransB) {
+            // rows of B^T are contiguous: dot products of the rows of A and B^T
+            out << SP << SP << "for (int j = 0; j < " << n << "; j++) {\n";
+            out << SP << SP << SP << "float sum = 0;\n";
+            out << SP << SP << SP << "for (int l = 0; l < " << k << "; l++)\n";
+            out << SP << SP << SP << SP << "sum += " << a << " * tensor_" << fNB << "[j * " << k << " + l];\n";
+            out << SP << SP << SP << y << "[i * " << n << " + j] = ";
+            if (fNC != "") {
+               out << Factor(fAttrBeta) << y << "[i * " << n << " + j] + ";
+            }
+            out << Factor(fAttrAlpha) << "sum;\n";
+            out << SP << SP << "}\n";
+         } else {
+            out << SP << SP << "float * y = " << y << " + i * " << n << ";\n";
+            if (fNC == "") {
+               out << SP << SP << "for (int j = 0; j < " << n << "; j++) y[j] = 0;\n";
+            } else if (fAttrBeta != 1) {
+               out << SP << SP << "for (int j = 0; j < " << n << "; j++) y[j] *= " << Literal(fAttrBeta) << ";\n";
+            }
+            out << SP << SP << "for (int l = 0; l < " << k << "; l++) {\n";
+            out << SP << SP << SP << "const float a = " << Factor(fAttrAlpha) << a << ";\n";
+            out << SP << SP << SP << "const float * b = tensor_" << fNB << " + l * " << n << ";\n";
+            out << SP << SP << SP << "for (int j = 0; j < " << n << "; j++) y[j] += a * b[j];\n";
+            out << SP << SP << "}\n";
+         }
+         out << SP << "}\n";
+         return out.str();
+      }
+
    public:
 
       ROperator_Gemm(){}
@@ -191,18 +239,9 @@ namespace SOFIE{
          }
          std::stringstream out;
          out << "\n//--------- Gemm\n";
-         out << SP << "char " << OpName << "_transA = " << (fAttrTransA ? "\'t\'" : "\'n\'") << ";\n";
-         out << SP << "char " << OpName << "_transB = " << (fAttrTransB ? "\'t\'" : "\'n\'") << ";\n";
          int m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
          int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
          int k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
-         out << SP << "int " << OpName << "_m = " << m << ";\n";
-         out << SP << "int " << OpName << "_n = " << n << ";\n";
-         out << SP << "int " << OpName << "_k = " << k << ";\n";
-         out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
-         out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
-         out << SP << "int " << OpName << "_lda = " << (fAttrTransA ? m : k) << ";\n";
-         out << SP << "int " << OpName << "_ldb = " << (fAttrTransB ? k : n) << ";\n";
          if (fNC != ""){
             size_t length = ConvertShapeToLength(fShapeY);
             if (fNC2 == fNC)
@@ -216,7 +255,18 @@ namespace SOFIE{
                throw std::runtime_error("TMVA SOFIE Gemm Op : Bias tensor is not present but beta value in Gemm is not zero");
             }
          }
-         if (fType == "float"){
+         if (static_cast<size_t>(m) * n * k <= kMaxSizeLoops) {
+            out << GenerateLoops(m, n, k);
+         } else if (fType == "float"){
+            out << SP << "char " << OpName << "_transA = " << (fAttrTransA ? "\'t\'" : "\'n\'") << ";\n";
+            out << SP << "char " << OpName << "_transB = " << (fAttrTransB ? "\'t\'" : "\'n\'") << ";\n";
+            out << SP << "int " << OpName << "_m = " << m << ";\n";
+            out << SP << "int " << OpName << "_n = " << n << ";\n";
+            out << SP << "int " << OpName << "_k = " << k << ";\n";
+            out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+            out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+            out << SP << "int " << OpName << "_lda = " << (fAttrTransA ? m : k) << ";\n";
+            out << SP << "int " << OpName << "_ldb = " << (fAttrTransB ? k : n) << ";\n";
             out << SP << "BLAS::sgemm_(&" << OpName << "_transB, &" << OpName << "_transA, &" << OpName
              << "_n, &" << OpName << "_m, &" << OpName << "_k, &" << OpName << "_alpha, " << "tensor_" << fNB
              << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, " << "tensor_" << fNY << ", &"
@@ -227,6 +277,28 @@ namespace SOFIE{
 
          }
 
+      std::string GenerateGPU(std::string){
+         if (fShapeA.empty() || fShapeB.empty() || fShapeY.empty() || (fNC != "" && fShapeC.empty())) {
+            throw std::runtime_error("TMVA SOFIE Gemm Op called to GenerateGPU without being initialized first");
+         }
+         int m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
+         int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         int k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
+         std::stringstream out;
+         out << std::setprecision(std::numeric_limits<float>::max_digits10);
+         out << "\n//--------- Gemm\n";
+         if (fNC != "") {
+            out << SP << "GPU::Check(cudaMemcpyAsync(tensor_" << fNY << ", tensor_" << fNC2 << ", "
+                << ConvertShapeToLength(fShapeY) << " * sizeof(float), cudaMemcpyDeviceToDevice, fGPU.fStream));\n";
+         } else if (fAttrBeta != 0) {
+            throw std::runtime_error("TMVA SOFIE Gemm Op : Bias tensor is not present but beta value in Gemm is not zero");
+         }
+         out << SP << "fGPU.Gemm(" << (fAttrTransA ? "true" : "false") << ", "
+             << (fAttrTransB ? "true" : "false") << ", " << m << ", " << n << ", " << k << ", " << fAttrAlpha << ", tensor_" << fNA << ", tensor_" << fNB << ", "
+             << fAttrBeta << ", tensor_" << fNY << ");\n";
+         return out.str();
+      }
+
 
 
    };
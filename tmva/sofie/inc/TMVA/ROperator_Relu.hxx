@@ -61,6 +61,17 @@ public:
       return out.str();
    }
 
+   std::string GenerateGPU(std::string){
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE Relu called to GenerateGPU without being initialized first");
+      }
+      std::stringstream out;
+      out << "\n//------ RELU\n";
+      out << SP << "fGPU.Activation(CUDNN_ACTIVATION_RELU, tensor_" << fNX << ", tensor_" << fNY << ", "
+          << ConvertShapeToLength(fShape) << ");\n";
+      return out.str();
+   }
+
 };
 
 }//SOFIE
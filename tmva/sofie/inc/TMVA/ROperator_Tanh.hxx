@@ -60,6 +60,17 @@ public:
       return out.str();
    }
 
+   std::string GenerateGPU(std::string){
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE Tanh called to GenerateGPU without being initialized first");
+      }
+      std::stringstream out;
+      out << "\n//------ TANH\n";
+      out << SP << "fGPU.Activation(CUDNN_ACTIVATION_TANH, tensor_" << fNX << ", tensor_" << fNY << ", "
+          << ConvertShapeToLength(fShape) << ");\n";
+      return out.str();
+   }
+
 };
 
 }//SOFIE
@@ -2,6 +2,9 @@
 #define TMVA_SOFIE_SOFIE_HELPERS
 
 
+#include "ROOT/RVec.hxx"
+
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -63,6 +66,73 @@ auto SofieFunctor(unsigned int nslots = 0, const std::string & weightsFile = "")
    return SofieFunctorHelper<std::make_index_sequence<N>, Session_t, float>(nslots, weightsFile);
 }
 
+///Helper class used by SofieBatchFunctor to evaluate the
+///infer function of the generated model on batches of events
+template <typename I, typename F, typename T>
+class SofieBatchFunctorHelper;
+
+template <std::size_t... N,  typename Session_t, typename T>
+class SofieBatchFunctorHelper<std::index_sequence<N...>, Session_t, T> {
+   template <std::size_t Idx>
+   using AlwaysT = T;
+
+   std::size_t fBatchSize;
+   std::vector<std::vector<T>> fInput;
+   std::vector<Session_t> fSessions;
+
+public:
+
+   SofieBatchFunctorHelper(unsigned int nslots = 0, std::size_t batchSize = 1, const std::string & filename = "") :
+      fBatchSize(std::max<std::size_t>(batchSize, 1))
+   {
+      // create one Session per slot: the intermediate tensors of a Session are its data members,
+      // so that the Sessions of different slots can be used concurrently
+      if (nslots < 1) nslots = 1;
+      fInput.resize(nslots, std::vector<T>(fBatchSize * sizeof...(N)));
+      fSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++) {
+         fSessions.emplace_back(filename);
+      }
+   }
+
+   void operator()(unsigned slot, ROOT::RVec<double> &out, const ROOT::RVec<AlwaysT<N>> &... args) {
+      constexpr std::size_t nInputs = sizeof...(N);
+      auto &input = fInput[slot];
+      for (std::size_t first = 0; first < out.size(); first += fBatchSize) {
+         const std::size_t n = std::min(fBatchSize, out.size() - first);
+         // the events are the rows of the input tensor; the rows after the last event are left as they are
+         for (std::size_t i = 0; i < n; i++) {
+            using expander = int[];
+            (void)expander{0, (input[i * nInputs + N] = args[first + i], 0)...};
+         }
+         auto y = fSessions[slot].infer(input.data());
+         const std::size_t outputSize = y.size() / fBatchSize;
+         for (std::size_t i = 0; i < n; i++)
+            out[first + i] = y[i * outputSize];
+      }
+   }
+};
+
+/// SofieBatchFunctor : used to evaluate the model generated by SOFIE with
+/// RDataFrame::DefineBatch, i.e. on the batches of events of bulk processing mode.
+/// The model must have been generated for the given batch size, e.g. with
+/// `model.Generate(Options::kDefault, batchSize)`, and its single input tensor
+/// has shape `{batchSize, N}`: each call of the infer function then evaluates
+/// `batchSize` events at once, which avoids the overhead of one call per event.
+/// As for SofieFunctor, one Session is created per slot.
+/// The defined column holds the first output value of each event, as for SofieFunctor:
+/// ~~~{.cpp}
+/// df.SetBulkSize(1024);
+/// df.DefineBatch("DNN_Value", SofieBatchFunctor<7, TMVA_SOFIE_Higgs_trained_model::Session>(nslots, 256),
+///                {"m_jj", "m_jjj", "m_lv", "m_jlv", "m_bb", "m_wbb", "m_wwbb"});
+/// ~~~
+template <std::size_t N, typename Session_t>
+auto SofieBatchFunctor(unsigned int nslots = 0, std::size_t batchSize = 1, const std::string & weightsFile = "")
+   -> SofieBatchFunctorHelper<std::make_index_sequence<N>, Session_t, float>
+{
+   return SofieBatchFunctorHelper<std::make_index_sequence<N>, Session_t, float>(nslots, batchSize, weightsFile);
+}
+
 }//Experimental
 }//TMVA
 
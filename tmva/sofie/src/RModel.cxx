@@ -245,8 +245,26 @@ namespace SOFIE{
       if (fUseWeightFile && !fUseSession) {
          throw std::runtime_error("TMVA-SOFIE: RModel::Generate: cannot use a separate weight file without generating a Session class");
       }
+      const bool reuseMemory = !(static_cast<std::underlying_type_t<Options>>(Options::kNoMemoryReuse) & options);
+      const bool useGPU = static_cast<std::underlying_type_t<Options>>(Options::kGPU) & options;
+      if (useGPU && !fUseSession) {
+         throw std::runtime_error("TMVA-SOFIE: RModel::Generate: the GPU backend requires generating a Session class");
+      }
       fGC.clear();
       Initialize(batchSize);
+
+      // the code of the operators is generated first, since it defines which intermediate tensors can share memory
+      std::vector<std::string> operatorsCode(fOperators.size());
+      std::string sessionMembersCode;
+      std::string initCode;
+      for (size_t id = 0; id < fOperators.size(); id++) {
+         std::string opName = std::to_string(id);
+         operatorsCode[id] = useGPU ? fOperators[id]->GenerateGPU(opName) : fOperators[id]->Generate(opName);
+         if (fUseSession) {
+            sessionMembersCode += fOperators[id]->GenerateSessionMembersCode(opName);
+            initCode += fOperators[id]->GenerateInitCode();
+         }
+      }
       fGC += ("//Code generated automatically by TMVA for Inference of Model file [" + fFileName + "] at [" + fParseTime.substr(0, fParseTime.length()-1) +"] \n");
       // add header guards
       std::string hgname = fName;
@@ -266,6 +284,13 @@ namespace SOFIE{
       if (fUseWeightFile)
          fGC += "#include <fstream>\n";
 
+      if (useGPU) {
+         GenerateGPUSession(operatorsCode, sessionMembersCode, initCode, reuseMemory);
+         fGC += ("} //TMVA_SOFIE_" + fName + "\n");
+         fGC += "\n#endif  // " + hgname + "\n";
+         return;
+      }
+
       fGC += "\nnamespace TMVA_SOFIE_" + fName + "{\n";
       if (!fNeededBlasRoutines.empty()) {
          fGC += ("namespace BLAS{\n");
@@ -313,28 +338,11 @@ namespace SOFIE{
 
          }
       }
-      for (auto&i: fIntermediateTensorInfos){
-         size_t length = ConvertShapeToLength(i.second.shape);
-         if (i.second.type == ETensorType::FLOAT){
-            fGC += "std::vector<float> fTensor_" + i.first  + " = std::vector<float>(" + std::to_string(length) + ");\n";
-            fGC += "float * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
-         }
-         if (i.second.type == ETensorType::DOUBLE){
-            fGC += "std::vector<double> fTensor_" + i.first  + " = std::vector<double>(" + std::to_string(length) + ");\n";
-            fGC += "double * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
-         }
-         if (i.second.type == ETensorType::INT64){
-            fGC += "std::vector<int64_t> fTensor_" + i.first  + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
-            fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
-         }
-      }
+      fGC += GenerateIntermediateTensorsCode(operatorsCode, sessionMembersCode + initCode, reuseMemory);
       if (fUseSession) {
          // add here specific operator code that needs to define session data members
          fGC += "\n";
-         for (size_t id = 0; id < fOperators.size(); id++) {
-            std::string opName = std::to_string(id);
-            fGC += fOperators[id]->GenerateSessionMembersCode(opName);
-         }
+         fGC += sessionMembersCode;
          fGC += "\n";
          // here add initialization and reading of weight tensors
          if (fUseWeightFile) {
@@ -348,9 +356,7 @@ namespace SOFIE{
             fGC += "Session(std::string = \"\") {\n";
          }
          // add here initialization code
-         for (size_t id = 0; id < fOperators.size() ; id++){
-            fGC += fOperators[id]->GenerateInitCode();
-         }
+         fGC += initCode;
          fGC += "}\n\n";
       }
 
@@ -415,8 +421,8 @@ namespace SOFIE{
 
       const std::string SP = "   ";
 
-      for (size_t id = 0; id < fOperators.size() ; id++){
-         fGC+= (fOperators[id]->Generate(std::to_string(id)));
+      for (auto &code : operatorsCode) {
+         fGC += code;
       }
       if (outputSize == 1) {
          size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[0]));
@@ -456,6 +462,354 @@ namespace SOFIE{
       fGC += "\n#endif  // " + hgname + "\n";
    }
 
+   namespace {
+   // whether the generated code uses the variable prefix + tensorName
+   bool UsesTensor(const std::string &code, const std::string &prefix, const std::string &tensorName) {
+      const std::string var = prefix + tensorName;
+      auto isIdChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+      for (auto pos = code.find(var); pos != std::string::npos; pos = code.find(var, pos + 1)) {
+         const auto end = pos + var.size();
+         if ((pos == 0 || !isIdChar(code[pos - 1])) && (end == code.size() || !isIdChar(code[end])))
+            return true;
+      }
+      return false;
+   }
+   } // namespace
+
+   std::string RModel::GenerateIntermediateTensorsCode(const std::vector<std::string> &operatorsCode,
+                                                       const std::string &sessionCode, bool reuseMemory,
+                                                       bool onDevice) {
+      // An intermediate tensor is only needed from the first to the last operator whose code uses it, so the
+      // tensors whose lifetimes do not overlap can share the same buffer: each buffer of the pool is given to a
+      // tensor when the last operator using the previous one has run. The output tensors, the tensors used by
+      // the initialization code of the session and the ones whose std::vector is used keep their own buffer.
+      // For the GPU backend the buffers are in device memory, apart from the tensors filled by the initialization
+      // code, which run on the host: these are copied to the device by the constructor of the Session.
+      struct Lifetime {
+         std::string name;
+         size_t first;
+         size_t last;
+      };
+      struct Buffer {
+         ETensorType type;
+         size_t length;
+         size_t last;
+      };
+      std::vector<Lifetime> lifetimes;
+      std::unordered_map<std::string, size_t> bufferIndex;
+      std::vector<Buffer> buffers;
+      auto isSupportedType = [](ETensorType type) {
+         return type == ETensorType::FLOAT || type == ETensorType::DOUBLE || type == ETensorType::INT64;
+      };
+      for (auto &i : fIntermediateTensorInfos) {
+         if (!reuseMemory)
+            break;
+         if (!isSupportedType(i.second.type) ||
+             std::find(fOutputTensorNames.begin(), fOutputTensorNames.end(), i.first) != fOutputTensorNames.end() ||
+             UsesTensor(sessionCode, "tensor_", i.first) || UsesTensor(sessionCode, "fTensor_", i.first))
+            continue;
+         Lifetime lifetime{i.first, operatorsCode.size(), 0};
+         bool usesVector = false;
+         for (size_t id = 0; id < operatorsCode.size(); id++) {
+            usesVector |= UsesTensor(operatorsCode[id], "fTensor_", i.first);
+            if (UsesTensor(operatorsCode[id], "tensor_", i.first)) {
+               lifetime.first = std::min(lifetime.first, id);
+               lifetime.last = id;
+            }
+         }
+         if (!usesVector && lifetime.first < operatorsCode.size())
+            lifetimes.push_back(lifetime);
+      }
+      std::sort(lifetimes.begin(), lifetimes.end(), [](const Lifetime &a, const Lifetime &b) {
+         return a.first != b.first ? a.first < b.first : a.name < b.name;
+      });
+      for (auto &lifetime : lifetimes) {
+         const auto &info = fIntermediateTensorInfos[lifetime.name];
+         const size_t length = ConvertShapeToLength(info.shape);
+         // among the free buffers take the smallest one large enough, otherwise the largest one
+         size_t best = buffers.size();
+         for (size_t ib = 0; ib < buffers.size(); ib++) {
+            if (buffers[ib].type != info.type || buffers[ib].last >= lifetime.first)
+               continue;
+            if (best == buffers.size()) {
+               best = ib;
+               continue;
+            }
+            const bool fits = buffers[ib].length >= length;
+            const bool bestFits = buffers[best].length >= length;
+            if ((fits && (!bestFits || buffers[ib].length < buffers[best].length)) ||
+                (!fits && !bestFits && buffers[ib].length > buffers[best].length))
+               best = ib;
+         }
+         if (best == buffers.size())
+            buffers.push_back({info.type, 0, 0});
+         buffers[best].length = std::max(buffers[best].length, length);
+         buffers[best].last = lifetime.last;
+         bufferIndex[lifetime.name] = best;
+      }
+
+      std::string code;
+      for (size_t ib = 0; ib < buffers.size(); ib++) {
+         const std::string type = ConvertTypeToString(buffers[ib].type);
+         const std::string length = std::to_string(buffers[ib].length);
+         if (onDevice) {
+            code += "GPU::Buffer<" + type + "> fIntermediateBuffer_" + std::to_string(ib) + " = GPU::Allocate<" +
+                    type + ">(" + length + ");\n";
+         } else {
+            code += "std::vector<" + type + "> fIntermediateBuffer_" + std::to_string(ib) + " = std::vector<" +
+                    type + ">(" + length + ");\n";
+         }
+      }
+      for (auto &i : fIntermediateTensorInfos) {
+         if (!isSupportedType(i.second.type))
+            continue;
+         const std::string type = ConvertTypeToString(i.second.type);
+         const std::string length = std::to_string(ConvertShapeToLength(i.second.shape));
+         auto ib = bufferIndex.find(i.first);
+         if (ib != bufferIndex.end()) {
+            code += type + " * tensor_" + i.first + " = fIntermediateBuffer_" + std::to_string(ib->second) +
+                    (onDevice ? ".get();\n" : ".data();\n");
+         } else if (onDevice && !UsesTensor(sessionCode, "tensor_", i.first)) {
+            code += "GPU::Buffer<" + type + "> fDevice_" + i.first + " = GPU::Allocate<" + type + ">(" + length +
+                    ");\n";
+            code += type + " * tensor_" + i.first + " = fDevice_" + i.first + ".get();\n";
+         } else {
+            code += "std::vector<" + type + "> fTensor_" + i.first + " = std::vector<" + type + ">(" + length +
+                    ");\n";
+            code += type + " * tensor_" + i.first + " = fTensor_" + i.first + ".data();\n";
+            if (onDevice)
+               code += "GPU::Buffer<" + type + "> fDevice_" + i.first + ";\n";
+         }
+      }
+      return code;
+   }
+
+   namespace {
+   // helpers of the code generated for the GPU backend: RAII wrappers of the device memory and of the
+   // CUDA stream, cuBLAS and cuDNN handles, and the calls of the library functions used by the operators
+   const char *kGPUHelpersCode = R"(namespace GPU{
+inline void Check(cudaError_t status) {
+   if (status != cudaSuccess)
+      throw std::runtime_error(std::string("TMVA-SOFIE CUDA error: ") + cudaGetErrorString(status));
+}
+inline void Check(cublasStatus_t status) {
+   if (status != CUBLAS_STATUS_SUCCESS)
+      throw std::runtime_error("TMVA-SOFIE cuBLAS error " + std::to_string(static_cast<int>(status)));
+}
+inline void Check(cudnnStatus_t status) {
+   if (status != CUDNN_STATUS_SUCCESS)
+      throw std::runtime_error(std::string("TMVA-SOFIE cuDNN error: ") + cudnnGetErrorString(status));
+}
+struct Free {
+   void operator()(void *p) const { cudaFree(p); }
+};
+template <typename T>
+using Buffer = std::unique_ptr<T, Free>;
+template <typename T>
+Buffer<T> Allocate(std::size_t n) {
+   void *p = nullptr;
+   Check(cudaMalloc(&p, n * sizeof(T)));
+   return Buffer<T>(static_cast<T *>(p));
+}
+template <typename T>
+Buffer<T> Upload(const std::vector<T> &v) {
+   auto buffer = Allocate<T>(v.size());
+   Check(cudaMemcpy(buffer.get(), v.data(), v.size() * sizeof(T), cudaMemcpyHostToDevice));
+   return buffer;
+}
+struct Context {
+   cudaStream_t fStream = nullptr;
+   cublasHandle_t fBlas = nullptr;
+   cudnnHandle_t fDnn = nullptr;
+   cudnnTensorDescriptor_t fTensorDesc = nullptr;
+   cudnnActivationDescriptor_t fActivationDesc = nullptr;
+   Context() {
+      Check(cudaStreamCreate(&fStream));
+      Check(cublasCreate(&fBlas));
+      Check(cublasSetStream(fBlas, fStream));
+      Check(cudnnCreate(&fDnn));
+      Check(cudnnSetStream(fDnn, fStream));
+      Check(cudnnCreateTensorDescriptor(&fTensorDesc));
+      Check(cudnnCreateActivationDescriptor(&fActivationDesc));
+   }
+   Context(Context &&other)
+      : fStream(std::exchange(other.fStream, nullptr)), fBlas(std::exchange(other.fBlas, nullptr)),
+        fDnn(std::exchange(other.fDnn, nullptr)), fTensorDesc(std::exchange(other.fTensorDesc, nullptr)),
+        fActivationDesc(std::exchange(other.fActivationDesc, nullptr)) {}
+   Context(const Context &) = delete;
+   Context &operator=(const Context &) = delete;
+   Context &operator=(Context &&) = delete;
+   ~Context() {
+      if (fActivationDesc) cudnnDestroyActivationDescriptor(fActivationDesc);
+      if (fTensorDesc) cudnnDestroyTensorDescriptor(fTensorDesc);
+      if (fDnn) cudnnDestroy(fDnn);
+      if (fBlas) cublasDestroy(fBlas);
+      if (fStream) cudaStreamDestroy(fStream);
+   }
+   void Synchronize() { Check(cudaStreamSynchronize(fStream)); }
+   // row major Y = alpha * op(A) * op(B) + beta * Y, computed as the column major Y^T = op(B)^T * op(A)^T
+   void Gemm(bool transA, bool transB, int m, int n, int k, float alpha, const float *A, const float *B, float beta,
+             float *Y) {
+      Check(cublasSgemm(fBlas, transB ? CUBLAS_OP_T : CUBLAS_OP_N, transA ? CUBLAS_OP_T : CUBLAS_OP_N, n, m, k, &alpha,
+                        B, transB ? k : n, A, transA ? m : k, &beta, Y, n));
+   }
+   void Activation(cudnnActivationMode_t mode, const float *X, float *Y, int n) {
+      const float alpha = 1, beta = 0;
+      Check(cudnnSetTensor4dDescriptor(fTensorDesc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, 1, 1, 1, n));
+      Check(cudnnSetActivationDescriptor(fActivationDesc, mode, CUDNN_PROPAGATE_NAN, 0.));
+      Check(cudnnActivationForward(fDnn, fActivationDesc, &alpha, fTensorDesc, X, &beta, fTensorDesc, Y));
+   }
+};
+}//GPU
+)";
+   } // namespace
+
+   void RModel::GenerateGPUSession(const std::vector<std::string> &operatorsCode, const std::string &sessionMembersCode,
+                                   const std::string &initCode, bool reuseMemory) {
+      // The Session of the GPU backend owns a CUDA stream on which all the operators are run asynchronously, with
+      // the tensors in device memory. The weights are read on the host and copied to the device by the constructor.
+      // Besides infer(), which takes and returns host data, inferDevice() takes the input and output tensors in
+      // device memory and returns without waiting for the result, see GetStream().
+      for (auto &name : fInputTensorNames) {
+         if (fReadyInputTensorInfos[name].type != ETensorType::FLOAT)
+            throw std::runtime_error("TMVA-SOFIE: the GPU backend supports only float input tensors, " + name +
+                                     " is of type " + ConvertTypeToString(fReadyInputTensorInfos[name].type));
+      }
+      for (auto &i : fIntermediateTensorInfos) {
+         if (i.second.type != ETensorType::FLOAT)
+            throw std::runtime_error("TMVA-SOFIE: the GPU backend supports only float tensors, " + i.first +
+                                     " is of type " + ConvertTypeToString(i.second.type));
+      }
+      const std::string SP = "   ";
+      const std::string sessionCode = sessionMembersCode + initCode;
+
+      fGC += "#include <cuda_runtime.h>\n";
+      fGC += "#include <cublas_v2.h>\n";
+      fGC += "#include <cudnn.h>\n";
+      fGC += "#include <memory>\n";
+      fGC += "#include <stdexcept>\n";
+      fGC += "#include <string>\n";
+      fGC += "#include <utility>\n";
+      fGC += "\nnamespace TMVA_SOFIE_" + fName + "{\n";
+      fGC += kGPUHelpersCode;
+      fGC += "struct Session {\n";
+      fGC += "GPU::Context fGPU;\n";
+      // the tensors which are copied to the device by the constructor
+      std::vector<std::string> uploadedTensors;
+      for (auto &i : fInitializedTensors) {
+         if (i.second.fType != ETensorType::FLOAT)
+            continue;
+         const size_t length = ConvertShapeToLength(i.second.fShape);
+         if (!fUseWeightFile) {
+            fGC += "std::vector<float> fTensor_" + i.first + " = {";
+            std::shared_ptr<float> data = std::static_pointer_cast<float>(i.second.fData);
+            std::stringstream floats;
+            for (size_t idx = 0; idx < length - 1; idx++) {
+               floats << std::setprecision(std::numeric_limits<float>::max_digits10) << data.get()[idx] << ", ";
+            }
+            floats << std::setprecision(std::numeric_limits<float>::max_digits10) << data.get()[length - 1];
+            fGC += floats.str();
+            fGC += "};\n";
+         } else {
+            fGC += "std::vector<float> fTensor_" + i.first + " = std::vector<float>(" + std::to_string(length) + ");\n";
+         }
+         fGC += "float * tensor_" + i.first + " = fTensor_" + i.first + ".data();\n";
+         fGC += "GPU::Buffer<float> fDevice_" + i.first + ";\n";
+         uploadedTensors.push_back(i.first);
+      }
+      for (auto &i : fIntermediateTensorInfos) {
+         if (UsesTensor(sessionCode, "tensor_", i.first))
+            uploadedTensors.push_back(i.first);
+      }
+      fGC += GenerateIntermediateTensorsCode(operatorsCode, sessionCode, reuseMemory, true);
+      for (auto &name : fInputTensorNames) {
+         fGC += "GPU::Buffer<float> fInput_" + name + " = GPU::Allocate<float>(" +
+                std::to_string(ConvertShapeToLength(GetTensorShape(name))) + ");\n";
+      }
+      fGC += "\n";
+      fGC += sessionMembersCode;
+      fGC += "\n";
+      if (fUseWeightFile) {
+         fGC += "Session(std::string filename =\"\") {\n";
+         fGC += "   if (filename.empty()) filename = \"" + fName + ".dat\";\n";
+         ReadInitializedTensorsFromFile();
+      } else {
+         fGC += "Session(std::string = \"\") {\n";
+      }
+      fGC += initCode;
+      for (auto &name : uploadedTensors) {
+         fGC += SP + "fDevice_" + name + " = GPU::Upload(fTensor_" + name + ");\n";
+         fGC += SP + "tensor_" + name + " = fDevice_" + name + ".get();\n";
+         fGC += SP + "fTensor_" + name + " = std::vector<float>();\n";
+      }
+      fGC += "}\n\n";
+
+      // the operators, reading the inputs from device memory
+      std::string inputArgs;
+      std::string inputNames;
+      std::string inputBuffers;
+      for (auto &name : fInputTensorNames) {
+         inputArgs += "const float* tensor_" + name + ",";
+         inputNames += "tensor_" + name + ",";
+         inputBuffers += "fInput_" + name + ".get(),";
+      }
+      inputArgs.pop_back();
+      inputNames.pop_back();
+      inputBuffers.pop_back();
+      fGC += "void run(" + inputArgs + "){\n";
+      for (auto &code : operatorsCode) {
+         fGC += code;
+      }
+      fGC += "}\n\n";
+
+      const size_t outputSize = fOutputTensorNames.size();
+      for (auto &name : fOutputTensorNames) {
+         if (fIntermediateTensorInfos.find(name) == fIntermediateTensorInfos.end())
+            throw std::runtime_error("TMVA-SOFIE: output tensor " + name + " not found when trying to get its info");
+      }
+      auto outputLength = [&](size_t i) {
+         return std::to_string(ConvertShapeToLength(GetTensorShape(fOutputTensorNames[i])));
+      };
+
+      // device version: asynchronous on the stream of the Session
+      fGC += "void inferDevice(" + inputArgs;
+      for (size_t i = 0; i < outputSize; i++)
+         fGC += ", float* output_" + std::to_string(i);
+      fGC += "){\n";
+      fGC += SP + "run(" + inputNames + ");\n";
+      for (size_t i = 0; i < outputSize; i++) {
+         fGC += SP + "GPU::Check(cudaMemcpyAsync(output_" + std::to_string(i) + ", tensor_" + fOutputTensorNames[i] +
+                ", " + outputLength(i) + " * sizeof(float), cudaMemcpyDeviceToDevice, fGPU.fStream));\n";
+      }
+      fGC += "}\n\n";
+
+      // host version, with the same signature as the one of the CPU Session
+      fGC += (outputSize == 1) ? "std::vector<float> " : "std::vector<std::vector<float>> ";
+      fGC += "infer(";
+      for (auto &name : fInputTensorNames)
+         fGC += "float* tensor_" + name + ",";
+      fGC.pop_back();
+      fGC += "){\n";
+      for (auto &name : fInputTensorNames) {
+         fGC += SP + "GPU::Check(cudaMemcpyAsync(fInput_" + name + ".get(), tensor_" + name + ", " +
+                std::to_string(ConvertShapeToLength(GetTensorShape(name))) +
+                " * sizeof(float), cudaMemcpyHostToDevice, fGPU.fStream));\n";
+      }
+      fGC += SP + "run(" + inputBuffers + ");\n";
+      fGC += SP + "std::vector<std::vector<float>> ret(" + std::to_string(outputSize) + ");\n";
+      for (size_t i = 0; i < outputSize; i++) {
+         const std::string ret = "ret[" + std::to_string(i) + "]";
+         fGC += SP + ret + ".resize(" + outputLength(i) + ");\n";
+         fGC += SP + "GPU::Check(cudaMemcpyAsync(" + ret + ".data(), tensor_" + fOutputTensorNames[i] + ", " +
+                outputLength(i) + " * sizeof(float), cudaMemcpyDeviceToHost, fGPU.fStream));\n";
+      }
+      fGC += SP + "fGPU.Synchronize();\n";
+      fGC += SP + (outputSize == 1 ? "return ret[0];\n" : "return ret;\n");
+      fGC += "}\n\n";
+      fGC += "cudaStream_t GetStream() const { return fGPU.fStream; }\n";
+      fGC += "};\n";
+   }
+
    void RModel::ReadInitializedTensorsFromFile() {
       // generate the code to read initialized tensors from a text data file
       if (fInitializedTensors.empty()) return;
@@ -0,0 +1,48 @@
+#include "TMVA/SOFIEHelpers.hxx"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace TMVA::Experimental;
+
+// A Session as generated by SOFIE for a model with an input tensor of shape {4, 2} and an output
+// tensor of shape {4, 2}: the outputs of an event are the sum and the difference of its two inputs
+struct FakeSession {
+   FakeSession(std::string = "") {}
+   std::vector<float> infer(float *x)
+   {
+      std::vector<float> y(8);
+      for (int i = 0; i < 4; i++) {
+         y[2 * i] = x[2 * i] + x[2 * i + 1];
+         y[2 * i + 1] = x[2 * i] - x[2 * i + 1];
+      }
+      return y;
+   }
+};
+
+TEST(SofieHelpers, BatchFunctor)
+{
+   auto functor = SofieBatchFunctor<2, FakeSession>(1, 4);
+   ROOT::RVecF a{1, 2, 3, 4, 5, 6};
+   ROOT::RVecF b{10, 20, 30, 40, 50, 60};
+   ROOT::RVecD out(a.size());
+   functor(0, out, a, b);
+   EXPECT_EQ(std::vector<double>(out.begin(), out.end()), std::vector<double>({11, 22, 33, 44, 55, 66}));
+}
+
+TEST(SofieHelpers, BatchFunctorRDF)
+{
+   ROOT::RDataFrame df(10);
+   df.SetBulkSize(6);
+   auto values = df.Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                    .Define("y", [](ULong64_t e) { return float(2 * e); }, {"rdfentry_"})
+                    .DefineBatch("s", SofieBatchFunctor<2, FakeSession>(df.GetNSlots(), 4), {"x", "y"})
+                    .Take<double>("s");
+   ASSERT_EQ(values->size(), 10u);
+   for (unsigned int i = 0; i < 10; i++)
+      EXPECT_EQ(values->at(i), 3. * i);
+}
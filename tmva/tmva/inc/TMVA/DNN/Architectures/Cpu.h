@@ -33,6 +33,7 @@
 
 #include <vector>
 #include <string>
+#include <algorithm>
 
 class TRandom;
 
@@ -53,6 +54,9 @@ namespace DNN
 
  struct DummyEmptyDescriptor {};
 
+ template <typename AFloat>
+ struct TCpuConvWorkspace;
+
 /** The TCpu architecture class.
  *
  * Low-level interface class for multi-threaded CPU architectures. Contains as
@@ -155,10 +159,12 @@ public:
    static void ReleaseBNormDescriptors(TDescriptors * & /*descriptors*/) {}
    static void ReleaseRNNDescriptors(TDescriptors *& /*descriptors*/) {}
 
-   static void InitializeConvWorkspace(TWorkspace * & /*workspace*/,
+   /** Allocate the workspace of a convolutional layer (a TCpuConvWorkspace), holding the
+    *  buffers of its convolutions which are reused from one batch to the next. */
+   static void InitializeConvWorkspace(TWorkspace * & workspace,
                                        TDescriptors * & /*descriptors*/,
                                        const DNN::CNN::TConvParams & /*params*/,
-                                       ConvLayer_t * /*L = nullptr*/) {}
+                                       ConvLayer_t * /*L = nullptr*/);
    static void InitializePoolDropoutWorkspace(TWorkspace * & /*workspace*/,
                                        TDescriptors * & /*descriptors*/,
                                        const DNN::CNN::TConvParams & /*params*/,
@@ -568,7 +574,8 @@ public:
    static void CalculateConvActivationGradients(Tensor_t &activationGradientsBackward, const Tensor_t &df,
                                                 const Matrix_t &weights, size_t batchSize, size_t inputHeight,
                                                 size_t inputWidth, size_t depth, size_t height, size_t width,
-                                                size_t filterDepth, size_t filterHeight, size_t filterWidth);
+                                                size_t filterDepth, size_t filterHeight, size_t filterWidth,
+                                                TCpuConvWorkspace<AReal> *workspace = nullptr);
 
    /** Utility function for calculating the weight gradients of the convolutional
     * layer. */
@@ -576,7 +583,7 @@ public:
                                             const Tensor_t &activations_backward, size_t batchSize, size_t inputHeight,
                                             size_t inputWidth, size_t depth, size_t height, size_t width,
                                             size_t filterDepth, size_t filterHeight, size_t filterWidth,
-                                            size_t nLocalViews);
+                                            size_t nLocalViews, TCpuConvWorkspace<AReal> *workspace = nullptr);
 
    /** Utility function for calculating the bias gradients of the convolutional
     *  layer */
@@ -814,6 +821,55 @@ public:
 
 };
 
+//____________________________________________________________________________
+/** Buffers of the convolutions of a TConvLayer with the TCpu architecture,
+ *  allocated at the first use and then reused for all the batches.
+ *  The batch is split in as many partitions as threads, each with its
+ *  own im2col and product matrices. */
+template <typename AFloat>
+struct TCpuConvWorkspace : public CNN::TCNNWorkspace<CNN::TConvLayer<TCpu<AFloat>>> {
+   std::vector<int> ForwardIndices;        ///< im2col indices of the forward convolution
+   std::vector<int> ActivationGradIndices; ///< im2col indices of the convolution giving the activation gradients
+   std::vector<int> WeightGradIndices;     ///< im2col indices of the convolution giving the weight gradients
+
+   std::vector<TCpuMatrix<AFloat>> ForwardBuffers;        ///< im2col matrices of the forward convolution
+   std::vector<TCpuMatrix<AFloat>> ActivationGradBuffers; ///< im2col matrices of the activation gradients
+   std::vector<TCpuMatrix<AFloat>> WeightGradBuffers;     ///< im2col matrices of the weight gradients
+   std::vector<TCpuMatrix<AFloat>> WeightGradProducts;    ///< weight gradients of one event
+   std::vector<TCpuMatrix<AFloat>> WeightGradSums;        ///< weight gradients summed over a partition
+
+   TCpuMatrix<AFloat> RotatedWeights;  ///< rotated weights of the activation gradients convolution
+   TCpuTensor<AFloat> ActivationDerivatives; ///< derivatives of the activation function times the gradients
+
+   /** Number of partitions of a batch processed in parallel. */
+   static size_t GetNPartitions(size_t batchSize)
+   {
+      size_t nThreads = TCpuMatrix<AFloat>::GetThreadExecutor().GetPoolSize();
+      return std::max<size_t>(1, std::min(batchSize, nThreads));
+   }
+
+   /** Make sure that there are at least \p n matrices of the given shape in \p buffers. */
+   static void ReserveBuffers(std::vector<TCpuMatrix<AFloat>> &buffers, size_t n, size_t nRows, size_t nCols)
+   {
+      if (!buffers.empty() && (buffers[0].GetNrows() != nRows || buffers[0].GetNcols() != nCols))
+         buffers.clear();
+      while (buffers.size() < n)
+         buffers.emplace_back(nRows, nCols);
+   }
+
+   /** Compute the im2col indices, unless they were already computed for the same sizes. */
+   static void ReserveIndices(std::vector<int> &indices, size_t n, const TCpuMatrix<AFloat> &B, size_t nLocalViews,
+                              size_t imgHeight, size_t imgWidth, size_t fltHeight, size_t fltWidth, size_t strideRows,
+                              size_t strideCols, size_t zeroPaddingHeight, size_t zeroPaddingWidth)
+   {
+      if (indices.size() == n)
+         return;
+      indices.resize(n);
+      TCpu<AFloat>::Im2colIndices(indices, B, nLocalViews, imgHeight, imgWidth, fltHeight, fltWidth, strideRows,
+                                  strideCols, zeroPaddingHeight, zeroPaddingWidth);
+   }
+};
+
 //____________________________________________________________________________
 template <typename AReal>
 template <typename AMatrix_t>
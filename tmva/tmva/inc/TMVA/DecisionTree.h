@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TH2.h"
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "TMVA/Types.h"
@@ -62,6 +64,36 @@ namespace TMVA {
 
    class Event;
 
+   /// Quantization of the input variables used by the histogram based training of the
+   /// decision trees, see DecisionTree::SetBinning(). The bins of each variable contain
+   /// about the same number of events, and the bins of all the events are computed once,
+   /// so that the trees of a forest can be trained on integer bin indices.
+   class DecisionTreeBinning {
+   public:
+      DecisionTreeBinning(const std::vector<const TMVA::Event*> &events, UInt_t nVars, UInt_t nBins);
+
+      UInt_t GetNVars() const { return fNVars; }
+      UInt_t GetNBins(UInt_t ivar) const { return fCutValues[ivar].size() + 1; }
+      /// Index of the first bin of the variable in the histograms of all the variables
+      UInt_t GetBinOffset(UInt_t ivar) const { return fBinOffsets[ivar]; }
+      UInt_t GetTotalNBins() const { return fBinOffsets[fNVars]; }
+      /// Lower edges of the bins of the variable, apart from the first one
+      const std::vector<Double_t> &GetCutValues(UInt_t ivar) const { return fCutValues[ivar]; }
+      /// Bins of the variables of the event, nullptr if the event was not known when binning
+      const UShort_t *GetBins(const TMVA::Event *e) const
+      {
+         auto it = fEventIndex.find(e);
+         return it == fEventIndex.end() ? nullptr : &fBins[it->second * fNVars];
+      }
+
+   private:
+      UInt_t fNVars;
+      std::vector<std::vector<Double_t>> fCutValues;
+      std::vector<UInt_t> fBinOffsets;
+      std::unordered_map<const TMVA::Event*, UInt_t> fEventIndex;
+      std::vector<UShort_t> fBins; ///< bins of the variables of the events, event after event
+   };
+
    class DecisionTree : public BinaryTree {
 
    private:
@@ -108,6 +140,7 @@ namespace TMVA {
       Double_t TrainNode( const EventConstList & eventSample,  DecisionTreeNode *node ) { return TrainNodeFast( eventSample, node ); }
       Double_t TrainNodeFast( const EventConstList & eventSample,  DecisionTreeNode *node );
       Double_t TrainNodeFull( const EventConstList & eventSample,  DecisionTreeNode *node );
+      Double_t TrainNodeHist( const EventConstList & eventSample,  DecisionTreeNode *node );
       void    GetRandomisedVariables(Bool_t *useVariable, UInt_t *variableMap, UInt_t & nVars);
       std::vector<Double_t>  GetFisherCoefficients(const EventConstList &eventSample, UInt_t nFisherVars, UInt_t *mapVarInFisher);
 
@@ -192,6 +225,9 @@ namespace TMVA {
       inline void SetMinLinCorrForFisher(Double_t min){fMinLinCorrForFisher = min;}
       inline void SetUseExclusiveVars(Bool_t t=kTRUE){fUseExclusiveVars = t;}
       inline void SetNVars(Int_t n){fNvars = n;}
+      /// Train the nodes with the histograms of the given binning of the variables instead
+      /// of the grid of NCuts cuts in the range of each node, see TrainNodeHist()
+      inline void SetBinning(const DecisionTreeBinning *binning) { fBinning = binning; }
 
    private:
       // utility functions
@@ -202,6 +238,10 @@ namespace TMVA {
       // calculates the purity S/(S+B) of a given event sample
       Double_t SamplePurity(EventList eventSample);
 
+      std::vector<Double_t> FillHistograms(const EventConstList &eventSample) const;
+      void FillDaughterHistograms(DecisionTreeNode *node, const EventConstList &leftSample,
+                                  const EventConstList &rightSample);
+
       UInt_t    fNvars;               ///< number of variables used to separate S and B
       Int_t     fNCuts;               ///< number of grid point in variable cut scans
       Bool_t    fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
@@ -240,6 +280,9 @@ namespace TMVA {
 
       DataSetInfo*  fDataSetInfo;
 
+      const DecisionTreeBinning *fBinning = nullptr; ///<! binning of the variables for the histogram based training
+      std::map<const DecisionTreeNode*, std::vector<Double_t>> fNodeHistograms; ///<! histograms of the nodes to be trained
+
       ClassDef(DecisionTree,0);               // implementation of a Decision Tree
    };
 
@@ -200,6 +200,9 @@ namespace TMVA {
       // signal/background classification response
       Double_t GetMvaValue( const TMVA::Event* const ev, Double_t* err = nullptr, Double_t* errUpper = nullptr );
 
+      // classification response for a block of events, given as nEvents rows of GetNvar() input values
+      virtual void GetBatchMvaValues( const Float_t* inputs, UInt_t nEvents, Float_t* mvaValues );
+
    protected:
       // helper function to set errors to -1
       void NoErrorCalc(Double_t* const err, Double_t* const errUpper);
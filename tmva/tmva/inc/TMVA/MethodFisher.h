@@ -82,6 +82,7 @@ namespace TMVA {
 
       // calculate the MVA value
       Double_t GetMvaValue( Double_t* err = nullptr, Double_t* errUpper = nullptr );
+      void GetBatchMvaValues( const Float_t* inputs, UInt_t nEvents, Float_t* mvaValues );
 
       enum EFisherMethod { kFisher, kMahalanobis };
       EFisherMethod GetFisherMethod( void ) { return fFisherMethod; }
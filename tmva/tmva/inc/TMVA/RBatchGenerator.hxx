@@ -0,0 +1,258 @@
+#ifndef TMVA_RBATCHGENERATOR
+#define TMVA_RBATCHGENERATOR
+
+#include "TMVA/RTensor.hxx"
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RInterface.hxx"
+#include "ROOT/RDF/Utils.hxx" // ROOT::Internal::RDF::GetNSlots
+
+#include <algorithm>          // std::shuffle, std::sort
+#include <condition_variable>
+#include <deque>
+#include <exception>          // std::exception_ptr
+#include <mutex>
+#include <numeric>            // std::iota
+#include <random>             // std::mt19937
+#include <stdexcept>          // std::runtime_error
+#include <string>
+#include <thread>
+#include <utility>            // std::move
+#include <vector>
+
+namespace TMVA {
+namespace Experimental {
+
+/// \brief Generator of batches of events read directly from an RDataFrame
+///
+/// The events are not copied in memory all together, as done by TMVA::DataLoader:
+/// the dataset is read in chunks of `chunkSize` consecutive entries, each chunk is
+/// shuffled and split in batches of `batchSize` events, given as row-major RTensors
+/// of shape `{batchSize, nColumns}` and type float. The chunks are read in a random order
+/// by a background thread, which loads the next chunk while the batches of the current
+/// one are used. At most about `3 * chunkSize * nColumns * sizeof(float)` bytes are used
+/// (the queued batches, the chunk being read and its copy sorted by entry number):
+/// the memory used is set by `chunkSize`, whatever the size of the dataset.
+///
+/// The events of the dataframe node can be selected by upstream Filters, then the chunks
+/// contain `chunkSize` entries of the original dataset before the selection. Any
+/// dataset RDataFrame can read can be used, e.g. TTrees or an RNTuple with
+/// ROOT::Experimental::MakeNTupleDataFrame(). Each chunk is read in its own event loop,
+/// which also runs over the entries outside the chunk without reading their columns:
+/// larger chunks mean fewer loops over the dataset.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// RBatchGenerator<float, float, int> generator(df, {"x", "y", "label"}, 256, 1000000);
+/// for (int epoch = 0; epoch < nEpochs; epoch++) {
+///    generator.Start();
+///    while (generator.HasNextBatch()) {
+///       auto batch = generator.GetNextBatch(); // {256, 3}, the last one can be smaller
+///       // train on batch.GetData()
+///    }
+/// }
+/// ~~~
+template <typename... ColumnTypes>
+class RBatchGenerator {
+   ROOT::RDF::RNode fDataFrame;
+   std::vector<std::string> fColumns;
+   std::size_t fBatchSize;
+   std::size_t fChunkSize;
+   bool fShuffle;
+   std::mt19937 fRng;
+   ULong64_t fNEntries = 0; ///< upper bound of the entry numbers of the events of the dataframe
+   ULong64_t fNEvents = 0;  ///< number of events of the dataframe, i.e. after its filters
+   unsigned int fNSlots;
+
+   std::size_t fMaxQueuedBatches;
+   std::deque<RTensor<float>> fBatches;
+   bool fLoading = false;
+   bool fStop = false;
+   std::exception_ptr fException;
+   std::mutex fMutex;
+   std::condition_variable fCondition;
+   std::thread fLoader;
+
+   /// Read the events of the entries [begin, end) in the order of the entry numbers
+   std::vector<float> LoadChunk(ULong64_t begin, ULong64_t end)
+   {
+      const std::size_t nColumns = fColumns.size();
+      std::vector<std::vector<ULong64_t>> entries(fNSlots);
+      std::vector<std::vector<float>> values(fNSlots);
+      auto fill = [&entries, &values](unsigned int slot, ULong64_t entry, const ColumnTypes &... columns) {
+         entries[slot].push_back(entry);
+         auto &v = values[slot];
+         using expander = int[];
+         (void)expander{0, (v.push_back(static_cast<float>(columns)), 0)...};
+      };
+      std::vector<std::string> columns{"rdfentry_"};
+      columns.insert(columns.end(), fColumns.begin(), fColumns.end());
+      fDataFrame.Filter([begin, end](ULong64_t entry) { return entry >= begin && entry < end; }, {"rdfentry_"})
+         .ForeachSlot(fill, columns);
+
+      // with several threads the order of the events depends on the scheduling
+      std::vector<std::pair<ULong64_t, const float *>> events;
+      for (unsigned int slot = 0; slot < fNSlots; slot++) {
+         for (std::size_t i = 0; i < entries[slot].size(); i++)
+            events.emplace_back(entries[slot][i], values[slot].data() + i * nColumns);
+      }
+      std::sort(events.begin(), events.end());
+      std::vector<float> chunk(events.size() * nColumns);
+      for (std::size_t i = 0; i < events.size(); i++)
+         std::copy(events[i].second, events[i].second + nColumns, chunk.begin() + i * nColumns);
+      return chunk;
+   }
+
+   /// Queue a batch, waiting while the queue is full; returns false if the generator is stopped
+   bool PushBatch(RTensor<float> batch)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondition.wait(lock, [this] { return fStop || fBatches.size() < fMaxQueuedBatches; });
+      if (fStop)
+         return false;
+      fBatches.push_back(std::move(batch));
+      fCondition.notify_all();
+      return true;
+   }
+
+   /// Read all the chunks and queue their batches, run by the loader thread
+   void Load()
+   {
+      const std::size_t nColumns = fColumns.size();
+      std::vector<ULong64_t> chunks((fNEntries + fChunkSize - 1) / fChunkSize);
+      std::iota(chunks.begin(), chunks.end(), 0);
+      if (fShuffle)
+         std::shuffle(chunks.begin(), chunks.end(), fRng);
+
+      // the events left after the last full batch of a chunk start the first batch of the next one
+      std::vector<float> pending;
+      bool stopped = false;
+      try {
+         for (auto ichunk : chunks) {
+            {
+               std::lock_guard<std::mutex> lock(fMutex);
+               if (fStop)
+                  break;
+            }
+            const ULong64_t begin = ichunk * fChunkSize;
+            std::vector<float> chunk = LoadChunk(begin, std::min<ULong64_t>(begin + fChunkSize, fNEntries));
+            const std::size_t nEvents = chunk.size() / nColumns;
+            std::vector<std::size_t> order(nEvents);
+            std::iota(order.begin(), order.end(), 0);
+            if (fShuffle)
+               std::shuffle(order.begin(), order.end(), fRng);
+            for (auto i : order) {
+               pending.insert(pending.end(), chunk.begin() + i * nColumns, chunk.begin() + (i + 1) * nColumns);
+               if (pending.size() == fBatchSize * nColumns) {
+                  RTensor<float> batch({fBatchSize, nColumns});
+                  std::copy(pending.begin(), pending.end(), batch.GetData());
+                  pending.clear();
+                  if (!PushBatch(std::move(batch))) {
+                     stopped = true;
+                     break;
+                  }
+               }
+            }
+            if (stopped)
+               break;
+         }
+         if (!stopped && !pending.empty()) {
+            RTensor<float> batch({pending.size() / nColumns, nColumns});
+            std::copy(pending.begin(), pending.end(), batch.GetData());
+            PushBatch(std::move(batch));
+         }
+      } catch (...) {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fException = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(fMutex);
+      fLoading = false;
+      fCondition.notify_all();
+   }
+
+public:
+   /// \param[in] dataframe RDataFrame node with the events
+   /// \param[in] columns Names of the columns, of types ColumnTypes, stored in the batches
+   /// \param[in] batchSize Number of events of a batch
+   /// \param[in] chunkSize Number of entries read at once, which sets the memory used
+   /// \param[in] shuffle Shuffle the order of the chunks and of the events within each chunk
+   /// \param[in] seed Seed of the random generator used for the shuffling
+   RBatchGenerator(ROOT::RDF::RNode dataframe, const std::vector<std::string> &columns, std::size_t batchSize,
+                   std::size_t chunkSize, bool shuffle = true, unsigned int seed = 0)
+      : fDataFrame(std::move(dataframe)), fColumns(columns), fBatchSize(batchSize), fChunkSize(chunkSize),
+        fShuffle(shuffle), fRng(seed), fNSlots(ROOT::Internal::RDF::GetNSlots())
+   {
+      if (fColumns.size() != sizeof...(ColumnTypes))
+         throw std::runtime_error("RBatchGenerator: the number of columns does not match the number of column types.");
+      if (fBatchSize == 0 || fChunkSize < fBatchSize)
+         throw std::runtime_error("RBatchGenerator: the chunk size must be larger than the (non zero) batch size.");
+      fMaxQueuedBatches = fChunkSize / fBatchSize;
+
+      auto count = fDataFrame.Count();
+      auto maxEntry = fDataFrame.Max<ULong64_t>("rdfentry_");
+      fNEvents = *count;
+      fNEntries = fNEvents > 0 ? *maxEntry + 1 : 0;
+   }
+
+   RBatchGenerator(const RBatchGenerator &) = delete;
+   RBatchGenerator &operator=(const RBatchGenerator &) = delete;
+
+   ~RBatchGenerator() { Stop(); }
+
+   /// Start reading the dataset from the beginning, i.e. a new epoch
+   void Start()
+   {
+      Stop();
+      fStop = false;
+      fException = nullptr;
+      fLoading = true;
+      fLoader = std::thread([this] { Load(); });
+   }
+
+   /// Stop reading the dataset and drop the batches not used yet
+   void Stop()
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fStop = true;
+         fCondition.notify_all();
+      }
+      if (fLoader.joinable())
+         fLoader.join();
+      fBatches.clear();
+   }
+
+   /// Wait for the next batch; returns false at the end of the dataset.
+   /// An exception thrown while reading the dataset is rethrown here.
+   bool HasNextBatch()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondition.wait(lock, [this] { return !fBatches.empty() || !fLoading; });
+      if (fBatches.empty() && fException)
+         std::rethrow_exception(fException);
+      return !fBatches.empty();
+   }
+
+   /// Get the next batch, of shape `{batchSize, nColumns}` apart from the last one of the dataset
+   RTensor<float> GetNextBatch()
+   {
+      if (!HasNextBatch())
+         throw std::runtime_error("RBatchGenerator: no batch left, call Start() for a new epoch.");
+      std::lock_guard<std::mutex> lock(fMutex);
+      RTensor<float> batch = std::move(fBatches.front());
+      fBatches.pop_front();
+      fCondition.notify_all();
+      return batch;
+   }
+
+   /// Number of events of the dataframe
+   ULong64_t GetNEvents() const { return fNEvents; }
+   /// Number of batches of an epoch
+   ULong64_t GetNBatches() const { return (fNEvents + fBatchSize - 1) / fBatchSize; }
+   std::size_t GetBatchSize() const { return fBatchSize; }
+   std::size_t GetChunkSize() const { return fChunkSize; }
+   const std::vector<std::string> &GetColumnNames() const { return fColumns; }
+};
+
+} // namespace Experimental
+} // namespace TMVA
+
+#endif // TMVA_RBATCHGENERATOR
@@ -3,10 +3,12 @@
 
 #include <vector>
 #include <string>
+#include <stdexcept>
 
 #include "TMVA/RTensor.hxx"
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RDF/RInterface.hxx"
+#include "ROOT/RVec.hxx"
 
 namespace TMVA {
 namespace Experimental {
@@ -59,6 +61,91 @@ AsTensor(U &dataframe, std::vector<std::string> columns = {}, MemoryLayout layou
    return x;
 }
 
+/// \brief View the content of an RVec as an RTensor, without copying it
+/// \param[in] v RVec with the values, which must not be resized while the tensor is used
+/// \param[in] shape Shape of the tensor, by default the one of a vector of size v.size()
+/// \param[in] layout Memory layout
+/// \return RTensor view over the memory of the RVec
+///
+/// This can be used e.g. for the per-event inputs of a model stored as an RVec column,
+/// which RDataFrame reads in place from an RNTuple for collections of arithmetic types.
+template <typename T>
+RTensor<T> AsTensorView(ROOT::RVec<T> &v, std::vector<std::size_t> shape = {},
+                        MemoryLayout layout = MemoryLayout::RowMajor)
+{
+   if (shape.empty())
+      shape = {v.size()};
+   if (Internal::GetSizeFromShape(shape) != v.size())
+      throw std::runtime_error("Size of the shape is not equal to the size of the RVec.");
+   return RTensor<T>(v.data(), shape, layout);
+}
+
+/// \brief Present a batch of entries of several columns as a column major RTensor of shape {entries, columns}
+/// \param[in] buffer Memory used if the values have to be copied, reused from one call to the next
+/// \param[in] column RVec with the values of the first column for the batch of entries
+/// \param[in] columns RVecs with the values of the other columns
+/// \return RTensor view over the RVecs if they are stored one after the other in memory,
+/// otherwise over their values copied in the buffer
+///
+/// This is meant for the inputs of a RDataFrame::DefineBatch expression, which are given column by column
+/// (structure of arrays). The tensor must only be read, and is valid until the next call with the
+/// same buffer. It can be given to RBDT::Compute or RReader::Compute, e.g.
+/// ~~~{.cpp}
+/// df.DefineBatch("bdt", [&](unsigned int slot, ROOT::RVecF &out, const ROOT::RVecF &x, const ROOT::RVecF &y) {
+///    auto inputs = AsTensorView(buffers[slot], x, y);
+///    bdt.Compute(inputs.GetData(), x.size(), false, out.data());
+/// }, {"x", "y"});
+/// ~~~
+template <typename T, typename... Columns>
+RTensor<T> AsTensorView(std::vector<T> &buffer, const ROOT::RVec<T> &column, const Columns &... columns)
+{
+   const std::vector<const ROOT::RVec<T> *> cols{&column, &columns...};
+   const std::size_t numEntries = column.size();
+   bool isContiguous = true;
+   for (std::size_t j = 0; j < cols.size(); j++) {
+      if (cols[j]->size() != numEntries)
+         throw std::runtime_error("The columns of the batch have different numbers of entries.");
+      isContiguous &= cols[j]->data() == column.data() + j * numEntries;
+   }
+   if (isContiguous)
+      return RTensor<T>(const_cast<T *>(column.data()), {numEntries, cols.size()}, MemoryLayout::ColumnMajor);
+
+   buffer.resize(numEntries * cols.size());
+   for (std::size_t j = 0; j < cols.size(); j++)
+      std::copy(cols[j]->begin(), cols[j]->end(), buffer.begin() + j * numEntries);
+   return RTensor<T>(buffer.data(), {numEntries, cols.size()}, MemoryLayout::ColumnMajor);
+}
+
+/// \brief Present a batch of entries of an RVec column as a row major RTensor of shape {entries, size of the RVecs}
+/// \param[in] buffer Memory used if the values have to be copied, reused from one call to the next
+/// \param[in] entries RVecs of all the entries of the batch, of the same size
+/// \return RTensor view over the RVecs if they are stored one after the other in memory,
+/// otherwise over their values copied in the buffer
+///
+/// This is meant for a column holding all the inputs of a model for each entry (array of structures),
+/// e.g. the collections read in place from an RNTuple page. The row major layout is the one of the
+/// inputs of the SOFIE sessions. The tensor must only be read, and is valid until the next call with
+/// the same buffer.
+template <typename T>
+RTensor<T> AsTensorView(std::vector<T> &buffer, const ROOT::RVec<ROOT::RVec<T>> &entries)
+{
+   const std::size_t numEntries = entries.size();
+   const std::size_t numCols = numEntries > 0 ? entries[0].size() : 0;
+   bool isContiguous = true;
+   for (std::size_t i = 0; i < numEntries; i++) {
+      if (entries[i].size() != numCols)
+         throw std::runtime_error("The RVecs of the entries of the batch have different sizes.");
+      isContiguous &= entries[i].data() == entries[0].data() + i * numCols;
+   }
+   if (isContiguous && numEntries > 0)
+      return RTensor<T>(const_cast<T *>(entries[0].data()), {numEntries, numCols}, MemoryLayout::RowMajor);
+
+   buffer.resize(numEntries * numCols);
+   for (std::size_t i = 0; i < numEntries; i++)
+      std::copy(entries[i].begin(), entries[i].end(), buffer.begin() + i * numCols);
+   return RTensor<T>(buffer.data(), {numEntries, numCols}, MemoryLayout::RowMajor);
+}
+
 } // namespace TMVA::Experimental
 } // namespace TMVA
 
@@ -48,6 +48,7 @@
 #include "TMVA/DataSetInfo.h"
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetManager.h"
+#include "TMVA/Event.h"
 
 #include <vector>
 #include <map>
@@ -60,6 +61,45 @@ namespace TMVA {
    class MethodBase;
    class DataSetInfo;
    class MethodCuts;
+   class Reader;
+
+   // Handle to a method booked in a Reader, bound once with Reader::GetEvaluator:
+   // the evaluation skips the look up of the method by name and the allocation of
+   // an event for each call, and evaluates blocks of events at once. The handle
+   // is valid as long as the Reader which created it.
+   class ReaderEvaluator {
+
+   public:
+
+      ReaderEvaluator() {}
+
+      Bool_t      IsValid()        const { return fMethod != nullptr; }
+      MethodBase* GetMethod()      const { return fMethod; }
+      UInt_t      GetNVariables()  const { return fNVars; }
+
+      // returns the MVA response for the GetNVariables() input values of an event
+      Double_t Evaluate( const Float_t* input );
+      Double_t Evaluate( const std::vector<Float_t>& input );
+
+      // MVA responses of nEvents events, whose input values are stored one event after the other
+      void     Evaluate( const Float_t* inputs, Float_t* mvaValues, UInt_t nEvents );
+      void     Evaluate( const std::vector<Float_t>& inputs, std::vector<Float_t>& mvaValues );
+
+   private:
+
+      friend class Reader;
+
+      ReaderEvaluator( MethodBase* method, UInt_t nVars, Double_t aux, MsgLogger* logger );
+
+      Bool_t   HasNaN( const Float_t* input ) const;
+      void     SetAux();
+
+      MethodBase* fMethod = nullptr; ///< the bound method
+      UInt_t      fNVars  = 0;       ///< number of input variables of an event
+      Double_t    fAux    = 0;       ///< signal efficiency for MethodCuts, ignored otherwise
+      Event       fEvent;            ///< event reused by the single event evaluation
+      MsgLogger*  fLogger = nullptr; ///< message logger of the Reader
+   };
 
    class Reader : public Configurable {
 
@@ -93,6 +133,9 @@ namespace TMVA {
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
 
+      // returns a handle evaluating the given method without per-event look ups
+      ReaderEvaluator GetEvaluator( const TString& methodTag, Double_t aux = 0 );
+
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
       Double_t GetMVAError() const { return fMvaEventError; }
@@ -30,6 +30,9 @@ namespace Experimental {
 
 namespace Internal {
 
+/// Number of events of the blocks evaluated tree by tree in the inference of the forests
+constexpr int kInferenceBlockSize = 64;
+
 /// Fill the empty nodes of a sparse tree recursively
 template <typename T>
 void RecursiveFill(int thisIndex, int lastIndex, int treeDepth, int maxTreeDepth, std::vector<T> &thresholds,
@@ -65,6 +68,8 @@ struct BranchlessTree {
    std::vector<int> fInputs;   ///< Cut variables / inputs
 
    inline T Inference(const T *input, const int stride);
+   inline void InferenceBlock(const T *inputs, const int rows, const int strideTree, const int strideBatch,
+                              T *predictions);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
 };
@@ -83,6 +88,34 @@ inline T BranchlessTree<T>::Inference(const T *input, const int stride)
    return fThresholds[index];
 }
 
+/// Perform inference on a block of events and add the tree scores to the predictions
+///
+/// The events are moved down the tree together, one level after the other, so that
+/// the loop over the events has no dependency between iterations and can be vectorized
+/// with gather instructions.
+///
+/// \param[in] inputs Pointer to data containing the input values of the first event
+/// \param[in] rows Number of events, at most Internal::kInferenceBlockSize
+/// \param[in] strideTree Stride to go from one input variable to the next one
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in,out] predictions Pointer to the buffer to which the tree scores are added
+template <typename T>
+inline void BranchlessTree<T>::InferenceBlock(const T *inputs, const int rows, const int strideTree,
+                                              const int strideBatch, T *predictions)
+{
+   int index[Internal::kInferenceBlockSize] = {};
+   const int *treeInputs = fInputs.data();
+   const T *thresholds = fThresholds.data();
+   for (int level = 0; level < fTreeDepth; ++level) {
+      for (int i = 0; i < rows; i++) {
+         const int node = index[i];
+         index[i] = 2 * node + 1 + (inputs[i * strideBatch + treeInputs[node] * strideTree] > thresholds[node]);
+      }
+   }
+   for (int i = 0; i < rows; i++)
+      predictions[i] += thresholds[index[i]];
+}
+
 /// Fill nodes of a sparse tree forming a full tree
 ///
 /// Sparse parts of the tree are marked with -1 values in the feature vector. The
@@ -75,6 +75,10 @@ struct ForestBase {
 
 /// Perform inference of the forest on a batch of inputs
 ///
+/// The events are processed in blocks of Internal::kInferenceBlockSize events, and each tree is
+/// evaluated on a whole block before going to the next one, so that the nodes of the tree
+/// stay in cache while they are used by the events of the block.
+///
 /// \param[in] inputs Pointer to data containing the inputs
 /// \param[in] rows Number of events in inputs vector
 /// \param[in] layout Row major (true) or column major (false) memory layout
@@ -84,13 +88,15 @@ inline void ForestBase<T, ForestType>::Inference(const T *inputs, const int rows
 {
    const auto strideTree = layout ? 1 : rows;
    const auto strideBatch = layout ? fNumInputs : 1;
-   for (int i = 0; i < rows; i++) {
-      predictions[i] = 0.0;
+   for (int first = 0; first < rows; first += Internal::kInferenceBlockSize) {
+      const int n = std::min(rows - first, Internal::kInferenceBlockSize);
+      std::fill(predictions + first, predictions + first + n, 0.0);
       for (auto &tree : fTrees) {
-         predictions[i] += tree.Inference(inputs + i * strideBatch, strideTree);
+         tree.InferenceBlock(inputs + first * strideBatch, n, strideTree, strideBatch, predictions + first);
       }
-      predictions[i] = fObjectiveFunc(predictions[i]);
    }
+   for (int i = 0; i < rows; i++)
+      predictions[i] = fObjectiveFunc(predictions[i]);
 }
 
 /// Forest using branchless trees
@@ -309,13 +315,18 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
              << "\n{\n"
              << "   const auto strideTree = layout ? 1 : rows;\n"
              << "   const auto strideBatch = layout ? " << this->fNumInputs << " : 1;\n"
-             << "   for (int i = 0; i < rows; i++) {\n"
-             << "      predictions[i] = 0.0;\n";
+             << "   for (int first = 0; first < rows; first += " << Internal::kInferenceBlockSize << ") {\n"
+             << "      const int last = first + " << Internal::kInferenceBlockSize << " < rows ? first + "
+             << Internal::kInferenceBlockSize << " : rows;\n"
+             << "      for (int i = first; i < last; i++)\n"
+             << "         predictions[i] = 0.0;\n";
+   // evaluate each tree on a block of events, see ForestBase::Inference
    for (int i = 0; i < static_cast<int>(codes.size()); i++) {
       std::stringstream ss;
       ss << "tree" << i;
       const std::string funcName = ss.str();
-      jitForest << "      predictions[i] += " << funcName << "(inputs + i * strideBatch, strideTree);\n";
+      jitForest << "      for (int i = first; i < last; i++)\n"
+                << "         predictions[i] += " << funcName << "(inputs + i * strideBatch, strideTree);\n";
    }
    jitForest << "   }\n"
              << "}\n"
@@ -321,6 +321,15 @@ size_t TCpu<AFloat>::calculateDimension(size_t imgDim, size_t fltDim, size_t pad
    return temp / stride + 1;
 }
 
+//____________________________________________________________________________
+template <typename AFloat>
+void TCpu<AFloat>::InitializeConvWorkspace(TWorkspace *&workspace, TDescriptors *& /*descriptors*/,
+                                           const DNN::CNN::TConvParams & /*params*/, ConvLayer_t * /*L*/)
+{
+   // the buffers are allocated at the first forward and backward propagations
+   workspace = new TCpuConvWorkspace<AFloat>();
+}
+
 //____________________________________________________________________________
 template <typename AFloat>
 void TCpu<AFloat>::ConvLayerForward(TCpuTensor<AFloat> & output,
@@ -330,42 +339,51 @@ void TCpu<AFloat>::ConvLayerForward(TCpuTensor<AFloat> & output,
                                     const DNN::CNN::TConvParams & params, EActivationFunction activFunc,
                                     TCpuTensor<AFloat> & /*  */,
                                     const ConvDescriptors_t & /*descriptors*/,
-                                    ConvWorkspace_t & /*workspace*/)
+                                    ConvWorkspace_t & workspace)
 {
    size_t height = calculateDimension(params.inputHeight, params.filterHeight, params.paddingHeight, params.strideRows);
    size_t width = calculateDimension(params.inputWidth, params.filterWidth, params.paddingWidth, params.strideCols);
    size_t nLocalViews = height * width;
    size_t nLocalViewPixels = params.inputDepth * params.filterHeight * params.filterWidth;
 
+   // the buffers are kept in the workspace of the layer, if any
+   TCpuConvWorkspace<AFloat> localWorkspace;
+   auto layerWorkspace = dynamic_cast<TCpuConvWorkspace<AFloat> *>(&workspace);
+   auto &ws = layerWorkspace ? *layerWorkspace : localWorkspace;
+
    R__ASSERT( input.GetSize() > 0);
-   std::vector<int> forwardIndices(nLocalViews * nLocalViewPixels);
-   Im2colIndices(forwardIndices, input.At(0).GetMatrix(), nLocalViews, params.inputHeight, params.inputWidth, params.filterHeight,
-                 params.filterWidth, params.strideRows, params.strideCols, params.paddingHeight, params.paddingWidth);
+   const std::vector<int> &forwardIndices = ws.ForwardIndices;
+   ws.ReserveIndices(ws.ForwardIndices, nLocalViews * nLocalViewPixels, input.At(0).GetMatrix(), nLocalViews,
+                     params.inputHeight, params.inputWidth, params.filterHeight, params.filterWidth, params.strideRows,
+                     params.strideCols, params.paddingHeight, params.paddingWidth);
 
    //this should fix multi-thread inizializations of arrays
    TCpuMatrix<AFloat>::InitializeOneVector(nLocalViews);
    TCpuMatrix<AFloat>::InitializeOneVector(output.GetWSize());   // since it is used in AddCOnvBiases
 
+   // each partition of the batch uses its own im2col matrix
+   const size_t batchSize = input.GetFirstSize();
+   const size_t nPartitions = ws.GetNPartitions(batchSize);
+   ws.ReserveBuffers(ws.ForwardBuffers, nPartitions, nLocalViews, nLocalViewPixels);
 
-   auto f = [&] (UInt_t i)
+   auto f = [&] (UInt_t partition)
    {
        // dropout not yet implemented for CNN
        // if (applyDropout && (dropoutProbability != 1.0)) {
        //    Dropout(input[i], dropoutProbability);
        // }
 
-       TCpuMatrix<AFloat> inputTr(nLocalViews, nLocalViewPixels);
-       //inputTr.Zero();   // this is not thread safe
-
-       Im2colFast(inputTr, input.At(i).GetMatrix(), forwardIndices);
-
-       Matrix_t output_m = output.At(i).GetMatrix();
-       MultiplyTranspose(output_m, weights, inputTr);
-       AddConvBiases(output_m, biases);
+       TCpuMatrix<AFloat> &inputTr = ws.ForwardBuffers[partition];
+       for (size_t i = partition * batchSize / nPartitions; i < (partition + 1) * batchSize / nPartitions; i++) {
+          Im2colFast(inputTr, input.At(i).GetMatrix(), forwardIndices);
 
+          Matrix_t output_m = output.At(i).GetMatrix();
+          MultiplyTranspose(output_m, weights, inputTr);
+          AddConvBiases(output_m, biases);
+       }
    };
 
-   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI(input.GetFirstSize()));
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI(nPartitions));
 
    //evaluateDerivative<TCpu<AFloat>>(derivatives, activFunc, output);
    // need to save output of convolution (input to activation function)
@@ -386,7 +404,7 @@ void TCpu<AFloat>::ConvLayerBackward(TCpuTensor<AFloat> &activationGradientsBack
                                      const Tensor_t & outputTensor,
                                      EActivationFunction activFunc,
                                      const ConvDescriptors_t & /*descriptors*/,
-                                     ConvWorkspace_t & /*workspace*/,
+                                     ConvWorkspace_t & workspace,
                                      size_t batchSize,   size_t inputHeight,
                                      size_t inputWidth,  size_t depth,
                                      size_t height,      size_t width,
@@ -399,9 +417,16 @@ void TCpu<AFloat>::ConvLayerBackward(TCpuTensor<AFloat> &activationGradientsBack
    //    n = activationGradients[0].GetNcols();
 
 
+   // the buffers are kept in the workspace of the layer, if any
+   TCpuConvWorkspace<AFloat> localWorkspace;
+   auto layerWorkspace = dynamic_cast<TCpuConvWorkspace<AFloat> *>(&workspace);
+   auto &ws = layerWorkspace ? *layerWorkspace : localWorkspace;
+
    // Compute activation backward pass  dx = f'(x) * dy
    //  put resulting dx of activation in activationgradients
-   Tensor_t df(activationGradients.GetShape() );   // this is a deep copy, could be put as data member of class
+   if (ws.ActivationDerivatives.GetShape() != activationGradients.GetShape())
+      ws.ActivationDerivatives = Tensor_t(activationGradients.GetShape());
+   Tensor_t &df = ws.ActivationDerivatives;
    ActivationFunctionBackward(df, outputTensor, activationGradients, inputActivationFunc,
                               activFunc, ActivationDescriptor_t() );
 
@@ -410,11 +435,11 @@ void TCpu<AFloat>::ConvLayerBackward(TCpuTensor<AFloat> &activationGradientsBack
 
    // Calculate the activation gradients of the previous layer
    CalculateConvActivationGradients(activationGradientsBackward, df, weights, batchSize, inputHeight, inputWidth, depth,
-                                    height, width, filterDepth, filterHeight, filterWidth);
+                                    height, width, filterDepth, filterHeight, filterWidth, &ws);
 
    // Calculate the weight gradients
    CalculateConvWeightGradients(weightGradients, df, activationsBackward, batchSize, inputHeight, inputWidth, depth,
-                                height, width, filterDepth, filterHeight, filterWidth, nLocalViews);
+                                height, width, filterDepth, filterHeight, filterWidth, nLocalViews, &ws);
 
    // Calculate the bias gradients
    CalculateConvBiasGradients(biasGradients, df, batchSize, depth, nLocalViews);
@@ -427,19 +452,24 @@ void TCpu<AFloat>::CalculateConvActivationGradients(TCpuTensor<AFloat> &activati
                                                     const TCpuMatrix<AFloat> &weights, size_t batchSize,
                                                     size_t inputHeight, size_t inputWidth, size_t depth, size_t height,
                                                     size_t width, size_t filterDepth, size_t filterHeight,
-                                                    size_t filterWidth)
+                                                    size_t filterWidth, TCpuConvWorkspace<AFloat> *workspace)
 {
    if (activationGradientsBackward.GetSize() == 0) return;
 
 
    activationGradientsBackward.Zero();
 
+   TCpuConvWorkspace<AFloat> localWorkspace;
+   auto &ws = workspace ? *workspace : localWorkspace;
 
    // Transform the weights
 
    //TMVA_DNN_PrintTCpuMatrix(weights,"weights");
    // filter depth must be same as input depth
-   TCpuMatrix<AFloat> rotWeights(filterDepth, depth * filterHeight * filterWidth);
+   const size_t rotWeightsCols = depth * filterHeight * filterWidth;
+   if (ws.RotatedWeights.GetNrows() != filterDepth || ws.RotatedWeights.GetNcols() != rotWeightsCols)
+      ws.RotatedWeights = TCpuMatrix<AFloat>(filterDepth, rotWeightsCols);
+   TCpuMatrix<AFloat> &rotWeights = ws.RotatedWeights;
    RotateWeights(rotWeights, weights, filterDepth, filterHeight, filterWidth, weights.GetNrows());
    //TMVA_DNN_PrintTCpuMatrix(rotWeights,"rot-weights");
 
@@ -459,34 +489,38 @@ void TCpu<AFloat>::CalculateConvActivationGradients(TCpuTensor<AFloat> &activati
 
    // An entire convolution follows
 
-    std::vector<int> vIndices( tempNLocalViews * tempNLocalViewPixels );
-    Im2colIndices(vIndices, df.At(0).GetMatrix(), tempNLocalViews, height, width, filterHeight, filterWidth, tempStrideRows, tempStrideCols,
-             tempZeroPaddingHeight, tempZeroPaddingWidth);
+    const std::vector<int> &vIndices = ws.ActivationGradIndices;
+    ws.ReserveIndices(ws.ActivationGradIndices, tempNLocalViews * tempNLocalViewPixels, df.At(0).GetMatrix(),
+                      tempNLocalViews, height, width, filterHeight, filterWidth, tempStrideRows, tempStrideCols,
+                      tempZeroPaddingHeight, tempZeroPaddingWidth);
 
 
     //for (size_t i = 0; i < batchSize; i++) {
     R__ASSERT(batchSize == df.GetFirstSize() );
     R__ASSERT(batchSize == activationGradientsBackward.GetFirstSize() );
-    auto f = [&] (UInt_t i)
+    const size_t nPartitions = ws.GetNPartitions(batchSize);
+    ws.ReserveBuffers(ws.ActivationGradBuffers, nPartitions, tempNLocalViews, tempNLocalViewPixels);
+    auto f = [&] (UInt_t partition)
    {
        // Im2col(dfTr, df[i], height, width, filterHeight, filterWidth, tempStrideRows, tempStrideCols,
        //       tempZeroPaddingHeight, tempZeroPaddingWidth);
 
-      TCpuMatrix<AFloat> dfTr(tempNLocalViews, tempNLocalViewPixels);
-
-      Im2colFast(dfTr, df.At(i).GetMatrix(), vIndices);
+      TCpuMatrix<AFloat> &dfTr = ws.ActivationGradBuffers[partition];
+      for (size_t i = partition * batchSize / nPartitions; i < (partition + 1) * batchSize / nPartitions; i++) {
+         Im2colFast(dfTr, df.At(i).GetMatrix(), vIndices);
 
-       //TMVA_DNN_PrintTCpuMatrix(df[i],"df[i]");
-       //TMVA_DNN_PrintTCpuMatrix(dfTr,"dfTr");
+         //TMVA_DNN_PrintTCpuMatrix(df[i],"df[i]");
+         //TMVA_DNN_PrintTCpuMatrix(dfTr,"dfTr");
 
-      Matrix_t agb_m = activationGradientsBackward.At(i).GetMatrix();
-      MultiplyTranspose(agb_m, rotWeights, dfTr);
+         Matrix_t agb_m = activationGradientsBackward.At(i).GetMatrix();
+         MultiplyTranspose(agb_m, rotWeights, dfTr);
+      }
 
        //TMVA_DNN_PrintTCpuMatrix(activationGradientsBackward[i],"activGrad-result");
 
    };
 
-    TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( batchSize ) );
+    TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( nPartitions ) );
 }
 
 //____________________________________________________________________________
@@ -496,7 +530,8 @@ void TCpu<AFloat>::CalculateConvWeightGradients(TCpuMatrix<AFloat> &weightGradie
                                                 const TCpuTensor<AFloat> &activationsBackward,
                                                 size_t batchSize, size_t inputHeight, size_t inputWidth, size_t depth,
                                                 size_t height, size_t width, size_t filterDepth, size_t filterHeight,
-                                                size_t filterWidth, size_t nLocalViews)
+                                                size_t filterWidth, size_t nLocalViews,
+                                                TCpuConvWorkspace<AFloat> *workspace)
 {
    // reinitialize the weight gradients to 0
    weightGradients.Zero();
@@ -517,65 +552,59 @@ void TCpu<AFloat>::CalculateConvWeightGradients(TCpuMatrix<AFloat> &weightGradie
 
 
 
-   std::vector<int> vIndices(nLocalViews * nLocalViewPixels );
-   Im2colIndices(vIndices, activationsBackward.At(0).GetMatrix(), nLocalViews, inputHeight, inputWidth, filterHeight , filterWidth,
-             tempStrideRows, tempStrideCols, tempZeroPaddingHeight, tempZeroPaddingWidth);
+   TCpuConvWorkspace<AFloat> localWorkspace;
+   auto &ws = workspace ? *workspace : localWorkspace;
 
-   //std::cout << "do back-propagation in conv layer - compute weight gradient" << std::endl;
+   const std::vector<int> &vIndices = ws.WeightGradIndices;
+   ws.ReserveIndices(ws.WeightGradIndices, nLocalViews * nLocalViewPixels, activationsBackward.At(0).GetMatrix(),
+                     nLocalViews, inputHeight, inputWidth, filterHeight, filterWidth, tempStrideRows, tempStrideCols,
+                     tempZeroPaddingHeight, tempZeroPaddingWidth);
 
-   // std::vector< TCpuMatrix<AFloat> > vres;//(batchSize);
-   // for (size_t i = 0; i < batchSize; i++) {
-   //    vres.emplace_back(depth, nLocalViewPixels);
-   //    //TMVA_DNN_PrintTCpuMatrix(df[i],"df");
-   //    //TMVA_DNN_PrintTCpuMatrix(activationsBackward[i],"df");
+   //std::cout << "do back-propagation in conv layer - compute weight gradient" << std::endl;
 
-   //}
-   //TCpuTensor<AFloat> vres( { batchSize, depth, nLocalViewPIxels} );
-   TCpuTensor<AFloat> vres( batchSize, depth, nLocalViewPixels);
+   // each partition of the batch sums the gradients of its events, instead of
+   // keeping the ones of all the events of the batch
+   const size_t nPartitions = ws.GetNPartitions(batchSize);
+   ws.ReserveBuffers(ws.WeightGradBuffers, nPartitions, nLocalViews, nLocalViewPixels);
+   ws.ReserveBuffers(ws.WeightGradProducts, nPartitions, depth, nLocalViewPixels);
+   ws.ReserveBuffers(ws.WeightGradSums, nPartitions, depth, nLocalViewPixels);
 
-   auto fmap = [&](int i) {
+   auto fmap = [&](int partition) {
 
-      //TMVA_DNN_PrintTCpuMatrix(df[i],"df-i");
-      TCpuMatrix<AFloat> xTr(nLocalViews, nLocalViewPixels);
-      TCpuMatrix<AFloat> res(depth, nLocalViewPixels);
+      TCpuMatrix<AFloat> &xTr = ws.WeightGradBuffers[partition];
+      TCpuMatrix<AFloat> &res = ws.WeightGradProducts[partition];
+      TCpuMatrix<AFloat> &sum = ws.WeightGradSums[partition];
+      sum.Zero();
 
       //computing t he gradient is equivalent of doing a convolution of the input using as conv kernel the delta's (the df[] values)
       //N.B. only stride values=1 are now supported
 
-      //xTr.Zero();
-      // Im2col(xTr, const_cast<TCpuMatrix<AFloat> &>(activationsBackward[i]), inputHeight, inputWidth, filterHeight , filterWidth,
-      //        tempStrideRows, tempStrideCols, tempZeroPaddingHeight, tempZeroPaddingWidth);
-      Im2colFast(xTr, activationsBackward.At(i).GetMatrix(), vIndices);
+      for (size_t i = partition * batchSize / nPartitions; i < (partition + 1) * batchSize / nPartitions; i++) {
+         Im2colFast(xTr, activationsBackward.At(i).GetMatrix(), vIndices);
 
-      //std::cout << "doing im2colfast" << std::endl;
-      //TMVA_DNN_PrintTCpuMatrix(xTr,"xTr-i");
-      //TMVA_DNN_PrintTCpuMatrix(activationsBackward[i],"actbackward-i");
-      Matrix_t mres = vres.At(i).GetMatrix();
-      Multiply( mres, df.At(i).GetMatrix(), xTr);
-      //TMVA_DNN_PrintTCpuMatrix(vres[i],"res_ofMT");
-
-      return;
-      //return res;
+         //TMVA_DNN_PrintTCpuMatrix(xTr,"xTr-i");
+         //TMVA_DNN_PrintTCpuMatrix(activationsBackward[i],"actbackward-i");
+         Multiply(res, df.At(i).GetMatrix(), xTr);
+         ScaleAdd(sum, res);
+      }
    };
 
-   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(fmap, ROOT::TSeqI( batchSize ) );
-
-//   auto freduce = [&](const TCpuTensor<AFloat> & vres) {
-      R__ASSERT(vres.GetFirstSize() == batchSize);
-      for (size_t i = 0; i < batchSize; i++) {
-         //TMVA_DNN_PrintTCpuMatrix(vres[i],"res");
-         Matrix_t vres_m = vres.At(i).GetMatrix();
-         for (size_t j = 0; j < depth; j++) {
-            for (size_t k = 0; k < filterDepth; k++) {
-               size_t kOffset = k * filterSize;
-               for (size_t l = 0; l < filterSize; l++) {
-                  //weightGradients(j, k * (filterHeight * filterWidth) + l) += res(k, (tempNLocalViews - 1) - l);
-                  weightGradients(j, kOffset + l) += vres_m(j,  kOffset + l);
-               }
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(fmap, ROOT::TSeqI( nPartitions ) );
+
+   for (size_t i = 0; i < nPartitions; i++) {
+      //TMVA_DNN_PrintTCpuMatrix(vres[i],"res");
+      const Matrix_t &vres_m = ws.WeightGradSums[i];
+      for (size_t j = 0; j < depth; j++) {
+         for (size_t k = 0; k < filterDepth; k++) {
+            size_t kOffset = k * filterSize;
+            for (size_t l = 0; l < filterSize; l++) {
+               //weightGradients(j, k * (filterHeight * filterWidth) + l) += res(k, (tempNLocalViews - 1) - l);
+               weightGradients(j, kOffset + l) += vres_m(j,  kOffset + l);
             }
          }
-         // TMVA_DNN_PrintTCpuMatrix(weightGradients,"weights_i");
       }
+      // TMVA_DNN_PrintTCpuMatrix(weightGradients,"weights_i");
+   }
       //  };
 
    //TCpuMatrix<AFloat>::GetThreadExecutor().MapReduce(fmap, ROOT::TSeqI( batchSize ) , freduce);
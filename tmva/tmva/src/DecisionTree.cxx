@@ -221,7 +221,8 @@ TMVA::DecisionTree::DecisionTree( const DecisionTree &d ):
    fSigClass   (d.fSigClass),
    fTreeID     (d.fTreeID),
    fAnalysisType(d.fAnalysisType),
-   fDataSetInfo    (d.fDataSetInfo)
+   fDataSetInfo    (d.fDataSetInfo),
+   fBinning        (d.fBinning)
 {
    this->SetRoot( new TMVA::DecisionTreeNode ( *((DecisionTreeNode*)(d.GetRoot())) ) );
    this->SetParentTreeInNodes();
@@ -387,6 +388,7 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
       this->GetRoot()->SetDepth(0);
       this->GetRoot()->SetParentTree(this);
       fMinSize = fMinNodeSize/100. * eventSample.size();
+      fNodeHistograms.clear();
       if (GetTreeID()==0){
          Log() << kDEBUG << "\tThe minimal node size MinNodeSize=" << fMinNodeSize << " fMinNodeSize="<<fMinNodeSize<< "% is translated to an actual number of events = "<< fMinSize<< " for the training sample size of " << eventSample.size() << Endl;
          Log() << kDEBUG << "\tNote: This number will be taken as absolute minimum in the node, " << Endl;
@@ -515,7 +517,10 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 
       // Train the node and figure out the separation gain and split points
       Double_t separationGain;
-      if (fNCuts > 0){
+      if (fBinning) {
+         separationGain = this->TrainNodeHist(eventSample, node);
+      }
+      else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       }
       else {
@@ -594,6 +599,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
+         if (fBinning) this->FillDaughterHistograms(node, leftSample, rightSample);
+
          this->BuildTree(rightSample, rightNode);
          this->BuildTree(leftSample,  leftNode );
 
@@ -624,6 +631,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
       if (node->GetDepth() > this->GetTotalTreeDepth()) this->SetTotalTreeDepth(node->GetDepth());
    }
 
+   // the histograms of a node which has not been split are not needed anymore
+   if (fBinning) fNodeHistograms.erase(node);
+
    //   if (IsRootNode) this->CleanTree();
    return fNNodes;
 }
@@ -644,6 +654,7 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
       this->GetRoot()->SetDepth(0);
       this->GetRoot()->SetParentTree(this);
       fMinSize = fMinNodeSize/100. * eventSample.size();
+      fNodeHistograms.clear();
       if (GetTreeID()==0){
          Log() << kDEBUG << "\tThe minimal node size MinNodeSize=" << fMinNodeSize << " fMinNodeSize="<<fMinNodeSize<< "% is translated to an actual number of events = "<< fMinSize<< " for the training sample size of " << eventSample.size() << Endl;
          Log() << kDEBUG << "\tNote: This number will be taken as absolute minimum in the node, " << Endl;
@@ -759,7 +770,10 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
    if ((eventSample.size() >= 2*fMinSize  && s+b >= 2*fMinSize) && node->GetDepth() < fMaxDepth
        && ( ( s!=0 && b !=0 && !DoRegression()) || ( (s+b)!=0 && DoRegression()) ) ) {
       Double_t separationGain;
-      if (fNCuts > 0){
+      if (fBinning) {
+         separationGain = this->TrainNodeHist(eventSample, node);
+      }
+      else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       } else {
          separationGain = this->TrainNodeFull(eventSample, node);
@@ -837,6 +851,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
+         if (fBinning) this->FillDaughterHistograms(node, leftSample, rightSample);
+
          this->BuildTree(rightSample, rightNode);
          this->BuildTree(leftSample,  leftNode );
 
@@ -867,6 +883,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
       if (node->GetDepth() > this->GetTotalTreeDepth()) this->SetTotalTreeDepth(node->GetDepth());
    }
 
+   // the histograms of a node which has not been split are not needed anymore
+   if (fBinning) fNodeHistograms.erase(node);
+
    //   if (IsRootNode) this->CleanTree();
    return fNNodes;
 }
@@ -2335,6 +2354,247 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
 }
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+/// quantize the variables of the events in about nBins bins with the same number of events;
+/// the bin edges are quantiles of (a subsample of) the events
+
+TMVA::DecisionTreeBinning::DecisionTreeBinning(const std::vector<const TMVA::Event*> &events, UInt_t nVars, UInt_t nBins)
+   : fNVars(nVars), fCutValues(nVars), fBinOffsets(nVars + 1, 0), fBins(events.size() * nVars)
+{
+   nBins = std::min<UInt_t>(std::max<UInt_t>(nBins, 2), std::numeric_limits<UShort_t>::max());
+   const UInt_t nevents = events.size();
+   const UInt_t nSample = std::min<UInt_t>(nevents, 100000);
+   std::vector<Double_t> values(nSample);
+   for (UInt_t ivar = 0; ivar < fNVars; ivar++) {
+      for (UInt_t i = 0; i < nSample; i++)
+         values[i] = events[ULong64_t(i) * nevents / nSample]->GetValueFast(ivar);
+      std::sort(values.begin(), values.end());
+      auto &cuts = fCutValues[ivar];
+      for (UInt_t ibin = 1; ibin < nBins && nSample > 0; ibin++) {
+         const Double_t cut = values[ULong64_t(ibin) * nSample / nBins];
+         // a cut at the smallest value would give an empty first bin
+         if (cut > values.front() && (cuts.empty() || cut > cuts.back()))
+            cuts.push_back(cut);
+      }
+      fBinOffsets[ivar + 1] = fBinOffsets[ivar] + cuts.size() + 1;
+   }
+
+   fEventIndex.reserve(nevents);
+   for (UInt_t iev = 0; iev < nevents; iev++)
+      fEventIndex.emplace(events[iev], iev);
+   // an event is in the bin after the last cut value smaller or equal to its value,
+   // like in DecisionTreeNode::GoesRight
+   auto fillBins = [this, &events, nevents](UInt_t ivar) {
+      const auto &cuts = fCutValues[ivar];
+      for (UInt_t iev = 0; iev < nevents; iev++) {
+         const Double_t val = events[iev]->GetValueFast(ivar);
+         fBins[ULong64_t(iev) * fNVars + ivar] = std::upper_bound(cuts.begin(), cuts.end(), val) - cuts.begin();
+      }
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Foreach(fillBins, ROOT::TSeqU(fNVars));
+}
+
+namespace {
+// the quantities summed in each bin of the histograms of the histogram based training
+enum EHistQuantity { kHistSig = 0, kHistBkg, kHistSigUnweighted, kHistBkgUnweighted, kHistTarget, kHistTarget2,
+                     kNHistQuantities };
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// fill the histograms of all the variables for the events of a node; the
+/// histograms of all the variables are stored one after the other, with
+/// kNHistQuantities values for each bin, followed by the number of events
+/// which are not known to the binning
+
+std::vector<Double_t> TMVA::DecisionTree::FillHistograms(const EventConstList &eventSample) const
+{
+   const UInt_t nHist = fBinning->GetTotalNBins() * kNHistQuantities;
+   const UInt_t nevents = eventSample.size();
+   const UInt_t nPartitions =
+      std::max(1u, std::min(TMVA::Config::Instance().GetThreadExecutor().GetPoolSize(), nevents / 1000));
+
+   auto f = [this, &eventSample, nHist, nevents, nPartitions](UInt_t partition = 0) {
+      std::vector<Double_t> hist(nHist + 1, 0.);
+      const UInt_t start = ULong64_t(partition) * nevents / nPartitions;
+      const UInt_t end = ULong64_t(partition + 1) * nevents / nPartitions;
+      for (UInt_t iev = start; iev < end; iev++) {
+         const TMVA::Event *evt = eventSample[iev];
+         const UShort_t *bins = fBinning->GetBins(evt);
+         if (!bins) {
+            hist[nHist]++;
+            continue;
+         }
+         const Double_t weight = evt->GetWeight();
+         const Bool_t isSignal = evt->GetClass() == fSigClass;
+         const Double_t tgt = DoRegression() ? evt->GetTarget(0) : 0.;
+         for (UInt_t ivar = 0; ivar < fNvars; ivar++) {
+            Double_t *h = &hist[(fBinning->GetBinOffset(ivar) + bins[ivar]) * kNHistQuantities];
+            if (isSignal) {
+               h[kHistSig] += weight;
+               h[kHistSigUnweighted]++;
+            } else {
+               h[kHistBkg] += weight;
+               h[kHistBkgUnweighted]++;
+            }
+            if (DoRegression()) {
+               h[kHistTarget] += weight * tgt;
+               h[kHistTarget2] += weight * tgt * tgt;
+            }
+         }
+      }
+      return hist;
+   };
+   auto redfunc = [nHist](const std::vector<std::vector<Double_t>> &v) {
+      std::vector<Double_t> hist(nHist + 1, 0.);
+      for (auto &h : v)
+         for (UInt_t i = 0; i <= nHist; i++)
+            hist[i] += h[i];
+      return hist;
+   };
+   auto hist = TMVA::Config::Instance().GetThreadExecutor().MapReduce(f, ROOT::TSeqU(nPartitions), redfunc);
+   if (hist[nHist] > 0) {
+      Log() << kFATAL << "<FillHistograms> " << hist[nHist]
+            << " events of the node are not in the events used to compute the binning of the variables" << Endl;
+   }
+   hist.pop_back();
+   return hist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// prepare the histograms of the daughter nodes of a node which has just been split:
+/// only those of the smaller daughter are filled, the ones of the other daughter are
+/// the ones of the mother node minus the filled ones
+
+void TMVA::DecisionTree::FillDaughterHistograms(DecisionTreeNode *node, const EventConstList &leftSample,
+                                                const EventConstList &rightSample)
+{
+   auto it = fNodeHistograms.find(node);
+   if (it == fNodeHistograms.end())
+      return;
+   std::vector<Double_t> hist = std::move(it->second);
+   fNodeHistograms.erase(it);
+   // the daughter nodes are leaves
+   if (node->GetDepth() + 1 >= fMaxDepth)
+      return;
+
+   const Bool_t leftIsSmaller = leftSample.size() < rightSample.size();
+   std::vector<Double_t> smallHist = FillHistograms(leftIsSmaller ? leftSample : rightSample);
+   for (UInt_t i = 0; i < hist.size(); i++)
+      hist[i] -= smallHist[i];
+   const DecisionTreeNode *left = static_cast<DecisionTreeNode*>(node->GetLeft());
+   const DecisionTreeNode *right = static_cast<DecisionTreeNode*>(node->GetRight());
+   fNodeHistograms[leftIsSmaller ? left : right] = std::move(smallHist);
+   fNodeHistograms[leftIsSmaller ? right : left] = std::move(hist);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decide how to split a node like TrainNodeFast(), but using as cut values the
+/// edges of the bins of the variables given with SetBinning(). As these are the same
+/// for all the nodes, the histograms of the variables are filled at the root node
+/// from the precomputed bin indices of the events, and after each split only for the
+/// smaller daughter node, see FillDaughterHistograms(). The Fisher cuts are not
+/// supported.
+
+Double_t TMVA::DecisionTree::TrainNodeHist( const EventConstList & eventSample,
+                                            TMVA::DecisionTreeNode *node )
+{
+   auto it = fNodeHistograms.find(node);
+   if (it == fNodeHistograms.end())
+      it = fNodeHistograms.emplace(node, FillHistograms(eventSample)).first;
+   const std::vector<Double_t> &hist = it->second;
+
+   std::vector<Bool_t> useVariable(fNvars, kTRUE);
+   if (fRandomisedTree) {
+      std::unique_ptr<Bool_t[]> useRandomVariable(new Bool_t[fNvars]);
+      std::unique_ptr<UInt_t[]> mapVariable(new UInt_t[fNvars]);
+      UInt_t tmp = fUseNvars;
+      GetRandomisedVariables(useRandomVariable.get(), mapVariable.get(), tmp);
+      for (UInt_t ivar = 0; ivar < fNvars; ivar++)
+         useVariable[ivar] = useRandomVariable[ivar];
+   }
+   for (UInt_t ivar = 0; ivar < fNvars; ivar++) {
+      if (almost_equal_float(node->GetSampleMax(ivar), node->GetSampleMin(ivar)))
+         useVariable[ivar] = kFALSE;
+   }
+
+   // the totals, from the histograms of the first variable
+   Double_t tot[kNHistQuantities] = {};
+   for (UInt_t ibin = 0; ibin < fBinning->GetNBins(0); ibin++) {
+      for (UInt_t q = 0; q < kNHistQuantities; q++)
+         tot[q] += hist[(fBinning->GetBinOffset(0) + ibin) * kNHistQuantities + q];
+   }
+   const Double_t nTotS = tot[kHistSig];
+   const Double_t nTotB = tot[kHistBkg];
+   const Double_t nTotUnweighted = tot[kHistSigUnweighted] + tot[kHistBkgUnweighted];
+
+   // scan the cumulative histograms of each variable: the events in the bins up to the
+   // cut go left, the other ones go right
+   std::vector<Double_t> separationGain(fNvars, -1);
+   std::vector<Int_t> cutIndex(fNvars, -1);
+   std::vector<Char_t> cutType(fNvars, kTRUE);
+   auto fvarMaxSep = [&](UInt_t ivar) {
+      if (!useVariable[ivar])
+         return 0;
+      Double_t sel[kNHistQuantities] = {};
+      for (UInt_t ibin = 0; ibin + 1 < fBinning->GetNBins(ivar); ibin++) { // the last bin contains "all events" -->skip
+         const Double_t *h = &hist[(fBinning->GetBinOffset(ivar) + ibin) * kNHistQuantities];
+         for (UInt_t q = 0; q < kNHistQuantities; q++)
+            sel[q] += h[q];
+         const Double_t nl = sel[kHistSigUnweighted] + sel[kHistBkgUnweighted];
+         const Double_t nlW = sel[kHistSig] + sel[kHistBkg];
+         // same minimum number of events in both daughter nodes as in TrainNodeFast
+         if (nl < fMinSize || nTotUnweighted - nl < fMinSize || nlW < fMinSize || nTotS + nTotB - nlW < fMinSize)
+            continue;
+         Double_t sepTmp;
+         if (DoRegression()) {
+            sepTmp = fRegType->GetSeparationGain(nlW, sel[kHistTarget], sel[kHistTarget2], nTotS + nTotB,
+                                                 tot[kHistTarget], tot[kHistTarget2]);
+         } else {
+            sepTmp = fSepType->GetSeparationGain(sel[kHistSig], sel[kHistBkg], nTotS, nTotB);
+         }
+         if (separationGain[ivar] < sepTmp) {
+            separationGain[ivar] = sepTmp;
+            cutIndex[ivar] = ibin;
+            cutType[ivar] = DoRegression() || sel[kHistSig] / nTotS > sel[kHistBkg] / nTotB;
+         }
+      }
+      return 0;
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Map(fvarMaxSep, ROOT::TSeqU(fNvars));
+
+   Double_t separationGainTotal = -1;
+   Int_t mxVar = -1;
+   for (UInt_t ivar = 0; ivar < fNvars; ivar++) {
+      if (useVariable[ivar] && separationGainTotal < separationGain[ivar]) {
+         separationGainTotal = separationGain[ivar];
+         mxVar = ivar;
+      }
+   }
+   if (mxVar < 0)
+      return 0;
+
+   const Double_t nTot = nTotS + nTotB;
+   if (DoRegression()) {
+      node->SetSeparationIndex(fRegType->GetSeparationIndex(nTot, tot[kHistTarget], tot[kHistTarget2]));
+      node->SetResponse(tot[kHistTarget] / nTot);
+      if (almost_equal_double(tot[kHistTarget2] / nTot, tot[kHistTarget] / nTot * tot[kHistTarget] / nTot))
+         node->SetRMS(0);
+      else
+         node->SetRMS(TMath::Sqrt(tot[kHistTarget2] / nTot - tot[kHistTarget] / nTot * tot[kHistTarget] / nTot));
+   } else {
+      node->SetSeparationIndex(fSepType->GetSeparationIndex(nTotS, nTotB));
+   }
+   node->SetSelector((UInt_t)mxVar);
+   node->SetCutValue(fBinning->GetCutValues(mxVar)[cutIndex[mxVar]]);
+   node->SetCutType(cutType[mxVar]);
+   node->SetSeparationGain(separationGainTotal);
+   node->SetNFisherCoeff(0);
+   fVariableImportance[mxVar] += separationGainTotal * separationGainTotal * nTot * nTot;
+
+   return separationGainTotal;
+}
+
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// calculate the fisher coefficients for the event sample and the variables used
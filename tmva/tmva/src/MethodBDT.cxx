@@ -181,6 +181,7 @@ TMVA::MethodBDT::MethodBDT( const TString& jobName,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistograms(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -236,6 +237,7 @@ TMVA::MethodBDT::MethodBDT( DataSetInfo& theData,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistograms(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -311,6 +313,9 @@ Bool_t TMVA::MethodBDT::HasAnalysisType( Types::EAnalysisType type, UInt_t numbe
 ///  - nCuts:           the number of steps in the optimisation of the cut for a node (if < 0, then
 ///                  step size is determined by the events)
 ///  - UseFisherCuts:   use multivariate splits using the Fisher criterion
+///  - UseHistograms:   quantize the variables once in nCuts+1 bins with the same number of training events and
+///                  find the node splits with the histograms of the bins, filled only for the smaller of
+///                  two daughter nodes (the other ones are the difference with the mother node)
 ///  - UseYesNoLeaf     decide if the classification is done simply by the node type, or the S/B
 ///                  (from the training) in the leaf node
 ///  - NodePurityLimit  the minimum purity to classify a node as a signal node (used in pruning and boosting to determine
@@ -419,6 +424,7 @@ void TMVA::MethodBDT::DeclareOptions()
    DeclareOptionRef(fUseFisherCuts=kFALSE, "UseFisherCuts", "Use multivariate splits using the Fisher criterion");
    DeclareOptionRef(fMinLinCorrForFisher=.8,"MinLinCorrForFisher", "The minimum linear correlation between two variables demanded for use in Fisher criterion in node splitting");
    DeclareOptionRef(fUseExclusiveVars=kFALSE,"UseExclusiveVars","Variables already used in fisher criterion are not anymore analysed individually for node splitting");
+   DeclareOptionRef(fUseHistograms=kFALSE,"UseHistograms","Find the node splits with histograms of the variables quantized once for all the trees in nCuts+1 bins with the same number of events (fast training on large samples)");
 
 
    DeclareOptionRef(fDoPreselection=kFALSE,"DoPreselection","and and apply automatic pre-selection for 100% efficient signal (bkg) cuts prior to training");
@@ -606,6 +612,17 @@ void TMVA::MethodBDT::ProcessOptions()
       fNCuts=20;
    }
 
+   if (fUseHistograms) {
+      if (fUseFisherCuts) {
+         Log() << kWARNING << "The option UseFisherCuts is not available with UseHistograms, I will ignore it!" << Endl;
+         fUseFisherCuts = kFALSE;
+      }
+      if (fNCuts <= 0) {
+         Log() << kWARNING << "The option UseHistograms needs nCuts > 0 --> I switch to nCuts = 255" << Endl;
+         fNCuts = 255;
+      }
+   }
+
    if (fNTrees==0){
       Log() << kERROR << " Zero Decision Trees demanded... that does not work !! "
             << " I set it to 1 .. just so that the program does not crash"
@@ -1264,6 +1281,11 @@ void TMVA::MethodBDT::Train()
       InitGradBoost(fEventSample);
    }
 
+   // the bins of the variables of the training events, shared by all the trees
+   if (fUseHistograms) {
+      fBinning = std::make_unique<DecisionTreeBinning>(fEventSample, GetNvar(), fNCuts + 1);
+   }
+
    Int_t itree=0;
    Bool_t continueBoost=kTRUE;
    //for (int itree=0; itree<fNTrees; itree++) {
@@ -1297,6 +1319,7 @@ void TMVA::MethodBDT::Train()
                                                  fRandomisedTrees, fUseNvars, fUsePoissonNvars, fMaxDepth,
                                                  itree*nClasses+i, fNodePurityLimit, itree*nClasses+1));
             fForest.back()->SetNVars(GetNvar());
+            fForest.back()->SetBinning(fBinning.get());
             if (fUseFisherCuts) {
                fForest.back()->SetUseFisherCuts();
                fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
@@ -1324,6 +1347,7 @@ void TMVA::MethodBDT::Train()
 
          fForest.push_back(dt);
          fForest.back()->SetNVars(GetNvar());
+         fForest.back()->SetBinning(fBinning.get());
          if (fUseFisherCuts) {
             fForest.back()->SetUseFisherCuts();
             fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
@@ -1409,6 +1433,11 @@ void TMVA::MethodBDT::Train()
    for (UInt_t i=0; i<fValidationSample.size(); i++) delete fValidationSample[i];
    fEventSample.clear();
    fValidationSample.clear();
+   // the bins are only known for the deleted training events
+   if (fBinning) {
+      for (auto tree : fForest) tree->SetBinning(nullptr);
+      fBinning.reset();
+   }
 
    if (!fExitFromTraining) fIPyMaxIter = fIPyCurrentIter;
    ExitFromTraining();
@@ -2489,6 +2518,64 @@ Double_t TMVA::MethodBDT::PrivateGetMvaValue(const TMVA::Event* ev, Double_t* er
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the MVA values of nEvents events, given as untransformed input values
+/// stored one event after the other, identical to the ones of GetMvaValue.
+/// The events are transformed in blocks and each tree is evaluated for all the
+/// events of the block before moving to the next one, so that the nodes of a
+/// tree stay in the cache instead of walking the whole forest for each event.
+
+void TMVA::MethodBDT::GetBatchMvaValues( const Float_t* inputs, UInt_t nEvents, Float_t* mvaValues )
+{
+   const UInt_t nvar = GetNvar();
+   const UInt_t blockSize = 64;
+   const UInt_t nTrees = fForest.size();
+   const Bool_t isGrad = (fBoostType=="Grad");
+
+   Double_t norm = 0;
+   for (UInt_t itree=0; itree<nTrees; itree++) norm += fBoostWeights[itree];
+
+   Event input( std::vector<Float_t>(nvar), 0 );
+   std::vector<Event> block( std::min(blockSize, nEvents), input );
+   std::vector<Double_t> sums( block.size() );
+   std::vector<Bool_t> preselected( block.size() );
+
+   for (UInt_t first=0; first<nEvents; first+=blockSize) {
+      const UInt_t n = std::min(blockSize, nEvents - first);
+      for (UInt_t i=0; i<n; i++) {
+         const Float_t* values = inputs + (first+i)*nvar;
+         for (UInt_t ivar=0; ivar<nvar; ivar++) input.SetVal( ivar, values[ivar] );
+         // the transformation handler returns its own (reused) event: keep a copy
+         block[i] = *GetTransformationHandler().Transform( &input );
+         sums[i] = 0;
+         preselected[i] = kFALSE;
+         if (fDoPreselection) {
+            Double_t val = ApplyPreselectionCuts( &block[i] );
+            if (TMath::Abs(val)>0.05) {
+               mvaValues[first+i] = val;
+               preselected[i] = kTRUE;
+            }
+         }
+      }
+
+      for (UInt_t itree=0; itree<nTrees; itree++) {
+         const DecisionTree* tree = fForest[itree];
+         if (isGrad) {
+            for (UInt_t i=0; i<n; i++) sums[i] += tree->CheckEvent( &block[i], kFALSE );
+         } else {
+            const Double_t boostWeight = fBoostWeights[itree];
+            for (UInt_t i=0; i<n; i++) sums[i] += boostWeight * tree->CheckEvent( &block[i], fUseYesNoLeaf );
+         }
+      }
+
+      for (UInt_t i=0; i<n; i++) {
+         if (preselected[i]) continue;
+         if (isGrad) mvaValues[first+i] = 2.0/(1.0+exp(-2.0*sums[i]))-1;
+         else mvaValues[first+i] = ( norm > std::numeric_limits<double>::epsilon() ) ? sums[i]/norm : 0;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the multiclass MVA response for the BDT classifier.
 
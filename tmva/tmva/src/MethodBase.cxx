@@ -847,6 +847,22 @@ Double_t TMVA::MethodBase::GetMvaValue( const Event* const ev, Double_t* err, Do
    return val;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// classification response of nEvents events, whose untransformed input values
+/// are stored one event after the other in inputs (nEvents x GetNvar() values).
+/// The default implementation evaluates the events one by one, reusing the same
+/// Event object; methods can override it with a faster evaluation of the block.
+
+void TMVA::MethodBase::GetBatchMvaValues( const Float_t* inputs, UInt_t nEvents, Float_t* mvaValues )
+{
+   const UInt_t nvar = GetNvar();
+   Event ev( std::vector<Float_t>(nvar), 0 );
+   for (UInt_t ievt=0; ievt<nEvents; ievt++) {
+      for (UInt_t ivar=0; ivar<nvar; ivar++) ev.SetVal( ivar, inputs[ievt*nvar + ivar] );
+      mvaValues[ievt] = GetMvaValue( &ev );
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// uses a pre-set cut on the MVA output (SetSignalReferenceCut and SetSignalReferenceCutOrientation)
 /// for a quick determination if an event would be selected as signal or background
@@ -123,6 +123,7 @@ The corresponding numbers are printed on standard output.
 
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 #include <cassert>
 
 REGISTER_METHOD(Fisher)
@@ -279,6 +280,37 @@ Double_t TMVA::MethodFisher::GetMvaValue( Double_t* err, Double_t* errUpper )
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// returns the Fisher values of nEvents events, given as untransformed input
+/// values stored one event after the other. The transformed values of a block
+/// of events are stored variable by variable, so that the sum over the
+/// coefficients runs over contiguous arrays.
+
+void TMVA::MethodFisher::GetBatchMvaValues( const Float_t* inputs, UInt_t nEvents, Float_t* mvaValues )
+{
+   const UInt_t nvar = GetNvar();
+   const UInt_t blockSize = 256;
+   Event input( std::vector<Float_t>(nvar), 0 );
+   std::vector<Double_t> values( nvar*std::min(blockSize, nEvents) );
+   std::vector<Double_t> result( std::min(blockSize, nEvents) );
+
+   for (UInt_t first=0; first<nEvents; first+=blockSize) {
+      const UInt_t n = std::min(blockSize, nEvents - first);
+      for (UInt_t i=0; i<n; i++) {
+         for (UInt_t ivar=0; ivar<nvar; ivar++) input.SetVal( ivar, inputs[(first+i)*nvar + ivar] );
+         const Event* ev = GetTransformationHandler().Transform( &input );
+         for (UInt_t ivar=0; ivar<nvar; ivar++) values[ivar*n + i] = ev->GetValue(ivar);
+      }
+      for (UInt_t i=0; i<n; i++) result[i] = fF0;
+      for (UInt_t ivar=0; ivar<nvar; ivar++) {
+         const Double_t coeff = (*fFisherCoeff)[ivar];
+         const Double_t* column = &values[ivar*n];
+         for (UInt_t i=0; i<n; i++) result[i] += coeff*column[i];
+      }
+      for (UInt_t i=0; i<n; i++) mvaValues[first+i] = result[i];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// initialization method; creates global matrices and vectors
 
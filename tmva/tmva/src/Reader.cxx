@@ -559,6 +559,123 @@ Double_t TMVA::Reader::EvaluateMVA( MethodBase* method, Double_t aux )
                                (fCalculateError?&fMvaEventErrorUpper:0) );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// returns a handle to the method booked with the given tag, to be used in the
+/// event loop instead of EvaluateMVA: the method is looked up once, and the
+/// events can be given as plain arrays, also many at once.
+/// The parameter aux is the efficiency cutoff for the cuts method.
+/// ~~~{.cpp}
+///    TMVA::ReaderEvaluator bdt = reader->GetEvaluator( "BDT method" );
+///    // inputs: nEvents x nVariables values, one event after the other
+///    bdt.Evaluate( inputs.data(), mvaValues.data(), nEvents );
+/// ~~~
+
+TMVA::ReaderEvaluator TMVA::Reader::GetEvaluator( const TString& methodTag, Double_t aux )
+{
+   std::map<TString, IMethod*>::iterator it = fMethodMap.find( methodTag );
+   if (it == fMethodMap.end()) {
+      Log() << kINFO << "<GetEvaluator> unknown classifier in map; "
+            << "you looked for \"" << methodTag << "\" within available methods: " << Endl;
+      for (it = fMethodMap.begin(); it!=fMethodMap.end(); ++it) Log() << "--> " << it->first << Endl;
+      Log() << "Check calling string" << kFATAL << Endl;
+      return ReaderEvaluator();
+   }
+
+   MethodBase * kl = dynamic_cast<TMVA::MethodBase*>(it->second);
+   if (kl==0) {
+      Log() << kFATAL << methodTag << " is not a method" << Endl;
+      return ReaderEvaluator();
+   }
+   return ReaderEvaluator( kl, DataInfo().GetNVariables(), aux, fLogger );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// constructor, used by Reader::GetEvaluator
+
+TMVA::ReaderEvaluator::ReaderEvaluator( MethodBase* method, UInt_t nVars, Double_t aux, MsgLogger* logger )
+   : fMethod( method ),
+     fNVars( nVars ),
+     fAux( aux ),
+     fEvent( std::vector<Float_t>(nVars), 0 ),
+     fLogger( logger )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// check for NaN in the input values of an event, as done by Reader::EvaluateMVA
+
+Bool_t TMVA::ReaderEvaluator::HasNaN( const Float_t* input ) const
+{
+   for (UInt_t i=0; i<fNVars; i++) {
+      if (TMath::IsNaN(input[i])) {
+         *fLogger << kERROR << i << "-th variable of the event is NaN --> return MVA value -999, \n that's all I can do, please fix or remove this event." << Endl;
+         return kTRUE;
+      }
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// the aux value is only needed for MethodCuts: it sets the required signal efficiency
+
+void TMVA::ReaderEvaluator::SetAux()
+{
+   if (fMethod->GetMethodType() == TMVA::Types::kCuts) {
+      TMVA::MethodCuts* mc = dynamic_cast<TMVA::MethodCuts*>(fMethod);
+      if (mc) mc->SetTestSignalEfficiency( fAux );
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// evaluates the MVA for the input values of an event
+
+Double_t TMVA::ReaderEvaluator::Evaluate( const Float_t* input )
+{
+   if (HasNaN( input )) return -999;
+   SetAux();
+   for (UInt_t i=0; i<fNVars; i++) fEvent.SetVal( i, input[i] );
+   return fMethod->GetMvaValue( &fEvent );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Double_t TMVA::ReaderEvaluator::Evaluate( const std::vector<Float_t>& input )
+{
+   if (input.size() != fNVars) {
+      *fLogger << kFATAL << "<Evaluate> the event has " << input.size() << " input values instead of "
+               << fNVars << Endl;
+      return 0;
+   }
+   return Evaluate( input.data() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// evaluates the MVA for nEvents events, whose input values are stored one event
+/// after the other in inputs; the events are evaluated by MethodBase::GetBatchMvaValues,
+/// which evaluates them by block for the methods supporting it (e.g. BDT and Fisher)
+
+void TMVA::ReaderEvaluator::Evaluate( const Float_t* inputs, Float_t* mvaValues, UInt_t nEvents )
+{
+   SetAux();
+   fMethod->GetBatchMvaValues( inputs, nEvents, mvaValues );
+   for (UInt_t ievt=0; ievt<nEvents; ievt++) {
+      if (HasNaN( inputs + ievt*fNVars )) mvaValues[ievt] = -999;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TMVA::ReaderEvaluator::Evaluate( const std::vector<Float_t>& inputs, std::vector<Float_t>& mvaValues )
+{
+   if (fNVars == 0 || inputs.size() % fNVars != 0) {
+      *fLogger << kFATAL << "<Evaluate> the number of input values " << inputs.size()
+               << " is not a multiple of the number of variables " << fNVars << Endl;
+      return;
+   }
+   mvaValues.resize( inputs.size()/fNVars );
+   Evaluate( inputs.data(), mvaValues.data(), mvaValues.size() );
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// evaluates MVA for given set of input variables
 
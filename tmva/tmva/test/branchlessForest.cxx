@@ -6,6 +6,7 @@
 #include "TMVA/TreeInference/BranchlessTree.hxx"
 #include "TMVA/TreeInference/Objectives.hxx"
 
+#include <cmath>
 #include <vector>
 
 using namespace TMVA::Experimental;
@@ -225,6 +226,62 @@ TEST(BranchlessForest, InferenceTwoTrees)
    TestInferenceTwoTrees<BranchlessForest<float>>("BranchlessForest");
 }
 
+template <typename ForestType>
+void TestInferenceManyEvents(const std::string& tag)
+{
+   // more events than the size of the blocks evaluated tree by tree
+   const auto maxDepth = 2;
+   const auto numInputs = 2;
+   const auto numTrees = 3;
+   const std::vector<int> treeInputs = {0, 1, 0, 1, 1, 0, 0, 0, 1};
+   const std::vector<float> thresholds = {0.0, -0.5, 0.5, 1.0, 2.0, 3.0, 4.0,
+                                          0.2, 0.1, -0.1, -1.0, -2.0, -3.0, -4.0,
+                                          -0.3, 0.4, 0.0, 0.5, 0.25, 0.125, 0.0625};
+   WriteModel("myModel", "Test" + tag + "4.root", "identity", treeInputs, {0, 0, 0}, thresholds, {maxDepth},
+              {numTrees}, {numInputs}, {1});
+
+   ForestType forest;
+   forest.Load("myModel", "Test" + tag + "4.root", 0);
+
+   const int rows = 150;
+   std::vector<float> inputs(numInputs * rows);
+   for (int i = 0; i < numInputs * rows; i++)
+      inputs[i] = std::sin(0.37 * i);
+   std::vector<float> expected(rows, 0.0);
+   for (int t = 0; t < numTrees; t++) {
+      BranchlessTree<float> tree;
+      tree.fTreeDepth = maxDepth;
+      tree.fInputs = {treeInputs.begin() + 3 * t, treeInputs.begin() + 3 * t + 3};
+      tree.fThresholds = {thresholds.begin() + 7 * t, thresholds.begin() + 7 * t + 7};
+      for (int i = 0; i < rows; i++)
+         expected[i] += tree.Inference(inputs.data() + i * numInputs, 1);
+   }
+
+   std::vector<float> predictions(rows);
+   forest.Inference(inputs.data(), rows, true, predictions.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], expected[i]);
+
+   // same events in column major layout
+   std::vector<float> inputsColumnMajor(numInputs * rows);
+   for (int i = 0; i < rows; i++)
+      for (int j = 0; j < numInputs; j++)
+         inputsColumnMajor[j * rows + i] = inputs[i * numInputs + j];
+   forest.Inference(inputsColumnMajor.data(), rows, false, predictions.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], expected[i]);
+}
+
+TEST(BranchlessJittedForest, InferenceManyEvents)
+{
+   TestInferenceManyEvents<BranchlessJittedForest<float>>("BranchlessJittedForest");
+}
+
+TEST(BranchlessForest, InferenceManyEvents)
+{
+   TestInferenceManyEvents<BranchlessForest<float>>("BranchlessForest");
+}
+
 TEST(BranchlessForest, SortTrees)
 {
    const auto maxDepth = 1;
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "TMVA/RBatchGenerator.hxx"
+#include "ROOT/RDataFrame.hxx"
+
+#include <set>
+
+using namespace ROOT;
+using namespace TMVA::Experimental;
+
+TEST(RBatchGenerator, Ordered)
+{
+   RDataFrame df(100);
+   auto df2 = df.Define("a", "1.f * rdfentry_").Define("b", "-2. * rdfentry_");
+   RBatchGenerator<float, double> generator(df2, {"a", "b"}, 8, 32, false);
+   EXPECT_EQ(generator.GetNEvents(), 100u);
+   EXPECT_EQ(generator.GetNBatches(), 13u);
+   generator.Start();
+   std::size_t nEvents = 0;
+   while (generator.HasNextBatch()) {
+      auto x = generator.GetNextBatch();
+      ASSERT_EQ(x.GetShape().size(), 2u);
+      EXPECT_EQ(x.GetShape()[0], nEvents < 96 ? 8u : 4u);
+      EXPECT_EQ(x.GetShape()[1], 2u);
+      for (std::size_t i = 0; i < x.GetShape()[0]; i++) {
+         EXPECT_EQ(x(i, 0), 1.f * nEvents);
+         EXPECT_EQ(x(i, 1), -2.f * nEvents);
+         nEvents++;
+      }
+   }
+   EXPECT_EQ(nEvents, 100u);
+   EXPECT_THROW(generator.GetNextBatch(), std::runtime_error);
+}
+
+TEST(RBatchGenerator, ShuffledEpochs)
+{
+   RDataFrame df(1000);
+   auto df2 = df.Define("a", "int(rdfentry_)").Filter("a % 3 != 0");
+   RBatchGenerator<int> generator(df2, {"a"}, 10, 100);
+   EXPECT_EQ(generator.GetNEvents(), 666u);
+   std::vector<float> firstEpoch;
+   for (int epoch = 0; epoch < 2; epoch++) {
+      generator.Start();
+      std::vector<float> values;
+      while (generator.HasNextBatch()) {
+         auto x = generator.GetNextBatch();
+         values.insert(values.end(), x.GetData(), x.GetData() + x.GetSize());
+      }
+      ASSERT_EQ(values.size(), 666u);
+      std::set<float> unique(values.begin(), values.end());
+      EXPECT_EQ(unique.size(), 666u);
+      for (auto v : unique)
+         EXPECT_NE(int(v) % 3, 0);
+      EXPECT_FALSE(std::is_sorted(values.begin(), values.end()));
+      if (epoch == 0)
+         firstEpoch = values;
+      else
+         EXPECT_NE(values, firstEpoch);
+   }
+}
+
+TEST(RBatchGenerator, StopEarly)
+{
+   RDataFrame df(1000);
+   auto df2 = df.Define("a", "1.f * rdfentry_");
+   RBatchGenerator<float> generator(df2, {"a"}, 10, 50);
+   generator.Start();
+   ASSERT_TRUE(generator.HasNextBatch());
+   generator.GetNextBatch();
+   generator.Stop();
+   EXPECT_FALSE(generator.HasNextBatch());
+}
+
+TEST(RBatchGenerator, WrongArguments)
+{
+   RDataFrame df(10);
+   auto df2 = df.Define("a", "1.f * rdfentry_");
+   EXPECT_THROW((RBatchGenerator<float, float>(df2, {"a"}, 2, 4)), std::runtime_error);
+   EXPECT_THROW((RBatchGenerator<float>(df2, {"a"}, 8, 4)), std::runtime_error);
+}
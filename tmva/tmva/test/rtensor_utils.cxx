@@ -47,3 +47,68 @@ TEST(RTensor, AsTensorColumnMajor)
       EXPECT_EQ(x(i, 1), -1.f * i);
    }
 }
+
+TEST(RTensor, AsTensorViewRVec)
+{
+   ROOT::RVecF v{1, 2, 3, 4, 5, 6};
+   auto x = AsTensorView(v);
+   EXPECT_TRUE(x.IsView());
+   EXPECT_EQ(x.GetData(), v.data());
+   EXPECT_EQ(x.GetShape(), std::vector<std::size_t>({6}));
+   auto y = AsTensorView(v, {2, 3});
+   EXPECT_EQ(y(1, 0), 4.f);
+   y(1, 0) = -4.f;
+   EXPECT_EQ(v[3], -4.f);
+   EXPECT_THROW(AsTensorView(v, {4, 2}), std::runtime_error);
+}
+
+TEST(RTensor, AsTensorViewColumns)
+{
+   std::vector<float> buffer;
+   // separate columns are copied
+   ROOT::RVecF a{1, 2, 3}, b{-1, -2, -3};
+   auto x = AsTensorView(buffer, a, b);
+   EXPECT_EQ(x.GetData(), buffer.data());
+   EXPECT_EQ(x.GetMemoryLayout(), MemoryLayout::ColumnMajor);
+   EXPECT_EQ(x.GetShape(), std::vector<std::size_t>({3, 2}));
+   for (size_t i = 0; i < 3; i++) {
+      EXPECT_EQ(x(i, 0), a[i]);
+      EXPECT_EQ(x(i, 1), b[i]);
+   }
+   // columns one after the other in memory are viewed in place
+   std::vector<float> values{1, 2, 3, -1, -2, -3};
+   ROOT::RVecF c(values.data(), 3), d(values.data() + 3, 3);
+   auto y = AsTensorView(buffer, c, d);
+   EXPECT_EQ(y.GetData(), values.data());
+   for (size_t i = 0; i < 3; i++) {
+      EXPECT_EQ(y(i, 0), c[i]);
+      EXPECT_EQ(y(i, 1), d[i]);
+   }
+   ROOT::RVecF e{1, 2};
+   EXPECT_THROW(AsTensorView(buffer, a, e), std::runtime_error);
+}
+
+TEST(RTensor, AsTensorViewEntries)
+{
+   std::vector<float> buffer;
+   // entries with their own memory are copied
+   ROOT::RVec<ROOT::RVecF> entries{{1, 2}, {3, 4}, {5, 6}};
+   auto x = AsTensorView(buffer, entries);
+   EXPECT_EQ(x.GetData(), buffer.data());
+   EXPECT_EQ(x.GetMemoryLayout(), MemoryLayout::RowMajor);
+   EXPECT_EQ(x.GetShape(), std::vector<std::size_t>({3, 2}));
+   for (size_t i = 0; i < 3; i++) {
+      EXPECT_EQ(x(i, 0), 2.f * i + 1);
+      EXPECT_EQ(x(i, 1), 2.f * i + 2);
+   }
+   // entries one after the other in memory are viewed in place
+   std::vector<float> values{1, 2, 3, 4, 5, 6};
+   ROOT::RVec<ROOT::RVecF> views;
+   for (size_t i = 0; i < 3; i++)
+      views.emplace_back(values.data() + 2 * i, 2);
+   auto y = AsTensorView(buffer, views);
+   EXPECT_EQ(y.GetData(), values.data());
+   EXPECT_EQ(y(2, 1), 6.f);
+   entries[1].push_back(0);
+   EXPECT_THROW(AsTensorView(buffer, entries), std::runtime_error);
+}
@@ -63,8 +63,20 @@ private:
    // work given that the pointer to the boolean in that case cannot be taken
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
+   /// The text of a chunk of the file read by GetEntryRanges in chunked parsing mode, see EnableChunkedParsing
+   struct RTextChunk {
+      ULong64_t fFirstEntry;
+      std::string fText;
+   };
+   std::uint64_t fChunkBytes = 0;   // the size of the chunks of the file in chunked parsing mode, 0 if disabled
+   std::uint64_t fChunkPos = 0;     // the file offset of the beginning of the next chunk
+   std::vector<RTextChunk> fChunks; // the chunks of the last GetEntryRanges call, one per range
+   std::vector<std::vector<Record_t>> fSlotRecords;           // the records of the chunk processed by each slot
+   std::vector<ULong64_t> fSlotFirstEntry;                    // the first entry of the chunk processed by each slot
+   std::vector<std::set<std::string>> fSlotColContainingEmpty; // fColContainingEmpty, one per slot
+
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void FillRecord(const std::string &, Record_t &, std::set<std::string> &colContainingEmpty);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
@@ -73,7 +85,9 @@ private:
    std::vector<std::string> ParseColumns(const std::string &);
    size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
    ColType_t GetType(std::string_view colName) const;
-   void FreeRecords();
+   void FreeRecords(std::vector<Record_t> &records);
+   bool ReadChunk(std::string &chunk);
+   void WarnAboutEmptyCells() const;
 
 protected:
    std::string AsString() final;
@@ -89,7 +103,10 @@ public:
    bool HasColumn(std::string_view colName) const final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
    void SetNSlots(unsigned int nSlots) final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
+   void FinalizeSlot(unsigned int slot) final;
    std::string GetLabel() final;
+   void EnableChunkedParsing(std::uint64_t chunkBytes = 64 * 1024 * 1024);
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
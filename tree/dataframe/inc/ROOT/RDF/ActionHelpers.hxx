@@ -21,6 +21,7 @@
 
 #include "Compression.h"
 #include "ROOT/RStringView.hxx"
+#include "ROOT/RMemoryBudget.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
 #include "ROOT/RDF/RCutFlowReport.hxx"
@@ -37,6 +38,7 @@
 #include "TError.h" // for R__ASSERT, Warning
 #include "TFile.h" // for SnapshotHelper
 #include "TH1.h"
+#include "TH2.h" // for UniformBinsFillHelper
 #include "TGraph.h"
 #include "TGraphAsymmErrors.h"
 #include "TLeaf.h"
@@ -46,8 +48,16 @@
 #include "TStatistic.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
+#ifdef R__HAS_ROOT7
+#include "ROOT/RNTuple.hxx"        // for SnapshotRNTupleHelper
+#include "ROOT/RNTupleModel.hxx"   // for SnapshotRNTupleHelper
+#include "ROOT/RNTupleOptions.hxx" // for SnapshotRNTupleHelper
+#endif
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -62,6 +72,8 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+class RDataFrame; // for SnapshotRNTupleHelper
+
 namespace Internal {
 namespace RDF {
 using namespace ROOT::TypeTraits;
@@ -351,11 +363,17 @@ extern template void BufferedFillHelper::Exec(unsigned int, const std::vector<in
 extern template void
 BufferedFillHelper::Exec(unsigned int, const std::vector<unsigned int> &, const std::vector<unsigned int> &);
 
+/// Estimate the memory of a copy of the histogram for a processing slot: its bin contents and sums of squares of
+/// weights, which are accounted for in the ROOT::Experimental::RMemoryBudget.
+std::size_t EstimateHistogramSize(const TH1 &h);
+
 /// The generic Fill helper: it calls Fill on per-thread objects and then Merge to produce a final result.
 /// For one-dimensional histograms, if no axes are specified, RDataFrame uses BufferedFillHelper instead.
 template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    std::vector<HIST *> fObjects;
+   /// The memory of the copies of the histogram for the slots other than the first, if HIST is a histogram
+   ROOT::Experimental::RMemoryBudget::RAllocation fSlotObjectsMemory{ROOT::Experimental::RMemoryBudget::kSlotResults};
 
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
@@ -379,6 +397,10 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
 
    void UnsetDirectoryIfPossible(...) {}
 
+   std::size_t EstimateSizeIfPossible(const TH1 *h) { return EstimateHistogramSize(*h); }
+
+   std::size_t EstimateSizeIfPossible(...) { return 0; }
+
    // Merge overload for types with Merge(TCollection*), like TH1s
    template <typename H, typename = std::enable_if_t<std::is_base_of<TObject, H>::value, int>>
    auto Merge(std::vector<H *> &objs, int /*toincreaseoverloadpriority*/)
@@ -477,6 +499,7 @@ public:
          fObjects[i] = new HIST(*fObjects[0]);
          UnsetDirectoryIfPossible(fObjects[i]);
       }
+      fSlotObjectsMemory.Resize((nSlots - 1) * EstimateSizeIfPossible(fObjects[0]));
    }
 
    void InitTask(TTreeReader *, unsigned int) {}
@@ -535,6 +558,7 @@ public:
       // delete the copies we created for the slots other than the first
       for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
          delete *it;
+      fSlotObjectsMemory.Resize(0);
    }
 
    HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
@@ -569,6 +593,193 @@ public:
    }
 };
 
+/// Whether a histogram can be filled by UniformBinsFillHelper: it must be empty and not buffered, and all of its axes
+/// must have fixed-size bins, no labels and must not be extendable.
+bool CanUseUniformBinsFill(const TH1 &h);
+
+/// A Fill helper for the common case of TH1Ds and TH2Ds with fixed-size bins, filled with scalar values.
+///
+/// Instead of calling TH1::Fill for every value, the values are buffered per slot. When a buffer is full, the bin
+/// indices of all of its values are computed in a loop without calls, that compilers can vectorize; then the bin
+/// contents, the sum of squares of weights and the statistics of the slot histogram are updated directly. The results
+/// are the same as with TH1::Fill (up to the order of the floating-point sums of the statistics).
+/// RDataFrame uses this helper for Histo1D and Histo2D if CanUseUniformBinsFill() is true, FillHelper otherwise.
+template <typename HIST>
+class R__CLING_PTRCHECK(off) UniformBinsFillHelper : public RActionImpl<UniformBinsFillHelper<HIST>> {
+   static constexpr unsigned int kDim = std::is_base_of<TH2, HIST>::value ? 2 : 1;
+   static constexpr std::size_t kBufSize = 1024;
+
+   struct RSlotBuffer {
+      std::array<std::array<double, kBufSize>, kDim> fValues;
+      std::array<double, kBufSize> fWeights;
+      std::array<std::array<int, kBufSize>, kDim> fBins;
+      std::size_t fSize = 0;
+      /// The statistics of the slot histogram, in the layout of TH1::GetStats
+      std::array<double, TH1::kNstat> fStats{};
+      double fEntries = 0.;
+   };
+
+   std::vector<HIST *> fObjects;
+   std::vector<std::unique_ptr<RSlotBuffer>> fBuffers;
+   /// The memory of the buffers and of the copies of the histogram for the slots other than the first
+   ROOT::Experimental::RMemoryBudget::RAllocation fSlotObjectsMemory{ROOT::Experimental::RMemoryBudget::kSlotResults};
+
+   // Same arithmetic as TAxis::FindBin for fixed-size bins: in particular, NaNs end up in the overflow bin
+   static void FindBins(const TAxis &axis, const double *values, int *bins, std::size_t n)
+   {
+      const int nBins = axis.GetNbins();
+      const double xMin = axis.GetXmin();
+      const double xMax = axis.GetXmax();
+      for (std::size_t i = 0; i < n; ++i) {
+         const double x = values[i];
+         bins[i] = x < xMin ? 0 : (!(x < xMax) ? nBins + 1 : 1 + int(nBins * (x - xMin) / (xMax - xMin)));
+      }
+   }
+
+   static const TAxis &GetAxis(const HIST &h, unsigned int d) { return d == 0 ? *h.GetXaxis() : *h.GetYaxis(); }
+
+   void Flush(unsigned int slot)
+   {
+      auto &buf = *fBuffers[slot];
+      const auto n = buf.fSize;
+      if (n == 0)
+         return;
+      HIST &h = *fObjects[slot];
+
+      std::array<int, kDim> nBins;
+      for (unsigned int d = 0; d < kDim; ++d) {
+         nBins[d] = GetAxis(h, d).GetNbins();
+         FindBins(GetAxis(h, d), buf.fValues[d].data(), buf.fBins[d].data(), n);
+      }
+
+      // as in TH1::Fill, the first weight different from 1 turns on the storage of the sum of squares of weights
+      const auto *weights = buf.fWeights.data();
+      if (!h.GetSumw2N() && !h.TestBit(TH1::kIsNotW) &&
+          std::any_of(weights, weights + n, [](double w) { return w != 1.; }))
+         h.Sumw2();
+
+      double *contents = h.GetArray();
+      double *sumw2 = h.GetSumw2N() ? h.GetSumw2()->GetArray() : nullptr;
+      const auto &binsX = buf.fBins[0];
+      const auto &binsY = buf.fBins[kDim - 1];
+      for (std::size_t i = 0; i < n; ++i) {
+         const int bin = kDim == 2 ? binsY[i] * (nBins[0] + 2) + binsX[i] : binsX[i];
+         contents[bin] += weights[i];
+         if (sumw2)
+            sumw2[bin] += weights[i] * weights[i];
+      }
+
+      // as in TH1::Fill, values in the under- and overflow bins only enter the statistics if requested
+      const bool statOverflows = h.GetStatOverflowsBehaviour();
+      auto &stats = buf.fStats;
+      const auto *xs = buf.fValues[0].data();
+      const auto *ys = buf.fValues[kDim - 1].data();
+      for (std::size_t i = 0; i < n; ++i) {
+         bool inRange = true;
+         for (unsigned int d = 0; d < kDim; ++d)
+            inRange &= buf.fBins[d][i] > 0 && buf.fBins[d][i] <= nBins[d];
+         if (!inRange && !statOverflows)
+            continue;
+         const double w = weights[i];
+         stats[0] += w;
+         stats[1] += w * w;
+         stats[2] += w * xs[i];
+         stats[3] += w * xs[i] * xs[i];
+         if (kDim == 2) {
+            stats[4] += w * ys[i];
+            stats[5] += w * ys[i] * ys[i];
+            stats[6] += w * xs[i] * ys[i];
+         }
+      }
+      buf.fEntries += n;
+      buf.fSize = 0;
+
+      h.PutStats(stats.data());
+      h.SetEntries(buf.fEntries);
+   }
+
+public:
+   UniformBinsFillHelper(UniformBinsFillHelper &&) = default;
+   UniformBinsFillHelper(const UniformBinsFillHelper &) = delete;
+
+   UniformBinsFillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObjects(nSlots, nullptr), fBuffers(nSlots)
+   {
+      fObjects[0] = h.get();
+      for (unsigned int i = 1; i < nSlots; ++i) {
+         fObjects[i] = new HIST(*fObjects[0]);
+         fObjects[i]->SetDirectory(nullptr);
+      }
+      for (auto &buf : fBuffers)
+         buf = std::make_unique<RSlotBuffer>();
+      fSlotObjectsMemory.Resize((nSlots - 1) * EstimateHistogramSize(*fObjects[0]) + nSlots * sizeof(RSlotBuffer));
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   /// Buffer kDim values, optionally followed by a weight
+   template <typename... ValTypes>
+   void Exec(unsigned int slot, const ValTypes &...vals)
+   {
+      static_assert(sizeof...(ValTypes) == kDim || sizeof...(ValTypes) == kDim + 1,
+                    "UniformBinsFillHelper: wrong number of values");
+      auto &buf = *fBuffers[slot];
+      const double values[] = {static_cast<double>(vals)...};
+      for (unsigned int d = 0; d < kDim; ++d)
+         buf.fValues[d][buf.fSize] = values[d];
+      buf.fWeights[buf.fSize] = sizeof...(ValTypes) > kDim ? values[sizeof...(ValTypes) - 1] : 1.;
+      if (++buf.fSize == kBufSize)
+         Flush(slot);
+   }
+
+   void FinalizeTask(unsigned int slot) { Flush(slot); }
+
+   void Initialize() { /* noop */}
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fObjects.size(); ++slot)
+         Flush(slot);
+      if (fObjects.size() == 1)
+         return;
+
+      TList l;
+      for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
+         l.Add(*it);
+      fObjects[0]->Merge(&l);
+
+      // delete the copies we created for the slots other than the first
+      for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
+         delete *it;
+      fSlotObjectsMemory.Resize(0);
+   }
+
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      Flush(slot);
+      return *fObjects[slot];
+   }
+
+   // Helper functions for RMergeableValue
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<HIST>>(*fObjects[0]);
+   }
+
+   std::string GetActionName()
+   {
+      return std::string(fObjects[0]->IsA()->GetName()) + "\\n" + std::string(fObjects[0]->GetName());
+   }
+
+   UniformBinsFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return UniformBinsFillHelper(result, fObjects.size());
+   }
+};
+
 class R__CLING_PTRCHECK(off) FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
 public:
    using Result_t = ::TGraph;
@@ -836,6 +1047,8 @@ template <typename RealT_t, typename T>
 class R__CLING_PTRCHECK(off) TakeHelper<RealT_t, T, std::vector<T>>
    : public RActionImpl<TakeHelper<RealT_t, T, std::vector<T>>> {
    Results<std::shared_ptr<std::vector<T>>> fColls;
+   /// The memory of the collection of each slot, updated when the collection is reallocated
+   std::vector<ROOT::Experimental::RMemoryBudget::RAllocation> fCollsMemory;
 
 public:
    using ColumnTypes_t = TypeList<T>;
@@ -847,13 +1060,23 @@ public:
          v->reserve(1024);
          fColls.emplace_back(v);
       }
+      for (unsigned int i = 0; i < nSlots; ++i)
+         fCollsMemory.emplace_back(ROOT::Experimental::RMemoryBudget::kTakeResults);
    }
    TakeHelper(TakeHelper &&);
    TakeHelper(const TakeHelper &) = delete;
 
    void InitTask(TTreeReader *, unsigned int) {}
 
-   void Exec(unsigned int slot, T &v) { FillColl(v, *fColls[slot]); }
+   void Exec(unsigned int slot, T &v)
+   {
+      auto &coll = *fColls[slot];
+      FillColl(v, coll);
+      // std::vector<bool> stores one bit per value
+      const auto size = std::is_same<T, bool>::value ? coll.capacity() / 8 : coll.capacity() * sizeof(T);
+      if (size != fCollsMemory[slot].GetSize())
+         fCollsMemory[slot].Resize(size);
+   }
 
    void Initialize() { /* noop */}
 
@@ -869,6 +1092,9 @@ public:
          auto &coll = fColls[i];
          rColl->insert(rColl->end(), coll->begin(), coll->end());
       }
+      // the result belongs to the user from now on
+      for (auto &memory : fCollsMemory)
+         memory.Resize(0);
    }
 
    std::vector<T> &PartialUpdate(unsigned int slot) { return *fColls[slot]; }
@@ -1810,6 +2036,113 @@ public:
    }
 };
 
+#ifdef R__HAS_ROOT7
+void ValidateSnapshotRNTupleOutput(const RSnapshotOptions &opts, const std::string &dirName);
+/// Replace the dataframe returned by a Snapshot to RNTuple, once the RNTuple is written, by one that reads it
+void SetSnapshotRNTupleOutput(ROOT::RDataFrame &outputDF, const std::string &ntupleName, const std::string &fileName);
+
+/// The type of the RNTuple field that stores a column of type T. (Unsigned) long long, e.g. ULong64_t, has no field of
+/// its own: it is stored as the fixed-width integer of the same size.
+template <typename T>
+struct RSnapshotFieldType {
+   using Type = T;
+};
+template <>
+struct RSnapshotFieldType<long long> {
+   static_assert(sizeof(long long) == sizeof(std::int64_t), "unexpected size of long long");
+   using Type = std::int64_t;
+};
+template <>
+struct RSnapshotFieldType<unsigned long long> {
+   static_assert(sizeof(unsigned long long) == sizeof(std::uint64_t), "unexpected size of unsigned long long");
+   using Type = std::uint64_t;
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple, in single- and multi-thread event loops.
+/// Every slot fills its own RNTupleFillContext, whose clusters are committed to the same file by the
+/// RNTupleParallelWriter: unlike the multi-thread TTree Snapshot, there is no merging step.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const RSnapshotOptions fOptions;
+   const ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   /// Fill contexts per slot, created by the first task of the slot. Must be destructed before fWriter.
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   /// Entries per slot, whose values are bound to the column values of each event. Destructed before the contexts.
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   /// The dataframe returned by Snapshot; it reads the RNTuple once it is written
+   std::shared_ptr<ROOT::RDataFrame> fOutputDF;
+
+   template <typename T>
+   static int CaptureValue(ROOT::Experimental::REntry::Iterator_t &value, T &columnValue)
+   {
+      *value = value->GetField()->CaptureValue(&columnValue);
+      ++value;
+      return 0;
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &fieldNames, const RSnapshotOptions &options,
+                         std::shared_ptr<ROOT::RDataFrame> outputDF)
+      : fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(fieldNames)), fFillContexts(nSlots), fEntries(nSlots),
+        fOutputDF(std::move(outputDF))
+   {
+      ValidateSnapshotRNTupleOutput(fOptions, std::string(dirname));
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      std::size_t i = 0;
+      int expander[] = {
+         (model->MakeField<typename RSnapshotFieldType<ColTypes>::Type>(fOutputFieldNames[i++]), 0)..., 0};
+      (void)expander;
+      (void)i; // avoid unused variable warnings when there are no columns
+
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(
+         ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+      fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName,
+                                                                     writeOptions);
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fFillContexts[slot]) {
+         fFillContexts[slot] = fWriter->CreateFillContext();
+         fEntries[slot] = fFillContexts[slot]->GetModel()->CreateBareEntry();
+      }
+   }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      // the addresses of the values can change from one entry to the next, e.g. for defined columns in bulk mode
+      auto value = fEntries[slot]->begin();
+      int expander[] = {CaptureValue(value, values)..., 0};
+      (void)expander;
+      fFillContexts[slot]->Fill(*fEntries[slot]);
+   }
+
+   void Finalize()
+   {
+      // destructing the fill contexts commits their last clusters, destructing the writer writes the footer
+      fEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+      SetSnapshotRNTupleOutput(*fOutputDF, fNTupleName, fFileName);
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+#endif // R__HAS_ROOT7
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
@@ -24,6 +24,7 @@
 #include <ROOT/RDF/RJittedFilter.hxx>
 #include <ROOT/RDF/RJittedVariation.hxx>
 #include <ROOT/RDF/RLoopManager.hxx>
+#include <ROOT/RDF/RResultCache.hxx>
 #include <ROOT/RStringView.hxx>
 #include <ROOT/RDF/RVariation.hxx>
 #include <ROOT/TypeTraits.hxx>
@@ -136,6 +137,36 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h,
    return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
 }
 
+// Filling of TH1Ds and TH2Ds with fixed-size bins from scalar values: use the fast UniformBinsFillHelper
+template <typename... ColTypes, typename HIST, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildFillHistoAction(const ColumnNames_t &bl, const std::shared_ptr<HIST> &h, const unsigned int nSlots,
+                     std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister,
+                     std::true_type /*allArithmetic*/)
+{
+   if (CanUseUniformBinsFill(*h)) {
+      using Helper_t = UniformBinsFillHelper<HIST>;
+      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+   }
+   return BuildFillHistoAction<ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister, std::false_type{});
+}
+
+template <typename... ColTypes, typename HIST, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildFillHistoAction(const ColumnNames_t &bl, const std::shared_ptr<HIST> &h, const unsigned int nSlots,
+                     std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister,
+                     std::false_type /*allArithmetic*/)
+{
+   using Helper_t = FillHelper<HIST>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
+template <typename... ColTypes>
+using AllArithmetic_t = std::is_same<std::integer_sequence<bool, true, std::is_arithmetic<ColTypes>::value...>,
+                                     std::integer_sequence<bool, std::is_arithmetic<ColTypes>::value..., true>>;
+
 // Histo1D filling (must handle the special case of distinguishing FillHelper and BufferedFillHelper
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -145,9 +176,8 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    auto hasAxisLimits = HistoUtils<::TH1D>::HasAxisLimits(*h);
 
    if (hasAxisLimits) {
-      using Helper_t = FillHelper<::TH1D>;
-      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
-      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+      return BuildFillHistoAction<ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister,
+                                               AllArithmetic_t<ColTypes...>{});
    } else {
       using Helper_t = BufferedFillHelper;
       using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
@@ -155,6 +185,16 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    }
 }
 
+// Histo2D filling of TH2Ds (other two-dimensional histograms use the generic filling)
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH2D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo2D, const RColumnRegister &colRegister)
+{
+   return BuildFillHistoAction<ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister,
+                                            AllArithmetic_t<ColTypes...>{});
+}
+
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<TGraph> &g, const unsigned int nSlots,
@@ -251,6 +291,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// The dataframe returned by Snapshot, only needed for RNTuple output: it is set up once the RNTuple is written
+   std::shared_ptr<ROOT::RDataFrame> fOutputDF;
 };
 
 // Snapshot action
@@ -276,7 +318,18 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+      // single- and multi-thread snapshot to RNTuple
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(
+         Helper_t(nSlots, filename, dirname, treename, outputColNames, options, snapHelperArgs->fOutputDF), colNames,
+         prevNode, colRegister));
+#else
+      throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7.");
+#endif
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -329,6 +382,53 @@ void CheckForNoVariations(const std::string &where, std::string_view definedColV
 
 std::string PrettyPrintAddr(const void *const addr);
 
+std::string GetColumnFingerprint(const std::string &col, const RColumnRegister &colRegister);
+
+std::string MakeActionFingerprint(const std::string &actionName, const ColumnNames_t &columns,
+                                  const RNodeBase &prevNode, const RColumnRegister &colRegister);
+
+/// Whether the results of an action can be stored in the result cache, see RInterfaceBase::SetResultCache.
+/// These are the actions whose result only depends on the values of their input columns.
+template <typename ActionTag>
+struct RIsCacheableAction : std::false_type {};
+// clang-format off
+template <> struct RIsCacheableAction<ActionTags::Histo1D> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Histo2D> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Histo3D> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::HistoND> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Graph> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::GraphAsymmErrors> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Profile1D> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Profile2D> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Min> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Max> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Sum> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::Mean> : std::true_type {};
+template <> struct RIsCacheableAction<ActionTags::StdDev> : std::true_type {};
+// clang-format on
+
+/// Register the result of an action with the result cache of the loop manager, under the given fingerprint of the
+/// action. Nothing happens if the action cannot be described or if its result cannot be stored in a ROOT file.
+template <typename T>
+void RegisterCachedResult(RLoopManager &lm, const std::string &fingerprint, const std::shared_ptr<T> &r,
+                          const std::shared_ptr<RActionBase> &action)
+{
+   using IO_t = RResultCacheIO<T>;
+   if (fingerprint.empty() || !IO_t::CanCache())
+      return;
+   const std::weak_ptr<T> result = r;
+   auto read = [result](TDirectory &dir, const std::string &key) {
+      auto resultPtr = result.lock();
+      return resultPtr && IO_t::Read(*resultPtr, dir, key);
+   };
+   auto write = [result](TDirectory &dir, const std::string &key) {
+      if (auto resultPtr = result.lock())
+         IO_t::Write(*resultPtr, dir, key);
+   };
+   // the initial state of the result, e.g. the binning of a histogram, is part of the description of the action
+   lm.RegisterCachedResult({action, fingerprint + '\n' + IO_t::GetState(*r), std::move(read), std::move(write)});
+}
+
 std::shared_ptr<RJittedFilter> BookFilterJit(std::shared_ptr<RNodeBase> *prevNodeOnHeap, std::string_view name,
                                              std::string_view expression, const ColumnNames_t &branches,
                                              const RColumnRegister &colRegister, TTree *tree, RDataSource *ds);
@@ -113,8 +113,26 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   void RunBulk(unsigned int slot, RMaskedEntryRange &mask) final
+   {
+      // flag the entries that pass all filters, then process them in order
+      fPrevNode.CheckFiltersBulk(slot, mask);
+      const auto firstEntry = mask.GetFirstEntry();
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i])
+            CallExec(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
+   bool HasUpstreamFilters() final
+   {
+      std::vector<std::string> filters;
+      fPrevNode.AddFilterName(filters);
+      return !filters.empty();
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -12,10 +12,12 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 
@@ -51,6 +53,8 @@ private:
    std::vector<std::string> fVariations;
 
    RColumnRegister fColRegister;
+   /// The node of the profiler of the loop manager that times the runs of this action, see SetProfilerNode()
+   unsigned int fProfilerNode = 0;
 
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RColumnRegister &colRegister,
@@ -63,7 +67,18 @@ public:
    RColumnRegister &GetColRegister() { return fColRegister; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
+   /// Set the node of the profiler of the loop manager that times the runs of this action in the following event
+   /// loop, if it is profiled. Actions are timed by the loop manager, which runs them.
+   void SetProfilerNode(unsigned int node) { fProfilerNode = node; }
+   unsigned int GetProfilerNode() const { return fProfilerNode; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Run the action on the entries of the range of mask, in bulk processing mode. Overridden by RAction: this
+   /// default implementation runs the entries one by one, ignoring the content of the mask.
+   virtual void RunBulk(unsigned int slot, RMaskedEntryRange &mask)
+   {
+      for (std::size_t i = 0; i < mask.Size(); ++i)
+         Run(slot, mask.GetFirstEntry() + i);
+   }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -73,6 +88,9 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    virtual void *PartialUpdate(unsigned int slot) = 0;
 
+   /// Whether the action only processes entries that passed a filter. Overridden by RAction.
+   virtual bool HasUpstreamFilters() { return false; }
+
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
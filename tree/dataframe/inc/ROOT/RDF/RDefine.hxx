@@ -14,6 +14,7 @@
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
@@ -22,6 +23,7 @@
 
 #include <array>
 #include <deque>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -70,28 +72,43 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
+   /// The values of the entries of the current range in bulk processing mode
+   struct RBulkValues {
+      ValuesPerSlot_t fValues;
+      std::vector<char> fIsComputed; ///< Whether the value of the nth entry of the range was already computed
+      Long64_t fFirstEntry{-1};
+      Long64_t fSize{0};
+   };
+   std::vector<RBulkValues> fBulkValues; ///< One per slot
+
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   void UpdateHelper(ret_type &result, unsigned int slot, Long64_t entry, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      // the column values are read outside of the RVec arena, which is only used by the temporaries of fExpression
+      auto &&args = std::forward_as_tuple(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      RDFInternal::AssignDefineResult(result, fLoopManager->GetRVecArena(slot),
+                                      [&] { return fExpression(std::get<S>(args)...); });
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   void UpdateHelper(ret_type &result, unsigned int slot, Long64_t entry, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      auto &&args = std::forward_as_tuple(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      RDFInternal::AssignDefineResult(result, fLoopManager->GetRVecArena(slot),
+                                      [&] { return fExpression(slot, std::get<S>(args)...); });
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void
-   UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   void UpdateHelper(ret_type &result, unsigned int slot, Long64_t entry, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      auto &&args = std::forward_as_tuple(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      RDFInternal::AssignDefineResult(result, fLoopManager->GetRVecArena(slot),
+                                      [&] { return fExpression(slot, entry, std::get<S>(args)...); });
    }
 
 public:
@@ -99,7 +116,8 @@ public:
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBulkValues(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +131,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkValues[slot].fSize = 0;
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -126,11 +145,39 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         RDFInternal::RProfileScope profile(fProfiler, slot, fProfilerNode);
+         UpdateHelper(fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()], slot, entry, ColumnTypes_t{},
+                      TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry) final
+   {
+      auto &bulk = fBulkValues[slot];
+      const auto idx = entry - bulk.fFirstEntry;
+      if (idx < 0 || idx >= bulk.fSize) {
+         Update(slot, entry);
+         return GetValuePtr(slot);
+      }
+      if (!bulk.fIsComputed[idx]) {
+         RDFInternal::RProfileScope profile(fProfiler, slot, fProfilerNode);
+         UpdateHelper(bulk.fValues[idx], slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         bulk.fIsComputed[idx] = true;
+      }
+      return static_cast<void *>(&bulk.fValues[idx]);
+   }
+
+   void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t size) final
+   {
+      auto &bulk = fBulkValues[slot];
+      if (bulk.fValues.size() < size)
+         bulk.fValues.resize(size);
+      bulk.fIsComputed.assign(size, false);
+      bulk.fFirstEntry = firstEntry;
+      bulk.fSize = size;
+   }
+
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
@@ -139,6 +186,7 @@ public:
    void FinalizeSlot(unsigned int slot) final
    {
       fValues[slot].fill(nullptr);
+      fBulkValues[slot].fSize = 0;
 
       for (auto &e : fVariedDefines)
          e.second->FinalizeSlot(slot);
@@ -17,6 +17,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
 
+#include <cstddef> // std::size_t
 #include <deque>
 #include <map>
 #include <memory>
@@ -29,6 +30,11 @@ namespace ROOT {
 namespace RDF {
 class RDataSource;
 }
+namespace Internal {
+namespace RDF {
+class RGraphProfiler;
+}
+} // namespace Internal
 namespace Detail {
 namespace RDF {
 
@@ -48,6 +54,9 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   std::string fFingerprint;                ///< Description of the define, see GetFingerprint().
+   RDFInternal::RGraphProfiler *fProfiler = nullptr; ///< Times the evaluations of this define, if not null
+   unsigned int fProfilerNode = 0;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -62,8 +71,19 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Update the value for the given entry and return its address. In bulk processing mode the values of all the
+   /// entries of the current range are kept, see SetBulkRange.
+   virtual void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry)
+   {
+      Update(slot, entry);
+      return GetValuePtr(slot);
+   }
+   /// Start a new range of entries in bulk processing mode. The entries of the range can be requested in any order,
+   /// e.g. first by all filters and then by all actions, and the value of each entry is computed at most once.
+   virtual void SetBulkRange(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*size*/) {}
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
@@ -71,6 +91,14 @@ public:
 
    const std::vector<std::string> &GetVariations() const { return fVariationDeps; }
 
+   /// A description of the values of this define that is the same from one process to the next, see
+   /// RNodeBase::GetFingerprint(). Empty if the define cannot be described, e.g. because it calls compiled code.
+   const std::string &GetFingerprint() const { return fFingerprint; }
+   void SetFingerprint(const std::string &fingerprint) { fFingerprint = fingerprint; }
+
+   /// Time the evaluations of this define in the following event loop, if profiler is not null
+   void SetProfiler(RDFInternal::RGraphProfiler *profiler);
+
    /// Create clones of this Define that work with values in varied "universes".
    virtual void MakeVariations(const std::vector<std::string> &variations) = 0;
 
@@ -0,0 +1,213 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RDEFINEBATCH
+#define ROOT_RDF_RDEFINEBATCH
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef> // std::size_t
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility> // std::index_sequence
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The value types of the batches of input values `const RVec<T1> &, const RVec<T2> &...` of a DefineBatch expression
+template <typename... BatchTypes>
+ROOT::TypeTraits::TypeList<typename std::decay_t<BatchTypes>::value_type...>
+BatchValueTypes(ROOT::TypeTraits::TypeList<BatchTypes...>);
+
+/// The batch buffers that hold the values of the input columns of a DefineBatch
+template <typename... ColTypes>
+std::tuple<ROOT::RVec<ColTypes>...> BatchInputs(ROOT::TypeTraits::TypeList<ColTypes...>);
+
+} // namespace RDF
+} // namespace Internal
+
+namespace Detail {
+namespace RDF {
+
+/// A defined column whose values are computed by batches of entries, see RInterface::DefineBatch().
+/// The expression has signature `void(unsigned int slot, RVec<R> &out, const RVec<T1> &in1, const RVec<T2> &in2...)`.
+template <typename F>
+class R__CLING_PTRCHECK(off) RDefineBatch final : public RDefineBase {
+   using FunParamTypes_t = typename ROOT::TypeTraits::CallableTraits<F>::arg_types;
+   using BatchParamTypes_t = ROOT::TypeTraits::RemoveFirstParameter_t<FunParamTypes_t>;
+
+public:
+   using Output_t = std::decay_t<ROOT::TypeTraits::TakeFirstParameter_t<BatchParamTypes_t>>;
+   using ret_type = typename Output_t::value_type;
+   using ColumnTypes_t =
+      decltype(RDFInternal::BatchValueTypes(ROOT::TypeTraits::RemoveFirstParameter_t<BatchParamTypes_t>{}));
+
+private:
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using Inputs_t = decltype(RDFInternal::BatchInputs(ColumnTypes_t{}));
+
+   static_assert(std::is_same<Output_t, ROOT::RVec<ret_type>>::value,
+                 "The second parameter of a DefineBatch expression must be the RVec of the output values.");
+
+   F fExpression;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
+
+   /// The entry range of the current batch of a slot, with its input and output values
+   struct RBatch {
+      Inputs_t fInputs;
+      Output_t fOutputs;
+      Long64_t fFirstEntry{-1};
+      Long64_t fSize{0};
+      std::size_t fLastIndex{0}; ///< The index in the batch of the last entry requested, see GetValuePtr()
+      bool fIsComputed{false};
+   };
+   std::vector<RBatch> fBatches; ///< One per slot
+
+   /// Define objects corresponding to systematic variations other than nominal for this defined column.
+   /// The map key is the full variation name, e.g. "pt:up".
+   std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
+
+   template <typename T>
+   static void FillInput(ROOT::RVec<T> &input, RColumnReaderBase &reader, const RBatch &batch)
+   {
+      input.resize(batch.fSize);
+      for (Long64_t i = 0; i < batch.fSize; ++i)
+         input[i] = reader.template Get<T>(batch.fFirstEntry + i);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void ComputeBatch(unsigned int slot, ROOT::TypeTraits::TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      RDFInternal::RProfileScope profile(fProfiler, slot, fProfilerNode);
+      auto &batch = fBatches[slot];
+      using expander = int[];
+      (void)expander{0, (FillInput<ColTypes>(std::get<S>(batch.fInputs), *fValues[slot][S], batch), 0)...};
+      batch.fOutputs.resize(batch.fSize);
+      fExpression(slot, batch.fOutputs, std::get<S>(batch.fInputs)...);
+      if (static_cast<Long64_t>(batch.fOutputs.size()) != batch.fSize)
+         throw std::runtime_error("DefineBatch: the expression of column \"" + fName +
+                                  "\" changed the size of the batch of output values.");
+      batch.fIsComputed = true;
+   }
+
+public:
+   RDefineBatch(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
+                const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
+                const std::string &variationName = "nominal")
+      : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
+        fValues(lm.GetNSlots()), fBatches(lm.GetNSlots())
+   {
+      fLoopManager->Register(this);
+   }
+
+   RDefineBatch(const RDefineBatch &) = delete;
+   RDefineBatch &operator=(const RDefineBatch &) = delete;
+   ~RDefineBatch() { fLoopManager->Deregister(this); }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
+      fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
+      fBatches[slot].fFirstEntry = -1;
+      fBatches[slot].fSize = 0;
+   }
+
+   /// Return the (type-erased) address of the value of the last entry requested in the given processing slot.
+   void *GetValuePtr(unsigned int slot) final
+   {
+      auto &batch = fBatches[slot];
+      return static_cast<void *>(&batch.fOutputs[batch.fLastIndex]);
+   }
+
+   void Update(unsigned int slot, Long64_t entry) final { UpdateAndGetValuePtr(slot, entry); }
+
+   /// Return the address of the value of the given entry, computing the values of its whole batch if needed.
+   /// Outside of bulk processing mode, each batch contains a single entry.
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry) final
+   {
+      auto &batch = fBatches[slot];
+      if (entry < batch.fFirstEntry || entry >= batch.fFirstEntry + batch.fSize)
+         SetBulkRange(slot, entry, 1);
+      if (!batch.fIsComputed)
+         ComputeBatch(slot, ColumnTypes_t{}, TypeInd_t{});
+      batch.fLastIndex = entry - batch.fFirstEntry;
+      return static_cast<void *>(&batch.fOutputs[batch.fLastIndex]);
+   }
+
+   void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t size) final
+   {
+      auto &batch = fBatches[slot];
+      batch.fFirstEntry = firstEntry;
+      batch.fSize = size;
+      batch.fIsComputed = false;
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(ret_type); }
+
+   /// Clean-up operations to be performed at the end of a task.
+   void FinalizeSlot(unsigned int slot) final
+   {
+      fValues[slot].fill(nullptr);
+      fBatches[slot].fFirstEntry = -1;
+      fBatches[slot].fSize = 0;
+
+      for (auto &e : fVariedDefines)
+         e.second->FinalizeSlot(slot);
+   }
+
+   /// Create clones of this Define that work with values in varied "universes".
+   void MakeVariations(const std::vector<std::string> &variations) final
+   {
+      for (const auto &variation : variations) {
+         if (std::find(fVariationDeps.begin(), fVariationDeps.end(), variation) == fVariationDeps.end())
+            continue; // this Defined quantity does not depend on this variation
+         if (fVariedDefines.find(variation) != fVariedDefines.end())
+            continue; // we already have this variation stored
+
+         // the varied defines get a copy of the callable object
+         fVariedDefines[variation] = std::unique_ptr<RDefineBase>(
+            new RDefineBatch(fName, fType, fExpression, fColumnNames, fColRegister, *fLoopManager, variation));
+      }
+   }
+
+   /// Return a clone of this Define that works with values in the variationName "universe".
+   RDefineBase &GetVariedDefine(const std::string &variationName) final
+   {
+      auto it = fVariedDefines.find(variationName);
+      if (it == fVariedDefines.end())
+         return *this; // we do not depend on this variation
+      return *(it->second);
+   }
+};
+
+} // namespace RDF
+} // namespace Detail
+} // namespace ROOT
+
+#endif // ROOT_RDF_RDEFINEBATCH
@@ -16,6 +16,7 @@
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
@@ -68,6 +69,8 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
    const std::shared_ptr<PrevNode_t> fPrevNodePtr;
    PrevNode_t &fPrevNode;
+   /// Results of this filter per slot for the current range of entries, in bulk processing mode
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
 
 public:
    RFilter(FilterF f, const ROOT::RDF::ColumnNames_t &columns, std::shared_ptr<PrevNode_t> pd,
@@ -76,7 +79,7 @@ public:
       : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), colRegister,
                     columns, pd->GetVariations(), variationName),
         fFilter(std::move(f)), fValues(pd->GetLoopManagerUnchecked()->GetNSlots()), fPrevNodePtr(std::move(pd)),
-        fPrevNode(*fPrevNodePtr)
+        fPrevNode(*fPrevNodePtr), fBulkMasks(fLoopManager->GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -92,7 +95,10 @@ public:
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
-         if (!fPrevNode.CheckFilters(slot, entry)) {
+         if (!fChain.empty()) {
+            // adaptive mode: evaluate the chain of unnamed filters that ends here in the most efficient order
+            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = CheckFilterChain(slot, entry);
+         } else if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
@@ -107,9 +113,41 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   /// Evaluate this filter for all the entries of the range that passed the upstream filters. The results are
+   /// cached, such that the actions and filters that share this node evaluate it only once per range.
+   void CheckFiltersBulk(unsigned int slot, RDFInternal::RMaskedEntryRange &mask) final
+   {
+      auto &bulkMask = fBulkMasks[slot];
+      if (!bulkMask.HasSameRange(mask)) {
+         bulkMask.Reset(mask.GetFirstEntry(), mask.Size());
+         fPrevNode.CheckFiltersBulk(slot, bulkMask);
+         const auto firstEntry = bulkMask.GetFirstEntry();
+         ULong64_t nChecked = 0;
+         ULong64_t nAccepted = 0;
+         for (std::size_t i = 0; i < bulkMask.Size(); ++i) {
+            if (!bulkMask[i])
+               continue;
+            bulkMask[i] = CheckFilterHelper(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+            ++nChecked;
+            nAccepted += bulkMask[i];
+         }
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nChecked - nAccepted;
+      }
+      mask = bulkMask;
+   }
+
+   bool EvalFilter(unsigned int slot, Long64_t entry) final
+   {
+      return CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+   }
+
+   RNodeBase *GetPrevNode() final { return &fPrevNode; }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
+      RDFInternal::RProfileScope profile(fProfiler, slot, fProfilerNode);
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
       // avoid unused parameter warnings (gcc 12.1)
       (void)slot;
@@ -121,6 +159,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkMasks[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
@@ -160,6 +199,13 @@ public:
       filters.push_back(name);
    }
 
+   bool HasUpstreamFilters() final
+   {
+      std::vector<std::string> filters;
+      fPrevNode.AddFilterName(filters);
+      return !filters.empty();
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final { fValues[slot].fill(nullptr); }
 
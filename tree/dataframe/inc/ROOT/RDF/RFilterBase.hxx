@@ -18,6 +18,7 @@
 #include "RtypesCore.h"
 
 #include <cassert>
+#include <cstddef> // std::size_t
 #include <string>
 #include <vector>
 
@@ -29,6 +30,12 @@ namespace RDF {
 class RCutFlowReport;
 } // ns RDF
 
+namespace Internal {
+namespace RDF {
+class RGraphProfiler;
+} // ns RDF
+} // ns Internal
+
 namespace Detail {
 namespace RDF {
 namespace RDFInternal = ROOT::Internal::RDF;
@@ -49,6 +56,24 @@ protected:
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
 
+   /// Per-slot measurements used to order the filters of a chain, see CheckFilterChain()
+   struct RChainStats {
+      std::vector<std::size_t> fOrder;   ///< Order of evaluation of the filters of the chain
+      std::vector<double> fCost;         ///< Time spent evaluating each filter while learning, in seconds
+      std::vector<ULong64_t> fNRejected; ///< Entries rejected by each filter while learning
+      ULong64_t fNLearned = 0;           ///< Entries processed while learning
+   };
+   /// This filter and the unnamed filters directly upstream of it, if the loop manager reorders the filters and there
+   /// are at least two of them; empty otherwise
+   std::vector<RFilterBase *> fChain;
+   /// The node upstream of the chain of filters, checked before them
+   RNodeBase *fChainUpstream = nullptr;
+   std::vector<RChainStats> fChainStats;
+   RDFInternal::RGraphProfiler *fProfiler = nullptr; ///< Times the evaluations of this filter, if not null
+   unsigned int fProfilerNode = 0;
+
+   bool CheckFilterChain(unsigned int slot, Long64_t entry);
+
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
                const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns,
@@ -58,8 +83,15 @@ public:
    ~RFilterBase() override;
 
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Evaluate the expression of this filter alone, without checking the upstream filters or caching the result.
+   virtual bool EvalFilter(unsigned int slot, Long64_t entry) = 0;
+   virtual RNodeBase *GetPrevNode() = 0;
    bool HasName() const;
    std::string GetName() const;
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   /// Whether the entries reaching this filter already passed other filters. Overridden by RFilter.
+   virtual bool HasUpstreamFilters() { return false; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -72,6 +104,8 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   /// Time the evaluations of this filter in the following event loop, if profiler is not null
+   void SetProfiler(RDFInternal::RGraphProfiler *profiler);
 };
 
 } // ns RDF
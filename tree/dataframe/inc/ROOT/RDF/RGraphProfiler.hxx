@@ -0,0 +1,167 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RGRAPHPROFILER
+#define ROOT_RDF_RGRAPHPROFILER
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include <RtypesCore.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RGraphProfiler
+\ingroup dataframe
+\brief Measures the time spent in each node of a computation graph during an event loop.
+
+The Filters, Defines, Variations and actions, the dataset column readers and the loading of the entries are timed
+with an RProfileScope while they are evaluated, see RInterfaceBase::SetProfiling. As the values of the Defines are
+computed when they are read, the evaluations are nested: each slot records the tree of the paths through which
+the nodes were evaluated, e.g. a Define computed because a Filter read it while an action was run. The self time of
+a node in a path excludes the time of the nodes evaluated from it, such that the reading of the columns is accounted
+for separately.
+
+Each slot records its own tree, so that profiling does not contend between threads. The overhead of profiling is
+about two reads of the clock per evaluation of a node.
+**/
+class RGraphProfiler {
+public:
+   /// The node that times the loading of the entries by the TTreeReader or the data source
+   static constexpr unsigned int kEntryLoadNode = 0;
+
+   /// Time spent in a node during the event loop, summed over the paths through which it was evaluated
+   struct RNodeProfile {
+      std::string fLabel;
+      std::vector<ULong64_t> fNCalls;    ///< Number of evaluations, per slot
+      std::vector<ULong64_t> fSelfTime;  ///< Time spent in the node itself, in nanoseconds, per slot
+      std::vector<ULong64_t> fTotalTime; ///< Time spent in the node and the nodes it evaluated, in ns, per slot
+   };
+
+private:
+   using Clock_t = std::chrono::steady_clock;
+
+   /// A node evaluated through a given path, in the tree of a slot
+   struct RFrame {
+      unsigned int fNode;
+      std::vector<std::size_t> fChildren;
+      ULong64_t fNCalls = 0;
+      ULong64_t fSelfTime = 0;
+      ULong64_t fTotalTime = 0;
+
+      explicit RFrame(unsigned int node) : fNode(node) {}
+   };
+
+   /// A frame being evaluated
+   struct RActiveFrame {
+      std::size_t fFrame;
+      Clock_t::time_point fStart;
+      ULong64_t fCalleeTime; ///< Time spent in the frames evaluated from this one so far
+   };
+
+   struct RSlotProfile {
+      std::vector<RFrame> fFrames; ///< fFrames[0] is the event loop, the root of the tree
+      std::vector<RActiveFrame> fStack;
+   };
+
+   std::vector<std::string> fLabels;
+   /// The nodes of the column readers, which are registered by each task
+   std::unordered_map<std::string, unsigned int> fColumnReadNodes;
+   std::mutex fMutex; ///< Protects the registration of nodes
+   /// One per slot, allocated separately to avoid false sharing between the slots
+   std::vector<std::unique_ptr<RSlotProfile>> fSlots;
+   bool fIsEnabled = false;
+
+   void AddStacks(const RSlotProfile &slot, std::size_t frame, const std::string &stack,
+                  std::unordered_map<std::string, ULong64_t> &stacks) const;
+
+public:
+   explicit RGraphProfiler(unsigned int nSlots);
+
+   /// Whether the following event loops are profiled
+   bool IsEnabled() const { return fIsEnabled; }
+   void SetEnabled(bool enable) { fIsEnabled = enable; }
+   /// Forget the nodes and the measurements of the previous event loop
+   void Reset();
+
+   unsigned int RegisterNode(const std::string &label);
+   /// Return the node of the reader of the given dataset column, registering it on first use. Thread-safe.
+   unsigned int RegisterColumnRead(const std::string &column);
+   /// Return label followed by the list of columns in parentheses, and by the variation unless it is nominal
+   static std::string MakeLabel(const std::string &label, const std::vector<std::string> &columns,
+                                const std::string &variation = "nominal");
+
+   void Enter(unsigned int slot, unsigned int node);
+   void Exit(unsigned int slot);
+
+   /// Return the profile of the nodes that were evaluated, from the one with the largest self time to the smallest
+   std::vector<RNodeProfile> GetNodeProfiles() const;
+   /// Return a table with the number of evaluations, the self and total time and the throughput of each node
+   std::string GetReport() const;
+   /// Return the self time of each path of nodes in nanoseconds, summed over the slots, in the "collapsed stacks"
+   /// format of flame graph tools, e.g. `RDataFrame;Sum(x);Define x(y);Read y 1234`
+   std::string GetStacks() const;
+};
+
+/// Time a node of the graph in a slot for the lifetime of this object, if profiler is not null
+class RProfileScope {
+   RGraphProfiler *fProfiler;
+   unsigned int fSlot;
+
+public:
+   RProfileScope(RGraphProfiler *profiler, unsigned int slot, unsigned int node) : fProfiler(profiler), fSlot(slot)
+   {
+      if (fProfiler != nullptr)
+         fProfiler->Enter(slot, node);
+   }
+   RProfileScope(const RProfileScope &) = delete;
+   RProfileScope &operator=(const RProfileScope &) = delete;
+   ~RProfileScope()
+   {
+      if (fProfiler != nullptr)
+         fProfiler->Exit(fSlot);
+   }
+};
+
+/// Decorates a dataset column reader to time its reads, which are measured while the profiler is enabled
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   RGraphProfiler &fProfiler;
+   const unsigned int fSlot;
+   unsigned int fNode;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      RProfileScope scope(fProfiler.IsEnabled() ? &fProfiler : nullptr, fSlot, fNode);
+      return &fReader->Get<char>(entry);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, RGraphProfiler &profiler,
+                         unsigned int slot, unsigned int node)
+      : fReader(std::move(reader)), fProfiler(profiler), fSlot(slot), fNode(node)
+   {
+   }
+
+   /// Set the node of the reader, after the nodes of the profiler were reset
+   void SetNode(unsigned int node) { fNode = node; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RGRAPHPROFILER
@@ -17,6 +17,7 @@
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RDefine.hxx"
+#include "ROOT/RDF/RDefineBatch.hxx"
 #include "ROOT/RDF/RDefinePerSample.hxx"
 #include "ROOT/RDF/RFilter.hxx"
 #include "ROOT/RDF/RInterfaceBase.hxx"
@@ -392,6 +393,67 @@ public:
    }
    // clang-format on
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Define a new column whose values are computed by batches of entries.
+   /// \param[in] name The name of the defined column.
+   /// \param[in] expression Callable object that computes the values of a batch of entries from the values of the input columns for these entries.
+   /// \param[in] columns Names of the columns/branches in input to the expression.
+   /// \return the first node of the computation graph for which the new quantity is defined.
+   ///
+   /// The expression must be a callable of signature `void(unsigned int slot, RVec<R> &out, const RVec<T1> &in1, const RVec<T2> &in2, ...)`
+   /// where `T1, T2...` are the types of the input columns and `R` the type of the defined column. For each batch of
+   /// entries, `in1, in2...` hold the values of the input columns for all the entries of the batch, and the expression
+   /// must fill `out`, which already has the size of the batch, with the value of the defined column for each entry.
+   /// The batches are contiguous in memory and can thus be handed as a whole to a vectorized library or copied to an
+   /// accelerator, e.g. to run a CUDA kernel; as in DefineSlot(), the slot number can be used to select per-thread
+   /// resources such as device buffers or streams.
+   ///
+   /// The batches are the ranges of entries of bulk processing mode, see RInterfaceBase::SetBulkSize(), and, as in
+   /// that mode, the expression is evaluated for all the entries of a batch, including the ones that do not pass the
+   /// filters upstream of the defined column. Outside of bulk processing mode, each batch contains one entry.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df(1000000);
+   /// df.SetBulkSize(4096);
+   /// auto pt2 = df.Define("pt", [] { return gRandom->Exp(10.); })
+   ///              .DefineBatch("pt2", [](unsigned int, ROOT::RVecD &out, const ROOT::RVecD &pt) { out = pt * pt; },
+   ///                           {"pt"});
+   /// ~~~
+   ///
+   /// See Define() for more information.
+   template <typename F>
+   RInterface<Proxied, DS_t> DefineBatch(std::string_view name, F expression, const ColumnNames_t &columns = {})
+   {
+      RDFInternal::CheckValidCppVarName(name, "DefineBatch");
+      RDFInternal::CheckForRedefinition("DefineBatch", name, fColRegister, fLoopManager->GetBranchNames(),
+                                        fDataSource ? fDataSource->GetColumnNames() : ColumnNames_t{});
+
+      using NewCol_t = RDFDetail::RDefineBatch<F>;
+      using ColTypes_t = typename NewCol_t::ColumnTypes_t;
+      using RetType = typename NewCol_t::ret_type;
+
+      const auto validColumnNames = GetValidatedColumnNames(ColTypes_t::list_size, columns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      // Declare return type to the interpreter, for future use by jitted actions
+      auto retTypeName = RDFInternal::TypeID2TypeName(typeid(RetType));
+      if (retTypeName.empty())
+         retTypeName = "CLING_UNKNOWN_TYPE_" + RDFInternal::DemangleTypeIdName(typeid(RetType));
+
+      auto newColumn = std::make_shared<NewCol_t>(name, retTypeName, std::move(expression), validColumnNames,
+                                                  fColRegister, *fLoopManager);
+
+      RDFInternal::RColumnRegister newCols(fColRegister);
+      newCols.AddDefine(std::move(newColumn));
+
+      RInterface<Proxied> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols));
+
+      return newInterface;
+   }
+   // clang-format on
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Define a new column.
    /// \param[in] name The name of the defined column.
@@ -932,6 +994,19 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// ### Writing an RNTuple
+   ///
+   /// With `RSnapshotOptions::fOutputFormat` set to `ESnapshotOutputFormat::kRNTuple`, the columns are written as the
+   /// fields of an RNTuple called `treename`. In multi-thread runs, each slot fills its own clusters, which are
+   /// committed to the output file as they are complete: no merging step is needed. The mode must be "RECREATE" and
+   /// the RNTuple cannot be written in a sub-directory. The returned dataframe reads the RNTuple; with lazy snapshots,
+   /// it must not be used before the event loop has run.
+   /// ~~~{.cpp}
+   /// RSnapshotOptions opts;
+   /// opts.fOutputFormat = ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("ntuple", "outputFile.root", {"x"}, opts);
+   /// ~~~
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -979,7 +1054,7 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, colListNoAliasesWithSizeBranches, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1207,6 +1282,10 @@ public:
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
+      const auto upstream = fProxiedPtr->GetFingerprint();
+      if (!upstream.empty())
+         rangePtr->SetFingerprint(upstream + "\nRange " + std::to_string(begin) + ' ' + std::to_string(end) + ' ' +
+                                  std::to_string(stride));
       RInterface<RDFDetail::RRange<Proxied>, DS_t> newInterface(std::move(rangePtr), *fLoopManager, fColRegister);
       return newInterface;
    }
@@ -1363,8 +1442,9 @@ public:
       auto cSPtr = std::make_shared<ULong64_t>(0);
       using Helper_t = RDFInternal::CountHelper;
       using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
-      auto action = std::make_unique<Action_t>(Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr,
-                                               RDFInternal::RColumnRegister(fColRegister));
+      std::shared_ptr<RDFInternal::RActionBase> action = std::make_unique<Action_t>(
+         Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr, RDFInternal::RColumnRegister(fColRegister));
+      RegisterCachedResult(ColumnNames_t{}, cSPtr, *fProxiedPtr, action, "Count", std::true_type{});
       return MakeResultPtr(cSPtr, *fLoopManager, std::move(action));
    }
 
@@ -2772,6 +2852,17 @@ private:
       return *this; // never reached
    }
 
+   /// Create the dataframe returned by Snapshot. For RNTuple output, it is a placeholder until the RNTuple is written.
+   static std::shared_ptr<ROOT::RDataFrame>
+   MakeSnapshotOutputDF(std::string_view fullTreeName, std::string_view filename, const ColumnNames_t &columns,
+                        RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat != ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+         return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, columns);
+      snapHelperArgs.fOutputDF = std::make_shared<ROOT::RDataFrame>(0);
+      return snapHelperArgs.fOutputDF;
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -2791,7 +2882,7 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, validCols, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs,
                                                                                     fProxiedPtr);
@@ -20,6 +20,7 @@
 #include <ROOT/RStringView.hxx>
 #include <TError.h> // R__ASSERT
 
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -138,6 +139,35 @@ protected:
          RDFInternal::AddDSColumns(validCols, *fLoopManager, *fDataSource, typeList, fColRegister);
    }
 
+   /// Register the result of an action with the result cache, if one is set and the action can be cached
+   template <typename ActionTag, typename ActionResultType>
+   void RegisterCachedResult(const ColumnNames_t &columns, const std::shared_ptr<ActionResultType> &r,
+                             const RDFDetail::RNodeBase &prevNode,
+                             const std::shared_ptr<RDFInternal::RActionBase> &action)
+   {
+      RegisterCachedResult(columns, r, prevNode, action, typeid(ActionTag).name(),
+                           RDFInternal::RIsCacheableAction<ActionTag>{});
+   }
+
+   template <typename ActionResultType>
+   void RegisterCachedResult(const ColumnNames_t &columns, const std::shared_ptr<ActionResultType> &r,
+                             const RDFDetail::RNodeBase &prevNode,
+                             const std::shared_ptr<RDFInternal::RActionBase> &action, const std::string &actionName,
+                             std::true_type /*isCacheable*/)
+   {
+      if (fLoopManager->GetResultCache().empty())
+         return;
+      const auto fingerprint = RDFInternal::MakeActionFingerprint(actionName, columns, prevNode, fColRegister);
+      RDFInternal::RegisterCachedResult(*fLoopManager, fingerprint, r, action);
+   }
+
+   template <typename ActionResultType>
+   void RegisterCachedResult(const ColumnNames_t &, const std::shared_ptr<ActionResultType> &,
+                             const RDFDetail::RNodeBase &, const std::shared_ptr<RDFInternal::RActionBase> &,
+                             const std::string &, std::false_type /*isCacheable*/)
+   {
+   }
+
    /// Create RAction object, return RResultPtr for the action
    /// Overload for the case in which all column types were specified (no jitting).
    /// For most actions, `r` and `helperArg` will refer to the same object, because the only argument to forward to
@@ -157,8 +187,9 @@ protected:
 
       const auto nSlots = fLoopManager->GetNSlots();
 
-      auto action = RDFInternal::BuildAction<ColTypes...>(validColumnNames, helperArg, nSlots, proxiedPtr, ActionTag{},
-                                                          fColRegister);
+      std::shared_ptr<RDFInternal::RActionBase> action = RDFInternal::BuildAction<ColTypes...>(
+         validColumnNames, helperArg, nSlots, proxiedPtr, ActionTag{}, fColRegister);
+      RegisterCachedResult<ActionTag>(validColumnNames, r, *proxiedPtr, action);
       return MakeResultPtr(r, *fLoopManager, std::move(action));
    }
 
@@ -191,6 +222,7 @@ protected:
          RDFInternal::JitBuildAction(validColumnNames, upcastNodeOnHeap, typeid(HelperArgType), typeid(ActionTag),
                                      helperArgOnHeap, tree, nSlots, fColRegister, fDataSource, jittedActionOnHeap);
       fLoopManager->ToJitExec(toJit);
+      RegisterCachedResult<ActionTag>(validColumnNames, r, *proxiedPtr, jittedAction);
       return MakeResultPtr(r, *fLoopManager, std::move(jittedAction));
    }
 
@@ -209,6 +241,15 @@ public:
    ColumnNames_t GetDefinedColumnNames();
    unsigned int GetNSlots() const;
    unsigned int GetNRuns() const;
+   void SetBulkSize(unsigned int bulkSize);
+   void SetRVecArenas(bool use = true);
+   void SetFilterReordering(bool reorder = true);
+   void SetResultCache(std::string_view fileName);
+   void SetProfiling(bool profile = true);
+   std::string GetProfileReport() const;
+   std::string GetProfileStacks() const;
+   void SetMemoryLimit(std::uint64_t bytes);
+   std::string GetMemoryReport() const;
 };
 } // namespace RDF
 } // namespace ROOT
@@ -47,6 +47,9 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   bool EvalFilter(unsigned int slot, Long64_t entry) final;
+   RNodeBase *GetPrevNode() final;
+   void CheckFiltersBulk(unsigned int slot, ROOT::Internal::RDF::RMaskedEntryRange &mask) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -44,6 +44,8 @@ public:
    void *GetValuePtr(unsigned int slot, const std::string &column, const std::string &variation) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
+   void *UpdateAndGetValuePtr(unsigned int slot, std::size_t colIdx, std::size_t varIdx, Long64_t entry) final;
+   void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t size) final;
    void FinalizeSlot(unsigned int slot) final;
 };
 
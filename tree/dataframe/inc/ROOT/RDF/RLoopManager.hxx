@@ -14,10 +14,16 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
+#include "ROOT/RVec.hxx" // RVecArena
 
+#include <cstddef> // std::size_t
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <map>
@@ -101,6 +107,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedFilter;
+class RJittedDefine;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -140,10 +148,35 @@ class RLoopManager : public RNodeBase {
    RDFInternal::RNewSampleNotifier fNewSampleNotifier;
    std::vector<ROOT::RDF::RSampleInfo> fSampleInfos;
    unsigned int fNRuns{0}; ///< Number of event loops run
+   unsigned int fBulkSize{1};   ///< Number of entries processed together in bulk processing mode, see SetBulkSize()
+   bool fRunBulk{false};        ///< Whether the current event loop runs in bulk processing mode
+   bool fReorderFilters{false}; ///< Whether chains of unnamed filters are reordered, see SetFilterReordering()
+   /// Scratch masks (one per slot) passed to the actions and named filters in bulk processing mode
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
+   /// Arenas (one per slot, empty if disabled) for the RVec temporaries of the Define expressions, see SetRVecArenas()
+   std::vector<std::unique_ptr<ROOT::Internal::VecOps::RVecArena>> fRVecArenas;
+   /// Times the nodes of the graph in the profiled event loops, see SetProfiling(). Keeps the measurements of the last
+   /// profiled event loop until the next one starts.
+   std::unique_ptr<RDFInternal::RGraphProfiler> fProfiler;
 
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// Unnamed jitted Filters and jitted Defines booked so far, keyed by their upstream node, expression and input
+   /// columns, so that identical operations booked in several branches of the graph share a single node.
+   /// See RDFInternal::BookFilterJit and RDFInternal::BookDefineJit.
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fSharedJittedFilters;
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fSharedJittedDefines;
+
+   /// Name of the file that stores the results of the actions across processes, see SetResultCache()
+   std::string fResultCacheFileName;
+   /// Results booked since the last event loop that can be read from or stored in the result cache
+   std::vector<RDFInternal::RCachedResult> fCachedResults;
+   /// Limit of the memory tracked by the RMemoryBudget during the event loops, 0 for none. See SetMemoryLimit()
+   std::uint64_t fMemoryLimit = 0;
+   /// The memory tracked by the RMemoryBudget during the last event loop, see GetMemoryReport()
+   std::string fMemoryReport;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
@@ -156,14 +189,27 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t size);
+   void RunSampleCallbacks(unsigned int slot);
+   bool CanRunBulk() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
+   void InitProfiler();
+   /// The profiler of the current event loop, nullptr if it is not profiled
+   RDFInternal::RGraphProfiler *GetActiveProfiler() const
+   {
+      return fProfiler && fProfiler->IsEnabled() ? fProfiler.get() : nullptr;
+   }
+   void SetDataSourceFilteredColumns();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
+   std::string GetDatasetFingerprint() const;
+   bool LoadCachedResults(const std::string &datasetFingerprint);
+   void StoreCachedResults(const std::string &datasetFingerprint);
 
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
@@ -175,6 +221,7 @@ public:
 
    void JitDeclarations();
    void Jit();
+   void JitOwnCode();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run(bool jit = true);
    const ColumnNames_t &GetDefaultColumnNames() const;
@@ -193,6 +240,7 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   void CheckFiltersBulk(unsigned int, RDFInternal::RMaskedEntryRange &mask) final;
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -203,6 +251,30 @@ public:
    void ToJitExec(const std::string &) const;
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void SetBulkSize(unsigned int bulkSize);
+   unsigned int GetBulkSize() const { return fBulkSize; }
+   void SetRVecArenas(bool use);
+   /// The arena of the RVec temporaries of the Define expressions in this slot, nullptr if they use the heap
+   ROOT::Internal::VecOps::RVecArena *GetRVecArena(unsigned int slot) const
+   {
+      return fRVecArenas.empty() ? nullptr : fRVecArenas[slot].get();
+   }
+   void SetFilterReordering(bool reorder) { fReorderFilters = reorder; }
+   bool GetFilterReordering() const { return fReorderFilters; }
+   void SetResultCache(const std::string &fileName) { fResultCacheFileName = fileName; }
+   const std::string &GetResultCache() const { return fResultCacheFileName; }
+   void SetProfiling(bool profile);
+   void SetMemoryLimit(std::uint64_t bytes) { fMemoryLimit = bytes; }
+   std::uint64_t GetMemoryLimit() const { return fMemoryLimit; }
+   /// The memory report of the last event loop, empty if no event loop was run
+   const std::string &GetMemoryReport() const { return fMemoryReport; }
+   /// The measurements of the last profiled event loop, nullptr if no event loop was profiled
+   const RDFInternal::RGraphProfiler *GetProfiler() const { return fProfiler.get(); }
+   void RegisterCachedResult(RDFInternal::RCachedResult &&result) { fCachedResults.emplace_back(std::move(result)); }
+   /// The head of every computation graph is described in the same way, the dataset is part of the cache key
+   std::string GetFingerprint() const final { return "RDataFrame"; }
+   std::weak_ptr<RJittedFilter> &GetSharedJittedFilter(const std::string &key) { return fSharedJittedFilters[key]; }
+   std::weak_ptr<RJittedDefine> &GetSharedJittedDefine(const std::string &key) { return fSharedJittedDefines[key]; }
    bool HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const;
    void AddDataSourceColumnReaders(const std::string &col, std::vector<std::unique_ptr<RColumnReaderBase>> &&readers,
                                    const std::type_info &ti);
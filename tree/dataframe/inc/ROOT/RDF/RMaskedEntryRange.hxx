@@ -0,0 +1,57 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include <RtypesCore.h>
+
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// A range of consecutive entries together with a mask that flags the entries that passed the filters.
+/// Used by the bulk processing mode of the event loop, see RLoopManager::SetBulkSize.
+class RMaskedEntryRange {
+   std::vector<char> fMask; ///< One flag per entry; the capacity is reused by the following ranges
+   Long64_t fFirstEntry{-1};
+   std::size_t fSize{0};
+
+public:
+   /// Set the range to size entries starting at firstEntry, all of them flagged as passing.
+   void Reset(Long64_t firstEntry, std::size_t size)
+   {
+      fFirstEntry = firstEntry;
+      fSize = size;
+      fMask.assign(size, 1);
+   }
+   /// Make the range empty, e.g. to drop the cached results of a filter at the beginning of a task.
+   void Invalidate()
+   {
+      fFirstEntry = -1;
+      fSize = 0;
+   }
+
+   Long64_t GetFirstEntry() const { return fFirstEntry; }
+   std::size_t Size() const { return fSize; }
+   char &operator[](std::size_t i) { return fMask[i]; }
+   char operator[](std::size_t i) const { return fMask[i]; }
+   bool HasSameRange(const RMaskedEntryRange &other) const
+   {
+      return fFirstEntry == other.fFirstEntry && fSize == other.fSize;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RMASKEDENTRYRANGE
@@ -11,6 +11,7 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
@@ -46,6 +47,7 @@ protected:
    unsigned int fNChildren{0};      ///< Number of nodes of the functional graph hanging from this object
    unsigned int fNStopsReceived{0}; ///< Number of times that a children node signaled to stop processing entries.
    std::vector<std::string> fVariations; ///< List of systematic variations that affect this node.
+   std::string fFingerprint;             ///< Description of the node and of its upstream graph, see GetFingerprint()
 
 public:
    RNodeBase(const std::vector<std::string> &variations = {}, RLoopManager *lm = nullptr)
@@ -54,6 +56,13 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Flag the entries of the range of mask that pass the filters up to this node. Used in bulk processing mode,
+   /// where the entries of a range are checked all together; this default implementation checks them one by one.
+   virtual void CheckFiltersBulk(unsigned int slot, ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      for (std::size_t i = 0; i < mask.Size(); ++i)
+         mask[i] = CheckFilters(slot, mask.GetFirstEntry() + i);
+   }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -73,6 +82,12 @@ public:
 
    const std::vector<std::string> &GetVariations() const { return fVariations; }
 
+   /// A description of this node and of its upstream graph that is the same from one process to the next. It
+   /// identifies the results stored in the cache set with RInterfaceBase::SetResultCache. Empty if the node cannot be
+   /// described, e.g. because it calls compiled code.
+   virtual std::string GetFingerprint() const { return fFingerprint; }
+   void SetFingerprint(const std::string &fingerprint) { fFingerprint = fingerprint; }
+
    /// Return a clone of this node that acts as a Filter working with values in the variationName "universe".
    virtual std::shared_ptr<RNodeBase> GetVariedFilter(const std::string & /*variationName*/)
    {
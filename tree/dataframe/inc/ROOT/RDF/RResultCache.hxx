@@ -0,0 +1,106 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTCACHE
+#define ROOT_RDF_RRESULTCACHE
+
+#include <RtypesCore.h>
+#include <TBufferFile.h>
+#include <TClass.h>
+#include <TDirectory.h>
+#include <TParameter.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+class RActionBase;
+
+/// A result booked while a result cache is set, see RInterfaceBase::SetResultCache.
+struct RCachedResult {
+   std::weak_ptr<RActionBase> fAction;
+   /// Describes the action, its input columns, its upstream graph and the initial state of its result
+   std::string fFingerprint;
+   /// Replace the result with the one stored in the directory with the given key; false if there is none
+   std::function<bool(TDirectory &, const std::string &)> fRead;
+   /// Store the result in the directory with the given key
+   std::function<void(TDirectory &, const std::string &)> fWrite;
+};
+
+/// How results of type T are stored in the result cache: types with a dictionary are stored as they are.
+template <typename T, bool IsArithmetic = std::is_arithmetic<T>::value>
+struct RResultCacheIO {
+   static TClass *GetClass() { return TClass::GetClass(typeid(T)); }
+
+   static bool CanCache()
+   {
+      auto *cl = GetClass();
+      return cl != nullptr && cl->HasDictionary();
+   }
+
+   /// The streamed initial state of the result, e.g. the axes of a histogram
+   static std::string GetState(const T &obj)
+   {
+      TBufferFile buf(TBuffer::kWrite);
+      buf.WriteObjectAny(&obj, GetClass());
+      return std::string(buf.Buffer(), buf.Length());
+   }
+
+   static void Write(const T &obj, TDirectory &dir, const std::string &key)
+   {
+      dir.WriteObjectAny(&obj, GetClass(), key.c_str(), "WriteDelete");
+   }
+
+   static bool Read(T &obj, TDirectory &dir, const std::string &key)
+   {
+      std::unique_ptr<T> cached(dir.Get<T>(key.c_str()));
+      if (!cached)
+         return false;
+      obj = *cached;
+      return true;
+   }
+};
+
+/// Arithmetic results are stored as TParameter<Long64_t> or TParameter<Double_t>.
+template <typename T>
+struct RResultCacheIO<T, true> {
+   using Stored_t = std::conditional_t<std::is_integral<T>::value, Long64_t, Double_t>;
+
+   static bool CanCache() { return true; }
+
+   static std::string GetState(const T &value)
+   {
+      return std::string(reinterpret_cast<const char *>(&value), sizeof(T));
+   }
+
+   static void Write(const T &value, TDirectory &dir, const std::string &key)
+   {
+      TParameter<Stored_t> param(key.c_str(), static_cast<Stored_t>(value));
+      dir.WriteTObject(&param, key.c_str(), "WriteDelete");
+   }
+
+   static bool Read(T &value, TDirectory &dir, const std::string &key)
+   {
+      std::unique_ptr<TParameter<Stored_t>> cached(dir.Get<TParameter<Stored_t>>(key.c_str()));
+      if (!cached)
+         return false;
+      value = static_cast<T>(cached->GetVal());
+      return true;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTCACHE
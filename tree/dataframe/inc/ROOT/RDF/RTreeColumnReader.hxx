@@ -14,12 +14,17 @@
 #include "RColumnReaderBase.hxx"
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+#include <TBranch.h>
+#include <TBufferFile.h>
+#include <TDataType.h>
+#include <TTree.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
 #include <memory>
 #include <string>
+#include <typeinfo>
 
 namespace ROOT {
 namespace Internal {
@@ -56,6 +61,70 @@ template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<TTreeReaderArray<T>> fTreeArray;
 
+   /// Variable-length collections of fundamental types are read in bulk, one basket at a time, bypassing fTreeArray.
+   /// The following members hold the state of the bulk read; fTreeArray is used if bulk reading is not possible.
+   TTreeReader &fTreeReader;
+   std::string fColName;
+   /// The branch read in bulk, nullptr if the current tree needs to be read through fTreeArray
+   TBranch *fBulkBranch = nullptr;
+   /// The tree (number) for which fBulkBranch was looked up; it changes when a chain moves to the next file
+   TTree *fBulkTree = nullptr;
+   Int_t fBulkTreeNumber = -1;
+   /// Contiguous, deserialized values of the events in the bulk buffer
+   TBufferFile fBulkValues{TBuffer::kWrite, 32 * 1024};
+   /// Offsets of the events' values in fBulkValues; holds one more element than there are events
+   TBufferFile fBulkOffsets{TBuffer::kWrite, 1024};
+   /// Tree-local entry number of the first event and number of events in the bulk buffer
+   Long64_t fBulkFirstEntry = -1;
+   Int_t fBulkNEntries = 0;
+
+   /// Returns the branch of the column in the given tree if it can be read in bulk as an array of T
+   TBranch *FindBulkBranch(TTree &tree)
+   {
+      auto branch = tree.GetBranch(fColName.c_str());
+      // Friend trees have their own entry numbering; leave them to the TTreeReader
+      if (!branch || branch->GetTree() != &tree)
+         return nullptr;
+      if (branch->GetBulkRead().GetVarLengthType() != TDataType::GetType(typeid(T)))
+         return nullptr;
+      return branch;
+   }
+
+   /// Points fRVec to the values of the current entry using bulk I/O; returns false if that is not possible
+   bool GetBulk()
+   {
+      auto tree = fTreeReader.GetTree() ? fTreeReader.GetTree()->GetTree() : nullptr;
+      if (!tree)
+         return false;
+      if (tree != fBulkTree || fTreeReader.GetTree()->GetTreeNumber() != fBulkTreeNumber) {
+         fBulkTree = tree;
+         fBulkTreeNumber = fTreeReader.GetTree()->GetTreeNumber();
+         fBulkBranch = FindBulkBranch(*tree);
+         fBulkNEntries = 0;
+      }
+      if (!fBulkBranch)
+         return false;
+
+      const auto localEntry = tree->GetReadEntry();
+      if (localEntry < fBulkFirstEntry || localEntry >= fBulkFirstEntry + fBulkNEntries) {
+         fBulkNEntries = fBulkBranch->GetBulkRead().GetBulkEntriesVarLength(localEntry, fBulkValues, fBulkOffsets);
+         if (fBulkNEntries <= 0) {
+            // Fall back to the TTreeReaderArray for the rest of this tree
+            fBulkBranch = nullptr;
+            fBulkNEntries = 0;
+            return false;
+         }
+         fBulkFirstEntry = localEntry;
+      }
+
+      const auto offsets = reinterpret_cast<const Int_t *>(fBulkOffsets.Buffer());
+      const auto idx = localEntry - fBulkFirstEntry;
+      auto values = reinterpret_cast<T *>(fBulkValues.Buffer());
+      RVec<T> rvec(values + offsets[idx], offsets[idx + 1] - offsets[idx]);
+      swap(fRVec, rvec);
+      return true;
+   }
+
    /// Enumerator for the memory layout of the branch
    enum class EStorageType : char { kContiguous, kUnknown, kSparse };
 
@@ -75,6 +144,11 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
       if (entry == fLastEntry)
          return &fRVec; // we already pointed our fRVec to the right address
 
+      if (GetBulk()) {
+         fLastEntry = entry;
+         return &fRVec;
+      }
+
       auto &readerArray = *fTreeArray;
       // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
       // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
@@ -132,7 +206,7 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
 
 public:
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
-      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str()))
+      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str())), fTreeReader(r), fColName(colName)
    {
    }
 
@@ -14,6 +14,7 @@
 #include "Utils.hxx" // IsRVec
 #include "ColumnReaderUtils.hxx"
 #include "RColumnReaderBase.hxx"
+#include "RGraphProfiler.hxx"
 #include "RLoopManager.hxx"
 #include "RVariationBase.hxx"
 
@@ -157,11 +158,21 @@ class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
    /// Per-slot storage for varied column values (for one or multiple columns depending on IsSingleColumn).
    std::vector<Result_t> fLastResults;
 
+   /// The values of the entries of the current range in bulk processing mode
+   struct RBulkResults {
+      std::vector<Result_t> fResults;
+      std::vector<char> fIsComputed; ///< Whether the variations of the nth entry of the range were already computed
+      Long64_t fFirstEntry{-1};
+      Long64_t fSize{0};
+   };
+   std::vector<RBulkResults> fBulkResults; ///< One per slot
+
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   void UpdateHelper(Result_t &resStorage, unsigned int slot, Long64_t entry, TypeList<ColTypes...>,
+                     std::index_sequence<S...>)
    {
       // fExpression must return an RVec<T>
       auto &&results = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
@@ -175,7 +186,7 @@ class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
                                   std::to_string(fVariationNames.size()) + " were expected.");
       }
 
-      AssignResults(fLastResults[slot * CacheLineStep<Result_t>()], std::move(results));
+      AssignResults(resStorage, std::move(results));
    }
 
 public:
@@ -184,7 +195,7 @@ public:
               RLoopManager &lm, const ColumnNames_t &inputColNames)
       : RVariationBase(colNames, variationName, variationTags, type, defines, lm, inputColNames),
         fExpression(std::move(expression)), fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<Result_t>()),
-        fValues(lm.GetNSlots())
+        fValues(lm.GetNSlots()), fBulkResults(lm.GetNSlots())
    {
       fLoopManager->Register(this);
 
@@ -201,6 +212,7 @@ public:
       RColumnReadersInfo info{fInputColumns, fColumnRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = GetColumnReaders(slot, r, ColumnTypes_t{}, info);
       fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = -1;
+      fBulkResults[slot].fSize = 0;
    }
 
    /// Return the (type-erased) address of the value for the given processing slot.
@@ -222,15 +234,49 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * CacheLineStep<Long64_t>()]) {
          // evaluate this filter, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         RProfileScope profile(fProfiler, slot, fProfilerNode);
+         UpdateHelper(fLastResults[slot * CacheLineStep<Result_t>()], slot, entry, ColumnTypes_t{}, TypeInd_t{});
          fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void *UpdateAndGetValuePtr(unsigned int slot, std::size_t colIdx, std::size_t varIdx, Long64_t entry) final
+   {
+      auto &bulk = fBulkResults[slot];
+      const auto idx = entry - bulk.fFirstEntry;
+      if (idx < 0 || idx >= bulk.fSize) {
+         Update(slot, entry);
+         return GetValuePtrHelper(fLastResults[slot * CacheLineStep<Result_t>()], colIdx, varIdx);
+      }
+      if (!bulk.fIsComputed[idx]) {
+         // all the variations of the entry are computed together, for all the readers of this variation
+         RProfileScope profile(fProfiler, slot, fProfilerNode);
+         UpdateHelper(bulk.fResults[idx], slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         bulk.fIsComputed[idx] = true;
+      }
+      return GetValuePtrHelper(bulk.fResults[idx], colIdx, varIdx);
+   }
+
+   void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t size) final
+   {
+      auto &bulk = fBulkResults[slot];
+      for (auto i = bulk.fResults.size(); i < size; ++i) {
+         bulk.fResults.emplace_back();
+         ResizeResults(bulk.fResults.back(), fColNames.size(), fVariationNames.size());
+      }
+      bulk.fIsComputed.assign(size, false);
+      bulk.fFirstEntry = firstEntry;
+      bulk.fSize = size;
+   }
+
    const std::type_info &GetTypeId() const final { return typeid(VariedCol_t); }
 
    /// Clean-up operations to be performed at the end of a task.
-   void FinalizeSlot(unsigned int slot) final { fValues[slot].fill(nullptr); }
+   void FinalizeSlot(unsigned int slot) final
+   {
+      fValues[slot].fill(nullptr);
+      fBulkResults[slot].fSize = 0;
+   }
 };
 
 } // namespace RDF
@@ -35,6 +35,8 @@ class RLoopManager;
 namespace Internal {
 namespace RDF {
 
+class RGraphProfiler;
+
 /// This type includes all parts of RVariation that do not depend on the callable signature.
 class RVariationBase {
 protected:
@@ -47,6 +49,8 @@ protected:
    ColumnNames_t fInputColumns;
    /// The nth flag signals whether the nth input column is a custom column or not.
    ROOT::RVecB fIsDefine;
+   RGraphProfiler *fProfiler = nullptr; ///< Times the evaluations of this variation, if not null
+   unsigned int fProfilerNode = 0;
 
 public:
    RVariationBase(const std::vector<std::string> &colNames, std::string_view variationName,
@@ -69,8 +73,17 @@ public:
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Update the values of all variations for the given entry and return the address of the value of the varIdx-th
+   /// variation of the colIdx-th column. In bulk processing mode the values of all the entries of the current range
+   /// are kept, see SetBulkRange.
+   virtual void *UpdateAndGetValuePtr(unsigned int slot, std::size_t colIdx, std::size_t varIdx, Long64_t entry) = 0;
+   /// Start a new range of entries in bulk processing mode. As for RDefineBase::SetBulkRange, the entries can be
+   /// requested in any order and the variations of each entry are computed at most once.
+   virtual void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t size) = 0;
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
+   /// Time the evaluations of this variation in the following event loop, if profiler is not null
+   void SetProfiler(RGraphProfiler *profiler);
 };
 
 } // namespace RDF
@@ -15,6 +15,7 @@
 #include "RVariationBase.hxx"
 #include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
 
+#include <algorithm>
 #include <limits>
 #include <type_traits>
 
@@ -26,23 +27,27 @@ namespace RDF {
 class R__CLING_PTRCHECK(off) RVariationReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    RVariationBase *fVariation;
 
-   /// Non-owning ptr to the value of the variation.
-   void *fValuePtr = nullptr;
+   /// Index of the column in the columns of the variation.
+   std::size_t fColIdx;
+
+   /// Index of the variation in the variations of the columns.
+   std::size_t fVarIdx;
 
    /// The slot this value belongs to.
    unsigned int fSlot = std::numeric_limits<unsigned int>::max();
 
-   void *GetImpl(Long64_t entry) final
-   {
-      fVariation->Update(fSlot, entry);
-      return fValuePtr;
-   }
+   void *GetImpl(Long64_t entry) final { return fVariation->UpdateAndGetValuePtr(fSlot, fColIdx, fVarIdx, entry); }
 
 public:
    RVariationReader(unsigned int slot, const std::string &colName, const std::string &variationName,
                     RVariationBase &variation)
-      : fVariation(&variation), fValuePtr(variation.GetValuePtr(slot, colName, variationName)), fSlot(slot)
+      : fVariation(&variation), fSlot(slot)
    {
+      const auto &colNames = variation.GetColumnNames();
+      fColIdx = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
+      const auto &variationNames = variation.GetVariationNames();
+      fVarIdx =
+         std::distance(variationNames.begin(), std::find(variationNames.begin(), variationNames.end(), variationName));
    }
 };
 
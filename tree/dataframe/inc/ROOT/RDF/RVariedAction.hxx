@@ -46,6 +46,14 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    /// Owning pointers to upstream nodes for each systematic variation (with the "nominal" at index 0).
    std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
 
+   /// Index in fPrevNodes of the first variation of each distinct upstream node, e.g. the nominal filter is shared by
+   /// all the variations it does not depend on.
+   std::vector<std::size_t> fDistinctPrevNodes;
+   /// Index in fDistinctPrevNodes of the upstream node of each variation.
+   std::vector<std::size_t> fPrevNodeIdx;
+   /// Masks of the entries that passed the filters of each distinct upstream node, per slot, in bulk processing mode.
+   std::vector<std::vector<RMaskedEntryRange>> fBulkMasks;
+
    /// Column readers per slot (outer dimension), per variation and per input column (inner dimension, std::array).
    std::vector<std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>>> fInputValues;
 
@@ -83,6 +91,15 @@ public:
    {
       fLoopManager->Register(this);
 
+      for (const auto &node : fPrevNodes) {
+         auto it = std::find_if(fDistinctPrevNodes.begin(), fDistinctPrevNodes.end(),
+                                [&](std::size_t i) { return fPrevNodes[i] == node; });
+         fPrevNodeIdx.push_back(std::distance(fDistinctPrevNodes.begin(), it));
+         if (it == fDistinctPrevNodes.end())
+            fDistinctPrevNodes.push_back(fPrevNodeIdx.size() - 1);
+      }
+      fBulkMasks.resize(GetNSlots(), std::vector<RMaskedEntryRange>(fDistinctPrevNodes.size()));
+
       for (auto i = 0u; i < columns.size(); ++i) {
          auto *define = colRegister.GetDefine(columns[i]);
          fIsDefine[i] = define != nullptr;
@@ -128,6 +145,26 @@ public:
       }
    }
 
+   void RunBulk(unsigned int slot, RMaskedEntryRange &mask) final
+   {
+      // the filters of each distinct upstream node are checked once for the whole range, then each variation
+      // processes the entries that passed its filters
+      auto &masks = fBulkMasks[slot];
+      for (std::size_t i = 0; i < fDistinctPrevNodes.size(); ++i) {
+         masks[i].Reset(mask.GetFirstEntry(), mask.Size());
+         fPrevNodes[fDistinctPrevNodes[i]]->CheckFiltersBulk(slot, masks[i]);
+      }
+
+      const auto firstEntry = mask.GetFirstEntry();
+      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
+         const auto &varMask = masks[fPrevNodeIdx[varIdx]];
+         for (std::size_t i = 0; i < varMask.Size(); ++i) {
+            if (varMask[i])
+               CallExec(slot, varIdx, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
+   }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
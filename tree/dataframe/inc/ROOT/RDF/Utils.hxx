@@ -197,6 +197,10 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Run the code queued for jitting from a shared library in the jitting cache directory cacheDir, compiling it first
+/// if needed. Return false if the code cannot be compiled outside of the interpreter; it must then be jitted.
+bool RunJittedCodeFromCache(const std::string &code, const std::string &cacheDir);
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
@@ -268,6 +272,27 @@ template <typename T>
 struct IsRVec<ROOT::VecOps::RVec<T>> : std::true_type {};
 // clang-format on
 
+/// Assign the value returned by f to the result of a Define. If arena is not null, the temporary RVecs created by f
+/// allocate their buffers in the arena, and the value is then copied into the buffer of result, on the heap.
+template <typename T, typename F>
+void AssignDefineResult(T &result, ROOT::Internal::VecOps::RVecArena *, F &&f)
+{
+   result = f();
+}
+
+template <typename T, typename F>
+void AssignDefineResult(ROOT::VecOps::RVec<T> &result, ROOT::Internal::VecOps::RVecArena *arena, F &&f)
+{
+   if (arena == nullptr) {
+      result = f();
+      return;
+   }
+   ROOT::Internal::VecOps::RVecArena::RScope scope(*arena);
+   ROOT::VecOps::RVec<T> value = f();
+   ROOT::Internal::VecOps::RVecArena::RPause pause(*arena);
+   result = value;
+}
+
 /// Return a vector with all elements of v1 and v2 and duplicates removed.
 /// Precondition: each of v1 and v2 must not have duplicate elements.
 template <typename T>
@@ -165,6 +165,8 @@ RNode AsRNode(NodeType node)
 /// RResultPtr is that the event loops will run concurrently. Therefore, the overall
 /// computation of all results is generally more efficient.
 /// It should be noted that user-defined operations (e.g., Filters and Defines) of the different RDataFrame graphs are assumed to be safe to call concurrently.
+/// With implicit multi-threading enabled, the computation graphs are just-in-time compiled one at a time and the
+/// event loop of each graph starts as soon as its code is compiled, while the following graphs are compiled.
 ///
 /// ~~~{.cpp}
 /// ROOT::RDataFrame df1("tree1", "file1.root");
@@ -198,6 +198,15 @@ public:
    // clang-format on
    virtual bool SetEntry(unsigned int slot, ULong64_t entry) = 0;
 
+   // clang-format off
+   /// \brief Inform the data source about the columns that are only read behind a Filter.
+   /// \param[in] columnNames The requested columns that the computation graph only reads for entries that passed
+   /// at least one filter. All other requested columns are potentially read for every entry.
+   /// This method is called before every event-loop, prior to Initialize. Data sources can use the information to
+   /// load the data of these columns on demand rather than prefetching it.
+   // clang-format on
+   virtual void SetFilteredColumns(const std::vector<std::string> & /*columnNames*/) {}
+
    // clang-format off
    /// \brief Convenience method called before starting an event-loop.
    /// This method might be called multiple times over the lifetime of a RDataSource, since
@@ -53,11 +53,24 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::unique_ptr<ROOT::Experimental::Internal::RNTupleColumnReader>> fColumnReaderPrototypes;
    std::vector<std::string> fColumnNames;
    std::vector<std::string> fColumnTypes;
+   /// Indexes into fColumnNames of the columns for which readers were requested
    std::vector<size_t> fActiveColumns;
 
+   /// Restricts the processed entries to the pages whose value range overlaps [fMin, fMax]
+   struct RValueRangeCut {
+      DescriptorId_t fColumnId;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RValueRangeCut> fValueRangeCuts;
+
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// Returns the entry ranges of the pages that can pass all the value range cuts and tells the page sources to skip
+   /// the clusters without any such entries
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetSelectedEntryRanges();
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -81,8 +94,19 @@ public:
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    std::string GetLabel() final { return "RNTupleDS"; }
 
+   /// Pushes a selection `min <= fieldName <= max` down to the data source. Using the per-page value ranges stored
+   /// in the page list (see RNTupleWriteOptions::SetComputeValueRanges()), only the entries of pages that might pass
+   /// the cut are processed and clusters without any such page are not read. The cut is a hint, the processed
+   /// entries can still fail it. It must therefore be implied by a Filter() of the computation graph.
+   /// Only top-level fields of arithmetic type are supported.
+   void AddValueRangeCut(std::string_view fieldName, double min, double max);
+
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// The physical columns that are only needed by the given RDF columns are not preloaded with the clusters but
+   /// loaded per cluster on first access (see RPageSource::SetLazyColumns())
+   void SetFilteredColumns(const std::vector<std::string> &columnNames) final;
+
    void Initialize() final;
    void Finalize() final;
 
@@ -0,0 +1,115 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPARQUETDS
+#define ROOT_RPARQUETDS
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDataSource.hxx"
+#include "ROOT/RStringView.hxx"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace parquet {
+namespace arrow {
+class FileReader;
+}
+} // namespace parquet
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+// Members are defined in RParquetDS.cxx in order to not pollute this header file with the parquet headers
+struct RParquetDSSlot;
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+
+// clang-format off
+/**
+\class ROOT::RDF::RParquetDS
+\ingroup dataframe
+\brief RDataFrame data source class to read Apache Parquet files.
+
+The RParquetDS reads the row groups of a Parquet file directly, without loading the whole file in an arrow::Table
+first. One can use it like
+
+    auto rdf = ROOT::RDF::MakeParquetDataFrame("/path/to/file.parquet");
+    auto h = rdf.Filter("x > 0").Histo1D("x");
+
+Each row group of the file is one entry range of the event loop, so that row groups are processed concurrently when
+implicit multi-threading is enabled. At the beginning of a range only the columns used by the computation graph are
+read, and the reads of their column chunks are coalesced and issued in parallel (Parquet "pre-buffering").
+
+The column statistics stored in the file can be used to skip whole row groups: SelectRowGroups drops the row groups
+in which, according to their min/max statistics, no value of a column lies in the given interval. The values of the
+row groups that are read are not checked, so the corresponding Filter still has to be booked:
+
+    auto ds = std::make_unique<ROOT::RDF::RParquetDS>("/path/to/file.parquet");
+    ds->SelectRowGroups("x", 0., 10.);
+    ROOT::RDataFrame rdf(std::move(ds));
+    auto n = rdf.Filter("x >= 0 && x <= 10").Count();
+
+The entry numbers (e.g. rdfentry_) of the entries read are the ones in the file, even if row groups are skipped.
+The supported column types are the ones of RArrowDS.
+*/
+// clang-format on
+class RParquetDS final : public RDataSource {
+private:
+   std::string fFileName;
+   /// Used to read the metadata and the statistics; each slot has its own reader for the values
+   std::unique_ptr<parquet::arrow::FileReader> fReader;
+   std::vector<std::string> fColumnNames;
+   std::vector<std::string> fColumnTypes;
+   /// The leaf column indices in the Parquet schema of each of the columns in fColumnNames
+   std::vector<std::vector<int>> fLeafIndices;
+   /// Whether a column is read by the event loop, i.e. whether GetColumnReadersImpl was called for it
+   std::vector<bool> fIsActive;
+   /// The entry number of the first entry of each row group, followed by the total number of entries
+   std::vector<ULong64_t> fRowGroupFirstEntry;
+   std::vector<bool> fIsRowGroupSelected;
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+   unsigned int fNSlots = 0U;
+   std::vector<std::unique_ptr<ROOT::Internal::RDF::RParquetDSSlot>> fSlots;
+   /// The value pointers handed out by GetColumnReadersImpl, nSlots per column
+   std::vector<void *> fValuePtrs;
+
+   std::size_t GetColumnIndex(std::string_view colName) const;
+
+protected:
+   Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
+
+public:
+   RParquetDS(std::string_view fileName, const std::vector<std::string> &columns = {});
+   ~RParquetDS();
+   void SetNSlots(unsigned int nSlots) final;
+   const std::vector<std::string> &GetColumnNames() const final;
+   bool HasColumn(std::string_view colName) const final;
+   std::string GetTypeName(std::string_view colName) const final;
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
+   void FinalizeSlot(unsigned int slot) final;
+   void Initialize() final;
+   std::string GetLabel() final;
+
+   std::size_t GetNRowGroups() const { return fIsRowGroupSelected.size(); }
+   void SelectRowGroups(std::string_view colName, double min, double max);
+};
+
+RDataFrame MakeParquetDataFrame(std::string_view fileName, const std::vector<std::string> &columns = {});
+
+} // namespace RDF
+
+} // namespace ROOT
+
+#endif
@@ -18,6 +18,14 @@
 namespace ROOT {
 
 namespace RDF {
+
+/// The data format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently the same as kTTree
+   kTTree,
+   kRNTuple ///< Requires ROOT to be built with root7
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +45,10 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   /// Format of the output dataset. RNTuple output only supports the "RECREATE" mode and no output subdirectory; the
+   /// slots of a multi-threaded event loop fill their own clusters of the same RNTuple, whose entries are therefore
+   /// not in the order of the input dataset.
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault;
 };
 } // ns RDF
 } // ns ROOT
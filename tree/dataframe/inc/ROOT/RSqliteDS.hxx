@@ -47,6 +47,12 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+With several processing slots, queries of the form "SELECT <columns> FROM <table> [WHERE <condition>]" without
+aggregate functions, sorting, grouping or joins are scanned in parallel: every slot opens its own connection to the
+file and reads its own ranges of the table's rowids. In this case the entry numbers of the data frame are the rowids
+of the table, so they are not contiguous if the table has gaps or the condition filters rows. Other queries are read
+sequentially, one row at a time.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -82,8 +88,9 @@ private:
    ULong64_t fNRow;
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
-   std::vector<Value_t> fValues;
+   /// The values of the current row of every slot. Queries that cannot be split by rowid ranges are read one row at a
+   /// time, in which case all the slots see the same current row.
+   std::vector<std::vector<Value_t>> fValues;
 
    // clang-format off
    /// Corresponds to the types defined in ETypes.
@@ -106,6 +113,7 @@ public:
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
    void Initialize() final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
    std::string GetLabel() final;
 
 protected:
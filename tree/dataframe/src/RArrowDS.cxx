@@ -29,7 +29,8 @@ arrow::Schema.
 #include <ROOT/RDF/Utils.hxx>
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RArrowDS.hxx>
-#include <snprintf.h>
+
+#include "RArrowVisitors.hxx"
 
 #include <algorithm>
 #include <memory>
@@ -51,155 +52,6 @@ namespace ROOT {
 namespace Internal {
 namespace RDF {
 
-// This is needed by Arrow 0.12.0 which dropped
-//
-//      using ArrowType = ArrowType_;
-//
-// from ARROW_STL_CONVERSION
-template <typename T>
-struct RootConversionTraits {};
-
-#define ROOT_ARROW_STL_CONVERSION(c_type, ArrowType_)  \
-   template <>                                         \
-   struct RootConversionTraits<c_type> {               \
-   using ArrowType = ::arrow::ArrowType_;              \
-   };
-
-ROOT_ARROW_STL_CONVERSION(bool, BooleanType)
-ROOT_ARROW_STL_CONVERSION(int8_t, Int8Type)
-ROOT_ARROW_STL_CONVERSION(int16_t, Int16Type)
-ROOT_ARROW_STL_CONVERSION(int32_t, Int32Type)
-ROOT_ARROW_STL_CONVERSION(Long64_t, Int64Type)
-ROOT_ARROW_STL_CONVERSION(uint8_t, UInt8Type)
-ROOT_ARROW_STL_CONVERSION(uint16_t, UInt16Type)
-ROOT_ARROW_STL_CONVERSION(uint32_t, UInt32Type)
-ROOT_ARROW_STL_CONVERSION(ULong64_t, UInt64Type)
-ROOT_ARROW_STL_CONVERSION(float, FloatType)
-ROOT_ARROW_STL_CONVERSION(double, DoubleType)
-ROOT_ARROW_STL_CONVERSION(std::string, StringType)
-
-// Per slot visitor of an Array.
-class ArrayPtrVisitor : public ::arrow::ArrayVisitor {
-private:
-   /// The pointer to update.
-   void **fResult;
-   bool fCachedBool{false}; // Booleans need to be unpacked, so we use a cached entry.
-   // FIXME: I should really use a variant here
-   RVec<float> fCachedRVecFloat;
-   RVec<double> fCachedRVecDouble;
-   RVec<ULong64_t> fCachedRVecULong64;
-   RVec<UInt_t> fCachedRVecUInt;
-   RVec<Long64_t> fCachedRVecLong64;
-   RVec<Int_t> fCachedRVecInt;
-   std::string fCachedString;
-   /// The entry in the array which should be looked up.
-   ULong64_t fCurrentEntry;
-
-   template <typename T>
-   void *getTypeErasedPtrFrom(arrow::ListArray const &array, int32_t entry, RVec<T> &cache)
-   {
-      using ArrowType = typename RootConversionTraits<T>::ArrowType;
-      using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
-      auto values = reinterpret_cast<ArrayType *>(array.values().get());
-      auto offset = array.value_offset(entry);
-      // Here the cast to void* is a worksround while we figure out the
-      // issues we have with long long types, signed and unsigned.
-      RVec<T> tmp(reinterpret_cast<T *>((void *)values->raw_values()) + offset, array.value_length(entry));
-      std::swap(cache, tmp);
-      return (void *)(&cache);
-   }
-
-public:
-   ArrayPtrVisitor(void **result) : fResult{result}, fCurrentEntry{0} {}
-
-   void SetEntry(ULong64_t entry) { fCurrentEntry = entry; }
-
-   /// Check if we are asking the same entry as before.
-   virtual arrow::Status Visit(arrow::Int32Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::Int64Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   /// Check if we are asking the same entry as before.
-   virtual arrow::Status Visit(arrow::UInt32Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::UInt64Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::FloatArray const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::DoubleArray const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::BooleanArray const &array) final
-   {
-      fCachedBool = array.Value(fCurrentEntry);
-      *fResult = reinterpret_cast<void *>(&fCachedBool);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::StringArray const &array) final
-   {
-      fCachedString = array.GetString(fCurrentEntry);
-      *fResult = reinterpret_cast<void *>(&fCachedString);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::ListArray const &array) final
-   {
-      switch (array.value_type()->id()) {
-      case arrow::Type::FLOAT: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecFloat);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::DOUBLE: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecDouble);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::UINT32: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecUInt);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::UINT64: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecULong64);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::INT32: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecInt);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::INT64: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecLong64);
-         return arrow::Status::OK();
-      }
-      default: return arrow::Status::TypeError("Type not supported");
-      }
-   }
-
-   using ::arrow::ArrayVisitor::Visit;
-};
-
 /// Helper class which keeps track for each slot where to get the entry.
 class TValueGetter {
 private:
@@ -230,6 +82,9 @@ public:
       }
    }
 
+   /// The entry numbers at which the chunks of the column end, in increasing order.
+   const std::vector<ULong64_t> &GetChunkEnds() const { return fChunkIndex; }
+
    /// This returns the ptr to the ptr to actual data.
    std::vector<void *> SlotPtrs()
    {
@@ -291,95 +146,6 @@ public:
 
 namespace RDF {
 
-/// Helper to get the contents of a given column
-
-/// Helper to get the human readable name of type
-class RDFTypeNameGetter : public ::arrow::TypeVisitor {
-private:
-   std::vector<std::string> fTypeName;
-
-public:
-   arrow::Status Visit(const arrow::Int64Type &) override
-   {
-      fTypeName.push_back("Long64_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::Int32Type &) override
-   {
-      fTypeName.push_back("Int_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::UInt64Type &) override
-   {
-      fTypeName.push_back("ULong64_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::UInt32Type &) override
-   {
-      fTypeName.push_back("UInt_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::FloatType &) override
-   {
-      fTypeName.push_back("float");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::DoubleType &) override
-   {
-      fTypeName.push_back("double");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::StringType &) override
-   {
-      fTypeName.push_back("string");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::BooleanType &) override
-   {
-      fTypeName.push_back("bool");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::ListType &l) override
-   {
-      /// Recursively visit List types and map them to
-      /// an RVec. We accumulate the result of the recursion on
-      /// fTypeName so that we can create the actual type
-      /// when the recursion is done.
-      fTypeName.push_back("ROOT::VecOps::RVec<%s>");
-      return l.value_type()->Accept(this);
-   }
-   std::string result()
-   {
-      // This recursively builds a nested type.
-      std::string result = "%s";
-      char buffer[8192];
-      for (size_t i = 0; i < fTypeName.size(); ++i) {
-         snprintf(buffer, 8192, result.c_str(), fTypeName[i].c_str());
-         result = buffer;
-      }
-      return result;
-   }
-
-   using ::arrow::TypeVisitor::Visit;
-};
-
-/// Helper to determine if a given Column is a supported type.
-class VerifyValidColumnType : public ::arrow::TypeVisitor {
-private:
-public:
-   virtual arrow::Status Visit(const arrow::Int64Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::UInt64Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::Int32Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::UInt32Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::FloatType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::DoubleType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::StringType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::BooleanType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::ListType &) override { return arrow::Status::OK(); }
-
-   using ::arrow::TypeVisitor::Visit;
-};
-
 ////////////////////////////////////////////////////////////////////////
 /// Constructor to create an Arrow RDataSource for RDataFrame.
 /// \param[in] inTable the arrow Table to observe.
@@ -516,20 +282,49 @@ void RArrowDS::InitSlot(unsigned int slot, ULong64_t entry)
    }
 }
 
-void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, int nRecords, unsigned int nSlots)
+/// Split the entries in ranges whose boundaries are, where possible, boundaries of the chunks (e.g. the record batches)
+/// of the columns, so that each range reads the values of a column from as few chunks as possible. Chunks with more
+/// than nRecords / nSlots entries are split in equal parts, so that all slots get work, and consecutive smaller chunks
+/// are merged up to that size, to limit the per-range overhead.
+void splitAtChunkBoundaries(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges,
+                            const std::vector<ULong64_t> &chunkEnds, ULong64_t nRecords, unsigned int nSlots)
 {
    ranges.clear();
-   const auto chunkSize = nRecords / nSlots;
-   const auto remainder = 1U == nSlots ? 0 : nRecords % nSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(nSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
+   if (nRecords == 0)
+      return;
+   const auto targetSize = std::max(nRecords / nSlots, 1ull);
+
+   std::vector<ULong64_t> boundaries(chunkEnds);
+   boundaries.emplace_back(nRecords);
+   std::sort(boundaries.begin(), boundaries.end());
+   boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+   ULong64_t rangeStart = 0ull;
+   ULong64_t chunkStart = 0ull;
+   for (const auto chunkEnd : boundaries) {
+      if (chunkEnd == 0ull || chunkEnd > nRecords)
+         continue;
+      const auto chunkSize = chunkEnd - chunkStart;
+      if (chunkSize > targetSize) {
+         // close the range of the previous small chunks, then split this chunk in parts of about targetSize entries
+         if (rangeStart < chunkStart)
+            ranges.emplace_back(rangeStart, chunkStart);
+         const auto nParts = chunkSize / targetSize;
+         const auto partSize = chunkSize / nParts;
+         for (auto i = 0ull; i < nParts; ++i) {
+            const auto partEnd = i + 1 == nParts ? chunkEnd : chunkStart + (i + 1) * partSize;
+            ranges.emplace_back(chunkStart + i * partSize, partEnd);
+         }
+         rangeStart = chunkEnd;
+      } else if (chunkEnd - rangeStart > targetSize) {
+         // this chunk does not fit in the current range: it starts a new one
+         ranges.emplace_back(rangeStart, chunkStart);
+         rangeStart = chunkStart;
+      }
+      chunkStart = chunkEnd;
    }
-   ranges.back().second += remainder;
+   if (rangeStart < nRecords)
+      ranges.emplace_back(rangeStart, nRecords);
 }
 
 int getNRecords(std::shared_ptr<arrow::Table> &table, std::vector<std::string> &columnNames)
@@ -588,8 +383,11 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
 
 void RArrowDS::Initialize()
 {
-   auto nRecords = getNRecords(fTable, fColumnNames);
-   splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
+   const ULong64_t nRecords = getNRecords(fTable, fColumnNames);
+   std::vector<ULong64_t> chunkEnds;
+   for (const auto &getter : fValueGetters)
+      chunkEnds.insert(chunkEnds.end(), getter->GetChunkEnds().begin(), getter->GetChunkEnds().end());
+   splitAtChunkBoundaries(fEntryRanges, chunkEnds, nRecords, fNSlots);
 }
 
 std::string RArrowDS::GetLabel()
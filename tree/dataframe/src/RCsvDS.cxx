@@ -68,10 +68,21 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
+By default, RCsvDS reads the entire CSV file content into memory before
 RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
 important to check both how much memory is available and the size of the CSV file.
 
+For large files, RCsvDS::EnableChunkedParsing switches to a streaming mode: the file is read in chunks of
+(about) a given number of bytes that end at line boundaries, each chunk is one entry range, and the lines of
+a chunk are parsed when a slot starts processing the range, so that with implicit multi-threading the chunks
+are parsed in parallel. Only one chunk per slot is kept in memory at a time. The column types are still
+inferred from the first lines of the file:
+~~~{.cpp}
+auto ds = std::make_unique<ROOT::RDF::RCsvDS>("large.csv");
+ds->EnableChunkedParsing();
+ROOT::RDataFrame df(std::move(ds));
+~~~
+
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
 Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored as zeros.
@@ -117,14 +128,14 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+void RCsvDS::FillRecord(const std::string &line, Record_t &record, std::set<std::string> &colContainingEmpty)
 {
    auto i = 0U;
 
    auto columns = ParseColumns(line);
 
    for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+      auto colType = fColTypes.at(fHeaders[i]);
 
       switch (colType) {
       case 'D': {
@@ -135,7 +146,7 @@ void RCsvDS::FillRecord(const std::string &line, Record_t &record)
          if (col != "nan") {
             record.emplace_back(new Long64_t(std::stoll(col)));
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
+            colContainingEmpty.insert(fHeaders[i]);
             record.emplace_back(new Long64_t(0));
          }
          break;
@@ -146,7 +157,7 @@ void RCsvDS::FillRecord(const std::string &line, Record_t &record)
          if (col != "nan") {
             std::istringstream(col) >> std::boolalpha >> *b;
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
+            colContainingEmpty.insert(fHeaders[i]);
             *b = false;
          }
          break;
@@ -372,9 +383,9 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 }
 
-void RCsvDS::FreeRecords()
+void RCsvDS::FreeRecords(std::vector<Record_t> &records)
 {
-   for (auto &record : fRecords) {
+   for (auto &record : records) {
       for (size_t i = 0; i < record.size(); ++i) {
          void *p = record[i];
          const auto colType = fColTypes[fHeaders[i]];
@@ -398,22 +409,33 @@ void RCsvDS::FreeRecords()
          }
       }
    }
-   fRecords.clear();
+   records.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RCsvDS::~RCsvDS()
 {
-   FreeRecords();
+   FreeRecords(fRecords);
+   for (auto &records : fSlotRecords)
+      FreeRecords(records);
 }
 
 void RCsvDS::Finalize()
 {
+   if (fChunkBytes > 0) {
+      for (auto &colContainingEmpty : fSlotColContainingEmpty) {
+         fColContainingEmpty.insert(colContainingEmpty.begin(), colContainingEmpty.end());
+         colContainingEmpty.clear();
+      }
+      WarnAboutEmptyCells();
+      fChunkPos = fDataPos;
+      fChunks.clear();
+   }
    fCsvFile->Seek(fDataPos);
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
-   FreeRecords();
+   FreeRecords(fRecords);
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -421,31 +443,89 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
    return fHeaders;
 }
 
+void RCsvDS::WarnAboutEmptyCells() const
+{
+   if (fColContainingEmpty.empty())
+      return;
+
+   std::string msg = "";
+   for (const auto &col : fColContainingEmpty) {
+      const auto colT = GetTypeName(col);
+      msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
+      msg += "There is no `nan` equivalent for type " + colT + ", hence ";
+      msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
+   }
+   msg += "Please manually set the column type to `double` (with `D`) in `MakeCsvDataFrame` to read NaNs instead.\n";
+   Warning("RCsvDS", "%s", msg.c_str());
+}
+
+/// Read the next chunk of the file in chunked parsing mode: about fChunkBytes bytes, extended to the end of the line.
+/// Returns false at the end of the file.
+bool RCsvDS::ReadChunk(std::string &chunk)
+{
+   chunk.clear();
+   const auto fileSize = fCsvFile->GetSize();
+   if (fChunkPos >= fileSize)
+      return false;
+
+   auto nBytes = std::min<std::uint64_t>(fChunkBytes, fileSize - fChunkPos);
+   chunk.resize(nBytes);
+   chunk.resize(fCsvFile->ReadAt(&chunk[0], nBytes, fChunkPos));
+   // extend the chunk until its last line is complete
+   while (!chunk.empty() && fChunkPos + chunk.size() < fileSize && chunk.back() != '\n') {
+      const auto prevSize = chunk.size();
+      nBytes = std::min<std::uint64_t>(4096, fileSize - fChunkPos - prevSize);
+      chunk.resize(prevSize + nBytes);
+      chunk.resize(prevSize + fCsvFile->ReadAt(&chunk[prevSize], nBytes, fChunkPos + prevSize));
+      const auto lineEnd = chunk.find('\n', prevSize);
+      if (lineEnd != std::string::npos)
+         chunk.resize(lineEnd + 1);
+      if (chunk.size() == prevSize)
+         break; // could not read more
+   }
+   fChunkPos += chunk.size();
+   return !chunk.empty();
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
+   if (fChunkBytes > 0) {
+      // Read the next chunk for each slot and count its lines: the lines are parsed in InitSlot, by the slot that
+      // processes the range
+      std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+      fChunks.clear();
+      std::string text;
+      while (fChunks.size() < fNSlots && ReadChunk(text)) {
+         ULong64_t nLines = 0ULL;
+         for (std::size_t lineStart = 0; lineStart < text.size();) {
+            auto lineEnd = std::min(text.find('\n', lineStart), text.size());
+            const auto lineLength = lineEnd - lineStart - (lineEnd > lineStart && text[lineEnd - 1] == '\r' ? 1 : 0);
+            if (lineLength > 0)
+               ++nLines; // empty lines are skipped
+            lineStart = lineEnd + 1;
+         }
+         if (nLines == 0)
+            continue;
+         entryRanges.emplace_back(fProcessedLines, fProcessedLines + nLines);
+         fChunks.push_back({fProcessedLines, std::move(text)});
+         fProcessedLines += nLines;
+      }
+      return entryRanges;
+   }
+
    // Read records and store them in memory
    auto linesToRead = fLinesChunkSize;
-   FreeRecords();
+   FreeRecords(fRecords);
 
    std::string line;
    while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
       if (line.empty()) continue; // skip empty lines
       fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
+      FillRecord(line, fRecords.back(), fColContainingEmpty);
       --linesToRead;
    }
 
-   if (!fColContainingEmpty.empty()) {
-      std::string msg = "";
-      for (const auto &col : fColContainingEmpty) {
-         const auto colT = GetTypeName(col);
-         msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
-         msg += "There is no `nan` equivalent for type " + colT + ", hence ";
-         msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
-      }
-      msg += "Please manually set the column type to `double` (with `D`) in `MakeCsvDataFrame` to read NaNs instead.\n";
-      Warning("RCsvDS", "%s", msg.c_str());
-   }
+   WarnAboutEmptyCells();
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
@@ -504,10 +584,11 @@ bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
    // Here we need to normalise the entry to the number of lines we already processed.
    const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
+   const auto &record =
+      fChunkBytes > 0 ? fSlotRecords[slot][entry - fSlotFirstEntry[slot]] : fRecords[entry - offset];
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
+      auto dataPtr = record[colIndex];
       switch (colType) {
       case 'D': {
          fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
@@ -546,6 +627,49 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
    fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+
+   fSlotRecords.resize(fNSlots);
+   fSlotFirstEntry.resize(fNSlots, 0ULL);
+   fSlotColContainingEmpty.resize(fNSlots);
+}
+
+void RCsvDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   if (fChunkBytes == 0)
+      return;
+
+   // with one slot there is one chunk per GetEntryRanges call, and the sequential event loop does not pass its
+   // first entry
+   auto chunk = fNSlots == 1u ? fChunks.begin()
+                              : std::find_if(fChunks.begin(), fChunks.end(), [firstEntry](const RTextChunk &c) {
+                                   return c.fFirstEntry == firstEntry;
+                                });
+   assert(chunk != fChunks.end());
+
+   auto &records = fSlotRecords[slot];
+   FreeRecords(records);
+   fSlotFirstEntry[slot] = chunk->fFirstEntry;
+   const auto &text = chunk->fText;
+   std::string line;
+   for (std::size_t lineStart = 0; lineStart < text.size();) {
+      auto lineEnd = std::min(text.find('\n', lineStart), text.size());
+      line.assign(text, lineStart, lineEnd - lineStart);
+      lineStart = lineEnd + 1;
+      if (!line.empty() && line.back() == '\r')
+         line.pop_back();
+      if (line.empty())
+         continue; // skip empty lines
+      records.emplace_back();
+      FillRecord(line, records.back(), fSlotColContainingEmpty[slot]);
+   }
+   // the text is not needed anymore, each range is processed by one slot
+   std::string().swap(chunk->fText);
+}
+
+void RCsvDS::FinalizeSlot(unsigned int slot)
+{
+   if (fChunkBytes > 0)
+      FreeRecords(fSlotRecords[slot]);
 }
 
 std::string RCsvDS::GetLabel()
@@ -553,6 +677,21 @@ std::string RCsvDS::GetLabel()
    return "RCsv";
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Read and parse the file in chunks, in parallel when implicit multi-threading is enabled.
+/// \param[in] chunkBytes the approximate size of the chunks, in bytes
+///
+/// Each chunk ends at a line boundary and is one entry range of the event loop. Its lines are parsed by the slot
+/// that processes the range, and at most one chunk per slot is in memory at a time. The lines chunk size passed to
+/// the constructor is ignored in this mode. Must be called before the event loop runs.
+void RCsvDS::EnableChunkedParsing(std::uint64_t chunkBytes)
+{
+   if (chunkBytes == 0)
+      throw std::runtime_error("RCsvDS: the size of the chunks of chunked parsing must be larger than zero.");
+   fChunkBytes = chunkBytes;
+   fChunkPos = fDataPos;
+}
+
 RDataFrame MakeCsvDataFrame(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize,
                             std::unordered_map<std::string, char> &&colTypes)
 {
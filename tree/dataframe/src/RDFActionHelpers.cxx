@@ -248,6 +248,32 @@ template class TakeHelper<float, float, std::vector<float>>;
 template class TakeHelper<double, double, std::vector<double>>;
 #endif
 
+std::size_t EstimateHistogramSize(const TH1 &h)
+{
+   // the bin contents are stored by the TArray base class of the concrete histogram type
+   std::size_t binSize = sizeof(Double_t);
+   if (dynamic_cast<const TArrayC *>(&h))
+      binSize = sizeof(Char_t);
+   else if (dynamic_cast<const TArrayS *>(&h))
+      binSize = sizeof(Short_t);
+   else if (dynamic_cast<const TArrayI *>(&h) || dynamic_cast<const TArrayF *>(&h))
+      binSize = sizeof(Float_t);
+   return h.GetNcells() * binSize + h.GetSumw2N() * sizeof(Double_t);
+}
+
+bool CanUseUniformBinsFill(const TH1 &h)
+{
+   if (h.GetBuffer() || h.GetEntries() != 0.)
+      return false;
+   const TAxis *axes[] = {h.GetXaxis(), h.GetYaxis()};
+   for (int i = 0; i < std::min(h.GetDimension(), 2); ++i) {
+      const TAxis &axis = *axes[i];
+      if (axis.GetXbins()->GetSize() > 0 || axis.CanExtend() || axis.IsAlphanumeric() || axis.GetLabels())
+         return false;
+   }
+   return true;
+}
+
 void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &treeName, const std::string &fileName)
 {
    TString fileMode = opts.fMode;
@@ -279,6 +305,19 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__HAS_ROOT7
+void ValidateSnapshotRNTupleOutput(const RSnapshotOptions &opts, const std::string &dirName)
+{
+   TString fileMode = opts.fMode;
+   fileMode.ToLower();
+   if (fileMode != "recreate")
+      throw std::invalid_argument("Snapshot: RNTuple output only supports the \"RECREATE\" mode");
+   if (!dirName.empty())
+      throw std::invalid_argument("Snapshot: RNTuple output cannot be written in the sub-directory \"" + dirName +
+                                  "\"");
+}
+#endif
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -18,7 +18,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RResultHandle.hxx"    // for RResultHandle, RunGraphs
 #ifdef R__USE_IMT
-#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TTaskGroup.hxx"
 #endif // R__USE_IMT
 
 #include <algorithm>
@@ -48,37 +48,51 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    std::set<RResultHandle, decltype(sameGraph)> s(handles.begin(), handles.end(), sameGraph);
    std::vector<RResultHandle> uniqueLoops(s.begin(), s.end());
 
-   // Trigger jitting. One call is enough to jit the code required by all computation graphs.
-   TStopwatch sw;
-   sw.Start();
-   {
-      // silence logs from RLoopManager::Jit: RunGraphs does its own logging
-      auto silenceRDFLogs = ROOT::Experimental::RLogScopedVerbosity(ROOT::Detail::RDF::RDFLogChannel(),
-                                                                    ROOT::Experimental::ELogLevel::kError);
-      uniqueLoops[0].fLoopManager->Jit();
-   }
-   sw.Stop();
-   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
-      << "Just-in-time compilation phase for RunGraphs (" << uniqueLoops.size()
-      << " unique computation graphs) completed"
-      << (sw.RealTime() > 1e-3 ? " in " + std::to_string(sw.RealTime()) + " seconds." : " in less than 1ms.");
-
    // Trigger the unique event loops
    auto run = [](RResultHandle &h) {
       if (h.fLoopManager)
          h.fLoopManager->Run(/*jit=*/false);
    };
 
+   TStopwatch sw;
+   TStopwatch jitSw;
+   jitSw.Reset();
    sw.Start();
 #ifdef R__USE_IMT
    if (ROOT::IsImplicitMTEnabled()) {
-      ROOT::TThreadExecutor{}.Foreach(run, uniqueLoops);
+      // Jit the computation graphs one at a time and start each event loop as soon as its code is jitted, such that
+      // the jitting of the following graphs overlaps with the event loops that are already running.
+      ROOT::Experimental::TTaskGroup tasks;
+      for (auto &h : uniqueLoops) {
+         {
+            auto silenceRDFLogs = ROOT::Experimental::RLogScopedVerbosity(ROOT::Detail::RDF::RDFLogChannel(),
+                                                                          ROOT::Experimental::ELogLevel::kError);
+            jitSw.Continue();
+            h.fLoopManager->JitOwnCode();
+            jitSw.Stop();
+         }
+         tasks.Run([&run, &h] { run(h); });
+      }
+      tasks.Wait();
    } else {
 #endif
+      // Trigger jitting. One call is enough to jit the code required by all computation graphs.
+      {
+         // silence logs from RLoopManager::Jit: RunGraphs does its own logging
+         auto silenceRDFLogs = ROOT::Experimental::RLogScopedVerbosity(ROOT::Detail::RDF::RDFLogChannel(),
+                                                                       ROOT::Experimental::ELogLevel::kError);
+         jitSw.Start();
+         uniqueLoops[0].fLoopManager->Jit();
+         jitSw.Stop();
+      }
       std::for_each(uniqueLoops.begin(), uniqueLoops.end(), run);
 #ifdef R__USE_IMT
    }
 #endif
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+      << "Just-in-time compilation phase for RunGraphs (" << uniqueLoops.size()
+      << " unique computation graphs) completed"
+      << (jitSw.RealTime() > 1e-3 ? " in " + std::to_string(jitSw.RealTime()) + " seconds." : " in less than 1ms.");
    sw.Stop();
    R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
       << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << sw.CpuTime() << "s CPU, "
@@ -19,6 +19,7 @@
 #include <ROOT/RDF/RLoopManager.hxx>
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RStringView.hxx>
 #include <TBranch.h>
 #include <TClass.h>
@@ -26,10 +27,12 @@
 #include <TDataType.h>
 #include <TError.h>
 #include <TLeaf.h>
+#include <TMD5.h>
 #include <TObjArray.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
@@ -48,6 +51,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>  // for size_t
+#include <fstream>
 #include <iterator> // for back_insert_iterator
 #include <map>
 #include <memory>
@@ -638,6 +642,62 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+/// Describe a column for the fingerprints of the nodes that read it, see RNodeBase::GetFingerprint(). Return an empty
+/// string if the column cannot be described, i.e. if it is a Define that calls compiled code or that is affected by
+/// systematic variations.
+std::string GetColumnFingerprint(const std::string &col, const RColumnRegister &colRegister)
+{
+   const auto name = colRegister.ResolveAlias(col);
+   if (!colRegister.GetVariationDeps(name).empty())
+      return "";
+   if (auto *define = colRegister.GetDefine(name))
+      return define->GetFingerprint();
+   return "column " + name;
+}
+
+/// Describe an operation that reads the given columns, for the fingerprints of the nodes of the computation graph and
+/// of the actions. Return an empty string if one of the columns cannot be described.
+static std::string MakeOperationFingerprint(const std::string &operation, const ColumnNames_t &columns,
+                                            const RColumnRegister &colRegister)
+{
+   std::string fingerprint = operation;
+   for (const auto &col : columns) {
+      const auto colFingerprint = GetColumnFingerprint(col, colRegister);
+      if (colFingerprint.empty())
+         return "";
+      fingerprint += "\n{" + colFingerprint + '}';
+   }
+   return fingerprint;
+}
+
+/// Describe an action booked on prevNode, for the keys of the result cache. Return an empty string if the action
+/// cannot be described, i.e. if its upstream graph or one of its input columns cannot be described, or if it is
+/// affected by systematic variations.
+std::string MakeActionFingerprint(const std::string &actionName, const ColumnNames_t &columns,
+                                  const RNodeBase &prevNode, const RColumnRegister &colRegister)
+{
+   const auto upstream = prevNode.GetFingerprint();
+   if (upstream.empty() || !prevNode.GetVariations().empty())
+      return "";
+   const auto fingerprint = MakeOperationFingerprint(actionName, columns, colRegister);
+   return fingerprint.empty() ? "" : upstream + '\n' + fingerprint;
+}
+
+/// Build the key under which a jitted Filter or Define is shared with the identical ones booked before it: the
+/// upstream node (nullptr for Defines, which do not depend on it), the name, the jitted function and the nodes that
+/// produce the input columns. Return an empty key if the operation must not be shared: if it depends on systematic
+/// variations, or if it reads no column, as such expressions are typically not pure (e.g. random numbers).
+static std::string MakeSharedJittedNodeKey(const void *upstream, std::string_view name, const std::string &funcName,
+                                           const ColumnNames_t &usedCols, const RColumnRegister &colRegister)
+{
+   if (usedCols.empty() || !colRegister.GetVariationDeps(usedCols).empty())
+      return "";
+   std::string key = PrettyPrintAddr(upstream) + ' ' + std::string(name) + ' ' + funcName;
+   for (const auto &col : usedCols)
+      key += ' ' + col + '=' + PrettyPrintAddr(colRegister.GetDefine(col));
+   return key;
+}
+
 /// Book the jitting of a Filter call
 std::shared_ptr<RDFDetail::RJittedFilter>
 BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name, std::string_view expression,
@@ -653,14 +713,39 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   // Unnamed filters identical to one booked before on the same node are evaluated once: named filters are not
+   // shared, as each of them has its own line in the cut-flow report
+   // Expressions that read no column are typically not pure (e.g. random numbers): they are not described
+   const auto upstream = (*prevNodeOnHeap)->GetFingerprint();
+   const auto fingerprint =
+      upstream.empty() || parsedExpr.fUsedCols.empty()
+         ? ""
+         : MakeOperationFingerprint("Filter " + std::string(name) + ": " + std::string(expression),
+                                    parsedExpr.fUsedCols, colRegister);
+
+   auto *lm = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   const auto sharedKey = name.empty() && (*prevNodeOnHeap)->GetVariations().empty()
+                             ? MakeSharedJittedNodeKey(prevNodeOnHeap->get(), name, funcName, parsedExpr.fUsedCols,
+                                                       colRegister)
+                             : "";
+   if (!sharedKey.empty()) {
+      if (auto sharedFilter = lm->GetSharedJittedFilter(sharedKey).lock()) {
+         delete prevNodeOnHeap;
+         return sharedFilter;
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(colRegister);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
    const auto prevNodeAddr = PrettyPrintAddr(prevNodeOnHeap);
 
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
-      (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
-      Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+      lm, name, Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+   if (!sharedKey.empty())
+      lm->GetSharedJittedFilter(sharedKey) = jittedFilter;
+   if (!fingerprint.empty())
+      jittedFilter->SetFingerprint(upstream + '\n' + fingerprint);
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -682,7 +767,6 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
 
    return jittedFilter;
@@ -703,9 +787,25 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // Defines identical to one booked before compute the same values, wherever they are in the graph: share the node
+   const auto sharedKey = MakeSharedJittedNodeKey(nullptr, name, funcName, parsedExpr.fUsedCols, colRegister);
+   if (!sharedKey.empty()) {
+      if (auto sharedDefine = lm.GetSharedJittedDefine(sharedKey).lock()) {
+         delete upcastNodeOnHeap;
+         return sharedDefine;
+      }
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
+   if (!sharedKey.empty())
+      lm.GetSharedJittedDefine(sharedKey) = jittedDefine;
+   // Expressions that read no column are typically not pure (e.g. random numbers): they are not described
+   if (!parsedExpr.fUsedCols.empty()) {
+      const auto operation = "Define " + std::string(name) + ": " + std::string(expression);
+      jittedDefine->SetFingerprint(MakeOperationFingerprint(operation, parsedExpr.fUsedCols, colRegister));
+   }
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefineTag>(" << funcName
@@ -875,6 +975,129 @@ std::string JitBuildAction(const ColumnNames_t &cols, std::shared_ptr<RDFDetail:
    return createAction_str.str();
 }
 
+/// Make the code queued for jitting independent of the run: the addresses of the RDF objects, which follow an opening
+/// parenthesis, are replaced by the elements of the array rdfAddrs, and the jitted functions R_rdf::funcN are renamed
+/// R_rdf::fK in order of appearance. The addresses and the original names of the functions are returned.
+static std::string MakeJittedCodeRelocatable(const std::string &code, std::vector<std::size_t> &addresses,
+                                             std::vector<std::string> &funcNames)
+{
+   static const std::string kFuncPrefix = "R_rdf::func";
+   std::string result;
+   result.reserve(code.size());
+   bool inString = false;
+   std::size_t i = 0;
+   while (i < code.size()) {
+      const char c = code[i];
+      if (inString) {
+         result += c;
+         if (c == '\\' && i + 1 < code.size())
+            result += code[++i];
+         else if (c == '"')
+            inString = false;
+         ++i;
+      } else if (c == '"') {
+         inString = true;
+         result += c;
+         ++i;
+      } else if (c == '(' && code.compare(i + 1, 2, "0x") == 0) {
+         const auto end = code.find_first_not_of("0123456789abcdefABCDEF", i + 3);
+         const auto hex = code.substr(i + 3, end - i - 3);
+         addresses.push_back(std::stoull(hex, nullptr, 16));
+         result += "(rdfAddrs[" + std::to_string(addresses.size() - 1) + "]";
+         i = end;
+      } else if (code.compare(i, kFuncPrefix.size(), kFuncPrefix) == 0) {
+         auto end = code.find_first_not_of("0123456789", i + kFuncPrefix.size());
+         const auto name = code.substr(i, end - i);
+         auto it = std::find(funcNames.begin(), funcNames.end(), name);
+         if (it == funcNames.end())
+            it = funcNames.insert(funcNames.end(), name);
+         result += "R_rdf::f" + std::to_string(std::distance(funcNames.begin(), it));
+         i = end;
+      } else {
+         result += c;
+         ++i;
+      }
+   }
+   return result;
+}
+
+/// The shared library is compiled by ACLiC the first time that the same code is jitted with the same ROOT
+/// installation. The compilation fails if the code uses types or functions that were only declared to the
+/// interpreter; failed compilations are remembered, such that they are not attempted again.
+bool RunJittedCodeFromCache(const std::string &code, const std::string &cacheDir)
+{
+   R__LOCKGUARD(gROOTMutex);
+
+   std::vector<std::size_t> addresses;
+   std::vector<std::string> funcNames;
+   const auto relocatableCode = MakeJittedCodeRelocatable(code, addresses, funcNames);
+
+   std::string declarations;
+   for (std::size_t i = 0; i < funcNames.size(); ++i) {
+      const auto &exprMap = GetJittedExprs();
+      const auto it = std::find_if(exprMap.begin(), exprMap.end(),
+                                   [&](const std::pair<const std::string, std::string> &e) {
+                                      return e.second == funcNames[i];
+                                   });
+      if (it == exprMap.end())
+         return false;
+      declarations += "auto f" + std::to_string(i) + it->first + "\n";
+   }
+
+   // The key covers everything that the compiled code depends on
+   const std::string environment = std::string(gROOT->GetVersion()) + gROOT->GetGitCommit() +
+                                   gSystem->GetBuildCompilerVersion() + gSystem->GetIncludePath() +
+                                   gSystem->GetFlagsOpt();
+   const std::string keyInput = environment + '\n' + declarations + '\n' + relocatableCode;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyInput.data()), keyInput.size());
+   md5.Final();
+   const std::string key = std::string("rdf_jit_") + md5.AsString();
+
+   TString dir = cacheDir;
+   gSystem->ExpandPathName(dir);
+   const std::string base = std::string(dir.Data()) + "/" + key;
+   const std::string library = base + "." + gSystem->GetSoExt();
+   const std::string failedMarker = base + ".failed";
+   if (!gSystem->AccessPathName(failedMarker.c_str()))
+      return false;
+
+   if (gSystem->AccessPathName(library.c_str())) {
+      gSystem->mkdir(dir, /*recursive=*/true);
+      // Compile and rename into place under a name local to this process, other processes might share the cache
+      const std::string tmpSuffix = "_" + std::to_string(gSystem->GetPid());
+      const std::string source = base + tmpSuffix + ".C";
+      {
+         std::ofstream out(source);
+         out << "// Code jitted by RDataFrame, compiled ahead of time for the jitting cache\n"
+             << "#include \"ROOT/RDataFrame.hxx\"\n#include \"ROOT/RDF/InterfaceUtils.hxx\"\n#include <cstddef>\n"
+             << "namespace " << key << " {\nusing namespace std;\nnamespace R_rdf {\n"
+             << declarations << "}\nvoid Run(const std::size_t *rdfAddrs)\n{\n"
+             << relocatableCode << "\n}\n}\n"
+             << "extern \"C\" void " << key << "_run(const std::size_t *rdfAddrs)\n{\n   " << key
+             << "::Run(rdfAddrs);\n}\n";
+      }
+      const bool compiled = gSystem->CompileMacro(source.c_str(), "kOsc", (base + tmpSuffix).c_str());
+      const std::string tmpLibrary = base + tmpSuffix + "." + gSystem->GetSoExt();
+      if (!compiled || gSystem->Rename(tmpLibrary.c_str(), library.c_str()) != 0) {
+         R__LOG_INFO(RDFLogChannel()) << "The jitted code cannot be compiled for the jitting cache, it is jitted.";
+         std::ofstream marker(failedMarker);
+         gSystem->Unlink(tmpLibrary.c_str());
+         return false;
+      }
+   }
+
+   if (gSystem->Load(library.c_str()) < 0)
+      return false;
+   using Run_t = void (*)(const std::size_t *);
+   auto run = reinterpret_cast<Run_t>(gSystem->DynFindSymbol(library.c_str(), (key + "_run").c_str()));
+   if (!run)
+      return false;
+   R__LOG_INFO(RDFLogChannel()) << "Running the jitted code from the jitting cache " << library;
+   run(addresses.data());
+   return true;
+}
+
 bool AtLeastOneEmptyString(const std::vector<std::string_view> strings)
 {
    for (const auto &s : strings) {
@@ -20,12 +20,14 @@
 #include "TClass.h"
 #include "TClassEdit.h"
 #include "TClassRef.h"
+#include "TEnv.h"
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -312,11 +314,21 @@ std::vector<std::string> ReplaceDotWithUnderscore(const std::vector<std::string>
    return newColNames;
 }
 
+/// Return the `#pragma cling optimize` directive for the level set with RDataFrame.JitOptimizationLevel in .rootrc,
+/// or an empty string if it is not set and the interpreter's default optimization level is used.
+static std::string GetJitOptimizationPragma()
+{
+   const int level = gEnv->GetValue("RDataFrame.JitOptimizationLevel", -1);
+   if (level < 0)
+      return "";
+   return "#pragma cling optimize(" + std::to_string(std::min(level, 3)) + ")\n";
+}
+
 void InterpreterDeclare(const std::string &code)
 {
    R__LOG_DEBUG(10, RDFLogChannel()) << "Declaring the following code to cling:\n\n" << code << '\n';
 
-   if (!gInterpreter->Declare(code.c_str())) {
+   if (!gInterpreter->Declare((GetJitOptimizationPragma() + code).c_str())) {
       const auto msg =
          "\nRDataFrame: An error occurred during just-in-time compilation. The lines above might indicate the cause of "
          "the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid state.\n";
@@ -330,8 +342,9 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
 
    TInterpreter::EErrorCode errorCode(TInterpreter::kNoError); // storage for cling errors
 
-   auto callCalc = [&errorCode, &context](const std::string &codeSlice) {
-      gInterpreter->Calc(codeSlice.c_str(), &errorCode);
+   const auto optPragma = GetJitOptimizationPragma();
+   auto callCalc = [&errorCode, &context, &optPragma](const std::string &codeSlice) {
+      gInterpreter->Calc((optPragma + codeSlice).c_str(), &errorCode);
       if (errorCode != TInterpreter::EErrorCode::kNoError) {
          std::string msg = "\nAn error occurred during just-in-time compilation";
          if (!context.empty())
@@ -9,6 +9,7 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
@@ -48,3 +49,11 @@ std::string RDefineBase::GetTypeName() const
 {
    return fType;
 }
+
+void RDefineBase::SetProfiler(RDFInternal::RGraphProfiler *profiler)
+{
+   fProfiler = profiler;
+   if (profiler != nullptr)
+      fProfilerNode =
+         profiler->RegisterNode(RDFInternal::RGraphProfiler::MakeLabel("Define " + fName, fColumnNames, fVariation));
+}
@@ -11,8 +11,14 @@
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/Utils.hxx"
-#include <numeric> // std::accumulate
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric> // std::accumulate, std::iota
 
 using namespace ROOT::Detail::RDF;
 
@@ -60,4 +66,77 @@ void RFilterBase::InitNode()
 {
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
+
+   // In adaptive mode, an unnamed filter evaluates itself together with the unnamed filters directly upstream.
+   // Named filters, and the nodes that are not filters, delimit the chains; they are evaluated in booking order.
+   fChain.clear();
+   fChainStats.clear();
+   if (!fLoopManager->GetFilterReordering() || !fName.empty())
+      return;
+   fChain.push_back(this);
+   fChainUpstream = GetPrevNode();
+   for (auto *prev = dynamic_cast<RFilterBase *>(fChainUpstream); prev && !prev->HasName();
+        prev = dynamic_cast<RFilterBase *>(fChainUpstream)) {
+      fChain.push_back(prev);
+      fChainUpstream = prev->GetPrevNode();
+   }
+   if (fChain.size() < 2) {
+      fChain.clear();
+      return;
+   }
+   // booking order, from the most upstream filter
+   std::reverse(fChain.begin(), fChain.end());
+   RChainStats stats;
+   stats.fOrder.resize(fChain.size());
+   std::iota(stats.fOrder.begin(), stats.fOrder.end(), 0);
+   stats.fCost.resize(fChain.size());
+   stats.fNRejected.resize(fChain.size());
+   fChainStats.assign(fLoopManager->GetNSlots(), stats);
+}
+
+void RFilterBase::SetProfiler(RDFInternal::RGraphProfiler *profiler)
+{
+   fProfiler = profiler;
+   if (profiler != nullptr)
+      fProfilerNode = profiler->RegisterNode(
+         RDFInternal::RGraphProfiler::MakeLabel(HasName() ? "Filter " + fName : "Filter", fColumnNames, fVariation));
+}
+
+/// Check the upstream node, then the chain of filters. During the first entries processed by each slot, all the
+/// filters of the chain are evaluated and timed. Then they are evaluated in increasing order of cost per rejected
+/// entry, and the evaluation stops at the first filter that rejects the entry.
+bool RFilterBase::CheckFilterChain(unsigned int slot, Long64_t entry)
+{
+   constexpr ULong64_t kNLearningEntries = 1000;
+
+   if (!fChainUpstream->CheckFilters(slot, entry))
+      return false;
+
+   auto &stats = fChainStats[slot];
+   if (stats.fNLearned < kNLearningEntries) {
+      bool passed = true;
+      for (std::size_t i = 0; i < fChain.size(); ++i) {
+         const auto start = std::chrono::steady_clock::now();
+         const bool passedThis = fChain[i]->EvalFilter(slot, entry);
+         stats.fCost[i] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+         if (!passedThis) {
+            ++stats.fNRejected[i];
+            passed = false;
+         }
+      }
+      if (++stats.fNLearned == kNLearningEntries) {
+         auto costPerRejection = [&stats](std::size_t i) {
+            return stats.fNRejected[i] == 0 ? std::numeric_limits<double>::max() : stats.fCost[i] / stats.fNRejected[i];
+         };
+         std::stable_sort(stats.fOrder.begin(), stats.fOrder.end(),
+                          [&](std::size_t a, std::size_t b) { return costPerRejection(a) < costPerRejection(b); });
+      }
+      return passed;
+   }
+
+   for (const auto i : stats.fOrder) {
+      if (!fChain[i]->EvalFilter(slot, entry))
+         return false;
+   }
+   return true;
 }
@@ -0,0 +1,191 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RGraphProfiler.hxx"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <numeric>
+#include <sstream>
+
+using ROOT::Internal::RDF::RGraphProfiler;
+
+namespace {
+/// Frames are separated by semicolons in the collapsed stacks
+std::string ToStackLabel(std::string label)
+{
+   std::replace(label.begin(), label.end(), ';', ',');
+   return label;
+}
+} // anonymous namespace
+
+RGraphProfiler::RGraphProfiler(unsigned int nSlots)
+{
+   fSlots.reserve(nSlots);
+   for (unsigned int i = 0; i < nSlots; ++i)
+      fSlots.emplace_back(std::make_unique<RSlotProfile>());
+   Reset();
+}
+
+void RGraphProfiler::Reset()
+{
+   fLabels = {"Load entry"};
+   fColumnReadNodes.clear();
+   for (auto &slot : fSlots) {
+      slot->fFrames.clear();
+      slot->fFrames.emplace_back(/*node*/ kEntryLoadNode); // the root, its node is not used
+      slot->fStack.clear();
+   }
+}
+
+unsigned int RGraphProfiler::RegisterNode(const std::string &label)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fLabels.emplace_back(label);
+   return fLabels.size() - 1;
+}
+
+unsigned int RGraphProfiler::RegisterColumnRead(const std::string &column)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto it = fColumnReadNodes.find(column);
+   if (it == fColumnReadNodes.end()) {
+      fLabels.emplace_back("Read " + column);
+      it = fColumnReadNodes.emplace(column, fLabels.size() - 1).first;
+   }
+   return it->second;
+}
+
+std::string RGraphProfiler::MakeLabel(const std::string &label, const std::vector<std::string> &columns,
+                                      const std::string &variation)
+{
+   std::string result = label + '(';
+   for (std::size_t i = 0; i < columns.size(); ++i)
+      result += (i > 0 ? ", " : "") + columns[i];
+   result += ')';
+   if (variation != "nominal")
+      result += " [" + variation + ']';
+   return result;
+}
+
+void RGraphProfiler::Enter(unsigned int slot, unsigned int node)
+{
+   auto &profile = *fSlots[slot];
+   const auto parent = profile.fStack.empty() ? 0 : profile.fStack.back().fFrame;
+   const auto &children = profile.fFrames[parent].fChildren;
+   auto it = std::find_if(children.begin(), children.end(),
+                          [&](std::size_t child) { return profile.fFrames[child].fNode == node; });
+   std::size_t frame;
+   if (it != children.end()) {
+      frame = *it;
+   } else {
+      frame = profile.fFrames.size();
+      profile.fFrames.emplace_back(node);
+      profile.fFrames[parent].fChildren.push_back(frame);
+   }
+   profile.fStack.push_back({frame, Clock_t::now(), 0});
+}
+
+void RGraphProfiler::Exit(unsigned int slot)
+{
+   const auto end = Clock_t::now();
+   auto &profile = *fSlots[slot];
+   const auto active = profile.fStack.back();
+   profile.fStack.pop_back();
+   const ULong64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - active.fStart).count();
+   auto &frame = profile.fFrames[active.fFrame];
+   ++frame.fNCalls;
+   frame.fTotalTime += elapsed;
+   frame.fSelfTime += elapsed - std::min(elapsed, active.fCalleeTime);
+   if (!profile.fStack.empty())
+      profile.fStack.back().fCalleeTime += elapsed;
+}
+
+std::vector<RGraphProfiler::RNodeProfile> RGraphProfiler::GetNodeProfiles() const
+{
+   const auto nSlots = fSlots.size();
+   std::vector<RNodeProfile> nodes(fLabels.size());
+   for (std::size_t i = 0; i < nodes.size(); ++i)
+      nodes[i] = {fLabels[i], std::vector<ULong64_t>(nSlots), std::vector<ULong64_t>(nSlots),
+                  std::vector<ULong64_t>(nSlots)};
+   for (std::size_t slot = 0; slot < nSlots; ++slot) {
+      const auto &frames = fSlots[slot]->fFrames;
+      // a node cannot be evaluated from itself, so the total times of its paths do not overlap
+      for (std::size_t i = 1; i < frames.size(); ++i) {
+         auto &node = nodes[frames[i].fNode];
+         node.fNCalls[slot] += frames[i].fNCalls;
+         node.fSelfTime[slot] += frames[i].fSelfTime;
+         node.fTotalTime[slot] += frames[i].fTotalTime;
+      }
+   }
+
+   auto sum = [](const std::vector<ULong64_t> &v) { return std::accumulate(v.begin(), v.end(), ULong64_t(0)); };
+   nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [&](const RNodeProfile &n) { return sum(n.fNCalls) == 0; }),
+               nodes.end());
+   std::stable_sort(nodes.begin(), nodes.end(), [&](const RNodeProfile &a, const RNodeProfile &b) {
+      return sum(a.fSelfTime) > sum(b.fSelfTime);
+   });
+   return nodes;
+}
+
+std::string RGraphProfiler::GetReport() const
+{
+   const auto nodes = GetNodeProfiles();
+   auto sum = [](const std::vector<ULong64_t> &v) { return std::accumulate(v.begin(), v.end(), ULong64_t(0)); };
+   ULong64_t totalSelfTime = 0;
+   std::size_t labelWidth = 4;
+   for (const auto &node : nodes) {
+      totalSelfTime += sum(node.fSelfTime);
+      labelWidth = std::max(labelWidth, node.fLabel.size());
+   }
+
+   std::ostringstream os;
+   char line[256];
+   os << "Node" << std::string(labelWidth - 4, ' ');
+   std::snprintf(line, sizeof(line), " %12s %12s %7s %12s %14s %15s\n", "Calls", "Self [s]", "Self %", "Total [s]",
+                 "Calls/s", "Max slot [s]");
+   os << line;
+   for (const auto &node : nodes) {
+      const double selfTime = sum(node.fSelfTime) * 1e-9;
+      const double totalTime = sum(node.fTotalTime) * 1e-9;
+      const auto nCalls = sum(node.fNCalls);
+      // the self time of the busiest slot shows whether the work is balanced between the slots
+      const double maxSlotSelfTime = *std::max_element(node.fSelfTime.begin(), node.fSelfTime.end()) * 1e-9;
+      os << node.fLabel << std::string(labelWidth - node.fLabel.size(), ' ');
+      std::snprintf(line, sizeof(line), " %12llu %12.6f %6.1f%% %12.6f %14.4g %15.6f\n", nCalls, selfTime,
+                    totalSelfTime > 0 ? 100. * sum(node.fSelfTime) / totalSelfTime : 0., totalTime,
+                    totalTime > 0 ? nCalls / totalTime : 0., maxSlotSelfTime);
+      os << line;
+   }
+   return os.str();
+}
+
+void RGraphProfiler::AddStacks(const RSlotProfile &slot, std::size_t frame, const std::string &stack,
+                               std::unordered_map<std::string, ULong64_t> &stacks) const
+{
+   for (const auto child : slot.fFrames[frame].fChildren) {
+      const auto &childFrame = slot.fFrames[child];
+      const auto childStack = stack + ';' + ToStackLabel(fLabels[childFrame.fNode]);
+      stacks[childStack] += childFrame.fSelfTime;
+      AddStacks(slot, child, childStack, stacks);
+   }
+}
+
+std::string RGraphProfiler::GetStacks() const
+{
+   std::unordered_map<std::string, ULong64_t> stacks;
+   for (const auto &slot : fSlots)
+      AddStacks(*slot, 0, "RDataFrame", stacks);
+
+   std::map<std::string, ULong64_t> sortedStacks(stacks.begin(), stacks.end());
+   std::ostringstream os;
+   for (const auto &stack : sortedStacks)
+      os << stack.first << ' ' << stack.second << '\n';
+   return os.str();
+}
@@ -21,6 +21,7 @@
 #include <memory>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <unordered_set>
 
@@ -384,6 +385,208 @@ unsigned int ROOT::RDF::RInterfaceBase::GetNRuns() const
    return fLoopManager->GetNRuns();
 }
 
+/// \brief Process several entries at a time in the following event loops (experimental).
+/// \param[in] bulkSize The number of entries that are processed together; 1, the default, disables bulk processing.
+///
+/// In bulk processing mode, the event loop processes ranges of bulkSize entries: each Filter is evaluated for all the
+/// entries of a range, then the actions process the entries that passed. The values of the defined columns are
+/// computed once per entry and kept for the whole range. This reduces the per-entry overhead of the computation
+/// graph for analyses with lightweight expressions, at the cost of keeping bulkSize values per defined column.
+/// The results are the same as in the default mode, but Filter and Define expressions are called in a different
+/// order, which matters only if they have side effects.
+///
+/// With Vary, the expression of a variation computes all the variations of each entry once for the whole range, the
+/// filters of each universe are checked once for the range and the nodes that do not depend on a variation are
+/// shared with the nominal universe. Varied actions then process the entries of the range one variation after the
+/// other, which is typically faster than processing all the variations of each entry in turn for many variations.
+///
+/// The setting applies to the whole computation graph. It is currently honored only by RDataFrames that generate
+/// their entries, i.e. `RDataFrame(nEntries)`, and that do not use Range; it is ignored otherwise.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df(1000000);
+/// df.SetBulkSize(256);
+/// auto h = df.Define("x", [] { return gRandom->Gaus(); }).Filter("x > 0").Histo1D("x");
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetBulkSize(unsigned int bulkSize)
+{
+   fLoopManager->SetBulkSize(bulkSize);
+}
+
+/// \brief Allocate the temporary RVecs of the Define expressions in per-slot arenas (experimental).
+/// \param[in] use Whether the arenas are used; by default the RVecs allocate their buffers on the heap.
+///
+/// Define expressions that compute an RVec often create several temporary RVecs per entry, e.g. `pt[eta > 0] * 2`.
+/// With this setting, the buffers of the RVecs created while a Define expression returning an RVec runs are taken from
+/// a bump allocator of the processing slot, which is recycled at once when the evaluation ends; the returned value is
+/// copied into the value of the defined column, which stays on the heap and reuses its buffer from entry to entry.
+///
+/// Define expressions must then not keep the RVecs they create beyond their evaluation, e.g. in static variables or
+/// in the captures of a lambda. The setting applies to the whole computation graph, in the following event loops.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("Events", "file.root");
+/// df.SetRVecArenas();
+/// auto h = df.Define("good_pt", "Muon_pt[Muon_eta > 0] * 2").Histo1D("good_pt");
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetRVecArenas(bool use)
+{
+   fLoopManager->SetRVecArenas(use);
+}
+
+/// \brief Reorder chains of unnamed filters adaptively in the following event loops (experimental).
+/// \param[in] reorder Whether the filters are reordered; by default they are evaluated in booking order.
+///
+/// In this mode, consecutive unnamed Filters are evaluated as a group. During the first 1000 entries processed by each
+/// slot, all the filters of the group are evaluated for every entry, and their cost and rejection rate are measured.
+/// Then they are evaluated from the cheapest per rejected entry to the most expensive one, stopping at the first one
+/// that rejects the entry. As the values of defined columns are only computed when they are read, the Defines used
+/// only by the filters that are skipped are not computed either.
+///
+/// The filters of a group must be independent of each other and free of side effects: a filter that protects the
+/// evaluation of the following one, e.g. `Filter("v.size() > 0").Filter("v[0] > 1")`, must not be used in this mode.
+/// Named filters and Range calls delimit the groups and are evaluated in booking order, so cut-flow reports are not
+/// affected.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// df.SetFilterReordering();
+/// auto h = df.Filter("nJet > 2").Filter("ExpensiveSelection(jets)").Filter("met > 50").Histo1D("met");
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetFilterReordering(bool reorder)
+{
+   fLoopManager->SetFilterReordering(reorder);
+}
+
+/// \brief Store the results of the following event loops in a file, and read them back instead of recomputing them.
+/// \param[in] fileName The name of the ROOT file that stores the results; it is created if it does not exist.
+///
+/// When the event loop is about to start, the results of the booked actions are looked up in the file, under a key
+/// that describes the dataset (the names and UUIDs of its files and the entry range) and the computation graph that
+/// produces the result (the expressions of the Filters and Defines upstream of the action, the Range calls, the input
+/// columns of the action and the initial state of its result, e.g. the binning of a histogram). The results that are
+/// found are not recomputed; if all of them are found, no event loop is run. The results computed by the event loop
+/// are then stored in the file, so that later processes running the same analysis on the same dataset can reuse them.
+///
+/// Only the results of Count, Sum, Mean, StdDev, Min, Max, and of the histogram, profile and graph actions can be
+/// cached, and only if their whole computation graph is described by strings, i.e. uses only jitted Filters and
+/// Defines and dataset columns. Results that depend on functions or lambdas passed to Filter and Define, on `rdfslot_`,
+/// on DefinePerSample, on Vary or on friend trees, and results obtained from data sources, are always recomputed.
+/// Functions called by the jitted expressions are identified by their name only: the cache must be removed when they
+/// change. OnPartialResult callbacks are only called for the results that are recomputed.
+///
+/// The setting applies to the actions booked after this call, in the whole computation graph.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// df.SetResultCache("results.root");
+/// auto h = df.Filter("nJet > 2").Define("ht", "Sum(jet_pt)").Histo1D({"h", "h", 100, 0., 1000.}, "ht");
+/// h->Draw(); // the first process runs the event loop, the following ones read h from results.root
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetResultCache(std::string_view fileName)
+{
+   fLoopManager->SetResultCache(std::string(fileName));
+}
+
+/// \brief Measure the time spent in each node of the computation graph in the following event loops (experimental).
+/// \param[in] profile Whether the event loops are profiled; by default they are not.
+///
+/// In this mode, each evaluation of the Filters, Defines, Vary expressions and actions of the whole computation graph
+/// is timed in each processing slot, as well as the reading of the dataset columns and the loading of the entries, so
+/// that the time spent waiting for I/O can be told apart from the time spent computing. As the values of the defined
+/// columns are computed when they are first read, the time of a node is split between its self time, spent in its own
+/// code, and the time of the nodes it evaluated, e.g. the Define computed for an action, or the column read for the
+/// Define. Profiling costs about two reads of the clock per evaluation, which may be significant for trivial nodes.
+///
+/// The measurements of the last profiled event loop are returned by GetProfileReport(), as a table of the nodes, and by
+/// GetProfileStacks(), in a format that flame graph tools can draw.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("Events", "file.root");
+/// df.SetProfiling();
+/// auto h = df.Filter("nMuon > 1").Define("pt2", "Muon_pt[0] * Muon_pt[0]").Histo1D("pt2");
+/// h->Draw();
+/// std::cout << df.GetProfileReport();
+/// std::ofstream("profile.folded") << df.GetProfileStacks(); // then e.g. `flamegraph.pl profile.folded > out.svg`
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetProfiling(bool profile)
+{
+   fLoopManager->SetProfiling(profile);
+}
+
+/// \brief Return the time spent in each node of the computation graph by the last profiled event loop.
+///
+/// The table lists, for each node, its number of evaluations, its self time, i.e. excluding the time of the nodes it
+/// evaluated, its share of the total self time, its total time, its throughput in evaluations per second of total time,
+/// and the self time of the slot that spent the most time in it, which shows how balanced the slots are. The nodes are
+/// listed from the largest self time to the smallest. `Read x` nodes are the reads of the dataset column x, and
+/// `Load entry` is the loading of the entries by the TTreeReader or the data source.
+/// See SetProfiling().
+std::string ROOT::RDF::RInterfaceBase::GetProfileReport() const
+{
+   const auto *profiler = fLoopManager->GetProfiler();
+   if (profiler == nullptr)
+      throw std::runtime_error("GetProfileReport: no event loop was profiled, see SetProfiling.");
+   return profiler->GetReport();
+}
+
+/// \brief Return the time spent in the nodes of the computation graph by the last profiled event loop, per path.
+///
+/// Each line is a path of nodes through which a node was evaluated, separated by semicolons, followed by the self time
+/// spent in the last node of the path, in nanoseconds, summed over the processing slots, e.g.
+/// `RDataFrame;TH1D pt2(pt2);Define pt2(Muon_pt);Read Muon_pt 1234`. This is the "collapsed stacks" format of flame
+/// graph tools such as flamegraph.pl, speedscope or inferno. See SetProfiling().
+std::string ROOT::RDF::RInterfaceBase::GetProfileStacks() const
+{
+   const auto *profiler = fLoopManager->GetProfiler();
+   if (profiler == nullptr)
+      throw std::runtime_error("GetProfileStacks: no event loop was profiled, see SetProfiling.");
+   return profiler->GetStacks();
+}
+
+/// \brief Limit the memory of the caches, buffers and partial results during the following event loops (experimental).
+/// \param[in] bytes The limit in bytes; 0, the default, for no limit.
+///
+/// The memory is tracked by the process-wide ROOT::Experimental::RMemoryBudget, which accounts for the clusters
+/// prefetched by the RNTuple readers, the TTreeCache buffers, the queue of TBufferMerger, the per-slot copies of the
+/// histograms filled by the actions and the vectors collected by Take. When the tracked memory exceeds three quarters
+/// of the limit, the readers prefetch less ahead and TBufferMerger merges its queue eagerly. The limit is soft:
+/// allocations never fail because of it, but a warning is issued if the peak of the event loop exceeded it.
+///
+/// As the budget is shared by the whole process, the limit also applies to the other readers of the process while the
+/// event loop runs, e.g. an RNTupleReader used in an action.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("Events", "file.root");
+/// df.SetMemoryLimit(2ull << 30); // 2 GB
+/// auto h = df.Histo1D("Muon_pt");
+/// h->Draw();
+/// std::cout << df.GetMemoryReport();
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetMemoryLimit(std::uint64_t bytes)
+{
+   fLoopManager->SetMemoryLimit(bytes);
+}
+
+/// \brief Return the current and peak memory of each component tracked by the last event loop.
+///
+/// The peaks are measured from the start of the event loop to the end of the processing of the entries, before the
+/// partial results of the slots are merged. The sizes of the histograms are estimated from their number of bins.
+/// See SetMemoryLimit().
+std::string ROOT::RDF::RInterfaceBase::GetMemoryReport() const
+{
+   const auto &report = fLoopManager->GetMemoryReport();
+   if (report.empty())
+      throw std::runtime_error("GetMemoryReport: no event loop was run.");
+   return report;
+}
+
 ROOT::RDF::ColumnNames_t ROOT::RDF::RInterfaceBase::GetColumnTypeNamesList(const ColumnNames_t &columnList)
 {
    std::vector<std::string> types;
@@ -413,6 +616,7 @@ void ROOT::RDF::RInterfaceBase::AddDefaultColumns()
 
    auto entryColumn = std::make_shared<NewColEntry_t>(entryColName, entryColType, std::move(entryColGen),
                                                       ColumnNames_t{}, fColRegister, *fLoopManager);
+   entryColumn->SetFingerprint(entryColName);
    fColRegister.AddDefine(std::move(entryColumn));
 
    // Slot number column
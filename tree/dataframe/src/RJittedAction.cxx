@@ -73,6 +73,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, RMaskedEntryRange &mask)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, mask);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
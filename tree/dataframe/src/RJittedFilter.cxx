@@ -59,6 +59,24 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+bool RJittedFilter::EvalFilter(unsigned int slot, Long64_t entry)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->EvalFilter(slot, entry);
+}
+
+RNodeBase *RJittedFilter::GetPrevNode()
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetPrevNode();
+}
+
+void RJittedFilter::CheckFiltersBulk(unsigned int slot, ROOT::Internal::RDF::RMaskedEntryRange &mask)
+{
+   assert(fConcreteFilter != nullptr);
+   fConcreteFilter->CheckFiltersBulk(slot, mask);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -40,6 +40,18 @@ void RJittedVariation::Update(unsigned int slot, Long64_t entry)
    fConcreteVariation->Update(slot, entry);
 }
 
+void *RJittedVariation::UpdateAndGetValuePtr(unsigned int slot, std::size_t colIdx, std::size_t varIdx, Long64_t entry)
+{
+   assert(fConcreteVariation != nullptr);
+   return fConcreteVariation->UpdateAndGetValuePtr(slot, colIdx, varIdx, entry);
+}
+
+void RJittedVariation::SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t size)
+{
+   assert(fConcreteVariation != nullptr);
+   fConcreteVariation->SetBulkRange(slot, firstEntry, size);
+}
+
 void RJittedVariation::FinalizeSlot(unsigned int slot)
 {
    assert(fConcreteVariation != nullptr);
@@ -13,19 +13,25 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RGraphProfiler.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RMemoryBudget.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TChain.h"
 #include "TEntryList.h"
+#include "TEnv.h"
+#include "TError.h"
 #include "TFile.h"
 #include "TFriendElement.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
 
@@ -39,6 +45,7 @@
 #include <atomic>
 #include <cassert>
 #include <functional>
+#include <iterator>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -46,6 +53,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -59,12 +67,33 @@ namespace {
 /// We want RLoopManagers to be able to add their code to a global "code to execute via cling",
 /// so that, lazily, we can jit everything that's needed by all RDFs in one go, which is potentially
 /// much faster than jitting each RLoopManager's code separately.
-static std::string &GetCodeToJit()
+/// The code is stored together with the RLoopManager that booked it, in booking order, so that the code of a single
+/// computation graph can also be jitted on its own (see RLoopManager::JitOwnCode()).
+static std::vector<std::pair<const RLoopManager *, std::string>> &GetCodeToJit()
 {
-   static std::string code;
+   static std::vector<std::pair<const RLoopManager *, std::string>> code;
    return code;
 }
 
+/// Jit and execute the code, through the jitting cache if one is configured.
+static void JitAndRun(const std::string &code)
+{
+   if (code.empty()) {
+      R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
+      return;
+   }
+
+   TStopwatch s;
+   s.Start();
+   const std::string cacheDir = gEnv->GetValue("RDataFrame.JitCacheDir", "");
+   if (cacheDir.empty() || !RDFInternal::RunJittedCodeFromCache(code, cacheDir))
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   s.Stop();
+   R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
+                                << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
+                                                        : " in less than 1ms.");
+}
+
 static bool ContainsLeaf(const std::set<TLeaf *> &leaves, TLeaf *leaf)
 {
    return (leaves.find(leaf) != leaves.end());
@@ -248,6 +277,29 @@ struct MaxTreeSizeRAII {
    ~MaxTreeSizeRAII() { TTree::SetMaxTreeSize(fOldMaxTreeSize); }
 };
 
+/**
+\struct MemoryLimitRAII
+\brief Scope-bound limit of the memory tracked by the ROOT::Experimental::RMemoryBudget, if one is given.
+*/
+struct MemoryLimitRAII {
+   using RMemoryBudget = ROOT::Experimental::RMemoryBudget;
+   std::uint64_t fOldLimit;
+   bool fIsActive;
+
+   explicit MemoryLimitRAII(std::uint64_t limit) : fOldLimit(RMemoryBudget::GetLimit()), fIsActive(limit > 0)
+   {
+      if (fIsActive)
+         RMemoryBudget::SetLimit(limit);
+      RMemoryBudget::ResetPeaks();
+   }
+
+   ~MemoryLimitRAII()
+   {
+      if (fIsActive)
+         RMemoryBudget::SetLimit(fOldLimit);
+   }
+};
+
 struct DatasetLogInfo {
    std::string fDataSet;
    ULong64_t fRangeStart;
@@ -307,6 +359,20 @@ static auto MakeDatasetColReadersKey(const std::string &colName, const std::type
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+
+/// Move the reader to the next entry, timing it if the event loop is profiled
+bool NextEntry(TTreeReader &r, RGraphProfiler *profiler, unsigned int slot)
+{
+   RProfileScope profile(profiler, slot, RGraphProfiler::kEntryLoadNode);
+   return r.Next();
+}
+
+/// Move the data source to the given entry, timing it if the event loop is profiled
+bool SetDataSourceEntry(ROOT::RDF::RDataSource &ds, RGraphProfiler *profiler, unsigned int slot, ULong64_t entry)
+{
+   RProfileScope profile(profiler, slot, RGraphProfiler::kEntryLoadNode);
+   return ds.SetEntry(slot, entry);
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -456,8 +522,14 @@ void RLoopManager::RunEmptySourceMT()
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (fRunBulk) {
+            for (auto currEntry = range.first; currEntry < range.second; currEntry += fBulkSize) {
+               RunAndCheckFiltersBulk(slot, currEntry, std::min<ULong64_t>(fBulkSize, range.second - currEntry));
+            }
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -480,8 +552,15 @@ void RLoopManager::RunEmptySource()
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/0, {0, fNEmptyEntries});
-      for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (fRunBulk) {
+         for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren;
+              currEntry += fBulkSize) {
+            RunAndCheckFiltersBulk(0, currEntry, std::min<ULong64_t>(fBulkSize, fNEmptyEntries - currEntry));
+         }
+      } else {
+         for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -512,9 +591,10 @@ void RLoopManager::RunTreeProcessorMT()
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
       auto count = entryCount.fetch_add(nEntries);
+      auto *profiler = GetActiveProfiler();
       try {
          // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
+         while (NextEntry(r, profiler, slot)) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
                UpdateSampleInfo(slot, r);
             }
@@ -554,8 +634,9 @@ void RLoopManager::RunTreeReader()
 
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
+   auto *profiler = GetActiveProfiler();
    try {
-      while (r.Next() && fNStopsReceived < fNChildren) {
+      while (NextEntry(r, profiler, 0u) && fNStopsReceived < fNChildren) {
          if (fNewSampleNotifier.CheckFlag(0)) {
             UpdateSampleInfo(/*slot*/0, r);
          }
@@ -578,6 +659,7 @@ void RLoopManager::RunDataSource()
    assert(fDataSource != nullptr);
    fDataSource->CallInitialize();
    auto ranges = fDataSource->GetEntryRanges();
+   auto *profiler = GetActiveProfiler();
    while (!ranges.empty() && fNStopsReceived < fNChildren) {
       InitNodeSlots(nullptr, 0u);
       fDataSource->InitSlot(0u, 0ull);
@@ -588,7 +670,7 @@ void RLoopManager::RunDataSource()
             const auto end = range.second;
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
+               if (SetDataSourceEntry(*fDataSource, profiler, 0u, entry)) {
                   RunAndCheckFilters(0u, entry);
                }
             }
@@ -621,9 +703,10 @@ void RLoopManager::RunDataSourceMT()
       const auto start = range.first;
       const auto end = range.second;
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
+      auto *profiler = GetActiveProfiler();
       try {
          for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
+            if (SetDataSourceEntry(*fDataSource, profiler, slot, entry)) {
                RunAndCheckFilters(slot, entry);
             }
          }
@@ -649,20 +732,68 @@ void RLoopManager::RunDataSourceMT()
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
    // data-block callbacks run before the rest of the graph
-   if (fNewSampleNotifier.CheckFlag(slot)) {
-      for (auto &callback : fSampleCallbacks)
-         callback.second(slot, fSampleInfos[slot]);
-      fNewSampleNotifier.UnsetFlag(slot);
-   }
+   RunSampleCallbacks(slot);
 
-   for (auto &actionPtr : fBookedActions)
+   auto *profiler = GetActiveProfiler();
+   for (auto &actionPtr : fBookedActions) {
+      RProfileScope profile(profiler, slot, actionPtr->GetProfilerNode());
       actionPtr->Run(slot, entry);
+   }
    for (auto &namedFilterPtr : fBookedNamedFilters)
       namedFilterPtr->CheckFilters(slot, entry);
    for (auto &callback : fCallbacks)
       callback(slot);
 }
 
+/// Bulk processing counterpart of RunAndCheckFilters: process the size entries starting at firstEntry together.
+/// Each action asks its upstream filters for the mask of the entries it has to process; the filters evaluate their
+/// expression for the whole range and cache the result, the Defines keep the values of all the entries of the range.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t size)
+{
+   RunSampleCallbacks(slot);
+
+   for (auto *definePtr : fBookedDefines)
+      definePtr->SetBulkRange(slot, firstEntry, size);
+   for (auto *variationPtr : fBookedVariations)
+      variationPtr->SetBulkRange(slot, firstEntry, size);
+
+   auto &mask = fBulkMasks[slot];
+   auto *profiler = GetActiveProfiler();
+   for (auto &actionPtr : fBookedActions) {
+      mask.Reset(firstEntry, size);
+      RProfileScope profile(profiler, slot, actionPtr->GetProfilerNode());
+      actionPtr->RunBulk(slot, mask);
+   }
+   for (auto &namedFilterPtr : fBookedNamedFilters) {
+      mask.Reset(firstEntry, size);
+      namedFilterPtr->CheckFiltersBulk(slot, mask);
+   }
+   // the callbacks count the entries they are called for
+   for (std::size_t i = 0; i < size; ++i) {
+      for (auto &callback : fCallbacks)
+         callback(slot);
+   }
+}
+
+/// Run the data-block callbacks if a new data block started.
+void RLoopManager::RunSampleCallbacks(unsigned int slot)
+{
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+}
+
+/// Whether the event loop can run in bulk processing mode.
+/// Only the entries of an empty source can be visited in any order: TTree and data source readers only provide the
+/// values of the current entry. Ranges count the entries in the order they are checked.
+bool RLoopManager::CanRunBulk() const
+{
+   return fBulkSize > 1 && (fLoopType == ELoopType::kNoFiles || fLoopType == ELoopType::kNoFilesMT) &&
+          fBookedRanges.empty();
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
@@ -732,6 +863,187 @@ void RLoopManager::InitNodes()
       range->InitNode();
    for (auto &ptr : fBookedActions)
       ptr->Initialize();
+   InitProfiler();
+}
+
+/// Register the nodes of the graph with the profiler at the beginning of a profiled event loop, or stop timing them
+/// if the event loop is not profiled.
+void RLoopManager::InitProfiler()
+{
+   auto *profiler = GetActiveProfiler();
+   if (profiler != nullptr)
+      profiler->Reset();
+   for (auto *filter : fBookedFilters)
+      filter->SetProfiler(profiler);
+   for (auto *define : fBookedDefines)
+      define->SetProfiler(profiler);
+   for (auto *variation : fBookedVariations)
+      variation->SetProfiler(profiler);
+   if (profiler == nullptr)
+      return;
+
+   std::unordered_map<void *, std::shared_ptr<GraphDrawing::GraphNode>> visitedMap;
+   for (auto *action : fBookedActions) {
+      // the names of the graph nodes are split on several lines, e.g. "TH1D\\nh" for a histogram named h
+      auto name = action->GetGraph(visitedMap)->GetName();
+      for (auto pos = name.find("\\n"); pos != std::string::npos; pos = name.find("\\n", pos))
+         name.replace(pos, 2, " ");
+      action->SetProfilerNode(profiler->RegisterNode(RGraphProfiler::MakeLabel(name, action->GetColumnNames())));
+   }
+
+   // The tree column readers are created by each task, see AddTreeColumnReader, while the data source column readers
+   // are created when the graph is booked and are kept from one event loop to the next
+   if (!fDataSource)
+      return;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      for (auto &reader : fDatasetColumnReaders[slot]) {
+         if (!reader.second)
+            continue;
+         // the keys are made of the column name and of the mangled name of the type, see MakeDatasetColReadersKey
+         const auto node = profiler->RegisterColumnRead(reader.first.substr(0, reader.first.rfind(':')));
+         if (auto *profiledReader = dynamic_cast<RProfiledColumnReader *>(reader.second.get()))
+            profiledReader->SetNode(node);
+         else
+            reader.second = std::make_unique<RProfiledColumnReader>(std::move(reader.second), *profiler, slot, node);
+      }
+   }
+}
+
+/// Tell the data source which of its columns are only read by nodes downstream of a filter.
+/// Columns read by Defines and Variations are conservatively treated as read for every entry.
+void RLoopManager::SetDataSourceFilteredColumns()
+{
+   std::set<std::string> unfilteredColumns;
+   std::set<std::string> filteredColumns;
+   auto addColumns = [&](const ColumnNames_t &columnNames, const RDFInternal::RColumnRegister &colRegister,
+                         bool isFiltered) {
+      for (const auto &name : columnNames) {
+         if (colRegister.GetDefine(name) != nullptr || !fDataSource->HasColumn(name))
+            continue;
+         if (isFiltered)
+            filteredColumns.insert(name);
+         else
+            unfilteredColumns.insert(name);
+      }
+   };
+
+   if (fBookedVariations.empty()) {
+      for (auto *filter : fBookedFilters)
+         addColumns(filter->GetColumnNames(), filter->GetColRegister(), filter->HasUpstreamFilters());
+      for (auto *action : fBookedActions)
+         addColumns(action->GetColumnNames(), action->GetColRegister(), action->HasUpstreamFilters());
+      for (auto *define : fBookedDefines)
+         unfilteredColumns.insert(define->GetColumnNames().begin(), define->GetColumnNames().end());
+   }
+
+   std::vector<std::string> result;
+   std::set_difference(filteredColumns.begin(), filteredColumns.end(), unfilteredColumns.begin(),
+                       unfilteredColumns.end(), std::back_inserter(result));
+   fDataSource->SetFilteredColumns(result);
+}
+
+/// Return a description of the dataset processed by the event loop, for the keys of the result cache. Files are
+/// identified by their name and their UUID, so that results are not reused after a file is rewritten. Return an empty
+/// string if the results obtained from this dataset must not be cached: data sources, friend trees, entry lists and
+/// trees that are not stored in a file are not described.
+std::string RLoopManager::GetDatasetFingerprint() const
+{
+   std::string fingerprint;
+   if (fLoopType == ELoopType::kNoFiles || fLoopType == ELoopType::kNoFilesMT) {
+      fingerprint = "empty " + std::to_string(fNEmptyEntries) + '\n';
+   } else {
+      if (fDataSource || !fTree || fTree->GetEntryList())
+         return "";
+      const auto *friends = fTree->GetListOfFriends();
+      if (friends && friends->GetEntries() > 0)
+         return "";
+
+      std::vector<std::pair<std::string, std::string>> treesAndFiles;
+      if (auto *chain = dynamic_cast<TChain *>(fTree.get())) {
+         for (const auto *element : *chain->GetListOfFiles())
+            treesAndFiles.emplace_back(element->GetName(), element->GetTitle());
+      } else if (auto *file = fTree->GetCurrentFile()) {
+         treesAndFiles.emplace_back(ROOT::Internal::TreeUtils::GetTreeFullPaths(*fTree)[0], file->GetName());
+      }
+      if (treesAndFiles.empty())
+         return "";
+
+      TDirectory::TContext ctxt;
+      for (const auto &treeAndFile : treesAndFiles) {
+         std::unique_ptr<TFile> file(TFile::Open(treeAndFile.second.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+         if (!file || file->IsZombie())
+            return "";
+         fingerprint += treeAndFile.first + ' ' + treeAndFile.second + ' ' + file->GetUUID().AsString() + '\n';
+      }
+   }
+   return fingerprint + "entries " + std::to_string(fBeginEntry) + ' ' + std::to_string(fEndEntry);
+}
+
+/// The key under which a result is stored in the result cache
+static std::string MakeResultCacheKey(const std::string &datasetFingerprint, const std::string &resultFingerprint)
+{
+   const std::string keyInput = datasetFingerprint + '\n' + resultFingerprint;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyInput.data()), keyInput.size());
+   md5.Final();
+   return std::string("rdf_") + md5.AsString();
+}
+
+/// Replace the results of the booked actions with the ones found in the result cache, and mark those actions as run.
+/// Return whether any result was found.
+bool RLoopManager::LoadCachedResults(const std::string &datasetFingerprint)
+{
+   if (datasetFingerprint.empty()) {
+      fCachedResults.clear();
+      return false;
+   }
+   // Callbacks must see all the entries, and cached results are written out at the end of the event loop anyway
+   if (!fCallbacks.empty() || !fCallbacksOnce.empty() || gSystem->AccessPathName(fResultCacheFileName.c_str()))
+      return false;
+
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> file(TFile::Open(fResultCacheFileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (!file || file->IsZombie())
+      return false;
+
+   bool found = false;
+   auto isFound = [&](RDFInternal::RCachedResult &result) {
+      auto action = result.fAction.lock();
+      if (!action || std::find(fBookedActions.begin(), fBookedActions.end(), action.get()) == fBookedActions.end())
+         return false;
+      if (!result.fRead(*file, MakeResultCacheKey(datasetFingerprint, result.fFingerprint)))
+         return false;
+      RDFInternal::Erase(action.get(), fBookedActions);
+      fSampleCallbacks.erase(action.get());
+      fRunActions.emplace_back(action.get());
+      action->SetHasRun();
+      found = true;
+      return true;
+   };
+   fCachedResults.erase(std::remove_if(fCachedResults.begin(), fCachedResults.end(), isFound), fCachedResults.end());
+
+   return found;
+}
+
+/// Store the results computed by the last event loop in the result cache.
+void RLoopManager::StoreCachedResults(const std::string &datasetFingerprint)
+{
+   if (datasetFingerprint.empty() || fCachedResults.empty())
+      return;
+
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> file(TFile::Open(fResultCacheFileName.c_str(), "UPDATE_WITHOUT_GLOBALREGISTRATION"));
+   if (!file || file->IsZombie()) {
+      Warning("Run", "Could not open the result cache %s, the results of this event loop are not stored.",
+              fResultCacheFileName.c_str());
+   } else {
+      for (auto &result : fCachedResults) {
+         auto action = result.fAction.lock();
+         if (action && action->HasRun())
+            result.fWrite(*file, MakeResultCacheKey(datasetFingerprint, result.fFingerprint));
+      }
+   }
+   fCachedResults.clear();
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -780,25 +1092,35 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
-/// This method also clears the contents of GetCodeToJit().
+/// This method also clears the contents of GetCodeToJit(): the code booked by all RLoopManagers is jitted in one go.
 void RLoopManager::Jit()
 {
    // TODO this should be a read lock unless we find GetCodeToJit non-empty
    R__LOCKGUARD(gROOTMutex);
 
-   const std::string code = std::move(GetCodeToJit());
-   if (code.empty()) {
-      R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
-      return;
-   }
+   std::string code;
+   for (auto &codeOfLoop : GetCodeToJit())
+      code += codeOfLoop.second;
+   GetCodeToJit().clear();
+   JitAndRun(code);
+}
 
-   TStopwatch s;
-   s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
-   s.Stop();
-   R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
-                                << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
-                                                        : " in less than 1ms.");
+/// Add the RDF nodes of this computation graph that require just-in-time compilation, leaving the code booked by
+/// other RLoopManagers in GetCodeToJit(). Used by RunGraphs to start the event loop of a computation graph while the
+/// following ones are still being jitted.
+void RLoopManager::JitOwnCode()
+{
+   R__LOCKGUARD(gROOTMutex);
+
+   auto &codeToJit = GetCodeToJit();
+   std::string code;
+   for (auto &codeOfLoop : codeToJit) {
+      if (codeOfLoop.first == this)
+         code += codeOfLoop.second;
+   }
+   auto isOwnCode = [this](const std::pair<const RLoopManager *, std::string> &c) { return c.first == this; };
+   codeToJit.erase(std::remove_if(codeToJit.begin(), codeToJit.end(), isOwnCode), codeToJit.end());
+   JitAndRun(code);
 }
 
 /// Trigger counting of number of children nodes for each node of the functional graph.
@@ -830,7 +1152,23 @@ void RLoopManager::Run(bool jit)
    if (jit)
       Jit();
 
+   const auto datasetFingerprint = fCachedResults.empty() ? std::string() : GetDatasetFingerprint();
+   if (LoadCachedResults(datasetFingerprint) && fBookedActions.empty() &&
+       (!fMustRunNamedFilters || fBookedNamedFilters.empty())) {
+      CleanUpNodes();
+      R__LOG_INFO(RDFLogChannel()) << "All results were read from the result cache " << fResultCacheFileName
+                                   << ", no event loop was run.";
+      return;
+   }
+
+   MemoryLimitRAII memoryLimit(fMemoryLimit);
+
    InitNodes();
+   if (fDataSource)
+      SetDataSourceFilteredColumns();
+   fRunBulk = CanRunBulk();
+   if (fRunBulk)
+      fBulkMasks.resize(fNSlots);
 
    TStopwatch s;
    s.Start();
@@ -844,7 +1182,15 @@ void RLoopManager::Run(bool jit)
    }
    s.Stop();
 
+   // before CleanUpNodes, which releases the memory of the partial results of the slots
+   fMemoryReport = ROOT::Experimental::RMemoryBudget::GetReport();
+   if (fMemoryLimit > 0 && ROOT::Experimental::RMemoryBudget::GetTotalPeak() > fMemoryLimit) {
+      Warning("Run", "The tracked memory peaked at %.1f MB, above the limit of %.1f MB. See GetMemoryReport().",
+              ROOT::Experimental::RMemoryBudget::GetTotalPeak() / (1024. * 1024.), fMemoryLimit / (1024. * 1024.));
+   }
+
    CleanUpNodes();
+   StoreCachedResults(datasetFingerprint);
 
    fNRuns++;
 
@@ -928,6 +1274,52 @@ bool RLoopManager::CheckFilters(unsigned int, Long64_t)
    return true;
 }
 
+/// All entries pass: end of the recursive chain of calls in bulk processing mode.
+void RLoopManager::CheckFiltersBulk(unsigned int, RDFInternal::RMaskedEntryRange &mask)
+{
+   for (std::size_t i = 0; i < mask.Size(); ++i)
+      mask[i] = true;
+}
+
+/// Process bulkSize entries at a time in the following event loops.
+///
+/// In bulk processing mode, each filter is evaluated for all the entries of a range before the actions run, and the
+/// values of the defined columns are kept for the whole range. The filters, Defines and actions are therefore called
+/// in a different order than in the default mode, entry by entry; the results are the same. A bulk size of 1, the
+/// default, disables bulk processing. Bulk processing is currently only used for RDataFrames without a data source,
+/// Range or Vary; the other event loops ignore the setting.
+void RLoopManager::SetBulkSize(unsigned int bulkSize)
+{
+   if (bulkSize == 0)
+      throw std::runtime_error("RDataFrame: the bulk size must be at least 1.");
+   fBulkSize = bulkSize;
+}
+
+/// Allocate the RVec temporaries of the Define expressions in per-slot arenas in the following event loops.
+///
+/// Each evaluation of a Define expression that returns an RVec then takes the buffers of the RVecs it creates from
+/// the arena of its slot, and recycles them all at once when the value has been copied into the result of the Define.
+/// The result itself and the values of all other columns stay on the heap.
+void RLoopManager::SetRVecArenas(bool use)
+{
+   fRVecArenas.clear();
+   if (use) {
+      fRVecArenas.reserve(fNSlots);
+      for (auto slot = 0u; slot < fNSlots; ++slot)
+         fRVecArenas.emplace_back(std::make_unique<ROOT::Internal::VecOps::RVecArena>());
+   }
+}
+
+/// Enable or disable the profiling of the following event loops, see RInterfaceBase::SetProfiling. The measurements
+/// of the last profiled event loop stay available when profiling is disabled.
+void RLoopManager::SetProfiling(bool profile)
+{
+   if (profile && !fProfiler)
+      fProfiler = std::make_unique<RGraphProfiler>(fNSlots);
+   if (fProfiler)
+      fProfiler->SetEnabled(profile);
+}
+
 /// Call `FillReport` on all booked filters
 void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 {
@@ -947,7 +1339,11 @@ void RLoopManager::SetTree(std::shared_ptr<TTree> tree)
 void RLoopManager::ToJitExec(const std::string &code) const
 {
    R__LOCKGUARD(gROOTMutex);
-   GetCodeToJit().append(code);
+   auto &codeToJit = GetCodeToJit();
+   if (codeToJit.empty() || codeToJit.back().first != this)
+      codeToJit.emplace_back(this, code);
+   else
+      codeToJit.back().second.append(code);
 }
 
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
@@ -1051,6 +1447,9 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
+   if (auto *profiler = GetActiveProfiler())
+      reader = std::make_unique<RProfiledColumnReader>(std::move(reader), *profiler, slot,
+                                                       profiler->RegisterColumnRead(col));
    auto *rptr = reader.get();
    readers[key] = std::move(reader);
    return rptr;
@@ -14,6 +14,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RDF/ActionHelpers.hxx>
 #include <ROOT/RDF/RColumnReaderBase.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RFieldValue.hxx>
@@ -26,7 +27,13 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstdlib>
 #include <string>
+#include <tuple>
+#include <unordered_set>
 #include <vector>
 #include <typeinfo>
 #include <utility>
@@ -42,6 +49,11 @@
 * For each column containing an array or a collection, a corresponding column `#colname` is available to access
 * `colname.size()` without reading and deserializing the collection values.
 *
+* The members of a collection of records are available as separate columns that are read only if they are used: for
+* a field `jets` of type `std::vector<Jet>`, the column `jets.pt` is an `RVec<float>` of the `pt` members. For a
+* collection that is not nested in another collection, the values of such columns of arithmetic type are not copied:
+* the RVec points to the page of the RNTuple column in memory, unless the collection is split across pages.
+*
 **/
 // clang-format on
 
@@ -113,6 +125,92 @@ public:
    }
 };
 
+/// An RVec field for the RDF columns of single-level collections of simple items, e.g. `jets.pt` for a top-level
+/// `std::vector<Jet>` field `jets`. Instead of copying the items one by one, the RVec adopts the memory of the page of
+/// the item column if the collection lies in a single page, which is the common case. The adopted memory remains
+/// valid until the next read of the field, which may map another page; RDF uses the value only for the current entry.
+template <typename ItemT>
+class RRDFRVecViewField final : public ROOT::Experimental::RRVecField {
+   using RFieldBase = ROOT::Experimental::Detail::RFieldBase;
+   using RFieldValue = ROOT::Experimental::Detail::RFieldValue;
+
+   /// The data members of the RVec value: begin, size and capacity. A capacity of -1 marks adopted memory.
+   static std::tuple<void **, std::int32_t *, std::int32_t *> GetDataMembers(void *rvecPtr)
+   {
+      void **begin = reinterpret_cast<void **>(rvecPtr);
+      std::int32_t *size = reinterpret_cast<std::int32_t *>(begin + 1);
+      return {begin, size, size + 1};
+   }
+
+protected:
+   std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      return std::make_unique<RRDFRVecViewField>(newName, fSubFields[0]->Clone(fSubFields[0]->GetName()));
+   }
+
+   void ReadGlobalImpl(NTupleSize_t globalIndex, RFieldValue *value) final
+   {
+      auto [beginPtr, sizePtr, capacityPtr] = GetDataMembers(value->GetRawPtr());
+
+      ClusterSize_t nItems;
+      RClusterIndex collectionStart;
+      GetCollectionInfo(globalIndex, &collectionStart, &nItems);
+      if (nItems > 0) {
+         NTupleSize_t nMapped;
+         auto items = static_cast<RField<ItemT> *>(fSubFields[0].get())->MapV(collectionStart, nMapped);
+         if (nMapped >= nItems) {
+            if (*capacityPtr != -1)
+               free(*beginPtr);
+            *beginPtr = items;
+            *sizePtr = nItems;
+            *capacityPtr = -1;
+            return;
+         }
+      }
+
+      // The collection spans several pages (or is empty): copy the items into memory owned by the RVec
+      if (*capacityPtr == -1) {
+         *beginPtr = nullptr;
+         *sizePtr = 0;
+         *capacityPtr = 0;
+      }
+      RRVecField::ReadGlobalImpl(globalIndex, value);
+   }
+
+public:
+   RRDFRVecViewField(std::string_view fieldName, std::unique_ptr<RFieldBase> itemField)
+      : RRVecField(fieldName, std::move(itemField))
+   {
+   }
+};
+
+/// Wrap itemField in an RRDFRVecViewField if it is of one of the types ItemTs, in an RRVecField otherwise
+template <typename... ItemTs>
+struct RRVecFieldMaker;
+
+template <>
+struct RRVecFieldMaker<> {
+   static std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+   Make(std::unique_ptr<ROOT::Experimental::Detail::RFieldBase> itemField)
+   {
+      return std::make_unique<ROOT::Experimental::RRVecField>("", std::move(itemField));
+   }
+};
+
+template <typename ItemT, typename... ItemTs>
+struct RRVecFieldMaker<ItemT, ItemTs...> {
+   static std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+   Make(std::unique_ptr<ROOT::Experimental::Detail::RFieldBase> itemField)
+   {
+      if (dynamic_cast<ROOT::Experimental::RField<ItemT> *>(itemField.get()))
+         return std::make_unique<RRDFRVecViewField<ItemT>>("", std::move(itemField));
+      return RRVecFieldMaker<ItemTs...>::Make(std::move(itemField));
+   }
+};
+
+using RSimpleRVecFieldMaker = RRVecFieldMaker<float, double, std::int8_t, std::uint8_t, std::int16_t, std::uint16_t,
+                                              std::int32_t, std::uint32_t, std::int64_t, std::uint64_t>;
+
 /// Every RDF column is represented by exactly one RNTuple field
 class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    using RFieldBase = ROOT::Experimental::Detail::RFieldBase;
@@ -144,6 +242,24 @@ public:
          f.ConnectPageSource(source);
    }
 
+   /// Adds the ids of the physical columns that back the field and its subfields to `columnIds`
+   void CollectColumnIds(const RNTupleDescriptor &desc, std::unordered_set<DescriptorId_t> &columnIds)
+   {
+      auto fnAddColumns = [&desc, &columnIds](const RFieldBase &field) {
+         if (field.GetOnDiskId() == kInvalidDescriptorId)
+            return;
+         for (std::uint32_t i = 0;; ++i) {
+            const auto columnId = desc.FindColumnId(field.GetOnDiskId(), i);
+            if (columnId == kInvalidDescriptorId)
+               break;
+            columnIds.insert(columnId);
+         }
+      };
+      fnAddColumns(*fField);
+      for (auto &f : *fField)
+         fnAddColumns(f);
+   }
+
    void *GetImpl(Long64_t entry) final
    {
       if (entry != fLastEntry) {
@@ -245,7 +361,12 @@ void RNTupleDS::AddField(const RNTupleDescriptor &desc, std::string_view colName
    }
 
    for (auto i = skeinIDs.rbegin(); i != skeinIDs.rend(); ++i) {
-      valueField = std::make_unique<ROOT::Experimental::RRVecField>("", std::move(valueField));
+      // The items of a single-level collection can be read in place from the page of the item column; with nested
+      // collections, reading the next inner collection could map another page while the previous ones are still used
+      if (skeinIDs.size() == 1)
+         valueField = ROOT::Experimental::Internal::RSimpleRVecFieldMaker::Make(std::move(valueField));
+      else
+         valueField = std::make_unique<ROOT::Experimental::RRVecField>("", std::move(valueField));
       valueField->SetOnDiskId(*i);
       // Skip the inner-most collection level to construct the cardinality column
       if (i != skeinIDs.rbegin()) {
@@ -290,6 +411,8 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    // at this point we can assume that `name` will be found in fColumnNames, RDF is in charge validation
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
+   if ((slot == 0) && (std::find(fActiveColumns.begin(), fActiveColumns.end(), index) == fActiveColumns.end()))
+      fActiveColumns.emplace_back(index);
    auto clone = fColumnReaderPrototypes[index]->Clone();
    clone->Connect(*fSources[slot]);
    return clone;
@@ -300,6 +423,78 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::AddValueRangeCut(std::string_view fieldName, double min, double max)
+{
+   auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+   const auto fieldId = descriptorGuard->FindFieldId(fieldName, descriptorGuard->GetFieldZeroId());
+   if (fieldId == kInvalidDescriptorId)
+      throw std::runtime_error("RNTupleDS: no top-level field " + std::string(fieldName));
+   const auto &fieldDesc = descriptorGuard->GetFieldDescriptor(fieldId);
+   // For a top-level leaf field with a single column, the column element index is the entry number
+   const auto columnId = descriptorGuard->FindColumnId(fieldId, 0);
+   if ((fieldDesc.GetStructure() != ENTupleStructure::kLeaf) || (columnId == kInvalidDescriptorId) ||
+       (descriptorGuard->FindColumnId(fieldId, 1) != kInvalidDescriptorId)) {
+      throw std::runtime_error("RNTupleDS: value range cuts require a field of arithmetic type, got " +
+                               std::string(fieldName));
+   }
+   fValueRangeCuts.push_back({columnId, min, max});
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetSelectedEntryRanges()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   std::unordered_set<DescriptorId_t> skippedClusters;
+   {
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+         const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+         std::vector<std::pair<ULong64_t, ULong64_t>> selected{{firstEntry, firstEntry + clusterDesc.GetNEntries()}};
+         for (const auto &cut : fValueRangeCuts) {
+            if (!clusterDesc.ContainsColumn(cut.fColumnId))
+               continue;
+            // The entry ranges of the pages that might pass the cut, with adjacent pages merged
+            std::vector<std::pair<ULong64_t, ULong64_t>> passing;
+            auto pageFirst = clusterDesc.GetColumnRange(cut.fColumnId).fFirstElementIndex;
+            for (const auto &pi : clusterDesc.GetPageRange(cut.fColumnId).fPageInfos) {
+               const auto pageLast = pageFirst + pi.fNElements;
+               if (pi.fValueRange.MayOverlap(cut.fMin, cut.fMax)) {
+                  if (!passing.empty() && passing.back().second == pageFirst)
+                     passing.back().second = pageLast;
+                  else
+                     passing.emplace_back(pageFirst, pageLast);
+               }
+               pageFirst = pageLast;
+            }
+            // Intersect the entries selected so far with the passing pages; both lists are sorted and disjoint
+            std::vector<std::pair<ULong64_t, ULong64_t>> intersection;
+            auto itrSelected = selected.begin();
+            auto itrPassing = passing.begin();
+            while (itrSelected != selected.end() && itrPassing != passing.end()) {
+               const auto start = std::max(itrSelected->first, itrPassing->first);
+               const auto end = std::min(itrSelected->second, itrPassing->second);
+               if (start < end)
+                  intersection.emplace_back(start, end);
+               if (itrSelected->second < itrPassing->second)
+                  ++itrSelected;
+               else
+                  ++itrPassing;
+            }
+            std::swap(selected, intersection);
+         }
+
+         if (selected.empty())
+            skippedClusters.insert(clusterDesc.GetId());
+         ranges.insert(ranges.end(), selected.begin(), selected.end());
+      }
+   }
+
+   for (auto &source : fSources)
+      source->SetSkippedClusters(skippedClusters);
+
+   std::sort(ranges.begin(), ranges.end());
+   return ranges;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
@@ -307,6 +502,11 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fValueRangeCuts.empty()) {
+      fHasSeenAllRanges = true;
+      return GetSelectedEntryRanges();
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -334,6 +534,31 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
    return std::find(fColumnNames.begin(), fColumnNames.end(), colName) != fColumnNames.end();
 }
 
+void RNTupleDS::SetFilteredColumns(const std::vector<std::string> &columnNames)
+{
+   // Physical columns can be shared by several RDF columns, e.g. the offset column of "jets" by "R_rdf_sizeof_jets".
+   // Only the columns that are not needed by any of the unfiltered RDF columns are lazy.
+   std::unordered_set<DescriptorId_t> filteredColumnIds;
+   std::unordered_set<DescriptorId_t> unfilteredColumnIds;
+   {
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      for (auto index : fActiveColumns) {
+         const bool isFiltered =
+            std::find(columnNames.begin(), columnNames.end(), fColumnNames[index]) != columnNames.end();
+         fColumnReaderPrototypes[index]->CollectColumnIds(descriptorGuard.GetRef(),
+                                                          isFiltered ? filteredColumnIds : unfilteredColumnIds);
+      }
+   }
+
+   std::unordered_set<DescriptorId_t> lazyColumnIds;
+   for (auto columnId : filteredColumnIds) {
+      if (unfilteredColumnIds.count(columnId) == 0)
+         lazyColumnIds.insert(columnId);
+   }
+   for (auto &source : fSources)
+      source->SetLazyColumns(lazyColumnIds);
+}
+
 void RNTupleDS::Initialize()
 {
    fHasSeenAllRanges = false;
@@ -368,3 +593,9 @@ ROOT::RDataFrame ROOT::Experimental::MakeNTupleDataFrame(RNTuple *ntuple)
    ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(ntuple->MakePageSource()));
    return rdf;
 }
+
+void ROOT::Internal::RDF::SetSnapshotRNTupleOutput(ROOT::RDataFrame &outputDF, const std::string &ntupleName,
+                                                   const std::string &fileName)
+{
+   outputDF = ROOT::Experimental::MakeNTupleDataFrame(ntupleName, fileName);
+}
@@ -0,0 +1,357 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RParquetDS.hxx>
+
+#include "RArrowVisitors.hxx"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/io/file.h>
+#include <arrow/table.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/schema.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The state of a slot of RParquetDS: its file reader and the values of the row group it is processing.
+struct RParquetDSSlot {
+   std::unique_ptr<parquet::arrow::FileReader> fReader;
+   ULong64_t fFirstEntry = 0;
+   /// The values of each column in the current row group; null for the columns that are not read
+   std::vector<std::shared_ptr<arrow::ChunkedArray>> fColumns;
+   /// The current chunk of each column and the entry number, within the row group, of its first entry
+   std::vector<int> fCurrentChunk;
+   std::vector<ULong64_t> fChunkFirstEntry;
+   std::vector<ArrayPtrVisitor> fVisitors;
+};
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+
+namespace {
+
+std::unique_ptr<parquet::arrow::FileReader> OpenParquetFile(const std::string &fileName)
+{
+   auto file = arrow::io::ReadableFile::Open(fileName);
+   if (!file.ok())
+      throw std::runtime_error("RParquetDS: cannot open file " + fileName + ": " + file.status().ToString());
+
+   // Coalesce the reads of the column chunks of a row group and issue them concurrently
+   parquet::ArrowReaderProperties arrowProperties;
+   arrowProperties.set_pre_buffer(true);
+
+   std::unique_ptr<parquet::arrow::FileReader> reader;
+   parquet::arrow::FileReaderBuilder builder;
+   auto status = builder.Open(*file);
+   if (status.ok())
+      status = builder.properties(arrowProperties)->Build(&reader);
+   if (!status.ok())
+      throw std::runtime_error("RParquetDS: cannot read file " + fileName + ": " + status.ToString());
+   return reader;
+}
+
+void CollectLeafIndices(const parquet::arrow::SchemaField &field, std::vector<int> &leafIndices)
+{
+   if (field.is_leaf())
+      leafIndices.emplace_back(field.column_index);
+   for (const auto &child : field.children)
+      CollectLeafIndices(child, leafIndices);
+}
+
+template <typename ParquetType>
+void GetTypedMinMax(const parquet::Statistics &stats, double &min, double &max)
+{
+   const auto &typedStats = static_cast<const parquet::TypedStatistics<ParquetType> &>(stats);
+   min = typedStats.min();
+   max = typedStats.max();
+}
+
+/// Read the min/max statistics of a column chunk as doubles; false if there are none.
+bool GetMinMax(const parquet::Statistics &stats, double &min, double &max)
+{
+   if (!stats.HasMinMax())
+      return false;
+   const bool isUnsigned = stats.descr()->sort_order() == parquet::SortOrder::UNSIGNED;
+   switch (stats.physical_type()) {
+   case parquet::Type::INT32:
+      GetTypedMinMax<parquet::Int32Type>(stats, min, max);
+      if (isUnsigned) {
+         min = static_cast<std::uint32_t>(static_cast<std::int32_t>(min));
+         max = static_cast<std::uint32_t>(static_cast<std::int32_t>(max));
+      }
+      return true;
+   case parquet::Type::INT64: {
+      // go through the integer type to not lose the sign of unsigned values
+      const auto &typedStats = static_cast<const parquet::Int64Statistics &>(stats);
+      min = isUnsigned ? static_cast<double>(static_cast<std::uint64_t>(typedStats.min())) : typedStats.min();
+      max = isUnsigned ? static_cast<double>(static_cast<std::uint64_t>(typedStats.max())) : typedStats.max();
+      return true;
+   }
+   case parquet::Type::FLOAT: GetTypedMinMax<parquet::FloatType>(stats, min, max); return true;
+   case parquet::Type::DOUBLE: GetTypedMinMax<parquet::DoubleType>(stats, min, max); return true;
+   default: return false;
+   }
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create a Parquet RDataSource for RDataFrame.
+/// \param[in] fileName the path of the Parquet file
+/// \param[in] columns the names of the columns to expose; if empty, all the columns of the file are exposed
+RParquetDS::RParquetDS(std::string_view fileName, const std::vector<std::string> &columns)
+   : fFileName(fileName), fReader(OpenParquetFile(fFileName)), fColumnNames(columns)
+{
+   std::shared_ptr<arrow::Schema> schema;
+   auto status = fReader->GetSchema(&schema);
+   if (!status.ok())
+      throw std::runtime_error("RParquetDS: cannot read the schema of file " + fFileName + ": " + status.ToString());
+
+   if (fColumnNames.empty()) {
+      for (const auto &field : schema->fields())
+         fColumnNames.emplace_back(field->name());
+   }
+
+   const auto &manifest = fReader->manifest();
+   for (const auto &name : fColumnNames) {
+      const auto fieldIdx = schema->GetFieldIndex(name);
+      if (fieldIdx < 0)
+         throw std::runtime_error("RParquetDS: file " + fFileName + " does not have column " + name);
+
+      const auto &type = schema->field(fieldIdx)->type();
+      VerifyValidColumnType verifyType;
+      RDFTypeNameGetter typeGetter;
+      if (!type->Accept(&verifyType).ok() || !type->Accept(&typeGetter).ok())
+         throw std::runtime_error("RParquetDS: column " + name + " contains an unsupported type " + type->name());
+      fColumnTypes.emplace_back(typeGetter.result());
+
+      fLeafIndices.emplace_back();
+      CollectLeafIndices(manifest.schema_fields[fieldIdx], fLeafIndices.back());
+   }
+   fIsActive.resize(fColumnNames.size(), false);
+
+   auto metadata = fReader->parquet_reader()->metadata();
+   const auto nRowGroups = metadata->num_row_groups();
+   ULong64_t nEntries = 0ull;
+   for (int i = 0; i < nRowGroups; ++i) {
+      fRowGroupFirstEntry.emplace_back(nEntries);
+      nEntries += metadata->RowGroup(i)->num_rows();
+   }
+   fRowGroupFirstEntry.emplace_back(nEntries);
+   fIsRowGroupSelected.resize(nRowGroups, true);
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Destructor.
+RParquetDS::~RParquetDS() = default;
+
+std::size_t RParquetDS::GetColumnIndex(std::string_view colName) const
+{
+   const auto it = std::find(fColumnNames.begin(), fColumnNames.end(), colName);
+   if (it == fColumnNames.end())
+      throw std::runtime_error("RParquetDS: the dataset does not have column " + std::string(colName));
+   return std::distance(fColumnNames.begin(), it);
+}
+
+void RParquetDS::SetNSlots(unsigned int nSlots)
+{
+   assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
+   fNSlots = nSlots;
+
+   const auto nColumns = fColumnNames.size();
+   fValuePtrs.assign(nColumns * nSlots, nullptr);
+   fSlots.clear();
+   for (unsigned int slot = 0u; slot < nSlots; ++slot) {
+      auto slotState = std::make_unique<ROOT::Internal::RDF::RParquetDSSlot>();
+      // Each slot has its own reader, so that the row groups are read concurrently
+      slotState->fReader = OpenParquetFile(fFileName);
+      slotState->fColumns.resize(nColumns);
+      slotState->fCurrentChunk.resize(nColumns, 0);
+      slotState->fChunkFirstEntry.resize(nColumns, 0ull);
+      for (std::size_t col = 0u; col < nColumns; ++col)
+         slotState->fVisitors.emplace_back(&fValuePtrs[col * nSlots + slot]);
+      fSlots.emplace_back(std::move(slotState));
+   }
+}
+
+const std::vector<std::string> &RParquetDS::GetColumnNames() const
+{
+   return fColumnNames;
+}
+
+bool RParquetDS::HasColumn(std::string_view colName) const
+{
+   return std::find(fColumnNames.begin(), fColumnNames.end(), colName) != fColumnNames.end();
+}
+
+std::string RParquetDS::GetTypeName(std::string_view colName) const
+{
+   return fColumnTypes[GetColumnIndex(colName)];
+}
+
+RDataSource::Record_t RParquetDS::GetColumnReadersImpl(std::string_view name, const std::type_info &)
+{
+   const auto colIdx = GetColumnIndex(name);
+   fIsActive[colIdx] = true;
+   Record_t ptrs;
+   for (unsigned int slot = 0u; slot < fNSlots; ++slot)
+      ptrs.emplace_back(&fValuePtrs[colIdx * fNSlots + slot]);
+   return ptrs;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Skip the row groups in which no value of a column lies in [min, max].
+/// \param[in] colName the name of a column of arithmetic type
+/// \param[in] min the lower bound of the interval
+/// \param[in] max the upper bound of the interval
+///
+/// The decision is taken from the min/max statistics of the column chunks stored in the file: row groups without
+/// statistics are kept. The entries of the row groups that are kept are not filtered, a Filter of the values is
+/// still required. Successive calls drop more row groups; they must happen before the event loop runs.
+void RParquetDS::SelectRowGroups(std::string_view colName, double min, double max)
+{
+   const auto colIdx = GetColumnIndex(colName);
+   auto metadata = fReader->parquet_reader()->metadata();
+   const auto leafIdx = fLeafIndices[colIdx].front();
+   const auto *descr = metadata->schema()->Column(leafIdx);
+   const auto physicalType = descr->physical_type();
+   if (fLeafIndices[colIdx].size() != 1 || descr->max_repetition_level() > 0 ||
+       (physicalType != parquet::Type::INT32 && physicalType != parquet::Type::INT64 &&
+        physicalType != parquet::Type::FLOAT && physicalType != parquet::Type::DOUBLE)) {
+      throw std::runtime_error("RParquetDS: row groups can only be selected on columns of arithmetic type, column " +
+                               std::string(colName) + " is of type " + fColumnTypes[colIdx]);
+   }
+
+   for (std::size_t rg = 0u; rg < fIsRowGroupSelected.size(); ++rg) {
+      if (!fIsRowGroupSelected[rg])
+         continue;
+      auto columnChunk = metadata->RowGroup(rg)->ColumnChunk(leafIdx);
+      if (!columnChunk->is_stats_set())
+         continue;
+      auto stats = columnChunk->statistics();
+      double rgMin, rgMax;
+      if (stats && GetMinMax(*stats, rgMin, rgMax) && (rgMax < min || rgMin > max))
+         fIsRowGroupSelected[rg] = false;
+   }
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RParquetDS::GetEntryRanges()
+{
+   auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+   return entryRanges;
+}
+
+void RParquetDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   auto &slotState = *fSlots[slot];
+   const auto rgIt = std::upper_bound(fRowGroupFirstEntry.begin(), fRowGroupFirstEntry.end(), firstEntry);
+   const int rowGroup = std::distance(fRowGroupFirstEntry.begin(), rgIt) - 1;
+   slotState.fFirstEntry = fRowGroupFirstEntry[rowGroup];
+
+   // Only the column chunks of the columns used by the computation graph are read
+   std::vector<int> leafIndices;
+   for (std::size_t col = 0u; col < fColumnNames.size(); ++col) {
+      if (fIsActive[col])
+         leafIndices.insert(leafIndices.end(), fLeafIndices[col].begin(), fLeafIndices[col].end());
+   }
+   if (leafIndices.empty())
+      return;
+
+   std::shared_ptr<arrow::Table> table;
+   auto status = slotState.fReader->ReadRowGroup(rowGroup, leafIndices, &table);
+   if (!status.ok()) {
+      throw std::runtime_error("RParquetDS: cannot read row group " + std::to_string(rowGroup) + " of file " +
+                               fFileName + ": " + status.ToString());
+   }
+
+   for (std::size_t col = 0u; col < fColumnNames.size(); ++col) {
+      slotState.fCurrentChunk[col] = 0;
+      slotState.fChunkFirstEntry[col] = 0ull;
+      slotState.fColumns[col] = fIsActive[col] ? table->GetColumnByName(fColumnNames[col]) : nullptr;
+   }
+}
+
+bool RParquetDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   auto &slotState = *fSlots[slot];
+   const auto entryInRowGroup = entry - slotState.fFirstEntry;
+   for (std::size_t col = 0u; col < fColumnNames.size(); ++col) {
+      const auto &column = slotState.fColumns[col];
+      if (!column)
+         continue;
+      // entries are processed in increasing order within a range, so the current chunk only moves forward
+      auto &chunkIdx = slotState.fCurrentChunk[col];
+      auto &chunkFirstEntry = slotState.fChunkFirstEntry[col];
+      while (entryInRowGroup >= chunkFirstEntry + column->chunk(chunkIdx)->length()) {
+         chunkFirstEntry += column->chunk(chunkIdx)->length();
+         ++chunkIdx;
+      }
+      auto &visitor = slotState.fVisitors[col];
+      visitor.SetEntry(entryInRowGroup - chunkFirstEntry);
+      auto status = column->chunk(chunkIdx)->Accept(&visitor);
+      if (!status.ok()) {
+         throw std::runtime_error("RParquetDS: could not read column " + fColumnNames[col] + " at entry " +
+                                  std::to_string(entry) + ": " + status.ToString());
+      }
+   }
+   return true;
+}
+
+void RParquetDS::FinalizeSlot(unsigned int slot)
+{
+   // release the values of the row group
+   for (auto &column : fSlots[slot]->fColumns)
+      column.reset();
+}
+
+void RParquetDS::Initialize()
+{
+   fEntryRanges.clear();
+   for (std::size_t rg = 0u; rg < fIsRowGroupSelected.size(); ++rg) {
+      if (fIsRowGroupSelected[rg] && fRowGroupFirstEntry[rg] < fRowGroupFirstEntry[rg + 1])
+         fEntryRanges.emplace_back(fRowGroupFirstEntry[rg], fRowGroupFirstEntry[rg + 1]);
+   }
+}
+
+std::string RParquetDS::GetLabel()
+{
+   return "ParquetDS";
+}
+
+/// \brief Factory method to create an RDataFrame that reads a Parquet file.
+/// \param[in] fileName the path of the Parquet file
+/// \param[in] columns the names of the columns to expose; if empty, all the columns of the file are exposed
+RDataFrame MakeParquetDataFrame(std::string_view fileName, const std::vector<std::string> &columns)
+{
+   ROOT::RDataFrame rdf(std::make_unique<RParquetDS>(fileName, columns));
+   return rdf;
+}
+
+} // namespace RDF
+
+} // namespace ROOT
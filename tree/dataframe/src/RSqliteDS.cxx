@@ -12,6 +12,9 @@
 #include <ROOT/RRawFile.hxx>
 
 #include "TError.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TPRegexp.h"
 #include "TRandom.h"
 #include "TSystem.h"
 
@@ -318,6 +321,51 @@ static bool RegisterSqliteVfs()
    return (retval == SQLITE_OK);
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// Opens the sqlite file read-only through the custom VFS module and configures the connection.
+int OpenSqliteDb(const std::string &fileName, sqlite3 **db)
+{
+   int retval = sqlite3_open_v2(fileName.c_str(), db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, gSQliteVfsName);
+   if (retval != SQLITE_OK)
+      return retval;
+
+   // Certain complex queries trigger creation of temporary tables. Depending on the build options of sqlite,
+   // sqlite may try to store such temporary tables on disk, using our custom VFS module to do so.
+   // Creation of new database files, however, is not supported by the custom VFS module.  Thus we set the behavior
+   // of the database connection to "temp_store=2", meaning that temporary tables should always be maintained
+   // in memory.
+   return sqlite3_exec(*db, "PRAGMA temp_store=2;", nullptr, nullptr, nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// For queries of the form "SELECT <columns> FROM <table> [WHERE <condition>]" whose result rows stem each from
+/// a single table row, returns the table name and the same query restricted to the rowid range [?1, ?2), ordered by
+/// rowid and returning the rowid as additional last column. Returns empty strings for all other queries.
+std::pair<std::string, std::string> GetRowidRangeQuery(const std::string &query)
+{
+   TPRegexp reSimple("^\\s*SELECT\\s+(.+?)\\s+FROM\\s+([A-Za-z_][A-Za-z0-9_]*)(?:\\s+WHERE\\s+(.+?))?\\s*;?\\s*$");
+   std::unique_ptr<TObjArray> parts(reSimple.MatchS(query, "is"));
+   if (!parts || parts->GetEntriesFast() < 3)
+      return {};
+   parts->SetOwner();
+   const TString columns = static_cast<TObjString *>(parts->At(1))->GetString();
+   const TString table = static_cast<TObjString *>(parts->At(2))->GetString();
+   const TString condition = parts->GetEntriesFast() > 3 ? static_cast<TObjString *>(parts->At(3))->GetString() : "";
+
+   // Subqueries, aggregate and window functions combine several rows
+   TPRegexp reKeywords("\\b(SELECT|FROM|WHERE|GROUP|HAVING|ORDER|LIMIT|JOIN|UNION|INTERSECT|EXCEPT|DISTINCT|"
+                       "WINDOW|OVER)\\b|\\b(COUNT|SUM|TOTAL|AVG|MIN|MAX|GROUP_CONCAT)\\s*\\(");
+   if (reKeywords.MatchB(columns, "i") || reKeywords.MatchB(condition, "i"))
+      return {};
+
+   std::string rangeQuery = "SELECT " + std::string(columns) + ", rowid FROM " + std::string(table) +
+                            " WHERE rowid >= ?1 AND rowid < ?2";
+   if (!condition.IsNull())
+      rangeQuery += " AND (" + std::string(condition) + ")";
+   rangeQuery += " ORDER BY rowid";
+   return {std::string(table), rangeQuery};
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -328,8 +376,34 @@ namespace Internal {
 ////////////////////////////////////////////////////////////////////////////
 /// The state of an open dataset in terms of the sqlite3 C library.
 struct RSqliteDSDataSet {
+   /// A connection of a processing slot that reads the table in rowid ranges.
+   struct RSlot {
+      sqlite3 *fDb = nullptr;
+      sqlite3_stmt *fQuery = nullptr;
+      Long64_t fRowid = -1; ///< The rowid of the current row of fQuery, -1 once the range is exhausted
+
+      /// Advances to the next row of the range and returns the sqlite result code of the step.
+      int Step(int rowidColumn)
+      {
+         int retval = sqlite3_step(fQuery);
+         fRowid = (retval == SQLITE_ROW) ? sqlite3_column_int64(fQuery, rowidColumn) : -1;
+         return retval;
+      }
+   };
+
    sqlite3 *fDb = nullptr;
    sqlite3_stmt *fQuery = nullptr;
+   std::string fFileName;
+   /// The table and the rowid range query if the query can be split in rowid ranges, empty otherwise.
+   std::string fTable;
+   std::string fRangeQuery;
+   /// One connection per slot, only opened for several slots and queries that can be split.
+   std::vector<RSlot> fSlots;
+   bool fUseRanges = false;  ///< Whether the current event loop reads rowid ranges
+   bool fRangesDone = false; ///< Whether the rowid ranges of the current event loop have been handed out
+   ULong64_t fRowidBegin = 0;
+   ULong64_t fRowidEnd = 0;
+   ULong64_t fRangeSize = 1;
 };
 }
 
@@ -363,17 +437,8 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
 
    int retval;
 
-   retval = sqlite3_open_v2(fileName.c_str(), &fDataSet->fDb, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
-                            gSQliteVfsName);
-   if (retval != SQLITE_OK)
-      SqliteError(retval);
-
-   // Certain complex queries trigger creation of temporary tables. Depending on the build options of sqlite,
-   // sqlite may try to store such temporary tables on disk, using our custom VFS module to do so.
-   // Creation of new database files, however, is not supported by the custom VFS module.  Thus we set the behavior
-   // of the database connection to "temp_store=2", meaning that temporary tables should always be maintained
-   // in memory.
-   retval = sqlite3_exec(fDataSet->fDb, "PRAGMA temp_store=2;", nullptr, nullptr, nullptr);
+   fDataSet->fFileName = fileName;
+   retval = OpenSqliteDb(fileName, &fDataSet->fDb);
    if (retval != SQLITE_OK)
       SqliteError(retval);
 
@@ -381,12 +446,29 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
    if (retval != SQLITE_OK)
       SqliteError(retval);
 
+   // Only ordinary tables can be read in rowid ranges, views and tables without rowid cannot
+   auto rangeQuery = GetRowidRangeQuery(query);
+   if (!rangeQuery.first.empty()) {
+      sqlite3_stmt *stmt = nullptr;
+      const std::string check = "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = ?1";
+      if (sqlite3_prepare_v2(fDataSet->fDb, check.c_str(), -1, &stmt, nullptr) == SQLITE_OK &&
+          sqlite3_bind_text(stmt, 1, rangeQuery.first.c_str(), -1, SQLITE_TRANSIENT) == SQLITE_OK &&
+          sqlite3_step(stmt) == SQLITE_ROW) {
+         sqlite3_finalize(stmt);
+         stmt = nullptr;
+         if (sqlite3_prepare_v2(fDataSet->fDb, rangeQuery.second.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+            fDataSet->fTable = rangeQuery.first;
+            fDataSet->fRangeQuery = rangeQuery.second;
+         }
+      }
+      sqlite3_finalize(stmt);
+   }
+
    int colCount = sqlite3_column_count(fDataSet->fQuery);
    retval = sqlite3_step(fDataSet->fQuery);
    if ((retval != SQLITE_ROW) && (retval != SQLITE_DONE))
       SqliteError(retval);
 
-   fValues.reserve(colCount);
    for (int i = 0; i < colCount; ++i) {
       fColumnNames.emplace_back(sqlite3_column_name(fDataSet->fQuery, i));
       int type = SQLITE_NULL;
@@ -414,24 +496,19 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
       switch (type) {
       case SQLITE_INTEGER:
          fColumnTypes.push_back(ETypes::kInteger);
-         fValues.emplace_back(ETypes::kInteger);
          break;
       case SQLITE_FLOAT:
          fColumnTypes.push_back(ETypes::kReal);
-         fValues.emplace_back(ETypes::kReal);
          break;
       case SQLITE_TEXT:
          fColumnTypes.push_back(ETypes::kText);
-         fValues.emplace_back(ETypes::kText);
          break;
       case SQLITE_BLOB:
          fColumnTypes.push_back(ETypes::kBlob);
-         fValues.emplace_back(ETypes::kBlob);
          break;
       case SQLITE_NULL:
          // TODO: Null values in first rows are not well handled
          fColumnTypes.push_back(ETypes::kNull);
-         fValues.emplace_back(ETypes::kNull);
          break;
       default: throw std::runtime_error("Unhandled data type");
       }
@@ -443,6 +520,10 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
 RSqliteDS::~RSqliteDS()
 {
    // sqlite3_finalize returns the error code of the most recent operation on fQuery.
+   for (auto &slot : fDataSet->fSlots) {
+      sqlite3_finalize(slot.fQuery);
+      sqlite3_close(slot.fDb);
+   }
    sqlite3_finalize(fDataSet->fQuery);
    // Closing can possibly fail with SQLITE_BUSY, in which case resources are leaked. This should not happen
    // the way it is used in this class because we cleanup the prepared statement before.
@@ -476,16 +557,30 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
       throw std::runtime_error(errmsg);
    }
 
-   fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   std::vector<void *> ptrs;
+   for (auto &values : fValues) {
+      values[index].fIsActive = true;
+      ptrs.emplace_back(&values[index].fPtr);
+   }
+   return ptrs;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 /// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// This inherently serialized the RDF independent of the number of slots, unless the query is read in rowid
+/// ranges: then all the rowid ranges of the table are returned at once.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   if (fDataSet->fUseRanges) {
+      if (!fDataSet->fRangesDone) {
+         for (auto first = fDataSet->fRowidBegin; first < fDataSet->fRowidEnd; first += fDataSet->fRangeSize)
+            entryRanges.emplace_back(first, std::min(first + fDataSet->fRangeSize, fDataSet->fRowidEnd));
+         fDataSet->fRangesDone = true;
+      }
+      return entryRanges;
+   }
+
    int retval = sqlite3_step(fDataSet->fQuery);
    switch (retval) {
    case SQLITE_DONE: return entryRanges;
@@ -522,13 +617,64 @@ bool RSqliteDS::HasColumn(std::string_view colName) const
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Resets the SQlite query engine at the beginning of the event loop.
+/// Resets the SQlite query engine at the beginning of the event loop. With connections per slot, splits the rowids
+/// of the table in a few ranges per slot.
 void RSqliteDS::Initialize()
 {
    fNRow = 0;
    int retval = sqlite3_reset(fDataSet->fQuery);
    if (retval != SQLITE_OK)
       throw std::runtime_error("SQlite error, reset");
+
+   fDataSet->fUseRanges = false;
+   fDataSet->fRangesDone = false;
+   if (fDataSet->fSlots.empty())
+      return;
+
+   sqlite3_stmt *stmt = nullptr;
+   const std::string query = "SELECT min(rowid), max(rowid) FROM " + fDataSet->fTable;
+   retval = sqlite3_prepare_v2(fDataSet->fDb, query.c_str(), -1, &stmt, nullptr);
+   if (retval != SQLITE_OK)
+      SqliteError(retval);
+   retval = sqlite3_step(stmt);
+   if (retval != SQLITE_ROW) {
+      sqlite3_finalize(stmt);
+      SqliteError(retval);
+   }
+   const bool isEmpty = sqlite3_column_type(stmt, 0) == SQLITE_NULL;
+   const Long64_t minRowid = sqlite3_column_int64(stmt, 0);
+   const Long64_t maxRowid = sqlite3_column_int64(stmt, 1);
+   sqlite3_finalize(stmt);
+
+   // Negative rowids cannot be entry numbers, such tables are read sequentially
+   if (!isEmpty && minRowid < 0)
+      return;
+
+   fDataSet->fUseRanges = true;
+   fDataSet->fRowidBegin = isEmpty ? 0 : minRowid;
+   fDataSet->fRowidEnd = isEmpty ? 0 : static_cast<ULong64_t>(maxRowid) + 1;
+   const ULong64_t nRanges = 4 * fDataSet->fSlots.size();
+   fDataSet->fRangeSize =
+      std::max<ULong64_t>(1, (fDataSet->fRowidEnd - fDataSet->fRowidBegin + nRanges - 1) / nRanges);
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Positions the connection of the slot at the first row of the rowid range starting at firstEntry.
+void RSqliteDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   if (!fDataSet->fUseRanges)
+      return;
+
+   auto &s = fDataSet->fSlots[slot];
+   const auto lastEntry = std::min(firstEntry + fDataSet->fRangeSize, fDataSet->fRowidEnd);
+   int retval = sqlite3_reset(s.fQuery);
+   if (retval != SQLITE_OK)
+      SqliteError(retval);
+   sqlite3_bind_int64(s.fQuery, 1, static_cast<sqlite3_int64>(firstEntry));
+   sqlite3_bind_int64(s.fQuery, 2, static_cast<sqlite3_int64>(lastEntry));
+   retval = s.Step(fColumnNames.size());
+   if ((retval != SQLITE_ROW) && (retval != SQLITE_DONE))
+      SqliteError(retval);
 }
 
 std::string RSqliteDS::GetLabel()
@@ -547,51 +693,90 @@ RDataFrame MakeSqliteDataFrame(std::string_view fileName, std::string_view query
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+/// Stores the result of the current active sqlite query row as a C++ value. When reading rowid ranges, the entries
+/// are the rowids of the range and the ones without a row in the result set are skipped.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   assert(entry + 1 == fNRow);
-   (void)entry;
-   unsigned N = fValues.size();
+   sqlite3_stmt *query = fDataSet->fQuery;
+   if (fDataSet->fUseRanges) {
+      auto &s = fDataSet->fSlots[slot];
+      if (s.fRowid < 0 || static_cast<ULong64_t>(s.fRowid) != entry)
+         return false;
+      query = s.fQuery;
+   } else {
+      assert(entry + 1 == fNRow);
+      (void)entry;
+   }
+
+   auto &values = fValues[slot];
+   unsigned N = values.size();
    for (unsigned i = 0; i < N; ++i) {
-      if (!fValues[i].fIsActive)
+      if (!values[i].fIsActive)
          continue;
 
       int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
+      switch (values[i].fType) {
+      case ETypes::kInteger: values[i].fInteger = sqlite3_column_int64(query, i); break;
+      case ETypes::kReal: values[i].fReal = sqlite3_column_double(query, i); break;
       case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         nbytes = sqlite3_column_bytes(query, i);
          if (nbytes == 0) {
-            fValues[i].fText = "";
+            values[i].fText = "";
          } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
+            values[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(query, i));
          }
          break;
       case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
+         nbytes = sqlite3_column_bytes(query, i);
+         values[i].fBlob.resize(nbytes);
          if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
+            std::memcpy(values[i].fBlob.data(), sqlite3_column_blob(query, i), nbytes);
          }
          break;
       case ETypes::kNull: break;
       default: throw std::runtime_error("Unhandled column type");
       }
    }
+
+   if (fDataSet->fUseRanges) {
+      int retval = fDataSet->fSlots[slot].Step(fColumnNames.size());
+      if ((retval != SQLITE_ROW) && (retval != SQLITE_DONE))
+         SqliteError(retval);
+   }
    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// Opens one connection per slot if the query can be read in rowid ranges. Otherwise the rows are read one at a
+/// time, where many slots can in fact reduce the performance due to thread synchronization.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
+   fNSlots = nSlots;
+   fValues.clear();
+   fValues.resize(nSlots);
+   for (auto &values : fValues) {
+      values.reserve(fColumnTypes.size());
+      for (auto type : fColumnTypes)
+         values.emplace_back(type);
+   }
+
+   if (nSlots <= 1)
+      return;
+   if (fDataSet->fRangeQuery.empty()) {
       ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
                              "Consider turning off IMT.");
+      return;
+   }
+
+   fDataSet->fSlots.resize(nSlots);
+   for (auto &s : fDataSet->fSlots) {
+      int retval = OpenSqliteDb(fDataSet->fFileName, &s.fDb);
+      if (retval != SQLITE_OK)
+         SqliteError(retval);
+      retval = sqlite3_prepare_v2(s.fDb, fDataSet->fRangeQuery.c_str(), -1, &s.fQuery, nullptr);
+      if (retval != SQLITE_OK)
+         SqliteError(retval);
    }
-   fNSlots = nSlots;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
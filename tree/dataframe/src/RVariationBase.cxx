@@ -9,6 +9,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnRegister.hxx>
+#include <ROOT/RDF/RGraphProfiler.hxx>
 #include <ROOT/RDF/RLoopManager.hxx>
 #include <ROOT/RDF/RVariationBase.hxx>
 #include <ROOT/RDF/Utils.hxx> // CacheLineStep
@@ -57,6 +58,17 @@ std::string RVariationBase::GetTypeName() const
    return fType;
 }
 
+void RVariationBase::SetProfiler(RGraphProfiler *profiler)
+{
+   fProfiler = profiler;
+   if (profiler != nullptr) {
+      std::string label = "Vary";
+      for (std::size_t i = 0; i < fColNames.size(); ++i)
+         label += (i > 0 ? ", " : " ") + fColNames[i];
+      fProfilerNode = profiler->RegisterNode(RGraphProfiler::MakeLabel(label, fInputColumns));
+   }
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -633,6 +633,28 @@ TEST(RunGraphs, RunGraphsWithJitting)
    EXPECT_EQ(r4.GetValue(), 3u);
 }
 
+TEST(RunGraphs, RunGraphsWithJittingManyGraphs)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif // R__USE_IMT
+
+   std::vector<ROOT::RDataFrame> dfs;
+   std::vector<ROOT::RDF::RResultPtr<double>> sums;
+   for (int i = 0; i < 10; ++i) {
+      dfs.emplace_back(10);
+      sums.emplace_back(dfs.back().Define("x", std::to_string(i) + " * rdfentry_").Filter("x >= 0").Sum("x"));
+   }
+
+   std::vector<RResultHandle> v(sums.begin(), sums.end());
+   ROOT::RDF::RunGraphs(v);
+
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(dfs[i].GetNRuns(), 1u);
+      EXPECT_DOUBLE_EQ(sums[i].GetValue(), 45. * i);
+   }
+}
+
 TEST(RunGraphs, RunGraphsWithDisabledIMT)
 {
 #ifdef R__USE_IMT
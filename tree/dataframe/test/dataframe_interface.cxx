@@ -5,6 +5,8 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TEnv.h"
+#include "TInterpreter.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
@@ -877,3 +879,64 @@ TEST(RDataFrameUtils, RegexWithFriendsInJittedFilters)
    EXPECT_EQ(df.Filter("fr.x < 0 && x > 0").Count().GetValue(), 1);
    EXPECT_EQ(df.Filter("x > 0 && fr.x < 0").Count().GetValue(), 1);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const char *cacheDir = "dataframe_interface_jitcache";
+   gEnv->SetValue("RDataFrame.JitCacheDir", cacheDir);
+
+   auto makeGraph = [] {
+      auto df = ROOT::RDataFrame(10).Define("x", "int(rdfentry_)").Filter("x % 2 == 0");
+      return df.Sum<int>("x");
+   };
+   // The first event loop compiles the library, the second one loads it
+   EXPECT_EQ(*makeGraph(), 20);
+   EXPECT_EQ(*makeGraph(), 20);
+
+   void *dir = gSystem->OpenDirectory(cacheDir);
+   ASSERT_NE(dir, nullptr);
+   bool foundLibrary = false;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      if (name == "." || name == "..")
+         continue;
+      if (name.find(std::string(".") + gSystem->GetSoExt()) != std::string::npos)
+         foundLibrary = true;
+      gSystem->Unlink((std::string(cacheDir) + "/" + name).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+   gEnv->SetValue("RDataFrame.JitCacheDir", "");
+
+   EXPECT_TRUE(foundLibrary);
+}
+
+TEST(RDataFrameInterface, SharedJittedNodes)
+{
+   gInterpreter->Declare(
+      "namespace RDFSharedJittedNodes { int nCalls = 0; int Count(int x) { ++nCalls; return x; } }");
+   auto getNCalls = [] { return gInterpreter->Calc("RDFSharedJittedNodes::nCalls"); };
+
+   auto d = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+
+   // identical unnamed filters on the same node are evaluated once per entry
+   auto c1 = d.Filter("RDFSharedJittedNodes::Count(x) > 4").Count();
+   auto c2 = d.Filter("RDFSharedJittedNodes::Count(x) > 4").Count();
+   EXPECT_EQ(*c1, 5u);
+   EXPECT_EQ(*c2, 5u);
+   EXPECT_EQ(getNCalls(), 10);
+
+   // named filters are not shared
+   auto n1 = d.Filter("RDFSharedJittedNodes::Count(x) > 4", "f1").Count();
+   auto n2 = d.Filter("RDFSharedJittedNodes::Count(x) > 4", "f2").Count();
+   EXPECT_EQ(*n1, 5u);
+   EXPECT_EQ(*n2, 5u);
+   EXPECT_EQ(getNCalls(), 30);
+
+   // identical defines are evaluated once per entry, also in different branches
+   auto s1 = d.Define("y", "RDFSharedJittedNodes::Count(x)").Sum<int>("y");
+   auto s2 = d.Filter([] { return true; }).Define("y", "RDFSharedJittedNodes::Count(x)").Sum<int>("y");
+   EXPECT_EQ(*s1, 45);
+   EXPECT_EQ(*s2, 45);
+   EXPECT_EQ(getNCalls(), 40);
+}
@@ -8,10 +8,12 @@
 
 #include <ROOT/TestSupport.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RMemoryBudget.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
 #include <TFile.h>
 #include <TGraph.h>
+#include <TH2.h>
 #include <TInterpreter.h>
 #include <TRandom.h>
 #include <TROOT.h>
@@ -20,10 +22,16 @@
 
 #include <algorithm> // std::sort
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include <set>
 #include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 
 #include "MaxSlotHelper.h"
 #include "SimpleFiller.h"
@@ -519,6 +527,205 @@ TEST_P(RDFSimpleTests, TakeCarrays)
    gSystem->Unlink(fileName);
 }
 
+// Variable-length collections of fundamental types are read basket by basket with TBranch bulk I/O
+TEST_P(RDFSimpleTests, VarLengthArraysBulk)
+{
+   const auto treeName = "t";
+   const std::vector<std::string> fileNames{"VarLengthArraysBulk_1.root", "VarLengthArraysBulk_2.root"};
+   const int nEvents = 10000;
+
+   for (const auto &fileName : fileNames) {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree t(treeName, treeName);
+      t.SetAutoFlush(1000);
+      int n = 0;
+      float arr[8];
+      std::vector<float> vec;
+      t.Branch("n", &n);
+      t.Branch("arr", arr, "arr[n]/F");
+      t.Branch("vec", &vec);
+      for (int i = 0; i < nEvents; ++i) {
+         n = i % 8;
+         vec.clear();
+         for (int j = 0; j < n; ++j) {
+            arr[j] = i + j;
+            vec.push_back(i - j);
+         }
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c(treeName);
+   for (const auto &fileName : fileNames)
+      c.Add(fileName.c_str());
+   RDataFrame df(c);
+   auto nWrong = df.Filter(
+                      [](int n, const RVec<float> &arr, const RVec<float> &vec) {
+                         if (arr.size() != static_cast<std::size_t>(n) || vec.size() != static_cast<std::size_t>(n))
+                            return true;
+                         for (int j = 0; j < n; ++j) {
+                            if (arr[j] != arr[0] + j || vec[j] != arr[0] - j)
+                               return true;
+                         }
+                         return false;
+                      },
+                      {"n", "arr", "vec"})
+                    .Count();
+   auto sumArr = df.Define("s", [](const RVec<float> &arr) { return static_cast<double>(Sum(arr)); }, {"arr"})
+                    .Sum<double>("s");
+   EXPECT_EQ(0u, *nWrong);
+
+   double expectedSum = 0;
+   for (int i = 0; i < nEvents; ++i) {
+      for (int j = 0; j < i % 8; ++j)
+         expectedSum += i + j;
+   }
+   EXPECT_DOUBLE_EQ(2 * expectedSum, *sumArr);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+// In bulk mode, filters and defines are evaluated once per entry and the results match the entry-by-entry mode
+TEST_P(RDFSimpleTests, BulkProcessing)
+{
+   const ULong64_t nEntries = 1000;
+   auto makeGraph = [&](RDataFrame &df, std::atomic<ULong64_t> &nDefineCalls) {
+      auto d = df.Define("x",
+                         [&nDefineCalls](ULong64_t e) {
+                            ++nDefineCalls;
+                            return static_cast<double>(e % 37);
+                         },
+                         {"rdfentry_"})
+                  .Define("y", "x * 2");
+      auto f1 = d.Filter([](double x) { return x > 10; }, {"x"}, "f1");
+      auto f2 = f1.Filter("y < 60", "f2");
+      std::vector<RResultPtr<double>> sums{f1.Sum<double>("x"), f2.Sum<double>("y"), d.Sum<double>("y")};
+      auto count = f2.Count();
+      auto entries = f2.Take<ULong64_t>("rdfentry_");
+      auto report = df.Report();
+      return std::make_tuple(sums, count, entries, report);
+   };
+
+   RDataFrame ref(nEntries);
+   std::atomic<ULong64_t> nRefCalls{0};
+   auto refResults = makeGraph(ref, nRefCalls);
+
+   RDataFrame bulk(nEntries);
+   // not a divisor of the number of entries, such that the last range is smaller
+   bulk.SetBulkSize(64);
+   std::atomic<ULong64_t> nBulkCalls{0};
+   auto bulkResults = makeGraph(bulk, nBulkCalls);
+
+   for (std::size_t i = 0; i < std::get<0>(refResults).size(); ++i)
+      EXPECT_DOUBLE_EQ(*std::get<0>(refResults)[i], *std::get<0>(bulkResults)[i]);
+   EXPECT_EQ(*std::get<1>(refResults), *std::get<1>(bulkResults));
+   auto refEntries = *std::get<2>(refResults);
+   auto bulkEntries = *std::get<2>(bulkResults);
+   std::sort(refEntries.begin(), refEntries.end());
+   std::sort(bulkEntries.begin(), bulkEntries.end());
+   EXPECT_EQ(refEntries, bulkEntries);
+   EXPECT_EQ(nEntries, nRefCalls);
+   EXPECT_EQ(nEntries, nBulkCalls);
+
+   auto &refReport = *std::get<3>(refResults);
+   auto &bulkReport = *std::get<3>(bulkResults);
+   for (const auto name : {"f1", "f2"}) {
+      EXPECT_EQ(refReport[name].GetAll(), bulkReport[name].GetAll());
+      EXPECT_EQ(refReport[name].GetPass(), bulkReport[name].GetPass());
+   }
+
+   EXPECT_THROW(bulk.SetBulkSize(0), std::runtime_error);
+}
+
+// In adaptive mode, the cheap filter that rejects most entries of a chain is evaluated first once it is identified
+TEST_P(RDFSimpleTests, FilterReordering)
+{
+   const ULong64_t nEntries = 100000;
+   RDataFrame df(nEntries);
+   df.SetFilterReordering();
+   std::atomic<ULong64_t> nCalls{0};
+   auto d = df.Define("x", [](ULong64_t e) { return static_cast<int>(e % 10); }, {"rdfentry_"});
+   auto f = d.Filter(
+                [&nCalls](int x) {
+                   ++nCalls;
+                   return x >= 0;
+                },
+                {"x"})
+               .Filter([](int x) { return x == 0; }, {"x"});
+   auto count = f.Filter([](int x) { return x < 5; }, {"x"}, "named").Count();
+   auto report = df.Report();
+
+   EXPECT_EQ(*count, nEntries / 10);
+   EXPECT_EQ((*report)["named"].GetAll(), nEntries / 10);
+   EXPECT_EQ((*report)["named"].GetPass(), nEntries / 10);
+   // the first filter is evaluated for every entry while learning, then only for the entries that pass the second one
+   EXPECT_LT(nCalls, NSLOTS * 1000 + nEntries / 10 + 1);
+}
+
+// Batch defines see whole bulk ranges, or single entries outside of bulk processing mode
+TEST_P(RDFSimpleTests, DefineBatch)
+{
+   const ULong64_t nEntries = 1000;
+   auto makeGraph = [](RDataFrame &df, std::atomic<ULong64_t> &nCalls) {
+      auto d = df.Define("x", [](ULong64_t e) { return static_cast<double>(e); }, {"rdfentry_"})
+                  .DefineBatch("y",
+                               [&nCalls](unsigned int, ROOT::RVecD &out, const ROOT::RVecD &x) {
+                                  ++nCalls;
+                                  out = 2. * x;
+                               },
+                               {"x"})
+                  .Filter([](double y) { return y < 1000.; }, {"y"});
+      return std::make_pair(d.Sum<double>("y"), d.Count());
+   };
+   RDataFrame single(nEntries);
+   std::atomic<ULong64_t> nSingleCalls{0};
+   auto singleResults = makeGraph(single, nSingleCalls);
+   RDataFrame bulk(nEntries);
+   bulk.SetBulkSize(100);
+   std::atomic<ULong64_t> nBulkCalls{0};
+   auto bulkResults = makeGraph(bulk, nBulkCalls);
+
+   EXPECT_DOUBLE_EQ(*singleResults.first, 249500.);
+   EXPECT_EQ(*singleResults.second, 500ull);
+   EXPECT_DOUBLE_EQ(*bulkResults.first, 249500.);
+   EXPECT_EQ(*bulkResults.second, 500ull);
+   EXPECT_EQ(nSingleCalls, nEntries);
+   // at most one partial batch per task, and there are about two tasks per slot
+   EXPECT_LT(nBulkCalls, nEntries / 100 + 2 * NSLOTS + 1);
+
+   auto wrongSize = RDataFrame(1).DefineBatch("z", [](unsigned int, ROOT::RVecI &out) { out.push_back(1); }).Count();
+   EXPECT_THROW(wrongSize.GetValue(), std::runtime_error);
+}
+
+// The RVecs returned by the Defines are copied out of the per-slot arenas, also when the Define reads another one
+TEST_P(RDFSimpleTests, RVecArenas)
+{
+   const ULong64_t nEntries = 1000;
+   auto makeGraph = [](RDataFrame &df) {
+      auto d = df.Define("v", [](ULong64_t e) { return ROOT::RVec<double>(e % 100, e); }, {"rdfentry_"})
+                  .Define("w", [](const ROOT::RVec<double> &v) { return (v * 2.)[v > 10.]; }, {"v"})
+                  .Define("n", [](const ROOT::RVec<double> &w) { return w.size(); }, {"w"});
+      return std::make_pair(d.Take<ROOT::RVec<double>>("w"), d.Sum<std::size_t>("n"));
+   };
+   RDataFrame ref(nEntries);
+   auto refResults = makeGraph(ref);
+   RDataFrame arenas(nEntries);
+   arenas.SetRVecArenas();
+   auto arenaResults = makeGraph(arenas);
+
+   EXPECT_EQ(*refResults.second, *arenaResults.second);
+   auto sortedValues = [](const std::vector<ROOT::RVec<double>> &vs) {
+      std::vector<std::vector<double>> res;
+      for (const auto &v : vs)
+         res.emplace_back(v.begin(), v.end());
+      std::sort(res.begin(), res.end());
+      return res;
+   };
+   EXPECT_EQ(sortedValues(*refResults.first), sortedValues(*arenaResults.first));
+}
+
 TEST_P(RDFSimpleTests, Reduce)
 {
    auto d = RDataFrame(5).DefineSlotEntry("x", [](unsigned int, ULong64_t e) { return static_cast<int>(e) + 1; });
@@ -849,6 +1056,53 @@ TEST_P(RDFSimpleTests, HistosOneWeightPerEvent)
    EXPECT_DOUBLE_EQ(h3->GetMean(), 2.);
 }
 
+TEST_P(RDFSimpleTests, HistosWithUniformBins)
+{
+   // values with under/overflows and NaNs, filled from more entries than the buffers of the fast filling path hold
+   const auto nEntries = 5000u;
+   auto value = [](ULong64_t e) { return e % 97 == 0 ? std::nan("") : -1. + 0.0007 * e; };
+   auto weight = [](ULong64_t e) { return 0.5 + (e % 3); };
+   auto d = RDataFrame(nEntries)
+               .Define("x", value, {"rdfentry_"})
+               .Define("y", [](double x) { return float(2. * x); }, {"x"})
+               .Define("w", weight, {"rdfentry_"});
+   auto h1 = d.Histo1D<double>({"h1", "h1", 32, -0.5, 2.5}, "x");
+   auto h1w = d.Histo1D<double, double>({"h1w", "h1w", 32, -0.5, 2.5}, "x", "w");
+   auto h2 = d.Histo2D<double, float>({"h2", "h2", 16, -0.5, 2.5, 8, -1., 5.}, "x", "y");
+   auto h2w = d.Histo2D<double, float, double>({"h2w", "h2w", 16, -0.5, 2.5, 8, -1., 5.}, "x", "y", "w");
+
+   TH1D r1("r1", "r1", 32, -0.5, 2.5);
+   TH1D r1w("r1w", "r1w", 32, -0.5, 2.5);
+   TH2D r2("r2", "r2", 16, -0.5, 2.5, 8, -1., 5.);
+   TH2D r2w("r2w", "r2w", 16, -0.5, 2.5, 8, -1., 5.);
+   for (ULong64_t e = 0; e < nEntries; ++e) {
+      const auto x = value(e);
+      const auto y = float(2. * x);
+      r1.Fill(x);
+      r1w.Fill(x, weight(e));
+      r2.Fill(x, y);
+      r2w.Fill(x, y, weight(e));
+   }
+
+   auto checkHistos = [](const TH1 &h, const TH1 &r) {
+      EXPECT_EQ(h.GetEntries(), r.GetEntries());
+      EXPECT_EQ(h.GetSumw2N(), r.GetSumw2N());
+      for (int bin = 0; bin < r.GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(h.GetBinContent(bin), r.GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(h.GetBinError(bin), r.GetBinError(bin));
+      }
+      std::array<double, TH1::kNstat> stats, rStats;
+      h.GetStats(stats.data());
+      r.GetStats(rStats.data());
+      for (int i = 0; i < 7; ++i)
+         EXPECT_NEAR(stats[i], rStats[i], 1e-9 * std::abs(rStats[i]));
+   };
+   checkHistos(*h1, r1);
+   checkHistos(*h1w, r1w);
+   checkHistos(*h2, r2);
+   checkHistos(*h2w, r2w);
+}
+
 TEST_P(RDFSimpleTests, ManyRangesPerWorker)
 {
    auto filename = "ManyRangesPerWorker_file.root";
@@ -1014,6 +1268,111 @@ TEST_P(RDFSimpleTests, FillWithCustomClassJitted)
    EXPECT_EQ(h.GetEntries(), 10);
 }
 
+TEST_P(RDFSimpleTests, ResultCache)
+{
+   const auto cacheName = std::string("RDFSimpleTests_ResultCache") + (GetParam() ? "MT" : "") + ".root";
+   gSystem->Unlink(cacheName.c_str());
+
+   // book the same analysis in several RDataFrames, as several processes would
+   auto book = [&](ROOT::RDataFrame &df, const char *cut) {
+      df.SetResultCache(cacheName);
+      auto d = df.Define("x", "rdfentry_ * 0.5").Filter(cut);
+      return std::make_tuple(d.Count(), d.Sum<double>("x"), d.Histo1D({"h", "h", 10, 0., 50.}, "x"));
+   };
+
+   ROOT::RDataFrame df1(100);
+   auto results1 = book(df1, "x > 10");
+   EXPECT_EQ(*std::get<0>(results1), 79ull);
+   EXPECT_EQ(df1.GetNRuns(), 1u);
+
+   // all results are read from the cache
+   ROOT::RDataFrame df2(100);
+   auto results2 = book(df2, "x > 10");
+   EXPECT_EQ(*std::get<0>(results2), *std::get<0>(results1));
+   EXPECT_DOUBLE_EQ(*std::get<1>(results2), *std::get<1>(results1));
+   EXPECT_EQ(std::get<2>(results2)->GetEntries(), std::get<2>(results1)->GetEntries());
+   EXPECT_DOUBLE_EQ(std::get<2>(results2)->GetMean(), std::get<2>(results1)->GetMean());
+   EXPECT_EQ(df2.GetNRuns(), 0u);
+
+   // results that depend on compiled code are always recomputed
+   auto ySum = [&](ROOT::RDataFrame &df) {
+      df.SetResultCache(cacheName);
+      return df.Define("y", [](ULong64_t e) { return e * 0.5; }, {"rdfentry_"}).Sum<double>("y");
+   };
+   ROOT::RDataFrame df3(100);
+   EXPECT_DOUBLE_EQ(*ySum(df3), 2475.);
+   ROOT::RDataFrame df4(100);
+   EXPECT_DOUBLE_EQ(*ySum(df4), 2475.);
+   EXPECT_EQ(df4.GetNRuns(), 1u);
+
+   // a different graph or a different dataset gives different results
+   ROOT::RDataFrame df5(100);
+   auto results5 = book(df5, "x > 20");
+   EXPECT_EQ(*std::get<0>(results5), 59ull);
+   EXPECT_EQ(df5.GetNRuns(), 1u);
+   ROOT::RDataFrame df6(50);
+   auto results6 = book(df6, "x > 10");
+   EXPECT_EQ(*std::get<0>(results6), 29ull);
+   EXPECT_EQ(df6.GetNRuns(), 1u);
+
+   gSystem->Unlink(cacheName.c_str());
+}
+
+// The nodes of a profiled event loop are timed under the nodes that evaluated them
+TEST_P(RDFSimpleTests, Profiling)
+{
+   RDataFrame df(1000);
+   EXPECT_THROW(df.GetProfileReport(), std::runtime_error);
+   df.SetProfiling();
+   auto d = df.Define("x", [](ULong64_t e) { return static_cast<double>(e); }, {"rdfentry_"});
+   auto sum = d.Filter([](double x) { return x >= 500.; }, {"x"}).Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum, 374750.);
+
+   const auto report = df.GetProfileReport();
+   std::istringstream lines(report);
+   bool foundDefine = false;
+   for (std::string line; std::getline(lines, line);) {
+      if (line.rfind("Define x(rdfentry_) ", 0) == 0) {
+         foundDefine = true;
+         // evaluated once per entry, by the filter
+         EXPECT_EQ(std::stoull(line.substr(line.find_first_not_of(' ', 20))), 1000ull) << report;
+      }
+   }
+   EXPECT_TRUE(foundDefine) << report;
+   EXPECT_NE(report.find("Filter(x)"), std::string::npos) << report;
+   EXPECT_NE(report.find("Sum(x)"), std::string::npos) << report;
+
+   const auto stacks = df.GetProfileStacks();
+   EXPECT_NE(stacks.find("RDataFrame;Sum(x);Filter(x);Define x(rdfentry_)"), std::string::npos) << stacks;
+
+   // the measurements of the last profiled event loop are kept
+   df.SetProfiling(false);
+   EXPECT_EQ(*d.Count(), 1000ull);
+   EXPECT_EQ(df.GetProfileStacks(), stacks);
+}
+
+TEST_P(RDFSimpleTests, MemoryReport)
+{
+   using ROOT::Experimental::RMemoryBudget;
+   RDataFrame df(100000);
+   EXPECT_THROW(df.GetMemoryReport(), std::runtime_error);
+   auto entries = df.Take<ULong64_t>("rdfentry_");
+   EXPECT_EQ(entries->size(), 100000u);
+   // the vectors of the slots are released when they are merged
+   EXPECT_GE(RMemoryBudget::GetPeak(RMemoryBudget::kTakeResults), 100000 * sizeof(ULong64_t));
+   EXPECT_EQ(RMemoryBudget::GetUsage(RMemoryBudget::kTakeResults), 0u);
+   const auto report = df.GetMemoryReport();
+   EXPECT_NE(report.find("takeResults"), std::string::npos) << report;
+
+   // the limit is soft: the event loop runs, with a warning
+   df.SetMemoryLimit(1024);
+   ROOT::TestSupport::CheckDiagsRAII diagRAII;
+   diagRAII.requiredDiag(kWarning, "Run", "The tracked memory peaked at", /*matchFullMessage=*/false);
+   EXPECT_EQ(df.Take<ULong64_t>("rdfentry_")->size(), 100000u);
+   EXPECT_EQ(RMemoryBudget::GetLimit(), 0u);
+   EXPECT_NE(df.GetMemoryReport().find("limit"), std::string::npos);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -3,6 +3,7 @@
 #include <ROOT/RDFHelpers.hxx>
 #include <TSystem.h>
 
+#include <atomic>
 #include <thread> // std::thread::hardware_concurrency
 
 #include "SimpleFiller.h" // for VaryFill
@@ -1592,6 +1593,52 @@ TEST_P(RDFVary, ManyVariationsManyColumns)
    }
 }
 
+// In bulk mode, the variations of each entry are computed once and the results match the entry-by-entry mode
+TEST_P(RDFVary, BulkProcessing)
+{
+   const ULong64_t nEntries = 1000;
+   const int nVariations = 20;
+   auto makeGraph = [&](ROOT::RDataFrame &df, std::atomic<ULong64_t> &nVaryCalls, std::atomic<ULong64_t> &nCalls) {
+      auto d = df.Define("x", [](ULong64_t e) { return static_cast<double>(e % 37); }, {"rdfentry_"})
+                  .Vary("x",
+                        [&, nVariations](double x) {
+                           ++nVaryCalls;
+                           ROOT::RVecD v(nVariations);
+                           for (int i = 0; i < nVariations; ++i)
+                              v[i] = x + i;
+                           return v;
+                        },
+                        {"x"}, nVariations, "syst")
+                  .Define("y", [](ULong64_t e) { return static_cast<double>(e % 11); }, {"rdfentry_"})
+                  // does not depend on the variation, so it is shared by all the universes
+                  .Filter(
+                     [&nCalls](double y) {
+                        ++nCalls;
+                        return y > 2;
+                     },
+                     {"y"})
+                  .Filter([](double x) { return x < 30; }, {"x"});
+      return std::make_pair(VariationsFor(d.Sum<double>("x")), VariationsFor(d.Count()));
+   };
+
+   ROOT::RDataFrame ref(nEntries);
+   std::atomic<ULong64_t> nRefVaryCalls{0}, nRefCalls{0};
+   auto refResults = makeGraph(ref, nRefVaryCalls, nRefCalls);
+
+   ROOT::RDataFrame bulk(nEntries);
+   bulk.SetBulkSize(64);
+   std::atomic<ULong64_t> nBulkVaryCalls{0}, nBulkCalls{0};
+   auto bulkResults = makeGraph(bulk, nBulkVaryCalls, nBulkCalls);
+
+   for (const auto &name : refResults.first.GetKeys()) {
+      EXPECT_DOUBLE_EQ(refResults.first[name], bulkResults.first[name]) << name;
+      EXPECT_EQ(refResults.second[name], bulkResults.second[name]) << name;
+   }
+   EXPECT_EQ(nEntries, nBulkCalls);
+   // the variations are only computed for the entries that pass the shared filter
+   EXPECT_EQ(nRefVaryCalls, nBulkVaryCalls);
+}
+
 // instantiate single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFVary, ::testing::Values(false));
 
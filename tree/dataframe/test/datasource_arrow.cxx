@@ -113,6 +113,44 @@ TEST(RArrowDS, EntryRanges)
    EXPECT_EQ(6U, ranges[2].second);
 }
 
+TEST(RArrowDS, EntryRangesFollowChunks)
+{
+   // two columns with chunks of 4 + 2 and 1 + 3 + 2 entries
+   std::vector<std::int64_t> ages = {64, 50, 40, 30, 2, 0};
+   std::shared_ptr<Array> agesChunks[2];
+   arrow::ArrayFromVector<Int64Type, int64_t>({ages.begin(), ages.begin() + 4}, &agesChunks[0]);
+   arrow::ArrayFromVector<Int64Type, int64_t>({ages.begin() + 4, ages.end()}, &agesChunks[1]);
+   std::vector<double> heights = {180.0, 200.5, 1.7, 1.9, 1.0, 0.8};
+   std::shared_ptr<Array> heightsChunks[3];
+   arrow::ArrayFromVector<DoubleType, double>({heights.begin(), heights.begin() + 1}, &heightsChunks[0]);
+   arrow::ArrayFromVector<DoubleType, double>({heights.begin() + 1, heights.begin() + 4}, &heightsChunks[1]);
+   arrow::ArrayFromVector<DoubleType, double>({heights.begin() + 4, heights.end()}, &heightsChunks[2]);
+   auto table = Table::Make(schema({field("Age", arrow::int64()), field("Height", arrow::float64())}),
+                            {std::make_shared<arrow::ChunkedArray>(ArrayVector{agesChunks[0], agesChunks[1]}),
+                             std::make_shared<arrow::ChunkedArray>(
+                                ArrayVector{heightsChunks[0], heightsChunks[1], heightsChunks[2]})});
+
+   RArrowDS tds(table, {});
+   tds.SetNSlots(2U);
+   auto valsAge = tds.GetColumnReaders<Long64_t>("Age");
+   auto valsHeight = tds.GetColumnReaders<double>("Height");
+   tds.Initialize();
+   const auto ranges = tds.GetEntryRanges();
+   const std::vector<std::pair<ULong64_t, ULong64_t>> expected{{0, 1}, {1, 4}, {4, 6}};
+   EXPECT_EQ(ranges, expected);
+
+   auto slot = 0U;
+   for (auto &&range : ranges) {
+      tds.InitSlot(slot, range.first);
+      for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
+         tds.SetEntry(slot, i);
+         EXPECT_EQ(ages[i], **valsAge[slot]);
+         EXPECT_DOUBLE_EQ(heights[i], **valsHeight[slot]);
+      }
+      slot = (slot + 1) % 2;
+   }
+}
+
 TEST(RArrowDS, ColumnReaders)
 {
    RArrowDS tds(createTestTable(), {});
@@ -197,6 +197,57 @@ TEST(RCsvDS, ProgressiveReadingRDF)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ChunkedParsingEntryRanges)
+{
+   RCsvDS tds(fileName0);
+   tds.EnableChunkedParsing(40);
+   const auto nSlots = 2U;
+   tds.SetNSlots(nSlots);
+   auto names = tds.GetColumnReaders<std::string>("Name");
+   auto ages = tds.GetColumnReaders<Long64_t>("Age");
+   tds.Initialize();
+
+   const std::vector<std::string> namesRef = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
+   const std::vector<Long64_t> agesRef{60LL, 50LL, 40LL, 30LL, 1LL, -1LL};
+   ULong64_t nextEntry = 0ULL;
+   auto nCalls = 0U;
+   for (auto ranges = tds.GetEntryRanges(); !ranges.empty(); ranges = tds.GetEntryRanges()) {
+      EXPECT_LE(ranges.size(), nSlots);
+      auto slot = 0U;
+      for (auto &&range : ranges) {
+         EXPECT_EQ(nextEntry, range.first);
+         nextEntry = range.second;
+         tds.InitSlot(slot, range.first);
+         for (auto i : ROOT::TSeq<ULong64_t>(range.first, range.second)) {
+            tds.SetEntry(slot, i);
+            EXPECT_EQ(namesRef[i], *((std::string *)*names[slot]));
+            EXPECT_EQ(agesRef[i], *((Long64_t *)*ages[slot]));
+         }
+         tds.FinalizeSlot(slot);
+         slot++;
+      }
+      ++nCalls;
+   }
+   tds.Finalize();
+   EXPECT_EQ(6ULL, nextEntry);
+   EXPECT_GT(nCalls, 1U);
+}
+
+TEST(RCsvDS, ChunkedParsingRDF)
+{
+   for (auto fileName : {fileName0, fileName3}) {
+      auto tds = std::make_unique<RCsvDS>(fileName);
+      tds->EnableChunkedParsing(50);
+      ROOT::RDataFrame tdf(std::move(tds));
+      auto c = tdf.Count();
+      auto ages = tdf.Take<Long64_t>("Age");
+      auto maxHeight = tdf.Max<double>("Height");
+      EXPECT_EQ(6U, *c);
+      EXPECT_EQ(*ages, std::vector<Long64_t>({60LL, 50LL, 40LL, 30LL, 1LL, -1LL}));
+      EXPECT_DOUBLE_EQ(200.5, *maxHeight);
+   }
+}
+
 #ifndef NDEBUG
 
 TEST(RCsvDS, SetNSlotsTwice)
@@ -320,6 +371,19 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ChunkedParsingRDFMT)
+{
+   auto tds = std::make_unique<RCsvDS>(fileName0);
+   tds->EnableChunkedParsing(30);
+   ROOT::RDataFrame tdf(std::move(tds));
+   auto c = tdf.Count();
+   auto sumAge = tdf.Sum<Long64_t>("Age");
+   auto married = tdf.Filter("Married").Count();
+   EXPECT_EQ(6U, *c);
+   EXPECT_EQ(180LL, *sumAge);
+   EXPECT_EQ(3U, *married);
+}
+
 TEST(RCsvDS, SpecifyColumnTypes)
 {
    RCsvDS tds0(fileName0, true, ',', -1LL, {{"Age", 'D'}, {"Height", 'T'}}); // with headers
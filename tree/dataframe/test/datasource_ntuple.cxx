@@ -8,6 +8,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+
 using ROOT::Experimental::RNTupleDS;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
@@ -135,3 +138,155 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+TEST(RNTupleDS, ValueRangeCut)
+{
+   std::string fileName = "RNTupleDS_test_value_range.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetComputeValueRanges(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = static_cast<float>(i);
+         ntuple->Fill();
+         if ((i % 10) == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   EXPECT_THROW(ds->AddValueRangeCut("tag", 0.0, 1.0), std::runtime_error);
+   EXPECT_THROW(ds->AddValueRangeCut("nonexistent", 0.0, 1.0), std::runtime_error);
+   ds->AddValueRangeCut("pt", 25.0, 44.0);
+   ROOT::RDataFrame df(std::move(ds));
+   // Only the clusters [20, 30), [30, 40), [40, 50) need to be read
+   auto nRead = df.Count();
+   auto nSelected = df.Filter([](float pt) { return pt >= 25 && pt <= 44; }, {"pt"}).Count();
+   EXPECT_EQ(30ull, nRead.GetValue());
+   EXPECT_EQ(20ull, nSelected.GetValue());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, FilteredColumns)
+{
+   std::string fileName = "RNTupleDS_test_filtered_columns.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrJets = std::vector<float>(i % 3, 1.f);
+         ntuple->Fill();
+         if ((i % 10) == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   // "jets" is only read for entries that pass the filter and is thus loaded on demand, "R_rdf_sizeof_jets" shares
+   // the offset column with "jets" and is read for every entry
+   auto df = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fileName);
+   auto sumNJets = df.Sum<std::size_t>("R_rdf_sizeof_jets");
+   auto filtered = df.Filter([](float pt) { return pt > 94; }, {"pt"});
+   auto sumJets = filtered.Sum<ROOT::RVecF>("jets");
+   auto count = filtered.Count();
+   EXPECT_EQ(99u, sumNJets.GetValue());
+   EXPECT_EQ(5u, count.GetValue());
+   EXPECT_FLOAT_EQ(5.f, sumJets.GetValue());
+
+   std::remove(fileName.c_str());
+}
+
+// Collections of arithmetic types are read in place from the pages unless they span several pages
+TEST(RNTupleDS, CollectionsAcrossPages)
+{
+   std::string fileName = "RNTupleDS_test_collections_pages.root";
+   auto makeJets = [](int i) {
+      std::vector<float> jets(i % 7);
+      for (std::size_t j = 0; j < jets.size(); ++j)
+         jets[j] = static_cast<float>(i) + static_cast<float>(j) / 10.f;
+      return jets;
+   };
+   {
+      auto model = RNTupleModel::Create();
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto wrNested = model->MakeField<std::vector<std::vector<float>>>("nested");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      // 16 floats per page
+      options.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 200; ++i) {
+         *wrJets = makeJets(i);
+         *wrNested = {makeJets(i), makeJets(i + 1)};
+         ntuple->Fill();
+         if ((i % 50) == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto df = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fileName);
+   auto jets = df.Take<ROOT::RVecF>("jets");
+   auto nested = df.Take<ROOT::RVec<ROOT::RVecF>>("nested");
+   auto nMismatches = df.Define("nMismatches",
+                                [&makeJets](ULong64_t entry, const ROOT::RVecF &j) {
+                                   const auto expected = makeJets(static_cast<int>(entry));
+                                   return j.size() != expected.size() ||
+                                          !std::equal(j.begin(), j.end(), expected.begin());
+                                },
+                                {"rdfentry_", "jets"})
+                         .Sum<bool>("nMismatches");
+   ASSERT_EQ(200u, jets->size());
+   ASSERT_EQ(200u, nested->size());
+   EXPECT_EQ(0u, *nMismatches);
+   for (int i = 0; i < 200; ++i) {
+      const auto expected = makeJets(i);
+      EXPECT_TRUE(std::equal(expected.begin(), expected.end(), jets->at(i).begin(), jets->at(i).end()));
+      const auto expectedNext = makeJets(i + 1);
+      ASSERT_EQ(2u, nested->at(i).size());
+      EXPECT_TRUE(std::equal(expectedNext.begin(), expectedNext.end(), nested->at(i)[1].begin(),
+                             nested->at(i)[1].end()));
+   }
+
+   std::remove(fileName.c_str());
+}
+
+static void SnapshotToRNTupleTest(const std::string &fileName)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(100).Define("x", [](ULong64_t e) { return static_cast<float>(e); }, {"rdfentry_"});
+   auto snap = df.Snapshot<ULong64_t, float>("ntuple", fileName, {"rdfentry_", "x"}, opts);
+
+   auto sumX = snap->Sum<float>("x");
+   auto entries = snap->Take<std::uint64_t>("rdfentry_");
+   EXPECT_FLOAT_EQ(4950.f, sumX.GetValue());
+   auto sortedEntries = *entries;
+   std::sort(sortedEntries.begin(), sortedEntries.end());
+   ASSERT_EQ(100u, sortedEntries.size());
+   for (std::uint64_t i = 0; i < 100; ++i)
+      EXPECT_EQ(i, sortedEntries[i]);
+
+   opts.fMode = "UPDATE";
+   EXPECT_THROW(df.Snapshot<float>("ntuple", fileName, {"x"}, opts), std::invalid_argument);
+   opts.fMode = "RECREATE";
+   EXPECT_THROW(df.Snapshot<float>("dir/ntuple", fileName, {"x"}, opts), std::invalid_argument);
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, SnapshotToRNTuple)
+{
+   SnapshotToRNTupleTest("RNTupleDS_test_snapshot.root");
+}
+
+TEST(RNTupleDS, SnapshotToRNTupleMT)
+{
+   IMTRAII _;
+
+   SnapshotToRNTupleTest("RNTupleDS_test_snapshot_mt.root");
+}
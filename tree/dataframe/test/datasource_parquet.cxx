@@ -0,0 +1,132 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include <TROOT.h>
+#include <TSystem.h>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <arrow/io/file.h>
+#include <arrow/memory_pool.h>
+#include <arrow/table.h>
+#include <arrow/testing/builder.h>
+#include <parquet/arrow/writer.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ROOT::RDF;
+
+// 100 entries in 4 row groups of 25 entries
+class RParquetDSTest : public ::testing::Test {
+protected:
+   static constexpr const char *fFileName = "datasource_parquet.parquet";
+
+   static void SetUpTestCase()
+   {
+      std::vector<int64_t> xs(100);
+      std::iota(xs.begin(), xs.end(), 0);
+      std::vector<double> ys(xs.begin(), xs.end());
+      std::vector<std::string> names;
+      for (auto x : xs)
+         names.emplace_back("n" + std::to_string(x));
+
+      std::shared_ptr<arrow::Array> arrays[3];
+      arrow::ArrayFromVector<arrow::Int64Type, int64_t>(xs, &arrays[0]);
+      arrow::ArrayFromVector<arrow::DoubleType, double>(ys, &arrays[1]);
+      arrow::ArrayFromVector<arrow::StringType, std::string>(names, &arrays[2]);
+      auto schema = arrow::schema(
+         {arrow::field("x", arrow::int64()), arrow::field("y", arrow::float64()), arrow::field("name", arrow::utf8())});
+      auto table = arrow::Table::Make(schema, {arrays[0], arrays[1], arrays[2]});
+
+      auto outFile = arrow::io::FileOutputStream::Open(fFileName);
+      ASSERT_TRUE(outFile.ok());
+      auto status = parquet::arrow::WriteTable(*table, arrow::default_memory_pool(), *outFile, 25);
+      ASSERT_TRUE(status.ok()) << status.ToString();
+   }
+
+   static void TearDownTestCase() { gSystem->Unlink(fFileName); }
+};
+
+TEST_F(RParquetDSTest, ColumnNamesAndTypes)
+{
+   RParquetDS ds(fFileName);
+   EXPECT_EQ(ds.GetColumnNames(), (std::vector<std::string>{"x", "y", "name"}));
+   EXPECT_EQ(ds.GetTypeName("x"), "Long64_t");
+   EXPECT_EQ(ds.GetTypeName("y"), "double");
+   EXPECT_EQ(ds.GetTypeName("name"), "string");
+   EXPECT_EQ(ds.GetNRowGroups(), 4u);
+   EXPECT_FALSE(ds.HasColumn("z"));
+
+   RParquetDS projected(fFileName, {"y"});
+   EXPECT_EQ(projected.GetColumnNames(), std::vector<std::string>{"y"});
+   EXPECT_THROW(RParquetDS(fFileName, {"z"}), std::runtime_error);
+}
+
+TEST_F(RParquetDSTest, OneRangePerRowGroup)
+{
+   RParquetDS ds(fFileName);
+   ds.SetNSlots(1);
+   ds.Initialize();
+   const std::vector<std::pair<ULong64_t, ULong64_t>> expected{{0, 25}, {25, 50}, {50, 75}, {75, 100}};
+   EXPECT_EQ(ds.GetEntryRanges(), expected);
+}
+
+TEST_F(RParquetDSTest, ReadValues)
+{
+   auto df = MakeParquetDataFrame(fFileName);
+   auto sumX = df.Sum<Long64_t>("x");
+   auto sumY = df.Sum<double>("y");
+   auto names = df.Take<std::string>("name");
+   auto count = df.Count();
+   EXPECT_EQ(*sumX, 4950);
+   EXPECT_DOUBLE_EQ(*sumY, 4950.);
+   EXPECT_EQ(*count, 100ull);
+   ASSERT_EQ(names->size(), 100u);
+   EXPECT_EQ(names->at(42), "n42");
+}
+
+TEST_F(RParquetDSTest, SelectRowGroups)
+{
+   auto ds = std::make_unique<RParquetDS>(fFileName);
+   ds->SelectRowGroups("x", 30, 40);
+   ds->SetNSlots(1);
+   ds->Initialize();
+   const std::vector<std::pair<ULong64_t, ULong64_t>> expected{{25, 50}};
+   EXPECT_EQ(ds->GetEntryRanges(), expected);
+
+   auto selected = std::make_unique<RParquetDS>(fFileName);
+   selected->SelectRowGroups("y", 20, 55);
+   ROOT::RDataFrame df(std::move(selected));
+   auto entries = df.Filter("y >= 20 && y <= 55").Take<ULong64_t>("rdfentry_");
+   auto nRead = df.Count();
+   EXPECT_EQ(*nRead, 75ull);
+   ASSERT_EQ(entries->size(), 36u);
+   EXPECT_EQ(entries->front(), 20ull);
+
+   RParquetDS strings(fFileName);
+   EXPECT_THROW(strings.SelectRowGroups("name", 0, 1), std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST_F(RParquetDSTest, ReadValuesMT)
+{
+   ROOT::EnableImplicitMT(4);
+   auto skipFirst = std::make_unique<RParquetDS>(fFileName, std::vector<std::string>{"x"});
+   skipFirst->SelectRowGroups("x", 25, 1000);
+   ROOT::RDataFrame df(std::move(skipFirst));
+   auto sumX = df.Sum<Long64_t>("x");
+   auto count = df.Count();
+   EXPECT_EQ(*sumX, 4950 - 300);
+   EXPECT_EQ(*count, 75ull);
+   ROOT::DisableImplicitMT();
+}
+#endif
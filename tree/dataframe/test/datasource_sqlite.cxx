@@ -20,6 +20,8 @@ constexpr auto query0 = "SELECT * FROM test";
 constexpr auto query1 = "SELECT fint + 1, freal/1.0 as fmyreal, NULL, 'X', fblob FROM test";
 constexpr auto query2 = "SELECT fint, freal, fint FROM test";
 constexpr auto query3 = "SELECT fint, freal, ftext, fblob FROM test";
+constexpr auto query4 = "SELECT * FROM test ORDER BY fint";
+constexpr auto query5 = "SELECT fint, ftext FROM test WHERE fint > 1";
 constexpr auto epsilon = 0.001;
 
 TEST(RSqliteDS, Basics)
@@ -122,7 +124,8 @@ TEST(RSqliteDS, DuplicateColumns)
 
 TEST(RSqliteDS, ColumnReaders)
 {
-   RSqliteDS rds(fileName0, query0);
+   // Sorted results cannot be read in rowid ranges
+   RSqliteDS rds(fileName0, query4);
    const auto nSlots = 2U;
    ROOT_EXPECT_WARNING(rds.SetNSlots(nSlots), "SetNSlots",
                        "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
@@ -194,6 +197,31 @@ TEST(RSqliteDS, SetEntry)
    EXPECT_EQ(nullptr, **vnull[0]);
 }
 
+TEST(RSqliteDS, RowidRanges)
+{
+   RSqliteDS rds(fileName0, query5);
+   const auto nSlots = 2U;
+   rds.SetNSlots(nSlots);
+   auto vint = rds.GetColumnReaders<Long64_t>("fint");
+   auto vtext = rds.GetColumnReaders<std::string>("ftext");
+   rds.Initialize();
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(2U, ranges.size());
+   EXPECT_EQ(1U, ranges[0].first);
+   EXPECT_EQ(2U, ranges[0].second);
+   EXPECT_EQ(2U, ranges[1].first);
+   EXPECT_EQ(3U, ranges[1].second);
+   EXPECT_EQ(0U, rds.GetEntryRanges().size());
+
+   // The entries are the rowids, the first row does not pass the condition
+   rds.InitSlot(1, ranges[1].first);
+   rds.InitSlot(0, ranges[0].first);
+   EXPECT_FALSE(rds.SetEntry(0, ranges[0].first));
+   EXPECT_TRUE(rds.SetEntry(1, ranges[1].first));
+   EXPECT_EQ(2, **vint[1]);
+   EXPECT_EQ("2", **vtext[1]);
+}
+
 #ifdef R__USE_IMT
 
 TEST(RSqliteDS, IMT)
@@ -202,7 +230,7 @@ TEST(RSqliteDS, IMT)
    const auto nSlots = 4U;
    ROOT::EnableImplicitMT(nSlots);
 
-   ROOT::TestSupport::CheckDiagsRAII diagRAII{kWarning, "SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. Consider turning off IMT."};
+   // The table is read in rowid ranges by every slot
    auto rdf = MakeSqliteDataFrame(fileName0, query0);
    EXPECT_EQ(3, *rdf.Sum("fint"));
    EXPECT_NEAR(3.0, *rdf.Sum("freal"), epsilon);
@@ -217,6 +245,8 @@ TEST(RSqliteDS, IMT)
       "fblob");
    std::sort(sum_blob.begin(), sum_blob.end());
 
+   EXPECT_EQ(2, *MakeSqliteDataFrame(fileName0, query5).Sum("fint"));
+
    ROOT::DisableImplicitMT();
 
    ASSERT_EQ(2U, sum_blob.size());
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RCluster
 #define ROOT7_RCluster
 
+#include <ROOT/RMemoryBudget.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstdint>
@@ -133,8 +134,13 @@ class ROnDiskPageMapHeap : public ROnDiskPageMap {
 private:
    /// The memory region containing the on-disk pages.
    std::unique_ptr<unsigned char []> fMemory;
+   /// Accounts for the size of fMemory in the memory budget of the cluster pools
+   RMemoryBudget::RAllocation fAllocation;
 public:
-   explicit ROnDiskPageMapHeap(std::unique_ptr<unsigned char []> memory) : fMemory(std::move(memory)) {}
+   explicit ROnDiskPageMapHeap(std::unique_ptr<unsigned char[]> memory, std::size_t size = 0)
+      : fMemory(std::move(memory)), fAllocation(RMemoryBudget::kClusterPool, size)
+   {
+   }
    ROnDiskPageMapHeap(const ROnDiskPageMapHeap &other) = delete;
    ROnDiskPageMapHeap(ROnDiskPageMapHeap &&other) = default;
    ROnDiskPageMapHeap &operator =(const ROnDiskPageMapHeap &other) = delete;
@@ -20,6 +20,7 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <future>
@@ -50,6 +51,9 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+The compressed pages of the loaded clusters are accounted for in the RMemoryBudget. If the budget is under pressure,
+the pool stops preloading and only loads the requested cluster.
 */
 // clang-format on
 class RClusterPool {
@@ -63,6 +67,13 @@ private:
       RCluster::RKey fClusterKey;
    };
 
+   /// A bunch of clusters whose I/O has been submitted by RPageSource::LoadClustersAsync() but which possibly
+   /// has not yet arrived. Only used by the I/O thread.
+   struct RInFlightBunch {
+      std::vector<RReadItem> fReadItems;
+      std::vector<std::unique_ptr<RCluster>> fClusters;
+   };
+
    /// Request to decompress and if necessary unpack compressed pages. The unzipped pages
    /// are supposed to be pushed into the page pool by the page source.
    struct RUnzipItem {
@@ -130,8 +141,12 @@ private:
    /// Returns an index of an unused element in fPool; callers of this function (GetCluster() and WaitFor())
    /// make sure that a free slot actually exists
    size_t FindFreeSlot() const;
-   /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
+   /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool. If the page source
+   /// supports asynchronous I/O, the I/O thread keeps up to RPageSource::GetMaxInFlightClusterBunches() bunches in
+   /// flight and hands them over to the unzip thread in the order of their submission.
    void ExecReadClusters();
+   /// Waits for the I/O of the given bunch to finish and passes its clusters on to the unzip thread
+   void FinishReadBunch(RInFlightBunch &bunch);
    /// The unzip thread routine which takes a loaded cluster and passes it to fPageSource.UnzipCluster (which
    /// might be a no-op if IMT is off). Marks the cluster as ready to be picked up by the main thread.
    void ExecUnzipClusters();
@@ -154,7 +169,14 @@ public:
    /// and possibly pages of other columns, too.  If implicit multi-threading is turned on, the uncompressed pages
    /// of the returned cluster are already pushed into the page pool associated with the page source upon return.
    /// The cluster remains valid until the next call to GetCluster().
-   RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+   RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
+   {
+      return GetCluster(clusterId, columns, columns);
+   }
+   /// Like GetCluster() above but the following clusters are preloaded with the columns `preloadColumns`, which
+   /// may be a subset of `columns`. Columns of the requested cluster missing in `preloadColumns` are loaded on demand.
+   RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns,
+                        const RCluster::ColumnSet_t &preloadColumns);
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
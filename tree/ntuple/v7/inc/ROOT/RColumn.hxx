@@ -26,6 +26,7 @@
 #include <TError.h>
 
 #include <memory>
+#include <type_traits>
 
 namespace ROOT {
 namespace Experimental {
@@ -73,9 +74,40 @@ private:
    ColumnId_t fColumnIdSource = kInvalidColumnId;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   /// Computes the value range of the elements of a page. Only set for columns of arithmetic C++ types. Unlike
+   /// fElement, it remains bound to the C++ type when the column switches to a binary compatible column type.
+   RColumnValueRange (*fFnValueRange)(const void *buffer, std::size_t nElements) = nullptr;
+
+   template <typename CppT>
+   static RColumnValueRange ComputeValueRange(const void *buffer, std::size_t nElements)
+   {
+      return RColumnValueRange::Compute(static_cast<const CppT *>(buffer), nElements);
+   }
+   template <typename CppT>
+   static typename std::enable_if<std::is_arithmetic<CppT>::value && !std::is_same<CppT, bool>::value,
+                                  decltype(fFnValueRange)>::type
+   GetFnValueRange()
+   {
+      return &ComputeValueRange<CppT>;
+   }
+   template <typename CppT>
+   static typename std::enable_if<!std::is_arithmetic<CppT>::value || std::is_same<CppT, bool>::value,
+                                  decltype(fFnValueRange)>::type
+   GetFnValueRange()
+   {
+      return nullptr;
+   }
 
    RColumn(const RColumnModel &model, std::uint32_t index);
 
+   /// Replaces the column model and the element by the ones of the given, binary compatible type, e.g. of the
+   /// split encoded variant of the current type. Returns false if the element sizes do not match.
+   bool SwitchToType(EColumnType type);
+
+   /// Called on flush if adaptive sizing is enabled: resizes the empty write pages to the page size that the page
+   /// sink currently recommends for this column
+   void AdaptWritePages();
+
    /// Used in Append() and AppendV() to switch pages when the main page reached the target size
    /// The other page has been flushed when the main page reached 50%.
    void SwapWritePagesIfFull() {
@@ -104,6 +136,7 @@ public:
       R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      column->fFnValueRange = GetFnValueRange<CppT>();
       return column;
    }
 
@@ -306,6 +339,13 @@ public:
    void MapPage(const RClusterIndex &clusterIndex);
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
+   /// Returns the minimum and maximum of the page's elements; invalid if the column has no arithmetic C++ type
+   RColumnValueRange GetValueRange(const RPage &page) const
+   {
+      if (!fFnValueRange)
+         return RColumnValueRange();
+      return fFnValueRange(page.GetBuffer(), page.GetNElements());
+   }
    const RColumnModel &GetModel() const { return fModel; }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
@@ -50,6 +50,15 @@ enum class EColumnType {
    kInt32,
    kInt16,
    kInt8,
+   // Split ("byte-shuffled") variants of the above: the elements of a page are stored byte-plane by byte-plane,
+   // i.e. first the least significant bytes of all elements, then the second bytes, and so on. Index elements are
+   // additionally delta encoded and integers are zigzag encoded, so that small values result in many zero bytes.
+   kSplitIndex32,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
    kMax,
 };
 
@@ -260,7 +260,7 @@ public:
      \brief Perform a vector read operation on multiple objects.
      \param map A `MultiObjectRWOperation_t` that describes read operations to perform.
      \param cid An object class ID.
-     \return Number of operations that could not complete.
+     \return 0 if all the operations succeeded; a negative DAOS error number otherwise.
      */
    int ReadV(MultiObjectRWOperation_t &map, ObjClassId_t cid) { return VectorReadWrite(map, cid, &RDaosObject::Fetch); }
    int ReadV(MultiObjectRWOperation_t &map) { return ReadV(map, fDefaultObjectClass); }
@@ -269,7 +269,7 @@ public:
      \brief Perform a vector write operation on multiple objects.
      \param map A `MultiObjectRWOperation_t` that describes write operations to perform.
      \param cid An object class ID.
-     \return Number of operations that could not complete.
+     \return 0 if all the operations succeeded; a negative DAOS error number otherwise.
      */
    int WriteV(MultiObjectRWOperation_t &map, ObjClassId_t cid)
    {
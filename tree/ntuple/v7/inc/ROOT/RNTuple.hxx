@@ -32,6 +32,7 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
@@ -85,6 +86,15 @@ public:
 };
 #endif
 
+/// Runs the unzip tasks of a cluster one after the other on the calling thread, which is the background unzip thread
+/// of the cluster pool, see RNTupleReadOptions::SetUseBackgroundUnzip()
+class RNTupleSequentialTaskScheduler : public Detail::RPageStorage::RTaskScheduler {
+public:
+   void Reset() final {}
+   void AddTask(const std::function<void(void)> &taskFunc) final { taskFunc(); }
+   void Wait() final {}
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RNTupleReader
@@ -109,7 +119,8 @@ std::cout << "myNTuple has " << ntuple->GetNEntries() << " entries\n";
 // clang-format on
 class RNTupleReader {
 private:
-   /// Set as the page source's scheduler for parallel page decompression if IMT is on
+   /// Set as the page source's scheduler for parallel page decompression if IMT is on, or for the decompression on
+   /// the cluster pool's thread if requested by the read options
    /// Needs to be destructed after the pages source is destructed (an thus be declared before)
    std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fUnzipTasks;
 
@@ -440,6 +451,131 @@ public:
    const RNTupleModel *GetModel() const { return fModel.get(); }
 };
 
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread handle to fill entries into an RNTupleParallelWriter
+
+A fill context owns a clone of the writer's model and buffers the sealed (packed and compressed) pages of the
+current cluster. Once the cluster is full, its pages are handed over to the parallel writer in one go. A fill context
+must only be used by one thread at a time and it must be destructed before the parallel writer.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   /// Collects the sealed pages of the current cluster
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// Keeps track of the number of bytes written into the current cluster
+   std::size_t fUnzippedClusterSize = 0;
+   /// Limit for committing cluster no matter the other tunables
+   std::size_t fMaxUnzippedClusterSize;
+   /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
+   NTupleSize_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   /// Commits the remaining entries as a last cluster of this context
+   ~RNTupleFillContext();
+
+   /// Fill the default entry of the context's model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// Fill an entry created by CreateEntry() of this context.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.GetField()->Append(value);
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Hand the entries filled so far over to the parallel writer as a new cluster
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// The model of the context; its default entry is filled by Fill()
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled concurrently from several threads
+
+Every thread requests its own RNTupleFillContext by CreateFillContext() and fills entries into it. The contexts
+serialize and compress their pages independently. Complete clusters are committed to the shared page sink under a
+short lock, so no merging of partial files is necessary at the end. Clusters are written in the order in which they
+are committed; within a cluster, the entries keep the fill order of their context.
+
+~~~ {.cpp}
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", "out.root");
+// In every thread:
+auto context = writer->CreateFillContext();
+auto entry = context->CreateEntry();
+*entry->Get<float>("pt") = 42.0;
+context->Fill(*entry);
+~~~
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Protects fSink, fNEntries and the creation of fill contexts
+   std::mutex fMutex;
+   /// The page sink that writes the clusters of all the fill contexts
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The prototype for the models of the fill contexts. It is not frozen such that clones get unique model ids.
+   /// Needs to be destructed before fSink.
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The number of entries in all the committed clusters
+   NTupleSize_t fNEntries = 0;
+
+   /// Called by the fill contexts to write the sealed pages of a complete cluster with the given number of entries.
+   /// Returns the number of bytes written to storage.
+   std::uint64_t CommitCluster(std::span<Detail::RPageStorage::RSealedPageGroup> ranges, NTupleSize_t nEntries);
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null. The sink should be unbuffered because the fill contexts
+   /// already provide whole clusters of sealed pages.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   /// All fill contexts must have been destructed before
+   ~RNTupleParallelWriter();
+
+   /// Thread-safe creation of a new fill context
+   std::unique_ptr<RNTupleFillContext> CreateFillContext();
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RCollectionNTuple
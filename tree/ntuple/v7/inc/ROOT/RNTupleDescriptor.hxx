@@ -227,9 +227,11 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// Optional minimum and maximum of the page's elements, see RNTupleWriteOptions::SetComputeValueRanges()
+         RColumnValueRange fValueRange;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fValueRange == other.fValueRange;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -312,6 +314,8 @@ public:
    bool ContainsColumn(DescriptorId_t columnId) const;
    std::unordered_set<DescriptorId_t> GetColumnIds() const;
    std::uint64_t GetBytesOnStorage() const;
+   /// Merges the value ranges of all the pages of the column; invalid if any of the pages lacks a value range
+   RColumnValueRange GetValueRange(DescriptorId_t columnId) const;
    bool HasPageLocations() const { return fHasPageLocations; }
 };
 
@@ -18,11 +18,24 @@
 
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RCluster;
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +51,63 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates ntuples with identical schema at the level of sealed pages
+
+The merger appends the clusters of all the input page sources to the destination page sink. Pages are never
+unpacked. If the compression settings of an input cluster column match the compression of the destination, the
+compressed page payloads are copied verbatim (fast merge). Otherwise, the pages are decompressed and recompressed
+with the destination's compression settings.
+
+The input clusters are read in bunches by vector reads; the next bunch is requested asynchronously while the
+current one is written. The pages of a cluster are committed in one vector commit, which the file page sink writes
+in a single, large write request.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Input clusters are bunched for vector reads until a bunch has at least this many bytes on storage
+   static constexpr std::uint64_t kMinBunchSize = 64 * 1024 * 1024;
+
+   struct RCounters {
+      Detail::RNTuplePlainCounter &fNPageCopied;
+      Detail::RNTuplePlainCounter &fNPageResealed;
+      Detail::RNTuplePlainCounter &fSzRead;
+      Detail::RNTuplePlainCounter &fSzWritten;
+      Detail::RNTuplePlainCounter &fTimeWallMerge;
+      Detail::RNTupleTickCounter<Detail::RNTuplePlainCounter> &fTimeCpuMerge;
+   };
+
+   Detail::RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+   /// Used to decompress pages whose compression settings differ from the destination's ones
+   Detail::RNTupleDecompressor fDecompressor;
+
+   /// Commits the given, loaded clusters of the source to the destination. `columnMap` maps the source column ids
+   /// to the destination column ids.
+   void MergeClusters(const RNTupleDescriptor &sourceDesc, std::vector<std::unique_ptr<Detail::RCluster>> &clusters,
+                      const std::vector<DescriptorId_t> &columnMap, Detail::RPageSink &destination,
+                      NTupleSize_t &nEntries);
+
+public:
+   RNTupleMerger();
+   RNTupleMerger(const RNTupleMerger &other) = delete;
+   RNTupleMerger &operator=(const RNTupleMerger &other) = delete;
+   ~RNTupleMerger() = default;
+
+   /// Appends the entries of all the sources to the destination and finalizes the destination. The destination
+   /// must not be created yet; it is created from the schema of the first source. All the sources must have the
+   /// same fields and column types, otherwise an exception is thrown.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   /// Counts the verbatim copied and the recompressed pages as well as the merge throughput
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
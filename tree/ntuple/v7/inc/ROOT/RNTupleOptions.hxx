@@ -47,6 +47,15 @@ All page sink classes need to support the common options.
 */
 // clang-format on
 class RNTupleWriteOptions {
+public:
+   /// Controls whether pages are compressed in parallel by the tasks of the implicit multi-threading task arena.
+   /// kDefault uses parallel compression if implicit multi-threading is enabled, kOff always compresses sequentially.
+   enum class EImplicitMT {
+      kOff,
+      kDefault,
+   };
+
+private:
    int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
    ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
    /// Approximation of the target compressed cluster size
@@ -60,6 +69,20 @@ class RNTupleWriteOptions {
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
+   /// Parallel page compression requires buffered writing because the sealed pages of a cluster have to be kept
+   /// until they can be written in their original order on CommitCluster()
+   EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+   /// If set, integer, index, and floating point columns are stored in split encoding (byte planes), with
+   /// additional delta encoding for index columns and zigzag encoding for signed integer columns. This typically
+   /// improves the compression ratio at the cost of an extra pass over the page data.
+   bool fUseSplitEncoding = false;
+   /// If set, the minimum and maximum value of every page of columns of arithmetic type is stored in the page list.
+   /// Readers can use the value ranges to skip pages and clusters that cannot pass a selection.
+   bool fComputeValueRanges = false;
+   /// If set, the cluster size estimate follows the recently observed compression factor rather than the average
+   /// over all clusters, and the page size of every column is scaled by the column's compression factor relative to
+   /// the overall one. Thus, the compressed pages of all columns have about the same size.
+   bool fUseAdaptiveSizing = false;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -85,6 +108,18 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
+   void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
+
+   bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+   void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+
+   bool GetComputeValueRanges() const { return fComputeValueRanges; }
+   void SetComputeValueRanges(bool val) { fComputeValueRanges = val; }
+
+   bool GetUseAdaptiveSizing() const { return fUseAdaptiveSizing; }
+   void SetUseAdaptiveSizing(bool val) { fUseAdaptiveSizing = val; }
 };
 
 // clang-format off
@@ -129,12 +164,31 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If set and if the storage supports it, pages that are stored uncompressed and in their in-memory layout
+   /// are not read but memory mapped. The populated pages then point directly into the mapped region, which
+   /// avoids copying from the OS page cache into the cluster buffers.
+   bool fUseMemoryMap = false;
+   /// If set, unzipped pages are shared through the process-wide RPageCache among all page sources reading the
+   /// same ntuple from the same file, in particular among the clones used by multi-threaded RDataFrame. Every page
+   /// is then decompressed only once as long as it fits in the cache's memory budget.
+   bool fUseSharedPageCache = false;
+   /// If set, the pages of the clusters prefetched by the cluster pool are unzipped by its background thread while
+   /// the current entries are processed, such that a sequential reader on a single thread overlaps decompression with
+   /// its own work. With implicit multi-threading, the pages are unzipped in the background anyway, by parallel
+   /// tasks. Requires the cluster cache. The unzipped pages of the prefetched clusters use additional memory.
+   bool fUseBackgroundUnzip = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   bool GetUseMemoryMap() const { return fUseMemoryMap; }
+   void SetUseMemoryMap(bool val) { fUseMemoryMap = val; }
+   bool GetUseSharedPageCache() const { return fUseSharedPageCache; }
+   void SetUseSharedPageCache(bool val) { fUseSharedPageCache = val; }
+   bool GetUseBackgroundUnzip() const { return fUseBackgroundUnzip; }
+   void SetUseBackgroundUnzip(bool val) { fUseBackgroundUnzip = val; }
 };
 
 } // namespace Experimental
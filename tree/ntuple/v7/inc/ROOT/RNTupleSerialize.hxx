@@ -65,6 +65,8 @@ public:
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
 
+   static constexpr std::uint16_t kFlagValidValueRange = 0x01;
+
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
    struct REnvelopeLink {
@@ -162,6 +164,10 @@ public:
    static std::uint32_t SerializeUInt64(std::uint64_t val, void *buffer);
    static std::uint32_t DeserializeUInt64(const void *buffer, std::uint64_t &val);
 
+   /// IEEE-754 double precision floats are stored with the little-endian byte order of their bit pattern
+   static std::uint32_t SerializeDouble(double val, void *buffer);
+   static std::uint32_t DeserializeDouble(const void *buffer, double &val);
+
    static std::uint32_t SerializeString(const std::string &val, void *buffer);
    static RResult<std::uint32_t> DeserializeString(const void *buffer, std::uint32_t bufSize, std::string &val);
 
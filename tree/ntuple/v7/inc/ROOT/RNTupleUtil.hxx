@@ -18,7 +18,9 @@
 
 #include <cstdint>
 
+#include <algorithm>
 #include <string>
+#include <type_traits>
 
 #include <ROOT/RLogger.hxx>
 
@@ -122,6 +124,64 @@ struct RNTupleLocator {
    }
 };
 
+/// The smallest and the largest value of the elements of a page or of the pages of a column in a cluster.
+/// Value ranges are used to skip pages and clusters whose entries cannot pass a selection. They are only available
+/// for columns of arithmetic C++ types. For other columns, and for pages containing NaN values, the range is invalid.
+struct RColumnValueRange {
+   bool fIsValid = false;
+   double fMin = 0.0;
+   double fMax = 0.0;
+
+   RColumnValueRange() = default;
+   RColumnValueRange(double min, double max) : fIsValid(true), fMin(min), fMax(max) {}
+
+   /// Computes the range of the given values. For 64bit integers, the range is only valid if all values can be
+   /// represented exactly as a double.
+   template <typename T>
+   static RColumnValueRange Compute(const T *values, std::size_t nValues)
+   {
+      static_assert(std::is_arithmetic<T>::value, "value ranges require arithmetic types");
+      if (nValues == 0)
+         return RColumnValueRange();
+      T min = values[0];
+      T max = values[0];
+      for (std::size_t i = 0; i < nValues; ++i) {
+         // Only true for NaN
+         if (values[i] != values[i])
+            return RColumnValueRange();
+         min = std::min(min, values[i]);
+         max = std::max(max, values[i]);
+      }
+      constexpr double kMaxExact = 9007199254740992.0; // 2^53
+      if (std::is_integral<T>::value && (sizeof(T) > 4) &&
+          ((static_cast<double>(max) >= kMaxExact) || (static_cast<double>(min) <= -kMaxExact))) {
+         return RColumnValueRange();
+      }
+      return RColumnValueRange(static_cast<double>(min), static_cast<double>(max));
+   }
+
+   /// Widens the range such that it includes the other range; the result is invalid if either range is invalid
+   void Merge(const RColumnValueRange &other)
+   {
+      if (!fIsValid || !other.fIsValid) {
+         *this = RColumnValueRange();
+         return;
+      }
+      fMin = std::min(fMin, other.fMin);
+      fMax = std::max(fMax, other.fMax);
+   }
+
+   /// Returns false only if none of the values in the range can be in [min, max]
+   bool MayOverlap(double min, double max) const { return !fIsValid || ((fMax >= min) && (fMin <= max)); }
+
+   bool operator==(const RColumnValueRange &other) const
+   {
+      if (!fIsValid || !other.fIsValid)
+         return fIsValid == other.fIsValid;
+      return fMin == other.fMin && fMax == other.fMax;
+   }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -21,7 +21,12 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ROOT {
@@ -77,6 +82,95 @@ public:
    void ReturnPage(const RPage &page);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageCache
+\ingroup NTuple
+\brief A process-wide, thread-safe cache of unzipped page buffers shared among page sources
+
+Page sources that read the same ntuple from the same file, e.g. the clones of RNTupleDS in multi-threaded mode,
+can share their unzipped pages through the page cache so that every page is decompressed only once. Buffers are
+identified by the source (file and ntuple name), the cluster, the column, and the page number within the cluster.
+The cache has a memory budget; if it is exceeded, the least recently used buffers are evicted. Buffers are
+reference counted, so that evicted buffers stay valid for as long as page sources use them.
+*/
+// clang-format on
+class RPageCache {
+public:
+   static constexpr std::size_t kDefaultMemoryBudget = 512 * 1024 * 1024;
+
+   struct RKey {
+      std::uint64_t fSourceId = 0;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      NTupleSize_t fPageNo = 0;
+
+      bool operator==(const RKey &other) const
+      {
+         return fSourceId == other.fSourceId && fClusterId == other.fClusterId && fColumnId == other.fColumnId &&
+                fPageNo == other.fPageNo;
+      }
+   };
+
+private:
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const
+      {
+         std::size_t h = std::hash<std::uint64_t>()(key.fSourceId);
+         h ^= std::hash<DescriptorId_t>()(key.fClusterId) + 0x9e3779b9 + (h << 6) + (h >> 2);
+         h ^= std::hash<DescriptorId_t>()(key.fColumnId) + 0x9e3779b9 + (h << 6) + (h >> 2);
+         h ^= std::hash<NTupleSize_t>()(key.fPageNo) + 0x9e3779b9 + (h << 6) + (h >> 2);
+         return h;
+      }
+   };
+
+   struct REntry {
+      RKey fKey;
+      std::shared_ptr<unsigned char[]> fBuffer;
+      std::size_t fSize = 0;
+   };
+   using LruList_t = std::list<REntry>;
+
+   std::mutex fLock;
+   std::size_t fMemoryBudget = kDefaultMemoryBudget;
+   std::size_t fMemoryUsed = 0;
+   /// The most recently used entry is at the front
+   LruList_t fLruList;
+   std::unordered_map<RKey, LruList_t::iterator, RKeyHash> fIndex;
+   /// Maps source strings (file URL and ntuple name) to source ids
+   std::unordered_map<std::string, std::uint64_t> fSourceIds;
+
+   /// Removes least recently used entries until the memory used is within the budget. Requires fLock.
+   void EvictUnlocked();
+
+public:
+   /// The cache used by page sources that have RNTupleReadOptions::SetUseSharedPageCache() turned on
+   static RPageCache &GetShared();
+
+   RPageCache() = default;
+   explicit RPageCache(std::size_t memoryBudget) : fMemoryBudget(memoryBudget) {}
+   RPageCache(const RPageCache &) = delete;
+   RPageCache &operator=(const RPageCache &) = delete;
+   ~RPageCache() = default;
+
+   /// Returns a stable id for the given source string; equal strings result in the same id
+   std::uint64_t GetSourceId(const std::string &source);
+
+   /// Returns the buffer stored under the given key and marks it as most recently used, or nullptr if there is none
+   std::shared_ptr<unsigned char[]> Get(const RKey &key);
+   /// Adds a buffer of the given size in bytes to the cache and returns the buffer the cache holds for the key after
+   /// the operation. If a different thread added the same page in the meantime, that buffer is returned and the
+   /// given one is not inserted. Buffers larger than the memory budget are not cached and returned as is.
+   std::shared_ptr<unsigned char[]> Put(const RKey &key, std::shared_ptr<unsigned char[]> buffer, std::size_t size);
+
+   void SetMemoryBudget(std::size_t memoryBudget);
+   std::size_t GetMemoryBudget() const { return fMemoryBudget; }
+   std::size_t GetMemoryUsed() const { return fMemoryUsed; }
+   std::size_t GetNEntries() const { return fIndex.size(); }
+   /// Drops all entries; buffers that are still in use by page sources remain valid
+   void Clear();
+};
+
 } // namespace Detail
 
 } // namespace Experimental
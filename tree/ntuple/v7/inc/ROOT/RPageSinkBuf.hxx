@@ -126,6 +126,10 @@ private:
    /// Vector of buffered column pages. Indexed by column id.
    std::vector<RColumnBuf> fBufferedColumns;
 
+   /// Commits the cluster in the inner sink and takes over the locators of the inner sink's pages, such that
+   /// the page sizes on storage are known to this sink, too
+   std::uint64_t CommitInnerCluster(NTupleSize_t nEntries);
+
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
    RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
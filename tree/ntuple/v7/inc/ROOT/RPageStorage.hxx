@@ -87,6 +87,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Minimum and maximum of the page's elements, if known
+      RColumnValueRange fValueRange;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -200,6 +202,16 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Packed size and size on storage of the pages of a column, used to estimate the column's compression factor.
+   /// On every cluster commit, the previous values are halved such that recent clusters have more weight.
+   struct RColumnSizeStats {
+      double fNBytesPacked = 0;
+      double fNBytesOnStorage = 0;
+   };
+   /// Indexed by column id
+   std::vector<RColumnSizeStats> fColumnSizeStats;
+   /// Sum over all columns
+   RColumnSizeStats fTotalSizeStats;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
@@ -231,6 +243,9 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
       int compressionSetting, void *buf);
 
+   /// Returns the minimum and maximum of the page's elements if value ranges are enabled in the write options
+   RColumnValueRange ComputeValueRange(ColumnHandle_t columnHandle, const RPage &page) const;
+
    /// Enables the default set of metrics provided by RPageSink. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
    /// This set of counters can be extended by a subclass by calling `fMetrics.MakeCounter<...>()`.
@@ -257,6 +272,15 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor built so far: the schema given to Create() and the committed clusters
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
+   /// Returns the ratio of packed bytes to bytes on storage of the recently committed pages of the column or of all
+   /// columns, if the column id is invalid. Returns zero if no pages have been committed yet.
+   float GetCompressionFactor(DescriptorId_t columnId = kInvalidDescriptorId) const;
+   /// Returns the targeted uncompressed size of the column's pages. If adaptive sizing is enabled in the write options,
+   /// the page size given by the write options is scaled such that the compressed pages of all columns have about
+   /// the same size.
+   std::size_t GetApproxUnzippedPageSize(DescriptorId_t columnId) const;
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -357,6 +381,8 @@ protected:
       RNTupleAtomicCounter &fNClusterLoaded;
       RNTupleAtomicCounter &fNPageLoaded;
       RNTupleAtomicCounter &fNPagePopulated;
+      RNTupleAtomicCounter &fNPageMapped;
+      RNTupleAtomicCounter &fNPageCacheHit;
       RNTupleAtomicCounter &fTimeWallRead;
       RNTupleAtomicCounter &fTimeWallUnzip;
       RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
@@ -374,6 +400,11 @@ protected:
    RNTupleReadOptions fOptions;
    /// The active columns are implicitly defined by the model fields or views
    RCluster::ColumnSet_t fActiveColumns;
+   /// Clusters that the reader is known to not access, e.g. because of value range cuts. They are not preloaded.
+   std::unordered_set<DescriptorId_t> fSkippedClusters;
+   /// Active columns whose pages are rarely accessed. They are not preloaded but loaded once the first page of
+   /// a cluster is requested.
+   RCluster::ColumnSet_t fLazyColumns;
 
    /// Helper to unzip pages and header/footer; comprises a 16MB (kMAXZIPBUF) unzip buffer.
    /// Not all page sources need a decompressor (e.g. virtual ones for chains and friends don't), thus we
@@ -399,6 +430,9 @@ protected:
    /// GetMetrics() member function.
    void EnableDefaultMetrics(const std::string &prefix);
 
+   /// The columns that the cluster pool preloads, i.e. the active columns that are not lazy
+   RCluster::ColumnSet_t GetPreloadColumns() const;
+
    /// Note that the underlying lock is not recursive. See GetSharedDescriptorGuard() for further information.
    RExclDescriptorGuard GetExclDescriptorGuard() { return RExclDescriptorGuard(fDescriptor, fDescriptorLock); }
 
@@ -439,6 +473,16 @@ public:
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
    ColumnId_t GetColumnId(ColumnHandle_t columnHandle);
 
+   /// Marks clusters that won't be read such that the cluster pool does not preload them. Explicitly requested
+   /// clusters are still loaded. Must be set before reading starts.
+   void SetSkippedClusters(const std::unordered_set<DescriptorId_t> &clusterIds) { fSkippedClusters = clusterIds; }
+   bool IsClusterSkipped(DescriptorId_t clusterId) const { return fSkippedClusters.count(clusterId) > 0; }
+   /// Marks columns that are only read for a small fraction of the entries, e.g. because they are only accessed
+   /// after a selective cut. Instead of being preloaded together with the other active columns, the pages of lazy
+   /// columns are read from a cluster on first access. Must be set before reading starts.
+   void SetLazyColumns(const RCluster::ColumnSet_t &columnIds) { fLazyColumns = columnIds; }
+   bool IsColumnLazy(DescriptorId_t columnId) const { return fLazyColumns.count(columnId) > 0; }
+
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
@@ -459,6 +503,18 @@ public:
    /// LoadClusters() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
+   /// Like LoadClusters() but only submits the I/O requests without waiting for the data to arrive. The returned
+   /// clusters must be passed to WaitForClusters(), in the same grouping, before any of their pages is accessed.
+   /// The default implementation loads the clusters synchronously.
+   virtual std::vector<std::unique_ptr<RCluster>> LoadClustersAsync(std::span<RCluster::RKey> clusterKeys)
+   {
+      return LoadClusters(clusterKeys);
+   }
+   /// Blocks until the I/O of the clusters returned by a LoadClustersAsync() call is finished
+   virtual void WaitForClusters(std::vector<std::unique_ptr<RCluster>> & /* clusters */) {}
+   /// The number of LoadClustersAsync() calls that the page source can usefully keep in flight at the same time.
+   /// Page sources without asynchronous I/O return 1.
+   virtual unsigned int GetMaxInFlightClusterBunches() const { return 1; }
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
@@ -21,13 +21,16 @@
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RReadPlanner.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <array>
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -44,6 +47,7 @@ namespace Detail {
 
 class RClusterPool;
 class RPageAllocatorHeap;
+class RPageCache;
 class RPagePool;
 
 
@@ -58,6 +62,9 @@ The written file can be either in ROOT format or in RNTuple bare format.
 // clang-format on
 class RPageSinkFile : public RPageSink {
 private:
+   /// Vector commits up to this size are gathered in a single blob; larger ones are written page by page
+   static constexpr std::size_t kMaxSealedPageVBlobSize = 256 * 1024 * 1024;
+
    std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
 
    std::unique_ptr<Internal::RNTupleFileWriter> fWriter;
@@ -72,6 +79,8 @@ protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
    RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
    RNTupleLocator CommitSealedPageImpl(DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage) final;
+   /// Writes the given pages in one large, sequential blob
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges) final;
    std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
    RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
    void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
@@ -135,12 +144,21 @@ private:
    RCluster *fCurrentCluster = nullptr;
    /// An RRawFile is used to request the necessary byte ranges from a local or a remote file
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   /// Steers the coalescing of page reads into vector read requests, set according to the transport of fFile
+   ROOT::Internal::RReadPlanner::RSettings fReadPlannerSettings;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   /// The read requests of the LoadClustersAsync() calls that have not yet been waited for, keyed by the first
+   /// cluster of the bunch. Only accessed by the I/O thread of the cluster pool.
+   std::unordered_map<const RCluster *, std::vector<ROOT::Internal::RRawFile::RIOVec>> fPendingReadRequests;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Set in AttachImpl() if the shared page cache is enabled in the read options
+   RPageCache *fSharedPageCache = nullptr;
+   /// Identifies file and ntuple of this page source (and its clones) in the shared page cache
+   std::uint64_t fSharedPageCacheSourceId = 0;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -151,6 +169,13 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Returns true if memory mapping is enabled and the page is stored uncompressed, in its in-memory layout,
+   /// and suitably aligned. Such pages are not read into clusters but mapped on PopulatePage().
+   bool IsMappablePage(const RColumnElementBase &element,
+                       const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const;
+   /// Creates a page that points directly into a memory mapping of the file. The mapping is removed when the
+   /// page pool deletes the page.
+   RPage PopulatePageFromMap(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo);
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
@@ -184,6 +209,9 @@ public:
                        RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+   std::vector<std::unique_ptr<RCluster>> LoadClustersAsync(std::span<RCluster::RKey> clusterKeys) final;
+   void WaitForClusters(std::vector<std::unique_ptr<RCluster>> &clusters) final;
+   unsigned int GetMaxInFlightClusterBunches() const final;
 };
 
 
@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include <ROOT/RClusterPool.hxx>
+#include <ROOT/RMemoryBudget.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
@@ -105,56 +106,97 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
 
 void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
 {
+   // Queried once the first work item arrives because the page source is still being constructed when the
+   // I/O thread starts
+   unsigned int maxInFlightBunches = 0;
+   std::deque<RInFlightBunch> inFlightBunches;
+
    while (true) {
-      std::vector<RReadItem> readItems;
-      std::vector<RCluster::RKey> clusterKeys;
-      std::int64_t bunchId = -1;
+      std::vector<std::vector<RReadItem>> newBunches;
+      bool isShutdown = false;
       {
          std::unique_lock<std::mutex> lock(fLockWorkQueue);
-         fCvHasReadWork.wait(lock, [&]{ return !fReadQueue.empty(); });
+         // Only block on new work if there is no outstanding I/O that we could wait for instead
+         if (inFlightBunches.empty())
+            fCvHasReadWork.wait(lock, [&]{ return !fReadQueue.empty(); });
+         std::int64_t bunchId = -1;
          while (!fReadQueue.empty()) {
             if (fReadQueue.front().fClusterKey.fClusterId == kInvalidDescriptorId) {
                fReadQueue.pop();
-               return;
+               isShutdown = true;
+               break;
             }
 
-            if ((bunchId >= 0) && (fReadQueue.front().fBunchId != bunchId))
-               break;
-            readItems.emplace_back(std::move(fReadQueue.front()));
+            if (maxInFlightBunches == 0)
+               maxInFlightBunches = std::max(1u, fPageSource.GetMaxInFlightClusterBunches());
+
+            if ((bunchId < 0) || (fReadQueue.front().fBunchId != bunchId)) {
+               if (inFlightBunches.size() + newBunches.size() >= maxInFlightBunches)
+                  break;
+               newBunches.emplace_back();
+            }
+            newBunches.back().emplace_back(std::move(fReadQueue.front()));
             fReadQueue.pop();
-            bunchId = readItems.back().fBunchId;
-            clusterKeys.emplace_back(readItems.back().fClusterKey);
+            bunchId = newBunches.back().back().fBunchId;
          }
       }
 
-      auto clusters = fPageSource.LoadClusters(clusterKeys);
+      for (auto &readItems : newBunches) {
+         std::vector<RCluster::RKey> clusterKeys;
+         for (const auto &item : readItems)
+            clusterKeys.emplace_back(item.fClusterKey);
+         RInFlightBunch bunch;
+         bunch.fReadItems = std::move(readItems);
+         bunch.fClusters = fPageSource.LoadClustersAsync(clusterKeys);
+         inFlightBunches.emplace_back(std::move(bunch));
+      }
 
-      for (std::size_t i = 0; i < clusters.size(); ++i) {
-         // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
-         // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
-         bool discard = false;
-         {
-            std::unique_lock<std::mutex> lock(fLockWorkQueue);
-            for (auto &inFlight : fInFlightClusters) {
-               if (inFlight.fClusterKey.fClusterId != clusters[i]->GetId())
-                  continue;
-               discard = inFlight.fIsExpired;
-               break;
-            }
-         }
-         if (discard) {
-            clusters[i].reset();
-            readItems[i].fPromise.set_value(std::move(clusters[i]));
-         } else {
-            // Hand-over the loaded cluster pages to the unzip thread
-            std::unique_lock<std::mutex> lock(fLockUnzipQueue);
-            fUnzipQueue.emplace(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
-            fCvHasUnzipWork.notify_one();
-         }
+      if (isShutdown) {
+         // Nobody is waiting for the clusters anymore but the outstanding I/O must finish before the buffers go away
+         for (auto &bunch : inFlightBunches)
+            fPageSource.WaitForClusters(bunch.fClusters);
+         return;
       }
+
+      if (inFlightBunches.empty())
+         continue;
+
+      FinishReadBunch(inFlightBunches.front());
+      inFlightBunches.pop_front();
    } // while (true)
 }
 
+void ROOT::Experimental::Detail::RClusterPool::FinishReadBunch(RInFlightBunch &bunch)
+{
+   fPageSource.WaitForClusters(bunch.fClusters);
+
+   auto &clusters = bunch.fClusters;
+   auto &readItems = bunch.fReadItems;
+   for (std::size_t i = 0; i < clusters.size(); ++i) {
+      // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
+      // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
+      bool discard = false;
+      {
+         std::unique_lock<std::mutex> lock(fLockWorkQueue);
+         for (auto &inFlight : fInFlightClusters) {
+            if (inFlight.fClusterKey.fClusterId != clusters[i]->GetId())
+               continue;
+            discard = inFlight.fIsExpired;
+            break;
+         }
+      }
+      if (discard) {
+         clusters[i].reset();
+         readItems[i].fPromise.set_value(std::move(clusters[i]));
+      } else {
+         // Hand-over the loaded cluster pages to the unzip thread
+         std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+         fUnzipQueue.emplace(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
+         fCvHasUnzipWork.notify_one();
+      }
+   }
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) const
 {
@@ -232,8 +274,9 @@ public:
 } // anonymous namespace
 
 ROOT::Experimental::Detail::RCluster *
-ROOT::Experimental::Detail::RClusterPool::GetCluster(
-   DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
+ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
+                                                     const RCluster::ColumnSet_t &columns,
+                                                     const RCluster::ColumnSet_t &preloadColumns)
 {
    std::set<DescriptorId_t> keep;
    RProvides provide;
@@ -254,20 +297,27 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
       provideInfo.fColumnSet = columns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
+      // Under memory pressure, only the requested cluster is loaded and the preloaded ones are released
+      const unsigned int nProvide = RMemoryBudget::IsUnderPressure() ? 1 : 2 * fClusterBunchSize;
+      for (DescriptorId_t i = 0, next = clusterId; i < nProvide; ++i) {
          if (i == fClusterBunchSize)
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
          next = descriptorGuard->FindNextClusterId(cid);
+         // Clusters that the reader is going to skip are not preloaded
+         while ((next != kInvalidDescriptorId) && fPageSource.IsClusterSkipped(next))
+            next = descriptorGuard->FindNextClusterId(next);
          if (next == kInvalidDescriptorId)
             provideInfo.fFlags |= RProvides::kFlagLast;
 
-         provide.Insert(cid, provideInfo);
+         if (!provideInfo.fColumnSet.empty())
+            provide.Insert(cid, provideInfo);
 
          if (next == kInvalidDescriptorId)
             break;
          provideInfo.fFlags = 0;
+         provideInfo.fColumnSet = preloadColumns;
       }
    } // descriptorGuard
 
@@ -15,10 +15,13 @@
 
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RColumnModel.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 
 ROOT::Experimental::Detail::RColumn::RColumn(const RColumnModel& model, std::uint32_t index)
@@ -45,6 +48,8 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    switch (pageStorage->GetType()) {
    case EPageStorageType::kSink:
       fPageSink = static_cast<RPageSink*>(pageStorage); // the page sink initializes fWritePage on AddColumn
+      if (fPageSink->GetWriteOptions().GetUseSplitEncoding())
+         SwitchToType(RColumnElementBase::GetSplitType(fModel.GetType()));
       fHandleSink = fPageSink->AddColumn(fieldId, *this);
       fApproxNElementsPerPage = fPageSink->GetWriteOptions().GetApproxUnzippedPageSize() / fElement->GetSize();
       if (fApproxNElementsPerPage < 2)
@@ -58,12 +63,32 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
       fHandleSource = fPageSource->AddColumn(fieldId, *this);
       fNElements = fPageSource->GetNElements(fHandleSource);
       fColumnIdSource = fPageSource->GetColumnId(fHandleSource);
+      {
+         auto onDiskType =
+            fPageSource->GetSharedDescriptorGuard()->GetColumnDescriptor(fColumnIdSource).GetModel().GetType();
+         if (onDiskType != fModel.GetType()) {
+            if (onDiskType != RColumnElementBase::GetSplitType(fModel.GetType()) || !SwitchToType(onDiskType))
+               throw RException(R__FAIL("cannot read column of type " + RColumnElementBase::GetTypeName(onDiskType) +
+                                        " as " + RColumnElementBase::GetTypeName(fModel.GetType())));
+         }
+      }
       break;
    default:
       R__ASSERT(false);
    }
 }
 
+bool ROOT::Experimental::Detail::RColumn::SwitchToType(EColumnType type)
+{
+   if (type == fModel.GetType())
+      return true;
+   if (fElement->GetSize() * 8 != RColumnElementBase::GetBitsOnStorage(type))
+      return false;
+   fModel = RColumnModel(type, fModel.GetIsSorted());
+   fElement = RColumnElementBase::Generate(type);
+   return true;
+}
+
 void ROOT::Experimental::Detail::RColumn::Flush()
 {
    auto otherIdx = 1 - fWritePageIdx;
@@ -82,6 +107,27 @@ void ROOT::Experimental::Detail::RColumn::Flush()
    R__ASSERT(fWritePage[otherIdx].IsEmpty());
    fPageSink->CommitPage(fHandleSink, fWritePage[fWritePageIdx]);
    fWritePage[fWritePageIdx].Reset(fNElements);
+
+   if (fPageSink->GetWriteOptions().GetUseAdaptiveSizing())
+      AdaptWritePages();
+}
+
+void ROOT::Experimental::Detail::RColumn::AdaptWritePages()
+{
+   const std::uint32_t nElementsPerPage =
+      std::max<std::size_t>(2, fPageSink->GetApproxUnzippedPageSize(fHandleSink.fId) / fElement->GetSize());
+   // Avoid reallocating the write pages for small fluctuations of the compression factor
+   const auto difference = std::abs(static_cast<std::int64_t>(nElementsPerPage) - fApproxNElementsPerPage);
+   if (difference <= fApproxNElementsPerPage / 8)
+      return;
+
+   fApproxNElementsPerPage = nElementsPerPage;
+   for (auto &page : fWritePage) {
+      R__ASSERT(page.IsEmpty());
+      fPageSink->ReleasePage(page);
+      page = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
+   }
+   fWritePage[fWritePageIdx].Reset(fNElements);
 }
 
 void ROOT::Experimental::Detail::RColumn::MapPage(const NTupleSize_t index)
@@ -20,9 +20,93 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Transformations applied to the elements of a page before splitting them into byte planes. The encoder and decoder
+/// are stateful because delta encoding depends on the previous element of the page.
+template <typename UIntT>
+struct RIdentityCoding {
+   UIntT Encode(UIntT v) { return v; }
+   UIntT Decode(UIntT v) { return v; }
+};
+
+/// Each element is stored as the difference to its predecessor in the page. Sorted index columns thus turn into
+/// columns of small, mostly constant values.
+template <typename UIntT>
+struct RDeltaCoding {
+   UIntT fPrev = 0;
+   UIntT Encode(UIntT v)
+   {
+      UIntT d = v - fPrev;
+      fPrev = v;
+      return d;
+   }
+   UIntT Decode(UIntT d)
+   {
+      fPrev += d;
+      return fPrev;
+   }
+};
+
+/// Maps signed integers of small magnitude to small unsigned integers: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+template <typename UIntT>
+struct RZigzagCoding {
+   using SIntT = std::make_signed_t<UIntT>;
+   static constexpr unsigned kSignShift = sizeof(UIntT) * 8 - 1;
+   UIntT Encode(UIntT v)
+   {
+      return static_cast<UIntT>(static_cast<UIntT>(v << 1) ^ static_cast<UIntT>(static_cast<SIntT>(v) >> kSignShift));
+   }
+   UIntT Decode(UIntT z)
+   {
+      return static_cast<UIntT>((z >> 1) ^ static_cast<UIntT>(-static_cast<SIntT>(z & 1)));
+   }
+};
+
+/// Writes the i-th byte (in the order of significance) of all the `count` elements to the i-th byte plane of `dst`.
+/// The loops are kept simple so that the compiler can vectorize them.
+template <typename UIntT, typename CodingT>
+void SplitPack(void *dst, const void *src, std::size_t count)
+{
+   constexpr std::size_t N = sizeof(UIntT);
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   auto srcArray = reinterpret_cast<const unsigned char *>(src);
+   CodingT coding;
+   for (std::size_t i = 0; i < count; ++i) {
+      UIntT val;
+      std::memcpy(&val, srcArray + i * N, N);
+      val = coding.Encode(val);
+      for (std::size_t b = 0; b < N; ++b) {
+         splitArray[b * count + i] = static_cast<unsigned char>(val >> (8 * b));
+      }
+   }
+}
+
+/// Inverse of SplitPack(): collects the bytes of the `count` elements from the byte planes in `src`
+template <typename UIntT, typename CodingT>
+void SplitUnpack(void *dst, const void *src, std::size_t count)
+{
+   constexpr std::size_t N = sizeof(UIntT);
+   auto dstArray = reinterpret_cast<unsigned char *>(dst);
+   auto splitArray = reinterpret_cast<const unsigned char *>(src);
+   CodingT coding;
+   for (std::size_t i = 0; i < count; ++i) {
+      UIntT val = 0;
+      for (std::size_t b = 0; b < N; ++b) {
+         val |= static_cast<UIntT>(static_cast<UIntT>(splitArray[b * count + i]) << (8 * b));
+      }
+      val = coding.Decode(val);
+      std::memcpy(dstArray + i * N, &val, N);
+   }
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -48,6 +132,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -79,6 +175,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitIndex32:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt16:
+      return 16;
    default:
       R__ASSERT(false);
    }
@@ -110,11 +218,36 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitIndex32:
+      return "SplitIndex32";
+   case EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
    default:
       return "UNKNOWN";
    }
 }
 
+ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RColumnElementBase::GetSplitType(EColumnType type)
+{
+   switch (type) {
+   case EColumnType::kIndex: return EColumnType::kSplitIndex32;
+   case EColumnType::kReal64: return EColumnType::kSplitReal64;
+   case EColumnType::kReal32: return EColumnType::kSplitReal32;
+   case EColumnType::kInt64: return EColumnType::kSplitInt64;
+   case EColumnType::kInt32: return EColumnType::kSplitInt32;
+   case EColumnType::kInt16: return EColumnType::kSplitInt16;
+   default: return type;
+   }
+}
+
 void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::RColumnSwitch,
                                                 ROOT::Experimental::EColumnType::kSwitch>::Pack(void *dst, void *src,
                                                                                                 std::size_t count) const
@@ -207,3 +340,77 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
 #endif
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::uint32_t, RDeltaCoding<std::uint32_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::uint32_t, RDeltaCoding<std::uint32_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::uint64_t, RIdentityCoding<std::uint64_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::uint64_t, RIdentityCoding<std::uint64_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::uint32_t, RIdentityCoding<std::uint32_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::uint32_t, RIdentityCoding<std::uint32_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::uint64_t, RZigzagCoding<std::uint64_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::uint64_t, RZigzagCoding<std::uint64_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::uint32_t, RZigzagCoding<std::uint32_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::uint32_t, RZigzagCoding<std::uint32_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitPack<std::uint16_t, RZigzagCoding<std::uint16_t>>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitUnpack<std::uint16_t, RZigzagCoding<std::uint16_t>>(dst, src, count);
+}
@@ -231,10 +231,12 @@ int ROOT::Experimental::Detail::RDaosContainer::WriteSingleAkey(const void *buff
 int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOperation_t &map, ObjClassId_t cid,
                                                                 int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &))
 {
-   using request_t = std::tuple<std::unique_ptr<RDaosObject>, RDaosObject::FetchUpdateArgs>;
-
    int ret;
-   std::vector<request_t> requests{};
+   // Each object is opened once, also if several of its distribution keys are accessed, e.g. the columns of a
+   // cluster stored in a single object. The objects are closed after the completion of all the requests.
+   std::unordered_map<ROidDkeyPair, std::unique_ptr<RDaosObject>, ROidDkeyPair::Hash> objects{};
+   // Not reallocated while the requests are in flight: their events are referenced by the event queue
+   std::vector<RDaosObject::FetchUpdateArgs> requests{};
    requests.reserve(map.size());
 
    // Initialize parent event used for grouping and waiting for completion of all requests
@@ -243,22 +245,28 @@ int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOpe
       return ret;
 
    for (auto &[key, batch] : map) {
-      requests.push_back(std::make_tuple(
-         std::make_unique<RDaosObject>(*this, batch.fOid, cid.fCid),
-         RDaosObject::FetchUpdateArgs{batch.fDistributionKey, batch.fAttributeKeys, batch.fIovs, /*is_async=*/true}));
-
-      if ((ret = fPool->fEventQueue->InitializeEvent(std::get<1>(requests.back()).GetEventPointer(), &parent_event)) <
-          0)
+      ROidDkeyPair objectKey{};
+      objectKey.oid = batch.fOid;
+      auto &object = objects[objectKey];
+      if (!object)
+         object = std::make_unique<RDaosObject>(*this, batch.fOid, cid.fCid);
+
+      requests.emplace_back(batch.fDistributionKey, batch.fAttributeKeys, batch.fIovs, /*is_async=*/true);
+      if ((ret = fPool->fEventQueue->InitializeEvent(requests.back().GetEventPointer(), &parent_event)) < 0)
          return ret;
 
       // Launch operation
-      if ((ret = (std::get<0>(requests.back()).get()->*fn)(std::get<1>(requests.back()))) < 0)
+      if ((ret = (object.get()->*fn)(requests.back())) < 0)
          return ret;
    }
 
    // Sets parent barrier and waits for all children launched before it.
    if ((ret = fPool->fEventQueue->WaitOnParentBarrier(&parent_event)) < 0)
       return ret;
+   // The failure of a request is reported by its event, and propagated to the parent
+   const int err = parent_event.ev_error;
 
-   return fPool->fEventQueue->FinalizeEvent(&parent_event);
+   if ((ret = fPool->fEventQueue->FinalizeEvent(&parent_event)) < 0)
+      return ret;
+   return err;
 }
@@ -351,7 +351,9 @@ ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureCo
 
    const auto &columnDesc = desc.GetColumnDescriptor(columnId);
    for (auto type : requestedTypes) {
-      if (type == columnDesc.GetModel().GetType())
+      // The split encoded variant of a type is transparently decoded by the column
+      if ((type == columnDesc.GetModel().GetType()) ||
+          (RColumnElementBase::GetSplitType(type) == columnDesc.GetModel().GetType()))
          return type;
    }
    throw RException(R__FAIL(
@@ -17,6 +17,7 @@
 
 #include <ROOT/RFieldVisitor.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
@@ -31,6 +32,8 @@
 #include <TROOT.h> // for IsImplicitMTEnabled()
 
 #include <algorithm>
+#include <cstring>
+#include <deque>
 #include <exception>
 #include <functional>
 #include <iomanip>
@@ -91,6 +94,12 @@ void ROOT::Experimental::RNTupleReader::InitPageSource()
       fSource->SetTaskScheduler(fUnzipTasks.get());
    }
 #endif
+   const auto &options = fSource->GetReadOptions();
+   if (!fUnzipTasks && options.GetUseBackgroundUnzip() &&
+       options.GetClusterCache() != RNTupleReadOptions::EClusterCache::kOff) {
+      fUnzipTasks = std::make_unique<RNTupleSequentialTaskScheduler>();
+      fSource->SetTaskScheduler(fUnzipTasks.get());
+   }
    fSource->Attach();
    fMetrics.ObserveMetrics(fSource->GetMetrics());
 }
@@ -307,7 +316,8 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    }
    fModel->Freeze();
 #ifdef R__USE_IMT
-   if (IsImplicitMTEnabled()) {
+   if (IsImplicitMTEnabled() &&
+       fSink->GetWriteOptions().GetUseImplicitMT() == RNTupleWriteOptions::EImplicitMT::kDefault) {
       fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
       fSink->SetTaskScheduler(fZipTasks.get());
    }
@@ -373,9 +383,12 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
    fNBytesCommitted += fSink->CommitCluster(fNEntries);
    fNBytesFilled += fUnzippedClusterSize;
 
+   float compressionFactor = static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted);
+   // In adaptive mode, follow the compression factor of the recent clusters as tracked by the page sink
+   if (fSink->GetWriteOptions().GetUseAdaptiveSizing() && (fSink->GetCompressionFactor() > 0))
+      compressionFactor = fSink->GetCompressionFactor();
    // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor = std::min(1000.f,
-      static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   compressionFactor = std::min(1000.f, compressionFactor);
    fUnzippedClusterSizeEst =
       compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
 
@@ -390,6 +403,240 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 //------------------------------------------------------------------------------
 
 
+namespace {
+
+/// The page sink of a fill context. It seals the pages of the current cluster in the filling thread and passes
+/// the sealed pages on to the parallel writer when the cluster is committed. Header, cluster groups, and footer
+/// are written by the parallel writer's sink.
+class RPageSinkFillContext final : public ROOT::Experimental::Detail::RPageSink {
+public:
+   using RPage = ROOT::Experimental::Detail::RPage;
+   using CommitClusterFunc_t =
+      std::function<std::uint64_t(std::span<RSealedPageGroup>, ROOT::Experimental::NTupleSize_t)>;
+
+private:
+   /// A sealed page together with the memory it points to
+   struct RBufferedPage {
+      RPage fPage;
+      std::unique_ptr<unsigned char[]> fBuf;
+   };
+
+   CommitClusterFunc_t fCommitClusterFunc;
+   /// Indexed by column id
+   std::vector<std::deque<RBufferedPage>> fBufferedPages;
+   /// Indexed by column id
+   std::vector<SealedPageSequence_t> fSealedPages;
+
+protected:
+   void CreateImpl(const ROOT::Experimental::RNTupleModel & /* model */, unsigned char * /* serializedHeader */,
+                   std::uint32_t /* length */) final
+   {
+      const auto nColumns = fDescriptorBuilder.GetDescriptor().GetNColumns();
+      fBufferedPages.resize(nColumns);
+      fSealedPages.resize(nColumns);
+   }
+
+   ROOT::Experimental::RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      const auto &element = *columnHandle.fColumn->GetElement();
+      const auto compression = GetWriteOptions().GetCompression();
+      RBufferedPage bufPage;
+      if ((compression == 0) && element.IsMappable()) {
+         // The sealed page points directly to the page buffer, which therefore needs to be copied
+         bufPage.fPage = ReservePage(columnHandle, page.GetNElements());
+         bufPage.fPage.GrowUnchecked(page.GetNElements());
+         memcpy(bufPage.fPage.GetBuffer(), page.GetBuffer(), page.GetNBytes());
+      }
+      const std::size_t bufSize =
+         std::max<std::size_t>(page.GetNBytes(), element.GetPackedSize(page.GetNElements()));
+      bufPage.fBuf = std::make_unique<unsigned char[]>(bufSize);
+      const auto &sealSource = bufPage.fPage.IsNull() ? page : bufPage.fPage;
+      auto sealedPage = SealPage(sealSource, element, compression, bufPage.fBuf.get());
+      sealedPage.fValueRange = ComputeValueRange(columnHandle, page);
+
+      // The locators of the context sink are never written out; the page size is used for the compression statistics
+      ROOT::Experimental::RNTupleLocator locator;
+      locator.fBytesOnStorage = sealedPage.fSize;
+      fBufferedPages.at(columnHandle.fId).emplace_back(std::move(bufPage));
+      fSealedPages.at(columnHandle.fId).emplace_back(std::move(sealedPage));
+      return locator;
+   }
+
+   ROOT::Experimental::RNTupleLocator
+   CommitSealedPageImpl(ROOT::Experimental::DescriptorId_t columnId, const RSealedPage &sealedPage) final
+   {
+      RBufferedPage bufPage;
+      bufPage.fBuf = std::make_unique<unsigned char[]>(sealedPage.fSize);
+      memcpy(bufPage.fBuf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      RSealedPage copy(bufPage.fBuf.get(), sealedPage.fSize, sealedPage.fNElements);
+      copy.fValueRange = sealedPage.fValueRange;
+
+      ROOT::Experimental::RNTupleLocator locator;
+      locator.fBytesOnStorage = copy.fSize;
+      fBufferedPages.at(columnId).emplace_back(std::move(bufPage));
+      fSealedPages.at(columnId).emplace_back(std::move(copy));
+      return locator;
+   }
+
+   std::uint64_t CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries) final
+   {
+      std::vector<RSealedPageGroup> toCommit;
+      toCommit.reserve(fSealedPages.size());
+      for (ROOT::Experimental::DescriptorId_t i = 0; i < fSealedPages.size(); ++i)
+         toCommit.emplace_back(i, fSealedPages[i].cbegin(), fSealedPages[i].cend());
+      auto nbytes = fCommitClusterFunc(toCommit, nEntries - fPrevClusterNEntries);
+
+      for (auto &pages : fBufferedPages) {
+         for (auto &bufPage : pages) {
+            if (!bufPage.fPage.IsNull())
+               ReleasePage(bufPage.fPage);
+         }
+         pages.clear();
+      }
+      for (auto &sealedPages : fSealedPages)
+         sealedPages.clear();
+      return nbytes;
+   }
+
+   ROOT::Experimental::RNTupleLocator
+   CommitClusterGroupImpl(unsigned char * /* serializedPageList */, std::uint32_t /* length */) final
+   {
+      return ROOT::Experimental::RNTupleLocator{};
+   }
+
+   void CommitDatasetImpl(unsigned char * /* serializedFooter */, std::uint32_t /* length */) final {}
+
+public:
+   RPageSinkFillContext(std::string_view ntupleName, const ROOT::Experimental::RNTupleWriteOptions &options,
+                        CommitClusterFunc_t commitClusterFunc)
+      : RPageSink(ntupleName, options), fCommitClusterFunc(std::move(commitClusterFunc))
+   {
+   }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw ROOT::Experimental::RException(R__FAIL("invalid call: request empty page"));
+      const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+   }
+
+   void ReleasePage(RPage &page) final { ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(page); }
+};
+
+} // anonymous namespace
+
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   fModel->Freeze();
+   fSink->Create(*fModel.get());
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   const auto nBytesCommitted = fSink->CommitCluster(fNEntries);
+
+   float compressionFactor =
+      static_cast<float>(fUnzippedClusterSize) / static_cast<float>(std::max<std::uint64_t>(nBytesCommitted, 1));
+   if (fSink->GetWriteOptions().GetUseAdaptiveSizing() && (fSink->GetCompressionFactor() > 0))
+      compressionFactor = fSink->GetCompressionFactor();
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   compressionFactor = std::min(1000.f, compressionFactor);
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   if (fModel->IsFrozen()) {
+      throw RException(R__FAIL("the model of a parallel writer must not be frozen"));
+   }
+   fSink->Create(*fModel.get());
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   if (fNEntries > 0)
+      fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // The fill contexts provide complete clusters of sealed pages, an additional buffer layer is not needed
+   auto unbufferedOptions = options.Clone();
+   unbufferedOptions->SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, *unbufferedOptions));
+}
+
+std::uint64_t
+ROOT::Experimental::RNTupleParallelWriter::CommitCluster(std::span<Detail::RPageStorage::RSealedPageGroup> ranges,
+                                                         NTupleSize_t nEntries)
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   fSink->CommitSealedPageV(ranges);
+   fNEntries += nEntries;
+   return fSink->CommitCluster(fNEntries);
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::unique_ptr<RNTupleModel> model;
+   {
+      std::lock_guard<std::mutex> guard(fMutex);
+      model = fModel->Clone();
+   }
+   auto sink = std::make_unique<RPageSinkFillContext>(
+      fSink->GetNTupleName(), fSink->GetWriteOptions(),
+      [this](std::span<Detail::RPageStorage::RSealedPageGroup> ranges, NTupleSize_t nEntries) {
+         return CommitCluster(ranges, nEntries);
+      });
+   return std::unique_ptr<RNTupleFillContext>(new RNTupleFillContext(std::move(model), std::move(sink)));
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionNTupleWriter::RCollectionNTupleWriter(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
@@ -172,6 +172,18 @@ std::uint64_t ROOT::Experimental::RClusterDescriptor::GetBytesOnStorage() const
    return nbytes;
 }
 
+ROOT::Experimental::RColumnValueRange
+ROOT::Experimental::RClusterDescriptor::GetValueRange(DescriptorId_t columnId) const
+{
+   const auto &pageInfos = GetPageRange(columnId).fPageInfos;
+   if (pageInfos.empty())
+      return RColumnValueRange();
+   RColumnValueRange range = pageInfos[0].fValueRange;
+   for (const auto &pi : pageInfos)
+      range.Merge(pi.fValueRange);
+   return range;
+}
+
 void ROOT::Experimental::RClusterDescriptor::EnsureHasPageLocations() const
 {
    if (!fHasPageLocations)
@@ -13,11 +13,57 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+namespace {
+
+/// Fills `columnMap`, which is indexed by source column id, for the subfields of the given source and destination
+/// fields. Throws if the subfields or their columns do not match.
+void MapColumns(const ROOT::Experimental::RNTupleDescriptor &source, ROOT::Experimental::DescriptorId_t sourceFieldId,
+                const ROOT::Experimental::RNTupleDescriptor &destination,
+                ROOT::Experimental::DescriptorId_t destinationFieldId,
+                std::vector<ROOT::Experimental::DescriptorId_t> &columnMap)
+{
+   using ROOT::Experimental::RException;
+
+   for (const auto &sourceField : source.GetFieldIterable(sourceFieldId)) {
+      const auto fieldName = source.GetQualifiedFieldName(sourceField.GetId());
+      const auto destinationChildId = destination.FindFieldId(sourceField.GetFieldName(), destinationFieldId);
+      if (destinationChildId == ROOT::Experimental::kInvalidDescriptorId)
+         throw RException(R__FAIL("cannot merge, field " + fieldName + " is missing in the destination"));
+      const auto &destinationField = destination.GetFieldDescriptor(destinationChildId);
+      if ((sourceField.GetTypeName() != destinationField.GetTypeName()) ||
+          (sourceField.GetStructure() != destinationField.GetStructure())) {
+         throw RException(R__FAIL("cannot merge, type mismatch of field " + fieldName));
+      }
+
+      for (const auto &sourceColumn : source.GetColumnIterable(sourceField)) {
+         const auto destinationColumnId = destination.FindColumnId(destinationChildId, sourceColumn.GetIndex());
+         if ((destinationColumnId == ROOT::Experimental::kInvalidDescriptorId) ||
+             !(destination.GetColumnDescriptor(destinationColumnId).GetModel() == sourceColumn.GetModel())) {
+            throw RException(R__FAIL("cannot merge, column type mismatch in field " + fieldName));
+         }
+         columnMap.at(sourceColumn.GetId()) = destinationColumnId;
+      }
+
+      MapColumns(source, sourceField.GetId(), destination, destinationChildId, columnMap);
+   }
+}
+
+} // anonymous namespace
+
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
@@ -36,3 +82,154 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+ROOT::Experimental::RNTupleMerger::RNTupleMerger() : fMetrics("RNTupleMerger")
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("nPageCopied", "",
+                                                           "number of compressed pages copied verbatim"),
+      *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("nPageResealed", "",
+                                                           "number of pages recompressed with new settings"),
+      *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("szRead", "B", "volume of the input pages"),
+      *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("szWritten", "B", "volume of the output pages"),
+      *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("timeWallMerge", "ns", "wall clock time spent merging"),
+      *fMetrics.MakeCounter<Detail::RNTupleTickCounter<Detail::RNTuplePlainCounter> *>("timeCpuMerge", "ns",
+                                                                                     "CPU time spent merging")});
+}
+
+void ROOT::Experimental::RNTupleMerger::MergeClusters(const RNTupleDescriptor &sourceDesc,
+                                                      std::vector<std::unique_ptr<Detail::RCluster>> &clusters,
+                                                      const std::vector<DescriptorId_t> &columnMap,
+                                                      Detail::RPageSink &destination, NTupleSize_t &nEntries)
+{
+   const auto compression = destination.GetWriteOptions().GetCompression();
+
+   for (const auto &cluster : clusters) {
+      const auto &clusterDesc = sourceDesc.GetClusterDescriptor(cluster->GetId());
+
+      // Indexed like the page groups; a deque such that the page groups' iterators remain valid
+      std::deque<Detail::RPageStorage::SealedPageSequence_t> sealedPages;
+      std::vector<Detail::RPageStorage::RSealedPageGroup> pageGroups;
+      // Memory of the recompressed pages
+      std::vector<std::unique_ptr<unsigned char[]>> buffers;
+
+      for (DescriptorId_t columnId = 0; columnId < columnMap.size(); ++columnId) {
+         if (!clusterDesc.ContainsColumn(columnId))
+            continue;
+
+         const bool isVerbatim = (clusterDesc.GetColumnRange(columnId).fCompressionSettings == compression);
+         const auto bitsOnStorage =
+            Detail::RColumnElementBase::GetBitsOnStorage(sourceDesc.GetColumnDescriptor(columnId).GetModel().GetType());
+         auto &columnPages = sealedPages.emplace_back();
+         std::uint64_t pageNo = 0;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+            auto onDiskPage = cluster->GetOnDiskPage(Detail::ROnDiskPage::Key{columnId, pageNo++});
+            R__ASSERT(onDiskPage);
+            Detail::RPageStorage::RSealedPage sealedPage{onDiskPage->GetAddress(), onDiskPage->GetSize(),
+                                                         pageInfo.fNElements};
+            sealedPage.fValueRange = pageInfo.fValueRange;
+            fCounters->fSzRead.Add(sealedPage.fSize);
+
+            if (isVerbatim) {
+               fCounters->fNPageCopied.Inc();
+            } else {
+               const std::size_t bytesPacked = (bitsOnStorage * pageInfo.fNElements + 7) / 8;
+               auto packedBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+               fDecompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, packedBuffer.get());
+               auto zipBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+               sealedPage.fSize = Detail::RNTupleCompressor::Zip(packedBuffer.get(), bytesPacked, compression,
+                                                                 zipBuffer.get());
+               sealedPage.fBuffer = zipBuffer.get();
+               buffers.emplace_back(std::move(zipBuffer));
+               fCounters->fNPageResealed.Inc();
+            }
+            fCounters->fSzWritten.Add(sealedPage.fSize);
+            columnPages.emplace_back(std::move(sealedPage));
+         }
+         pageGroups.emplace_back(columnMap[columnId], columnPages.cbegin(), columnPages.cend());
+      }
+
+      destination.CommitSealedPageV(pageGroups);
+      nEntries += clusterDesc.GetNEntries();
+      destination.CommitCluster(nEntries);
+   }
+}
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources,
+                                              Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("cannot merge, no sources given"));
+
+   Detail::RNTuplePlainTimer timer(fCounters->fTimeWallMerge, fCounters->fTimeCpuMerge);
+
+   std::unique_ptr<RNTupleModel> model;
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      source->Attach();
+      auto sourceDesc = source->GetSharedDescriptorGuard()->Clone();
+      if (!model) {
+         model = sourceDesc->GenerateModel();
+         destination.Create(*model);
+      }
+      const auto &destinationDesc = destination.GetDescriptor();
+      if ((sourceDesc->GetNFields() != destinationDesc.GetNFields()) ||
+          (sourceDesc->GetNColumns() != destinationDesc.GetNColumns())) {
+         throw RException(R__FAIL("cannot merge, schema of " + sourceDesc->GetName() + " differs"));
+      }
+      std::vector<DescriptorId_t> columnMap(sourceDesc->GetNColumns(), kInvalidDescriptorId);
+      MapColumns(*sourceDesc, sourceDesc->GetFieldZeroId(), destinationDesc, destinationDesc.GetFieldZeroId(),
+                 columnMap);
+
+      Detail::RCluster::ColumnSet_t columnSet;
+      for (DescriptorId_t columnId = 0; columnId < columnMap.size(); ++columnId)
+         columnSet.insert(columnId);
+
+      // Sort the clusters by entry number and group them in bunches for vector reads
+      std::vector<std::pair<NTupleSize_t, DescriptorId_t>> clusterOrder;
+      for (const auto &clusterDesc : sourceDesc->GetClusterIterable())
+         clusterOrder.emplace_back(clusterDesc.GetFirstEntryIndex(), clusterDesc.GetId());
+      std::sort(clusterOrder.begin(), clusterOrder.end());
+
+      std::vector<std::vector<Detail::RCluster::RKey>> bunches;
+      std::uint64_t bunchSize = kMinBunchSize;
+      for (const auto &[_, clusterId] : clusterOrder) {
+         if (bunchSize >= kMinBunchSize) {
+            bunches.emplace_back();
+            bunchSize = 0;
+         }
+         bunches.back().push_back(Detail::RCluster::RKey{clusterId, columnSet});
+         const auto &clusterDesc = sourceDesc->GetClusterDescriptor(clusterId);
+         for (auto columnId : columnSet) {
+            if (!clusterDesc.ContainsColumn(columnId))
+               continue;
+            for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos)
+               bunchSize += pageInfo.fLocator.fBytesOnStorage;
+         }
+      }
+
+      // While the pages of a bunch are committed, the I/O for the next bunch is already in flight
+      std::vector<std::unique_ptr<Detail::RCluster>> inFlight;
+      if (!bunches.empty())
+         inFlight = source->LoadClustersAsync(bunches[0]);
+      for (std::size_t i = 0; i < bunches.size(); ++i) {
+         auto clusters = std::move(inFlight);
+         source->WaitForClusters(clusters);
+         if (i + 1 < bunches.size())
+            inFlight = source->LoadClustersAsync(bunches[i + 1]);
+         try {
+            MergeClusters(*sourceDesc, clusters, columnMap, destination, nEntries);
+         } catch (...) {
+            // The in-flight I/O must not outlive its buffers
+            source->WaitForClusters(inFlight);
+            throw;
+         }
+      }
+   }
+
+   destination.CommitClusterGroup();
+   destination.CommitDataset();
+}
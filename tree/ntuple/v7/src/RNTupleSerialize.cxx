@@ -22,6 +22,7 @@
 #include <RVersion.h>
 #include <RZip.h> // for R__crc32
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <deque>
 #include <set>
@@ -382,6 +383,21 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto result = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return result;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -441,6 +457,18 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
          return SerializeUInt16(0x0C, buffer);
       case EColumnType::kInt8:
          return SerializeUInt16(0x0D, buffer);
+      case EColumnType::kSplitIndex32:
+         return SerializeUInt16(0x0F, buffer);
+      case EColumnType::kSplitReal64:
+         return SerializeUInt16(0x10, buffer);
+      case EColumnType::kSplitReal32:
+         return SerializeUInt16(0x11, buffer);
+      case EColumnType::kSplitInt64:
+         return SerializeUInt16(0x13, buffer);
+      case EColumnType::kSplitInt32:
+         return SerializeUInt16(0x14, buffer);
+      case EColumnType::kSplitInt16:
+         return SerializeUInt16(0x15, buffer);
       default:
          throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
@@ -490,6 +518,24 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
       case 0x0D:
          type = EColumnType::kInt8;
          break;
+      case 0x0F:
+         type = EColumnType::kSplitIndex32;
+         break;
+      case 0x10:
+         type = EColumnType::kSplitReal64;
+         break;
+      case 0x11:
+         type = EColumnType::kSplitReal32;
+         break;
+      case 0x13:
+         type = EColumnType::kSplitInt64;
+         break;
+      case 0x14:
+         type = EColumnType::kSplitInt32;
+         break;
+      case 0x15:
+         type = EColumnType::kSplitInt16;
+         break;
       default:
          return R__FAIL("unexpected on-disk column type");
    }
@@ -1004,6 +1050,17 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional value ranges, only written if at least one of the pages has a valid range
+         bool hasValueRanges = std::any_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                                           [](const auto &pi) { return pi.fValueRange.fIsValid; });
+         if (hasValueRanges) {
+            for (const auto &pi : pageRange.fPageInfos) {
+               pos += SerializeUInt16(pi.fValueRange.fIsValid ? kFlagValidValueRange : 0, *where);
+               pos += SerializeDouble(pi.fValueRange.fMin, *where);
+               pos += SerializeDouble(pi.fValueRange.fMax, *where);
+            }
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1394,6 +1451,20 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         constexpr auto kValueRangeSize = sizeof(std::uint16_t) + 2 * sizeof(double);
+         if (nPages > 0 && fnInnerFrameSizeLeft() >= static_cast<int>(nPages * kValueRangeSize)) {
+            for (auto &pi : pageRange.fPageInfos) {
+               std::uint16_t flags;
+               double min;
+               double max;
+               bytes += DeserializeUInt16(bytes, flags);
+               bytes += DeserializeDouble(bytes, min);
+               bytes += DeserializeDouble(bytes, max);
+               if (flags & kFlagValidValueRange)
+                  pi.fValueRange = RColumnValueRange(min, max);
+            }
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
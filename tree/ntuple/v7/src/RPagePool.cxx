@@ -19,6 +19,7 @@
 #include <TError.h>
 
 #include <cstdlib>
+#include <utility>
 
 void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
 {
@@ -88,3 +89,75 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage
    }
    return RPage();
 }
+
+ROOT::Experimental::Detail::RPageCache &ROOT::Experimental::Detail::RPageCache::GetShared()
+{
+   static RPageCache gPageCache;
+   return gPageCache;
+}
+
+std::uint64_t ROOT::Experimental::Detail::RPageCache::GetSourceId(const std::string &source)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fSourceIds.find(source);
+   if (itr != fSourceIds.end())
+      return itr->second;
+   const std::uint64_t sourceId = fSourceIds.size();
+   fSourceIds[source] = sourceId;
+   return sourceId;
+}
+
+void ROOT::Experimental::Detail::RPageCache::EvictUnlocked()
+{
+   while (fMemoryUsed > fMemoryBudget) {
+      R__ASSERT(!fLruList.empty());
+      const auto &entry = fLruList.back();
+      fMemoryUsed -= entry.fSize;
+      fIndex.erase(entry.fKey);
+      fLruList.pop_back();
+   }
+}
+
+std::shared_ptr<unsigned char[]> ROOT::Experimental::Detail::RPageCache::Get(const RKey &key)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fIndex.find(key);
+   if (itr == fIndex.end())
+      return nullptr;
+   fLruList.splice(fLruList.begin(), fLruList, itr->second);
+   return itr->second->fBuffer;
+}
+
+std::shared_ptr<unsigned char[]>
+ROOT::Experimental::Detail::RPageCache::Put(const RKey &key, std::shared_ptr<unsigned char[]> buffer, std::size_t size)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fIndex.find(key);
+   if (itr != fIndex.end()) {
+      fLruList.splice(fLruList.begin(), fLruList, itr->second);
+      return itr->second->fBuffer;
+   }
+   if (size > fMemoryBudget)
+      return buffer;
+
+   fLruList.push_front(REntry{key, buffer, size});
+   fIndex[key] = fLruList.begin();
+   fMemoryUsed += size;
+   EvictUnlocked();
+   return buffer;
+}
+
+void ROOT::Experimental::Detail::RPageCache::SetMemoryBudget(std::size_t memoryBudget)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fMemoryBudget = memoryBudget;
+   EvictUnlocked();
+}
+
+void ROOT::Experimental::Detail::RPageCache::Clear()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fIndex.clear();
+   fLruList.clear();
+   fMemoryUsed = 0;
+}
@@ -66,8 +66,10 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    R__ASSERT(zipItem->fBuf);
    auto sealedPage = fBufferedColumns.at(columnHandle.fId).RegisterSealedPage();
    fTaskScheduler->AddTask([this, zipItem, sealedPage, colId = columnHandle.fId] {
-      *sealedPage = SealPage(zipItem->fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-                             GetWriteOptions().GetCompression(), zipItem->fBuf.get());
+      const auto &handle = fBufferedColumns.at(colId).GetHandle();
+      *sealedPage = SealPage(zipItem->fPage, *handle.fColumn->GetElement(), GetWriteOptions().GetCompression(),
+                             zipItem->fBuf.get());
+      sealedPage->fValueRange = ComputeValueRange(handle, zipItem->fPage);
       zipItem->fSealedPage = &(*sealedPage);
    });
 
@@ -86,6 +88,23 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(
    return RNTupleLocator{};
 }
 
+std::uint64_t ROOT::Experimental::Detail::RPageSinkBuf::CommitInnerCluster(ROOT::Experimental::NTupleSize_t nEntries)
+{
+   auto nbytes = fInnerSink->CommitCluster(nEntries);
+
+   // The inner sink uses the same column ids and received the pages of every column in the same order
+   const auto &innerDesc = fInnerSink->GetDescriptor();
+   const auto &innerCluster = innerDesc.GetClusterDescriptor(innerDesc.GetNClusters() - 1);
+   for (DescriptorId_t i = 0; i < fOpenPageRanges.size(); ++i) {
+      auto &pageInfos = fOpenPageRanges[i].fPageInfos;
+      const auto &innerPageInfos = innerCluster.GetPageRange(i).fPageInfos;
+      R__ASSERT(pageInfos.size() == innerPageInfos.size());
+      for (std::size_t j = 0; j < pageInfos.size(); ++j)
+         pageInfos[j].fLocator = innerPageInfos[j].fLocator;
+   }
+   return nbytes;
+}
+
 std::uint64_t
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
 {
@@ -108,7 +127,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
 
       for (auto &bufColumn : fBufferedColumns)
          bufColumn.DrainBufferedPages();
-      return fInnerSink->CommitCluster(nEntries);
+      return CommitInnerCluster(nEntries);
    }
 
    // Otherwise, try to do it per column
@@ -131,7 +150,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
          ReleasePage(bufPage.fPage);
       }
    }
-   return fInnerSink->CommitCluster(nEntries);
+   return CommitInnerCluster(nEntries);
 }
 
 ROOT::Experimental::RNTupleLocator
@@ -31,6 +31,7 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
 #include <utility>
 
 
@@ -89,6 +90,19 @@ void ROOT::Experimental::Detail::RPageSource::DropColumn(ColumnHandle_t columnHa
    fActiveColumns.erase(columnHandle.fId);
 }
 
+ROOT::Experimental::Detail::RCluster::ColumnSet_t ROOT::Experimental::Detail::RPageSource::GetPreloadColumns() const
+{
+   if (fLazyColumns.empty())
+      return fActiveColumns;
+
+   RCluster::ColumnSet_t result;
+   for (auto columnId : fActiveColumns) {
+      if (fLazyColumns.count(columnId) == 0)
+         result.emplace(columnId);
+   }
+   return result;
+}
+
 ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEntries()
 {
    return GetSharedDescriptorGuard()->GetNEntries();
@@ -152,6 +166,10 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
                                                    "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "",
+                                                   "number of populated pages that are memory mapped"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageCacheHit", "",
+                                                   "number of populated pages taken from the shared page cache"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallRead", "ns", "wall clock time spent reading"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns", "wall clock time spent decompressing"),
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuRead", "ns", "CPU time spent reading"),
@@ -305,6 +323,7 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       pageRange.fColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
    }
+   fColumnSizeStats.resize(nColumns);
 
    fSerializationContext = Internal::RNTupleSerializer::SerializeHeaderV1(nullptr, descriptor);
    auto buffer = std::make_unique<unsigned char[]>(fSerializationContext.GetHeaderSize());
@@ -320,6 +339,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
+   pageInfo.fValueRange = ComputeValueRange(columnHandle, page);
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
    fOpenPageRanges.at(columnHandle.fId).fPageInfos.emplace_back(pageInfo);
 }
@@ -333,6 +353,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fValueRange = sealedPage.fValueRange;
    pageInfo.fLocator = CommitSealedPageImpl(columnId, sealedPage);
    fOpenPageRanges.at(columnId).fPageInfos.emplace_back(pageInfo);
 }
@@ -359,12 +380,21 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
+         pageInfo.fValueRange = sealedPageIt->fValueRange;
          pageInfo.fLocator = locators[i++];
          fOpenPageRanges.at(range.fColumnId).fPageInfos.emplace_back(pageInfo);
       }
    }
 }
 
+ROOT::Experimental::RColumnValueRange
+ROOT::Experimental::Detail::RPageSink::ComputeValueRange(ColumnHandle_t columnHandle, const RPage &page) const
+{
+   if (!fOptions->GetComputeValueRanges())
+      return RColumnValueRange();
+   return columnHandle.fColumn->GetValueRange(page);
+}
+
 std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto nbytes = CommitClusterImpl(nEntries);
@@ -373,7 +403,26 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
    auto nEntriesInCluster = ClusterSize_t(nEntries - fPrevClusterNEntries);
    RClusterDescriptorBuilder clusterBuilder(fDescriptorBuilder.GetDescriptor().GetNClusters(), fPrevClusterNEntries,
                                             nEntriesInCluster);
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   fTotalSizeStats.fNBytesPacked /= 2;
+   fTotalSizeStats.fNBytesOnStorage /= 2;
    for (unsigned int i = 0; i < fOpenColumnRanges.size(); ++i) {
+      const auto bitsOnStorage =
+         RColumnElementBase::GetBitsOnStorage(descriptor.GetColumnDescriptor(i).GetModel().GetType());
+      auto &stats = fColumnSizeStats[i];
+      stats.fNBytesPacked /= 2;
+      stats.fNBytesOnStorage /= 2;
+      for (const auto &pageInfo : fOpenPageRanges[i].fPageInfos) {
+         // Pages of sinks that do not know the final page sizes have empty locators
+         if (pageInfo.fLocator.fBytesOnStorage == 0)
+            continue;
+         const double nBytesPacked = (bitsOnStorage * pageInfo.fNElements + 7) / 8;
+         stats.fNBytesPacked += nBytesPacked;
+         stats.fNBytesOnStorage += pageInfo.fLocator.fBytesOnStorage;
+         fTotalSizeStats.fNBytesPacked += nBytesPacked;
+         fTotalSizeStats.fNBytesOnStorage += pageInfo.fLocator.fBytesOnStorage;
+      }
+
       RClusterDescriptor::RPageRange fullRange;
       fullRange.fColumnId = i;
       std::swap(fullRange, fOpenPageRanges[i]);
@@ -387,6 +436,28 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
    return nbytes;
 }
 
+float ROOT::Experimental::Detail::RPageSink::GetCompressionFactor(DescriptorId_t columnId) const
+{
+   const auto &stats = (columnId == kInvalidDescriptorId) ? fTotalSizeStats : fColumnSizeStats.at(columnId);
+   if (stats.fNBytesOnStorage == 0)
+      return 0;
+   return stats.fNBytesPacked / stats.fNBytesOnStorage;
+}
+
+std::size_t ROOT::Experimental::Detail::RPageSink::GetApproxUnzippedPageSize(DescriptorId_t columnId) const
+{
+   const auto pageSize = fOptions->GetApproxUnzippedPageSize();
+   if (!fOptions->GetUseAdaptiveSizing())
+      return pageSize;
+   const auto columnFactor = GetCompressionFactor(columnId);
+   const auto totalFactor = GetCompressionFactor();
+   if ((columnFactor == 0) || (totalFactor == 0))
+      return pageSize;
+   // Limit the scaling such that neither tiny nor huge pages are created for extremely (in)compressible columns
+   const auto scale = std::clamp(columnFactor / totalFactor, 0.25f, 4.f);
+   return std::min(static_cast<std::size_t>(scale * pageSize), fOptions->GetMaxUnzippedClusterSize());
+}
+
 void ROOT::Experimental::Detail::RPageSink::CommitClusterGroup()
 {
    const auto &descriptor = fDescriptorBuilder.GetDescriptor();
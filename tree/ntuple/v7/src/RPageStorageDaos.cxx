@@ -269,7 +269,9 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageImpl(DescriptorId_t c
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, columnId, offsetData);
-      fDaosContainer->WriteSingleAkey(sealedPage.fBuffer, sealedPage.fSize, daosKey.fOid, daosKey.fDkey, daosKey.fAkey);
+      if (int err = fDaosContainer->WriteSingleAkey(sealedPage.fBuffer, sealedPage.fSize, daosKey.fOid, daosKey.fDkey,
+                                                    daosKey.fAkey))
+         throw ROOT::Experimental::RException(R__FAIL("WriteSingleAkey: error" + std::string(d_errstr(err))));
    }
 
    RNTupleLocator result;
@@ -503,6 +505,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (sealedPage.fBuffer) {
       RDaosKey daosKey =
          GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, columnId, pageInfo.fLocator.fPosition);
@@ -538,8 +541,14 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
       fCounters->fSzReadPayload.Add(bytesOnStorage);
       sealedPageBuffer = directReadBuffer.get();
    } else {
-      if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
+      if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) ||
+          !fCurrentCluster->ContainsColumn(columnId)) {
+         // Lazy columns are only loaded for the cluster at hand; the following clusters get the preloaded columns
+         const auto preloadColumns = GetPreloadColumns();
+         auto columns = preloadColumns;
+         columns.emplace(columnId);
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, columns, preloadColumns);
+      }
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
@@ -684,7 +693,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
       szPayload += clusterBufSz;
 
       clusterBuffers[i] = new unsigned char[clusterBufSz];
-      pageMaps[i] = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(clusterBuffers[i]));
+      pageMaps[i] =
+         std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(clusterBuffers[i]), clusterBufSz);
 
       // Fill the cluster page maps and the input dictionary for the RDaosContainer::ReadV() call
       for (const auto &s : onDiskClusterPages) {
@@ -16,6 +16,7 @@
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RField.hxx>
+#include <ROOT/RIOMetrics.hxx>
 #include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleModel.hxx>
@@ -33,6 +34,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <utility>
 
@@ -43,6 +45,17 @@
 #include <thread>
 #include <queue>
 
+namespace {
+
+/// The page keeps a reference to the buffer of the shared page cache; releasing the page drops the reference
+ROOT::Experimental::Detail::RPageDeleter MakeSharedPageDeleter(std::shared_ptr<unsigned char[]> buffer)
+{
+   return ROOT::Experimental::Detail::RPageDeleter(
+      [buffer](const ROOT::Experimental::Detail::RPage & /*page*/, void * /*userData*/) {}, nullptr);
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
@@ -142,6 +155,58 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(
 }
 
 
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges)
+{
+   std::size_t nPages = 0;
+   std::size_t nBytesBlob = 0;
+   std::size_t nBytesPacked = 0;
+   for (auto &range : ranges) {
+      const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
+         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fColumnId).GetModel().GetType());
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         nPages++;
+         nBytesBlob += sealedPageIt->fSize;
+         nBytesPacked += (bitsOnStorage * sealedPageIt->fNElements + 7) / 8;
+      }
+   }
+   if (nPages == 0)
+      return {};
+   // Avoid large memory copies; very large clusters are anyway written in large requests
+   if (nBytesBlob > kMaxSealedPageVBlobSize)
+      return RPageSink::CommitSealedPageVImpl(ranges);
+
+   // Gather all the pages in a single buffer such that they get written in a single, large write request
+   auto blob = std::make_unique<unsigned char[]>(nBytesBlob);
+   std::vector<RNTupleLocator> locators;
+   locators.reserve(nPages);
+   std::uint64_t offsetInBlob = 0;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         memcpy(blob.get() + offsetInBlob, sealedPageIt->fBuffer, sealedPageIt->fSize);
+         RNTupleLocator locator;
+         locator.fPosition = offsetInBlob;
+         locator.fBytesOnStorage = sealedPageIt->fSize;
+         locators.emplace_back(locator);
+         offsetInBlob += sealedPageIt->fSize;
+      }
+   }
+
+   std::uint64_t offsetData;
+   {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+      offsetData = fWriter->WriteBlob(blob.get(), nBytesBlob, nBytesPacked);
+   }
+   for (auto &locator : locators)
+      locator.fPosition += offsetData;
+
+   fCounters->fNPageCommitted.Add(nPages);
+   fCounters->fSzWritePayload.Add(nBytesBlob);
+   fNBytesCurrentCluster += nBytesBlob;
+   return locators;
+}
+
+
 std::uint64_t
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
@@ -229,6 +294,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    fFile = ROOT::Internal::RRawFile::Create(path);
    R__ASSERT(fFile);
    fReader = Internal::RMiniFileReader(fFile.get());
+   fReadPlannerSettings =
+      ROOT::Internal::RReadPlanner::RSettings::GetForTransport(ROOT::Internal::RRawFile::GetTransport(path));
 }
 
 void ROOT::Experimental::Detail::RPageSourceFile::InitDescriptor(const Internal::RFileNTupleAnchor &anchor)
@@ -287,6 +354,11 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
       }
    }
 
+   if (fOptions.GetUseSharedPageCache()) {
+      fSharedPageCache = &RPageCache::GetShared();
+      fSharedPageCacheSourceId = fSharedPageCache->GetSourceId(fFile->GetUrl() + ":" + fNTupleName);
+   }
+
    return ntplDesc;
 }
 
@@ -306,6 +378,7 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (sealedPage.fBuffer)
       fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, pageInfo.fLocator.fPosition);
 }
@@ -323,6 +396,22 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    const auto elementSize = element->GetSize();
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
 
+   if (IsMappablePage(*element, pageInfo))
+      return PopulatePageFromMap(columnHandle, clusterInfo);
+
+   const RPageCache::RKey cacheKey{fSharedPageCacheSourceId, clusterId, columnId, pageInfo.fPageNo};
+   if (fSharedPageCache) {
+      if (auto sharedBuffer = fSharedPageCache->Get(cacheKey)) {
+         auto newPage = fPageAllocator->NewPage(columnId, sharedBuffer.get(), elementSize, pageInfo.fNElements);
+         newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                           RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+         fPagePool->RegisterPage(newPage, MakeSharedPageDeleter(std::move(sharedBuffer)));
+         fCounters->fNPageCacheHit.Inc();
+         fCounters->fNPagePopulated.Inc();
+         return newPage;
+      }
+   }
+
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
    std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
 
@@ -332,10 +421,19 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       fCounters->fNPageLoaded.Inc();
       fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
+      RIOMetrics::Add(RIOMetrics::kBytesRequested, bytesOnStorage);
+      RIOMetrics::Add(RIOMetrics::kBytesRead, bytesOnStorage);
+      RIOMetrics::Add(RIOMetrics::kReadCalls, 1);
       sealedPageBuffer = directReadBuffer.get();
    } else {
-      if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
+      if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) ||
+          !fCurrentCluster->ContainsColumn(columnId)) {
+         // Lazy columns are only loaded for the cluster at hand; the following clusters get the preloaded columns
+         const auto preloadColumns = GetPreloadColumns();
+         auto columns = preloadColumns;
+         columns.emplace(columnId);
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, columns, preloadColumns);
+      }
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
@@ -351,10 +449,22 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    std::unique_ptr<unsigned char []> pageBuffer;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+      RIOMetrics::RTimer unzipTimer(RIOMetrics::kUnzipTime);
       pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
 
+   if (fSharedPageCache) {
+      std::shared_ptr<unsigned char[]> sharedBuffer(pageBuffer.release());
+      sharedBuffer = fSharedPageCache->Put(cacheKey, std::move(sharedBuffer), elementSize * pageInfo.fNElements);
+      auto newPage = fPageAllocator->NewPage(columnId, sharedBuffer.get(), elementSize, pageInfo.fNElements);
+      newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                        RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+      fPagePool->RegisterPage(newPage, MakeSharedPageDeleter(std::move(sharedBuffer)));
+      fCounters->fNPagePopulated.Inc();
+      return newPage;
+   }
+
    auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
@@ -368,6 +478,57 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
 }
 
 
+bool ROOT::Experimental::Detail::RPageSourceFile::IsMappablePage(
+   const RColumnElementBase &element, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const
+{
+   if (!fOptions.GetUseMemoryMap() || !(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      return false;
+   if (!element.IsMappable())
+      return false;
+   const auto elementSize = element.GetSize();
+   // Uncompressed pages are stored with exactly the size of their unpacked elements
+   if (pageInfo.fLocator.fBytesOnStorage != elementSize * pageInfo.fNElements)
+      return false;
+   // Mappings start at an OS page boundary, so the element alignment carries over from the file offset
+   return (pageInfo.fLocator.fPosition % elementSize) == 0;
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromMap(ColumnHandle_t columnHandle,
+                                                                 const RClusterInfo &clusterInfo)
+{
+   const auto columnId = columnHandle.fId;
+   const auto clusterId = clusterInfo.fClusterId;
+   const auto pageInfo = clusterInfo.fPageInfo;
+   const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+   const std::uint64_t offset = pageInfo.fLocator.fPosition;
+
+   std::uint64_t mapdOffset;
+   void *region;
+   {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      region = fFile->Map(bytesOnStorage, offset, mapdOffset);
+   }
+   const std::size_t regionSize = bytesOnStorage + (offset - mapdOffset);
+   fCounters->fSzReadPayload.Add(bytesOnStorage);
+   RIOMetrics::Add(RIOMetrics::kBytesRequested, bytesOnStorage);
+   RIOMetrics::Add(RIOMetrics::kBytesRead, bytesOnStorage);
+
+   auto newPage = fPageAllocator->NewPage(columnId, reinterpret_cast<unsigned char *>(region) + (offset - mapdOffset),
+                                          elementSize, pageInfo.fNElements);
+   newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                     RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   // Pages are returned to the page pool while the page source, and therefore fFile, is alive
+   fPagePool->RegisterPage(newPage, RPageDeleter([file = fFile.get(), region, regionSize](const RPage &, void *) {
+                              file->Unmap(region, regionSize);
+                           }));
+   fCounters->fNPagePopulated.Inc();
+   fCounters->fNPageMapped.Inc();
+   return newPage;
+}
+
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::PopulatePage(
    ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
 {
@@ -427,6 +588,7 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
+   clone->fReadPlannerSettings = fReadPlannerSettings;
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
@@ -440,24 +602,29 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
       ROOT::Experimental::NTupleSize_t fPageNo = 0;
       std::uint64_t fOffset = 0;
       std::uint64_t fSize = 0;
-      std::size_t fBufPos = 0;
    };
 
    std::vector<ROnDiskPageLocator> onDiskPages;
-   auto activeSize = 0;
    {
       auto descriptorGuard = GetSharedDescriptorGuard();
       const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterKey.fClusterId);
 
-      // Collect the page necessary page meta-data and sum up the total size of the compressed and packed pages
+      // Collect the page necessary page meta-data
       for (auto columnId : clusterKey.fColumnSet) {
          const auto &pageRange = clusterDesc.GetPageRange(columnId);
+         std::unique_ptr<RColumnElementBase> element;
+         if (fOptions.GetUseMemoryMap())
+            element = RColumnElementBase::Generate(descriptorGuard->GetColumnDescriptor(columnId).GetModel().GetType());
          NTupleSize_t pageNo = 0;
          for (const auto &pageInfo : pageRange.fPageInfos) {
+            // Mappable pages are not part of the cluster; they are mapped on demand by PopulatePage()
+            if (element && IsMappablePage(*element, pageInfo)) {
+               ++pageNo;
+               continue;
+            }
             const auto &pageLocator = pageInfo.fLocator;
-            activeSize += pageLocator.fBytesOnStorage;
             onDiskPages.push_back(
-               {columnId, pageNo, std::uint64_t(pageLocator.fPosition), pageLocator.fBytesOnStorage, 0});
+               {columnId, pageNo, std::uint64_t(pageLocator.fPosition), pageLocator.fBytesOnStorage});
             ++pageNo;
          }
       }
@@ -467,78 +634,35 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    std::sort(onDiskPages.begin(), onDiskPages.end(),
       [](const ROnDiskPageLocator &a, const ROnDiskPageLocator &b) {return a.fOffset < b.fOffset;});
 
-   // In order to coalesce close-by pages, we collect the sizes of the gaps between pages on disk.  We then order
-   // the gaps by size, sum them up and find a cutoff for the largest gap that we tolerate when coalescing pages.
-   // The size of the cutoff is given by the fraction of extra bytes we are willing to read in order to reduce
-   // the number of read requests.  We thus schedule the lowest number of requests given a tolerable fraction
-   // of extra bytes.
-   // TODO(jblomer): Eventually we may want to select the parameter at runtime according to link latency and speed,
-   // memory consumption, device block size.
-   float maxOverhead = 0.25 * float(activeSize);
-   std::vector<std::size_t> gaps;
-   for (unsigned i = 1; i < onDiskPages.size(); ++i) {
-      gaps.emplace_back(onDiskPages[i].fOffset - (onDiskPages[i-1].fSize + onDiskPages[i-1].fOffset));
-   }
-   std::sort(gaps.begin(), gaps.end());
-   std::size_t gapCut = 0;
-   std::size_t currentGap = 0;
-   float szExtra = 0.0;
-   for (auto g : gaps) {
-      if (g != currentGap) {
-         gapCut = currentGap;
-         currentGap = g;
-      }
-      szExtra += g;
-      if (szExtra  > maxOverhead)
-         break;
-   }
-
-   // In a first step, we coalesce the read requests and calculate the cluster buffer size.
-   // In a second step, we'll fix-up the memory destinations for the read calls given the
-   // address of the allocated buffer.  We must not touch, however, the read requests from previous
-   // calls to PrepareSingleCluster()
-   const auto currentReadRequestIdx = readRequests.size();
-
-   ROOT::Internal::RRawFile::RIOVec req;
-   std::size_t szPayload = 0;
-   std::size_t szOverhead = 0;
-   for (auto &s : onDiskPages) {
+   // Coalesce close-by pages into read requests. The requests' data is stored back to back in the cluster buffer.
+   std::vector<ROOT::Internal::RReadPlanner::RRange> ranges;
+   ranges.reserve(onDiskPages.size());
+   for (const auto &s : onDiskPages) {
       R__ASSERT(s.fSize > 0);
-      auto readUpTo = req.fOffset + req.fSize;
-      R__ASSERT(s.fOffset >= readUpTo);
-      auto overhead = s.fOffset - readUpTo;
-      szPayload += s.fSize;
-      if (overhead <= gapCut) {
-         szOverhead += overhead;
-         s.fBufPos = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize + overhead;
-         req.fSize += overhead + s.fSize;
-         continue;
-      }
-
-      // close the current request and open new one
-      if (req.fSize > 0)
-         readRequests.emplace_back(req);
-
-      req.fBuffer = reinterpret_cast<unsigned char *>(req.fBuffer) + req.fSize;
-      s.fBufPos = reinterpret_cast<intptr_t>(req.fBuffer);
-
-      req.fOffset = s.fOffset;
-      req.fSize = s.fSize;
+      ranges.push_back({s.fOffset, s.fSize});
    }
-   readRequests.emplace_back(req);
-   fCounters->fSzReadPayload.Add(szPayload);
-   fCounters->fSzReadOverhead.Add(szOverhead);
+   const auto plan = ROOT::Internal::RReadPlanner::Plan(ranges, fReadPlannerSettings);
+   fCounters->fSzReadPayload.Add(plan.fSzPayload);
+   fCounters->fSzReadOverhead.Add(plan.fSzOverhead);
+   RIOMetrics::Add(RIOMetrics::kBytesRequested, plan.fSzPayload);
+   RIOMetrics::Add(RIOMetrics::kBytesRead, plan.fSzPayload + plan.fSzOverhead);
 
    // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
-   for (const auto &s : onDiskPages) {
+   auto buffer = new unsigned char[plan.fBufferSize];
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer), plan.fBufferSize);
+   for (std::size_t i = 0; i < onDiskPages.size(); ++i) {
+      const auto &s = onDiskPages[i];
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
-      pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
+      pageMap->Register(key, ROnDiskPage(buffer + plan.fRangeBufferOffsets[i], s.fSize));
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
-      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
+   // Requests from previous calls to PrepareSingleCluster() remain untouched
+   for (const auto &r : plan.fRequests) {
+      ROOT::Internal::RRawFile::RIOVec req;
+      req.fBuffer = buffer + r.fBufferOffset;
+      req.fOffset = r.fOffset;
+      req.fSize = r.fSize;
+      readRequests.emplace_back(req);
    }
 
    auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
@@ -550,6 +674,14 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
 
 std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
 ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   auto clusters = LoadClustersAsync(clusterKeys);
+   WaitForClusters(clusters);
+   return clusters;
+}
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClustersAsync(std::span<RCluster::RKey> clusterKeys)
 {
    fCounters->fNClusterLoaded.Add(clusterKeys.size());
 
@@ -559,22 +691,56 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
    for (auto key: clusterKeys) {
       clusters.emplace_back(PrepareSingleCluster(key, readRequests));
    }
+   if (clusters.empty())
+      return clusters;
 
-   auto nReqs = readRequests.size();
+   // Moving the request vector into the map keeps its memory in place, which the in-flight reads point to
+   auto &pendingRequests = fPendingReadRequests[clusters[0].get()];
+   R__ASSERT(pendingRequests.empty());
+   pendingRequests = std::move(readRequests);
+
+   auto nReqs = pendingRequests.size();
+   if (nReqs == 0)
+      return clusters;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-      fFile->ReadV(&readRequests[0], nReqs);
+      fFile->ReadVAsync(&pendingRequests[0], nReqs);
    }
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
+   RIOMetrics::Add(RIOMetrics::kVectorReads, 1);
+   RIOMetrics::Add(RIOMetrics::kReadCalls, 1);
 
    return clusters;
 }
 
+void ROOT::Experimental::Detail::RPageSourceFile::WaitForClusters(std::vector<std::unique_ptr<RCluster>> &clusters)
+{
+   if (clusters.empty())
+      return;
+
+   auto itr = fPendingReadRequests.find(clusters[0].get());
+   R__ASSERT(itr != fPendingReadRequests.end());
+   if (!itr->second.empty()) {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      fFile->WaitReadV(&itr->second[0], itr->second.size());
+   }
+   fPendingReadRequests.erase(itr);
+}
+
+unsigned int ROOT::Experimental::Detail::RPageSourceFile::GetMaxInFlightClusterBunches() const
+{
+   // With asynchronous I/O, the reads of the following cluster bunches overlap with the current one
+   if (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasAsyncIo)
+      return 4;
+   return 1;
+}
+
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
    RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+   RIOMetrics::RTimer unzipTimer(RIOMetrics::kUnzipTime);
    fTaskScheduler->Reset();
 
    const auto clusterId = cluster->GetId();
@@ -593,16 +759,40 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
+         if (IsMappablePage(*allElements.back(), pi)) {
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
+
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
 
          auto taskFunc =
-            [this, columnId, clusterId, firstInPage, onDiskPage,
+            [this, columnId, clusterId, firstInPage, onDiskPage, pageNo,
              element = allElements.back().get(),
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
+               if (fSharedPageCache) {
+                  const RPageCache::RKey cacheKey{fSharedPageCacheSourceId, clusterId, columnId, pageNo};
+                  auto sharedBuffer = fSharedPageCache->Get(cacheKey);
+                  if (sharedBuffer) {
+                     fCounters->fNPageCacheHit.Inc();
+                  } else {
+                     sharedBuffer.reset(
+                        UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element).release());
+                     fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+                     sharedBuffer =
+                        fSharedPageCache->Put(cacheKey, std::move(sharedBuffer), element->GetSize() * nElements);
+                  }
+                  auto newPage = fPageAllocator->NewPage(columnId, sharedBuffer.get(), element->GetSize(), nElements);
+                  newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+                  fPagePool->PreloadPage(newPage, MakeSharedPageDeleter(std::move(sharedBuffer)));
+                  return;
+               }
+
                auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
                fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
@@ -298,6 +298,46 @@ TEST(RNTuple, PageSize)
    EXPECT_EQ(20, col0_pages.fPageInfos.size());
 }
 
+TEST(RNTuple, AdaptivePageSize)
+{
+   FileRaii fileGuard("test_ntuple_adaptive_page_size.root");
+   auto model = RNTupleModel::Create();
+   auto fldConstant = model->MakeField<float>("constant", 1.0);
+   auto fldNoise = model->MakeField<float>("noise");
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetCompression(505);
+      opt.SetApproxUnzippedPageSize(1024);
+      opt.SetUseAdaptiveSizing(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), opt);
+      TRandom3 rnd(42);
+      for (int i = 0; i < 10000; i++) {
+         *fldNoise = rnd.Rndm();
+         ntuple->Fill();
+         if ((i % 2000) == 1999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   ASSERT_EQ(5U, desc->GetNClusters());
+   const auto colConstant = desc->FindColumnId(desc->FindFieldId("constant"), 0);
+   const auto colNoise = desc->FindColumnId(desc->FindFieldId("noise"), 0);
+   // In the first cluster, no compression factors are known yet and both columns use the same page size
+   EXPECT_EQ(desc->GetClusterDescriptor(0).GetPageRange(colConstant).fPageInfos.size(),
+             desc->GetClusterDescriptor(0).GetPageRange(colNoise).fPageInfos.size());
+   // Later on, the well compressible column gets larger pages than the incompressible one
+   const auto &lastCluster = desc->GetClusterDescriptor(4);
+   EXPECT_LT(2 * lastCluster.GetPageRange(colConstant).fPageInfos.size(),
+             lastCluster.GetPageRange(colNoise).fPageInfos.size());
+
+   auto viewConstant = ntuple->GetView<float>("constant");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_FLOAT_EQ(1.0, viewConstant(i));
+}
+
 TEST(RNTupleModel, EnforceValidFieldNames)
 {
    auto model = RNTupleModel::Create();
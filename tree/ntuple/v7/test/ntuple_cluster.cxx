@@ -281,6 +281,37 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, GetClusterLazyColumns)
+{
+   RPageSourceMock p1;
+   RClusterPool c1(p1, 1);
+   c1.GetCluster(3, {0, 1}, {0});
+   c1.WaitForInFlightClusters();
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(3U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(4U, p1.fReqsClusterIds[1]);
+   EXPECT_EQ(RCluster::ColumnSet_t({0, 1}), p1.fReqsColumns[0]);
+   EXPECT_EQ(RCluster::ColumnSet_t({0}), p1.fReqsColumns[1]);
+
+   // Only the lazy column is missing from the preloaded cluster
+   c1.GetCluster(4, {0, 1}, {0});
+   c1.WaitForInFlightClusters();
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(4U, p1.fReqsClusterIds[2]);
+   EXPECT_EQ(5U, p1.fReqsClusterIds[3]);
+   EXPECT_EQ(RCluster::ColumnSet_t({1}), p1.fReqsColumns[2]);
+   EXPECT_EQ(RCluster::ColumnSet_t({0}), p1.fReqsColumns[3]);
+
+   // Nothing is preloaded if all the columns are lazy
+   RPageSourceMock p2;
+   RClusterPool c2(p2, 1);
+   c2.GetCluster(0, {1}, {});
+   c2.WaitForInFlightClusters();
+   ASSERT_EQ(1U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p2.fReqsClusterIds[0]);
+   EXPECT_EQ(RCluster::ColumnSet_t({1}), p2.fReqsColumns[0]);
+}
+
 TEST(PageStorageFile, LoadClusters)
 {
    FileRaii fileGuard("test_pagestoragefile_loadclusters.root");
@@ -80,3 +80,122 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+
+void WriteMergeInput(const std::string &path, int compression, int first, int n)
+{
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldJets = model->MakeField<std::vector<std::int32_t>>("jets");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   for (int i = first; i < first + n; ++i) {
+      *fldPt = i;
+      *fldJets = std::vector<std::int32_t>(i % 3, i);
+      writer->Fill();
+      if (i % 10 == 9)
+         writer->CommitCluster();
+   }
+}
+
+std::int64_t GetMergeCounter(const RNTupleMerger &merger, const std::string &name)
+{
+   auto counter = merger.GetMetrics().GetCounter("RNTupleMerger." + name);
+   EXPECT_NE(nullptr, counter);
+   return counter->GetValueAsInt();
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, FastMerge)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuardOut("test_ntuple_merge_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 505, 0, 25);
+   WriteMergeInput(fileGuard2.GetPath(), 505, 25, 30);
+
+   RNTupleMerger merger;
+   merger.EnableMetrics();
+   {
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{&source1, &source2};
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), options);
+      merger.Merge(sources, destination);
+   }
+   EXPECT_GT(GetMergeCounter(merger, "nPageCopied"), 0);
+   EXPECT_EQ(0, GetMergeCounter(merger, "nPageResealed"));
+   EXPECT_EQ(GetMergeCounter(merger, "szRead"), GetMergeCounter(merger, "szWritten"));
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuardOut.GetPath());
+   EXPECT_EQ(55U, reader->GetNEntries());
+   EXPECT_EQ(7U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewJets = reader->GetView<std::vector<std::int32_t>>("jets");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<std::int32_t>(i % 3, i), viewJets(i));
+   }
+}
+
+TEST(RNTupleMerger, Recompress)
+{
+   FileRaii fileGuardIn("test_ntuple_merge_recompress_in.root");
+   FileRaii fileGuardOut("test_ntuple_merge_recompress_out.root");
+   WriteMergeInput(fileGuardIn.GetPath(), 0, 0, 20);
+
+   RNTupleMerger merger;
+   merger.EnableMetrics();
+   {
+      RPageSourceFile source("ntpl", fileGuardIn.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{&source};
+      RNTupleWriteOptions options;
+      options.SetCompression(404);
+      RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), options);
+      merger.Merge(sources, destination);
+   }
+   EXPECT_EQ(0, GetMergeCounter(merger, "nPageCopied"));
+   EXPECT_GT(GetMergeCounter(merger, "nPageResealed"), 0);
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuardOut.GetPath());
+   EXPECT_EQ(20U, reader->GetNEntries());
+   const auto &desc = reader->GetDescriptor();
+   const auto columnId = desc->FindColumnId(desc->FindFieldId("pt"), 0);
+   for (const auto &clusterDesc : desc->GetClusterIterable())
+      EXPECT_EQ(404, clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+   auto viewPt = reader->GetView<float>("pt");
+   for (auto i : reader->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+}
+
+TEST(RNTupleMerger, SchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merge_mismatch_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_mismatch_in_2.root");
+   FileRaii fileGuardOut("test_ntuple_merge_mismatch_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 505, 0, 10);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<float>>("jets");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      writer->Fill();
+   }
+
+   RNTupleMerger merger;
+   RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+   RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+   std::vector<RPageSource *> sources{&source1, &source2};
+   RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), RNTupleWriteOptions());
+   try {
+      merger.Merge(sources, destination);
+      FAIL() << "merging ntuples with different schema should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("type mismatch"));
+   }
+}
@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -50,3 +52,120 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0xaa, s2.GetIndex());
    EXPECT_EQ(0x55, s2.GetTag());
 }
+
+TEST(Packing, SplitEncoding)
+{
+   using ROOT::Experimental::EColumnType;
+   using ROOT::Experimental::Detail::RColumnElement;
+
+   RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32> elemIndex(nullptr);
+   elemIndex.Pack(nullptr, nullptr, 0);
+   elemIndex.Unpack(nullptr, nullptr, 0);
+   ClusterSize_t index[] = {ClusterSize_t{0}, ClusterSize_t{4}, ClusterSize_t{8}, ClusterSize_t{0x01020310}};
+   unsigned char packedIndex[sizeof(index)];
+   elemIndex.Pack(packedIndex, index, 4);
+   // Delta encoding: 0, 4, 4, 0x01020308; byte planes from least significant to most significant
+   unsigned char expectedIndex[] = {0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x03,
+                                    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01};
+   for (unsigned i = 0; i < sizeof(index); ++i)
+      EXPECT_EQ(expectedIndex[i], packedIndex[i]);
+   ClusterSize_t unpackedIndex[4];
+   elemIndex.Unpack(unpackedIndex, packedIndex, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(index[i], unpackedIndex[i]);
+
+   RColumnElement<std::int16_t, EColumnType::kSplitInt16> elemInt16(nullptr);
+   std::int16_t i16[] = {0, -1, 1, -2, std::numeric_limits<std::int16_t>::min(),
+                         std::numeric_limits<std::int16_t>::max()};
+   unsigned char packedInt16[sizeof(i16)];
+   elemInt16.Pack(packedInt16, i16, 6);
+   // Zigzag encoding maps small magnitudes to small unsigned values
+   EXPECT_EQ(0, packedInt16[0]);
+   EXPECT_EQ(1, packedInt16[1]);
+   EXPECT_EQ(2, packedInt16[2]);
+   EXPECT_EQ(3, packedInt16[3]);
+   std::int16_t unpackedInt16[6];
+   elemInt16.Unpack(unpackedInt16, packedInt16, 6);
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(i16[i], unpackedInt16[i]);
+
+   RColumnElement<std::int32_t, EColumnType::kSplitInt32> elemInt32(nullptr);
+   std::int32_t i32[] = {42, -42, std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max()};
+   unsigned char packedInt32[sizeof(i32)];
+   elemInt32.Pack(packedInt32, i32, 4);
+   std::int32_t unpackedInt32[4];
+   elemInt32.Unpack(unpackedInt32, packedInt32, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i32[i], unpackedInt32[i]);
+
+   RColumnElement<std::int64_t, EColumnType::kSplitInt64> elemInt64(nullptr);
+   std::int64_t i64[] = {42, -42, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()};
+   unsigned char packedInt64[sizeof(i64)];
+   elemInt64.Pack(packedInt64, i64, 4);
+   std::int64_t unpackedInt64[4];
+   elemInt64.Unpack(unpackedInt64, packedInt64, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i64[i], unpackedInt64[i]);
+
+   RColumnElement<float, EColumnType::kSplitReal32> elemReal32(nullptr);
+   float f32[] = {0.0, 1.0, -2.5, std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
+   unsigned char packedReal32[sizeof(f32)];
+   elemReal32.Pack(packedReal32, f32, 5);
+   float unpackedReal32[5];
+   elemReal32.Unpack(unpackedReal32, packedReal32, 5);
+   for (unsigned i = 0; i < 5; ++i)
+      EXPECT_FLOAT_EQ(f32[i], unpackedReal32[i]);
+
+   RColumnElement<double, EColumnType::kSplitReal64> elemReal64(nullptr);
+   double f64[] = {0.0, 1.0, -2.5, std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+   unsigned char packedReal64[sizeof(f64)];
+   elemReal64.Pack(packedReal64, f64, 5);
+   double unpackedReal64[5];
+   elemReal64.Unpack(unpackedReal64, packedReal64, 5);
+   for (unsigned i = 0; i < 5; ++i)
+      EXPECT_DOUBLE_EQ(f64[i], unpackedReal64[i]);
+}
+
+TEST(Packing, SplitEncodingRoundTrip)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldE = model->MakeField<double>("energy");
+      auto fldId = model->MakeField<std::int32_t>("id");
+      auto fldJets = model->MakeField<std::vector<std::int64_t>>("jets");
+      RNTupleWriteOptions options;
+      options.SetUseSplitEncoding(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *fldPt = 0.5f * i;
+         *fldE = -1.5 * i;
+         *fldId = 500 - i;
+         fldJets->clear();
+         for (int j = 0; j < i % 5; ++j)
+            fldJets->push_back(-j * i);
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc->FindColumnId(desc->FindFieldId("pt"), 0);
+   EXPECT_EQ(EColumnType::kSplitReal32, desc->GetColumnDescriptor(ptColumnId).GetModel().GetType());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewE = ntuple->GetView<double>("energy");
+   auto viewId = ntuple->GetView<std::int32_t>("id");
+   auto viewJets = ntuple->GetView<std::vector<std::int64_t>>("jets");
+   ASSERT_EQ(1000U, ntuple->GetNEntries());
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(0.5f * i, viewPt(i));
+      EXPECT_DOUBLE_EQ(-1.5 * i, viewE(i));
+      EXPECT_EQ(500 - static_cast<std::int32_t>(i), viewId(i));
+      const auto &jets = viewJets(i);
+      ASSERT_EQ(i % 5, jets.size());
+      for (std::size_t j = 0; j < jets.size(); ++j)
+         EXPECT_EQ(-static_cast<std::int64_t>(j * i), jets[j]);
+   }
+}
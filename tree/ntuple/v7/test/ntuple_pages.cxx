@@ -56,3 +56,88 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, Cache)
+{
+   RPageCache cache(100);
+   const auto sourceId = cache.GetSourceId("file.root:ntpl");
+   EXPECT_EQ(sourceId, cache.GetSourceId("file.root:ntpl"));
+   EXPECT_NE(sourceId, cache.GetSourceId("other.root:ntpl"));
+
+   RPageCache::RKey key1{sourceId, 0, 0, 0};
+   RPageCache::RKey key2{sourceId, 0, 1, 0};
+   RPageCache::RKey key3{sourceId, 1, 0, 0};
+   EXPECT_EQ(nullptr, cache.Get(key1));
+
+   std::shared_ptr<unsigned char[]> buffer1(new unsigned char[40]);
+   EXPECT_EQ(buffer1, cache.Put(key1, buffer1, 40));
+   EXPECT_EQ(buffer1, cache.Get(key1));
+   EXPECT_EQ(40U, cache.GetMemoryUsed());
+
+   // A concurrently unzipped copy of the same page is not inserted
+   std::shared_ptr<unsigned char[]> buffer1Copy(new unsigned char[40]);
+   EXPECT_EQ(buffer1, cache.Put(key1, buffer1Copy, 40));
+   EXPECT_EQ(40U, cache.GetMemoryUsed());
+
+   std::shared_ptr<unsigned char[]> buffer2(new unsigned char[40]);
+   cache.Put(key2, buffer2, 40);
+   // Touch key1 so that key2 becomes the least recently used entry
+   EXPECT_EQ(buffer1, cache.Get(key1));
+   std::shared_ptr<unsigned char[]> buffer3(new unsigned char[40]);
+   cache.Put(key3, buffer3, 40);
+   EXPECT_EQ(2U, cache.GetNEntries());
+   EXPECT_EQ(80U, cache.GetMemoryUsed());
+   EXPECT_EQ(nullptr, cache.Get(key2));
+   EXPECT_EQ(buffer1, cache.Get(key1));
+   EXPECT_EQ(buffer3, cache.Get(key3));
+
+   // Buffers larger than the budget are passed through
+   std::shared_ptr<unsigned char[]> bufferLarge(new unsigned char[200]);
+   EXPECT_EQ(bufferLarge, cache.Put(key2, bufferLarge, 200));
+   EXPECT_EQ(nullptr, cache.Get(key2));
+
+   cache.SetMemoryBudget(50);
+   EXPECT_EQ(1U, cache.GetNEntries());
+   EXPECT_EQ(buffer3, cache.Get(key3));
+
+   cache.Clear();
+   EXPECT_EQ(0U, cache.GetNEntries());
+   EXPECT_EQ(0U, cache.GetMemoryUsed());
+}
+
+TEST(Pages, SharedCache)
+{
+   FileRaii fileGuard("test_ntuple_pages_shared_cache.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 1000; ++i) {
+         *fldPt = static_cast<float>(i);
+         writer->Fill();
+      }
+   }
+
+   RPageCache::GetShared().Clear();
+   RNTupleReadOptions options;
+   options.SetUseSharedPageCache(true);
+
+   auto reader1 = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   auto viewPt1 = reader1->GetView<float>("pt");
+   for (auto i : reader1->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt1(i));
+   EXPECT_GT(RPageCache::GetShared().GetNEntries(), 0U);
+
+   auto reader2 = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   reader2->EnableMetrics();
+   auto viewPt2 = reader2->GetView<float>("pt");
+   for (auto i : reader2->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt2(i));
+   auto nPageCacheHit = reader2->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageCacheHit");
+   ASSERT_NE(nullptr, nPageCacheHit);
+   EXPECT_GT(nPageCacheHit->GetValueAsInt(), 0);
+
+   // Cached buffers stay valid when dropped from the cache while pages still use them
+   RPageCache::GetShared().Clear();
+   EXPECT_FLOAT_EQ(10.f, viewPt2(10));
+}
@@ -0,0 +1,107 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<std::int32_t>>("jets");
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      auto context = writer->CreateFillContext();
+      *context->GetModel()->GetDefaultEntry()->Get<float>("pt") = 1.0;
+      context->Fill();
+      auto entry = context->CreateEntry();
+      *entry->Get<float>("pt") = 2.0;
+      entry->Get<std::vector<std::int32_t>>("jets")->push_back(3);
+      context->Fill(*entry);
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(2U, reader->GetNEntries());
+   EXPECT_EQ(1U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewJets = reader->GetView<std::vector<std::int32_t>>("jets");
+   EXPECT_FLOAT_EQ(1.0, viewPt(0));
+   EXPECT_TRUE(viewJets(0).empty());
+   EXPECT_FLOAT_EQ(2.0, viewPt(1));
+   EXPECT_EQ(std::vector<std::int32_t>{3}, viewJets(1));
+}
+
+TEST(RNTupleParallelWriter, FrozenModel)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_frozen.root");
+
+   auto model = RNTupleModel::Create();
+   model->Freeze();
+   try {
+      RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      FAIL() << "creating a parallel writer from a frozen model should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("must not be frozen"));
+   }
+}
+
+TEST(RNTupleParallelWriter, EntryMismatch)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_mismatch.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+   auto context1 = writer->CreateFillContext();
+   auto context2 = writer->CreateFillContext();
+   auto entry = context1->CreateEntry();
+   EXPECT_THROW(context2->Fill(*entry), RException);
+}
+
+TEST(RNTupleParallelWriter, MultiThreaded)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_mt.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<std::int32_t>("thread");
+   model->MakeField<std::int32_t>("value");
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(4096);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *entry->Get<std::int32_t>("thread") = t;
+               *entry->Get<std::int32_t>("value") = i;
+               context->Fill(*entry);
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), reader->GetNEntries());
+   EXPECT_GT(reader->GetDescriptor()->GetNClusters(), static_cast<std::size_t>(kNThreads));
+
+   // Within a thread, the entries keep their fill order
+   std::vector<std::int32_t> nextValue(kNThreads, 0);
+   auto viewThread = reader->GetView<std::int32_t>("thread");
+   auto viewValue = reader->GetView<std::int32_t>("value");
+   for (auto i : reader->GetEntryRange()) {
+      const auto t = viewThread(i);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      EXPECT_EQ(nextValue[t], viewValue(i));
+      nextValue[t]++;
+   }
+   for (auto n : nextValue)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
@@ -414,6 +414,35 @@ TEST(RPageSinkBuf, ParallelZip) {
    }
 }
 
+TEST(RPageSinkBuf, ParallelZipOff)
+{
+   ROOT::EnableImplicitMT();
+
+   FileRaii fileGuard("test_ntuple_sinkbuf_pzip_off.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto floatField = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetUseImplicitMT(RNTupleWriteOptions::EImplicitMT::kOff);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "pzip_off", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 1000; i++) {
+         *floatField = static_cast<float>(i);
+         ntuple->Fill();
+      }
+      ntuple->CommitCluster();
+      auto *parallel_zip = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.ParallelZip");
+      ASSERT_FALSE(parallel_zip == nullptr);
+      EXPECT_EQ(0, parallel_zip->GetValueAsInt());
+   }
+
+   auto ntuple = RNTupleReader::Open("pzip_off", fileGuard.GetPath());
+   EXPECT_EQ(1000U, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+}
+
 TEST(RPageSinkBuf, CommitSealedPageV)
 {
    RNTupleWriteOptions options;
@@ -507,3 +536,123 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RPageSourceFile, MemoryMap)
+{
+   FileRaii fileGuard("test_ntuple_page_source_mmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<char>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrTag = 'a' + (i % 26);
+         ntuple->Fill();
+         if (i == 500)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetUseMemoryMap(true);
+      auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<char>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ('a' + static_cast<char>(i % 26), viewTag(i));
+      }
+      // Pages of single byte elements are always suitably aligned for mapping
+      auto *nPageMapped = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped");
+      ASSERT_FALSE(nPageMapped == nullptr);
+      EXPECT_LE(2, nPageMapped->GetValueAsInt());
+   }
+}
+
+TEST(RPageSourceFile, BackgroundUnzip)
+{
+   FileRaii fileGuard("test_ntuple_page_source_background_unzip.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 250 == 249)
+            ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::DisableImplicitMT();
+   RNTupleReadOptions options;
+   options.SetUseBackgroundUnzip(true);
+   options.SetClusterBunchSize(2);
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath(), options);
+   auto rdPt = ntuple->GetModel()->Get<float>("pt");
+   auto rdTag = ntuple->GetModel()->Get<std::string>("tag");
+   for (auto i : ntuple->GetEntryRange()) {
+      ntuple->LoadEntry(i);
+      EXPECT_EQ(static_cast<float>(i), *rdPt);
+      EXPECT_EQ(std::to_string(i), *rdTag);
+   }
+   ROOT::EnableImplicitMT();
+}
+
+TEST(RPageSink, ValueRanges)
+{
+   FileRaii fileGuard("test_ntuple_value_ranges.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrId = model->MakeField<std::uint32_t>("id");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetComputeValueRanges(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrId = 0xF0000000u + i;
+         *wrTag = "abc";
+         ntuple->Fill();
+         if (i == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   const auto &desc = *ntuple->GetDescriptor();
+   ASSERT_EQ(2U, desc.GetNClusters());
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto idColumnId = desc.FindColumnId(desc.FindFieldId("id"), 0);
+   const auto tagColumnId = desc.FindColumnId(desc.FindFieldId("tag"), 0);
+
+   const auto &cluster0 = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 0));
+   auto range = cluster0.GetValueRange(ptColumnId);
+   EXPECT_TRUE(range.fIsValid);
+   EXPECT_EQ(0.0, range.fMin);
+   EXPECT_EQ(49.0, range.fMax);
+   EXPECT_FALSE(range.MayOverlap(50.0, 100.0));
+
+   const auto &cluster1 = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 50));
+   range = cluster1.GetValueRange(ptColumnId);
+   EXPECT_TRUE(range.fIsValid);
+   EXPECT_EQ(50.0, range.fMin);
+   EXPECT_EQ(99.0, range.fMax);
+
+   // Unsigned values are not interpreted as signed integers of the column type
+   range = cluster1.GetValueRange(idColumnId);
+   EXPECT_TRUE(range.fIsValid);
+   EXPECT_EQ(static_cast<double>(0xF0000000u + 50), range.fMin);
+
+   // Offset columns have no value range
+   EXPECT_FALSE(cluster1.GetValueRange(tagColumnId).fIsValid);
+}
@@ -84,3 +84,43 @@ TEST(RNTupleZip, Large)
    decompressor.Unzip(zipBuffer.get(), szZip, N, unzipBuffer.get());
    EXPECT_EQ(data, std::string(unzipBuffer.get(), N));
 }
+
+
+TEST(RNTupleZip, Streaming)
+{
+   constexpr unsigned int N = kMAXZIPBUF + 32;
+   auto zipBuffer = std::make_unique<unsigned char[]>(N);
+   auto unzipBuffer = std::make_unique<unsigned char[]>(N);
+   std::string data(N, 'x');
+   for (unsigned int i = 0; i < N; i += 1000)
+      data[i] = 'a' + (i % 26);
+
+   RNTupleCompressor compressor;
+   auto szZip = compressor.Zip(data.data(), data.length(), 505,
+      [&zipBuffer](const void *buffer, size_t nbytes, size_t offset) {
+         memcpy(zipBuffer.get() + offset, buffer, nbytes);
+      });
+   ASSERT_LT(szZip, N);
+
+   // the records arrive in pieces that split the headers and the records
+   for (int pieceSize : {1, 7, 1000, static_cast<int>(szZip)}) {
+      memset(unzipBuffer.get(), 0, N);
+      R__unzip_stream stream;
+      R__unzip_stream_init(&stream, unzipBuffer.get(), N);
+      int nout = 0;
+      for (int offset = 0; offset < static_cast<int>(szZip); offset += pieceSize) {
+         int nbytes = std::min(pieceSize, static_cast<int>(szZip) - offset);
+         nout = R__unzip_stream_feed(&stream, zipBuffer.get() + offset, nbytes);
+         ASSERT_GE(nout, 0);
+      }
+      EXPECT_EQ(0, R__unzip_stream_end(&stream));
+      EXPECT_EQ(static_cast<int>(N), nout);
+      EXPECT_EQ(data, std::string(reinterpret_cast<char *>(unzipBuffer.get()), N));
+   }
+
+   // an incomplete record is reported at the end
+   R__unzip_stream stream;
+   R__unzip_stream_init(&stream, unzipBuffer.get(), N);
+   EXPECT_GE(R__unzip_stream_feed(&stream, zipBuffer.get(), szZip - 1), 0);
+   EXPECT_EQ(1, R__unzip_stream_end(&stream));
+}
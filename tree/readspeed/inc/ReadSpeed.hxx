@@ -19,6 +19,8 @@
 
 namespace ReadSpeed {
 
+enum class EDataFormat { kTTree, kRNTuple };
+
 struct Data {
    /// Either a single tree name common for all files, or one tree name per file.
    std::vector<std::string> fTreeNames;
@@ -28,6 +30,10 @@ struct Data {
    std::vector<std::string> fBranchNames;
    /// If the branch names should use regex matching.
    bool fUseRegex = false;
+   /// If the time spent fetching, decompressing and deserializing the data should be measured separately.
+   bool fMeasureStages = false;
+   /// Number of clusters that the page sources of RNTuples read at once (0 for the default).
+   unsigned int fClusterBunchSize = 0;
 };
 
 struct Result {
@@ -45,6 +51,15 @@ struct Result {
    ULong64_t fCompressedBytesRead;
    /// Size of ROOT's thread pool for the run (0 indicates a single-thread run with no thread pool present).
    unsigned int fThreadPoolSize;
+   /// Time spent fetching the compressed data from storage, summed over threads, in seconds (-1 if not measured).
+   double fFetchTime = -1.;
+   /// Time spent decompressing the data, summed over threads, in seconds (-1 if not measured).
+   double fDecompressTime = -1.;
+   /// Time spent deserializing the data into the in-memory objects, summed over threads, in seconds (-1 if not
+   /// measured).
+   double fDeserializeTime = -1.;
+   /// Format of the data that was read.
+   EDataFormat fFormat = EDataFormat::kTTree;
 };
 
 struct EntryRange {
@@ -55,6 +70,10 @@ struct EntryRange {
 struct ByteData {
    ULong64_t fUncompressedBytesRead;
    ULong64_t fCompressedBytesRead;
+   /// Times spent in each reading stage in seconds, only filled if the stages are measured.
+   double fFetchTime = 0.;
+   double fDecompressTime = 0.;
+   double fDeserializeTime = 0.;
 };
 
 struct ReadSpeedRegex {
@@ -68,8 +87,22 @@ std::vector<std::string> GetMatchingBranchNames(const std::string &fileName, con
                                                 const std::vector<ReadSpeedRegex> &regexes);
 
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
+// If measureStages is true, the baskets are fetched, decompressed and deserialized one after the other and the
+// time spent in each stage is returned as well.
 ByteData ReadTree(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
-                  EntryRange range = {-1, -1});
+                  EntryRange range = {-1, -1}, bool measureStages = false);
+
+// Read the top-level fields listed in fieldNames of the RNTuple ntupleName in file fileName, with the read options
+// of d (cluster bunch size, stage measurement). The bytes read are the ones accounted by the page source.
+ByteData ReadNTuple(const std::string &fileName, const std::string &ntupleName,
+                    const std::vector<std::string> &fieldNames, const Data &d);
+
+// Return whether the dataset of d is made of TTrees or RNTuples, looking at its first file.
+EDataFormat GetDataFormat(const Data &d);
+
+// Copy the dataset of d to new files in directory dir, with the given compression settings (see
+// ROOT::RCompressionSetting), and return the description of the copy. The caller removes the new files.
+Data RecompressData(const Data &d, int compression, const std::string &dir);
 
 Result EvalThroughputST(const Data &d);
 
@@ -85,6 +118,9 @@ MergeClusters(std::vector<std::vector<EntryRange>> &&clusters, unsigned int maxT
 
 Result EvalThroughputMT(const Data &d, unsigned nThreads);
 
+// Read RNTuples, each file by a different task of a pool of nThreads threads if nThreads > 0.
+Result EvalThroughputRNTuple(const Data &d, unsigned nThreads);
+
 Result EvalThroughput(const Data &d, unsigned nThreads);
 
 } // namespace ReadSpeed
@@ -16,6 +16,8 @@
 
 #include "ReadSpeed.hxx"
 
+#include <ostream>
+#include <string>
 #include <vector>
 
 namespace ReadSpeed {
@@ -27,11 +29,33 @@ struct Args {
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   /// Compression settings to rewrite the data with before reading it, one run each (empty to read the data as is).
+   std::vector<int> fCompressionSettings;
+   /// Cluster bunch sizes to read RNTuples with, one run each (empty for the default).
+   std::vector<unsigned int> fClusterBunchSizes;
+   /// File to write the results of the runs to in JSON format (empty for none).
+   std::string fJSONFile;
+   /// Directory where the recompressed copies of the data are written.
+   std::string fScratchDir;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
 Args ParseArgs(int argc, char **argv);
 
+struct BenchmarkRun {
+   /// Compression setting the data was rewritten with (-1 for the original data).
+   int fCompression = -1;
+   /// Cluster bunch size the data was read with (0 for the default).
+   unsigned int fClusterBunchSize = 0;
+   Result fResult;
+};
+
+// Run and print one throughput evaluation per combination of the compression settings and cluster bunch sizes of
+// args.
+std::vector<BenchmarkRun> RunBenchmarks(const Args &args);
+
+void WriteJSON(const std::vector<BenchmarkRun> &runs, std::ostream &os);
+
 } // namespace ReadSpeed
 
 #endif // ROOTREADSPEEDCLI
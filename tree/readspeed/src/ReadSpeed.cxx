@@ -10,6 +10,7 @@
 
 #include "ReadSpeed.hxx"
 
+#include <RConfigure.h> // R__HAS_ROOT7
 #include <ROOT/TSeq.hxx>
 
 #ifdef R__USE_IMT
@@ -18,14 +19,25 @@
 #include <ROOT/RSlotStack.hxx>
 #endif
 
+#ifdef R__HAS_ROOT7
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#endif
+
+#include <Bytes.h> // frombuf
 #include <ROOT/InternalTreeUtils.hxx> // for ROOT::Internal::TreeUtils::GetTopLevelBranchNames
+#include <RZip.h>
 #include <TBranch.h>
 #include <TStopwatch.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath> // std::ceil
+#include <cstring> // std::memcpy
 #include <memory>
 #include <numeric> // std::accumulate
 #include <stdexcept>
@@ -34,17 +46,11 @@
 
 using namespace ReadSpeed;
 
-std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
-                                                           const std::vector<ReadSpeedRegex> &regexes)
+// Select the names matching any of the regexes, and make sure that all regexes are used
+static std::vector<std::string> MatchNames(const std::vector<std::string> &unfilteredBranchNames,
+                                           const std::vector<ReadSpeedRegex> &regexes, const std::string &treeName,
+                                           const std::string &fileName)
 {
-   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-   if (f == nullptr || f->IsZombie())
-      throw std::runtime_error("Could not open file '" + fileName + '\'');
-   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
-   if (t == nullptr)
-      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
-
-   const auto unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
    std::set<ReadSpeedRegex> usedRegexes;
    std::vector<std::string> branchNames;
 
@@ -88,7 +94,33 @@ std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fi
    return branchNames;
 }
 
-std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
+std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
+                                                           const std::vector<ReadSpeedRegex> &regexes)
+{
+   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (f == nullptr || f->IsZombie())
+      throw std::runtime_error("Could not open file '" + fileName + '\'');
+   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
+   if (t == nullptr)
+      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+
+   return MatchNames(ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t), regexes, treeName, fileName);
+}
+
+#ifdef R__HAS_ROOT7
+// Top-level field names of an RNTuple matching the regexes
+static std::vector<std::string> GetMatchingFieldNames(const std::string &fileName, const std::string &ntupleName,
+                                                      const std::vector<ReadSpeedRegex> &regexes)
+{
+   auto reader = ROOT::Experimental::RNTupleReader::Open(ntupleName, fileName);
+   std::vector<std::string> fieldNames;
+   for (const auto &field : reader->GetDescriptor()->GetTopLevelFields())
+      fieldNames.emplace_back(field.GetFieldName());
+   return MatchNames(fieldNames, regexes, ntupleName, fileName);
+}
+#endif
+
+std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d, EDataFormat format = EDataFormat::kTTree)
 {
    auto treeIdx = 0;
    std::vector<std::vector<std::string>> fileBranchNames;
@@ -101,7 +133,11 @@ std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
 
    for (const auto &fName : d.fFileNames) {
       std::vector<std::string> branchNames;
-      if (d.fUseRegex)
+      if (d.fUseRegex && format == EDataFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+         branchNames = GetMatchingFieldNames(fName, d.fTreeNames[treeIdx], regexes);
+#endif
+      } else if (d.fUseRegex)
          branchNames = GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes);
       else
          branchNames = d.fBranchNames;
@@ -123,12 +159,108 @@ ByteData SumBytes(const std::vector<ByteData> &bytesData) {
       std::accumulate(bytesData.begin(), bytesData.end(), 0ull,
                         [](ULong64_t sum, const ByteData &o) { return sum + o.fCompressedBytesRead; });
 
-   return {uncompressedBytes, compressedBytes};
+   ByteData sum{uncompressedBytes, compressedBytes};
+   for (const auto &o : bytesData) {
+      sum.fFetchTime += o.fFetchTime;
+      sum.fDecompressTime += o.fDecompressTime;
+      sum.fDeserializeTime += o.fDeserializeTime;
+   }
+   return sum;
 };
 
+// Fill the stage times of a result if they were measured
+static Result WithStageTimes(Result r, const ByteData &byteData, bool measureStages)
+{
+   if (measureStages) {
+      r.fFetchTime = byteData.fFetchTime;
+      r.fDecompressTime = byteData.fDecompressTime;
+      r.fDeserializeTime = byteData.fDeserializeTime;
+   }
+   return r;
+}
+
+static double SecondsSince(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Decompress the raw bytes of a basket as read from the file, key header included, like TBasket::ReadBasketBuffers
+static void UnzipBasket(std::vector<char> &raw, std::vector<unsigned char> &unzipped, const TBranch &b)
+{
+   char *header = raw.data();
+   Int_t nbytes, objlen;
+   Version_t version;
+   UInt_t datime;
+   Short_t keylen;
+   frombuf(header, &nbytes);
+   frombuf(header, &version);
+   frombuf(header, &objlen);
+   frombuf(header, &datime);
+   frombuf(header, &keylen);
+
+   unzipped.resize(objlen);
+   if (objlen <= nbytes - keylen) { // stored uncompressed
+      std::memcpy(unzipped.data(), raw.data() + keylen, objlen);
+      return;
+   }
+   auto *src = reinterpret_cast<unsigned char *>(raw.data()) + keylen;
+   Int_t nout = 0;
+   while (nout < objlen) {
+      int nin, nbuf, nunzip = 0;
+      if (R__unzip_header(&nin, src, &nbuf) != 0)
+         throw std::runtime_error(std::string("Inconsistent compressed record in a basket of branch '") +
+                                  b.GetName() + '\'');
+      R__unzip(&nin, src, &nbuf, unzipped.data() + nout, &nunzip);
+      if (nunzip == 0)
+         throw std::runtime_error(std::string("Could not decompress a basket of branch '") + b.GetName() + '\'');
+      nout += nunzip;
+      src += nin;
+   }
+}
+
+// Read the entries of the range basket by basket, timing separately the three reading stages: the raw basket is
+// fetched from the file and decompressed, then the branch loads the basket again (not timed, mostly from the OS page
+// cache) and its entries are deserialized.
+static ByteData ReadTreeStages(TFile &f, const std::vector<TBranch *> &branches, EntryRange range)
+{
+   ByteData data{0ull, 0ull};
+   std::vector<char> raw;
+   std::vector<unsigned char> unzipped;
+   for (auto *b : branches) {
+      const auto nBaskets = b->GetWriteBasket();
+      const auto *basketEntry = b->GetBasketEntry();
+      for (Int_t i = 0; i < nBaskets; ++i) {
+         const auto first = std::max(basketEntry[i], range.fStart);
+         const auto last = std::min(i + 1 < nBaskets ? basketEntry[i + 1] : b->GetEntries(), range.fEnd);
+         if (first >= last)
+            continue;
+
+         const auto nbytes = b->GetBasketBytes()[i];
+         raw.resize(nbytes);
+         auto start = std::chrono::steady_clock::now();
+         if (f.ReadBuffer(raw.data(), b->GetBasketSeek(i), nbytes))
+            throw std::runtime_error(std::string("Could not read a basket of branch '") + b->GetName() +
+                                     "' from file '" + f.GetName() + '\'');
+         data.fFetchTime += SecondsSince(start);
+         data.fCompressedBytesRead += nbytes;
+
+         start = std::chrono::steady_clock::now();
+         UnzipBasket(raw, unzipped, *b);
+         data.fDecompressTime += SecondsSince(start);
+
+         b->GetBasket(i);
+         start = std::chrono::steady_clock::now();
+         for (auto e = first; e < last; ++e)
+            data.fUncompressedBytesRead += b->GetEntry(e);
+         data.fDeserializeTime += SecondsSince(start);
+      }
+   }
+   return data;
+}
+
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
 ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
-                             EntryRange range)
+                             EntryRange range, bool measureStages)
 {
    std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
    if (t == nullptr)
@@ -155,6 +287,9 @@ ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::v
                                t->GetName() + "' in file '" + t->GetCurrentFile()->GetName() + "' with " +
                                std::to_string(nEntries) + " entries.");
 
+   if (measureStages)
+      return ReadTreeStages(*f, branches, range);
+
    ULong64_t bytesRead = 0;
    const ULong64_t fileStartBytes = f->GetBytesRead();
    for (auto e = range.fStart; e < range.fEnd; ++e)
@@ -169,8 +304,7 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
 {
    auto treeIdx = 0;
    auto fileIdx = 0;
-   ULong64_t uncompressedBytesRead = 0;
-   ULong64_t compressedBytesRead = 0;
+   std::vector<ByteData> filesByteData;
 
    TStopwatch sw;
    const auto fileBranchNames = GetPerFileBranchNames(d);
@@ -182,9 +316,8 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
 
       sw.Start(kFALSE);
 
-      const auto byteData = ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx]);
-      uncompressedBytesRead += byteData.fUncompressedBytesRead;
-      compressedBytesRead += byteData.fCompressedBytesRead;
+      filesByteData.emplace_back(
+         ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx], {-1, -1}, d.fMeasureStages));
 
       if (d.fTreeNames.size() > 1)
          ++treeIdx;
@@ -193,7 +326,10 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
       sw.Stop();
    }
 
-   return {sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0};
+   const auto byteData = SumBytes(filesByteData);
+   return WithStageTimes(
+      {sw.RealTime(), sw.CpuTime(), 0., 0., byteData.fUncompressedBytesRead, byteData.fCompressedBytesRead, 0},
+      byteData, d.fMeasureStages);
 }
 
 // Return a vector of EntryRanges per file, i.e. a vector of vectors of EntryRanges with outer size equal to
@@ -314,7 +450,7 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
          if (file == nullptr || file->IsZombie())
             throw std::runtime_error("Could not open file '" + fileName + '\'');
 
-         auto result = ReadTree(file.get(), treeName, branchNames, range);
+         auto result = ReadTree(file.get(), treeName, branchNames, range, d.fMeasureStages);
 
          return result;
       };
@@ -329,13 +465,9 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
    const auto totalByteData = pool.MapReduce(processFile, ROOT::TSeqUL(d.fFileNames.size()), SumBytes);
    sw.Stop();
 
-   return {sw.RealTime(),
-           sw.CpuTime(),
-           clsw.RealTime(),
-           clsw.CpuTime(),
-           totalByteData.fUncompressedBytesRead,
-           totalByteData.fCompressedBytesRead,
-           actualThreads};
+   return WithStageTimes({sw.RealTime(), sw.CpuTime(), clsw.RealTime(), clsw.CpuTime(),
+                          totalByteData.fUncompressedBytesRead, totalByteData.fCompressedBytesRead, actualThreads},
+                         totalByteData, d.fMeasureStages);
 #else
    (void)d;
    (void)nThreads;
@@ -343,6 +475,171 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
 #endif // R__USE_IMT
 }
 
+ByteData ReadSpeed::ReadNTuple(const std::string &fileName, const std::string &ntupleName,
+                               const std::vector<std::string> &fieldNames, const Data &d)
+{
+#ifdef R__HAS_ROOT7
+   using ROOT::Experimental::RNTupleModel;
+   using ROOT::Experimental::RNTupleReader;
+   using ROOT::Experimental::RNTupleReadOptions;
+
+   // A model with only the requested fields, with the types found on storage
+   auto model = RNTupleModel::Create();
+   {
+      auto reader = RNTupleReader::Open(ntupleName, fileName);
+      const auto *descriptor = reader->GetDescriptor();
+      for (const auto &fieldName : fieldNames) {
+         const auto fieldId = descriptor->FindFieldId(fieldName);
+         if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+            throw std::runtime_error("Could not retrieve field '" + fieldName + "' from RNTuple '" + ntupleName +
+                                     "' in file '" + fileName + '\'');
+         const auto typeName = descriptor->GetFieldDescriptor(fieldId).GetTypeName();
+         model->AddField(ROOT::Experimental::Detail::RFieldBase::Create(fieldName, typeName).Unwrap());
+      }
+   }
+
+   RNTupleReadOptions options;
+   if (d.fClusterBunchSize > 0)
+      options.SetClusterBunchSize(d.fClusterBunchSize);
+   // Without implicit multi-threading the pages are decompressed in the reading thread, so that the deserialization
+   // time is what is left of the entry loop
+   auto reader = RNTupleReader::Open(std::move(model), ntupleName, fileName, options);
+   reader->EnableMetrics();
+
+   const auto start = std::chrono::steady_clock::now();
+   for (auto i : reader->GetEntryRange())
+      reader->LoadEntry(i);
+   const auto loopTime = SecondsSince(start);
+
+   auto counter = [&reader](const std::string &name) -> std::int64_t {
+      const auto *c = reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile." + name);
+      return c ? c->GetValueAsInt() : 0;
+   };
+   ByteData data{static_cast<ULong64_t>(counter("szUnzip")),
+                 static_cast<ULong64_t>(counter("szReadPayload") + counter("szReadOverhead"))};
+   if (d.fMeasureStages) {
+      data.fFetchTime = counter("timeWallRead") * 1e-9;
+      data.fDecompressTime = counter("timeWallUnzip") * 1e-9;
+      data.fDeserializeTime = std::max(loopTime - data.fDecompressTime, 0.);
+   }
+   return data;
+#else
+   (void)fileName;
+   (void)ntupleName;
+   (void)fieldNames;
+   (void)d;
+   throw std::runtime_error("ROOT was built without RNTuple support (root7=OFF).");
+#endif
+}
+
+EDataFormat ReadSpeed::GetDataFormat(const Data &d)
+{
+#ifdef R__HAS_ROOT7
+   const auto &fileName = d.fFileNames[0];
+   std::unique_ptr<TFile> f(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (f == nullptr || f->IsZombie())
+      throw std::runtime_error("Could not open file '" + fileName + '\'');
+   // Only the key is looked at if the object is not an RNTuple
+   std::unique_ptr<ROOT::Experimental::RNTuple> ntuple(f->Get<ROOT::Experimental::RNTuple>(d.fTreeNames[0].c_str()));
+   if (ntuple)
+      return EDataFormat::kRNTuple;
+#else
+   (void)d;
+#endif
+   return EDataFormat::kTTree;
+}
+
+Data ReadSpeed::RecompressData(const Data &d, int compression, const std::string &dir)
+{
+   const auto format = GetDataFormat(d);
+   Data copy = d;
+   copy.fFileNames.clear();
+   copy.fTreeNames.clear();
+   for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx) {
+      const auto &fileName = d.fFileNames[fileIdx];
+      const auto &treeName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+      const auto copyName = dir + "/readspeed_" + std::to_string(compression) + '_' + std::to_string(fileIdx) + '_' +
+                            gSystem->BaseName(fileName.c_str());
+
+      if (format == EDataFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+         using namespace ROOT::Experimental;
+         auto reader = RNTupleReader::Open(treeName, fileName);
+         RNTupleWriteOptions options;
+         options.SetCompression(compression);
+         auto writer = RNTupleWriter::Recreate(reader->GetModel()->Clone(), treeName, copyName, options);
+         // Write the values of the reader entry
+         auto *readEntry = reader->GetModel()->GetDefaultEntry();
+         auto *writeEntry = writer->GetModel()->GetDefaultEntry();
+         for (const auto &value : *readEntry)
+            writeEntry->CaptureValueUnsafe(value.GetField()->GetName(), value.GetRawPtr());
+         for (auto i : reader->GetEntryRange()) {
+            reader->LoadEntry(i);
+            writer->Fill();
+         }
+#endif
+         copy.fTreeNames.emplace_back(treeName);
+      } else {
+         std::unique_ptr<TFile> f(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+         if (f == nullptr || f->IsZombie())
+            throw std::runtime_error("Could not open file '" + fileName + '\'');
+         auto *t = f->Get<TTree>(treeName.c_str());
+         if (t == nullptr)
+            throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+         std::unique_ptr<TFile> out(TFile::Open(copyName.c_str(), "RECREATE", "", compression));
+         if (out == nullptr || out->IsZombie())
+            throw std::runtime_error("Could not create file '" + copyName + '\'');
+         // Not a fast clone, so that the baskets are compressed again
+         t->SetBranchStatus("*", 1);
+         auto *clone = t->CloneTree(-1);
+         clone->Write();
+         copy.fTreeNames.emplace_back(clone->GetName());
+      }
+      copy.fFileNames.emplace_back(copyName);
+   }
+   if (d.fTreeNames.size() == 1)
+      copy.fTreeNames.resize(1);
+   return copy;
+}
+
+Result ReadSpeed::EvalThroughputRNTuple(const Data &d, unsigned nThreads)
+{
+   const auto fileFieldNames = GetPerFileBranchNames(d, EDataFormat::kRNTuple);
+   auto readFile = [&](std::size_t fileIdx) {
+      const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+      return ReadNTuple(d.fFileNames[fileIdx], ntupleName, fileFieldNames[fileIdx], d);
+   };
+
+   TStopwatch sw;
+   ByteData byteData{0ull, 0ull};
+   unsigned int poolSize = 0;
+#ifdef R__USE_IMT
+   if (nThreads > 0) {
+      ROOT::TThreadExecutor pool(nThreads);
+      poolSize = ROOT::GetThreadPoolSize();
+      sw.Start();
+      byteData = pool.MapReduce(readFile, ROOT::TSeqUL(d.fFileNames.size()), SumBytes);
+      sw.Stop();
+   } else
+#else
+   (void)nThreads;
+#endif
+   {
+      std::vector<ByteData> filesByteData;
+      sw.Start();
+      for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx)
+         filesByteData.emplace_back(readFile(fileIdx));
+      sw.Stop();
+      byteData = SumBytes(filesByteData);
+   }
+
+   auto result = WithStageTimes({sw.RealTime(), sw.CpuTime(), 0., 0., byteData.fUncompressedBytesRead,
+                                 byteData.fCompressedBytesRead, poolSize},
+                                byteData, d.fMeasureStages);
+   result.fFormat = EDataFormat::kRNTuple;
+   return result;
+}
+
 Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
 {
    if (d.fTreeNames.empty()) {
@@ -362,6 +659,17 @@ Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
       std::terminate();
    }
 
+   if (GetDataFormat(d) == EDataFormat::kRNTuple) {
+#ifndef R__USE_IMT
+      if (nThreads > 0) {
+         std::cerr << nThreads
+                   << " threads were requested, but ROOT was built without implicit multi-threading (IMT) support.\n";
+         std::terminate();
+      }
+#endif
+      return EvalThroughputRNTuple(d, nThreads);
+   }
+
 #ifdef R__USE_IMT
    return nThreads > 0 ? EvalThroughputMT(d, nThreads) : EvalThroughputST(d);
 #else
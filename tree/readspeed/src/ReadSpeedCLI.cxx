@@ -14,6 +14,8 @@
 #include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::SetTasksPerWorkerHint
 #endif
 
+#include <TSystem.h>
+
 #include <iostream>
 #include <cstring>
 
@@ -26,6 +28,11 @@ const auto usageText = "Usage:\n"
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--stages]\n"
+                       "               [--compression setting1 [setting2 ...]]\n"
+                       "               [--cluster-bunch-sizes nclusters1 [nclusters2 ...]]\n"
+                       "               [--scratch-dir dir]\n"
+                       "               [--json fname]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -39,7 +46,8 @@ const auto argUsageText =
    "   --trees tname1 [tname2...]\n"
    "    The list of trees to read from the files. If only one tree is provided then it will\n"
    "    be used for all files. If multiple trees are specified, each tree is read from the\n"
-   "    respective file.\n"
+   "    respective file. RNTuples are read in the same way, passing their names instead; the\n"
+   "    branches are then the top-level fields.\n"
    "\n"
    "\n"
    " Specifying branches:\n"
@@ -62,7 +70,30 @@ const auto argUsageText =
    "    available threads on the machine.\n"
    "\n"
    "   --tasks-per-worker ntasks\n"
-   "    The number of tasks to generate for each worker thread when using multithreading.\n";
+   "    The number of tasks to generate for each worker thread when using multithreading.\n"
+   "\n"
+   "\n"
+   " Benchmark arguments:\n"
+   "   --stages\n"
+   "    Measure separately the time spent fetching the compressed data from storage, decompressing\n"
+   "    it and deserializing it. For TTrees, the baskets are then fetched with plain reads and\n"
+   "    decompressed before being deserialized, which adds some overhead to the total time.\n"
+   "\n"
+   "   --compression setting1 [setting2 ...]\n"
+   "    Rewrite the data with each of the compression settings (algorithm * 100 + level, e.g. 505\n"
+   "    for ZSTD level 5, 404 for LZ4 level 4, 0 for no compression) and run the benchmark on\n"
+   "    each copy.\n"
+   "\n"
+   "   --cluster-bunch-sizes nclusters1 [nclusters2 ...]\n"
+   "    Run the benchmark once per number of clusters that are read at once from RNTuples.\n"
+   "    Combined with --compression, all the combinations are run.\n"
+   "\n"
+   "   --scratch-dir dir\n"
+   "    The directory where the recompressed copies of the data are written and removed again\n"
+   "    after their run. Defaults to the temporary directory of the system.\n"
+   "\n"
+   "   --json fname\n"
+   "    Write the results of all the runs to the given file in JSON format.\n";
 
 const auto fullUsageText =
    "Description:\n"
@@ -149,6 +180,7 @@ const auto fullUsageText =
 
 void ReadSpeed::PrintThroughput(const Result &r)
 {
+   std::cout << "Data format:\t\t\t" << (r.fFormat == EDataFormat::kRNTuple ? "RNTuple" : "TTree") << '\n';
    std::cout << "Thread pool size:\t\t" << r.fThreadPoolSize << '\n';
 
    if (r.fMTSetupRealTime > 0.) {
@@ -159,6 +191,12 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "Real time:\t\t\t" << r.fRealTime << " s\n";
    std::cout << "CPU time:\t\t\t" << r.fCpuTime << " s\n";
 
+   if (r.fFetchTime >= 0.) {
+      std::cout << "Fetch time:\t\t\t" << r.fFetchTime << " s (summed over threads)\n";
+      std::cout << "Decompression time:\t\t" << r.fDecompressTime << " s (summed over threads)\n";
+      std::cout << "Deserialization time:\t\t" << r.fDeserializeTime << " s (summed over threads)\n";
+   }
+
    std::cout << "Uncompressed data read:\t\t" << r.fUncompressedBytesRead << " bytes\n";
    std::cout << "Compressed data read:\t\t" << r.fCompressedBytesRead << " bytes\n";
 
@@ -205,8 +243,23 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   std::vector<int> compressionSettings;
+   std::vector<unsigned int> clusterBunchSizes;
+   std::string jsonFile;
+   std::string scratchDir = gSystem->TempDirectory();
 
-   enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
+   enum class EArgState {
+      kNone,
+      kTrees,
+      kFiles,
+      kBranches,
+      kThreads,
+      kTasksPerWorkerHint,
+      kCompression,
+      kClusterBunchSizes,
+      kScratchDir,
+      kJSONFile
+   } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
    const auto branchOptionsErrMsg =
       "Options --all-branches, --branches, and --branches-regex are mutually exclusive. You can use only one.\n";
@@ -246,6 +299,17 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--stages") {
+         argState = EArgState::kNone;
+         d.fMeasureStages = true;
+      } else if (arg == "--compression") {
+         argState = EArgState::kCompression;
+      } else if (arg == "--cluster-bunch-sizes") {
+         argState = EArgState::kClusterBunchSizes;
+      } else if (arg == "--scratch-dir") {
+         argState = EArgState::kScratchDir;
+      } else if (arg == "--json") {
+         argState = EArgState::kJSONFile;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -267,12 +331,27 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
                          "will be ignored.\n";
 #endif
             break;
+         case EArgState::kCompression: compressionSettings.emplace_back(std::stoi(arg)); break;
+         case EArgState::kClusterBunchSizes: clusterBunchSizes.emplace_back(std::stoul(arg)); break;
+         case EArgState::kScratchDir:
+            scratchDir = arg;
+            argState = EArgState::kNone;
+            break;
+         case EArgState::kJSONFile:
+            jsonFile = arg;
+            argState = EArgState::kNone;
+            break;
          default: std::cerr << "Unrecognized option '" << arg << "'\n"; return {};
          }
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   Args parsed{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   parsed.fCompressionSettings = std::move(compressionSettings);
+   parsed.fClusterBunchSizes = std::move(clusterBunchSizes);
+   parsed.fJSONFile = std::move(jsonFile);
+   parsed.fScratchDir = std::move(scratchDir);
+   return parsed;
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
@@ -286,3 +365,89 @@ Args ReadSpeed::ParseArgs(int argc, char **argv)
 
    return ParseArgs(args);
 }
+
+std::vector<BenchmarkRun> ReadSpeed::RunBenchmarks(const Args &args)
+{
+   const auto compressions = args.fCompressionSettings.empty() ? std::vector<int>{-1} : args.fCompressionSettings;
+   const bool isRNTuple = GetDataFormat(args.fData) == EDataFormat::kRNTuple;
+   if (!isRNTuple && !args.fClusterBunchSizes.empty())
+      std::cerr << "Cluster bunch sizes only apply to RNTuples, the --cluster-bunch-sizes option will be ignored.\n";
+   const auto bunchSizes = (!isRNTuple || args.fClusterBunchSizes.empty()) ? std::vector<unsigned int>{0u}
+                                                                            : args.fClusterBunchSizes;
+   const auto nRuns = compressions.size() * bunchSizes.size();
+
+   std::vector<BenchmarkRun> runs;
+   for (auto compression : compressions) {
+      auto d = compression < 0 ? args.fData : RecompressData(args.fData, compression, args.fScratchDir);
+      auto removeCopies = [&] {
+         if (compression >= 0)
+            for (const auto &fileName : d.fFileNames)
+               gSystem->Unlink(fileName.c_str());
+      };
+      try {
+         for (auto bunchSize : bunchSizes) {
+            d.fClusterBunchSize = bunchSize;
+            if (nRuns > 1) {
+               std::cout << "--- Compression setting: ";
+               if (compression < 0)
+                  std::cout << "original";
+               else
+                  std::cout << compression;
+               if (isRNTuple)
+                  std::cout << ", cluster bunch size: " << bunchSize;
+               std::cout << " ---\n";
+            }
+            runs.push_back({compression, bunchSize, EvalThroughput(d, args.fNThreads)});
+            PrintThroughput(runs.back().fResult);
+            if (nRuns > 1)
+               std::cout << '\n';
+         }
+      } catch (...) {
+         removeCopies();
+         throw;
+      }
+      removeCopies();
+   }
+   return runs;
+}
+
+void ReadSpeed::WriteJSON(const std::vector<BenchmarkRun> &runs, std::ostream &os)
+{
+   // Stage times that were not measured are written as null
+   auto writeTime = [&os](const char *key, double time) {
+      os << "      \"" << key << "\": ";
+      if (time >= 0.)
+         os << time;
+      else
+         os << "null";
+      os << ",\n";
+   };
+
+   os << "{\n  \"runs\": [";
+   for (auto i = 0u; i < runs.size(); ++i) {
+      const auto &r = runs[i].fResult;
+      os << (i > 0 ? ",\n" : "\n") << "    {\n";
+      os << "      \"format\": \"" << (r.fFormat == EDataFormat::kRNTuple ? "RNTuple" : "TTree") << "\",\n";
+      os << "      \"compression\": ";
+      if (runs[i].fCompression < 0)
+         os << "null";
+      else
+         os << runs[i].fCompression;
+      os << ",\n";
+      os << "      \"clusterBunchSize\": " << runs[i].fClusterBunchSize << ",\n";
+      os << "      \"threadPoolSize\": " << r.fThreadPoolSize << ",\n";
+      os << "      \"realTime\": " << r.fRealTime << ",\n";
+      os << "      \"cpuTime\": " << r.fCpuTime << ",\n";
+      os << "      \"mtSetupRealTime\": " << r.fMTSetupRealTime << ",\n";
+      os << "      \"mtSetupCpuTime\": " << r.fMTSetupCpuTime << ",\n";
+      writeTime("fetchTime", r.fFetchTime);
+      writeTime("decompressTime", r.fDecompressTime);
+      writeTime("deserializeTime", r.fDeserializeTime);
+      os << "      \"uncompressedBytes\": " << r.fUncompressedBytesRead << ",\n";
+      os << "      \"compressedBytes\": " << r.fCompressedBytesRead << ",\n";
+      os << "      \"uncompressedThroughput\": " << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 << ",\n";
+      os << "      \"compressedThroughput\": " << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 << "\n";
+      os << "    }";
+   }
+   os << (runs.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
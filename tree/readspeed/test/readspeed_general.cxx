@@ -13,10 +13,18 @@
 #include "ROOT/TTreeProcessorMT.hxx" // for TTreeProcessorMT::GetTasksPerWorkerHint
 #endif
 
+#include "RConfigure.h" // for R__HAS_ROOT7
 #include "TFile.h"
 #include "TSystem.h"
 #include "TTree.h"
 
+#ifdef R__HAS_ROOT7
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTuple.hxx>
+#endif
+
+#include <sstream>
+
 using namespace ReadSpeed;
 
 // Helper function to generate a .root file with some dummy data in it.
@@ -139,6 +147,111 @@ TEST_F(ReadSpeedIntegration, AllBranches)
    EXPECT_EQ(result.fCompressedBytesRead, 1316837) << "Wrong number of compressed bytes read";
 }
 
+TEST_F(ReadSpeedIntegration, Stages)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fMeasureStages = true;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 80000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GE(result.fFetchTime, 0.) << "Fetch time not measured";
+   EXPECT_GE(result.fDecompressTime, 0.) << "Decompression time not measured";
+   EXPECT_GE(result.fDeserializeTime, 0.) << "Deserialization time not measured";
+
+   const auto noStages = EvalThroughput({{"t"}, {"readspeedinput1.root"}, {"x"}}, 0);
+   EXPECT_LT(noStages.fFetchTime, 0.) << "Stage times measured when they should not";
+}
+
+TEST_F(ReadSpeedIntegration, Recompression)
+{
+   Args args;
+   args.fData = {{"t"}, {"readspeedinput1.root"}, {"x"}};
+   args.fCompressionSettings = {0, 101};
+   args.fScratchDir = ".";
+   const auto runs = RunBenchmarks(args);
+
+   ASSERT_EQ(runs.size(), 2u) << "Wrong number of benchmark runs";
+   EXPECT_EQ(runs[0].fCompression, 0);
+   EXPECT_EQ(runs[1].fCompression, 101);
+   for (const auto &run : runs)
+      EXPECT_EQ(run.fResult.fUncompressedBytesRead, 40000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GE(runs[0].fResult.fCompressedBytesRead, 40000000) << "Uncompressed copy smaller than its data";
+   EXPECT_LT(runs[1].fResult.fCompressedBytesRead, 40000000) << "Compressed copy not smaller than its data";
+   EXPECT_TRUE(gSystem->AccessPathName("./readspeed_0_0_readspeedinput1.root")) << "Copy of the data not removed";
+
+   std::stringstream json;
+   WriteJSON(runs, json);
+   EXPECT_NE(json.str().find("\"compression\": 101,"), std::string::npos) << "Run missing from JSON output";
+   EXPECT_NE(json.str().find("\"fetchTime\": null,"), std::string::npos) << "Unmeasured stage not null in JSON";
+}
+
+#ifdef R__HAS_ROOT7
+TEST(ReadSpeedRNTuple, ReadFields)
+{
+   const auto fileName = "readspeedntuple.root";
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      auto x = model->MakeField<int>("x");
+      auto y = model->MakeField<float>("y");
+      auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "ntpl", fileName);
+      for (int i = 0; i < 100000; ++i) {
+         *x = i;
+         *y = 0.5f * i;
+         writer->Fill();
+      }
+   }
+
+   Data d{{"ntpl"}, {fileName}, {"x"}};
+   d.fMeasureStages = true;
+   d.fClusterBunchSize = 2;
+   EXPECT_EQ(GetDataFormat(d), EDataFormat::kRNTuple);
+   const auto result = EvalThroughput(d, 0);
+   EXPECT_EQ(result.fFormat, EDataFormat::kRNTuple);
+   EXPECT_EQ(result.fUncompressedBytesRead, 400000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GT(result.fCompressedBytesRead, 0) << "No compressed bytes read";
+   EXPECT_GE(result.fDecompressTime, 0.) << "Decompression time not measured";
+
+   const auto all = EvalThroughput({{"ntpl"}, {fileName}, {".*"}, true}, 0);
+   EXPECT_EQ(all.fUncompressedBytesRead, 800000) << "Wrong number of uncompressed bytes read";
+   EXPECT_THROW(EvalThroughput({{"ntpl"}, {fileName}, {"z"}}, 0), std::runtime_error)
+      << "Should throw for non-existent field";
+
+   gSystem->Unlink(fileName);
+}
+#endif
+
+TEST(ReadSpeedCLI, BenchmarkArgs)
+{
+   const std::vector<std::string> allArgs{"root-readspeed",
+                                          "--files",
+                                          "doesnotexist.root",
+                                          "--trees",
+                                          "t",
+                                          "--branches",
+                                          "x",
+                                          "--stages",
+                                          "--compression",
+                                          "0",
+                                          "505",
+                                          "--cluster-bunch-sizes",
+                                          "1",
+                                          "4",
+                                          "--json",
+                                          "result.json",
+                                          "--scratch-dir",
+                                          "/scratch"};
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_TRUE(parsedArgs.fData.fMeasureStages) << "Stages not measured when they should";
+   EXPECT_EQ(parsedArgs.fCompressionSettings, std::vector<int>({0, 505})) << "Wrong compression settings";
+   EXPECT_EQ(parsedArgs.fClusterBunchSizes, std::vector<unsigned int>({1, 4})) << "Wrong cluster bunch sizes";
+   EXPECT_EQ(parsedArgs.fJSONFile, "result.json") << "Wrong JSON file";
+   EXPECT_EQ(parsedArgs.fScratchDir, "/scratch") << "Wrong scratch directory";
+   EXPECT_EQ(parsedArgs.fData.fBranchNames, std::vector<std::string>({"x"})) << "Wrong branches";
+}
+
 TEST(ReadSpeedCLI, CheckFilenames)
 {
    const std::vector<std::string> baseArgs{"root-readspeed", "--trees", "t", "--branches", "x", "--files"};
@@ -19,6 +19,7 @@
 #define ROOT_INTERNAL_TREEUTILS_H
 
 #include "TChain.h"
+#include "TDataType.h" // EDataType
 #include "TNotifyLink.h"
 #include "TObjArray.h"
 #include "ROOT/RFriendInfo.hxx"
@@ -78,6 +79,30 @@ public:
 
 std::unique_ptr<TChain> MakeChainForMT(const std::string &name = "", const std::string &title = "");
 
+/// Layout of the values of a branch that can be read with ReadBranchBulk() or ReadBranchBulkVarLength()
+struct RBulkBranchInfo {
+   EDataType fType = kOther_t; ///< type of the values, kOther_t if the branch cannot be read in bulk
+   Int_t fLen = 1;             ///< number of values of each entry for fixed-size arrays
+   bool fVarLength = false;    ///< entries are variable-length arrays, read with ReadBranchBulkVarLength()
+};
+
+RBulkBranchInfo GetBulkBranchInfo(TTree &tree, const std::string &branchName);
+bool ReadBranchBulk(TTree &tree, const std::string &branchName, Long64_t start, Long64_t stop, void *values);
+template <typename T>
+bool ReadBranchBulkVarLength(TTree &tree, const std::string &branchName, Long64_t start, Long64_t stop,
+                             std::vector<T> &values, std::vector<Long64_t> &offsets);
+
+/// Number of entries and cluster boundaries of a tree, as read from the header of its file by GetTreeHeaderInfos()
+struct RTreeHeaderInfo {
+   bool fFileOk = false;                 ///< the file could be opened
+   bool fTreeOk = false;                 ///< the file contains the tree
+   Long64_t fEntries = 0;                ///< number of entries of the tree
+   std::vector<Long64_t> fClusterStarts; ///< first entry of each cluster of the tree
+};
+
+std::vector<RTreeHeaderInfo>
+GetTreeHeaderInfos(const std::vector<std::string> &treeNames, const std::vector<std::string> &fileNames);
+
 } // namespace TreeUtils
 } // namespace Internal
 } // namespace ROOT
@@ -73,7 +73,10 @@ public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   Int_t GetBulkEntriesVarLength(Long64_t evt, TBuffer &user_buf, TBuffer &offset_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsBulkReadVarLength() const;
+   EDataType GetVarLengthType();
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -174,12 +177,18 @@ protected:
 
    virtual void SetAddressImpl(void *addr, Bool_t /* implied */) { SetAddress(addr); }
 
+   virtual EDataType GetBulkVarLengthType();
+   /// Skips the per-entry header of variable-length entries read in bulk; returns the number of elements announced by
+   /// the header or -1 if the entries have no header, in which case the size follows from the entry's byte count.
+   virtual Int_t     ReadBulkVarLengthHeader(TBuffer &) { return -1; }
+
 private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   Int_t    GetBulkEntriesVarLength(Long64_t, TBuffer&, TBuffer&);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
    TBranch(const TBranch&) = delete;             // not implemented
@@ -283,6 +292,7 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree; }
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkReadVarLength() const;
    virtual void      UpdateAddress() {}
    virtual void      UpdateFile();
 
@@ -316,7 +326,10 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntriesVarLength(Long64_t evt, TBuffer& user_buf, TBuffer& offset_buf) { return fParent.GetBulkEntriesVarLength(evt, user_buf, offset_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkReadVarLength() const { return fParent.SupportsBulkReadVarLength(); }
+inline EDataType TBulkBranchRead::GetVarLengthType() { return fParent.GetBulkVarLengthType(); }
 
 }  // Internal
 }  // Experimental
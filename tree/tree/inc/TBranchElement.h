@@ -146,6 +146,8 @@ protected:
    void SetReadActionSequence();
    void SetupAddressesImpl();
    void SetAddressImpl(void *addr, Bool_t implied) override;
+   EDataType GetBulkVarLengthType() override;
+   Int_t ReadBulkVarLengthHeader(TBuffer &b) override;
 
    void FillLeavesImpl(TBuffer& b);
    void FillLeavesMakeClass(TBuffer& b);
@@ -30,6 +30,12 @@ class TEntryList;
 class TEventList;
 class TCollection;
 
+namespace ROOT {
+namespace Internal {
+struct TChainNextFile;
+}
+}
+
 class TChain : public TTree {
 
 protected:
@@ -44,10 +50,15 @@ protected:
    TList       *fStatus;           ///< -> List of active/inactive branches (TChainElement, owned)
    TChain      *fProofChain;       ///<! chain proxy when going to be processed by PROOF
    bool         fGlobalRegistration;  ///<! if true, bypass use of global lists
+   Bool_t       fPrefetchNextFile{kFALSE};  ///<! If true, the next file is opened ahead of time, see SetPrefetchNextFile()
+   Long64_t     fPrefetchEntry{-1};         ///<! Chain entry from which on the next file is opened ahead of time
+   ROOT::Internal::TChainNextFile *fNextFile{nullptr}; ///<! The next file, opened in the background
 
 private:
    TChain(const TChain&);            // not implemented
    TChain& operator=(const TChain&); // not implemented
+   void PrefetchNextFile();
+   void ReadTreeHeaders();
    void ParseTreeFilename(const char *name, TString &filename, TString &treename, TString &query, TString &suffix, Bool_t wildcards) const;
 
 protected:
@@ -96,6 +107,7 @@ public:
    virtual Long64_t  GetChainEntryNumber(Long64_t entry) const;
    virtual TClusterIterator GetClusterIterator(Long64_t firstentry);
            Int_t     GetNtrees() const { return fNtrees; }
+           Bool_t    GetPrefetchNextFile() const { return fPrefetchNextFile; }
    virtual Long64_t  GetEntries() const;
    virtual Long64_t  GetEntries(const char *sel) { return TTree::GetEntries(sel); }
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall=0);
@@ -165,6 +177,7 @@ public:
    virtual void      SetMakeClass(Int_t make) { TTree::SetMakeClass(make); if (fTree) fTree->SetMakeClass(make);}
    virtual void      SetName(const char *name);
    virtual void      SetPacketSize(Int_t size = 100);
+           void      SetPrefetchNextFile(Bool_t on = kTRUE);
    virtual void      SetProof(Bool_t on = kTRUE, Bool_t refresh = kFALSE, Bool_t gettreeheader = kFALSE);
    virtual void      SetWeight(Double_t w=1, Option_t *option="");
    virtual void      UseCache(Int_t maxCacheSize = 10, Int_t pageSize = 0);
@@ -76,6 +76,8 @@ class TEntryList: public TNamed
    virtual TList      *GetLists() const { return fLists; }
    virtual TDirectory *GetDirectory() const { return fDirectory; }
    virtual Long64_t    GetN() const { return fN; }
+   Long64_t            GetNBefore(Long64_t entry) const;
+   void                GetNBefore(Long64_t n, const Long64_t *entries, Long64_t *nbefore) const;
    virtual const char *GetTreeName() const { return fTreeName.Data(); }
    virtual const char *GetFileName() const { return fFileName.Data(); }
    virtual Int_t       GetTreeNumber() const { return fTreeNumber; }
@@ -87,6 +89,7 @@ class TEntryList: public TNamed
       return kFALSE;
    }
 
+   virtual void        Intersect(const TEntryList *elist);
    virtual Int_t       Merge(TCollection *list);
 
    virtual Long64_t    Next();
@@ -29,6 +29,8 @@
 // - Merge() - adds all entries from one block to the other. If the first block
 //             uses array representation, it's changed to bits representation only
 //             if the total number of passing entries is still less than kBlockSize
+// - Intersect() - keeps only the entries that are also in the other block
+// - Subtract()  - removes all entries of the other block
 // - GetEntry(n) - returns n-th non-zero entry.
 // - Next()      - return next non-zero entry. In case of representation 1), Next()
 //                 is faster than GetEntry()
@@ -55,6 +57,8 @@ class TEntryListBlock:public TObject
    Int_t    fLastIndexReturned; ///<! to optimize GetEntry() in a loop
 
    void Transform(Bool_t dir, UShort_t *indexnew);
+   void GetBits(UShort_t *bits) const;
+   void SetBits(const UShort_t *bits);
 
  public:
 
@@ -69,11 +73,14 @@ class TEntryListBlock:public TObject
    Int_t   Contains(Int_t entry);
    void    OptimizeStorage();
    Int_t   Merge(TEntryListBlock *block);
+   Int_t   Intersect(TEntryListBlock *block);
+   Int_t   Subtract(TEntryListBlock *block);
    Int_t   Next();
    Int_t   GetEntry(Int_t entry);
    void    ResetIndices() {fLastIndexQueried = -1, fLastIndexReturned = -1;}
    Int_t   GetType() { return fType; }
    Int_t   GetNPassed();
+   Int_t   GetNPassedBefore(Int_t entry) const;
    virtual void Print(const Option_t *option = "") const;
    void    PrintWithShift(Int_t shift) const;
 
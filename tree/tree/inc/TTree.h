@@ -140,6 +140,12 @@ protected:
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
+   Int_t fCompressionChunkSize{0};        ///<! Size of the independently compressed chunks of a basket, 0 for the default kMAXZIPBUF
+   Int_t fReadThreads{0};                 ///<! Number of threads expected to read the tree, 0 if no read targets are set
+   Bool_t fReadRemote{kFALSE};            ///<! True if the tree is expected to be read from remote storage
+   TString fReadBranches;                 ///<! Comma separated list of the branches expected to be read
+   Long64_t fReadExpectedEntries{0};      ///<! Expected number of entries of the tree, 0 if unknown
+   Long64_t fReadClusterBytes{-1};        ///<! Compressed bytes of the read branches per cluster, -1 until the targets are applied
    Float_t fTargetMemoryRatio{1.1f};      ///<! Ratio for memory usage in uncompressed buffers versus actual occupancy.  1.0
                                            /// indicates basket should be resized to exact memory usage, but causes significant
 /// memory churn.
@@ -161,6 +167,7 @@ private:
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
+   void             ApplyReadTargets();
    Long64_t         GetMedianClusterSize();
 
 protected:
@@ -451,6 +458,7 @@ public:
    virtual Long64_t        GetChainEntryNumber(Long64_t entry) const { return entry; }
    virtual Long64_t        GetChainOffset() const { return fChainOffset; }
    virtual Bool_t          GetClusterPrefetch() const { return fCacheDoClusterPrefetch; }
+           Int_t           GetCompressionChunkSize() const { return fCompressionChunkSize; }
            TFile          *GetCurrentFile() const;
            Int_t           GetDefaultEntryOffsetLen() const {return fDefaultEntryOffsetLen;}
            Long64_t        GetDebugMax()  const { return fDebugMax; }
@@ -605,6 +613,7 @@ public:
    virtual void            SetChainOffset(Long64_t offset = 0) { fChainOffset=offset; }
    virtual void            SetCircular(Long64_t maxEntries);
    virtual void            SetClusterPrefetch(Bool_t enabled) { fCacheDoClusterPrefetch = enabled; }
+           void            SetCompressionChunkSize(Int_t size);
    virtual void            SetDebug(Int_t level = 1, Long64_t min = 0, Long64_t max = 9999999); // *MENU*
    virtual void            SetDefaultEntryOffsetLen(Int_t newdefault, Bool_t updateExisting = kFALSE);
    virtual void            SetDirectory(TDirectory* dir);
@@ -636,6 +645,8 @@ public:
    virtual void            SetObject(const char* name, const char* title);
    virtual void            SetParallelUnzip(Bool_t opt=kTRUE, Float_t RelSize=-1);
    virtual void            SetPerfStats(TVirtualPerfStats* perf);
+           void            SetReadTargets(Int_t nThreads, const char *branches = "*", Bool_t remote = kFALSE,
+                                          Long64_t expectedEntries = 0);
    virtual void            SetScanField(Int_t n = 50) { fScanField = n; } // *MENU*
    void SetTargetMemoryRatio(Float_t ratio) { fTargetMemoryRatio = ratio; }
    virtual void            SetTimerInterval(Int_t msec = 333) { fTimerInterval=msec; }
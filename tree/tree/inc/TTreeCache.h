@@ -67,6 +67,9 @@ protected:
 
    Bool_t       fLearnPrefilling{kFALSE}; ///<! true if we are in the process of executing LearnPrefill
 
+   TString      fTrainingFile;            ///<! file to which the result of the learning phase is saved, if any
+   Bool_t       fTrainingLoaded{kFALSE};  ///<! true if the set of branches was loaded by LoadTraining()
+
    // These members hold cached data for missed branches when miss optimization
    // is enabled.  Pointers are only initialized if the miss cache is enabled.
    Bool_t   fOptimizeMisses{kFALSE}; ///<! true if we should optimize cache misses.
@@ -136,6 +139,7 @@ public:
    virtual void         Disable() {fEnabled = kFALSE;}
    virtual void         Enable() {fEnabled = kTRUE;}
    Bool_t               GetOptimizeMisses() const { return fOptimizeMisses; }
+   const char          *GetTrainingFile() const { return fTrainingFile.Data(); }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
    EPrefillType         GetConfiguredPrefillType() const;
    Double_t             GetEfficiency() const;
@@ -154,9 +158,11 @@ public:
    virtual Bool_t       FillBuffer();
    Int_t                LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE) override;
    virtual void         LearnPrefill();
+   Int_t                LoadTraining(const char *filename, const char *key = "");
 
    void                 Print(Option_t *option="") const override;
    Int_t                ReadBuffer(char *buf, Long64_t pos, Int_t len) override;
+   Int_t                SaveTraining(const char *filename, const char *key = "") const;
    virtual Int_t        ReadBufferNormal(char *buf, Long64_t pos, Int_t len);
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
@@ -168,6 +174,7 @@ public:
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(Bool_t opt);
+   void                 SetTrainingFile(const char *filename) { fTrainingFile = filename; }
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
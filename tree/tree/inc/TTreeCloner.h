@@ -22,6 +22,7 @@
 
 #include "TObjArray.h"
 
+class TBasket;
 class TBranch;
 class TTree;
 class TFile;
@@ -87,6 +88,10 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   void LoadBasket(UInt_t j, TBasket *basket, UInt_t &notCached);
+   void StoreBasket(UInt_t j, TBasket *basket);
+   void CopyUnwrittenBasket(UInt_t j);
+   void WriteBasketsConcurrently();
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -52,6 +52,9 @@ protected:
    TSQLServer            *fServer;
    Bool_t                 fBranchChecked;
    TSQLTableInfo         *fTableInfo;
+   Int_t                  fInsertBatchSize;  ///<! Number of rows inserted by a single INSERT statement
+   Int_t                  fNPendingInserts;  ///<! Number of filled rows not yet sent to the database
+   TString                fPendingInserts;   ///<! Multi-row INSERT statement of the pending rows
 
    void                   CheckBasket(TBranch *tb);
    Bool_t                 CheckBranch(TBranch *tb);
@@ -82,14 +85,17 @@ public:
    TBranch               *Branch(const char *name, void *address, const char *leaflist, Int_t bufsize) override;
 
    virtual Int_t          Fill() override;
+   Int_t                  FlushInserts();
    virtual Int_t          GetEntry(Long64_t entry=0, Int_t getall=0) override;
    virtual Long64_t       GetEntries() const override;
    Long64_t               GetEntries(const char *sel) override { return TTree::GetEntries(sel); }
    Long64_t               GetEntriesFast()const override;
+   Int_t                  GetInsertBatchSize() const { return fInsertBatchSize; }
    TString                GetTableName(){ return fTable; }
    virtual Long64_t       LoadTree(Long64_t entry) override;
    virtual Long64_t       PrepEntry(Long64_t entry);
    void                   Refresh() override;
+   void                   SetInsertBatchSize(Int_t n);
 
    ClassDefOverride(TTreeSQL,2);  // TTree Implementation read and write to a SQL database.
 };
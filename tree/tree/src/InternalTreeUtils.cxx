@@ -8,12 +8,31 @@
 
 #include "ROOT/InternalTreeUtils.hxx"
 #include "TBranch.h" // Usage of TBranch in ClearMustCleanupBits
+#include "TBufferFile.h"
 #include "TChain.h"
 #include "TCollection.h" // TRangeStaticCast
+#include "TEnv.h"
 #include "TFile.h"
 #include "TFriendElement.h"
+#include "TLeaf.h"
+#include "TMath.h" // TMath::BinarySearch
+#include "TROOT.h" // ROOT::IsImplicitMTEnabled
+#include "TSystem.h"
 #include "TTree.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm> // std::min
+#include <cstring>   // std::memcpy
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+
 #include <utility> // std::pair
 #include <vector>
 #include <stdexcept> // std::runtime_error
@@ -56,6 +75,128 @@ static void GetTopLevelBranchNamesImpl(TTree &t, std::unordered_set<std::string>
    }
 }
 
+namespace {
+
+/// Process-wide cache of the tree headers read by GetTreeHeaderInfos(), keyed by file and tree name. An entry is only
+/// used while the file keeps its modification time and size. If the rootrc variable TTree.HeaderCacheFile is set, the
+/// cache is loaded from and appended to that sidecar file, such that it is shared by subsequent processes.
+class RTreeHeaderCache {
+   struct REntry {
+      Long_t fModTime;
+      Long64_t fSize;
+      ROOT::Internal::TreeUtils::RTreeHeaderInfo fInfo;
+   };
+
+   std::mutex fMutex;
+   std::unordered_map<std::string, REntry> fEntries;
+   std::string fSidecar;
+
+   static std::string Key(const std::string &fileName, const std::string &treeName)
+   {
+      return fileName + '\t' + treeName;
+   }
+
+   // Each line of the sidecar holds the file name, tree name, modification time, size, number of entries and the
+   // space-separated starts of the clusters, separated by tabs. Later lines take precedence.
+   RTreeHeaderCache()
+   {
+      TString sidecar = gEnv->GetValue("TTree.HeaderCacheFile", "");
+      if (sidecar.IsNull() || gSystem->ExpandPathName(sidecar))
+         return;
+      fSidecar = sidecar.Data();
+
+      std::ifstream in(fSidecar);
+      std::string line;
+      while (std::getline(in, line)) {
+         std::istringstream fields(line);
+         std::string fileName, treeName, starts;
+         REntry entry;
+         if (!std::getline(fields, fileName, '\t') || !std::getline(fields, treeName, '\t') ||
+             !(fields >> entry.fModTime >> entry.fSize >> entry.fInfo.fEntries))
+            continue;
+         std::getline(fields, starts);
+         std::istringstream startsStream(starts);
+         for (Long64_t start; startsStream >> start;)
+            entry.fInfo.fClusterStarts.push_back(start);
+         entry.fInfo.fFileOk = entry.fInfo.fTreeOk = true;
+         fEntries[Key(fileName, treeName)] = std::move(entry);
+      }
+   }
+
+public:
+   static RTreeHeaderCache &Instance()
+   {
+      static RTreeHeaderCache cache;
+      return cache;
+   }
+
+   bool Find(const std::string &fileName, const std::string &treeName, const FileStat_t &stat,
+             ROOT::Internal::TreeUtils::RTreeHeaderInfo &info)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto it = fEntries.find(Key(fileName, treeName));
+      if (it == fEntries.end() || it->second.fModTime != stat.fMtime || it->second.fSize != stat.fSize)
+         return false;
+      info = it->second.fInfo;
+      return true;
+   }
+
+   void Insert(const std::string &fileName, const std::string &treeName, const FileStat_t &stat,
+               const ROOT::Internal::TreeUtils::RTreeHeaderInfo &info)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fEntries[Key(fileName, treeName)] = REntry{stat.fMtime, stat.fSize, info};
+      if (fSidecar.empty())
+         return;
+
+      std::ostringstream line;
+      line << fileName << '\t' << treeName << '\t' << stat.fMtime << '\t' << stat.fSize << '\t' << info.fEntries
+           << '\t';
+      for (auto start : info.fClusterStarts)
+         line << start << ' ';
+      line << '\n';
+      std::ofstream out(fSidecar, std::ios::app);
+      out << line.str();
+   }
+};
+
+/// Read the number of entries and the cluster boundaries of a tree from the header of its file, unless the cache
+/// holds them for the current version of the file.
+ROOT::Internal::TreeUtils::RTreeHeaderInfo ReadTreeHeaderInfo(const std::string &treeName, const std::string &fileName)
+{
+   ROOT::Internal::TreeUtils::RTreeHeaderInfo info;
+   auto &cache = RTreeHeaderCache::Instance();
+   // Files that cannot be stat'ed, e.g. members of archives, are always read
+   FileStat_t stat;
+   const bool cacheable = gSystem->GetPathInfo(fileName.c_str(), stat) == 0;
+   if (cacheable && cache.Find(fileName, treeName, stat, info))
+      return info;
+
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> f(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (!f || f->IsZombie())
+      return info;
+   info.fFileOk = true;
+   auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+   if (!t)
+      return info;
+   info.fTreeOk = true;
+
+   // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+   t->ResetBit(kMustCleanup);
+   ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
+   info.fEntries = t->GetEntries();
+   auto clusterIter = t->GetClusterIterator(0);
+   for (Long64_t start; (start = clusterIter()) < info.fEntries;)
+      info.fClusterStarts.push_back(start);
+
+   if (cacheable)
+      cache.Insert(fileName, treeName, stat, info);
+   return info;
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 namespace Internal {
 namespace TreeUtils {
@@ -306,6 +447,145 @@ std::unique_ptr<TChain> MakeChainForMT(const std::string &name, const std::strin
    return c;
 }
 
+/// \brief Return the layout of the values of a branch, as read by ReadBranchBulk() or ReadBranchBulkVarLength().
+///
+/// Supported are single-leaf branches of fundamental types or fixed-size arrays of them, which TBranch::GetBulkEntries
+/// can read, and the variable-length arrays and std::vector branches which TBranch::GetBulkEntriesVarLength can read.
+/// The type of the returned info is kOther_t for all other branches.
+RBulkBranchInfo GetBulkBranchInfo(TTree &tree, const std::string &branchName)
+{
+   RBulkBranchInfo info;
+   TBranch *branch = tree.GetBranch(branchName.c_str());
+   if (!branch)
+      return info;
+   if (branch->SupportsBulkReadVarLength()) {
+      info.fType = branch->GetBulkRead().GetVarLengthType();
+      info.fVarLength = true;
+      return info;
+   }
+   if (!branch->SupportsBulkRead())
+      return info;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (leaf->GetLeafCount() || branch->GetExpectedType(cl, type) || cl || !TDataType::GetDataType(type))
+      return info;
+   info.fType = type;
+   info.fLen = leaf->GetLenStatic();
+   return info;
+}
+
+/// \brief Read the values of a branch for the entries [start, stop) of a tree or chain into a contiguous array.
+///
+/// The values, `(stop - start) * fLen` of the type given by GetBulkBranchInfo(), are deserialized basket by basket
+/// with TBranch::GetBulkEntries, without going through SetBranchAddress and GetEntry.
+/// Returns false if the branch cannot be read in bulk or if reading a basket failed.
+bool ReadBranchBulk(TTree &tree, const std::string &branchName, Long64_t start, Long64_t stop, void *values)
+{
+   const auto info = GetBulkBranchInfo(tree, branchName);
+   if (info.fType == kOther_t || info.fVarLength)
+      return false;
+   const Long64_t entrySize = TDataType::GetDataType(info.fType)->Size() * info.fLen;
+   char *out = static_cast<char *>(values);
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   for (Long64_t entry = start; entry < stop;) {
+      const Long64_t local = tree.LoadTree(entry);
+      TBranch *branch = (local < 0) ? nullptr : tree.GetTree()->GetBranch(branchName.c_str());
+      if (!branch)
+         return false;
+      // GetBulkEntries reads complete baskets, starting with the first entry of the basket that contains `local`
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Long64_t first = basketEntry[TMath::BinarySearch(branch->GetWriteBasket() + 1, basketEntry, local)];
+      const Int_t n = branch->GetBulkRead().GetBulkEntries(first, buf);
+      if (n <= local - first)
+         return false;
+      const Long64_t count = std::min(first + n - local, stop - entry);
+      std::memcpy(out, buf.GetCurrent() + (local - first) * entrySize, count * entrySize);
+      out += count * entrySize;
+      entry += count;
+   }
+   return true;
+}
+
+/// \brief Read the variable-length entries [start, stop) of a branch of a tree or chain.
+///
+/// The values of all entries, which must be of the type T given by GetBulkBranchInfo(), are appended contiguously
+/// to `values` and `stop - start + 1` offsets are appended to `offsets`, such that the values of the entry
+/// `start + i` are the elements [offsets[i], offsets[i + 1]) of the appended values.
+/// Returns false if the branch cannot be read in bulk or if reading a basket failed.
+template <typename T>
+bool ReadBranchBulkVarLength(TTree &tree, const std::string &branchName, Long64_t start, Long64_t stop,
+                             std::vector<T> &values, std::vector<Long64_t> &offsets)
+{
+   const auto info = GetBulkBranchInfo(tree, branchName);
+   if (info.fType != TDataType::GetType(typeid(T)) || !info.fVarLength)
+      return false;
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile offsetBuf(TBuffer::kWrite, 1024);
+   Long64_t nValues = 0;
+   offsets.reserve(offsets.size() + stop - start + 1);
+   offsets.push_back(nValues);
+   for (Long64_t entry = start; entry < stop;) {
+      const Long64_t local = tree.LoadTree(entry);
+      TBranch *branch = (local < 0) ? nullptr : tree.GetTree()->GetBranch(branchName.c_str());
+      if (!branch)
+         return false;
+      const Int_t n = branch->GetBulkRead().GetBulkEntriesVarLength(local, buf, offsetBuf);
+      if (n <= 0)
+         return false;
+      const Long64_t count = std::min<Long64_t>(n, stop - entry);
+      const Int_t *basketOffsets = reinterpret_cast<const Int_t *>(offsetBuf.GetCurrent());
+      const T *basketValues = reinterpret_cast<const T *>(buf.GetCurrent());
+      values.insert(values.end(), basketValues, basketValues + basketOffsets[count]);
+      for (Long64_t i = 1; i <= count; ++i)
+         offsets.push_back(nValues + basketOffsets[i]);
+      nValues += basketOffsets[count];
+      entry += count;
+   }
+   return true;
+}
+
+// Value types of variable-length branches, whose std::vector can be viewed as NumPy arrays by PyROOT
+template bool ReadBranchBulkVarLength(TTree &, const std::string &, Long64_t, Long64_t, std::vector<Int_t> &,
+                                      std::vector<Long64_t> &);
+template bool ReadBranchBulkVarLength(TTree &, const std::string &, Long64_t, Long64_t, std::vector<UInt_t> &,
+                                      std::vector<Long64_t> &);
+template bool ReadBranchBulkVarLength(TTree &, const std::string &, Long64_t, Long64_t, std::vector<Float_t> &,
+                                      std::vector<Long64_t> &);
+template bool ReadBranchBulkVarLength(TTree &, const std::string &, Long64_t, Long64_t, std::vector<Double_t> &,
+                                      std::vector<Long64_t> &);
+template bool ReadBranchBulkVarLength(TTree &, const std::string &, Long64_t, Long64_t, std::vector<Long64_t> &,
+                                      std::vector<Long64_t> &);
+template bool ReadBranchBulkVarLength(TTree &, const std::string &, Long64_t, Long64_t, std::vector<ULong64_t> &,
+                                      std::vector<Long64_t> &);
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read the number of entries and the cluster boundaries of trees from the headers of their files.
+/// \param[in] treeNames The names of the trees, one per file.
+/// \param[in] fileNames The names of the files.
+///
+/// With the implicit multi-threading enabled, the files are opened concurrently by the tasks of the thread pool,
+/// which bounds the number of files open at the same time. The headers are cached for the lifetime of the process
+/// (and beyond, in the sidecar file given by the rootrc variable TTree.HeaderCacheFile), as long as the modification
+/// time and the size of the files do not change. The files are not kept open.
+std::vector<RTreeHeaderInfo>
+GetTreeHeaderInfos(const std::vector<std::string> &treeNames, const std::vector<std::string> &fileNames)
+{
+   const auto nFiles = fileNames.size();
+   std::vector<RTreeHeaderInfo> infos(nFiles);
+   auto readHeader = [&](std::size_t i) { infos[i] = ReadTreeHeaderInfo(treeNames[i], fileNames[i]); };
+#ifdef R__USE_IMT
+   if (nFiles > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(readHeader, ROOT::TSeq<std::size_t>(nFiles));
+      return infos;
+   }
+#endif
+   for (std::size_t i = 0; i < nFiles; ++i)
+      readHeader(i);
+   return infos;
+}
+
 } // namespace TreeUtils
 } // namespace Internal
 } // namespace ROOT
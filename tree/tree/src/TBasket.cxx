@@ -23,10 +23,18 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
+#include "ROOT/RIOMetrics.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
+#include "ROOT/RZipRecords.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
 
 #include <bitset>
+#include <cstring>
+#include <vector>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
@@ -598,6 +606,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       if (R__unlikely(gPerfStats)) {
          start = TTimeStamp();
       }
+      ROOT::Experimental::RIOMetrics::RTimer unzipTimer(ROOT::Experimental::RIOMetrics::kUnzipTime);
 
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, fKeylen);
       char *rawUncompressedObjectBuffer = rawUncompressedBuffer+fKeylen;
@@ -605,8 +614,18 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       Int_t nin, nbuf;
       Int_t nout = 0, noutot = 0, nintot = 0;
 
+      Bool_t unzipped = kFALSE;
+#ifdef R__USE_IMT
+      if (!oldCase && ROOT::IsImplicitMTEnabled() && fBranch->GetTree()->GetImplicitMT()) {
+         unzipped = ROOT::Internal::UnzipRecordsInParallel(rawCompressedObjectBuffer, len - fKeylen,
+                                                           rawUncompressedObjectBuffer, fObjlen, nintot);
+         if (unzipped)
+            noutot = fObjlen;
+      }
+#endif // R__USE_IMT
+
       // Unzip all the compressed objects in the compressed object buffer.
-      while (1) {
+      while (!unzipped) {
          // Check the header for errors.
          if (R__unlikely(R__unzip_header(&nin, rawCompressedObjectBuffer, &nbuf) != 0)) {
             Error("ReadBasketBuffers", "Inconsistency found in header (nin=%d, nbuf=%d)", nin, nbuf);
@@ -1204,7 +1223,7 @@ Int_t TBasket::WriteBuffer()
       }
    }
 
-   Int_t nout, noutot, bufmax, nzip;
+   Int_t nout, noutot;
 
    fObjlen = fBufferRef->Length() - fKeylen;
 
@@ -1217,7 +1236,11 @@ Int_t TBasket::WriteBuffer()
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
       cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
    if (cxlevel > 0) {
-      Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
+      TTree *tree = fBranch->GetTree();
+      Int_t chunkSize = tree ? tree->GetCompressionChunkSize() : 0;
+      if (chunkSize <= 0 || chunkSize > kMAXZIPBUF)
+         chunkSize = kMAXZIPBUF;
+      Int_t nbuffers = 1 + (fObjlen - 1) / chunkSize;
       Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
       InitializeCompressedBuffer(buflen, file);
       if (!fCompressedBufferRef) {
@@ -1227,26 +1250,47 @@ Int_t TBasket::WriteBuffer()
       fCompressedBufferRef->SetWriteMode();
       fBuffer = fCompressedBufferRef->Buffer();
       char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
+
+      // Every chunk is compressed into its own region of the output buffer such that the chunks can be
+      // compressed independently; the compressed chunks are moved next to each other afterwards.  A chunk
+      // whose compressed size would exceed its uncompressed size is reported as not compressed (nout == 0).
+      std::vector<Int_t> nouts(nbuffers, 0);
+      // Small baskets may be compressed with the dictionary of the file
+      UInt_t dictID = nbuffers == 1 ? file->GetCompressionDictionary(objbuf, fObjlen, cxAlgorithm) : 0;
+      auto fnZipChunk = [&](Int_t i) {
+         Int_t srcsize = (i == nbuffers - 1) ? fObjlen - i * chunkSize : chunkSize;
+         Int_t tgtsize = srcsize;
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         R__zipWithDictionary(cxlevel, &srcsize, objbuf + i * chunkSize, &tgtsize,
+                              &fBuffer[fKeylen] + i * chunkSize, &nouts[i], cxAlgorithm, dictID);
+      };
+
+      // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
+      // for a given TFile: that's because the compression buffer when we use IMT is no longer
+      // shared amongst several threads.
 #ifdef R__USE_IMT
-         sentry.lock();
+      sentry.unlock();
+      if (nbuffers > 1 && tree && ROOT::IsImplicitMTEnabled() && tree->GetImplicitMT()) {
+         ROOT::Experimental::TTaskGroup chunkTasks;
+         for (Int_t i = 0; i < nbuffers; ++i)
+            chunkTasks.Run([&fnZipChunk, i]() { fnZipChunk(i); });
+         chunkTasks.Wait();
+      } else {
+         for (Int_t i = 0; i < nbuffers; ++i)
+            fnZipChunk(i);
+      }
+      sentry.lock();
+#else
+      for (Int_t i = 0; i < nbuffers; ++i)
+         fnZipChunk(i);
 #endif  // R__USE_IMT
 
+      char *bufcur = &fBuffer[fKeylen];
+      noutot = 0;
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         nout = nouts[i];
          // test if buffer has really been compressed. In case of small buffers
          // when the buffer contains random data, it may happen that the compressed
          // buffer is larger than the input. In this case, we write the original uncompressed buffer
@@ -1265,10 +1309,10 @@ Int_t TBasket::WriteBuffer()
             }
             goto WriteFile;
          }
+         if (bufcur != &fBuffer[fKeylen] + i * chunkSize)
+            memmove(bufcur, &fBuffer[fKeylen] + i * chunkSize, nout);
          bufcur += nout;
          noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
       }
       nout = noutot;
       Create(noutot,file);
@@ -51,6 +51,7 @@
 
 #include "TBranchIMTHelper.h"
 
+#include "ROOT/RIOMetrics.hxx"
 #include "ROOT/TIOFeatures.hxx"
 
 #include <atomic>
@@ -1622,6 +1623,186 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+namespace {
+
+/// Size in memory of the elements of variable-length entries that GetBulkEntriesVarLength() supports;
+/// returns 0 for unsupported types.
+Int_t GetBulkElementSize(EDataType type)
+{
+   switch (type) {
+   case kChar_t:
+   case kUChar_t:
+   case kBool_t: return 1;
+   case kShort_t:
+   case kUShort_t: return 2;
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t: return 4;
+   case kLong64_t:
+   case kULong64_t:
+   case kDouble_t: return 8;
+   default: return 0;
+   }
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the value type of the elements of the variable-length entries of this
+/// branch, or kOther_t if the branch cannot be read with GetBulkEntriesVarLength().
+///
+/// A plain branch qualifies if it has a single leaf holding a variable-length array
+/// of a fundamental type, e.g. `x[n]/F`.
+
+EDataType TBranch::GetBulkVarLengthType()
+{
+   if (fNleaves != 1)
+      return kOther_t;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   if (!leaf->GetLeafCount() || leaf->GetDeserializeType() == TLeaf::DeserializeType::kExternal)
+      return kOther_t;
+   TClass *clptr = nullptr;
+   EDataType type = kOther_t;
+   if (GetExpectedType(clptr, type) || clptr)
+      return kOther_t;
+   return GetBulkElementSize(type) ? type : kOther_t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch stores variable-length collections of a fundamental type
+/// that can be read with GetBulkEntriesVarLength(), false otherwise.
+
+Bool_t TBranch::SupportsBulkReadVarLength() const {
+   return const_cast<TBranch*>(this)->GetBulkVarLengthType() != kOther_t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the remaining events of the basket that contains `entry` into the given
+/// buffers.  Supported are variable-length leaf arrays (e.g. `x[n]/F`) and
+/// non-split std::vector branches of fundamental types (see SupportsBulkReadVarLength()).
+///
+/// Returns -1 in case of a failure.  On success, returns the number N of events
+/// starting at `entry` that are now in the buffers.  The caller can then access
+/// the values, deserialized and contiguous across events, as
+///
+/// static_cast<T*>(user_buf.GetCurrent())
+///
+/// and the N + 1 offsets into the values array as
+///
+/// reinterpret_cast<Int_t*>(offset_buf.GetCurrent())
+///
+/// such that the values of event `entry + i` are in the range [offsets[i], offsets[i + 1]).
+///
+/// Unlike GetBulkEntries(), `entry` does not need to be the first entry of a basket.
+
+Int_t TBranch::GetBulkEntriesVarLength(Long64_t entry, TBuffer &user_buf, TBuffer &offset_buf)
+{
+   const EDataType type = GetBulkVarLengthType();
+   const Int_t elementSize = GetBulkElementSize(type);
+   if (R__unlikely(elementSize == 0)) { return -1; }
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) { return -1; }
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) { return -1; }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntriesVarLength", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntriesVarLength", "Basket has displacement.\n");
+      return -1;
+   }
+
+   // Needs to be done before the basket buffer is handed over to user_buf, the offsets may be calculated from it
+   Int_t *entryOffset = basket->GetEntryOffset();
+
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   const Int_t firstInBasket = entry - first;
+   const Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - entry;
+   const Int_t nevbuf = basket->GetNevBuf();
+   const Int_t nevbufsize = basket->GetNevBufSize();
+   const Int_t bufbegin = basket->GetKeylen();
+
+   const Int_t offsetsSize = (N + 1) * sizeof(Int_t);
+   if (offset_buf.BufferSize() < offsetsSize) {
+      offset_buf.AutoExpand(offsetsSize);
+   }
+   Int_t *offsets = reinterpret_cast<Int_t*>(offset_buf.Buffer());
+
+   // Compact the values of all events at the beginning of the buffer, which also keeps them aligned.
+   // The destination never overtakes the source because the values are moved only towards the front.
+   char *values = user_buf.Buffer();
+   Int_t nValues = 0;
+   offsets[0] = 0;
+   for (Int_t i = 0; i < N; ++i) {
+      const Int_t idx = firstInBasket + i;
+      const Int_t entryBegin = entryOffset ? entryOffset[idx] : bufbegin + idx * nevbufsize;
+      Int_t entryEnd;
+      if (idx + 1 < nevbuf) {
+         entryEnd = entryOffset ? entryOffset[idx + 1] : entryBegin + nevbufsize;
+      } else {
+         entryEnd = basket->GetLast();
+      }
+      user_buf.SetBufferOffset(entryBegin);
+      const Int_t nAnnounced = ReadBulkVarLengthHeader(user_buf);
+      const Int_t valuesBegin = user_buf.Length();
+      const Int_t nBytes = entryEnd - valuesBegin;
+      if (R__unlikely((nBytes < 0) || (nBytes % elementSize) ||
+                      ((nAnnounced >= 0) && (nAnnounced * elementSize != nBytes)))) {
+         Error("GetBulkEntriesVarLength", "Unexpected layout of entry %lld.\n", entry + i);
+         return -1;
+      }
+      memmove(values + nValues * elementSize, values + valuesBegin, nBytes);
+      nValues += nBytes / elementSize;
+      offsets[i + 1] = nValues;
+   }
+
+   user_buf.SetBufferOffset(0);
+   if ((elementSize > 1) && R__unlikely(!user_buf.ByteSwapBuffer(nValues, type))) {
+      Error("GetBulkEntriesVarLength", "Failed to deserialize values.\n");
+      return -1;
+   }
+   offset_buf.SetBufferOffset(0);
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -1688,7 +1869,10 @@ Int_t TBranch::GetEntry(Long64_t entry, Int_t getall)
    }
 
    // Int_t bufbegin = buf->Length();
-   (this->*fReadLeaves)(*buf);
+   {
+      ROOT::Experimental::RIOMetrics::RTimer deserializeTimer(ROOT::Experimental::RIOMetrics::kDeserializeTime);
+      (this->*fReadLeaves)(*buf);
+   }
    return buf->Length() - bufbegin;
 }
 
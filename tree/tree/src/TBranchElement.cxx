@@ -2835,6 +2835,55 @@ Int_t TBranchElement::GetExpectedType(TClass *&expectedClass,EDataType &expected
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Non-split std::vector branches of fundamental types, both top-level and as data
+/// members of split objects, can be read with GetBulkEntriesVarLength().
+
+EDataType TBranchElement::GetBulkVarLengthType()
+{
+   if ((fType != 0) || (fBranches.GetEntriesFast() > 0))
+      return kOther_t;
+   if ((fID != -1) && (fStreamerType != TVirtualStreamerInfo::kSTL))
+      return kOther_t;
+
+   TClass *clptr = nullptr;
+   EDataType type = kOther_t;
+   if (GetExpectedType(clptr, type) || !clptr)
+      return kOther_t;
+   TVirtualCollectionProxy *proxy = clptr->GetCollectionProxy();
+   if (!proxy || (proxy->GetCollectionType() != ROOT::kSTLvector) || proxy->HasPointers() || proxy->GetValueClass())
+      return kOther_t;
+   // std::vector<bool> is bit-packed in memory and thus not in the list
+   type = proxy->GetType();
+   switch (type) {
+   case kChar_t: case kUChar_t: case kShort_t: case kUShort_t: case kInt_t: case kUInt_t: case kFloat_t:
+   case kLong64_t: case kULong64_t: case kDouble_t: return type;
+   default: return kOther_t;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Collections of fundamental types are streamed as the byte count and version of
+/// the collection followed by the number of elements and the elements themselves.
+
+Int_t TBranchElement::ReadBulkVarLengthHeader(TBuffer &b)
+{
+   const UInt_t kByteCountMask = 0x40000000;  // OR the byte count with this
+   const Int_t start = b.Length();
+   UInt_t count;
+   b >> count;
+   if (count & kByteCountMask) {
+      Version_t version;
+      b >> version;
+   } else {
+      // No byte count, only the version
+      b.SetBufferOffset(start + sizeof(Version_t));
+   }
+   Int_t nElements;
+   b >> nElements;
+   return nElements;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the 'full' name of the branch.  In particular prefix  the mother's name
 /// when it does not end in a trailing dot and thus is not part of the branch name
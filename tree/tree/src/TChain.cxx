@@ -37,6 +37,7 @@ the trees in the chain.
 #include "TClass.h"
 #include "TColor.h"
 #include "TCut.h"
+#include "TEnv.h"
 #include "TError.h"
 #include "TFile.h"
 #include "TFileInfo.h"
@@ -62,9 +63,38 @@ the trees in the chain.
 #include "TVirtualPerfStats.h"
 #include "strlcpy.h"
 #include "snprintf.h"
+#include "ROOT/InternalTreeUtils.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
 
 ClassImp(TChain);
 
+/// The next file of a chain, opened and read up to its tree header by a task while the current file is processed.
+struct ROOT::Internal::TChainNextFile {
+   Int_t fTreeNumber = -1; ///< The index of the tree in the chain
+   TString fFileName;      ///< The file name of the chain element, used to detect changes of the list of files
+   TFile *fFile = nullptr; ///< The opened file, owned until Take() is called
+#ifdef R__USE_IMT
+   ROOT::Experimental::TTaskGroup fTask;
+#endif
+
+   ~TChainNextFile() { delete Take(); }
+
+   /// Wait for the background open to complete and release the ownership of the file
+   TFile *Take()
+   {
+#ifdef R__USE_IMT
+      fTask.Wait();
+#endif
+      TFile *file = fFile;
+      fFile = nullptr;
+      return file;
+   }
+};
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -179,6 +209,8 @@ TChain::~TChain()
    }
 
    SafeDelete(fProofChain);
+   delete fNextFile;
+   fNextFile = nullptr;
    fStatus->Delete();
    delete fStatus;
    fStatus = 0;
@@ -953,7 +985,10 @@ Long64_t TChain::GetChainEntryNumber(Long64_t entry) const
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the total number of entries in the chain.
 /// In case the number of entries in each tree is not yet known,
-/// the offset table is computed.
+/// the offset table is computed. With the implicit multi-threading enabled
+/// or the tree header cache configured (rootrc variable TTree.HeaderCacheFile),
+/// the headers of the files are read in parallel or taken from the cache,
+/// without loading the trees; otherwise the files are opened one by one.
 
 Long64_t TChain::GetEntries() const
 {
@@ -965,7 +1000,12 @@ Long64_t TChain::GetEntries() const
       return fProofChain->GetEntries();
    }
    if (fEntries == TTree::kMaxEntries) {
-      const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
+      const char *headerCache = gEnv->GetValue("TTree.HeaderCacheFile", "");
+      if (ROOT::IsImplicitMTEnabled() || (headerCache && headerCache[0]))
+         const_cast<TChain*>(this)->ReadTreeHeaders();
+      // The trees whose header could not be read are opened in turn
+      if (fEntries == TTree::kMaxEntries)
+         const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
    return fEntries;
 }
@@ -1340,6 +1380,10 @@ Long64_t TChain::LoadTree(Long64_t entry)
 
    // If entry belongs to the current tree return entry.
    if (fTree && treenum == fTreeNumber) {
+      // Overlap opening the next file with reading the last cluster of this one
+      if ((fPrefetchEntry >= 0) && (entry >= fPrefetchEntry) && !fNextFile) {
+         PrefetchNextFile();
+      }
       // First set the entry the tree on its owns friends
       // (the friends of the chain will be updated in the
       // next loop).
@@ -1496,7 +1540,16 @@ Long64_t TChain::LoadTree(Long64_t entry)
    {
       TDirectory::TContext ctxt;
       const char *option = fGlobalRegistration ? "READ" : "READ_WITHOUT_GLOBALREGISTRATION";
-      fFile = TFile::Open(element->GetTitle(), option);
+      fFile = nullptr;
+      if (fNextFile) {
+         // Use the file opened ahead of time, unless the chain has been modified in the meantime
+         if (fNextFile->fTreeNumber == treenum && fNextFile->fFileName == element->GetTitle())
+            fFile = fNextFile->Take();
+         delete fNextFile;
+         fNextFile = nullptr;
+      }
+      if (!fFile)
+         fFile = TFile::Open(element->GetTitle(), option);
       if (fFile && fGlobalRegistration)
          fFile->SetBit(kMustCleanup);
    }
@@ -1617,6 +1670,12 @@ Long64_t TChain::LoadTree(Long64_t entry)
    // before calling LoadTree(entry) on the friends (so that
    // they use the correct read entry number).
 
+   // Open the next file in the background once the last cluster of this tree is reached
+   fPrefetchEntry = -1;
+   if (fPrefetchNextFile && fTreeNumber < fNtrees - 1 && nentries > 0 && ROOT::IsImplicitMTEnabled() && fIMTEnabled) {
+      fPrefetchEntry = fTreeOffset[fTreeNumber] + fTree->GetClusterIterator(nentries - 1).GetStartEntry();
+   }
+
    // Change the new current tree to the new entry.
    Long64_t loadResult = fTree->LoadTree(treeReadEntry);
    if (loadResult == treeReadEntry) {
@@ -2309,11 +2368,76 @@ void TChain::RemoveFriend(TTree* oldFriend)
    InvalidateCurrentTree();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Open the file following the current one in a task, including the reading of its
+/// tree header, such that LoadTree() does not need to wait for it when switching files.
+
+void TChain::PrefetchNextFile()
+{
+#ifdef R__USE_IMT
+   TChainElement *element = static_cast<TChainElement *>(fFiles->At(fTreeNumber + 1));
+   if (!element)
+      return;
+
+   fNextFile = new ROOT::Internal::TChainNextFile();
+   fNextFile->fTreeNumber = fTreeNumber + 1;
+   fNextFile->fFileName = element->GetTitle();
+   TString treeName = element->GetName();
+   const char *option = fGlobalRegistration ? "READ" : "READ_WITHOUT_GLOBALREGISTRATION";
+   auto nextFile = fNextFile;
+   fNextFile->fTask.Run([nextFile, treeName, option]() {
+      TDirectory::TContext ctxt;
+      TFile *file = TFile::Open(nextFile->fFileName, option);
+      if (file && !file->IsZombie()) {
+         // Keeps the tree in the list of in-memory objects of the file, for the Get() in LoadTree()
+         file->Get(treeName);
+      }
+      nextFile->fFile = file;
+   });
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the number of entries of the trees that are not known yet, and the offset
+/// table up to the first tree that remains unknown, from the tree headers returned
+/// by ROOT::Internal::TreeUtils::GetTreeHeaderInfos(). The trees are not loaded.
+
+void TChain::ReadTreeHeaders()
+{
+   std::vector<Int_t> unknown;
+   std::vector<std::string> treeNames, fileNames;
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      TChainElement *element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      if (element->GetEntries() != TTree::kMaxEntries)
+         continue;
+      unknown.push_back(i);
+      treeNames.emplace_back(element->GetName());
+      fileNames.emplace_back(element->GetTitle());
+   }
+
+   const auto infos = ROOT::Internal::TreeUtils::GetTreeHeaderInfos(treeNames, fileNames);
+   for (std::size_t j = 0; j < unknown.size(); ++j) {
+      if (infos[j].fTreeOk)
+         static_cast<TChainElement *>(fFiles->UncheckedAt(unknown[j]))->SetNumberEntries(infos[j].fEntries);
+   }
+
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      const Long64_t nentries = static_cast<TChainElement *>(fFiles->UncheckedAt(i))->GetEntries();
+      if (nentries == TTree::kMaxEntries)
+         return;
+      fTreeOffset[i + 1] = fTreeOffset[i] + nentries;
+   }
+   fEntries = fTreeOffset[fNtrees];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Resets the state of this chain.
 
 void TChain::Reset(Option_t*)
 {
+   delete fNextFile;
+   fNextFile = nullptr;
+   fPrefetchEntry = -1;
    delete fFile;
    fFile = 0;
    fNtrees         = 0;
@@ -2336,6 +2460,9 @@ void TChain::Reset(Option_t*)
 
 void TChain::ResetAfterMerge(TFileMergeInfo *info)
 {
+   delete fNextFile;
+   fNextFile = nullptr;
+   fPrefetchEntry = -1;
    fNtrees         = 0;
    fTreeNumber     = -1;
    fTree           = 0;
@@ -2978,6 +3105,24 @@ void TChain::SetPacketSize(Int_t size)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable/Disable opening the next file of the chain ahead of time.
+///
+/// If enabled and implicit multi-threading is on, LoadTree() opens the next file and
+/// reads its tree header in a task as soon as the last cluster of the current tree is
+/// reached.  This hides the latency of opening remote files at file boundaries.  At most
+/// one file is opened ahead of time, so the memory overhead is bounded by one tree header.
+
+void TChain::SetPrefetchNextFile(Bool_t on)
+{
+   fPrefetchNextFile = on;
+   if (!on) {
+      delete fNextFile;
+      fNextFile = nullptr;
+      fPrefetchEntry = -1;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Enable/Disable PROOF processing on the current default Proof (gProof).
 ///
@@ -154,9 +154,47 @@ See comments to those functions for more details
 #include "TRegexp.h"
 #include "TSystem.h"
 #include "TObjString.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 ClassImp(TEntryList);
 
+namespace {
+
+/// The number of blocks processed by a single task in the parallel operations on blocks
+constexpr Int_t kBlocksPerTask = 64;
+
+/// Call func(i) for all i in [0, n).  The blocks of an entry list are independent, so
+/// that the calls are distributed over tasks if implicit multi-threading is enabled.
+void ForEachBlock(Int_t n, const std::function<void(Int_t)> &func)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && n > kBlocksPerTask) {
+      ROOT::Experimental::TTaskGroup tasks;
+      for (Int_t first = 0; first < n; first += kBlocksPerTask) {
+         tasks.Run([&func, first, n]() {
+            const Int_t last = std::min(first + kBlocksPerTask, n);
+            for (Int_t i = first; i < last; ++i)
+               func(i);
+         });
+      }
+      tasks.Wait();
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; ++i)
+      func(i);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// default c-tor
 
@@ -420,19 +458,20 @@ void TEntryList::Add(const TEntryList *elist)
                }
                return;
             }
-            //both not empty, merge block by block
+            //both not empty, merge block by block (in parallel with IMT)
             TEntryListBlock *block1=0;
             TEntryListBlock *block2=0;
             Int_t i;
             Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
-            Long64_t nnew, nold;
-            for (i=0; i<nmin; i++){
-               block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
-               block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
-               nold = block1->GetNPassed();
-               nnew = block1->Merge(block2);
-               fN = fN - nold + nnew;
-            }
+            std::vector<Long64_t> ndiff(nmin, 0);
+            ForEachBlock(nmin, [&](Int_t iblock) {
+               auto b1 = (TEntryListBlock*)fBlocks->UncheckedAt(iblock);
+               auto b2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(iblock);
+               Long64_t nold = b1->GetNPassed();
+               ndiff[iblock] = b1->Merge(b2) - nold;
+            });
+            for (i=0; i<nmin; i++)
+               fN += ndiff[i];
             if (fNBlocks<elist->fNBlocks){
                Int_t nmax = elist->fNBlocks;
                for (i=nmin; i<nmax; i++){
@@ -1335,13 +1374,20 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
-            }
+            //same tree, subtract block by block (in parallel with IMT)
+            if (!elist->fBlocks) return;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            std::vector<Long64_t> ndiff(nmin, 0);
+            ForEachBlock(nmin, [&](Int_t iblock) {
+               auto block1 = (TEntryListBlock*)fBlocks->UncheckedAt(iblock);
+               auto block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(iblock);
+               Long64_t nold = block1->GetNPassed();
+               ndiff[iblock] = block1->Subtract(block2) - nold;
+            });
+            for (Int_t i=0; i<nmin; i++)
+               fN += ndiff[i];
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
@@ -1376,6 +1422,108 @@ void TEntryList::Subtract(const TEntryList *elist)
    return;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Keep only the entries that are also in elist.
+///
+/// As for Subtract(), entries are matched by tree and file name.  For lists of
+/// the same tree, the intersection is computed block by block; the blocks are
+/// processed in parallel if implicit multi-threading is enabled.
+
+void TEntryList::Intersect(const TEntryList *elist)
+{
+   if (!elist) return;
+   TEntryList *templist = 0;
+   if (!fLists){
+      if (!fBlocks) return;
+      const TEntryList *other = nullptr;
+      if (!elist->fLists){
+         if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
+             !strcmp(elist->fFileName.Data(),fFileName.Data()))
+            other = elist;
+      } else {
+         //second list has sublists, try to find one for the same tree as this list
+         TIter next1(elist->GetLists());
+         while ((templist = (TEntryList*)next1())){
+            if (!strcmp(templist->fTreeName.Data(),fTreeName.Data()) &&
+                !strcmp(templist->fFileName.Data(),fFileName.Data())){
+               other = templist;
+               break;
+            }
+         }
+      }
+      // Blocks without a counterpart are intersected with an empty block
+      TEntryListBlock empty;
+      const Int_t nother = (other && other->fBlocks) ? other->fNBlocks : 0;
+      std::vector<Long64_t> ndiff(fNBlocks, 0);
+      ForEachBlock(fNBlocks, [&](Int_t iblock) {
+         auto block1 = (TEntryListBlock*)fBlocks->UncheckedAt(iblock);
+         auto block2 = (iblock < nother) ? (TEntryListBlock*)other->fBlocks->UncheckedAt(iblock) : &empty;
+         Long64_t nold = block1->GetNPassed();
+         ndiff[iblock] = block1->Intersect(block2) - nold;
+      });
+      for (Int_t i=0; i<fNBlocks; i++)
+         fN += ndiff[i];
+      fLastIndexQueried = -1;
+      fLastIndexReturned = 0;
+   } else {
+      //this list has sublists
+      TIter next2(fLists);
+      Long64_t oldn=0;
+      while ((templist = (TEntryList*)next2())){
+         oldn = templist->GetN();
+         templist->Intersect(elist);
+         fN = fN - oldn + templist->GetN();
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of entries in this list that are smaller than entry, i.e.
+/// the index that entry has (or would have) in the list.  For a list with
+/// sub-lists, returns -1.
+
+Long64_t TEntryList::GetNBefore(Long64_t entry) const
+{
+   Long64_t nbefore = 0;
+   GetNBefore(1, &entry, &nbefore);
+   return nbefore;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set nbefore[i] to GetNBefore(entries[i]) for the n entries, which must be
+/// sorted in ascending order.  The blocks are visited only once, such that e.g.
+/// the boundaries of all the clusters of a tree can be translated to ranges of
+/// entry list indices in a single pass, without iterating over the entries.
+
+void TEntryList::GetNBefore(Long64_t n, const Long64_t *entries, Long64_t *nbefore) const
+{
+   if (fLists) {
+      for (Long64_t i = 0; i < n; i++)
+         nbefore[i] = -1;
+      return;
+   }
+   Int_t iblock = 0;
+   Long64_t ncur = 0; // number of entries in the blocks before iblock
+   for (Long64_t i = 0; i < n; i++) {
+      R__ASSERT(i == 0 || entries[i] >= entries[i-1]);
+      if (!fBlocks || entries[i] <= 0) {
+         nbefore[i] = 0;
+         continue;
+      }
+      const Long64_t nblock = entries[i] / kBlockSize;
+      while (iblock < fNBlocks && iblock < nblock) {
+         ncur += ((TEntryListBlock*)fBlocks->UncheckedAt(iblock))->GetNPassed();
+         iblock++;
+      }
+      if (iblock < nblock || iblock >= fNBlocks) {
+         nbefore[i] = ncur;
+      } else {
+         auto block = (TEntryListBlock*)fBlocks->UncheckedAt(iblock);
+         nbefore[i] = ncur + block->GetNPassedBefore(entries[i] - nblock * kBlockSize);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TEntryList operator||(TEntryList &elist1, TEntryList &elist2)
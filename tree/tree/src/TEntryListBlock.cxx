@@ -38,6 +38,12 @@ End_Macro
  - __Merge__() - adds all entries from one block to the other. If the first block
              uses array representation, it's changed to bits representation only
              if the total number of passing entries is still less than kBlockSize
+ - __Intersect__() - keeps only the entries that are also in the other block
+ - __Subtract__() - removes all entries of the other block
+
+Merge(), Intersect() and Subtract() work on 16 entries at a time on the bits
+representation of both blocks, independently of the representation the blocks
+are stored in.
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
@@ -46,6 +52,9 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+#include <bitset>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,10 +251,12 @@ Int_t TEntryListBlock::Contains(Int_t entry)
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
+      if (fIndices)
+         delete [] fIndices;
       fN = block->fN;
       fIndices = new UShort_t[fN];
       for (i=0; i<fN; i++)
@@ -258,109 +269,97 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
       fLastIndexQueried = -1;
       return fNPassed;
    }
+   UShort_t bits[kBlockSize];
+   UShort_t otherBits[kBlockSize];
+   GetBits(bits);
+   block->GetBits(otherBits);
+   for (i=0; i<kBlockSize; i++)
+      bits[i] |= otherBits[i];
+   SetBits(bits);
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Keep only the entries that are also in the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Intersect(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0) return 0;
+   UShort_t bits[kBlockSize];
+   UShort_t otherBits[kBlockSize];
+   GetBits(bits);
+   block->GetBits(otherBits);
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] &= otherBits[i];
+   SetBits(bits);
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the entries of the other block from this block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   UShort_t bits[kBlockSize];
+   UShort_t otherBits[kBlockSize];
+   GetBits(bits);
+   block->GetBits(otherBits);
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] &= ~otherBits[i];
+   SetBits(bits);
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the kBlockSize words of bits with the entries of this block,
+/// whatever the representation of the block
+
+void TEntryListBlock::GetBits(UShort_t *bits) const
+{
+   Int_t i;
+   if (!fIndices) {
+      // an empty block, unless it stores the (no) entries that don't pass
+      for (i=0; i<kBlockSize; i++)
+         bits[i] = fPassing ? 0 : 0xFFFF;
+      return;
+   }
    if (fType==0){
-      //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
-      }
-   } else {
-      //stored as a list
-      if (GetNPassed() + block->GetNPassed() > kBlockSize){
-         //change to bits
-         UShort_t *bits = new UShort_t[kBlockSize];
-         Transform(1, bits);
-         Merge(block);
-      } else {
-         //this is only possible if fPassing=1 in both blocks
-         if (block->fType==1){
-            //second block stored as a list
-            //make a bigger list
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            UShort_t *elst = block->fIndices;
-            Int_t newpos, elpos;
-            newpos = elpos = 0;
-            for (i=0; i<fNPassed; i++) {
-               while (elpos < en && fIndices[i] > elst[elpos]) {
-                  newlist[newpos] = elst[elpos];
-                  newpos++;
-                  elpos++;
-               }
-               if (fIndices[i] == elst[elpos]) elpos++;
-               newlist[newpos] = fIndices[i];
-               newpos++;
-            }
-            while (elpos < en) {
-               newlist[newpos] = elst[elpos];
-               newpos++;
-               elpos++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         } else {
-            //second block is stored as bits
-
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            Int_t newpos, current;
-            newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
-                  newpos++;
-               }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
-            }
-            while(current<fNPassed){
-               newlist[newpos] = fIndices[current];
-               newpos++;
-               current++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         }
-      }
+      for (i=0; i<kBlockSize; i++)
+         bits[i] = fIndices[i];
+      return;
    }
+   for (i=0; i<kBlockSize; i++)
+      bits[i] = fPassing ? 0 : 0xFFFF;
+   for (i=0; i<fNPassed; i++)
+      bits[fIndices[i]>>4] ^= 1<<(fIndices[i] & 15);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the content of this block by the entries given as kBlockSize words
+/// of bits and choose the best representation
+
+void TEntryListBlock::SetBits(const UShort_t *bits)
+{
+   if (fType != 0 || !fIndices) {
+      if (fIndices)
+         delete [] fIndices;
+      fIndices = new UShort_t[kBlockSize];
+   }
+   fNPassed = 0;
+   for (Int_t i=0; i<kBlockSize; i++) {
+      fIndices[i] = bits[i];
+      fNPassed += std::bitset<16>(bits[i]).count();
+   }
+   fN = kBlockSize;
+   fType = 0;
+   fPassing = 1;
+   fCurrent = 0;
    fLastIndexQueried = -1;
    fLastIndexReturned = -1;
    OptimizeStorage();
-   return GetNPassed();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -375,6 +374,29 @@ Int_t TEntryListBlock::GetNPassed()
       return kBlockSize*16-fNPassed;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of entries in the block that are smaller than entry,
+/// i.e. the index that entry has (or would have) in the block
+
+Int_t TEntryListBlock::GetNPassedBefore(Int_t entry) const
+{
+   if (entry <= 0) return 0;
+   if (entry > kBlockSize*16) entry = kBlockSize*16;
+   if (!fIndices)
+      return fPassing ? 0 : entry;
+   if (fType==0){
+      Int_t n = 0;
+      Int_t nwords = entry >> 4;
+      for (Int_t i=0; i<nwords; i++)
+         n += std::bitset<16>(fIndices[i]).count();
+      if (entry & 15)
+         n += std::bitset<16>(fIndices[nwords] & ((1<<(entry & 15)) - 1)).count();
+      return n;
+   }
+   Int_t nlisted = std::lower_bound(fIndices, fIndices + fNPassed, entry) - fIndices;
+   return fPassing ? nlisted : entry - nlisted;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return entry \#entry.
 /// See also Next()
@@ -40,13 +40,16 @@ of elements
 
 #include "TLeaf.h"
 #include "TBranch.h"
+#include "TBasket.h"
 #include "TBuffer.h"
+#include "TMath.h"
 #include "TTree.h"
 #include "TVirtualPad.h"
 #include "TBrowser.h"
 #include "strlcpy.h"
 
 #include <cctype>
+#include <vector>
 
 ClassImp(TLeaf);
 
@@ -197,6 +200,10 @@ Int_t *TLeaf::GenerateOffsetArrayBase(Int_t base, Int_t events) const
    }
 
    Long64_t orig_entry = std::max(fBranch->GetReadEntry(), 0LL); // -1 indicates to start at the beginning
+   // The offsets belong to the basket holding the current entry, which may be in the middle of the basket
+   const Int_t basketIdx = TMath::BinarySearch(fBranch->GetWriteBasket() + 1, fBranch->GetBasketEntry(), orig_entry);
+   if (basketIdx >= 0)
+      orig_entry = fBranch->GetBasketEntry()[basketIdx];
    const std::vector<Int_t> *countValues = fLeafCount->GetLeafCountValues(orig_entry, events);
 
    if (!countValues || ((Int_t)countValues->size()) < events) {
@@ -356,6 +363,67 @@ TLeaf* TLeaf::GetLeafCounter(Int_t& countval) const
    return 0;
 }
 
+namespace {
+
+template <typename T>
+Int_t DecodeCountValue(char *pos)
+{
+   T value;
+   frombuf(pos, &value);
+   return static_cast<Int_t>(value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decode the values of the count leaf `leaf` for the entries [start, start + len) directly from the baskets of
+/// its branch, without going through TBranch::GetEntry() for every entry.  This is possible if the leaf is the only,
+/// fixed-size integer leaf of a plain TBranch.  Returns false if the fast path does not apply; the content of
+/// `values` is unspecified in this case.
+
+bool ReadCountValuesFromBaskets(const TLeaf &leaf, Long64_t start, Long64_t len, std::vector<Int_t> &values)
+{
+   TBranch *branch = leaf.GetBranch();
+   if (!branch || branch->IsA() != TBranch::Class() || branch->GetNleaves() != 1 || leaf.GetLeafCount() ||
+       leaf.GetLenStatic() != 1 || start < 0 || start + len > branch->GetEntries())
+      return false;
+
+   Int_t (*decode)(char *) = nullptr;
+   const bool isUnsigned = leaf.IsUnsigned();
+   switch (leaf.GetLenType()) {
+   case 1: decode = isUnsigned ? &DecodeCountValue<UChar_t> : &DecodeCountValue<Char_t>; break;
+   case 2: decode = isUnsigned ? &DecodeCountValue<UShort_t> : &DecodeCountValue<Short_t>; break;
+   case 4: decode = isUnsigned ? &DecodeCountValue<UInt_t> : &DecodeCountValue<Int_t>; break;
+   case 8: decode = isUnsigned ? &DecodeCountValue<ULong64_t> : &DecodeCountValue<Long64_t>; break;
+   default: return false;
+   }
+
+   const Long64_t *basketEntry = branch->GetBasketEntry();
+   const Int_t writeBasket = branch->GetWriteBasket();
+   const Long64_t end = start + len;
+   Long64_t entry = start;
+   while (entry < end) {
+      const Int_t basketIdx = TMath::BinarySearch(writeBasket + 1, basketEntry, entry);
+      if (basketIdx < 0)
+         return false;
+      TBasket *basket = branch->GetBasket(basketIdx);
+      if (!basket || basket->GetDisplacement())
+         return false;
+      const Long64_t basketFirst = basketEntry[basketIdx];
+      const Long64_t basketEnd = (basketIdx == writeBasket) ? branch->GetEntryNumber() : basketEntry[basketIdx + 1];
+      const Int_t *entryOffset = basket->GetEntryOffset();
+      char *buffer = basket->GetBufferRef()->Buffer();
+      const Int_t keylen = basket->GetKeylen();
+      const Int_t nevbufsize = basket->GetNevBufSize();
+      for (; entry < end && entry < basketEnd; ++entry) {
+         const Long64_t idx = entry - basketFirst;
+         const Int_t pos = entryOffset ? entryOffset[idx] : keylen + static_cast<Int_t>(idx) * nevbufsize;
+         values.push_back(decode(buffer + pos));
+      }
+   }
+   return true;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// If this branch is a branch count, return the set of collection size for
 /// the entry range requested
@@ -376,6 +444,7 @@ const TLeaf::Counts_t *TLeaf::GetLeafCountValues(Long64_t start, Long64_t len)
       {
          auto &values(fLeafCountValues->fValues);
          values.erase(values.begin(), values.begin() + start-fLeafCountValues->fStartEntry);
+         fLeafCountValues->fStartEntry = start;
          return &values;
       }
    } else {
@@ -387,6 +456,12 @@ const TLeaf::Counts_t *TLeaf::GetLeafCountValues(Long64_t start, Long64_t len)
    fLeafCountValues->fValues.reserve(len);
    fLeafCountValues->fStartEntry = start;
 
+   // The count values of a plain fixed-size leaf can be decoded directly from the baskets; this is the usual case
+   // for offset arrays generated on read (kGenerateOffsetMap) and does not depend on the branch being enabled
+   if (ReadCountValuesFromBaskets(*this, start, len, fLeafCountValues->fValues))
+      return &(fLeafCountValues->fValues);
+   fLeafCountValues->fValues.clear();
+
    auto branch = GetBranch();
    Long64_t orig_leaf_entry = branch->GetReadEntry();
    for (Long64_t idx = 0; idx < len; ++idx) {
@@ -404,9 +404,11 @@ End_Macro
 #include "TList.h"
 #include "TMath.h"
 #include "TMemFile.h"
+#include "TObjString.h"
 #include "TROOT.h"
 #include "TRealData.h"
 #include "TRegexp.h"
+#include "RZip.h"
 #include "TRefTable.h"
 #include "TStreamerElement.h"
 #include "TStreamerInfo.h"
@@ -440,6 +442,7 @@ End_Macro
 #include <cstdio>
 #include <climits>
 #include <algorithm>
+#include <memory>
 #include <set>
 
 #ifdef R__USE_IMT
@@ -4464,6 +4467,18 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 /// You can use the option "goff" to turn off the graphics output
 /// of TTree::Draw in the above example.
 ///
+/// ### Multi-threaded filling of histograms
+///
+/// When the implicit multi-threading is enabled (ROOT::EnableImplicitMT), the
+/// histograms whose limits are known before the entry loop, such as an existing
+/// histogram or a new one booked with limits as in `"x>>h(100,0,10)"`, are filled
+/// by several threads, each one with its own clone of the histogram, which are
+/// merged before the histogram is drawn. This requires a tree read from files,
+/// without aliases, friends, entry list or event list; the other cases, like the
+/// automatic binning of the default histogram `htemp`, the graphs and the entry
+/// lists, are processed sequentially. Since the entries are then not filled in
+/// order, the values returned by GetV1, GetV2, GetV3, GetV4 and GetW are not filled.
+///
 /// ### Automatic interface to TTree::Draw via the TTreeViewer
 ///
 /// A complete graphical interface to this function is implemented
@@ -4711,6 +4726,9 @@ Int_t TTree::Fill()
 
             if (gDebug > 0)
                Info("TTree::Fill", "First AutoFlush.  fAutoFlush = %lld, fAutoSave = %lld\n", fAutoFlush, fAutoSave);
+
+            if (fReadThreads > 0)
+               ApplyReadTargets();
          }
       } else {
          // Check if we need to auto flush
@@ -4732,6 +4750,9 @@ Int_t TTree::Fill()
          Info("TTree::Fill", "FlushBaskets() called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n", fEntries,
               GetZipBytes(), fFlushedBytes);
       fFlushedBytes = GetZipBytes();
+      // the read targets were set after the first cluster
+      if (fReadThreads > 0 && fReadClusterBytes < 0)
+         ApplyReadTargets();
    }
 
    if (autoSave) {
@@ -7145,6 +7166,101 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
    }
 }
 
+namespace {
+
+/// Return the branches holding data that match one of the comma separated names or wildcard patterns, or whose mother
+/// matches one of them.
+std::vector<TBranch *> GetReadBranches(const TObjArray &leaves, const TString &patterns)
+{
+   std::vector<TString> names;
+   std::unique_ptr<TObjArray> tokens{patterns.Tokenize(",")};
+   for (auto token : *tokens)
+      names.emplace_back(TString(static_cast<TObjString *>(token)->GetString()).Strip(TString::kBoth));
+
+   std::vector<TBranch *> branches;
+   for (Int_t i = 0; i < leaves.GetEntriesFast(); ++i) {
+      TBranch *branch = static_cast<TLeaf *>(leaves.UncheckedAt(i))->GetBranch();
+      if (!branches.empty() && branches.back() == branch)
+         continue;
+      for (const auto &name : names) {
+         TRegexp re(name, kTRUE);
+         TString branchName = branch->GetName();
+         TString motherName = branch->GetMother()->GetName();
+         if (name == branchName || branchName.Index(re) != kNPOS || motherName.Index(re) != kNPOS) {
+            branches.push_back(branch);
+            break;
+         }
+      }
+   }
+   return branches;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Choose the size of the next clusters and the basket sizes of the branches expected to be read from the targets
+/// given to SetReadTargets, using the average entry sizes of the entries written so far.
+///
+/// The branches expected to be read are stored in clusters of about 8 MB compressed when the tree is read from
+/// local storage, and 32 MB when it is read remotely, where the latency of each request needs to be amortized. The
+/// clusters are made small enough for the caches of all the reading threads to fit in 1 GB and, if the number of
+/// entries is known, for each thread to get ten clusters to balance the load as TTreeProcessorMT does, but never
+/// smaller than an eighth of the target. The whole cluster is kept below 300 MB compressed, as much as the default
+/// AutoSave, to bound the memory of the writer. The basket size of each read branch is then set such that a cluster
+/// is stored in one basket per branch.
+
+void TTree::ApplyReadTargets()
+{
+   const Long64_t kLocalReadBytes = 8 * 1024 * 1024;
+   const Long64_t kRemoteReadBytes = 32 * 1024 * 1024;
+   const Long64_t kMaxReadMemory = 1024 * 1024 * 1024;
+   const Long64_t kMaxClusterBytes = 300000000;
+   const Long64_t kClustersPerThread = 10;
+
+   const auto branches = GetReadBranches(fLeaves, fReadBranches);
+   if (fEntries == 0 || branches.empty()) {
+      Warning("ApplyReadTargets", "No data was written for the branches '%s', the read targets are ignored",
+              fReadBranches.Data());
+      fReadThreads = 0;
+      return;
+   }
+   Double_t readZipBytes = 0;
+   for (auto branch : branches)
+      readZipBytes += branch->GetZipBytes();
+   const Double_t readBytesPerEntry = TMath::Max(readZipBytes / fEntries, 1.);
+   const Double_t zipBytesPerEntry = TMath::Max(Double_t(GetZipBytes()) / fEntries, 1.);
+
+   const Long64_t target = fReadRemote ? kRemoteReadBytes : kLocalReadBytes;
+   Long64_t clusterSize = target / readBytesPerEntry;
+   clusterSize = TMath::Min(clusterSize, Long64_t(kMaxReadMemory / fReadThreads / readBytesPerEntry));
+   if (fReadExpectedEntries > 0)
+      clusterSize = TMath::Min(clusterSize, fReadExpectedEntries / (fReadThreads * kClustersPerThread));
+   clusterSize = TMath::Max(clusterSize, Long64_t(target / 8 / readBytesPerEntry));
+   clusterSize = TMath::Min(clusterSize, Long64_t(kMaxClusterBytes / zipBytesPerEntry));
+   clusterSize = TMath::Max(clusterSize, 1LL);
+
+   if (!TestBit(kOnlyFlushAtCluster)) {
+      for (auto branch : branches) {
+         if (branch->GetEntries() == 0 || branch->GetListOfBranches()->GetEntries() > 0)
+            continue;
+         Double_t bsize = clusterSize * (Double_t(branch->GetTotBytes()) / branch->GetEntries());
+         if (branch->GetEntryOffsetLen())
+            bsize += clusterSize * sizeof(Int_t) * 2;
+         bsize = TMath::Min(bsize, Double_t(target));
+         Int_t newBsize = Int_t(bsize) - Int_t(bsize) % 512 + 512;
+         if (gDebug > 0)
+            Info("ApplyReadTargets", "Changing buffer size from %6d to %6d bytes for %s", branch->GetBasketSize(),
+                 newBsize, branch->GetName());
+         branch->SetBasketSize(newBsize);
+      }
+   }
+
+   SetAutoFlush(clusterSize);
+   if (fAutoSave > 0)
+      fAutoSave = TMath::Max(fAutoFlush, fAutoFlush * (fAutoSave / fAutoFlush));
+   fReadClusterBytes = Long64_t(clusterSize * readBytesPerEntry);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to the Principal Components Analysis class.
 ///
@@ -7275,6 +7391,12 @@ void TTree::Print(Option_t* option) const
       } else  {
          Printf("Total number of clusters: %lld %s", totalClusters, estimated ? "(estimated)" : "");
       }
+      if (fReadThreads > 0 && fReadClusterBytes >= 0) {
+         Printf("Clusters of %lld entries chosen for %d threads reading '%s' from %s storage: %lld bytes per cluster",
+                fAutoFlush, fReadThreads, fReadBranches.Data(), fReadRemote ? "remote" : "local", fReadClusterBytes);
+         for (auto branch : GetReadBranches(fLeaves, fReadBranches))
+            Printf("   Basket size of %-40s %8d", branch->GetName(), branch->GetBasketSize());
+      }
       return;
    }
 
@@ -8883,6 +9005,30 @@ void TTree::SetCircular(Long64_t maxEntries)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the size of the chunks in which the baskets of this tree are compressed.
+///
+/// Baskets larger than `size` bytes are split into several independently
+/// compressed records, which is the format that is used anyway for baskets
+/// larger than kMAXZIPBUF (16 MB) and that can be read by any version of ROOT.
+/// When implicit multi-threading is enabled, the chunks of a basket are
+/// compressed in parallel, which speeds up the flushing of trees whose volume
+/// is dominated by a single large (e.g. non-split) branch.  Smaller chunks
+/// result in a lower compression ratio; sizes of the order of a few hundred
+/// kilobytes are a reasonable compromise.
+///
+/// A size of 0 (the default) restores the default of kMAXZIPBUF; larger
+/// values are capped to kMAXZIPBUF.
+
+void TTree::SetCompressionChunkSize(Int_t size)
+{
+   if (size < 0) {
+      Error("SetCompressionChunkSize", "Invalid chunk size %d", size);
+      return;
+   }
+   fCompressionChunkSize = (size > kMAXZIPBUF) ? Int_t(kMAXZIPBUF) : size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the debug level and the debug range.
 ///
@@ -9270,6 +9416,36 @@ void TTree::SetPerfStats(TVirtualPerfStats *perf)
    fPerfStats = perf;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Describe how the tree will be read, such that the size of its clusters and the basket sizes of the branches that
+/// will be read are chosen for parallel reads, e.g. by TTreeProcessorMT or RDataFrame, at the next flush of the
+/// baskets; usually the first one, which is decided by the byte goal given to SetAutoFlush. The first cluster keeps
+/// the size decided by SetAutoFlush. See TTree::ApplyReadTargets for the choices, which are reported by
+/// `Print("clusters")`.
+///
+/// \param[in] nThreads the number of threads expected to read the tree
+/// \param[in] branches the comma separated names of the branches expected to be read, which can contain wildcards
+/// (see TRegexp); a branch is also read if its mother matches
+/// \param[in] remote true if the tree is expected to be read from remote storage
+/// \param[in] expectedEntries the expected number of entries of the tree, 0 if unknown
+///
+/// AutoFlush must be enabled. The targets are not persistent.
+
+void TTree::SetReadTargets(Int_t nThreads, const char *branches, Bool_t remote, Long64_t expectedEntries)
+{
+   if (nThreads < 1) {
+      Error("SetReadTargets", "Invalid number of threads %d", nThreads);
+      return;
+   }
+   if (fAutoFlush == 0)
+      Warning("SetReadTargets", "AutoFlush is disabled, the read targets have no effect");
+   fReadThreads = nThreads;
+   fReadBranches = branches;
+   fReadRemote = remote;
+   fReadExpectedEntries = expectedEntries;
+   fReadClusterBytes = -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The current TreeIndex is replaced by the new index.
 /// Note that this function does not delete the previous index.
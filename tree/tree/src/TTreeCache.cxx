@@ -75,6 +75,9 @@ The user can change the size of the cache with the TTree::SetCacheSize method
 environment variable `ROOT_TTREECACHE_SIZE` or the TTreeCache.Size option.
 The entry range for which the cache is active can also be set with the
 SetEntryRange method.
+The buffers of the caches are accounted for in the ROOT::Experimental::RMemoryBudget.
+If a memory limit is set and the budget is under pressure, the cache is filled
+with the baskets of one cluster at a time.
 
 \anchor changesbehaviour
 ## Changes of behavior when using TChain and TEventList
@@ -105,6 +108,8 @@ The learning period is stopped (and prefetching is started) when:
      The 'learning range is from fEntryMin (default to 0) to
      fEntryMin + fgLearnEntries.
    - A 'cached' TChain switches over to a new file.
+   - The result of the learning phase of a previous job is loaded with
+     TTreeCache::LoadTraining, see also TTreeCache::SaveTraining.
 
 
 \anchor cachemisses
@@ -299,10 +304,35 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "ROOT/RMemoryBudget.hxx"
 #include <limits.h>
 
 Int_t TTreeCache::fgLearnEntries = 100;
 
+namespace {
+
+/// Return the training file from the environment or resource variable, or an empty string
+TString GetConfiguredTrainingFile()
+{
+   const char *stcp = gSystem->Getenv("ROOT_TTREECACHE_TRAINING");
+   if (!stcp || !*stcp)
+      stcp = gEnv->GetValue("TTreeCache.Training", "");
+   return stcp;
+}
+
+/// Return the prefix of the resource names under which the training of `treename` is stored
+TString GetTrainingPrefix(const char *key, const char *treename)
+{
+   TString prefix;
+   if (key && *key)
+      prefix.Form("%s.%s.", key, treename);
+   else
+      prefix.Form("%s.", treename);
+   return prefix;
+}
+
+} // anonymous namespace
+
 ClassImp(TTreeCache);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +352,10 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
    fBranches = new TObjArray(nleaves);
+
+   fTrainingFile = GetConfiguredTrainingFile();
+   if (!fTrainingFile.IsNull() && !gSystem->AccessPathName(fTrainingFile))
+      LoadTraining(fTrainingFile);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1128,6 +1162,8 @@ Bool_t TTreeCache::FillBuffer()
             // the process of filling both prefetching buffers
             StopLearningPhase();
             fIsManual = kFALSE;
+            if (!fTrainingFile.IsNull() && !fTrainingLoaded)
+               SaveTraining(fTrainingFile);
          }
       }
       if (fIsLearning) { //  Learning mode
@@ -1701,8 +1737,10 @@ Bool_t TTreeCache::FillBuffer()
       // be 'large' (i.e. 30Mb * 300 intervals) and can overflow the numerical limit of Int_t (i.e. become
       // artificially negative).   To avoid this issue we promote ntotCurrentBuf to a long long (64 bits rather than 32
       // bits)
+      // Under memory pressure (see ROOT::Experimental::RMemoryBudget), only one cluster is prefetched at a time.
       if (!((fBufferSizeMin > ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations) &&
-            (prevNtot < ntotCurrentBuf) && (minEntry < fEntryMax))) {
+            (prevNtot < ntotCurrentBuf) && (minEntry < fEntryMax)) ||
+          ROOT::Experimental::RMemoryBudget::IsUnderPressure()) {
          if (showMore || gDebug > 6)
             Info("FillBuffer", "Breaking because %d <= %lld || (%d >= %d) || %lld >= %lld", fBufferSizeMin,
                  ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations, prevNtot, ntotCurrentBuf,
@@ -2301,3 +2339,78 @@ void TTreeCache::LearnPrefill()
 
    fLearnPrefilling = kFALSE;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load the set of branches and the read direction saved by SaveTraining() for
+/// the current tree and stop the learning phase, such that the cache prefetches
+/// the right baskets from the first entry on.  Branches not found in the current
+/// tree are ignored.
+///
+/// Returns:
+///  - the number of branches added to the cache
+///  - -1 if the file cannot be read or has no training for this tree and key
+
+Int_t TTreeCache::LoadTraining(const char *filename, const char *key /* = "" */)
+{
+   if (!fTree)
+      return -1;
+
+   TEnv env;
+   if (env.ReadFile(filename, kEnvLocal) < 0)
+      return -1;
+   const TString prefix = GetTrainingPrefix(key, fTree->GetName());
+   TString branchNames = env.GetValue(prefix + "Branches", "");
+   if (branchNames.IsNull())
+      return -1;
+
+   Int_t nbranches = 0;
+   TObjArray *tokens = branchNames.Tokenize(" ");
+   for (Int_t i = 0; i < tokens->GetEntriesFast(); ++i) {
+      TBranch *b = fTree->GetBranch(tokens->UncheckedAt(i)->GetName());
+      if (b && AddBranch(b) == 0)
+         ++nbranches;
+   }
+   delete tokens;
+
+   if (env.GetValue(prefix + "ReverseRead", 0)) {
+      fReverseRead = kTRUE;
+      fReadDirectionSet = kTRUE;
+   }
+   fTrainingLoaded = kTRUE;
+   StopLearningPhase();
+   return nbranches;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the set of branches in the cache and the read direction for the current
+/// tree into the text file `filename`, to be loaded by LoadTraining() in a later
+/// job.  The optional `key`, e.g. the name of the analysis, allows for storing
+/// several trainings for the same tree in one file; the trainings of other
+/// trees and keys already in the file are preserved.
+///
+/// If the file is set through the TTreeCache.Training resource or the
+/// ROOT_TTREECACHE_TRAINING environment variable, automatically created caches
+/// load the training from it and, if there is none yet, save it at the end of
+/// the learning phase.
+///
+/// Returns 0 on success and -1 on error.
+
+Int_t TTreeCache::SaveTraining(const char *filename, const char *key /* = "" */) const
+{
+   if (!fTree || fNbranches <= 0)
+      return -1;
+
+   TEnv env;
+   if (!gSystem->AccessPathName(filename))
+      env.ReadFile(filename, kEnvLocal);
+   const TString prefix = GetTrainingPrefix(key, fTree->GetName());
+   TString branchNames;
+   for (Int_t i = 0; i < fNbranches; ++i) {
+      if (i > 0)
+         branchNames += " ";
+      branchNames += fBranches->UncheckedAt(i)->GetName();
+   }
+   env.SetValue(prefix + "Branches", branchNames);
+   env.SetValue(prefix + "ReverseRead", (fReadDirectionSet && fReverseRead) ? "1" : "0");
+   return env.WriteFile(filename);
+}
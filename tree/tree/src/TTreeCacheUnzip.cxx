@@ -27,6 +27,7 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "ROOT/RIOMetrics.hxx"
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
@@ -715,6 +716,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                }
 
                fNFound++;
+               ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kCacheHits, 1);
                return fUnzipState.fUnzipLen[seekidx];
             }
 
@@ -764,6 +766,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
             }
 
             fNStalls++;
+            ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kCacheHits, 1);
             return fUnzipState.fUnzipLen[seekidx];
          } else {
             // This is a complete miss. We want to avoid the background tasks
@@ -788,6 +791,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
       }
    }
 
+   // Not found among the unzipped baskets
+   ROOT::Experimental::RIOMetrics::Add(ROOT::Experimental::RIOMetrics::kCacheMisses, 1);
    res = 0;
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
       // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
@@ -852,6 +857,7 @@ void TTreeCacheUnzip::SetUnzipBufferSize(Long64_t bufferSize)
 
 Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
 {
+   ROOT::Experimental::RIOMetrics::RTimer unzipTimer(ROOT::Experimental::RIOMetrics::kUnzipTime);
    Int_t  uzlen = 0;
    Bool_t alloc = kFALSE;
 
@@ -34,9 +34,17 @@ Class implementing or helping  the various TTree cloning method
 #include "TLeafC.h"
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
+#include "TROOT.h"
 #include "snprintf.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -508,271 +516,182 @@ void TTreeCloner::CopyStreamerInfos()
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Transfer the basket from the input file to the output file
+/// Read the j-th basket to be transferred from the input file into basket.
+/// Only the input file and the input branches are accessed.
 
-void TTreeCloner::CopyMemoryBaskets()
+void TTreeCloner::LoadBasket(UInt_t j, TBasket *basket, UInt_t &notCached)
 {
-   if (IsInPlace())
-      return;
+   TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+   TFile *fromfile = from->GetFile(0);
+   Int_t index = fBasketNum[ fBasketIndex[j] ];
+   Long64_t pos = from->GetBasketSeek(index);
 
-   TBasket *basket = 0;
-   for(Int_t i=0; i<fToBranches.GetEntriesFast(); ++i) {
-      TBranch *from = (TBranch*)fFromBranches.UncheckedAt( i );
-      TBranch *to   = (TBranch*)fToBranches.UncheckedAt( i );
-
-      basket = (!from->GetListOfBaskets()->IsEmpty()) ? from->GetBasket(from->GetWriteBasket()) : 0;
-      if (basket && basket->GetNevBuf()) {
-         basket = (TBasket*)basket->Clone();
-         basket->SetBranch(to);
-         to->AddBasket(*basket, kFALSE, fToStartEntries+from->GetBasketEntry()[from->GetWriteBasket()]);
-      } else {
-         to->AddLastBasket(  fToStartEntries+from->GetBasketEntry()[from->GetWriteBasket()] );
-      }
-      // In older files, if the branch is a TBranchElement non-terminal 'object' branch, it's basket will contain 0
-      // events, in newer file in the same case, the write basket will be missing.
-      if (from->GetEntries()!=0 && from->GetWriteBasket()==0 && (basket==0 || basket->GetNevBuf()==0)) {
-         to->SetEntries(to->GetEntries()+from->GetEntries());
-      }
+   if (fFileCache && j >= notCached) {
+      notCached = FillCache(notCached);
+   }
+   if (from->GetBasketBytes()[index] == 0) {
+      from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
    }
+   Int_t len = from->GetBasketBytes()[index];
+
+   basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
+   basket->IncrementPidOffset(fPidOffset);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Make sure that all the needed TStreamerInfo are
-/// present in the output file
+/// Write the j-th basket, previously read by LoadBasket, to the output file.
+/// Only the output file and the output branches are modified.
 
-void TTreeCloner::CopyProcessIds()
+void TTreeCloner::StoreBasket(UInt_t j, TBasket *basket)
 {
-   // NOTE: We actually need to merge the ProcessId somehow :(
-
-   TFile *fromfile = fFromTree->GetDirectory()->GetFile();
-   TFile *tofile = fToFile;
-
-   fPidOffset = tofile->GetNProcessIDs();
-
-   TIter next(fromfile->GetListOfKeys());
-   TKey *key;
-   TDirectory::TContext cur(fromfile);
-   while ((key = (TKey*)next())) {
-      if (!strcmp(key->GetClassName(),"TProcessID")) {
-         TProcessID *pid = (TProcessID*)key->ReadObjectAny(0);
-         if (!pid) continue;
-
-         //UShort_t out = TProcessID::WriteProcessID(id,tofile);
-         UShort_t out = 0;
-         TObjArray *pids = tofile->GetListOfProcessIDs();
-         Int_t npids = tofile->GetNProcessIDs();
-         Bool_t wasIn = kFALSE;
-         for (Int_t i=0;i<npids;i++) {
-            if (pids->At(i) == pid) {out = (UShort_t)i; wasIn = kTRUE; break;}
-         }
+   TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+   TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+   Int_t index = fBasketNum[ fBasketIndex[j] ];
 
-         if (!wasIn) {
-            TDirectory *dirsav = gDirectory;
-            tofile->cd();
-            tofile->SetBit(TFile::kHasReferences);
-            pids->AddAtAndExpand(pid,npids);
-            pid->IncrementCount();
-            char name[32];
-            snprintf(name,32,"ProcessID%d",npids);
-            pid->Write(name);
-            tofile->IncrementProcessIDs();
-            if (gDebug > 0) {
-               Info("WriteProcessID", "name=%s, file=%s", name, tofile->GetName());
-            }
-            if (dirsav) dirsav->cd();
-            out = (UShort_t)npids;
-         }
-         if (out<fPidOffset) {
-            Error("CopyProcessIDs","Copied %s from %s might already exist!\n",
-                  pid->GetName(),fromfile->GetName());
-         }
-      }
+   basket->CopyTo(fToFile);
+   if (IsInPlace()) {
+      to->fBasketSeek[index] = basket->GetSeekKey();
+   } else {
+      to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Create a TFileCacheRead if it was requested.
+/// Transfer the j-th basket when it was never written to the input file,
+/// i.e. when it is still the in-memory basket of the input branch.
 
-void TTreeCloner::CreateCache()
+void TTreeCloner::CopyUnwrittenBasket(UInt_t j)
 {
-   if (fCacheSize && fFromTree->GetCurrentFile()) {
-      TFile *f = fFromTree->GetCurrentFile();
-      auto prev = fFromTree->GetReadCache(f);
-      if (fFileCache && prev == fFileCache) {
-         return;
-      }
-      fPrevCache = prev;
-      // Remove the previous cache if any.
-      if (prev) f->SetCacheRead(nullptr, fFromTree);
-      // The constructor attach the new cache.
-      fFileCache = new TFileCacheRead(f, fCacheSize, fFromTree);
-   }
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/// Restore the TFileCacheRead to its previous value.
-
-void TTreeCloner::RestoreCache() {
-   if (IsValid() && fFileCache && fFromTree->GetCurrentFile()) {
-      TFile *f = fFromTree->GetCurrentFile();
-      f->SetCacheRead(nullptr,fFromTree); // Remove our file cache.
-      f->SetCacheRead(fPrevCache, fFromTree);
+   TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+   TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+   Int_t index = fBasketNum[ fBasketIndex[j] ];
+
+   TBasket *frombasket = from->GetBasket( index );
+   if (frombasket && frombasket->GetNevBuf()>0) {
+      TBasket *tobasket = (TBasket*)frombasket->Clone();
+      tobasket->SetBranch(to);
+      to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
+      to->FlushOneBasket(to->GetWriteBasket());
    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Set the entries and import the cluster range of the
+/// Transfer the basket from the input file to the output file
+///
+/// When implicit multi-threading is enabled the baskets are written to the
+/// output file by a separate thread, while the next ones are read, see
+/// WriteBasketsConcurrently.
 
-void TTreeCloner::ImportClusterRanges()
+void TTreeCloner::WriteBaskets()
 {
-   if (IsInPlace())
+#ifdef R__USE_IMT
+   if (!IsInPlace() && fMaxBaskets > 1 && ROOT::IsImplicitMTEnabled()) {
+      WriteBasketsConcurrently();
       return;
-
-   // First undo, the external call to SetEntries
-   // We could improve the interface to optional tell the TTreeCloner that the
-   // SetEntries was not done.
-   fToTree->SetEntries(fToTree->GetEntries() - fFromTree->GetTree()->GetEntries());
-
-   fToTree->ImportClusterRanges( fFromTree->GetTree() );
-
-   // This is only updated by TTree::Fill upon seeing a Flush event in TTree::Fill
-   // So we need to propagate (this has also the advantage of turning on the
-   // history recording feature of SetAutoFlush for the next iteration)
-   fToTree->fFlushedBytes += fFromTree->fFlushedBytes;
-
-   fToTree->SetEntries(fToTree->GetEntries() + fFromTree->GetTree()->GetEntries());
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/// Set the TFile cache size to be used.
-/// Note that the default is to use the same size as the default TTreeCache for
-/// the input tree.
-/// \param size Size of the cache. Zero disable the use of the cache.
-
-void TTreeCloner::SetCacheSize(Int_t size)
-{
-   fCacheSize = size;
-   if (IsValid() && fFileCache) {
-      if (fCacheSize == 0 || fCacheSize != fFileCache->GetBufferSize()) {
-         TFile *f = fFromTree->GetCurrentFile();
-         f->SetCacheRead(nullptr,fFromTree);
-         delete fFileCache;
-         fFileCache = nullptr;
-      }
    }
-   // Note if the TFile cache is needed, it will be created at the
-   // beginning of Exec.
-}
+#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/// Sort the basket according to the user request.
+   TBasket *basket = new TBasket();
+   for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
+      TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+      Int_t index = fBasketNum[ fBasketIndex[j] ];
 
-void TTreeCloner::SortBaskets()
-{
-   // Currently this sort __has to__ preserve the order
-   // of basket for each individual branch.
-
-   switch (fCloneMethod) {
-      case kSortBasketsByBranch:
-         // nothing to do, it is already sorted.
-         break;
-      case kSortBasketsByEntry: {
-         for(UInt_t i = 0; i < fMaxBaskets; ++i) { fBasketIndex[i] = i; }
-         std::sort(fBasketIndex, fBasketIndex+fMaxBaskets, CompareEntry( this) );
-         break;
-      }
-      case kSortBasketsByOffset:
-      default: {
-         for(UInt_t i = 0; i < fMaxBaskets; ++i) { fBasketIndex[i] = i; }
-         std::sort(fBasketIndex, fBasketIndex+fMaxBaskets, CompareSeek( this) );
-         break;
+      Long64_t pos = from->GetBasketSeek(index);
+      if (pos != 0) {
+         LoadBasket(j, basket, notCached);
+         StoreBasket(j, basket);
+      } else if (!IsInPlace()) {
+         CopyUnwrittenBasket(j);
       }
    }
+   delete basket;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Fill the file cache with the next set of basket.
+/// Transfer the baskets from the input file to the output file, reading and
+/// writing concurrently.
 ///
-/// \param from index of the first lement of fFromBranches to start caching
-/// \return The index of first element of fFromBranches that is not in the cache
-UInt_t TTreeCloner::FillCache(UInt_t from)
-{
-   if (!fFileCache) return 0;
-   // Reset the cache
-   fFileCache->Prefetch(0, 0);
-   Long64_t size = 0;
-   for (UInt_t j = from; j < fMaxBaskets; ++j) {
-      TBranch *frombr = (TBranch *) fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+/// The calling thread reads the baskets, using the vectored reads of the file
+/// cache, while a dedicated thread writes them to the output file.  The baskets
+/// are written in the same order as by the sequential transfer, such that the
+/// output file is identical.  At most the size of the file cache (and at least
+/// 16 MB) of baskets are held in memory waiting to be written.
 
-
-      Int_t index = fBasketNum[ fBasketIndex[j] ];
-      Long64_t pos = frombr->GetBasketSeek(index);
-      Int_t len = frombr->GetBasketBytes()[index];
-      if (pos && len) {
-         size += len;
-         if (size > fFileCache->GetBufferSize()) {
-            return j;
+void TTreeCloner::WriteBasketsConcurrently()
+{
+   const Long64_t maxPendingBytes = std::max<Long64_t>(fCacheSize, 16 * 1024 * 1024);
+
+   std::mutex mutex;
+   std::condition_variable cond;
+   std::deque<std::pair<UInt_t, TBasket *>> loaded; // Baskets read and waiting to be written, in order
+   std::vector<TBasket *> freeBaskets;
+   std::vector<std::unique_ptr<TBasket>> allBaskets;
+   Long64_t pendingBytes = 0;
+   Bool_t writing = kFALSE;
+   Bool_t done = kFALSE;
+
+   std::thread writer([&]() {
+      while (true) {
+         std::pair<UInt_t, TBasket *> item;
+         {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&] { return done || !loaded.empty(); });
+            if (loaded.empty())
+               return;
+            item = loaded.front();
+            loaded.pop_front();
+            writing = kTRUE;
          }
-         fFileCache->Prefetch(pos,len);
+         const Int_t nbytes = item.second->GetNbytes();
+         StoreBasket(item.first, item.second);
+         {
+            std::lock_guard<std::mutex> lock(mutex);
+            pendingBytes -= nbytes;
+            freeBaskets.push_back(item.second);
+            writing = kFALSE;
+         }
+         cond.notify_all();
       }
-   }
-   return fMaxBaskets;
-}
+   });
 
-////////////////////////////////////////////////////////////////////////////////
-/// Transfer the basket from the input file to the output file
-
-void TTreeCloner::WriteBaskets()
-{
-   TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
-      TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
-
-      TFile *tofile = fToFile;
-      TFile *fromfile = from->GetFile(0);
-
       Int_t index = fBasketNum[ fBasketIndex[j] ];
 
-      Long64_t pos = from->GetBasketSeek(index);
-      if (IsInPlace()) {
-         if (pos != 0) {
-            if (fFileCache && j >= notCached) {
-               notCached = FillCache(notCached);
-            }
-            Int_t len = from->GetBasketBytes()[index];
-            if (len == 0) {
-               len = basket->ReadBasketBytes(pos, fromfile);
-               from->GetBasketBytes()[index] = len;
-            }
-
-            basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
-            basket->IncrementPidOffset(fPidOffset);
-            basket->CopyTo(tofile);
-            to->fBasketSeek[index] = basket->GetSeekKey();
-         }
-      } else if (pos!=0) {
-         if (fFileCache && j >= notCached) {
-            notCached = FillCache(notCached);
-         }
-         if (from->GetBasketBytes()[index] == 0) {
-            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
-         }
-         Int_t len = from->GetBasketBytes()[index];
+      if (from->GetBasketSeek(index) == 0) {
+         // The in-memory basket is flushed to the output file from this thread,
+         // wait for the writer to be idle
+         std::unique_lock<std::mutex> lock(mutex);
+         cond.wait(lock, [&] { return loaded.empty() && !writing; });
+         CopyUnwrittenBasket(j);
+         continue;
+      }
 
-         basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
-         basket->IncrementPidOffset(fPidOffset);
-         basket->CopyTo(tofile);
-         to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
-      } else {
-         TBasket *frombasket = from->GetBasket( index );
-         if (frombasket && frombasket->GetNevBuf()>0) {
-            TBasket *tobasket = (TBasket*)frombasket->Clone();
-            tobasket->SetBranch(to);
-            to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
-            to->FlushOneBasket(to->GetWriteBasket());
+      TBasket *basket = nullptr;
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         cond.wait(lock, [&] { return pendingBytes < maxPendingBytes || loaded.empty(); });
+         if (freeBaskets.empty()) {
+            allBaskets.emplace_back(new TBasket());
+            basket = allBaskets.back().get();
+         } else {
+            basket = freeBaskets.back();
+            freeBaskets.pop_back();
          }
       }
+      LoadBasket(j, basket, notCached);
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         pendingBytes += basket->GetNbytes();
+         loaded.emplace_back(j, basket);
+      }
+      cond.notify_all();
    }
-   delete basket;
+
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      done = kTRUE;
+   }
+   cond.notify_all();
+   writer.join();
 }
@@ -55,7 +55,9 @@ TTreeSQL::TTreeSQL(TSQLServer *server, TString DB, const TString& table) :
    fResult(0), fRow(0),
    fServer(server),
    fBranchChecked(kFALSE),
-   fTableInfo(0)
+   fTableInfo(0),
+   fInsertBatchSize(1),
+   fNPendingInserts(0)
 {
    fCurrentEntry = -1;
    fQuery = TString("Select * from " + fTable);
@@ -565,7 +567,10 @@ void TTreeSQL::Init()
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Copy the information from the user object to the TTree
+/// Copy the information from the user object to the TTree.
+/// With an insert batch size larger than one, the row is appended to a multi-row
+/// INSERT statement which is sent to the database once it holds that many rows,
+/// see SetInsertBatchSize.
 
 Int_t TTreeSQL::Fill()
 {
@@ -604,6 +609,17 @@ Int_t TTreeSQL::Fill()
    if (fInsertQuery[fInsertQuery.Length()-1]!='(') {
       fInsertQuery.Remove(fInsertQuery.Length()-1);
       fInsertQuery += ")";
+      if (fInsertBatchSize > 1) {
+         if (fNPendingInserts == 0) {
+            fPendingInserts = fInsertQuery;
+         } else {
+            const Ssiz_t start = fInsertQuery.Index(" VALUES (") + 8;
+            fPendingInserts += ",";
+            fPendingInserts += fInsertQuery(start, fInsertQuery.Length() - start);
+         }
+         if (++fNPendingInserts < fInsertBatchSize) return 0;
+         return FlushInserts();
+      }
       TSQLResult *res = fServer?fServer->Query(fInsertQuery):0;
 
       if (res) {
@@ -613,6 +629,25 @@ Int_t TTreeSQL::Fill()
    return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Send the rows filled since the last batch to the database with a single
+/// INSERT statement. Returns the row count reported by the server, 0 if no
+/// row was pending and -1 if the query failed.
+
+Int_t TTreeSQL::FlushInserts()
+{
+   if (fNPendingInserts == 0 || fServer == 0) return 0;
+
+   fNPendingInserts = 0;
+   TSQLResult *res = fServer->Query(fPendingInserts);
+   fPendingInserts = "";
+   if (!res) return -1;
+
+   Int_t nrows = res->GetRowCount();
+   delete res;
+   return nrows;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a vector of columns index corresponding to the
 /// current SQL table and the branch given as argument
@@ -691,6 +726,7 @@ Long64_t  TTreeSQL::GetEntries() const
    if (!CheckTable(fTable.Data())) return 0;
 
    TTreeSQL* thisvar = const_cast<TTreeSQL*>(this);
+   thisvar->FlushInserts();
 
    // What if the user already started to call GetEntry
    // What about the initial value of fEntries is it really 0?
@@ -748,6 +784,11 @@ Long64_t TTreeSQL::PrepEntry(Long64_t entry)
 {
    if (entry < 0 || entry >= fEntries || fServer==0) return 0;
    fReadEntry = entry;
+   if (fNPendingInserts > 0) {
+      FlushInserts();
+      fCurrentEntry = -1;
+      delete fResult; fResult = 0;
+   }
 
    if(entry == fCurrentEntry) return entry;
 
@@ -796,12 +837,26 @@ Long64_t TTreeSQL::PrepEntry(Long64_t entry)
 void TTreeSQL::Refresh()
 {
    // Note : something to be done?
-   GetEntries(); // Re-load the number of entries
+   GetEntries(); // Flush the pending rows and re-load the number of entries
    fCurrentEntry = -1;
    delete fResult; fResult = 0;
    delete fRow; fRow = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of rows inserted into the database by a single INSERT
+/// statement. Rows are inserted one by one by default; larger batches save the
+/// round trip and the implicit transaction per row, which dominates the export
+/// of large trees. The database has to support multi-row VALUES lists, as do
+/// MySQL, PostgreSQL and SQLite. The pending rows are sent when reading from
+/// the tree, when counting its entries and when the tree is deleted.
+
+void TTreeSQL::SetInsertBatchSize(Int_t n)
+{
+   FlushInserts();
+   fInsertBatchSize = n > 1 ? n : 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset the internal query
 
@@ -816,6 +871,7 @@ void TTreeSQL::ResetQuery()
 
 TTreeSQL::~TTreeSQL()
 {
+   FlushInserts();
    delete fTableInfo;
    delete fResult;
    delete fRow;
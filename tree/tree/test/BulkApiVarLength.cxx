@@ -6,9 +6,11 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
+#include "ROOT/TTreeReaderArrayFast.hxx"
 #include "ROOT/TTreeReaderFast.hxx"
 #include "ROOT/TTreeReaderValueFast.hxx"
 #include "ROOT/TIOFeatures.hxx"
@@ -236,3 +238,178 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, varLengthRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using variable-length bulk APIs.\n");
+
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   EXPECT_TRUE(branchFloat->GetBulkRead().SupportsBulkReadVarLength());
+   EXPECT_FALSE(tree->GetBranch("myLen")->GetBulkRead().SupportsBulkReadVarLength());
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile floatOffsetBuf(TBuffer::kWrite, 1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleOffsetBuf(TBuffer::kWrite, 1024);
+
+   sw.Start();
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntriesVarLength(evt_idx, floatBuf, floatOffsetBuf);
+      ASSERT_GT(count, 0);
+      auto countDouble = branchDouble->GetBulkRead().GetBulkEntriesVarLength(evt_idx, doubleBuf, doubleOffsetBuf);
+      ASSERT_GT(countDouble, 0);
+      // Baskets of the two branches are not aligned, continue with the shorter range
+      count = std::min(count, countDouble);
+
+      auto float_buf = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      auto float_offsets = reinterpret_cast<Int_t*>(floatOffsetBuf.GetCurrent());
+      auto double_buf = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      auto double_offsets = reinterpret_cast<Int_t*>(doubleOffsetBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Long64_t ev = evt_idx + idx + 1;
+         ASSERT_EQ(ev % 10, float_offsets[idx + 1] - float_offsets[idx]);
+         ASSERT_EQ(ev % 10, double_offsets[idx + 1] - double_offsets[idx]);
+         for (Int_t entry_idx = float_offsets[idx]; entry_idx < float_offsets[idx + 1]; entry_idx++) {
+            if (R__unlikely((ev < 1600000) && (float_buf[entry_idx] != idx_f))) {
+               printf("Incorrect value on float branch: %f, expected %f (event %lld)\n",
+                      float_buf[entry_idx], idx_f, ev);
+               ASSERT_TRUE(false);
+            }
+            idx_f++;
+         }
+         for (Int_t entry_idx = double_offsets[idx]; entry_idx < double_offsets[idx + 1]; entry_idx++) {
+            if (R__unlikely((ev < 1600000) && (double_buf[entry_idx] != idx_d))) {
+               printf("Incorrect value on double branch: %f, expected %f (event %lld)\n",
+                      double_buf[entry_idx], idx_d, ev);
+               ASSERT_TRUE(false);
+            }
+            idx_d++;
+         }
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+   delete hfile;
+
+   sw.Stop();
+   printf("Bulk VarLength API: Successful read of all events.\n");
+   printf("Bulk VarLength API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
+}
+
+TEST_F(BulkApiVariableTest, fastReadArray)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using TTreeReaderFast with arrays.\n");
+
+   ROOT::Experimental::TTreeReaderFast myReader("T", hfile);
+   ROOT::Experimental::TTreeReaderArrayFast<float> myF(myReader, "f");
+   ROOT::Experimental::TTreeReaderArrayFast<double> myD(myReader, "d");
+   myReader.SetEntry(0);
+   ASSERT_EQ(ROOT::Internal::TTreeReaderValueBase::kSetupMatch, myF.GetSetupStatus());
+
+   Long64_t ev = 1;
+   float idx_f = 0;
+   double idx_d = 2;
+
+   sw.Start();
+   for (auto reader_ev : myReader) {
+      (void)reader_ev;
+      ASSERT_EQ(static_cast<size_t>(ev % 10), myF.size());
+      ASSERT_EQ(static_cast<size_t>(ev % 10), myD.size());
+      for (auto f : myF) {
+         if (R__unlikely((ev < 1600000) && (f != idx_f))) {
+            printf("Incorrect value on float branch: %f, expected %f (event %lld)\n", f, idx_f, ev);
+            ASSERT_TRUE(false);
+         }
+         idx_f++;
+      }
+      for (std::size_t idx = 0; idx < myD.size(); idx++) {
+         if (R__unlikely((ev < 1600000) && (myD[idx] != idx_d))) {
+            printf("Incorrect value on double branch: %f, expected %f (event %lld)\n", myD[idx], idx_d, ev);
+            ASSERT_TRUE(false);
+         }
+         idx_d++;
+      }
+      ev++;
+   }
+   ASSERT_EQ(ev, fEventCount + 1);
+   delete hfile;
+
+   sw.Stop();
+   printf("TTreeReaderFast: Successful read of all events.\n");
+   printf("TTreeReaderFast: Total elapsed time (seconds) for array API: %.2f\n", sw.RealTime());
+}
+
+TEST(BulkApiVarLength, StdVector)
+{
+   const std::string fileName = "BulkApiTestStdVector.root";
+   {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree tree("T", "A tree with a std::vector<float> branch");
+      std::vector<float> v;
+      std::vector<Long64_t> vl;
+      tree.Branch("v", &v);
+      tree.Branch("vl", &vl);
+      for (int ev = 0; ev < 50000; ev++) {
+         v.clear();
+         vl.clear();
+         for (int idx = 0; idx < (ev % 5); idx++) {
+            v.push_back(ev + idx);
+            vl.push_back(ev * 10 + idx);
+         }
+         tree.Fill();
+      }
+      tree.Write();
+   }
+
+   TFile f(fileName.c_str());
+   auto tree = f.Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch->GetBulkRead().SupportsBulkReadVarLength());
+   EXPECT_EQ(kFloat_t, branch->GetBulkRead().GetVarLengthType());
+   EXPECT_EQ(kLong64_t, tree->GetBranch("vl")->GetBulkRead().GetVarLengthType());
+
+   TBufferFile valueBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile offsetBuf(TBuffer::kWrite, 1024);
+   // Start in the middle of the first basket
+   Long64_t ev = 3;
+   while (ev < tree->GetEntries()) {
+      auto count = branch->GetBulkRead().GetBulkEntriesVarLength(ev, valueBuf, offsetBuf);
+      ASSERT_GT(count, 0);
+      auto values = reinterpret_cast<float*>(valueBuf.GetCurrent());
+      auto offsets = reinterpret_cast<Int_t*>(offsetBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++, ev++) {
+         ASSERT_EQ(ev % 5, offsets[idx + 1] - offsets[idx]);
+         for (Int_t i = 0; i < offsets[idx + 1] - offsets[idx]; i++)
+            ASSERT_EQ(static_cast<float>(ev + i), values[offsets[idx] + i]);
+      }
+   }
+   EXPECT_EQ(tree->GetEntries(), ev);
+
+   // The branch remains readable through the regular interface
+   std::vector<float> *v = nullptr;
+   tree->SetBranchAddress("v", &v);
+   tree->GetEntry(4);
+   ASSERT_EQ(4u, v->size());
+   EXPECT_EQ(7.f, v->at(3));
+   tree->ResetBranchAddresses();
+   delete v;
+
+   gSystem->Unlink(fileName.c_str());
+}
@@ -1,3 +1,5 @@
+#include "ROOT/InternalTreeUtils.hxx"
+#include "TChain.h"
 #include "TFile.h"
 #include "TROOT.h"
 #include "TSystem.h"
@@ -5,6 +7,9 @@
 
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +33,214 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, chainPrefetchNextFile)
+{
+   ROOT::EnableImplicitMT();
+   const auto treeName = "t";
+   const std::vector<std::string> fileNames{"chainPrefetchNextFile0.root", "chainPrefetchNextFile1.root",
+                                            "chainPrefetchNextFile2.root"};
+   int value = 0;
+   for (const auto &fileName : fileNames) {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree t(treeName, treeName);
+      t.Branch("value", &value);
+      t.SetAutoFlush(10);
+      for (int i = 0; i < 100; ++i, ++value)
+         t.Fill();
+      t.Write();
+   }
+
+   TChain chain(treeName);
+   for (const auto &fileName : fileNames)
+      chain.Add(fileName.c_str());
+   chain.SetPrefetchNextFile();
+   EXPECT_TRUE(chain.GetPrefetchNextFile());
+   int readValue = -1;
+   chain.SetBranchAddress("value", &readValue);
+   for (Long64_t i = 0; i < chain.GetEntries(); ++i) {
+      ASSERT_GT(chain.GetEntry(i), 0);
+      EXPECT_EQ(readValue, i);
+      EXPECT_EQ(chain.GetTreeNumber(), i / 100);
+   }
+
+   // Jumping back invalidates the prefetched file
+   chain.GetEntry(195);
+   chain.GetEntry(20);
+   EXPECT_EQ(readValue, 20);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+TEST(TTreeImplicitMT, chainReadTreeHeaders)
+{
+   ROOT::EnableImplicitMT();
+   const auto treeName = "t";
+   const std::vector<std::string> fileNames{"chainReadTreeHeaders0.root", "chainReadTreeHeaders1.root",
+                                            "chainReadTreeHeaders2.root", "chainReadTreeHeaders3.root"};
+   int value = 0;
+   for (std::size_t i = 0; i < fileNames.size(); ++i) {
+      TFile f(fileNames[i].c_str(), "RECREATE");
+      TTree t(treeName, treeName);
+      t.Branch("value", &value);
+      t.SetAutoFlush(10);
+      for (std::size_t j = 0; j < 25 * i; ++j, ++value)
+         t.Fill();
+      t.Write();
+   }
+
+   // The entries are counted from the headers, without loading any tree
+   TChain chain(treeName);
+   for (const auto &fileName : fileNames)
+      chain.Add(fileName.c_str());
+   EXPECT_EQ(chain.GetEntries(), 150);
+   EXPECT_EQ(chain.GetTreeNumber(), -1);
+   int readValue = -1;
+   chain.SetBranchAddress("value", &readValue);
+   ASSERT_GT(chain.GetEntry(149), 0);
+   EXPECT_EQ(readValue, 149);
+   EXPECT_EQ(chain.GetTreeNumber(), 3);
+
+   const std::vector<std::string> treeNames(fileNames.size(), treeName);
+   const auto headers = ROOT::Internal::TreeUtils::GetTreeHeaderInfos(treeNames, fileNames);
+   ASSERT_EQ(headers.size(), 4u);
+   EXPECT_TRUE(headers[0].fTreeOk);
+   EXPECT_EQ(headers[0].fEntries, 0);
+   EXPECT_TRUE(headers[0].fClusterStarts.empty());
+   EXPECT_EQ(headers[3].fEntries, 75);
+   EXPECT_EQ(headers[3].fClusterStarts, std::vector<Long64_t>({0, 10, 20, 30, 40, 50, 60, 70}));
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+
+   const auto missing = ROOT::Internal::TreeUtils::GetTreeHeaderInfos({treeName}, {"chainReadTreeHeadersNone.root"});
+   EXPECT_FALSE(missing[0].fFileOk);
+}
+
+TEST(TTreeImplicitMT, compressionChunks)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "compressionChunksMT.root";
+   const Int_t chunkSize = 64 * 1024;
+   Long64_t zipBytes = 0;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetCompressionChunkSize(chunkSize);
+      EXPECT_EQ(chunkSize, t.GetCompressionChunkSize());
+      std::vector<double> v;
+      // Not split: the entire vector goes into a single large basket
+      t.Branch("v", &v, 32000, 0);
+      t.SetAutoFlush(10);
+      for (int i = 0; i < 20; ++i) {
+         v.assign(50000, 0.);
+         for (std::size_t j = 0; j < v.size(); ++j)
+            v[j] = i + (j % 100);
+         t.Fill();
+      }
+      t.Write();
+      zipBytes = t.GetZipBytes();
+      EXPECT_LT(zipBytes, t.GetTotBytes());
+   }
+
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      std::vector<double> *v = nullptr;
+      t->SetBranchAddress("v", &v);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         ASSERT_EQ(50000u, v->size());
+         for (std::size_t j = 0; j < v->size(); j += 997)
+            EXPECT_EQ(i + (j % 100), (*v)[j]);
+      }
+      t->ResetBranchAddresses();
+      delete v;
+   }
+
+   // The compressed records do not depend on whether the chunks were compressed in parallel
+   ROOT::DisableImplicitMT();
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetCompressionChunkSize(chunkSize);
+      std::vector<double> v;
+      t.Branch("v", &v, 32000, 0);
+      t.SetAutoFlush(10);
+      for (int i = 0; i < 20; ++i) {
+         v.assign(50000, 0.);
+         for (std::size_t j = 0; j < v.size(); ++j)
+            v[j] = i + (j % 100);
+         t.Fill();
+      }
+      t.Write();
+      EXPECT_EQ(zipBytes, t.GetZipBytes());
+   }
+
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, fastCloneConcurrentWrite)
+{
+   const auto ifileName = "fastCloneConcurrentWriteIn.root";
+   const auto ofileName = "fastCloneConcurrentWriteOut.root";
+   const int nentries = 20000;
+   {
+      TFile f(ifileName, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      double x = 0.;
+      // Small baskets, such that many of them are transferred
+      t.Branch("i", &i, 1000);
+      t.Branch("x", &x, 1000);
+      for (i = 0; i < nentries; ++i) {
+         x = i * 0.5;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   auto cloneTree = [&](bool imt) {
+      if (imt)
+         ROOT::EnableImplicitMT(2);
+      else
+         ROOT::DisableImplicitMT();
+      TFile in(ifileName);
+      auto t = in.Get<TTree>("t");
+      TFile out(ofileName, "RECREATE");
+      auto clone = t->CloneTree(-1, "fast");
+      EXPECT_EQ(nentries, clone->GetEntries());
+      clone->Write();
+      const auto zipBytes = clone->GetZipBytes();
+      ROOT::DisableImplicitMT();
+      return zipBytes;
+   };
+
+   // The output does not depend on whether the baskets were written concurrently
+   const auto zipBytesSeq = cloneTree(false);
+   const auto zipBytesMT = cloneTree(true);
+   EXPECT_EQ(zipBytesSeq, zipBytesMT);
+
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      ASSERT_EQ(nentries, t->GetEntries());
+      int i = -1;
+      double x = -1.;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t e = 0; e < nentries; ++e) {
+         ASSERT_GT(t->GetEntry(e), 0);
+         EXPECT_EQ(e, i);
+         EXPECT_DOUBLE_EQ(e * 0.5, x);
+      }
+      t->ResetBranchAddresses();
+   }
+
+   gSystem->Unlink(ifileName);
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
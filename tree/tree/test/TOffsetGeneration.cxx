@@ -203,3 +203,40 @@ TEST_F(TOffsetGeneration, elementsTest)
 
    ASSERT_TRUE(br->GetTotalSize() < fEventCount * 10);
 }
+
+TEST_F(TOffsetGeneration, disabledCountBranch)
+{
+   // The offsets are generated from the count leaf even if its branch is not read
+   std::unique_ptr<TFile> file(new TFile("TOffsetGeneration5.root"));
+   auto tree = static_cast<TTree *>(file->Get("tree"));
+   tree->SetBranchStatus("*", false);
+   tree->SetBranchStatus("sample2", true);
+   auto br = tree->GetBranch("sample2");
+   Int_t sample[10];
+   br->SetAddress(sample);
+   auto basket = br->GetBasket(0);
+   Int_t *offsetArray = basket->GetEntryOffset();
+   ASSERT_TRUE(offsetArray);
+   for (Int_t idx = 1; idx < 10; idx++)
+      EXPECT_EQ(offsetArray[idx] - offsetArray[idx - 1], (idx - 1) * 4);
+
+   for (Long64_t entry = 0; entry < tree->GetEntries(); entry++)
+      EXPECT_EQ(br->GetEntry(entry), entry * 4);
+}
+
+TEST_F(TOffsetGeneration, multipleBaskets)
+{
+   std::unique_ptr<TFile> file(new TFile("TOffsetGeneration1.root"));
+   auto tree = static_cast<TTree *>(file->Get("tree"));
+   auto br = tree->GetBranch("sample");
+   ASSERT_GT(br->GetWriteBasket(), 10);
+   Int_t sample[10];
+   br->SetAddress(sample);
+   // Start in the middle of a basket other than the first one
+   br->GetEntry(fEventCount / 2 + 3);
+   auto basket = br->GetBasket(br->GetReadBasket());
+   Int_t *offsetArray = basket->GetEntryOffset();
+   ASSERT_TRUE(offsetArray);
+   for (Int_t idx = 1; idx < basket->GetNevBuf(); idx++)
+      EXPECT_EQ(offsetArray[idx] - offsetArray[idx - 1], 4);
+}
@@ -0,0 +1,66 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+TEST(TTreeCache, Training)
+{
+   const auto fileName = "ttreecache_training.root";
+   const auto trainingName = "ttreecache_training.txt";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int a = 0, b = 0, c = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.Branch("c", &c);
+      t.SetAutoFlush(100);
+      for (int i = 0; i < 1000; ++i) {
+         a = b = c = i;
+         t.Fill();
+      }
+      t.Write();
+   }
+   gSystem->Unlink(trainingName);
+
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      TTreeCache::SetLearnEntries(10);
+      t->SetCacheSize(1000000);
+      auto cache = t->GetReadCache(&f);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_EQ(cache->SaveTraining(trainingName), -1); // nothing learned yet
+      auto ba = t->GetBranch("a");
+      auto bc = t->GetBranch("c");
+      for (Long64_t i = 0; i < 100; ++i) {
+         t->LoadTree(i);
+         ba->GetEntry(i);
+         bc->GetEntry(i);
+      }
+      EXPECT_FALSE(cache->IsLearning());
+      EXPECT_EQ(cache->SaveTraining(trainingName), 0);
+      EXPECT_EQ(cache->SaveTraining(trainingName, "other"), 0);
+   }
+
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(1000000);
+      auto cache = t->GetReadCache(&f);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_EQ(cache->LoadTraining(trainingName, "unknown"), -1);
+      EXPECT_TRUE(cache->IsLearning());
+      EXPECT_EQ(cache->LoadTraining(trainingName), 2);
+      EXPECT_FALSE(cache->IsLearning());
+      ASSERT_EQ(cache->GetCachedBranches()->GetEntriesFast(), 2);
+      EXPECT_STREQ(cache->GetCachedBranches()->At(0)->GetName(), "a");
+      EXPECT_STREQ(cache->GetCachedBranches()->At(1)->GetName(), "c");
+   }
+
+   TTreeCache::SetLearnEntries(100);
+   gSystem->Unlink(trainingName);
+   gSystem->Unlink(fileName);
+}
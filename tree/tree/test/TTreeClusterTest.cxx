@@ -1,4 +1,5 @@
 #include "TFile.h"
+#include "TMemFile.h"
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
@@ -53,3 +54,33 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+// The clusters after the first one and the baskets of the read branches are sized for the read targets
+TEST(TTreeClusterTest, readTargets)
+{
+   TMemFile file("TTreeClusterTestReadTargets.root", "RECREATE");
+   TTree tree("tree", "A test tree with read targets");
+   tree.SetAutoFlush(-100000);
+   tree.SetReadTargets(4, "x", kFALSE, 1000000);
+   TRandom random(836);
+   Double_t x = 0;
+   Double_t y = 0;
+   auto branchX = tree.Branch("x", &x);
+   auto branchY = tree.Branch("y", &y);
+   for (Int_t ev = 0; ev < 20000; ++ev) {
+      x = random.Gaus(100, 7);
+      y = random.Gaus(100, 7);
+      tree.Fill();
+   }
+
+   // the first cluster was decided by the byte goal
+   ASSERT_GT(tree.GetAutoFlush(), 0);
+   TTree::TClusterIterator clusters = tree.GetClusterIterator(0);
+   const Long64_t firstCluster = clusters.Next() == 0 ? clusters.GetNextEntry() : -1;
+   EXPECT_GT(firstCluster, 0);
+   EXPECT_LT(firstCluster, 20000);
+   EXPECT_GT(tree.GetAutoFlush(), firstCluster);
+   // one basket per cluster for the read branch
+   EXPECT_GE(branchX->GetBasketSize(), tree.GetAutoFlush() * Long64_t(sizeof(Double_t)));
+   EXPECT_LT(branchY->GetBasketSize(), branchX->GetBasketSize());
+}
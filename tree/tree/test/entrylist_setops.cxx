@@ -0,0 +1,114 @@
+#include "TEntryList.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+namespace {
+
+// Entries with a mix of densities, such that the blocks use all the representations:
+// sparse lists, bits, and lists of the entries that don't pass
+std::set<Long64_t> MakeEntries(Long64_t nBlocks, Long64_t offset)
+{
+   std::set<Long64_t> entries;
+   for (Long64_t b = 0; b < nBlocks; ++b) {
+      const Long64_t first = b * TEntryList::kBlockSize;
+      const Long64_t step = (b + offset) % 3 == 0 ? 97 : ((b + offset) % 3 == 1 ? 3 : 1);
+      for (Long64_t e = first + offset; e < first + TEntryList::kBlockSize; e += step) {
+         if (step == 1 && (e % 1013) == 0)
+            continue;
+         entries.insert(e);
+      }
+   }
+   return entries;
+}
+
+void FillList(TEntryList &elist, const std::set<Long64_t> &entries)
+{
+   for (auto e : entries)
+      elist.Enter(e);
+   elist.OptimizeStorage();
+}
+
+void ExpectEqual(TEntryList &elist, const std::set<Long64_t> &entries)
+{
+   ASSERT_EQ(Long64_t(entries.size()), elist.GetN());
+   Long64_t i = 0;
+   for (auto e : entries) {
+      ASSERT_EQ(e, elist.GetEntry(i));
+      ++i;
+   }
+}
+
+void TestSetOperations(Long64_t nBlocks)
+{
+   const auto entries1 = MakeEntries(nBlocks, 0);
+   const auto entries2 = MakeEntries(nBlocks + 1, 5);
+
+   std::set<Long64_t> unionRef, intersectionRef, differenceRef;
+   std::set_union(entries1.begin(), entries1.end(), entries2.begin(), entries2.end(),
+                  std::inserter(unionRef, unionRef.end()));
+   std::set_intersection(entries1.begin(), entries1.end(), entries2.begin(), entries2.end(),
+                         std::inserter(intersectionRef, intersectionRef.end()));
+   std::set_difference(entries1.begin(), entries1.end(), entries2.begin(), entries2.end(),
+                       std::inserter(differenceRef, differenceRef.end()));
+
+   TEntryList elist2;
+   FillList(elist2, entries2);
+
+   TEntryList unionList;
+   FillList(unionList, entries1);
+   unionList.Add(&elist2);
+   ExpectEqual(unionList, unionRef);
+
+   TEntryList intersectionList;
+   FillList(intersectionList, entries1);
+   intersectionList.Intersect(&elist2);
+   ExpectEqual(intersectionList, intersectionRef);
+
+   TEntryList differenceList;
+   FillList(differenceList, entries1);
+   differenceList.Subtract(&elist2);
+   ExpectEqual(differenceList, differenceRef);
+}
+
+} // anonymous namespace
+
+TEST(TEntryList, SetOperations)
+{
+   TestSetOperations(6);
+}
+
+#ifdef R__USE_IMT
+TEST(TEntryList, SetOperationsMT)
+{
+   ROOT::EnableImplicitMT(4);
+   // Enough blocks to be split over several tasks
+   TestSetOperations(70);
+   ROOT::DisableImplicitMT();
+}
+#endif
+
+TEST(TEntryList, GetNBefore)
+{
+   const auto entries = MakeEntries(6, 3);
+   TEntryList elist;
+   FillList(elist, entries);
+
+   std::vector<Long64_t> queries;
+   for (Long64_t e = -1; e < 7 * TEntryList::kBlockSize; e += 4099)
+      queries.push_back(e);
+   queries.push_back(7 * TEntryList::kBlockSize);
+
+   std::vector<Long64_t> nbefore(queries.size());
+   elist.GetNBefore(queries.size(), queries.data(), nbefore.data());
+   for (std::size_t i = 0; i < queries.size(); ++i) {
+      const auto expected = std::distance(entries.begin(), entries.lower_bound(queries[i]));
+      EXPECT_EQ(expected, nbefore[i]);
+      EXPECT_EQ(expected, elist.GetNBefore(queries[i]));
+   }
+}
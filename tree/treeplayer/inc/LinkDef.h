@@ -19,6 +19,7 @@
 #pragma link C++ class TSelectorEntries;
 #pragma link C++ class TFileDrawMap+;
 #pragma link C++ class TTreeIndex-;
+#pragma link C++ class TTreeIndexMapped-;
 #pragma link C++ class TChainIndex+;
 #pragma link C++ class TChainIndex::TChainIndexEntry+;
 #pragma link C++ class TTreeFormulaManager;
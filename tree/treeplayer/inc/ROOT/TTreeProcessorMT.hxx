@@ -60,6 +60,8 @@ class TTreeView {
    // NOTE: fFriends and fEntryList MUST come before fChain to be deleted after it, because neither friend trees nor
    // entrylists are deregistered from the main tree at destruction (ROOT-9283 tracks the issue for friends).
    std::unique_ptr<TChain> fChain; ///< Chain on which to operate
+   /// Reader of fChain, redirected to the entry range of each task. Must come after fChain to be deleted before it.
+   std::unique_ptr<TTreeReader> fReader;
 
    void MakeChain(const std::vector<std::string> &treeName, const std::vector<std::string> &fileNames,
                   const ROOT::TreeUtils::RFriendInfo &friendInfo, const std::vector<Long64_t> &nEntries,
@@ -69,11 +71,10 @@ public:
    TTreeView() = default;
    // no-op, we don't want to copy the local TChains
    TTreeView(const TTreeView &) {}
-   std::unique_ptr<TTreeReader> GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::string> &treeName,
-                                              const std::vector<std::string> &fileNames,
-                                              const ROOT::TreeUtils::RFriendInfo &friendInfo,
-                                              const TEntryList &entryList, const std::vector<Long64_t> &nEntries,
-                                              const std::vector<std::vector<Long64_t>> &friendEntries);
+   TTreeReader &GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::string> &treeName,
+                              const std::vector<std::string> &fileNames, const ROOT::TreeUtils::RFriendInfo &friendInfo,
+                              const TEntryList &entryList, const std::vector<Long64_t> &nEntries,
+                              const std::vector<std::vector<Long64_t>> &friendEntries);
    void Reset();
 };
 } // End of namespace Internal
@@ -93,6 +94,7 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static unsigned int fgFilesOpenedAhead;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
@@ -110,6 +112,8 @@ public:
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetFilesOpenedAhead(unsigned int nFiles);
+   static unsigned int GetFilesOpenedAhead();
 };
 
 } // End of namespace ROOT
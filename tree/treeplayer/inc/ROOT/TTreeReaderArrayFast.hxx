@@ -0,0 +1,82 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeReaderArrayFast
+#define ROOT_TTreeReaderArrayFast
+
+
+////////////////////////////////////////////////////////////////////////////
+//                                                                        //
+// TTreeReaderArrayFast                                                   //
+//                                                                        //
+// A simple interface for reading variable-length arrays of fundamental   //
+// types, such as `x[n]/F` leaves or std::vector<float> branches, in bulk //
+//                                                                        //
+////////////////////////////////////////////////////////////////////////////
+
+#include "ROOT/TTreeReaderValueFast.hxx"
+
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TDataType.h"
+
+#include <cstddef>
+#include <typeinfo>
+
+namespace ROOT {
+namespace Experimental {
+
+template <typename T>
+class TTreeReaderArrayFast final : public ROOT::Experimental::Internal::TTreeReaderValueFastBase {
+
+   public:
+
+      TTreeReaderArrayFast(TTreeReaderFast& tr, const std::string &branchname) :
+            TTreeReaderValueFastBase(&tr, branchname) {}
+
+      std::size_t size() const { return GetOffsets()[fEvtIndex + 1] - GetOffsets()[fEvtIndex]; }
+      bool empty() const { return size() == 0; }
+      T* begin() { return GetValues() + GetOffsets()[fEvtIndex]; }
+      T* end() { return GetValues() + GetOffsets()[fEvtIndex + 1]; }
+      T& operator[](std::size_t idx) { return begin()[idx]; }
+
+   protected:
+      virtual const char *GetTypeName() override {return "array";}
+      virtual const char *BranchTypeName() override {return "array";}
+      virtual UInt_t GetSize() override {return sizeof(T);}
+
+      // The values are contiguous and already deserialized by TBranch::GetBulkEntriesVarLength(); the offsets
+      // buffer holds one more element than there are events.
+      virtual Int_t ReadBulk(Long64_t eventNum) override {
+         if (R__unlikely(fBranch->GetBulkRead().GetVarLengthType() != TDataType::GetType(typeid(T)))) {
+            Error("TTreeReaderArrayFast::ReadBulk()", "Branch %s cannot be read in bulk as an array of the requested type",
+                  fBranchName.c_str());
+            return -1;
+         }
+         return fBranch->GetBulkRead().GetBulkEntriesVarLength(eventNum, fBuffer, fOffsetBuffer);
+      }
+
+      // Only the offsets are per event, the values buffer stays as is.
+      virtual Int_t Adjust(Int_t eventCount) override {
+         fOffsetBuffer.SetBufferOffset(fOffsetBuffer.Length() + eventCount*sizeof(Int_t));
+         return 0;
+      }
+
+   private:
+      const Int_t *GetOffsets() const { return reinterpret_cast<const Int_t *>(fOffsetBuffer.GetCurrent()); }
+      T *GetValues() { return reinterpret_cast<T *>(fBuffer.Buffer()); }
+
+      TBufferFile  fOffsetBuffer{TBuffer::kWrite, 1024}; // Offsets of the events' values in fBuffer.
+};
+
+}  // Experimental
+}  // ROOT
+
+#endif // ROOT_TTreeReaderArrayFast
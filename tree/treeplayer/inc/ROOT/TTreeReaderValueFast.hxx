@@ -66,7 +66,7 @@ class TTreeReaderValueFastBase {
              }
              fRemaining -= adjust;
           } else {
-             fRemaining = fBranch->GetBulkRead().GetEntriesSerialized(eventNum, fBuffer);
+             fRemaining = ReadBulk(eventNum);
              if (R__unlikely(fRemaining < 0)) {
                 fReadStatus = ROOT::Internal::TTreeReaderValueBase::kReadError;
                 //printf("Failed to retrieve entries from the branch.\n");
@@ -84,6 +84,11 @@ class TTreeReaderValueFastBase {
 
    protected:
 
+      // Read the events of the basket containing eventNum into fBuffer; returns the number of events read.
+      virtual Int_t ReadBulk(Long64_t eventNum) {
+         return fBranch->GetBulkRead().GetEntriesSerialized(eventNum, fBuffer);
+      }
+
       // Adjust the current buffer offset forward N events.
       virtual Int_t Adjust(Int_t eventCount) {
          Int_t bufOffset = fBuffer.Length();
@@ -67,6 +67,7 @@ protected:
    virtual void      ClearFormula();
    virtual Bool_t    CompileVariables(const char *varexp="", const char *selection="");
    virtual void      InitArrays(Int_t newsize);
+   void              InitBuffers();
 
 private:
    TSelectorDraw(const TSelectorDraw&);             // not implemented
@@ -112,6 +113,7 @@ public:
    virtual void      ProcessFill(Long64_t entry);
    virtual void      ProcessFillMultiple(Long64_t entry);
    virtual void      ProcessFillObject(Long64_t entry);
+   Bool_t            ProcessMT(Long64_t firstentry, Long64_t nentries);
    virtual void      SetEstimate(Long64_t n);
    virtual UInt_t    SplitNames(const TString &varexp, std::vector<TString> &names);
    virtual void      TakeAction();
@@ -131,6 +131,17 @@ protected:
 
    RealInstanceCache fRealInstanceCache;              ///<! Cache accelerating the GetRealInstance function
 
+   /// Signature of the compiled operations: computes the results r[0..n-1] of n instances from the values
+   /// v[k*noperands..] of their operands and the constants c of the formula.
+   typedef void (*JitFunc_t)(Int_t n, const Double_t *v, const Double_t *c, Double_t *r);
+
+   JitFunc_t                 fJitFunc;                ///<! Compiled operations of the formula, see JitOperations()
+   std::vector<Int_t>        fJitOperands;            ///<! Operations providing the operands of fJitFunc
+   std::vector<Double_t>     fJitValues;              ///<! Values of the operands of fJitFunc
+   Bool_t                    fJitNeedsFallback;       ///<! True if the formula has boolean optimizations
+
+   static Int_t              fgJitEvaluation;         ///<  See SetJitEvaluation()
+
    TTreeFormula(const char *name, const char *formula, TTree *tree, const std::vector<std::string>& aliases);
    void Init(const char *name, const char *formula);
    Bool_t      BranchHasMethod(TLeaf* leaf, TBranch* branch, const char* method,const char* params, Long64_t readentry) const;
@@ -149,6 +160,11 @@ protected:
    virtual void*     GetValuePointerFromMethod(Int_t i, TLeaf *leaf) const;
    Int_t             GetRealInstance(Int_t instance, Int_t codeindex);
 
+   Bool_t            EvalOperand(Int_t i, Int_t instance, Bool_t willLoad, Double_t &value);
+   Double_t          EvalJitted(Int_t instance);
+   Double_t          EvalInterpreted(Int_t instance, Bool_t willLoad);
+   void              JitOperations();
+
    void              LoadBranches();
    Bool_t            LoadCurrentDim();
    void              ResetDimensions();
@@ -182,6 +198,7 @@ public:
    virtual Long64_t       EvalInstance64(Int_t i=0, const char *stringStack[] = nullptr) {return EvalInstance<Long64_t>(i, stringStack); }
    virtual LongDouble_t   EvalInstanceLD(Int_t i=0, const char *stringStack[] = nullptr) {return EvalInstance<LongDouble_t>(i, stringStack); }
 
+           void        EvalInstances(Int_t n, Double_t *values);
    virtual const char *EvalStringInstance(Int_t i=0);
    virtual void*       EvalObject(Int_t i=0);
    // EvalInstance should be const.  See comment on GetNdata()
@@ -198,12 +215,15 @@ public:
    //the mutable keyword.
    //NOTE: Also modify the code in PrintValue which current goes around this limitation :(
    virtual Bool_t      IsInteger(Bool_t fast=kTRUE) const;
+           Bool_t      IsJitted() const { return fJitFunc != nullptr; }
            Bool_t      IsQuickLoad() const { return fQuickLoad; }
    virtual Bool_t      IsString() const;
    virtual Bool_t      Notify() { UpdateFormulaLeaves(); return kTRUE; }
    virtual char       *PrintValue(Int_t mode=0) const;
    virtual char       *PrintValue(Int_t mode, Int_t instance, const char *decform = "9.9") const;
    virtual void        SetAxis(TAxis *axis = nullptr);
+   static  void        SetJitEvaluation(Bool_t jit = kTRUE);
+   static  Bool_t      GetJitEvaluation();
            void        SetQuickLoad(Bool_t quick) { fQuickLoad = quick; }
    virtual void        SetTree(TTree *tree) {fTree = tree;}
    virtual void        ResetLoading();
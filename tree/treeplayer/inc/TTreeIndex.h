@@ -56,6 +56,8 @@ public:
    Long64_t               FindValues(Long64_t major, Long64_t minor) const;
    virtual Long64_t       GetEntryNumberFriend(const TTree *parent);
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const;
+   void                   GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                                   Long64_t *entries) const;
    virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const;
    virtual Long64_t      *GetIndex()        const {return fIndex;}
    virtual Long64_t      *GetIndexValues()  const {return fIndexValues;}
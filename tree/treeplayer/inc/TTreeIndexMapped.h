@@ -0,0 +1,54 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeIndexMapped
+#define ROOT_TTreeIndexMapped
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TTreeIndexMapped                                                     //
+//                                                                      //
+// A TTreeIndex whose sorted values are memory-mapped from a file.      //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "TTreeIndex.h"
+
+class TTreeIndexMapped : public TTreeIndex {
+
+protected:
+   TString        fFileName;            ///< Name of the file holding the sorted index values
+   void          *fMapping;             ///<! Start of the mapped (or read) file content
+   Long64_t       fMappingSize;         ///<! Size of the mapped file content
+
+   Bool_t         Map(const char *filename);
+   void           Unmap();
+
+private:
+   TTreeIndexMapped(const TTreeIndexMapped&) = delete;            // Not implemented.
+   TTreeIndexMapped &operator=(const TTreeIndexMapped&) = delete; // Not implemented.
+
+public:
+   TTreeIndexMapped();
+   TTreeIndexMapped(const TTree *T, const char *filename);
+   virtual               ~TTreeIndexMapped();
+   virtual void           Append(const TVirtualIndex *,Bool_t delaySort = kFALSE);
+   const char            *GetFileName()     const {return fFileName.Data();}
+   void                   Prefetch() const;
+
+   static Bool_t          Save(const TTreeIndex &index, const char *filename);
+
+   ClassDef(TTreeIndexMapped,1);  //A Tree Index memory-mapped from a file
+};
+
+#endif
+
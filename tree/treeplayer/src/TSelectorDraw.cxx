@@ -28,6 +28,8 @@ A specialized TSelector for TTree::Draw.
 #include "TEnv.h"
 #include "TTree.h"
 #include "TCut.h"
+#include "TChain.h"
+#include "TFile.h"
 #include "TEntryList.h"
 #include "TEventList.h"
 #include "TEntryListArray.h"
@@ -37,9 +39,19 @@ A specialized TSelector for TTree::Draw.
 #include "TColor.h"
 #include "strlcpy.h"
 
+#ifdef R__USE_IMT
+#include "TTreeReader.h"
+#include "ROOT/TTreeProcessorMT.hxx"
+#include <memory>
+#include <mutex>
+#endif
+
 ClassImp(TSelectorDraw);
 
 const Int_t kCustomHistogram = BIT(17);
+#ifdef R__USE_IMT
+const Long64_t kWorkerBufferSize = 10000; // Estimate of the trees processed by the threads in ProcessMT
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default selector constructor.
@@ -908,31 +920,7 @@ void TSelectorDraw::Begin(TTree *tree)
       else            fAction = 6;
    }
    if (varexp) delete[] varexp;
-   for (i = 0; i < fValSize; ++i)
-      fVarMultiple[i] = kFALSE;
-   fSelectMultiple = kFALSE;
-   for (i = 0; i < fDimension; ++i) {
-      if (fVar[i] && fVar[i]->GetMultiplicity()) fVarMultiple[i] = kTRUE;
-   }
-
-   if (fSelect && fSelect->GetMultiplicity()) fSelectMultiple = kTRUE;
-
-   fForceRead = fTree->TestBit(TTree::kForceRead);
-   fWeight  = fTree->GetWeight();
-   fNfill   = 0;
-
-   for (i = 0; i < fDimension; ++i) {
-      if (!fVal[i] && fVar[i]) {
-         fVal[i] = new Double_t[(Int_t)fTree->GetEstimate()];
-      }
-   }
-
-   if (!fW)             fW  = new Double_t[(Int_t)fTree->GetEstimate()];
-
-   for (i = 0; i < fValSize; ++i) {
-      fVmin[i] = DBL_MAX;
-      fVmax[i] = -DBL_MAX;
-   }
+   InitBuffers();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1118,6 +1106,39 @@ void TSelectorDraw::InitArrays(Int_t newsize)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Initialization of the flags and of the buffers used to fill the compiled variables.
+
+void TSelectorDraw::InitBuffers()
+{
+   Int_t i;
+   for (i = 0; i < fValSize; ++i)
+      fVarMultiple[i] = kFALSE;
+   fSelectMultiple = kFALSE;
+   for (i = 0; i < fDimension; ++i) {
+      if (fVar[i] && fVar[i]->GetMultiplicity()) fVarMultiple[i] = kTRUE;
+   }
+
+   if (fSelect && fSelect->GetMultiplicity()) fSelectMultiple = kTRUE;
+
+   fForceRead = fTree->TestBit(TTree::kForceRead);
+   fWeight  = fTree->GetWeight();
+   fNfill   = 0;
+
+   for (i = 0; i < fDimension; ++i) {
+      if (!fVal[i] && fVar[i]) {
+         fVal[i] = new Double_t[(Int_t)fTree->GetEstimate()];
+      }
+   }
+
+   if (!fW)             fW  = new Double_t[(Int_t)fTree->GetEstimate()];
+
+   for (i = 0; i < fValSize; ++i) {
+      fVmin[i] = DBL_MAX;
+      fVmax[i] = -DBL_MAX;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Build Index array for names in varexp.
 /// This will allocated a C style array of TString and Ints
@@ -1337,6 +1358,139 @@ void TSelectorDraw::ProcessFillObject(Long64_t /*entry*/)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram from the entries [firstentry, firstentry + nentries) with
+/// the threads of the implicit multi-threading, instead of the entry loop of
+/// TTreePlayer::Process.
+///
+/// Each thread compiles its own copy of the variables and of the selection on
+/// its own chain of the files of the tree and fills its own clone of the
+/// histogram with TakeAction, and the clones are merged into the histogram
+/// when all the entries are processed. Since the entries are not processed in
+/// order, this is only done for the histograms with fixed limits and axes that
+/// cannot be extended, filled by the actions 1, 2, 3, 4 and 23, and for trees
+/// read from files without aliases, friends, entry lists or global weight.
+///
+/// Return kFALSE, without processing any entry, if the entries have to be
+/// processed sequentially.
+
+Bool_t TSelectorDraw::ProcessMT(Long64_t firstentry, Long64_t nentries)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || nentries <= 0 || fObjEval || fDimension <= 0 || fWeight != 1)
+      return kFALSE;
+   // Without extendable axes, TakeEstimate only fills the histogram for the negative actions 1, 2, 4 and 23
+   const Int_t action = (fAction == 3) ? fAction : TMath::Abs(fAction);
+   if (action != 1 && action != 2 && action != 3 && action != 4 && action != 23)
+      return kFALSE;
+   TH1 *hist = dynamic_cast<TH1 *>(fObject);
+   if (!hist || (action == 3 && hist->TestBit(kCanDelete)) || hist->GetXaxis()->CanExtend() ||
+       hist->GetYaxis()->CanExtend() || hist->GetZaxis()->CanExtend())
+      return kFALSE;
+   if (fTree->GetEntryList() || fTree->GetEventList() || fTree->GetUpdate() ||
+       (fTree->GetListOfAliases() && fTree->GetListOfAliases()->GetSize()) ||
+       (fTree->GetListOfFriends() && fTree->GetListOfFriends()->GetSize()) ||
+       (fTree->InheritsFrom(TChain::Class()) && fTree->TestBit(TChain::kGlobalWeight)))
+      return kFALSE;
+   // The threads read the files: the entries of the tree must all be in read-only files
+   TFile *file = fTree->GetCurrentFile();
+   if (!file || file->IsWritable())
+      return kFALSE;
+
+   TString varexp = fVar[0]->GetTitle();
+   for (Int_t i = 1; i < fDimension; ++i)
+      varexp.Append(":").Append(fVar[i]->GetTitle());
+   const TString selection = fSelect ? fSelect->GetTitle() : "";
+
+   std::unique_ptr<ROOT::TTreeProcessorMT> processor;
+   const std::pair<Long64_t, Long64_t> globalRange(firstentry, firstentry + nentries);
+   try {
+      processor = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, 0u, globalRange);
+   } catch (const std::exception &) {
+      return kFALSE;
+   }
+
+   // The selectors of the threads, each one with its clone of the histogram, the idle ones being in freeWorkers
+   std::vector<std::unique_ptr<TSelectorDraw>> workers;
+   std::vector<std::unique_ptr<TH1>> clones;
+   std::vector<TSelectorDraw *> freeWorkers;
+   std::mutex mutex;
+   Bool_t ok = kTRUE;
+
+   auto processRange = [&](TTreeReader &reader) {
+      TSelectorDraw *worker = nullptr;
+      TTree *tree = reader.GetTree();
+      const auto range = reader.GetEntriesRange();
+      tree->SetEstimate(kWorkerBufferSize);
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (freeWorkers.empty()) {
+            TDirectory::TContext ctxt(nullptr);
+            clones.emplace_back(static_cast<TH1 *>(hist->Clone()));
+            clones.back()->SetDirectory(nullptr);
+            clones.back()->Reset();
+            workers.emplace_back(new TSelectorDraw());
+            workers.back()->fAction = action;
+            workers.back()->fObject = clones.back().get();
+            freeWorkers.push_back(workers.back().get());
+         }
+         worker = freeWorkers.back();
+         freeWorkers.pop_back();
+
+         // The formulas are compiled under the lock, for each new chain processed by the worker
+         if (worker->fTree != tree) {
+            tree->LoadTree(range.first);
+            worker->fTree = tree;
+            if (!worker->CompileVariables(varexp, selection)) {
+               worker->fTree = nullptr;
+               ok = kFALSE;
+               freeWorkers.push_back(worker);
+               return;
+            }
+            worker->InitBuffers();
+         }
+      }
+
+      Int_t treeNumber = -1;
+      for (Long64_t entry = range.first; entry < range.second; ++entry) {
+         const Long64_t localEntry = tree->LoadTree(entry);
+         if (localEntry < 0)
+            break;
+         if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            worker->Notify();
+         }
+         worker->ProcessFill(localEntry);
+      }
+      if (worker->fNfill) {
+         worker->TakeAction();
+         worker->fNfill = 0;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      freeWorkers.push_back(worker);
+   };
+   processor->Process(processRange);
+
+   if (!ok)
+      Error("ProcessMT", "Variable compilation failed in the threads: {%s,%s}", varexp.Data(), selection.Data());
+   TList list;
+   for (auto &worker : workers) {
+      fSelectedRows += worker->fSelectedRows;
+      worker->fObject = nullptr;
+   }
+   for (auto &clone : clones)
+      list.Add(clone.get());
+   hist->Merge(&list);
+   fAction = action;
+   return kTRUE;
+#else
+   (void)firstentry;
+   (void)nentries;
+   return kFALSE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set number of entries to estimate variable limits.
 
@@ -44,6 +44,7 @@
 #include "strlcpy.h"
 #include "snprintf.h"
 #include "TEntryList.h"
+#include "TEnv.h"
 
 #include <cctype>
 #include <cstdio>
@@ -51,6 +52,9 @@
 #include <cstdlib>
 #include <typeinfo>
 #include <algorithm>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 
 const Int_t kMaxLen     = 1024;
 
@@ -94,6 +98,8 @@ The following method are available from the TFormLeafInfo interface:
 
 ClassImp(TTreeFormula);
 
+Int_t TTreeFormula::fgJitEvaluation = -1;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 inline static void R__LoadBranch(TBranch* br, Long64_t entry, Bool_t quickLoad)
@@ -122,7 +128,7 @@ public:
 ////////////////////////////////////////////////////////////////////////////////
 
 TTreeFormula::TTreeFormula(): ROOT::v5::TFormula(), fQuickLoad(kFALSE), fNeedLoading(kTRUE),
-   fDidBooleanOptimization(kFALSE), fDimensionSetup(0)
+   fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fJitFunc(nullptr), fJitNeedsFallback(kFALSE)
 
 {
    // Tree Formula default constructor
@@ -156,7 +162,7 @@ TTreeFormula::TTreeFormula(): ROOT::v5::TFormula(), fQuickLoad(kFALSE), fNeedLoa
 
 TTreeFormula::TTreeFormula(const char *name,const char *expression, TTree *tree)
    :ROOT::v5::TFormula(), fTree(tree), fQuickLoad(kFALSE), fNeedLoading(kTRUE),
-    fDidBooleanOptimization(kFALSE), fDimensionSetup(0)
+    fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fJitFunc(nullptr), fJitNeedsFallback(kFALSE)
 {
    Init(name,expression);
 }
@@ -167,7 +173,8 @@ TTreeFormula::TTreeFormula(const char *name,const char *expression, TTree *tree)
 TTreeFormula::TTreeFormula(const char *name,const char *expression, TTree *tree,
                            const std::vector<std::string>& aliases)
    :ROOT::v5::TFormula(), fTree(tree), fQuickLoad(kFALSE), fNeedLoading(kTRUE),
-    fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fAliasesUsed(aliases)
+    fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fAliasesUsed(aliases), fJitFunc(nullptr),
+    fJitNeedsFallback(kFALSE)
 {
    Init(name,expression);
 }
@@ -315,6 +322,8 @@ void TTreeFormula::Init(const char*name, const char* expression)
 
    }
 
+   if (fNoper > 1 && !IsString() && GetJitEvaluation()) JitOperations();
+
    if(savedir) savedir->cd();
 }
 
@@ -3944,6 +3953,7 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
 // Note that the redundancy and structure in this code is tailored to improve
 // efficiencies.
    if (TestBit(kMissingLeaf)) return 0;
+   if (std::is_same<T, Double_t>::value && fJitFunc) return EvalJitted(instance);
    if (fNoper == 1 && fNcodes > 0) {
 
       switch (fLookupType[0]) {
@@ -4412,6 +4422,323 @@ template double TTreeFormula::EvalInstance<double> (int, char const**);
 template long double TTreeFormula::EvalInstance<long double> (int, char const**);
 template long long TTreeFormula::EvalInstance<long long> (int, char const**);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the operand provided by the operation `i`, a tree variable or an alias, for the instance `instance`.
+/// This duplicates the evaluation of these operations in EvalInstance for the compiled formulas.
+/// Return false if the instance is out of range for this operand, in which case EvalInstance returns 0.
+
+Bool_t TTreeFormula::EvalOperand(Int_t i, Int_t instance, Bool_t willLoad, Double_t &value)
+{
+   if ((GetOper()[i] >> kTFOperShift) == kAlias) {
+      TTreeFormula *subform = static_cast<TTreeFormula*>(fAliases.UncheckedAt(i));
+      R__ASSERT(subform);
+      subform->fDidBooleanOptimization = fDidBooleanOptimization;
+      value = subform->EvalInstance<Double_t>(instance);
+      return kTRUE;
+   }
+
+   const Int_t code = (GetOper()[i] & kTFOperMask);
+   switch (fLookupType[code]) {
+      case kIndexOfEntry: value = fTree->GetReadEntry(); return kTRUE;
+      case kIndexOfLocalEntry: value = fTree->GetTree()->GetReadEntry(); return kTRUE;
+      case kEntries:      value = fTree->GetEntries(); return kTRUE;
+      case kLocalEntries: value = fTree->GetTree()->GetEntries(); return kTRUE;
+      case kLength:       value = fManager->fNdata; return kTRUE;
+      case kLengthFunc:   value = ((TTreeFormula*)fAliases.UncheckedAt(i))->GetNdata(); return kTRUE;
+      case kIteration:    value = instance; return kTRUE;
+      case kSum:          value = Summing<Double_t>((TTreeFormula*)fAliases.UncheckedAt(i)); return kTRUE;
+      case kMin:          value = FindMin<Double_t>((TTreeFormula*)fAliases.UncheckedAt(i)); return kTRUE;
+      case kMax:          value = FindMax<Double_t>((TTreeFormula*)fAliases.UncheckedAt(i)); return kTRUE;
+
+      case kDirect:     { TT_EVAL_INIT_LOOP; value = leaf->GetTypedValue<Double_t>(real_instance); return kTRUE; }
+      case kMethod:     { TT_EVAL_INIT_LOOP; value = GetValueFromMethod(code,leaf); return kTRUE; }
+      case kDataMember: { TT_EVAL_INIT_LOOP; value = ((TFormLeafInfo*)fDataMembers.UncheckedAt(code))->
+                                 GetTypedValue<Double_t>(leaf,real_instance); return kTRUE; }
+      case kTreeMember: { TREE_EVAL_INIT_LOOP; value = ((TFormLeafInfo*)fDataMembers.UncheckedAt(code))->
+                                 GetTypedValue<Double_t>((TLeaf*)0x0,real_instance); return kTRUE; }
+      case kEntryList: { TEntryList *elist = (TEntryList*)fExternalCuts.At(code);
+         value = elist->Contains(fTree->GetReadEntry());
+         return kTRUE;}
+      case -1: break;
+      default: value = 0; return kTRUE;
+   }
+   switch (fCodes[code]) {
+      case -2: {
+         TCutG *gcut = (TCutG*)fExternalCuts.At(code);
+         TTreeFormula *fx = (TTreeFormula *)gcut->GetObjectX();
+         TTreeFormula *fy = (TTreeFormula *)gcut->GetObjectY();
+         if (fDidBooleanOptimization) {
+            fx->ResetLoading();
+            fy->ResetLoading();
+         }
+         Double_t xcut = fx->EvalInstance<Double_t>(instance);
+         Double_t ycut = fy->EvalInstance<Double_t>(instance);
+         value = gcut->IsInside(xcut,ycut);
+         return kTRUE;
+      }
+      case -1: {
+         TCutG *gcut = (TCutG*)fExternalCuts.At(code);
+         TTreeFormula *fx = (TTreeFormula *)gcut->GetObjectX();
+         if (fDidBooleanOptimization) {
+            fx->ResetLoading();
+         }
+         value = fx->EvalInstance<Double_t>(instance);
+         return kTRUE;
+      }
+      default: value = 0; return kTRUE;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this compiled formula for the instance `instance`.
+///
+/// All the operands are evaluated before the compiled operations. The boolean optimizations of `&&` and `||`, which
+/// skip the evaluation of their right operand, thus do not change the result, except when this right operand is out
+/// of range: the instance is then evaluated by the interpreter.
+
+Double_t TTreeFormula::EvalJitted(Int_t instance)
+{
+   const Bool_t willLoad = (instance==0 || fNeedLoading); fNeedLoading = kFALSE;
+   if (willLoad) fDidBooleanOptimization = kFALSE;
+
+   Double_t *values = fJitValues.data();
+   const Int_t noperands = fJitOperands.size();
+   for (Int_t k = 0; k < noperands; ++k) {
+      if (!EvalOperand(fJitOperands[k], instance, willLoad, values[k]))
+         return fJitNeedsFallback ? EvalInterpreted(instance, willLoad) : 0;
+   }
+   Double_t result;
+   fJitFunc(1, values, fConst, &result);
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the instance `instance` of this compiled formula with the interpreter, loading the branches if
+/// `willLoad` is true.
+
+Double_t TTreeFormula::EvalInterpreted(Int_t instance, Bool_t willLoad)
+{
+   const JitFunc_t func = fJitFunc;
+   fJitFunc = nullptr;
+   fNeedLoading = willLoad;
+   const Double_t result = EvalInstance<Double_t>(instance);
+   fJitFunc = func;
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the `n` first instances of the formula, storing their results in `values`, which has at least `n`
+/// elements; `n` is usually the result of GetNdata().
+///
+/// A compiled formula (see SetJitEvaluation()) evaluates the operands of all the instances first and then runs
+/// its compiled operations once over all these instances.
+
+void TTreeFormula::EvalInstances(Int_t n, Double_t *values)
+{
+   if (!fJitFunc || TestBit(kMissingLeaf)) {
+      for (Int_t i = 0; i < n; ++i)
+         values[i] = EvalInstance<Double_t>(i);
+      return;
+   }
+   if (n <= 0)
+      return;
+
+   const Int_t noperands = fJitOperands.size();
+   if (fJitValues.size() < std::size_t(n) * noperands)
+      fJitValues.resize(std::size_t(n) * noperands);
+   std::vector<Int_t> outOfRange;
+   for (Int_t i = 0; i < n; ++i) {
+      const Bool_t willLoad = (i==0 || fNeedLoading); fNeedLoading = kFALSE;
+      if (willLoad) fDidBooleanOptimization = kFALSE;
+      Double_t *instanceValues = fJitValues.data() + std::size_t(i) * noperands;
+      for (Int_t k = 0; k < noperands; ++k) {
+         if (!EvalOperand(fJitOperands[k], i, willLoad, instanceValues[k])) {
+            outOfRange.push_back(i);
+            break;
+         }
+      }
+   }
+   fJitFunc(n, fJitValues.data(), fConst, values);
+   for (auto i : outOfRange)
+      values[i] = fJitNeedsFallback ? EvalInterpreted(i, i == 0) : 0;
+}
+
+namespace {
+
+/// Compiled operations of TTreeFormula, indexed by their generated code
+std::unordered_map<std::string, void *> gTreeFormulaJitFunctions;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the C++ code equivalent to the operations of the formula and compile it with cling.
+///
+/// The code computes, as EvalInstance, the value of the formula from the values of its operands, i.e. its tree
+/// variables and aliases, which are evaluated by EvalOperand(). Only the formulas made of operands, constants,
+/// arithmetic, bitwise, logical and comparison operators and of the builtin mathematical functions are compiled;
+/// the other ones (with strings, conditional expressions, function calls...) are always interpreted. The formulas
+/// with identical operations share their compiled code.
+
+void TTreeFormula::JitOperations()
+{
+   std::vector<Int_t> operands;
+   std::string body;
+   Bool_t hasBoolOptimization = kFALSE;
+   Bool_t hasRandom = kFALSE;
+   Int_t pos = 0;
+   Int_t maxpos = 0;
+
+   // Append a statement, in which $a and $b stand for the two last values of the stack
+   auto emit = [&](const char *statement) {
+      std::string s(statement);
+      for (std::size_t at = s.find('$'); at != std::string::npos; at = s.find('$', at)) {
+         const Int_t k = s[at + 1] == 'a' ? pos - 1 : pos;
+         s.replace(at, 2, "s" + std::to_string(k));
+      }
+      body += "      " + s + "\n";
+   };
+   auto push = [&](const std::string &value) {
+      body += "      s" + std::to_string(pos) + " = " + value + ";\n";
+      maxpos = std::max(maxpos, ++pos);
+   };
+
+   for (Int_t i = 0; i < fNoper; ++i) {
+      const Int_t action = GetAction(i);
+      // the binary operators use $a and $b, values of the left and right operands, and store their result in $a
+      const bool binary = (action >= kAdd && action <= kModulo) || action == katan2 || action == kfmod ||
+                          action == kpow || action == kmin || action == kmax ||
+                          (action >= kAnd && action <= kGreaterThan) || (action >= kBitAnd && action <= kRightShift);
+      if (binary) {
+         if (pos < 2)
+            return;
+         --pos;
+      } else if (action != kConstant && action != kpi && action != krndm && action != kDefinedVariable &&
+                 action != kAlias && action != kBoolOptimize && action != kEnd && pos < 1) {
+         return;
+      }
+      switch (action) {
+         case kConstant: push("c[" + std::to_string(GetActionParam(i)) + "]"); break;
+         case kDefinedVariable:
+         case kAlias:
+            push("v[" + std::to_string(operands.size()) + "]");
+            operands.push_back(i);
+            break;
+         case kpi: push("TMath::Pi()"); break;
+         case krndm: push("gRandom->Rndm()"); hasRandom = kTRUE; break;
+         case kBoolOptimize: hasBoolOptimization = kTRUE; break;
+         case kEnd: i = fNoper; break;
+
+         case kAdd: emit("$a += $b;"); break;
+         case kSubstract: emit("$a -= $b;"); break;
+         case kMultiply: emit("$a *= $b;"); break;
+         case kDivide: emit("$a = ($b == 0) ? 0 : $a / $b;"); break;
+         case kModulo: emit("$a = Double_t(Long64_t($a) % Long64_t($b));"); break;
+         case katan2: emit("$a = TMath::ATan2($a, $b);"); break;
+         case kfmod: emit("$a = fmod($a, $b);"); break;
+         case kpow: emit("$a = TMath::Power($a, $b);"); break;
+         case kmin: emit("$a = std::min($a, $b);"); break;
+         case kmax: emit("$a = std::max($a, $b);"); break;
+         case kAnd: emit("$a = ($a != 0 && $b != 0) ? 1 : 0;"); break;
+         case kOr: emit("$a = ($a != 0 || $b != 0) ? 1 : 0;"); break;
+         case kEqual: emit("$a = ($a == $b) ? 1 : 0;"); break;
+         case kNotEqual: emit("$a = ($a != $b) ? 1 : 0;"); break;
+         case kLess: emit("$a = ($a < $b) ? 1 : 0;"); break;
+         case kGreater: emit("$a = ($a > $b) ? 1 : 0;"); break;
+         case kLessThan: emit("$a = ($a <= $b) ? 1 : 0;"); break;
+         case kGreaterThan: emit("$a = ($a >= $b) ? 1 : 0;"); break;
+         case kBitAnd: emit("$a = ULong64_t($a) & ULong64_t($b);"); break;
+         case kBitOr: emit("$a = ULong64_t($a) | ULong64_t($b);"); break;
+         case kLeftShift: emit("$a = ULong64_t($a) << ULong64_t($b);"); break;
+         case kRightShift: emit("$a = ULong64_t($a) >> ULong64_t($b);"); break;
+
+         case kcos: emit("$a = TMath::Cos($a);"); break;
+         case ksin: emit("$a = TMath::Sin($a);"); break;
+         case ktan: emit("$a = (TMath::Cos($a) == 0) ? 0 : TMath::Tan($a);"); break;
+         case kacos: emit("$a = (TMath::Abs($a) > 1) ? 0 : TMath::ACos($a);"); break;
+         case kasin: emit("$a = (TMath::Abs($a) > 1) ? 0 : TMath::ASin($a);"); break;
+         case katan: emit("$a = TMath::ATan($a);"); break;
+         case kcosh: emit("$a = TMath::CosH($a);"); break;
+         case ksinh: emit("$a = TMath::SinH($a);"); break;
+         case ktanh: emit("$a = (TMath::CosH($a) == 0) ? 0 : TMath::TanH($a);"); break;
+         case kacosh: emit("$a = ($a < 1) ? 0 : TMath::ACosH($a);"); break;
+         case kasinh: emit("$a = TMath::ASinH($a);"); break;
+         case katanh: emit("$a = (TMath::Abs($a) > 1) ? 0 : TMath::ATanH($a);"); break;
+         case ksq: emit("$a = $a * $a;"); break;
+         case ksqrt: emit("$a = TMath::Sqrt(TMath::Abs($a));"); break;
+         case klog: emit("$a = ($a > 0) ? TMath::Log($a) : 0;"); break;
+         case kexp: emit("$a = ($a < -700) ? 0 : TMath::Exp(std::min($a, 700.));"); break;
+         case klog10: emit("$a = ($a > 0) ? TMath::Log10($a) : 0;"); break;
+         case kabs: emit("$a = TMath::Abs($a);"); break;
+         case ksign: emit("$a = ($a < 0) ? -1 : 1;"); break;
+         case kint: emit("$a = Double_t(Long64_t($a));"); break;
+         case kSignInv: emit("$a = -1 * $a;"); break;
+         case kNot: emit("$a = ($a != 0) ? 0 : 1;"); break;
+
+         default: return; // not supported, the formula is interpreted
+      }
+   }
+   // Evaluating all the operands would change the sequence of random numbers of the interpreter
+   if (pos != 1 || (hasRandom && hasBoolOptimization))
+      return;
+
+   const Int_t noperands = operands.size();
+   std::string key = std::to_string(noperands) + "\n" + body;
+   void *address = nullptr;
+   {
+      R__LOCKGUARD(gROOTMutex);
+      auto funcit = gTreeFormulaJitFunctions.find(key);
+      if (funcit != gTreeFormulaJitFunctions.end())
+         address = funcit->second;
+   }
+   if (!address) {
+      const std::string name = "TTreeFormula_jit_" + std::to_string(std::hash<std::string>{}(key));
+      std::string stack = "s0";
+      for (Int_t k = 1; k < maxpos; ++k)
+         stack += ", s" + std::to_string(k);
+      const std::string code = "#include \"TMath.h\"\n#include \"TRandom.h\"\n#include <algorithm>\n#include <cmath>\n"
+                               "void " + name + "(Int_t n, const Double_t *v, const Double_t *c, Double_t *r)\n{\n"
+                               "   for (Int_t i = 0; i < n; ++i, v += " + std::to_string(noperands) + ") {\n"
+                               "      Double_t " + stack + ";\n" + body +
+                               "      r[i] = s0;\n   }\n}\n";
+      ROOT::GetROOT();
+      R__ASSERT(gInterpreter);
+      if (!gInterpreter->Declare(code.c_str())) {
+         Warning("JitOperations", "Could not compile the formula %s, it is interpreted", GetTitle());
+         return;
+      }
+      address = (void *)gInterpreter->Calc(("(Longptr_t)&" + name + ";").c_str());
+      if (!address)
+         return;
+      R__LOCKGUARD(gROOTMutex);
+      gTreeFormulaJitFunctions.emplace(key, address);
+   }
+   fJitFunc = (JitFunc_t)address;
+   fJitOperands = operands;
+   fJitValues.assign(noperands, 0.);
+   fJitNeedsFallback = hasBoolOptimization;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether the operations of the formulas created from now on are compiled with cling, instead of being interpreted
+/// for each instance by EvalInstance. When compiled, EvalInstance only evaluates the operands of the formula, e.g.
+/// its tree variables, and then calls the compiled code. The default is given by the rootrc key
+/// `TTreeFormula.Jit` (no by default). Only the evaluations as `Double_t` are compiled, see JitOperations().
+
+void TTreeFormula::SetJitEvaluation(Bool_t jit)
+{
+   fgJitEvaluation = jit;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether the operations of new formulas are compiled, see SetJitEvaluation().
+
+Bool_t TTreeFormula::GetJitEvaluation()
+{
+   if (fgJitEvaluation < 0)
+      fgJitEvaluation = gEnv->GetValue("TTreeFormula.Jit", 0) ? 1 : 0;
+   return fgJitEvaluation;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return DataMember corresponding to code.
 ///
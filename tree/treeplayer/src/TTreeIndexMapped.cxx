@@ -0,0 +1,324 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TTreeIndexMapped
+A TTreeIndex whose sorted values are memory-mapped from a file.
+
+A TTreeIndex that is stored together with its TTree is read in full, i.e. three
+arrays of fN Long64_t, every time the tree is opened.  For trees with hundreds of
+millions of entries, in particular friend trees matched by e.g. (run, event), this
+dominates the start-up time and the memory footprint.  TTreeIndexMapped stores the
+sorted values in a separate file that is memory-mapped on use; the look-ups are the
+binary searches of TTreeIndex, performed in place on the mapped pages, such that only
+the pages that are actually touched are read from disk.
+
+The index file is written from an existing TTreeIndex:
+~~~{.cpp}
+   tree->BuildIndex("run", "event");
+   TTreeIndexMapped::Save(*static_cast<TTreeIndex *>(tree->GetTreeIndex()), "events.idx");
+~~~
+and attached to the tree with
+~~~{.cpp}
+   tree->SetTreeIndex(new TTreeIndexMapped(tree, "events.idx"));
+~~~
+When the tree is written, only the name of the index file is stored with it.  On
+reading, a relative file name is looked up in the working directory and then next to
+the file holding the tree.
+
+The index file consists of a header with the magic string "ROOTTIDX", the format
+version, a byte order mark and the number of entries, followed by the major and minor
+names and the three arrays of sorted major values, sorted minor values and entry
+numbers.  The file is not portable across platforms of different byte order.
+*/
+
+#include "TTreeIndexMapped.h"
+
+#include "TBuffer.h"
+#include "TError.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#ifndef R__WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ClassImp(TTreeIndexMapped);
+
+namespace {
+
+constexpr char kMagic[8] = {'R', 'O', 'O', 'T', 'T', 'I', 'D', 'X'};
+constexpr std::uint32_t kFormatVersion = 1;
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+
+struct RIndexFileHeader {
+   char fMagic[8];
+   std::uint32_t fVersion;
+   std::uint32_t fByteOrder;
+   std::uint64_t fN;
+   std::uint32_t fMajorNameLen;
+   std::uint32_t fMinorNameLen;
+};
+
+/// The arrays are aligned to 8 bytes
+std::uint64_t PaddedSize(std::uint64_t size)
+{
+   return (size + 7) & ~std::uint64_t(7);
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Default constructor for TTreeIndexMapped
+
+TTreeIndexMapped::TTreeIndexMapped(): TTreeIndex()
+{
+   fMapping     = nullptr;
+   fMappingSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Normal constructor for TTreeIndexMapped
+///
+/// Map the index file "filename", written by TTreeIndexMapped::Save, for Tree T.
+/// The major and minor names are taken from the file.
+
+TTreeIndexMapped::TTreeIndexMapped(const TTree *T, const char *filename)
+                 : TTreeIndex()
+{
+   fTree        = (TTree*)T;
+   fFileName    = filename;
+   fMapping     = nullptr;
+   fMappingSize = 0;
+   if (!Map(filename)) {
+      MakeZombie();
+      return;
+   }
+   if (T && T->GetEntries() < fN) {
+      Warning("TTreeIndexMapped", "The index %s has more entries (%lld) than the tree (%lld)", filename, fN,
+              T->GetEntries());
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TTreeIndexMapped::~TTreeIndexMapped()
+{
+   Unmap();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A memory-mapped index is read-only and cannot be appended to.
+
+void TTreeIndexMapped::Append(const TVirtualIndex *, Bool_t)
+{
+   Error("Append", "Cannot append to the memory-mapped index %s", fFileName.Data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Map the index file and point the TTreeIndex arrays to its content.
+/// Returns kFALSE if the file cannot be mapped or is not a valid index file.
+
+Bool_t TTreeIndexMapped::Map(const char *filename)
+{
+   Unmap();
+
+#ifndef R__WIN32
+   int fd = open(filename, O_RDONLY);
+   if (fd < 0) {
+      Error("Map", "Cannot open the index file %s", filename);
+      return kFALSE;
+   }
+   struct stat info;
+   if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(RIndexFileHeader)) {
+      close(fd);
+      Error("Map", "%s is not an index file", filename);
+      return kFALSE;
+   }
+   void *addr = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED) {
+      Error("Map", "Cannot map the index file %s", filename);
+      return kFALSE;
+   }
+   // Binary searches touch the pages in no particular order, read-ahead does not help
+   madvise(addr, info.st_size, MADV_RANDOM);
+   fMapping     = addr;
+   fMappingSize = info.st_size;
+#else
+   std::ifstream in(filename, std::ios::binary | std::ios::ate);
+   if (!in) {
+      Error("Map", "Cannot open the index file %s", filename);
+      return kFALSE;
+   }
+   Long64_t size = in.tellg();
+   if (size < (Long64_t)sizeof(RIndexFileHeader)) {
+      Error("Map", "%s is not an index file", filename);
+      return kFALSE;
+   }
+   char *content = new char[size];
+   in.seekg(0);
+   if (!in.read(content, size)) {
+      delete [] content;
+      Error("Map", "Cannot read the index file %s", filename);
+      return kFALSE;
+   }
+   fMapping     = content;
+   fMappingSize = size;
+#endif
+
+   const char *base = static_cast<const char *>(fMapping);
+   RIndexFileHeader header;
+   memcpy(&header, base, sizeof(header));
+   if (memcmp(header.fMagic, kMagic, sizeof(kMagic)) != 0 || header.fVersion != kFormatVersion ||
+       header.fByteOrder != kByteOrderMark) {
+      Error("Map", "%s is not an index file of version %u for this platform", filename, kFormatVersion);
+      Unmap();
+      return kFALSE;
+   }
+   const std::uint64_t namesOffset = sizeof(header);
+   const std::uint64_t arraysOffset = namesOffset + PaddedSize(header.fMajorNameLen + header.fMinorNameLen);
+   if (header.fN > std::uint64_t(kMaxLong64 / (3 * sizeof(Long64_t))) ||
+       arraysOffset + 3 * header.fN * sizeof(Long64_t) != std::uint64_t(fMappingSize)) {
+      Error("Map", "The index file %s is truncated or corrupted", filename);
+      Unmap();
+      return kFALSE;
+   }
+
+   fMajorName = TString(base + namesOffset, header.fMajorNameLen);
+   fMinorName = TString(base + namesOffset + header.fMajorNameLen, header.fMinorNameLen);
+   fN = header.fN;
+   // The arrays are never written to: Append is disabled and the Streamer does not read into them
+   Long64_t *arrays = reinterpret_cast<Long64_t *>(const_cast<char *>(base) + arraysOffset);
+   fIndexValues      = arrays;
+   fIndexValuesMinor = arrays + fN;
+   fIndex            = arrays + 2 * fN;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the mapping; the index is empty afterwards.
+
+void TTreeIndexMapped::Unmap()
+{
+   // Make sure that ~TTreeIndex does not try to delete the mapped arrays
+   fIndexValues      = nullptr;
+   fIndexValuesMinor = nullptr;
+   fIndex            = nullptr;
+   fN                = 0;
+   if (!fMapping)
+      return;
+#ifndef R__WIN32
+   munmap(fMapping, fMappingSize);
+#else
+   delete [] static_cast<char *>(fMapping);
+#endif
+   fMapping     = nullptr;
+   fMappingSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hint to the operating system that the whole index will be used soon, e.g.
+/// before a large number of look-ups.  The pages are then read ahead
+/// asynchronously instead of one by one on the first access.
+
+void TTreeIndexMapped::Prefetch() const
+{
+#ifndef R__WIN32
+   if (fMapping)
+      madvise(fMapping, fMappingSize, MADV_WILLNEED);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the sorted values of index into the file "filename" in the layout
+/// expected by TTreeIndexMapped.  Returns kFALSE in case of failure.
+
+Bool_t TTreeIndexMapped::Save(const TTreeIndex &index, const char *filename)
+{
+   const Long64_t n = index.GetN();
+   const Long64_t *major = index.GetIndexValues();
+   const Long64_t *minor = index.GetIndexValuesMinor();
+   const Long64_t *entries = index.GetIndex();
+   if (n <= 0 || !major || !minor || !entries) {
+      ::Error("TTreeIndexMapped::Save", "Cannot save an empty index");
+      return kFALSE;
+   }
+
+   const TString majorName = index.GetMajorName();
+   const TString minorName = index.GetMinorName();
+   RIndexFileHeader header;
+   memcpy(header.fMagic, kMagic, sizeof(kMagic));
+   header.fVersion      = kFormatVersion;
+   header.fByteOrder    = kByteOrderMark;
+   header.fN            = n;
+   header.fMajorNameLen = majorName.Length();
+   header.fMinorNameLen = minorName.Length();
+   const char padding[8] = {0};
+   const std::uint64_t namesLen = header.fMajorNameLen + header.fMinorNameLen;
+
+   std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+   out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+   out.write(majorName.Data(), majorName.Length());
+   out.write(minorName.Data(), minorName.Length());
+   out.write(padding, PaddedSize(namesLen) - namesLen);
+   out.write(reinterpret_cast<const char *>(major), n * sizeof(Long64_t));
+   out.write(reinterpret_cast<const char *>(minor), n * sizeof(Long64_t));
+   out.write(reinterpret_cast<const char *>(entries), n * sizeof(Long64_t));
+   out.close();
+   if (!out) {
+      ::Error("TTreeIndexMapped::Save", "Cannot write the index file %s", filename);
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stream an object of class TTreeIndexMapped.
+/// Only the names and the name of the index file are streamed; the index file
+/// is mapped when reading.
+
+void TTreeIndexMapped::Streamer(TBuffer &R__b)
+{
+   UInt_t R__s, R__c;
+   if (R__b.IsReading()) {
+      Version_t R__v = R__b.ReadVersion(&R__s, &R__c); if (R__v) { }
+      TVirtualIndex::Streamer(R__b);
+      fMajorName.Streamer(R__b);
+      fMinorName.Streamer(R__b);
+      fFileName.Streamer(R__b);
+      R__b.CheckByteCount(R__s, R__c, TTreeIndexMapped::IsA());
+
+      TString path = fFileName;
+      if (!gSystem->IsAbsoluteFileName(path) && gSystem->AccessPathName(path)) {
+         // Not found relative to the working directory, try next to the file holding the tree
+         if (auto file = dynamic_cast<TFile *>(R__b.GetParent())) {
+            TString dir = gSystem->GetDirName(file->GetName());
+            gSystem->PrependPathName(dir, path);
+         }
+      }
+      Map(path);
+   } else {
+      R__c = R__b.WriteVersion(TTreeIndexMapped::IsA(), kTRUE);
+      TVirtualIndex::Streamer(R__b);
+      fMajorName.Streamer(R__b);
+      fMinorName.Streamer(R__b);
+      fFileName.Streamer(R__b);
+      R__b.SetByteCount(R__c, kTRUE);
+   }
+}
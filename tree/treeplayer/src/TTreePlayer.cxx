@@ -2245,7 +2245,9 @@ Long64_t TTreePlayer::Process(TSelector *selector,Option_t *option, Long64_t nen
 
    Bool_t process = (selector->GetAbort() != TSelector::kAbortProcess &&
                     (selector->Version() != 0 || selector->GetStatus() != -1)) ? kTRUE : kFALSE;
-   if (process) {
+   // With IMT, the histograms of TTree::Draw with fixed limits are filled by several threads
+   const Bool_t processedMT = process && selector == fSelector && fSelector->ProcessMT(firstentry, nentries);
+   if (process && !processedMT) {
 
       Long64_t readbytesatstart = 0;
       readbytesatstart = TFile::GetFileBytesRead();
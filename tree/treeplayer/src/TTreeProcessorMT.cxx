@@ -19,14 +19,19 @@ passes a function whose only parameter is a TTreeReader. The function iterates
 on a subrange of entries by using that TTreeReader.
 
 The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the subranges,
-each corresponding to a cluster in the TTree. This is possible thanks to the use
-of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
-objects.
+each made of one or more consecutive clusters of the TTree. The subranges are handed out
+while the processing goes on: the first ones are large, and they become smaller towards
+the end of each file, so that all threads finish at about the same time. This is possible
+thanks to the use of a ROOT::TThreadedObject, so that each thread works with its own TFile
+and TTree objects.
 */
 
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <mutex>
+
 using namespace ROOT;
 
 namespace {
@@ -65,6 +70,39 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
    const bool listHasGlobalEntryNumbers = entryList.GetLists() == nullptr;
    const auto nFiles = clusters.size();
 
+   if (listHasGlobalEntryNumbers) {
+      // The cluster boundaries translate directly to entry list indices, without iterating over the entries
+      std::vector<Long64_t> boundaries;
+      for (const auto &fileClusters : clusters)
+         for (const auto &c : fileClusters)
+            boundaries.emplace_back(c.second);
+      std::vector<Long64_t> elistBoundaries(boundaries.size());
+      entryList.GetNBefore(boundaries.size(), boundaries.data(), elistBoundaries.data());
+
+      std::vector<std::vector<EntryRange>> elistClusters;
+      Long64_t elistRangeStart = 0ll;
+      for (const auto &fileClusters : clusters) {
+         if (!fileClusters.empty()) {
+            elistRangeStart = entryList.GetNBefore(fileClusters.front().first);
+            break;
+         }
+      }
+      std::size_t boundaryIdx = 0;
+      for (const auto &fileClusters : clusters) {
+         std::vector<EntryRange> elistClustersForFile;
+         for (std::size_t i = 0; i < fileClusters.size(); ++i, ++boundaryIdx) {
+            const Long64_t elistRangeEnd = elistBoundaries[boundaryIdx];
+            if (elistRangeEnd == elistRangeStart) // no entrylist entries in this cluster
+               continue;
+            elistClustersForFile.emplace_back(EntryRange{elistRangeStart, elistRangeEnd});
+            elistRangeStart = elistRangeEnd;
+         }
+         elistClusters.emplace_back(std::move(elistClustersForFile));
+      }
+      R__ASSERT(ClustersAreSortedAndContiguous(elistClusters));
+      return elistClusters;
+   }
+
    std::unique_ptr<TChain> chain;
    using NextFn_t = Long64_t (*)(Long64_t &, TEntryList &, TChain *);
    // A function that advances TEntryList and returns global entry numbers or -1 if we reached the end
@@ -125,13 +163,17 @@ using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
-                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
+                                       const std::vector<std::string> &fileNames,
                                        const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
 {
-   // Note that as a side-effect of opening all files that are going to be used in the
-   // analysis once, all necessary streamers will be loaded into memory.
-   TDirectory::TContext c;
+   // Without a range end, all the files are needed: their headers are read at once, in parallel and through the
+   // cache of tree headers. Otherwise they are read one by one until the end of the range is reached.
    const auto nFileNames = fileNames.size();
+   const bool readAllHeaders = range.second == std::numeric_limits<Long64_t>::max();
+   std::vector<ROOT::Internal::TreeUtils::RTreeHeaderInfo> headers;
+   if (readAllHeaders)
+      headers = ROOT::Internal::TreeUtils::GetTreeHeaderInfos(treeNames, fileNames);
+
    std::vector<std::vector<EntryRange>> clustersPerFile;
    std::vector<Long64_t> entriesPerFile;
    entriesPerFile.reserve(nFileNames);
@@ -141,30 +183,26 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       const auto &fileName = fileNames[i];
       const auto &treeName = treeNames[i];
 
-      std::unique_ptr<TFile> f(TFile::Open(
-         fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
+      const auto header = readAllHeaders
+                             ? headers[i]
+                             : ROOT::Internal::TreeUtils::GetTreeHeaderInfos({treeName}, {fileName})[0];
+      if (!header.fFileOk) {
          const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
          throw std::runtime_error(msg);
       }
-      auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
-
-      if (!t) {
+      if (!header.fTreeOk) {
          const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
                           "\" from file \"" + fileName + "\"";
          throw std::runtime_error(msg);
       }
 
-      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
-      t->ResetBit(kMustCleanup);
-      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
-      auto clusterIter = t->GetClusterIterator(0);
-      Long64_t clusterStart = 0ll, clusterEnd = 0ll;
-      const Long64_t entries = t->GetEntries();
+      const auto &clusterStarts = header.fClusterStarts;
+      const Long64_t entries = header.fEntries;
       // Iterate over the clusters in the current file
       std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
+      for (std::size_t k = 0; k < clusterStarts.size() && !rangeEndReached; ++k) {
+         const Long64_t clusterStart = clusterStarts[k];
+         const Long64_t clusterEnd = k + 1 < clusterStarts.size() ? clusterStarts[k + 1] : entries;
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -193,54 +231,89 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
                              "but the starting entry (" + range.first + ") is larger than the total number of " +
                              "entries (" + offset + ") in the dataset.");
 
-   // Here we "fuse" clusters together if the number of clusters is too big with respect to
-   // the number of slots, otherwise we can incur in an overhead which is big enough
-   // to make parallelisation detrimental to performance.
-   // For example, this is the case when, following a merging of many small files, a file
-   // contains a tree with many entries and with clusters of just a few entries each.
-   // Another problematic case is a high number of slots (e.g. 256) coupled with a high number
-   // of files (e.g. 1000 files): the large amount of files might result in a large amount
-   // of tasks, but the elevated concurrency level makes the little synchronization required by
-   // task initialization very expensive. In this case it's better to simply process fewer, larger tasks.
-   // Cluster-merging can help reduce the number of tasks down to a minumum of one task per file.
-   //
-   // The criterion according to which we fuse clusters together is to have around
-   // TTreeProcessorMT::GetTasksPerWorkerHint() clusters per slot.
-   // Concretely, for each file we will cap the number of tasks to ceil(GetTasksPerWorkerHint() * nWorkers / nFiles).
-
-   std::vector<std::vector<EntryRange>> eventRangesPerFile(clustersPerFile.size());
-   auto clustersPerFileIt = clustersPerFile.begin();
-   auto eventRangesPerFileIt = eventRangesPerFile.begin();
-   for (; clustersPerFileIt != clustersPerFile.end(); clustersPerFileIt++, eventRangesPerFileIt++) {
-      const auto clustersInThisFileSize = clustersPerFileIt->size();
-      const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
-      // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
-      if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
-         continue;
-      }
-      // Otherwise, we have to merge clusters, distributing the reminder evenly
-      // onto the first clusters
-      auto nReminderClusters = clustersInThisFileSize % maxTasksPerFile;
-      const auto &clustersInThisFile = *clustersPerFileIt;
-      for (auto i = 0ULL; i < clustersInThisFileSize; ++i) {
-         const auto start = clustersInThisFile[i].first;
-         // We lump together at least nFolds clusters, therefore
-         // we need to jump ahead of nFolds-1.
-         i += (nFolds - 1);
-         // We now add a cluster if we have some reminder left
-         if (nReminderClusters > 0) {
-            i += 1U;
-            nReminderClusters--;
-         }
-         const auto end = clustersInThisFile[i].second;
-         eventRangesPerFileIt->emplace_back(EntryRange({start, end}));
-      }
+   return std::make_pair(std::move(clustersPerFile), std::move(entriesPerFile));
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Hands out the clusters of a file to the tasks that process it, as ranges of consecutive clusters.
+///
+/// Each range covers about 1/nTasks of the entries that are left, but at least 1/(tasksPerWorkerHint * nTasks) of the
+/// entries of the file: the first ranges are large, to limit the overhead of starting a task, and they become smaller
+/// towards the end of the file, so that a task that is still processing an expensive range does not leave the other
+/// workers idle for long. The sizes of the ranges only depend on the clusters, not on the order in which the tasks
+/// ask for them.
+class RClusterQueue {
+   const std::vector<EntryRange> &fClusters; ///< Sorted and contiguous clusters of the file
+   const Long64_t fNTasks;
+   const Long64_t fMinEntries; ///< Minimum number of entries of a range, unless fewer are left
+   std::size_t fNextCluster = 0;
+   std::mutex fMutex;
+
+public:
+   RClusterQueue(const std::vector<EntryRange> &clusters, unsigned int nTasks, unsigned int tasksPerWorkerHint)
+      : fClusters(clusters), fNTasks(std::max(nTasks, 1u)),
+        fMinEntries(clusters.empty() ? 0ll
+                                     : (clusters.back().second - clusters.front().first) /
+                                          (fNTasks * std::max(tasksPerWorkerHint, 1u)))
+   {
    }
 
-   return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
-}
+   /// Get the next range of entries to process. Return false if all clusters have been handed out.
+   bool Next(EntryRange &range)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fNextCluster == fClusters.size())
+         return false;
+
+      const auto start = fClusters[fNextCluster].first;
+      const auto nEntries = std::max((fClusters.back().second - start) / fNTasks, fMinEntries);
+      // take at least one cluster, then all the following ones that fit in nEntries
+      ++fNextCluster;
+      while (fNextCluster < fClusters.size() && fClusters[fNextCluster].second - start <= nEntries)
+         ++fNextCluster;
+      range = EntryRange{start, fClusters[fNextCluster - 1].second};
+      return true;
+   }
+};
+
+/// Asks for the asynchronous opening of the next files of the dataset while the current ones are processed, so that
+/// the latency of opening a remote file is hidden behind the processing of the previous ones. The TFile::Open call
+/// of the TChain that reads a file takes the pending request over; requests that were never taken are cancelled at
+/// destruction.
+class RFileOpenAhead {
+   const std::vector<std::string> &fFileNames;
+   const std::size_t fNAhead;
+   std::size_t fNextFile = 0; ///< Index of the first file that was not requested yet
+   std::vector<TFileOpenHandle *> fHandles;
+   std::mutex fMutex;
+
+public:
+   RFileOpenAhead(const std::vector<std::string> &fileNames, unsigned int nAhead)
+      : fFileNames(fileNames), fNAhead(nAhead)
+   {
+   }
+   RFileOpenAhead(const RFileOpenAhead &) = delete;
+   RFileOpenAhead &operator=(const RFileOpenAhead &) = delete;
+   ~RFileOpenAhead()
+   {
+      for (auto handle : fHandles)
+         TFile::CancelAsyncOpen(handle);
+   }
+
+   /// Request the opening of the files following fileIdx that were not requested yet
+   void Start(std::size_t fileIdx)
+   {
+      if (fNAhead == 0)
+         return;
+      std::lock_guard<std::mutex> lock(fMutex);
+      fNextFile = std::max(fNextFile, fileIdx + 1);
+      const auto end = std::min(fFileNames.size(), fileIdx + 1 + fNAhead);
+      for (; fNextFile < end; ++fNextFile) {
+         if (auto handle = TFile::AsyncOpen(fFileNames[fNextFile].c_str(), "READ_WITHOUT_GLOBALREGISTRATION"))
+            fHandles.push_back(handle);
+      }
+   }
+};
 
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector containing the number of entries of each file of each friend TChain
@@ -306,6 +379,7 @@ static std::vector<std::vector<Long64_t>> GetFriendEntries(const ROOT::TreeUtils
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+unsigned int TTreeProcessorMT::fgFilesOpenedAhead = 2U;
 
 namespace Internal {
 
@@ -370,12 +444,16 @@ void TTreeView::MakeChain(const std::vector<std::string> &treeNames, const std::
 }
 
 //////////////////////////////////////////////////////////////////////////
-/// Get a TTreeReader for the current tree of this view.
-std::unique_ptr<TTreeReader>
-TTreeView::GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::string> &treeNames,
-                         const std::vector<std::string> &fileNames, const ROOT::TreeUtils::RFriendInfo &friendInfo,
-                         const TEntryList &entryList, const std::vector<Long64_t> &nEntries,
-                         const std::vector<std::vector<Long64_t>> &friendEntries)
+/// Get a TTreeReader for the current tree of this view, set to read the entries in [start, end).
+///
+/// As long as the tasks of this view process the same chain, the same reader is redirected to the entry range of each
+/// task: the chain, its friends and entry list, the branch proxies of the reader and the TTreeCache of the file, with
+/// the branches it learned, are all kept from one task to the next.
+TTreeReader &TTreeView::GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::string> &treeNames,
+                                      const std::vector<std::string> &fileNames,
+                                      const ROOT::TreeUtils::RFriendInfo &friendInfo, const TEntryList &entryList,
+                                      const std::vector<Long64_t> &nEntries,
+                                      const std::vector<std::vector<Long64_t>> &friendEntries)
 {
    const bool hasEntryList = entryList.GetN() > 0;
    const bool usingLocalEntries = friendInfo.fFriendNames.empty() && !hasEntryList;
@@ -383,6 +461,7 @@ TTreeView::GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::st
       fChain == nullptr || (usingLocalEntries && (fileNames[0] != fChain->GetListOfFiles()->At(0)->GetTitle() ||
                                                   treeNames[0] != fChain->GetListOfFiles()->At(0)->GetName()));
    if (needNewChain) {
+      fReader.reset();
       MakeChain(treeNames, fileNames, friendInfo, nEntries, friendEntries);
       if (hasEntryList) {
          fEntryList.reset(new TEntryList(entryList));
@@ -394,15 +473,17 @@ TTreeView::GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::st
          }
       }
    }
-   auto reader = std::make_unique<TTreeReader>(fChain.get(), fEntryList.get());
-   reader->SetEntriesRange(start, end);
-   return reader;
+   if (!fReader)
+      fReader = std::make_unique<TTreeReader>(fChain.get(), fEntryList.get());
+   fReader->SetEntriesRange(start, end);
+   return *fReader;
 }
 
 ////////////////////////////////////////////////////////////////////////
 /// Clear the resources
 void TTreeView::Reset()
 {
+   fReader.reset();
    fChain.reset();
    fEntryList.reset();
    fFriends.clear();
@@ -537,10 +618,28 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 /// \param[in] func User-defined function that processes a subrange of entries
 void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 {
-   // compute number of tasks per file
+   // Compute the maximum number of tasks that process each file concurrently. With a very large amount of files
+   // (e.g. 1000 files and 256 slots), running a task per slot for each file would make the little synchronization
+   // required by task initialization very expensive: the tasks are capped to
+   // ceil(GetTasksPerWorkerHint() * nWorkers / nFiles) per file, with a minimum of one task per file.
    const unsigned int maxTasksPerFile =
       std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
 
+   // Process the clusters of a file with a few tasks that take ranges of clusters from a queue until it is empty
+   auto processClusters = [&](const std::vector<EntryRange> &clusters,
+                              const std::function<void(const EntryRange &)> &f) {
+      const auto nTasks = std::min({static_cast<unsigned int>(clusters.size()), fPool.GetPoolSize(), maxTasksPerFile});
+      if (nTasks == 0)
+         return;
+      RClusterQueue queue(clusters, nTasks, GetTasksPerWorkerHint());
+      auto processQueue = [&]() {
+         EntryRange range;
+         while (queue.Next(range))
+            f(range);
+      };
+      fPool.Foreach(processQueue, nTasks);
+   };
+
    // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
    // so we do it here for all files.
    // Otherwise we can do it later, concurrently for each file, and clusters will contain local entry numbers.
@@ -554,35 +653,43 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, fGlobalRange);
       if (hasEntryList)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
 
+   // The friend files are opened once, not at every task
+   const auto friendEntries = hasFriends ? GetFriendEntries(fFriendInfo) : std::vector<std::vector<Long64_t>>{};
+
+   // The next files are opened in the background while the current ones are processed
+   RFileOpenAhead openAhead(fFileNames, fFileNames.size() > 1 ? GetFilesOpenedAhead() : 0u);
+
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
+      openAhead.Start(fileIdx);
       auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
-                                           allEntries, GetFriendEntries(fFriendInfo));
-         func(*r);
+         auto &r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
+                                            allEntries, friendEntries);
+         func(r);
       };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
+      processClusters(allClusters[fileIdx], processCluster);
    };
 
    // Per-file processing that also retrieves cluster info for a file
    auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
+      openAhead.Start(fileIdx);
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      const auto clustersAndEntries = MakeClusters(treeNames, fileNames);
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
       auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries},
-                                           std::vector<std::vector<Long64_t>>{});
-         func(*r);
+         auto &r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList,
+                                            {entries}, std::vector<std::vector<Long64_t>>{});
+         func(r);
       };
-      fPool.Foreach(processCluster, clusters);
+      processClusters(clusters, processCluster);
    };
 
    const auto firstNonEmpty =
@@ -619,11 +726,32 @@ unsigned int TTreeProcessorMT::GetTasksPerWorkerHint()
 /// \brief Set the hint for the desired number of tasks created per worker.
 /// \param[in] tasksPerWorkerHint Desired number of tasks per worker.
 ///
-/// This allows to create a reasonable number of tasks even if any of the
-/// processed files features a bad clustering, for example with a lot of
-/// entries and just a few entries per cluster, or to limit the number of
-/// tasks spawned when a very large number of files and workers is used.
+/// The ranges of entries handed out to the workers shrink towards the end of each file down to
+/// 1/tasksPerWorkerHint of the share of the file of each worker. This allows to create a reasonable
+/// number of tasks even if any of the processed files features a bad clustering, for example with
+/// a lot of entries and just a few entries per cluster, or to limit the number of tasks spawned
+/// when a very large number of files and workers is used.
 void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve the number of files opened ahead of the ones being processed.
+/// \return The number of files TTreeProcessorMT::Process asks to open asynchronously in advance.
+unsigned int TTreeProcessorMT::GetFilesOpenedAhead()
+{
+   return fgFilesOpenedAhead;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Set the number of files opened ahead of the ones being processed.
+/// \param[in] nFiles Number of files to open in advance, 0 disables the opening ahead.
+///
+/// When a task starts processing a file, TTreeProcessorMT::Process asks for the asynchronous opening of the
+/// following nFiles files of the dataset (see TFile::AsyncOpen), so that the latency of opening remote files
+/// overlaps with the processing of the previous ones. The default is 2.
+void TTreeProcessorMT::SetFilesOpenedAhead(unsigned int nFiles)
+{
+   fgFilesOpenedAhead = nFiles;
+}
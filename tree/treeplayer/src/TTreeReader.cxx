@@ -692,4 +692,7 @@ void TTreeReader::DeregisterValueReader(ROOT::Internal::TTreeReaderValueBase* re
       return;
    }
    fValues.erase(iReader);
+   // Once all value readers are gone, new ones can be registered: they get their proxies at the next entry
+   if (fValues.empty())
+      fProxiesSet = false;
 }
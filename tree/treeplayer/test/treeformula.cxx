@@ -0,0 +1,61 @@
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// Evaluate the formula for all the instances of all the entries of the tree, and for the instance 0 of the entries
+// without instances outside of bulk evaluation
+static std::vector<Double_t> EvalAll(TTree &t, const char *expression, Bool_t jit, Bool_t bulk = kFALSE)
+{
+   TTreeFormula::SetJitEvaluation(jit);
+   auto f = std::make_unique<TTreeFormula>("f", expression, &t);
+   TTreeFormula::SetJitEvaluation(kFALSE);
+   EXPECT_EQ(f->IsJitted(), jit) << expression;
+
+   std::vector<Double_t> res;
+   for (Long64_t entry = 0; entry < t.GetEntries(); ++entry) {
+      t.LoadTree(entry);
+      const Int_t ndata = f->GetNdata();
+      if (bulk) {
+         std::vector<Double_t> values(ndata);
+         f->EvalInstances(ndata, values.data());
+         res.insert(res.end(), values.begin(), values.end());
+      } else {
+         for (Int_t i = 0; i < std::max(ndata, 1); ++i)
+            res.push_back(f->EvalInstance(i));
+      }
+   }
+   return res;
+}
+
+TEST(TTreeFormula, Jit)
+{
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   Int_t n;
+   Double_t x, y;
+   Float_t arr[10];
+   t.Branch("n", &n);
+   t.Branch("x", &x);
+   t.Branch("y", &y);
+   t.Branch("arr", arr, "arr[n]/F");
+   for (Int_t i = 0; i < 50; ++i) {
+      n = i % 4;
+      x = 0.25 * i - 3;
+      y = i % 7;
+      for (Int_t j = 0; j < n; ++j)
+         arr[j] = i * j - 10;
+      t.Fill();
+   }
+
+   for (auto expression :
+        {"sqrt(x*x + y*y) > 2 && y != 3", "x/y + exp(-x)*atan2(y, x) - int(x) % 3", "arr*x - sin(arr) + (arr > 0)",
+         "n <= 2 || arr[2] > 5", "max(x, y) + (int(y) & 3) - (int(y) << 2)", "Sum$(arr) + Entry$ + log(y) - abs(x)"}) {
+      EXPECT_EQ(EvalAll(t, expression, kTRUE), EvalAll(t, expression, kFALSE)) << expression;
+      EXPECT_EQ(EvalAll(t, expression, kTRUE, kTRUE), EvalAll(t, expression, kFALSE, kTRUE)) << expression;
+   }
+}
@@ -0,0 +1,130 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+#include "TTreeIndexMapped.h"
+
+#include "gtest/gtest.h"
+
+#include "RErrorIgnoreRAII.hxx"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+void FillRunEventTree(TTree &t, int nentries)
+{
+   int run = 0;
+   int event = 0;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   // Entries are not sorted by (run, event)
+   for (int i = 0; i < nentries; ++i) {
+      run = (i * 7) % 13;
+      event = nentries - i;
+      t.Fill();
+   }
+   t.ResetBranchAddresses();
+}
+
+} // anonymous namespace
+
+TEST(TTreeIndex, BatchedLookup)
+{
+   const int nentries = 1000;
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   FillRunEventTree(t, nentries);
+   TTreeIndex index(&t, "run", "event");
+   ASSERT_EQ(nentries, index.GetN());
+
+   std::vector<Long64_t> major, minor;
+   for (int i = 0; i < nentries; ++i) {
+      major.push_back((i * 7) % 13);
+      minor.push_back(nentries - i);
+   }
+   // Pairs that are not in the index, before, between and after the stored pairs
+   major.push_back(-1);
+   minor.push_back(0);
+   major.push_back(3);
+   minor.push_back(nentries + 1);
+   major.push_back(100);
+   minor.push_back(1);
+
+   std::vector<Long64_t> entries(major.size(), -2);
+   index.GetEntryNumbersWithIndex(major.size(), major.data(), minor.data(), entries.data());
+   for (std::size_t i = 0; i < major.size(); ++i) {
+      EXPECT_EQ(index.GetEntryNumberWithIndex(major[i], minor[i]), entries[i]);
+      if (i < std::size_t(nentries))
+         EXPECT_EQ(Long64_t(i), entries[i]);
+      else
+         EXPECT_EQ(-1, entries[i]);
+   }
+}
+
+TEST(TTreeIndexMapped, SaveAndMap)
+{
+   const auto fileName = "ttreeindexmapped.root";
+   const auto indexName = "ttreeindexmapped.idx";
+   const int nentries = 1000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      FillRunEventTree(t, nentries);
+      ASSERT_EQ(nentries, t.BuildIndex("run", "event"));
+      auto index = dynamic_cast<TTreeIndex *>(t.GetTreeIndex());
+      ASSERT_NE(nullptr, index);
+      ASSERT_TRUE(TTreeIndexMapped::Save(*index, indexName));
+
+      auto mapped = new TTreeIndexMapped(&t, indexName);
+      ASSERT_FALSE(mapped->IsZombie());
+      EXPECT_STREQ("run", mapped->GetMajorName());
+      EXPECT_STREQ("event", mapped->GetMinorName());
+      ASSERT_EQ(index->GetN(), mapped->GetN());
+      for (int i = 0; i < nentries; i += 17) {
+         EXPECT_EQ(index->GetEntryNumberWithIndex((i * 7) % 13, nentries - i),
+                   mapped->GetEntryNumberWithIndex((i * 7) % 13, nentries - i));
+      }
+      // Only the name of the index file is written with the tree
+      t.SetTreeIndex(mapped);
+      delete index;
+      t.Write();
+   }
+
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      auto mapped = dynamic_cast<TTreeIndexMapped *>(t->GetTreeIndex());
+      ASSERT_NE(nullptr, mapped);
+      EXPECT_STREQ(indexName, mapped->GetFileName());
+      ASSERT_EQ(nentries, mapped->GetN());
+      mapped->Prefetch();
+      int event = 0;
+      t->SetBranchAddress("event", &event);
+      for (int i = 0; i < nentries; i += 13) {
+         ASSERT_GT(t->GetEntryWithIndex((i * 7) % 13, nentries - i), 0);
+         EXPECT_EQ(nentries - i, event);
+      }
+      EXPECT_EQ(-1, t->GetEntryNumberWithIndex(100, 1));
+      t->ResetBranchAddresses();
+   }
+
+   gSystem->Unlink(fileName);
+   gSystem->Unlink(indexName);
+}
+
+TEST(TTreeIndexMapped, InvalidFile)
+{
+   const auto indexName = "ttreeindexmapped_invalid.idx";
+   {
+      TFile f(indexName, "RECREATE");
+   }
+   RErrorIgnoreRAII errIgnRAII;
+   TTreeIndexMapped mapped(nullptr, indexName);
+   EXPECT_TRUE(mapped.IsZombie());
+   EXPECT_EQ(0, mapped.GetN());
+   EXPECT_EQ(-1, mapped.GetEntryNumberWithIndex(0, 0));
+   gSystem->Unlink(indexName);
+}
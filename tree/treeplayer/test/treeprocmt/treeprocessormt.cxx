@@ -1,12 +1,17 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <memory>
 #include <random>
+#include <set>
 #include <string>
 #include <thread>
 #include <utility>
 
+#include <TChain.h>
 #include <TFile.h>
+#include <TH1.h>
 #include <TTree.h>
 #include <TSystem.h>
 #include <TTreeReader.h>
@@ -280,18 +285,14 @@ TEST(TreeProcessorMT, LimitNTasks_CheckEntries)
    const auto filename = "TreeProcessorMT_LimitNTasks_CheckEntries.root";
    const auto treename = "t";
    WriteFileManyClusters(nEvents, treename, filename);
-   auto nTasks = 0U;
-   std::map<unsigned int, unsigned int> nEntriesCountsMap;
+   std::vector<unsigned int> nEntriesPerTask;
    std::mutex theMutex;
    auto f = [&](TTreeReader &t) {
       auto nentries = 0U;
       while (t.Next())
          nentries++;
       std::lock_guard<std::mutex> lg(theMutex);
-      nTasks++;
-      if (!nEntriesCountsMap.insert({nentries, 1U}).second) {
-         nEntriesCountsMap[nentries]++;
-      }
+      nEntriesPerTask.emplace_back(nentries);
    };
 
    const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
@@ -300,26 +301,61 @@ TEST(TreeProcessorMT, LimitNTasks_CheckEntries)
    ROOT::TTreeProcessorMT p(filename, treename);
    p.Process(f);
 
+   // each task takes 1/nslots of the clusters left, but at least 1/(10 * nslots) of the clusters of the file
+   std::sort(nEntriesPerTask.begin(), nEntriesPerTask.end(), std::greater<unsigned int>());
    if (nslots == 4) {
-      EXPECT_EQ(nTasks, 40U) << "Wrong number of tasks generated!\n";
-      EXPECT_EQ(nEntriesCountsMap[24], 9U) << "Wrong number of tasks with 24 clusters each!\n";
-      EXPECT_EQ(nEntriesCountsMap[25], 31U) << "Wrong number of tasks with 25 clusters each!\n";
-   }
-   else if (nslots == 2) {
-      EXPECT_EQ(nTasks, 20U) << "Wrong number of tasks generated!\n";
-      EXPECT_EQ(nEntriesCountsMap[49], 9U) << "Wrong number of tasks with 49 clusters each!\n";
-      EXPECT_EQ(nEntriesCountsMap[50], 11U) << "Wrong number of tasks with 50 clusters each!\n";
-   }
-   else if (nslots == 1) {
-      EXPECT_EQ(nTasks, 10U) << "Wrong number of tasks generated!\n";
-      EXPECT_EQ(nEntriesCountsMap[99], 9U) << "Wrong number of tasks with 99 clusters each!\n";
-      EXPECT_EQ(nEntriesCountsMap[100], 1U) << "Wrong number of tasks with 100 clusters each!\n";
+      const std::vector<unsigned int> expected{247, 186, 139, 104, 78, 59, 44, 33, 25, 24, 24, 24, 4};
+      EXPECT_EQ(nEntriesPerTask, expected) << "Wrong number of clusters per task!\n";
+   } else if (nslots == 2) {
+      const std::vector<unsigned int> expected{495, 248, 124, 62, 49, 13};
+      EXPECT_EQ(nEntriesPerTask, expected) << "Wrong number of clusters per task!\n";
+   } else if (nslots == 1) {
+      const std::vector<unsigned int> expected{991};
+      EXPECT_EQ(nEntriesPerTask, expected) << "Wrong number of clusters per task!\n";
    }
 
    gSystem->Unlink(filename);
    ROOT::DisableImplicitMT();
 }
 
+TEST(TreeProcessorMT, ReaderReusedAcrossTasks)
+{
+   const auto nEvents = 200;
+   const auto filename = "TreeProcessorMT_ReaderReusedAcrossTasks.root";
+   const auto treename = "t";
+   WriteFileManyClusters(nEvents, treename, filename);
+
+   const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
+   ROOT::EnableImplicitMT(nslots);
+
+   std::mutex m;
+   std::set<TTreeReader *> readers;
+   auto nTasks = 0u;
+   auto nEntries = 0u;
+   auto f = [&](TTreeReader &r) {
+      // value readers are created anew at every task, also when the reader is reused
+      TTreeReaderValue<int> v(r, "v");
+      auto n = 0u;
+      while (r.Next())
+         n += 1u + *v;
+      std::lock_guard<std::mutex> lg(m);
+      readers.insert(&r);
+      ++nTasks;
+      nEntries += n;
+   };
+
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(f);
+
+   EXPECT_EQ(nEntries, 200u);
+   if (nslots > 1) // a single worker processes the file in a single task
+      EXPECT_GT(nTasks, readers.size());
+   EXPECT_LE(readers.size(), nslots);
+
+   gSystem->Unlink(filename);
+   ROOT::DisableImplicitMT();
+}
+
 void CheckClusters(std::vector<std::pair<Long64_t, Long64_t>> &clusters, Long64_t entries)
 {
    using R = std::pair<Long64_t, Long64_t>;
@@ -518,3 +554,62 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+// TTree::Draw fills the histograms with fixed limits with the threads of a TTreeProcessorMT
+TEST(TreeProcessorMT, TTreeDraw)
+{
+   const auto filename = "TreeProcessorMT_TTreeDraw.root";
+   {
+      TFile f(filename, "recreate");
+      TTree t("t", "t");
+      int n = 0;
+      double x = 0;
+      float arr[5];
+      t.Branch("n", &n);
+      t.Branch("x", &x);
+      t.Branch("arr", arr, "arr[n]/F");
+      for (auto i = 0; i < 5000; ++i) {
+         n = i % 6;
+         x = 0.002 * i - 5;
+         for (auto j = 0; j < n; ++j)
+            arr[j] = std::sin(i * j);
+         t.Fill();
+         if (i % 100 == 99)
+            t.FlushBaskets();
+      }
+      t.Write();
+   }
+
+   auto draw = [&](const char *varexp, const char *selection, const char *option, Long64_t nentries,
+                   Long64_t firstentry) {
+      TChain c("t");
+      c.Add(filename);
+      c.Add(filename);
+      c.Draw(varexp, selection, option, nentries, firstentry);
+      auto h = static_cast<TH1 *>(gDirectory->Get("h"));
+      EXPECT_NE(h, nullptr) << varexp;
+      std::unique_ptr<TH1> res(static_cast<TH1 *>(h->Clone("hres")));
+      res->SetDirectory(nullptr);
+      delete h;
+      return res;
+   };
+   auto compare = [&](const char *varexp, const char *selection, const char *option = "goff",
+                      Long64_t nentries = TTree::kMaxEntries, Long64_t firstentry = 0) {
+      const auto expected = draw(varexp, selection, option, nentries, firstentry);
+      ROOT::EnableImplicitMT(4);
+      const auto res = draw(varexp, selection, option, nentries, firstentry);
+      ROOT::DisableImplicitMT();
+      EXPECT_EQ(res->GetEntries(), expected->GetEntries()) << varexp;
+      EXPECT_NEAR(res->GetSumOfWeights(), expected->GetSumOfWeights(), 1e-6) << varexp;
+      for (auto bin = 0; bin < expected->GetNcells(); ++bin)
+         EXPECT_NEAR(res->GetBinContent(bin), expected->GetBinContent(bin), 1e-6) << varexp << " bin " << bin;
+   };
+
+   compare("x>>h(40,-5,6)", "");
+   compare("x>>h(40,-5,6)", "n > 2 && x < 3", "goff", 7000, 1500);
+   compare("arr:x>>h(20,-5,6,20,-1,1)", "arr > -0.5");
+   compare("arr*x>>h(30,-5,5)", "(n % 2) * 0.5");
+   compare("arr:x>>h(25,-5,5)", "", "prof goff", TTree::kMaxEntries, 3000);
+
+   gSystem->Unlink(filename);
+}